@@ -6,6 +6,8 @@ BSLS_IDENT_RCSID(balber_berdecoder_cpp, "$Id$ $CSID$")
 
 #include <balber_berencoder.h>          // for testing only
 
+#include <bsl_cstring.h>
+
 namespace BloombergLP {
 
                    // --------------------------------------
@@ -34,6 +36,10 @@ BerDecoder::BerDecoder(const BerDecoderOptions *options,
 , d_numUnknownElementsSkipped(0)
 , d_topNode(0)
 , d_arrayLengthHint(0)
+, d_memStreamBuf(0)
+, d_memEnd(0)
+, d_blobStreamBuf(0)
+, d_viewAllocator(d_allocator)
 {
 }
 
@@ -69,6 +75,105 @@ BerDecoder::ErrorSeverity BerDecoder::logMsg(const char *prefix,
     return d_severity;
 }
 
+int BerDecoder::readStringView(bsl::string_view *value, int length)
+{
+    BSLS_ASSERT(0 < length);
+
+    typedef bsl::char_traits<char> Traits;
+
+    const bsl::ios_base::seekdir  k_CUR = bsl::ios_base::cur;
+    const bsl::ios_base::openmode k_IN  = bsl::ios_base::in;
+
+    if (d_memStreamBuf) {
+        // The input is contiguous: refer to it.
+
+        const bsl::size_t numRemaining = d_memStreamBuf->length();
+        if (numRemaining < static_cast<bsl::size_t>(length)) {
+            return -1;                                                // RETURN
+        }
+
+        const char *data = d_memEnd - numRemaining;
+        d_memStreamBuf->pubseekoff(length, k_CUR, k_IN);
+
+        *value = bsl::string_view(data, length);
+        return 0;                                                     // RETURN
+    }
+
+    char *data;
+
+    if (d_blobStreamBuf) {
+        const bdlbb::Blob&   blob     = *d_blobStreamBuf->data();
+        const bsl::streamoff position = d_blobStreamBuf->pubseekoff(0,
+                                                                    k_CUR,
+                                                                    k_IN);
+
+        if (blob.length() - position < length) {
+            return -1;                                                // RETURN
+        }
+
+        // Make the blob buffer holding the next byte the current one.
+
+        if (Traits::eq_int_type(Traits::eof(), d_blobStreamBuf->sgetc())) {
+            return -1;                                                // RETURN
+        }
+
+        const int                index  =
+                                         d_blobStreamBuf->currentBufferIndex();
+        const bdlbb::BlobBuffer& buffer = blob.buffer(index);
+        const int                offset =
+                                      static_cast<int>(position) -
+                                      d_blobStreamBuf->previousBuffersLength();
+
+        if (buffer.size() - offset >= length) {
+            // The bytes do not straddle two blob buffers: refer to them.
+
+            d_blobStreamBuf->pubseekoff(length, k_CUR, k_IN);
+
+            *value = bsl::string_view(buffer.data() + offset, length);
+            return 0;                                                 // RETURN
+        }
+
+        data = static_cast<char *>(d_viewAllocator.allocate(length));
+        if (length != d_blobStreamBuf->sgetn(data, length)) {
+            return -1;                                                // RETURN
+        }
+    }
+    else {
+        // The length of the input is unknown and 'length' could be corrupt,
+        // so, as 'BerUtil' does for strings, allocate no more than
+        // 'k_MAX_INITIAL_ALLOCATION' bytes until that many have been read.
+
+        static const int k_MAX_INITIAL_ALLOCATION = 16 * 1024 * 1024;
+
+        const int initialLength = length < k_MAX_INITIAL_ALLOCATION
+                                ? length
+                                : k_MAX_INITIAL_ALLOCATION;
+
+        data = static_cast<char *>(d_viewAllocator.allocate(initialLength));
+        if (initialLength != d_streamBuf->sgetn(data, initialLength)) {
+            return -1;                                                // RETURN
+        }
+
+        if (length > initialLength) {
+            // 'length' is now plausible: move the bytes read to storage for
+            // all of them (the first block is reclaimed with the arena).
+
+            char *all = static_cast<char *>(d_viewAllocator.allocate(length));
+            bsl::memcpy(all, data, initialLength);
+            data = all;
+
+            const int restLength = length - initialLength;
+            if (restLength != d_streamBuf->sgetn(data + initialLength,
+                                                 restLength)) {
+                return -1;                                            // RETURN
+            }
+        }
+    }
+
+    *value = bsl::string_view(data, length);
+    return 0;
+}
+
 int BerDecoder::decodeAny(bsl::streambuf *streamBuf, bdlar::AnyRef *any)
 {
     return decode(streamBuf, any);
@@ -238,6 +343,51 @@ int BerDecoder_Node::decode(bsl::vector<unsigned char> *variable,
     }
 }
 
+int BerDecoder_Node::decode(bsl::string_view           *variable,
+                            bdlat_TypeCategory::Simple  )
+{
+    if (d_tagType != BerConstants::e_PRIMITIVE) {
+        return logError("Expected PRIMITIVE tag type for 'string_view'");
+                                                                      // RETURN
+    }
+
+    if (d_expectedLength < 0) {
+        return logError("'string_view' with indefinite length "
+                        "is not supported at this time");             // RETURN
+    }
+
+    if (0 == d_expectedLength) {
+        if (!d_decoder->decoderOptions()->defaultEmptyStrings()) {
+            *variable = bsl::string_view();
+        }
+        return BerDecoder::e_BER_SUCCESS;                             // RETURN
+    }
+
+    if (0 != d_decoder->readStringView(variable, d_expectedLength)) {
+        return logError("Stream error while reading 'string_view'");
+                                                                      // RETURN
+    }
+
+    d_consumedBodyBytes = d_expectedLength;
+
+    return BerDecoder::e_BER_SUCCESS;
+}
+
+int BerDecoder_Node::decode(bslstl::StringRef          *variable,
+                            bdlat_TypeCategory::Simple  )
+{
+    bsl::string_view value(variable->data(), variable->length());
+
+    const int rc = this->decode(&value, bdlat_TypeCategory::Simple());
+    if (rc != BerDecoder::e_BER_SUCCESS) {
+        return rc;  // error message is already logged                // RETURN
+    }
+
+    *variable = bslstl::StringRef(value.data(), value.length());
+
+    return BerDecoder::e_BER_SUCCESS;
+}
+
 int BerDecoder_Node::readTagHeader()
 {
     if (d_decoder->maxDepthExceeded()) {
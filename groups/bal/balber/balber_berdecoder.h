@@ -16,13 +16,38 @@ BSLS_IDENT("$Id: $")
 // that contains a parameterized `decode` function.  The `decode` function
 // decodes data read from a specified stream and loads the corresponding object
 // to an object of the parameterized type.  The `decode` method is overloaded
-// for two types of input streams:
+// for four types of input:
 // * `bsl::streambuf`
 // * `bsl::istream`
+// * a contiguous buffer, specified by its address and length
+// * `bdlbb::Blob`
 //
 // This class decodes objects based on the X.690 BER specification and is
 // restricted to types supported by the `bdlat` framework.
 //
+///Decoding From Buffers and Blobs
+///-------------------------------
+// When the encoded message is held in memory, it may be supplied to `decode`
+// directly, as a buffer or as a `bdlbb::Blob`, rather than through a stream.
+// Such input is read through a `bdlsb::FixedMemInStreamBuf` or a
+// `bdlbb::InBlobStreamBuf`, so tags, lengths, and most values are decoded
+// exactly as from a stream buffer supplied by the caller; what these
+// overloads add is that the decoder knows where the encoded bytes lie.
+//
+// `bsl::string_view` and `bslstl::StringRef` objects, which can be encoded by
+// `balber::BerEncoder`, can be decoded by this component, and may be used as
+// (or within) the types of the fields of decoded objects in place of
+// `bsl::string` and `bsl::vector<char>`.  Such an object is loaded *without
+// copying*, referring to the encoded bytes in the input, if those bytes are
+// contiguous in the input -- that is, always when decoding from a buffer, and
+// when decoding from a blob unless the bytes straddle two blob buffers.
+// Otherwise (including whenever decoding from a stream), the bytes are copied
+// once, directly into memory owned by the decoder.
+// Therefore, the objects so decoded remain valid only while *both* the input
+// remains unmodified *and* the decoder is neither destroyed nor used to
+// decode another message.  Note that `bsl::string` and `bsl::vector<char>`
+// own their contents, and so are always copied from the input.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -78,6 +103,38 @@ BSLS_IDENT("$Id: $")
 // assert(bob.age()    == obj.age());
 // assert(bob.salary() == obj.salary());
 // ```
+//
+///Example 2: Decoding Strings Without Copying
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive BER-encoded messages in memory, and that we wish to
+// examine the strings they hold without copying each of them into a
+// `bsl::string`.  For simplicity, our message is a single string, but
+// `bsl::string_view` attributes of sequences and choices, and arrays of
+// `bsl::string_view`, are decoded in the same way.
+//
+// First, we encode a string, as a sender would:
+// ```
+// bsl::string greeting("Hello, world!");
+//
+// bdlsb::MemOutStreamBuf greetingOsb;
+// rc = encoder.encode(&greetingOsb, greeting);
+// assert(0 == rc);
+// ```
+// Then, we decode the encoding directly from the buffer holding it into a
+// `bsl::string_view` object:
+// ```
+// bsl::string_view view;
+//
+// rc = decoder.decode(greetingOsb.data(), greetingOsb.length(), &view);
+// assert(0 == rc);
+// ```
+// Finally, we observe that the decoded string has the expected value, and
+// that it refers to the encoded bytes themselves, which follow the one-byte
+// tag and the one-byte length of the encoding:
+// ```
+// assert(greeting                == view);
+// assert(greetingOsb.data() + 2 == view.data());
+// ```
 
 #include <balscm_version.h>
 
@@ -101,6 +158,12 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlb_variant.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobstreambuf.h>
+
+#include <bdlma_sequentialallocator.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
 #include <bdlsb_memoutstreambuf.h>
 
 #include <bslma_allocator.h>
@@ -111,9 +174,11 @@ BSLS_IDENT("$Id: $")
 #include <bsls_platform.h>
 #include <bsls_review.h>
 
+#include <bsl_cstddef.h>
 #include <bsl_istream.h>
 #include <bsl_ostream.h>
 #include <bsl_string.h>
+#include <bsl_string_view.h>
 #include <bsl_vector.h>
 
 namespace BloombergLP {
@@ -216,6 +281,25 @@ class BerDecoder {
     int                              d_arrayLengthHint;
                                                      // length hint
 
+    bdlsb::FixedMemInStreamBuf      *d_memStreamBuf; // if not zero, the
+                                                     // stream buffer over the
+                                                     // contiguous input (held,
+                                                     // not owned)
+
+    const char                      *d_memEnd;       // end of contiguous input
+
+    bdlbb::InBlobStreamBuf          *d_blobStreamBuf;
+                                                     // if not zero, the
+                                                     // stream buffer over the
+                                                     // blob input (held, not
+                                                     // owned)
+
+    bdlma::SequentialAllocator       d_viewAllocator;
+                                                     // storage for decoded
+                                                     // string views that
+                                                     // cannot refer to the
+                                                     // input
+
     // NOT IMPLEMENTED
     BerDecoder(const BerDecoder&);             // = delete;
     BerDecoder& operator=(const BerDecoder&);  // = delete;
@@ -240,6 +324,14 @@ class BerDecoder {
     /// yet, it will be created during this call.
     bsl::ostream& logStream();
 
+    /// Load into the specified `value` a reference to the next `length`
+    /// bytes of the input, and advance the input past those bytes.  Return
+    /// 0 on success, and a non-zero value if fewer than `length` bytes
+    /// remain.  The referenced bytes are those of the input if they are
+    /// contiguous in the input, and a copy held in storage owned by this
+    /// decoder otherwise.  The behavior is undefined unless `0 < length`.
+    int readStringView(bsl::string_view *value, int length);
+
   public:
     // CREATORS
 
@@ -270,6 +362,27 @@ class BerDecoder {
     template <typename TYPE>
     int decode(bsl::istream& stream, TYPE *variable);
 
+    /// Decode an object of parameterized `TYPE` from the specified `buffer`
+    /// having the specified `length` and load the result into the specified
+    /// `variable`.  Return 0 on success, and a non-zero value otherwise.
+    /// Any `bsl::string_view` and `bslstl::StringRef` objects within
+    /// `variable` refer to the bytes of `buffer`.  The behavior is undefined
+    /// unless `buffer` remains unmodified while those objects are in use.
+    /// See {Decoding From Buffers and Blobs}.
+    template <typename TYPE>
+    int decode(const char *buffer, bsl::size_t length, TYPE *variable);
+
+    /// Decode an object of parameterized `TYPE` from the data of the
+    /// specified `blob` and load the result into the specified `variable`.
+    /// Return 0 on success, and a non-zero value otherwise.  Any
+    /// `bsl::string_view` and `bslstl::StringRef` objects within `variable`
+    /// refer to the data of `blob` unless they straddle two of its buffers.
+    /// The behavior is undefined unless the data of `blob` remains
+    /// unmodified while those objects are in use.  See {Decoding From Buffers
+    /// and Blobs}.
+    template <typename TYPE>
+    int decode(const bdlbb::Blob& blob, TYPE *variable);
+
     /// Decode an object of parameterized `TYPE` from the specified `streamBuf`
     /// and load the result into the specified `variable`.  Return 0 on
     /// success, and a non-zero value otherwise.  Note that this function
@@ -367,6 +480,8 @@ class BerDecoder_Node {
     int decode(bsl::vector<char> *variable, bdlat_TypeCategory::Array);
     int decode(bsl::vector<unsigned char> *variable,
                bdlat_TypeCategory::Array);
+    int decode(bsl::string_view *variable, bdlat_TypeCategory::Simple);
+    int decode(bslstl::StringRef *variable, bdlat_TypeCategory::Simple);
     template <typename TYPE>
     int decode(TYPE *variable, bdlat_TypeCategory::Array);
     template <typename TYPE>
@@ -662,6 +777,8 @@ int BerDecoder::decode(bsl::streambuf *streamBuf, TYPE *variable)
 {
     BSLS_ASSERT(0 == d_streamBuf);
 
+    d_viewAllocator.release();
+
     d_streamBuf                 = streamBuf;
     d_currentDepth              = 0;
     d_severity                  = e_BER_SUCCESS;
@@ -693,6 +810,44 @@ int BerDecoder::decode(bsl::streambuf *streamBuf, TYPE *variable)
     return rc;
 }
 
+template <typename TYPE>
+int BerDecoder::decode(const char *buffer, bsl::size_t length, TYPE *variable)
+{
+    BSLS_ASSERT(buffer || 0 == length);
+
+    bdlsb::FixedMemInStreamBuf streamBuf(buffer, length);
+
+    d_memStreamBuf = &streamBuf;
+    d_memEnd       = buffer + length;
+
+    const int rc = decode(&streamBuf, variable);
+
+    d_memStreamBuf = 0;
+    d_memEnd       = 0;
+    return rc;
+}
+
+template <typename TYPE>
+int BerDecoder::decode(const bdlbb::Blob& blob, TYPE *variable)
+{
+    if (blob.numDataBuffers() <= 1) {
+        // The data of 'blob', if any, is contiguous.
+
+        const char *data = 0 == blob.numDataBuffers() ? 0
+                                                      : blob.buffer(0).data();
+        return decode(data, blob.length(), variable);                 // RETURN
+    }
+
+    bdlbb::InBlobStreamBuf streamBuf(&blob);
+
+    d_blobStreamBuf = &streamBuf;
+
+    const int rc = decode(&streamBuf, variable);
+
+    d_blobStreamBuf = 0;
+    return rc;
+}
+
 template <typename TYPE>
 inline
 int BerDecoder::decodeAny(bsl::istream& stream, TYPE *variable)
@@ -39,6 +39,9 @@
 #include <bdlat_selectioninfo.h>
 #include <bdlat_valuetypefunctions.h>
 #include <bdlb_string.h>
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_simpleblobbufferfactory.h>
 #include <bdlsb_memoutstreambuf.h>      // for testing only
 #include <bdlsb_fixedmeminstreambuf.h>  // for testing only
 
@@ -92,6 +95,9 @@ namespace test = BloombergLP::s_baltst;
 // [19] int BerDeocder::decode(bsl::istream&   stream   , TYPE *variable)
 //
 // [20] int decode(bsl::streambuf *streamBuf, TYPE *variable)
+//
+// [26] int decode(const char *buffer, bsl::size_t length, TYPE *variable)
+// [26] int decode(const bdlbb::Blob& blob, TYPE *variable)
 // ----------------------------------------------------------------------------
 // [ 1] FUNDAMENTALS TEST
 // [ 2] ENCODE AND DECODE REAL/FLOATING-POINT
@@ -118,7 +124,8 @@ namespace test = BloombergLP::s_baltst;
 // [23] FUZZ TEST BUG (DRQS 175594554)
 // [24] FUZZ TEST BUG (DRQS 175741365)
 // [25] MAXDEPTH IS RESPECTED
-// [26] USAGE EXAMPLE
+// [26] DECODE FROM BUFFERS AND BLOBS
+// [27] USAGE EXAMPLE
 //
 // [-1] PERFORMANCE TEST
 
@@ -1855,6 +1862,101 @@ struct IsEnumeration<test::Enumeration1> : public bsl::true_type {
 }  // close namespace bdlat_EnumFunctions
 }  // close enterprise namespace
 
+namespace BloombergLP {
+namespace s_baltst {
+
+                       // ===========================
+                       // class MyStringArraySequence
+                       // ===========================
+
+/// This class template provides a sequence having a single attribute, an
+/// array of the (template parameter) `ELEMENT_TYPE`, so that arrays of
+/// `bsl::string` may be encoded and then decoded as arrays of
+/// `bsl::string_view` or `bslstl::StringRef`.
+template <class ELEMENT_TYPE>
+class MyStringArraySequence {
+
+    // DATA
+    bsl::vector<ELEMENT_TYPE> d_elements;
+
+    /// Return the information describing the attribute having the specified
+    /// `attributeId`.
+    static bdlat_AttributeInfo attributeInfo(int attributeId)
+    {
+        bdlat_AttributeInfo info;
+        info.formattingMode() = bdlat_FormattingMode::e_DEFAULT;
+        info.id()             = attributeId;
+        info.name()           = "elements";
+        info.nameLength()     = 8;
+        return info;
+    }
+
+    template <class MANIPULATOR>
+    friend int bdlat_sequenceManipulateAttribute(
+                                           MyStringArraySequence *object,
+                                           MANIPULATOR&           manipulator,
+                                           int                    attributeId)
+    {
+        if (0 != attributeId) {
+            return -1;                                                // RETURN
+        }
+        return manipulator(&object->d_elements, attributeInfo(attributeId));
+    }
+
+    template <class MANIPULATOR>
+    friend int bdlat_sequenceManipulateAttributes(
+                                           MyStringArraySequence *object,
+                                           MANIPULATOR&           manipulator)
+    {
+        return bdlat_sequenceManipulateAttribute(object, manipulator, 0);
+    }
+
+    template <class ACCESSOR>
+    friend int bdlat_sequenceAccessAttribute(
+                                       const MyStringArraySequence& object,
+                                       ACCESSOR&                    accessor,
+                                       int                          attributeId)
+    {
+        if (0 != attributeId) {
+            return -1;                                                // RETURN
+        }
+        return accessor(object.d_elements, attributeInfo(attributeId));
+    }
+
+    template <class ACCESSOR>
+    friend int bdlat_sequenceAccessAttributes(
+                                          const MyStringArraySequence& object,
+                                          ACCESSOR&                    accessor)
+    {
+        return bdlat_sequenceAccessAttribute(object, accessor, 0);
+    }
+
+    friend bool bdlat_sequenceHasAttribute(const MyStringArraySequence&,
+                                           int attributeId)
+    {
+        return 0 == attributeId;
+    }
+
+  public:
+    // MANIPULATORS
+
+    /// Return a reference providing modifiable access to the array held by
+    /// this object.
+    bsl::vector<ELEMENT_TYPE>& elements()
+    {
+        return d_elements;
+    }
+};
+}  // close namespace s_baltst
+
+namespace bdlat_SequenceFunctions {
+template <class ELEMENT_TYPE>
+struct IsSequence<test::MyStringArraySequence<ELEMENT_TYPE> >
+: public bsl::true_type {
+};
+}  // close namespace bdlat_SequenceFunctions
+}  // close enterprise namespace
+
 // ============================================================================
 //                               USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -2302,6 +2404,38 @@ static void usageExample()
     ASSERT(bob.age()    == obj.age());
     ASSERT(bob.salary() == obj.salary());
 // ```
+//
+///Example 2: Decoding Strings Without Copying
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive BER-encoded messages in memory, and that we wish to
+// examine the strings they hold without copying each of them into a
+// `bsl::string`.  For simplicity, our message is a single string, but
+// `bsl::string_view` attributes of sequences and choices, and arrays of
+// `bsl::string_view`, are decoded in the same way.
+//
+// First, we encode a string, as a sender would:
+// ```
+    bsl::string greeting("Hello, world!");
+
+    bdlsb::MemOutStreamBuf greetingOsb;
+    rc = encoder.encode(&greetingOsb, greeting);
+    ASSERT(0 == rc);
+// ```
+// Then, we decode the encoding directly from the buffer holding it into a
+// `bsl::string_view` object:
+// ```
+    bsl::string_view view;
+
+    rc = decoder.decode(greetingOsb.data(), greetingOsb.length(), &view);
+    ASSERT(0 == rc);
+// ```
+// Finally, we observe that the decoded string has the expected value, and
+// that it refers to the encoded bytes themselves, which follow the one-byte
+// tag and the one-byte length of the encoding:
+// ```
+    ASSERT(greeting                == view);
+    ASSERT(greetingOsb.data() + 2 == view.data());
+// ```
 }
 
 // ============================================================================
@@ -2318,6 +2452,25 @@ static void usageExample()
 #define main test_driver_main
 #endif
 
+/// Return `true` if the specified `data` of the specified `length` lies
+/// entirely within the data of a single buffer of the specified `blob`, and
+/// `false` otherwise.
+static bool isWithinOneBuffer(const char         *data,
+                              bsl::size_t         length,
+                              const bdlbb::Blob&  blob)
+{
+    for (int i = 0; i < blob.numDataBuffers(); ++i) {
+        const char *begin = blob.buffer(i).data();
+        const char *end   = begin + (i == blob.numDataBuffers() - 1
+                                     ? blob.lastDataBufferLength()
+                                     : blob.buffer(i).size());
+        if (begin <= data && data + length <= end) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
 /// Try to deserialize an object of the specified `TYPE` from the specified
 /// span of bytes [`bytes`, `bytes` + `size`).  Return `true` on success.
 template <class TYPE>
@@ -2410,7 +2563,7 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 26: {
+      case 27: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -2434,6 +2587,243 @@ int main(int argc, char *argv[])
 
         if (verbose) cout << "\nEnd of test.\n";
       } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // DECODE FROM BUFFERS AND BLOBS
+        //
+        // Concerns:
+        // 1. Decoding from a buffer, or from a blob having any number of data
+        //    buffers of any size, produces the same value as decoding from a
+        //    stream buffer over the same bytes.
+        //
+        // 2. `bsl::string_view` and `bslstl::StringRef` objects are decoded
+        //    with the values of the encoded strings, including empty strings
+        //    and strings whose lengths are encoded in the long form.
+        //
+        // 3. Decoded string views refer to the input when decoding from a
+        //    buffer, and when decoding from a blob unless the string
+        //    straddles two blob buffers.
+        //
+        // 4. Decoded string views that cannot refer to the input are copied
+        //    once, directly to memory owned by the decoder, which is
+        //    reclaimed by the next decoding operation and on destruction.
+        //
+        // 5. Truncated input is reported as an error for every kind of input.
+        //
+        // Plan:
+        // 1. Encode a `TimingRequest` holding a `BigRecord`, decode it from
+        //    a stream buffer, a buffer, and blobs made of buffers of various
+        //    sizes, and compare the results.  (C-1)
+        //
+        // 2. Encode an array of strings of various lengths, decode it into
+        //    arrays of `bsl::string_view` and `bslstl::StringRef` from each
+        //    kind of input, compare the values, and check where each decoded
+        //    string view points.  Use a test allocator to detect leaks.
+        //    (C-2..4)
+        //
+        // 3. Decode all but the last byte of each encoding from each kind of
+        //    input, and verify that decoding fails.  (C-5)
+        //
+        // Testing:
+        //   int decode(const char *buffer, bsl::size_t length, TYPE *variable)
+        //   int decode(const bdlbb::Blob& blob, TYPE *variable)
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nDECODE FROM BUFFERS AND BLOBS"
+                             "\n=============================\n";
+
+        static const int BUFFER_SIZES[] = { 1, 2, 3, 5, 8, 13, 64, 1024 };
+        enum { NUM_BUFFER_SIZES = sizeof BUFFER_SIZES / sizeof *BUFFER_SIZES };
+
+        if (verbose) cout << "\nDecoding a complex message.\n";
+        {
+            test::BasicRecord basicRec;
+            basicRec.i1() = 11;
+            basicRec.i2() = 22;
+            basicRec.dt() = bdlt::DatetimeTz(
+                                     bdlt::Datetime(bdlt::Date(2007, 9, 3),
+                                                    bdlt::Time(16, 30)), 0);
+            basicRec.s()  = "The quick brown fox jumped over the lazy dog.";
+
+            test::BigRecord bigRec;
+            bigRec.name() = "This record is so big, it has its own gravity.";
+            for (int i = 0; i < 10; ++i) {
+                bigRec.array().push_back(basicRec);
+            }
+
+            test::TimingRequest request;
+            request.makeBig(bigRec);
+
+            bdlsb::MemOutStreamBuf osb;
+            ASSERT(0 == encoder.encode(&osb, request));
+
+            const char *DATA   = osb.data();
+            const int   LENGTH = static_cast<int>(osb.length());
+
+            test::TimingRequest        expected;
+            bdlsb::FixedMemInStreamBuf isb(DATA, LENGTH);
+            ASSERT(0 == decoder.decode(&isb, &expected));
+            ASSERT(request == expected);
+
+            test::TimingRequest fromBuffer;
+            ASSERT(0 == decoder.decode(DATA, LENGTH, &fromBuffer));
+            ASSERT(expected == fromBuffer);
+
+            test::TimingRequest truncated;
+            ASSERT(0 != decoder.decode(DATA, LENGTH - 1, &truncated));
+
+            for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+                const int BUFFER_SIZE = BUFFER_SIZES[ti];
+
+                bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE, &ta);
+                bdlbb::Blob                    blob(&factory, &ta);
+                bdlbb::BlobUtil::append(&blob, DATA, 0, LENGTH);
+
+                test::TimingRequest fromBlob;
+                ASSERTV(BUFFER_SIZE, 0 == decoder.decode(blob, &fromBlob));
+                ASSERTV(BUFFER_SIZE, expected == fromBlob);
+
+                blob.setLength(LENGTH - 1);
+                ASSERTV(BUFFER_SIZE, 0 != decoder.decode(blob, &truncated));
+            }
+        }
+
+        if (verbose) cout << "\nDecoding string views.\n";
+        {
+            test::MyStringArraySequence<bsl::string> stringsSequence;
+            bsl::vector<bsl::string>& strings = stringsSequence.elements();
+            strings.push_back("");
+            strings.push_back("a");
+            strings.push_back("");
+            strings.push_back("bc");
+            strings.push_back(bsl::string(200, 'd'));
+            strings.push_back("efghijklmnopqrstuvwxyz");
+            strings.push_back(bsl::string(1000, 'z'));
+
+            bdlsb::MemOutStreamBuf osb;
+            ASSERT(0 == encoder.encode(&osb, stringsSequence));
+
+            const char *DATA   = osb.data();
+            const int   LENGTH = static_cast<int>(osb.length());
+
+            bslma::TestAllocator da("decoder", veryVeryVerbose);
+            balber::BerDecoder   mX(&options, &da);
+
+            test::MyStringArraySequence<bsl::string_view>  viewsSequence;
+            test::MyStringArraySequence<bslstl::StringRef> refsSequence;
+
+            bsl::vector<bsl::string_view>&  views = viewsSequence.elements();
+            bsl::vector<bslstl::StringRef>& refs  = refsSequence.elements();
+
+            if (veryVerbose) cout << "\tFrom a buffer.\n";
+
+            ASSERT(0 == mX.decode(DATA, LENGTH, &viewsSequence));
+            ASSERT(strings.size() == views.size());
+            for (bsl::size_t i = 0; i < views.size(); ++i) {
+                const bsl::string_view& VIEW = views[i];
+
+                ASSERTV(i, strings[i] == VIEW);
+                ASSERTV(i, VIEW.empty() ||
+                               (DATA <= VIEW.data() &&
+                                VIEW.data() + VIEW.size() <= DATA + LENGTH));
+            }
+            ASSERT(0 == da.numBytesInUse());
+
+            ASSERT(0 == mX.decode(DATA, LENGTH, &refsSequence));
+            ASSERT(strings.size() == refs.size());
+            for (bsl::size_t i = 0; i < refs.size(); ++i) {
+                ASSERTV(i, strings[i] == refs[i]);
+            }
+
+            ASSERT(0 != mX.decode(DATA, LENGTH - 1, &viewsSequence));
+
+            if (veryVerbose) cout << "\tFrom a stream buffer.\n";
+
+            {
+                // No temporary copy of a string is made: each block allocated
+                // by a new decoder is still in use by its view storage.
+
+                bslma::TestAllocator sa("stream decoder", veryVeryVerbose);
+                balber::BerDecoder   mY(&options, &sa);
+
+                bdlsb::FixedMemInStreamBuf isb(DATA, LENGTH);
+                ASSERT(0 == mY.decode(&isb, &viewsSequence));
+                ASSERT(0 <  sa.numBlocksInUse());
+                ASSERTV(sa.numBlocksTotal(), sa.numBlocksInUse(),
+                        sa.numBlocksTotal() == sa.numBlocksInUse());
+            }
+
+            bdlsb::FixedMemInStreamBuf isb(DATA, LENGTH);
+            ASSERT(0 == mX.decode(&isb, &viewsSequence));
+            ASSERT(strings.size() == views.size());
+            for (bsl::size_t i = 0; i < views.size(); ++i) {
+                const bsl::string_view& VIEW = views[i];
+
+                ASSERTV(i, strings[i] == VIEW);
+                ASSERTV(i, VIEW.data() + VIEW.size() <= DATA ||
+                                                 DATA + LENGTH <= VIEW.data());
+            }
+            ASSERT(0 < da.numBytesInUse());
+
+            isb.pubsetbuf(DATA, LENGTH - 1);
+            ASSERT(0 != mX.decode(&isb, &viewsSequence));
+
+            if (veryVerbose) cout << "\tFrom blobs.\n";
+
+            for (int ti = 0; ti < NUM_BUFFER_SIZES; ++ti) {
+                const int BUFFER_SIZE = BUFFER_SIZES[ti];
+
+                bdlbb::SimpleBlobBufferFactory factory(BUFFER_SIZE, &ta);
+                bdlbb::Blob                    blob(&factory, &ta);
+                bdlbb::BlobUtil::append(&blob, DATA, 0, LENGTH);
+
+                ASSERTV(BUFFER_SIZE, 0 == mX.decode(blob, &viewsSequence));
+                ASSERTV(BUFFER_SIZE, strings.size() == views.size());
+
+                int numReferenced = 0;
+                for (bsl::size_t i = 0; i < views.size(); ++i) {
+                    const bsl::string_view& VIEW = views[i];
+
+                    ASSERTV(BUFFER_SIZE, i, strings[i] == VIEW);
+
+                    if (VIEW.empty()) {
+                        continue;                                   // CONTINUE
+                    }
+
+                    if (isWithinOneBuffer(VIEW.data(), VIEW.size(), blob)) {
+                        ++numReferenced;
+                    }
+                }
+
+                // Every non-empty string is referenced if the blob has a
+                // single buffer, and only the one-byte string is referenced
+                // if each blob buffer holds a single byte.
+
+                if (LENGTH <= BUFFER_SIZE) {
+                    ASSERTV(BUFFER_SIZE, 5 == numReferenced);
+                }
+                if (1 == BUFFER_SIZE) {
+                    ASSERTV(BUFFER_SIZE, 1 == numReferenced);
+                }
+
+                blob.setLength(LENGTH - 1);
+                ASSERTV(BUFFER_SIZE, 0 != mX.decode(blob, &viewsSequence));
+            }
+
+            if (veryVerbose) cout << "\tA top-level string view.\n";
+
+            bsl::string_view view;
+            bdlsb::MemOutStreamBuf viewOsb;
+            ASSERT(0 == encoder.encode(&viewOsb, strings[5]));
+            ASSERT(0 == mX.decode(viewOsb.data(), viewOsb.length(), &view));
+            ASSERT(strings[5] == view);
+            ASSERT(viewOsb.data() + viewOsb.length() - view.size() ==
+                                                                  view.data());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nEnd of test.\n";
+      } break;
       case 25: {
         // --------------------------------------------------------------------
         // MAXDEPTH IS RESPECTED
@@ -8407,6 +8797,25 @@ int main(int argc, char *argv[])
         cout << "    balber::BerDecoder: "
              << elapsed          << " seconds, "
              << (reps / elapsed) << " reps/sec\n";
+
+        // Measure decoding directly from the buffer:
+        inRequests = new test::TimingRequest[reps];
+        stopwatch.reset();
+        stopwatch.start();
+        for (int i = 0; i < reps; ++i) {
+            balber::BerDecoder decoder;  // Typical usage: single-use object
+            decoder.decode(osb.data(), osb.length(), &inRequests[i]);
+        }
+        stopwatch.stop();
+
+        ASSERT(*inRequests == request);
+        elapsed = stopwatch.elapsedTime();
+        ASSERT(elapsed > 0);
+        delete[] inRequests;
+
+        cout << "    balber::BerDecoder (buffer): "
+             << elapsed          << " seconds, "
+             << (reps / elapsed) << " reps/sec\n";
       } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
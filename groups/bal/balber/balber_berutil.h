@@ -16,7 +16,8 @@ BSLS_IDENT("$Id: $")
 // decoding of primitive BER constructs, such as tag identifier octets, length
 // octets, fundamental C++ types.  The encoding and decoding of `bsl::string`
 // and BDE date/time types is also implemented.  For `bsl::string_view` and
-// `bslstl::StringRef` types only encoding is supported.
+// `bslstl::StringRef` types only encoding is supported; `balber_berdecoder`
+// decodes them by referring to its input.
 //
 // These utility functions operate on `bsl::streambuf` for buffer management.
 //
@@ -0,0 +1,263 @@
+// baljsn_bufferformatter.cpp                                         -*-C++-*-
+#include <baljsn_bufferformatter.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(baljsn_bufferformatter_cpp,"$Id$ $CSID$")
+
+#include <bdlde_utf8util.h>
+
+#include <bsla_fallthrough.h>
+
+namespace BloombergLP {
+namespace baljsn {
+
+                           // ---------------------
+                           // class BufferFormatter
+                           // ---------------------
+
+// PRIVATE MANIPULATORS
+int BufferFormatter::printString(const bsl::string_view&  value,
+                                 const EncoderOptions    *options)
+{
+    static const char k_HEX_DIGITS[] = "0123456789abcdef";
+
+    const bool escapeForwardSlash = !options || options->escapeForwardSlash();
+
+    const bsl::string::size_type length = d_buffer_p->length();
+
+    const char       *runStart = value.data();
+    const char *const end      = value.data() + value.length();
+    unsigned char     allBits  = 0;
+
+    d_buffer_p->push_back('"');
+
+    for (const char *iter = value.data(); iter < end; ++iter) {
+        const unsigned char ch = static_cast<unsigned char>(*iter);
+
+        allBits |= ch;
+
+        if (0x20 <= ch && '"' != ch && '\\' != ch && '/' != ch) {
+            continue;                                               // CONTINUE
+        }
+
+        char escape;
+        switch (ch) {
+          case '"':  BSLA_FALLTHROUGH;
+          case '\\': {
+            escape = static_cast<char>(ch);
+          } break;
+          case '/': {
+            if (!escapeForwardSlash) {
+                continue;                                           // CONTINUE
+            }
+            escape = '/';
+          } break;
+          case '\b': {
+            escape = 'b';
+          } break;
+          case '\f': {
+            escape = 'f';
+          } break;
+          case '\n': {
+            escape = 'n';
+          } break;
+          case '\r': {
+            escape = 'r';
+          } break;
+          case '\t': {
+            escape = 't';
+          } break;
+          default: {
+            escape = 'u';
+          } break;
+        }
+
+        d_buffer_p->append(runStart, iter - runStart);
+        d_buffer_p->push_back('\\');
+        d_buffer_p->push_back(escape);
+        if ('u' == escape) {
+            const char digits[] = { '0',
+                                    '0',
+                                    k_HEX_DIGITS[(ch & 0xF0) >> 4],
+                                    k_HEX_DIGITS[ ch & 0x0F] };
+            d_buffer_p->append(digits, sizeof digits);
+        }
+        runStart = iter + 1;
+    }
+
+    if ((allBits & 0x80)
+     && !bdlde::Utf8Util::isValid(value.data(),
+                                  static_cast<int>(value.length()))) {
+        // Only strings having a non-ASCII character need be validated.
+
+        d_buffer_p->resize(length);
+        return -2;                                                    // RETURN
+    }
+
+    d_buffer_p->append(runStart, end - runStart);
+    d_buffer_p->push_back('"');
+    return 0;
+}
+
+// CREATORS
+BufferFormatter::BufferFormatter(bsl::string      *buffer,
+                                 bool              usePrettyStyle,
+                                 int               initialIndentLevel,
+                                 int               spacesPerLevel,
+                                 bslma::Allocator *basicAllocator)
+: d_buffer_p(buffer)
+, d_usePrettyStyle(usePrettyStyle)
+, d_escapeForwardSlash(true)
+, d_indentLevel(initialIndentLevel)
+, d_spacesPerLevel(spacesPerLevel)
+, d_callSequence(basicAllocator)
+, d_encoderOptions()
+, d_scratch(basicAllocator)
+{
+    BSLS_ASSERT(buffer);
+
+    // Add a dummy value so we don't have to check whether 'd_callSequence' is
+    // empty in 'openObject' when we access its last element.
+
+    d_callSequence.append(false);
+
+    if (d_usePrettyStyle) {
+        d_encoderOptions.setEncodingStyle(EncodingStyle::e_PRETTY);
+    }
+    d_encoderOptions.setEscapeForwardSlash(d_escapeForwardSlash);
+    d_encoderOptions.setInitialIndentLevel(d_indentLevel);
+    d_encoderOptions.setSpacesPerLevel(d_spacesPerLevel);
+}
+
+BufferFormatter::BufferFormatter(bsl::string      *buffer,
+                                 bool              usePrettyStyle,
+                                 int               initialIndentLevel,
+                                 int               spacesPerLevel,
+                                 bool              escapeForwardSlash,
+                                 bslma::Allocator *basicAllocator)
+: d_buffer_p(buffer)
+, d_usePrettyStyle(usePrettyStyle)
+, d_escapeForwardSlash(escapeForwardSlash)
+, d_indentLevel(initialIndentLevel)
+, d_spacesPerLevel(spacesPerLevel)
+, d_callSequence(basicAllocator)
+, d_encoderOptions()
+, d_scratch(basicAllocator)
+{
+    BSLS_ASSERT(buffer);
+
+    // Add a dummy value so we don't have to check whether 'd_callSequence' is
+    // empty in 'openObject' when we access its last element.
+
+    d_callSequence.append(false);
+
+    if (d_usePrettyStyle) {
+        d_encoderOptions.setEncodingStyle(EncodingStyle::e_PRETTY);
+    }
+    d_encoderOptions.setEscapeForwardSlash(d_escapeForwardSlash);
+    d_encoderOptions.setInitialIndentLevel(d_indentLevel);
+    d_encoderOptions.setSpacesPerLevel(d_spacesPerLevel);
+}
+
+// MANIPULATORS
+void BufferFormatter::openObject()
+{
+    if (d_usePrettyStyle && isArrayElement()) {
+        indent();
+    }
+
+    d_buffer_p->push_back('{');
+
+    if (d_usePrettyStyle) {
+        d_buffer_p->push_back('\n');
+        ++d_indentLevel;
+        d_callSequence.append(false);
+    }
+}
+
+void BufferFormatter::closeObject()
+{
+    if (d_usePrettyStyle) {
+        --d_indentLevel;
+        d_buffer_p->push_back('\n');
+        indent();
+
+        BSLS_ASSERT(false == isArrayElement());
+        d_callSequence.remove(d_callSequence.length() - 1);
+    }
+
+    d_buffer_p->push_back('}');
+}
+
+void BufferFormatter::openArray(bool formatAsEmptyArrayFlag)
+{
+    if (d_usePrettyStyle &&
+        (1 == d_callSequence.length() || isArrayElement())) {
+        indent();
+    }
+
+    d_buffer_p->push_back('[');
+
+    if (d_usePrettyStyle && !formatAsEmptyArrayFlag) {
+        d_buffer_p->push_back('\n');
+        ++d_indentLevel;
+        d_callSequence.append(true);
+    }
+}
+
+void BufferFormatter::closeArray(bool formatAsEmptyArrayFlag)
+{
+    if (d_usePrettyStyle && !formatAsEmptyArrayFlag) {
+        --d_indentLevel;
+        d_buffer_p->push_back('\n');
+        indent();
+
+        BSLS_ASSERT(true == isArrayElement());
+        d_callSequence.remove(d_callSequence.length() - 1);
+    }
+
+    d_buffer_p->push_back(']');
+}
+
+int BufferFormatter::openMember(const bsl::string_view& name)
+{
+    const bsl::string::size_type length = d_buffer_p->length();
+
+    if (d_usePrettyStyle) {
+        indent();
+    }
+
+    const int rc = printString(name, &d_encoderOptions);
+    if (rc) {
+        d_buffer_p->resize(length);
+        return rc;                                                    // RETURN
+    }
+
+    if (d_usePrettyStyle) {
+        d_buffer_p->append(": ", 2);
+    }
+    else {
+        d_buffer_p->push_back(':');
+    }
+
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
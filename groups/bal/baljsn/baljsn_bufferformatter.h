@@ -0,0 +1,657 @@
+// baljsn_bufferformatter.h                                           -*-C++-*-
+#ifndef INCLUDED_BALJSN_BUFFERFORMATTER
+#define INCLUDED_BALJSN_BUFFERFORMATTER
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a formatter that encodes JSON directly into a string.
+//
+//@CLASSES:
+// baljsn::BufferFormatter: JSON formatter appending to a `bsl::string`
+//
+//@SEE_ALSO: baljsn_formatter, baljsn_encoder, baljsn_printutil
+//
+//@DESCRIPTION: This component provides a class, `baljsn::BufferFormatter`,
+// for formatting JSON objects, arrays, and name-value pairs in the JSON
+// encoding format by appending text directly to a `bsl::string` (supplied at
+// construction).  `BufferFormatter` has the same interface, and produces
+// exactly the same text, as `baljsn::Formatter`, and so can be used in its
+// place (e.g., as the `FORMATTER` parameter of `baljsn::EncodeImplUtil`).
+//
+// `baljsn::Formatter` renders each punctuation character, member name, and
+// value through the `<<`, `put`, and `write` operations of a `bsl::ostream`,
+// each of which constructs a sentry object and makes a virtual call to the
+// stream buffer, and renders integers through the `num_put` facet of the
+// stream's locale.  For the documents produced by the encoder, which consist
+// mostly of short tokens, this per-token overhead is a large part of the cost
+// of encoding.  `BufferFormatter` instead appends each token to the string
+// directly:
+//
+// * Integers and (finite) floating-point values are rendered by
+//   `bslalg::NumericFormatterUtil::toChars`.
+//
+// * Strings and member names are escaped and appended in runs, and are
+//   validated as UTF-8 (rejecting invalid strings, as does
+//   `baljsn::PrintUtil`) only if they contain a non-ASCII character.
+//
+// Values of the remaining types (e.g., `bdldfp::Decimal64`, the `bdlt`
+// date and time types, floating-point values when a maximum precision is
+// specified in the `EncoderOptions`, and the non-finite floating-point values)
+// are rendered by `baljsn::PrintUtil` into a stream buffer owned by the
+// formatter, and then appended to the string.
+//
+// If rendering a value fails (e.g., a string that is not valid UTF-8), the
+// string is left unchanged by the operation.
+//
+///Valid sequence of operations
+///----------------------------
+// As for `baljsn::Formatter`, the `BufferFormatter` `class` does only minimal
+// checking to verify that the sequence of operations called on its object
+// result in a valid JSON document.  It is the user's responsibility to ensure
+// that the methods provided by this component are called in the right order.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding a Stock Quote in JSON
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have to encode a stock quote as a JSON object, and that the
+// encoded text is to be written to a network connection as a single,
+// contiguous buffer.
+//
+// First, we specify the result that we are expecting to get:
+// ```
+// const bsl::string EXPECTED =
+//     "{\n"
+//     "  \"Name\": \"International Business Machines Corp\",\n"
+//     "  \"Ticker\": \"IBM US Equity\",\n"
+//     "  \"Last Price\": 149.3,\n"
+//     "  \"Volume\": 4587123\n"
+//     "}";
+// ```
+// Then, we create a `baljsn::BufferFormatter` object that appends to a string
+// owned by the caller, in the pretty style with 2 spaces per level:
+// ```
+// bsl::string             output;
+// baljsn::BufferFormatter formatter(&output, true, 0, 2);
+// ```
+// Next, we call the same sequence of methods that we would call on a
+// `baljsn::Formatter` to produce the document:
+// ```
+// formatter.openObject();
+//
+// formatter.openMember("Name");
+// formatter.putValue("International Business Machines Corp");
+// formatter.closeMember();
+//
+// formatter.openMember("Ticker");
+// formatter.putValue("IBM US Equity");
+// formatter.closeMember();
+//
+// formatter.openMember("Last Price");
+// formatter.putValue(149.3);
+// formatter.closeMember();
+//
+// formatter.openMember("Volume");
+// formatter.putValue(4587123);
+//
+// formatter.closeObject();
+// ```
+// Finally, we verify that the string holds the encoded document:
+// ```
+// assert(EXPECTED == output);
+// ```
+
+#include <balscm_version.h>
+
+#include <baljsn_encoderoptions.h>
+#include <baljsn_printutil.h>
+
+#include <bdlb_float.h>
+
+#include <bdlc_bitarray.h>
+
+#include <bdlsb_memoutstreambuf.h>
+
+#include <bslalg_numericformatterutil.h>
+
+#include <bslma_allocator.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_ostream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+
+namespace BloombergLP {
+namespace baljsn {
+
+                           // =====================
+                           // class BufferFormatter
+                           // =====================
+
+/// This class implements a formatter providing operations for rendering JSON
+/// text elements by appending them to a string (supplied at construction)
+/// according to a set of formatting options (also supplied at construction).
+/// The text rendered by each operation is identical to that rendered by the
+/// same operation of `baljsn::Formatter`.
+class BufferFormatter {
+
+    // PRIVATE TYPES
+    typedef bslalg::NumericFormatterUtil NumFmt;
+
+    // DATA
+    bsl::string            *d_buffer_p;           // string to which output
+                                                  // is appended (held, not
+                                                  // owned)
+
+    bool                    d_usePrettyStyle;     // encoding style
+
+    bool                    d_escapeForwardSlash; // whether to escape `/` or
+                                                  // not
+
+    int                     d_indentLevel;        // current indentation level
+
+    int                     d_spacesPerLevel;     // spaces per indentation
+                                                  // level
+
+    bdlc::BitArray          d_callSequence;       // array specifying the
+                                                  // sequence in which the
+                                                  // 'openObject' and
+                                                  // 'openArray' methods were
+                                                  // called (see
+                                                  // 'baljsn::Formatter')
+
+    EncoderOptions          d_encoderOptions;     // options used to render
+                                                  // member names
+
+    bdlsb::MemOutStreamBuf  d_scratch;            // buffer for values
+                                                  // rendered by 'PrintUtil'
+
+    // NOT IMPLEMENTED
+    BufferFormatter(const BufferFormatter&);
+    BufferFormatter& operator=(const BufferFormatter&);
+
+    // PRIVATE MANIPULATORS
+
+    /// Unconditionally append to the string supplied at construction the
+    /// sequence of whitespace characters for the proper indentation of an
+    /// element at the current indentation level.
+    void indent();
+
+    /// Append the JSON representation of the specified `value` to the string
+    /// supplied at construction using the specified `options`.  Return 0 on
+    /// success and a non-zero value, leaving the string unchanged, otherwise.
+    int print(bool                    value, const EncoderOptions *options);
+    int print(char                    value, const EncoderOptions *options);
+    int print(signed char             value, const EncoderOptions *options);
+    int print(unsigned char           value, const EncoderOptions *options);
+    int print(short                   value, const EncoderOptions *options);
+    int print(unsigned short          value, const EncoderOptions *options);
+    int print(int                     value, const EncoderOptions *options);
+    int print(unsigned int            value, const EncoderOptions *options);
+    int print(long                    value, const EncoderOptions *options);
+    int print(unsigned long           value, const EncoderOptions *options);
+    int print(long long               value, const EncoderOptions *options);
+    int print(unsigned long long      value, const EncoderOptions *options);
+    int print(float                   value, const EncoderOptions *options);
+    int print(double                  value, const EncoderOptions *options);
+    int print(const char             *value, const EncoderOptions *options);
+    int print(const bsl::string&      value, const EncoderOptions *options);
+    int print(const bsl::string_view& value, const EncoderOptions *options);
+
+    /// Append the JSON representation of the specified `value` to the string
+    /// supplied at construction using the specified `options`, as rendered by
+    /// `PrintUtil::printValue`.  Return 0 on success and a non-zero value,
+    /// leaving the string unchanged, otherwise.
+    template <class TYPE>
+    int print(const TYPE& value, const EncoderOptions *options);
+
+    /// Append the JSON representation of the specified floating-point
+    /// `value` to the string supplied at construction using the specified
+    /// `options`.  The specified `maxPrecision` is the maximum precision for
+    /// values of `TYPE` in `options`, or 0 if `options` is 0.  Return 0 on
+    /// success and a non-zero value, leaving the string unchanged, otherwise.
+    template <class TYPE>
+    int printFloatingPoint(TYPE                  value,
+                           int                   maxPrecision,
+                           const EncoderOptions *options);
+
+    /// Append the decimal representation of the specified integral `value`
+    /// to the string supplied at construction.
+    template <class TYPE>
+    void printInteger(TYPE value);
+
+    /// Append the JSON string representation of the specified `value` to the
+    /// string supplied at construction, escaping `/` unless `options` is not
+    /// 0 and `options->escapeForwardSlash()` is `false`.  Return 0 on success,
+    /// and a non-zero value, leaving the string unchanged, if `value` is not
+    /// valid UTF-8.
+    int printString(const bsl::string_view& value,
+                    const EncoderOptions   *options);
+
+    // PRIVATE ACCESSORS
+
+    /// Return `true` if the value being encoded is an element of an array,
+    /// and `false` otherwise.
+    bool isArrayElement() const;
+
+  public:
+    // CREATORS
+
+    /// Create a `BufferFormatter` object that appends to the specified
+    /// `buffer`.  Optionally specify `usePrettyStyle` to inform the formatter
+    /// whether the pretty encoding style should be used when writing data.
+    /// If `usePrettyStyle` is not specified then the data is written in a
+    /// compact style.  If `usePrettyStyle` is specified, additionally specify
+    /// `initialIndentLevel` and `spacesPerLevel` to provide the initial
+    /// indentation level and spaces per level at which the data should be
+    /// formatted.  If `initialIndentLevel` or `spacesPerLevel` is not
+    /// specified then an initial value of `0` is used for both parameters.
+    /// If `usePrettyStyle` is `false` then `initialIndentLevel` and
+    /// `spacesPerLevel` are both ignored.  Optionally specify
+    /// `escapeForwardSlash`.  If `escapeForwardSlash` is specified as
+    /// `false`, `/` characters in member names will be formatted as-is,
+    /// otherwise, they will be rendered with a leading backslash, as "\\/".
+    /// Optionally specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  The behavior is undefined unless `buffer` is not 0.
+    explicit BufferFormatter(bsl::string      *buffer,
+                             bool              usePrettyStyle     = false,
+                             int               initialIndentLevel = 0,
+                             int               spacesPerLevel     = 0,
+                             bslma::Allocator *basicAllocator     = 0);
+    BufferFormatter(bsl::string      *buffer,
+                    bool              usePrettyStyle,
+                    int               initialIndentLevel,
+                    int               spacesPerLevel,
+                    bool              escapeForwardSlash,
+                    bslma::Allocator *basicAllocator = 0);
+
+    /// Destroy this object.
+    //! ~BufferFormatter() = default;
+
+    // MANIPULATORS
+
+    /// Append to the string supplied at construction the sequence of
+    /// characters that precede a JSON document, i.e., the indentation for the
+    /// initial indentation level if this formatter encodes in the pretty
+    /// style, and nothing otherwise.
+    void openDocument();
+
+    /// Append to the string supplied at construction the sequence of
+    /// characters that follow a JSON document, i.e., a newline if this
+    /// formatter encodes in the pretty style, and nothing otherwise.
+    void closeDocument();
+
+    /// Append to the string supplied at construction the sequence of
+    /// characters designating the start of an object (referred to as an
+    /// "object" in JSON).
+    void openObject();
+
+    /// Append to the string supplied at construction the sequence of
+    /// characters designating the end of an object (referred to as an
+    /// "object" in JSON).  The behavior is undefined unless this
+    /// `BufferFormatter` is currently formatting an object.
+    void closeObject();
+
+    /// Append to the string supplied at construction the sequence of
+    /// characters designating the start of an array (referred to as an
+    /// "array" in JSON).  Optionally specify `formatAsEmptyArray` denoting if
+    /// the array being opened should be formatted as an empty array.  If
+    /// `formatAsEmptyArray` is not specified then the array being opened is
+    /// formatted as an array having elements.  Note that the formatting (and
+    /// as a consequence the `formatAsEmptyArray`) is relevant only if this
+    /// formatter encodes in the pretty style and is ignored otherwise.
+    void openArray(bool formatAsEmptyArray = false);
+
+    /// Append to the string supplied at construction the sequence of
+    /// characters designating the end of an array (referred to as an "array"
+    /// in JSON).  Optionally specify `formatAsEmptyArray` denoting if the
+    /// array being closed should be formatted as an empty array.  If
+    /// `formatAsEmptyArray` is not specified then the array being closed is
+    /// formatted as an array having elements.  The behavior is undefined
+    /// unless this `BufferFormatter` is currently formatting an array.  Note
+    /// that the formatting (and as a consequence the `formatAsEmptyArray`) is
+    /// relevant only if this formatter encodes in the pretty style and is
+    /// ignored otherwise.
+    void closeArray(bool formatAsEmptyArray = false);
+
+    /// Append to the string supplied at construction the sequence of
+    /// characters designating the start of a member (referred to as a
+    /// "name/value pair" in JSON) having the specified `name`.  Return 0 on
+    /// success and a non-zero value otherwise.
+    int openMember(const bsl::string_view& name);
+
+    /// Append to the string supplied at construction the value corresponding
+    /// to a null element.  Return 0 on success and a non-zero value
+    /// otherwise.
+    int putNullValue();
+
+    /// Append to the string supplied at construction the specified `value`.
+    /// Optionally specify `options` according which `value` should be
+    /// encoded.  Return 0 on success and a non-zero value otherwise.
+    template <class TYPE>
+    int putValue(const TYPE& value, const EncoderOptions *options = 0);
+
+    /// Append to the string supplied at construction the sequence of
+    /// characters designating the end of an member (referred to as a
+    /// "name/value pair" in JSON).  The behavior is undefined unless this
+    /// `BufferFormatter` is currently formatting a member.
+    void closeMember();
+
+    /// Append to the string supplied at construction the sequence of
+    /// characters designating an array element separator (i.e., `,`).  The
+    /// behavior is undefined unless this `BufferFormatter` is currently
+    /// formatting a member.
+    void addArrayElementSeparator();
+
+    // ACCESSORS
+
+    /// Return the number of currently open nested objects or arrays.
+    int nestingDepth() const;
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                           // ---------------------
+                           // class BufferFormatter
+                           // ---------------------
+
+// PRIVATE MANIPULATORS
+inline
+void BufferFormatter::indent()
+{
+    const int numSpaces = d_indentLevel * d_spacesPerLevel;
+    if (0 < numSpaces) {
+        d_buffer_p->append(numSpaces, ' ');
+    }
+}
+
+inline
+int BufferFormatter::print(bool value, const EncoderOptions *)
+{
+    if (value) {
+        d_buffer_p->append("true", 4);
+    }
+    else {
+        d_buffer_p->append("false", 5);
+    }
+    return 0;
+}
+
+inline
+int BufferFormatter::print(char value, const EncoderOptions *)
+{
+    signed char tmp(value);  // Note that 'char' is unsigned on IBM.
+    printInteger(static_cast<int>(tmp));
+    return 0;
+}
+
+inline
+int BufferFormatter::print(signed char value, const EncoderOptions *)
+{
+    printInteger(static_cast<int>(value));
+    return 0;
+}
+
+inline
+int BufferFormatter::print(unsigned char value, const EncoderOptions *)
+{
+    printInteger(static_cast<int>(value));
+    return 0;
+}
+
+inline
+int BufferFormatter::print(short value, const EncoderOptions *)
+{
+    printInteger(value);
+    return 0;
+}
+
+inline
+int BufferFormatter::print(unsigned short value, const EncoderOptions *)
+{
+    printInteger(value);
+    return 0;
+}
+
+inline
+int BufferFormatter::print(int value, const EncoderOptions *)
+{
+    printInteger(value);
+    return 0;
+}
+
+inline
+int BufferFormatter::print(unsigned int value, const EncoderOptions *)
+{
+    printInteger(value);
+    return 0;
+}
+
+inline
+int BufferFormatter::print(long value, const EncoderOptions *)
+{
+    printInteger(value);
+    return 0;
+}
+
+inline
+int BufferFormatter::print(unsigned long value, const EncoderOptions *)
+{
+    printInteger(value);
+    return 0;
+}
+
+inline
+int BufferFormatter::print(long long value, const EncoderOptions *)
+{
+    printInteger(value);
+    return 0;
+}
+
+inline
+int BufferFormatter::print(unsigned long long value, const EncoderOptions *)
+{
+    printInteger(value);
+    return 0;
+}
+
+inline
+int BufferFormatter::print(float value, const EncoderOptions *options)
+{
+    return printFloatingPoint(value,
+                              options ? options->maxFloatPrecision() : 0,
+                              options);
+}
+
+inline
+int BufferFormatter::print(double value, const EncoderOptions *options)
+{
+    return printFloatingPoint(value,
+                              options ? options->maxDoublePrecision() : 0,
+                              options);
+}
+
+inline
+int BufferFormatter::print(const char *value, const EncoderOptions *options)
+{
+    return printString(value, options);
+}
+
+inline
+int BufferFormatter::print(const bsl::string&    value,
+                           const EncoderOptions *options)
+{
+    return printString(value, options);
+}
+
+inline
+int BufferFormatter::print(const bsl::string_view&  value,
+                           const EncoderOptions    *options)
+{
+    return printString(value, options);
+}
+
+template <class TYPE>
+int BufferFormatter::print(const TYPE& value, const EncoderOptions *options)
+{
+    d_scratch.pubseekpos(0);
+
+    bsl::ostream stream(&d_scratch);
+    const int    rc = PrintUtil::printValue(stream, value, options);
+    if (0 != rc || !stream) {
+        return 0 != rc ? rc : -1;                                     // RETURN
+    }
+
+    d_buffer_p->append(d_scratch.data(), d_scratch.length());
+    return 0;
+}
+
+template <class TYPE>
+inline
+int BufferFormatter::printFloatingPoint(TYPE                  value,
+                                        int                   maxPrecision,
+                                        const EncoderOptions *options)
+{
+    if (0 != maxPrecision || !bdlb::Float::isFinite(value)) {
+        // Values having a limited precision, and special values, are rendered
+        // by 'PrintUtil'.
+
+        return print<TYPE>(value, options);                           // RETURN
+    }
+
+    char              buffer[NumFmt::ToCharsMaxLength<TYPE>::k_VALUE];
+    const char *const endPtr = NumFmt::toChars(buffer,
+                                               buffer + sizeof buffer,
+                                               value);
+    BSLS_ASSERT(0 != endPtr);
+
+    d_buffer_p->append(buffer, endPtr - buffer);
+    return 0;
+}
+
+template <class TYPE>
+inline
+void BufferFormatter::printInteger(TYPE value)
+{
+    char              buffer[NumFmt::ToCharsMaxLength<TYPE>::k_VALUE];
+    const char *const endPtr = NumFmt::toChars(buffer,
+                                               buffer + sizeof buffer,
+                                               value);
+    BSLS_ASSERT(0 != endPtr);
+
+    d_buffer_p->append(buffer, endPtr - buffer);
+}
+
+// PRIVATE ACCESSORS
+inline
+bool BufferFormatter::isArrayElement() const
+{
+    BSLS_ASSERT(d_callSequence.length() >= 1);
+
+    return d_callSequence[d_callSequence.length() - 1];
+}
+
+// MANIPULATORS
+inline
+void BufferFormatter::openDocument()
+{
+    if (d_usePrettyStyle) {
+        indent();
+    }
+}
+
+inline
+void BufferFormatter::closeDocument()
+{
+    if (d_usePrettyStyle) {
+        d_buffer_p->push_back('\n');
+    }
+}
+
+inline
+int BufferFormatter::putNullValue()
+{
+    if (d_usePrettyStyle && isArrayElement()) {
+        indent();
+    }
+    d_buffer_p->append("null", 4);
+    return 0;
+}
+
+template <class TYPE>
+int BufferFormatter::putValue(const TYPE& value, const EncoderOptions *options)
+{
+    if (d_usePrettyStyle && isArrayElement()) {
+        const bsl::string::size_type length = d_buffer_p->length();
+
+        indent();
+
+        const int rc = print(value, options);
+        if (0 != rc) {
+            d_buffer_p->resize(length);
+        }
+        return rc;                                                    // RETURN
+    }
+
+    return print(value, options);
+}
+
+inline
+void BufferFormatter::closeMember()
+{
+    if (d_usePrettyStyle) {
+        d_buffer_p->append(",\n", 2);
+    }
+    else {
+        d_buffer_p->push_back(',');
+    }
+}
+
+inline
+void BufferFormatter::addArrayElementSeparator()
+{
+    if (d_usePrettyStyle) {
+        d_buffer_p->append(",\n", 2);
+    }
+    else {
+        d_buffer_p->push_back(',');
+    }
+}
+
+// ACCESSORS
+inline
+int BufferFormatter::nestingDepth() const
+{
+    // The call sequence contains a "dummy" initial element, so subtract one
+    // from the length.
+
+    return static_cast<int>(d_callSequence.length()) - 1;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
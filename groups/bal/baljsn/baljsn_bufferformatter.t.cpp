@@ -0,0 +1,907 @@
+// baljsn_bufferformatter.t.cpp                                       -*-C++-*-
+
+#include <baljsn_bufferformatter.h>
+
+#include <baljsn_formatter.h>
+
+#include <bslim_testutil.h>
+
+#include <bdlt_date.h>
+#include <bdlt_datetime.h>
+#include <bdlt_datetimeinterval.h>
+#include <bdlt_datetimetz.h>
+#include <bdlt_time.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_review.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test implements a formatter that renders JSON text by
+// appending to a `bsl::string`, and that is specified to produce exactly the
+// same text as `baljsn::Formatter`.  We therefore use `baljsn::Formatter`
+// writing to a `bsl::ostringstream` as an oracle: every sequence of operations
+// is applied to both formatters, and the text appended to the string is
+// compared to the text written to the stream.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] BufferFormatter(string *b, style, indent, spl, *ba);
+// [ 2] BufferFormatter(string *b, style, indent, spl, escFwd, *ba);
+// [ 2] ~BufferFormatter();
+//
+// MANIPULATORS
+// [ 2] void openDocument();
+// [ 2] void closeDocument();
+// [ 4] void openObject();
+// [ 4] void closeObject();
+// [ 4] void openArray(bool formatAsEmptyArray);
+// [ 4] void closeArray(bool formatAsEmptyArray);
+// [ 4] int openMember(const bsl::string_view& name);
+// [ 3] int putNullValue();
+// [ 3] int putValue(const TYPE& value, const EncoderOptions *options);
+// [ 4] void closeMember();
+// [ 4] void addArrayElementSeparator();
+//
+// ACCESSORS
+// [ 4] int nestingDepth() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef baljsn::BufferFormatter Obj;
+typedef baljsn::Formatter       Oracle;
+typedef baljsn::EncoderOptions  Options;
+
+/// Verify that `putValue` of the specified `value` using the specified
+/// `options`, as the value of a member and as an element of an array, on an
+/// object having the specified `style`, `indent`, and `spl` returns the same
+/// status as the same operation on a `baljsn::Formatter`, appends the same
+/// text if successful, and appends nothing otherwise.  Use the specified
+/// `line` to identify failures.
+template <class TYPE>
+void testPutValue(int            line,
+                  bool           style,
+                  int            indent,
+                  int            spl,
+                  const TYPE&    value,
+                  const Options *options)
+{
+    for (int i = 0; i < 2; ++i) {
+        // i == 0, output as the value of an element, i.e. without indentation
+        // i == 1, output as an array element, i.e. with indentation
+
+        bsl::ostringstream os;
+        Oracle             oracle(os, style, indent, spl);
+
+        bsl::string        output("prefix");
+        Obj                mX(&output, style, indent, spl);
+
+        if (0 == i) {
+            oracle.openObject();
+            mX.openObject();
+        }
+        else {
+            oracle.openArray();
+            mX.openArray();
+        }
+
+        const bsl::string before = output;
+
+        const int expRc = oracle.putValue(value, options);
+        const int rc    = mX.putValue(value, options);
+
+        ASSERTV(line, i, expRc, rc, expRc == rc);
+
+        if (0 == rc) {
+            ASSERTV(line,
+                    i,
+                    os.str(),
+                    output,
+                    "prefix" + os.str() == output);
+        }
+        else {
+            ASSERTV(line, i, before, output, before == output);
+        }
+    }
+}
+
+/// Apply the operation identified by the specified `op` to the specified
+/// `oracle` and `object`, and return the status of the operation.  The
+/// specified `name` is used by `openMember`.
+int apply(Oracle *oracle, Obj *object, char op, const char *name)
+{
+    switch (op) {
+      case '{': oracle->openObject();       object->openObject();      break;
+      case '}': oracle->closeObject();      object->closeObject();     break;
+      case '[': oracle->openArray();        object->openArray();       break;
+      case ']': oracle->closeArray();       object->closeArray();      break;
+      case '(': oracle->openArray(true);    object->openArray(true);   break;
+      case ')': oracle->closeArray(true);   object->closeArray(true);  break;
+      case ',': oracle->closeMember();      object->closeMember();     break;
+      case ';': {
+        oracle->addArrayElementSeparator();
+        object->addArrayElementSeparator();
+      } break;
+      case 'm': {
+        const int expRc = oracle->openMember(name);
+        const int rc    = object->openMember(name);
+        ASSERTV(expRc, rc, expRc == rc);
+        return rc;                                                    // RETURN
+      }
+      case 'n': oracle->putNullValue();     object->putNullValue();    break;
+      case 'i': oracle->putValue(-17);      object->putValue(-17);     break;
+      case 'd': oracle->putValue(2.5);      object->putValue(2.5);     break;
+      case 't': oracle->putValue(true);     object->putValue(true);    break;
+      case 's': oracle->putValue("a/b");    object->putValue("a/b");   break;
+      default: {
+        ASSERTV(op, !"Unknown operation");
+        return -1;                                                    // RETURN
+      }
+    }
+    return 0;
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int             test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    bool         verbose = argc > 2;
+    bool     veryVerbose = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: `BSLS_REVIEW` failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Encoding a Stock Quote in JSON
+///- - - - - - - - - - - - - - - - - - - - -
+// Suppose that we have to encode a stock quote as a JSON object, and that the
+// encoded text is to be written to a network connection as a single,
+// contiguous buffer.
+//
+// First, we specify the result that we are expecting to get:
+// ```
+    const bsl::string EXPECTED =
+        "{\n"
+        "  \"Name\": \"International Business Machines Corp\",\n"
+        "  \"Ticker\": \"IBM US Equity\",\n"
+        "  \"Last Price\": 149.3,\n"
+        "  \"Volume\": 4587123\n"
+        "}";
+// ```
+// Then, we create a `baljsn::BufferFormatter` object that appends to a string
+// owned by the caller, in the pretty style with 2 spaces per level:
+// ```
+    bsl::string             output;
+    baljsn::BufferFormatter formatter(&output, true, 0, 2);
+// ```
+// Next, we call the same sequence of methods that we would call on a
+// `baljsn::Formatter` to produce the document:
+// ```
+    formatter.openObject();
+
+    formatter.openMember("Name");
+    formatter.putValue("International Business Machines Corp");
+    formatter.closeMember();
+
+    formatter.openMember("Ticker");
+    formatter.putValue("IBM US Equity");
+    formatter.closeMember();
+
+    formatter.openMember("Last Price");
+    formatter.putValue(149.3);
+    formatter.closeMember();
+
+    formatter.openMember("Volume");
+    formatter.putValue(4587123);
+
+    formatter.closeObject();
+// ```
+// Finally, we verify that the string holds the encoded document:
+// ```
+    ASSERT(EXPECTED == output);
+// ```
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING STRUCTURAL OPERATIONS
+        //
+        // Concerns:
+        // 1. Each of `openObject`, `closeObject`, `openArray`, `closeArray`,
+        //    `openMember`, `closeMember`, and `addArrayElementSeparator`
+        //    appends the same text as the corresponding method of
+        //    `baljsn::Formatter`, in both the compact and the pretty style,
+        //    and for any initial indentation level and spaces per level.
+        //
+        // 2. `nestingDepth` returns the same value as that of
+        //    `baljsn::Formatter`.
+        //
+        // 3. Member names are escaped as by `baljsn::Formatter`, respecting
+        //    the `escapeForwardSlash` option, and `openMember` fails, leaving
+        //    the string unchanged, if the name is not valid UTF-8.
+        //
+        // Plan:
+        // 1. Using the table-driven technique, apply each of a set of
+        //    sequences of operations to both a `BufferFormatter` and a
+        //    `baljsn::Formatter` having the same options, and verify that the
+        //    text appended, and the nesting depth, are the same after each
+        //    operation.  (C-1..2)
+        //
+        // 2. Open members having names requiring escaping, and a name that is
+        //    not valid UTF-8, and compare with `baljsn::Formatter`.  (C-3)
+        //
+        // Testing:
+        //   void openObject();
+        //   void closeObject();
+        //   void openArray(bool formatAsEmptyArray);
+        //   void closeArray(bool formatAsEmptyArray);
+        //   int openMember(const bsl::string_view& name);
+        //   void closeMember();
+        //   void addArrayElementSeparator();
+        //   int nestingDepth() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING STRUCTURAL OPERATIONS" << endl
+                          << "=============================" << endl;
+
+        // Operations: '{' '}' open/close object, '[' ']' open/close array,
+        // '(' ')' open/close empty array, 'm' open member, ',' close member,
+        // ';' array separator, and 'n' 'i' 'd' 't' 's' put a value.
+
+        static const struct {
+            int         d_line;
+            const char *d_ops;
+        } DATA[] = {
+            //LINE  OPERATIONS
+            //----  ----------------------------------------
+            { L_,   "{}"                                     },
+            { L_,   "[]"                                     },
+            { L_,   "()"                                     },
+            { L_,   "{mn}"                                   },
+            { L_,   "{mi,md,mt,ms}"                          },
+            { L_,   "[i;d;t;s;n]"                            },
+            { L_,   "{m{mi,m{}},m[{mi};{}],m()}"               },
+            { L_,   "[[[i;i];[]];();{m[n]}]"                 },
+            { L_,   "{m[{m[{m[i]}]}]}"                       },
+            { L_,   "[{};[];();i]"                           },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        static const struct {
+            bool d_pretty;
+            int  d_indent;
+            int  d_spl;
+        } STYLES[] = {
+            { false, 0, 0 },
+            { false, 3, 4 },
+            { true,  0, 0 },
+            { true,  0, 2 },
+            { true,  2, 4 },
+        };
+        const int NUM_STYLES = sizeof STYLES / sizeof *STYLES;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE = DATA[ti].d_line;
+            const char *const OPS  = DATA[ti].d_ops;
+
+            for (int si = 0; si < NUM_STYLES; ++si) {
+                const bool PRETTY = STYLES[si].d_pretty;
+                const int  INDENT = STYLES[si].d_indent;
+                const int  SPL    = STYLES[si].d_spl;
+
+                if (veryVerbose) { T_ P_(LINE) P_(OPS) P_(PRETTY) P(SPL) }
+
+                bslma::TestAllocator ta("test", veryVeryVerbose);
+
+                bsl::ostringstream os;
+                Oracle             oracle(os, PRETTY, INDENT, SPL);
+                bsl::string        output(&ta);
+                Obj                mX(&output, PRETTY, INDENT, SPL, &ta);
+                const Obj&         X = mX;
+
+                for (const char *op = OPS; *op; ++op) {
+                    apply(&oracle, &mX, *op, "name");
+
+                    ASSERTV(LINE, si, *op, os.str(), output,
+                            os.str() == output);
+                    ASSERTV(LINE, si, *op,
+                            oracle.nestingDepth(), X.nestingDepth(),
+                            oracle.nestingDepth() == X.nestingDepth());
+                }
+                ASSERTV(LINE, si, X.nestingDepth(), 0 == X.nestingDepth());
+            }
+        }
+
+        if (verbose) cout << "\tTesting member names." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_name;
+                bool        d_isValid;
+            } NAMES[] = {
+                { L_, "",                          true  },
+                { L_, "a",                         true  },
+                { L_, "a/b",                       true  },
+                { L_, "\"quoted\"",                true  },
+                { L_, "back\\slash",               true  },
+                { L_, "\b\f\n\r\t",                true  },
+                { L_, "\x01\x1f\x7f",              true  },
+                { L_, "caf\xc3\xa9",               true  },
+                { L_, "\xe2\x82\xac/\"",           true  },
+                { L_, "bad\xc3",                   false },
+                { L_, "\xff",                      false },
+            };
+            const int NUM_NAMES = sizeof NAMES / sizeof *NAMES;
+
+            for (int ti = 0; ti < NUM_NAMES; ++ti) {
+                const int         LINE  = NAMES[ti].d_line;
+                const char *const NAME  = NAMES[ti].d_name;
+                const bool        VALID = NAMES[ti].d_isValid;
+
+                for (int pretty = 0; pretty < 2; ++pretty) {
+                for (int esc = 0; esc < 2; ++esc) {
+                    bsl::ostringstream os;
+                    Oracle             oracle(os, pretty, 1, 2, esc);
+                    bsl::string        output;
+                    Obj                mX(&output, pretty, 1, 2, esc);
+
+                    apply(&oracle, &mX, '{', 0);
+
+                    const bsl::string before = output;
+
+                    const int rc = apply(&oracle, &mX, 'm', NAME);
+                    ASSERTV(LINE, rc, VALID == (0 == rc));
+
+                    if (VALID) {
+                        ASSERTV(LINE, os.str(), output, os.str() == output);
+                    }
+                    else {
+                        ASSERTV(LINE, before, output, before == output);
+                    }
+                }
+                }
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING `putValue` AND `putNullValue`
+        //
+        // Concerns:
+        // 1. `putValue` appends the same text, and returns the same status, as
+        //    `baljsn::Formatter::putValue` for every type supported by
+        //    `baljsn::PrintUtil`, including the types rendered by the
+        //    formatter itself (integers, finite floating-point values, and
+        //    strings) and those delegated to `baljsn::PrintUtil`.
+        //
+        // 2. The options affecting the rendering of values (the maximum
+        //    precision of floating-point values, the encoding of non-finite
+        //    values, and the escaping of `/`) are honored.
+        //
+        // 3. Strings are escaped as by `baljsn::PrintUtil`, and a string that
+        //    is not valid UTF-8 is rejected.
+        //
+        // 4. If `putValue` fails, the string is unchanged, even in the
+        //    pretty style as an element of an array.
+        //
+        // 5. `putNullValue` appends `null`, indented as an element of an
+        //    array in the pretty style.
+        //
+        // Plan:
+        // 1. For a set of values of each supported type, with and without
+        //    options, compare the result of `putValue` with that of
+        //    `baljsn::Formatter::putValue`, as the value of a member and as an
+        //    element of an array, in both styles.  (C-1..4)
+        //
+        // 2. Compare the result of `putNullValue` with that of
+        //    `baljsn::Formatter`.  (C-5)
+        //
+        // Testing:
+        //   int putValue(const TYPE& value, const EncoderOptions *options);
+        //   int putNullValue();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `putValue` AND `putNullValue`" << endl
+                          << "=====================================" << endl;
+
+        Options defaultOptions;
+
+        Options limitedPrecision;
+        limitedPrecision.setMaxFloatPrecision(3);
+        limitedPrecision.setMaxDoublePrecision(5);
+
+        Options infAndNaNAsStrings;
+        infAndNaNAsStrings.setEncodeInfAndNaNAsStrings(true);
+
+        Options noEscapedSlash;
+        noEscapedSlash.setEscapeForwardSlash(false);
+
+        const Options *const OPTIONS[] = {
+            0,
+            &defaultOptions,
+            &limitedPrecision,
+            &infAndNaNAsStrings,
+            &noEscapedSlash,
+        };
+        const int NUM_OPTIONS = sizeof OPTIONS / sizeof *OPTIONS;
+
+        const double INF = bsl::numeric_limits<double>::infinity();
+        const double QNAN = bsl::numeric_limits<double>::quiet_NaN();
+
+        for (int oi = 0; oi < NUM_OPTIONS; ++oi) {
+        for (int pretty = 0; pretty < 2; ++pretty) {
+            const Options *OPT = OPTIONS[oi];
+
+            if (veryVerbose) { T_ P_(oi) P(pretty) }
+
+#define TEST(VALUE) testPutValue(L_, pretty, 1, 2, VALUE, OPT)
+
+            TEST(true);
+            TEST(false);
+
+            TEST('a');
+            TEST(static_cast<char>(-5));
+            TEST(static_cast<signed char>(-128));
+            TEST(static_cast<unsigned char>(255));
+            TEST(static_cast<short>(-32768));
+            TEST(static_cast<unsigned short>(65535));
+            TEST(0);
+            TEST(-1);
+            TEST(bsl::numeric_limits<int>::min());
+            TEST(bsl::numeric_limits<int>::max());
+            TEST(4000000000u);
+            TEST(-123456789L);
+            TEST(123456789UL);
+            TEST(bsl::numeric_limits<long long>::min());
+            TEST(bsl::numeric_limits<unsigned long long>::max());
+
+            TEST(0.0f);
+            TEST(1.5f);
+            TEST(-3.1415927f);
+            TEST(bsl::numeric_limits<float>::max());
+            TEST(0.0);
+            TEST(-0.0);
+            TEST(0.1);
+            TEST(149.3);
+            TEST(1e300);
+            TEST(-2.5e-300);
+            TEST(bsl::numeric_limits<double>::denorm_min());
+            TEST(1.0 / 3.0);
+            TEST(INF);
+            TEST(-INF);
+            TEST(QNAN);
+            TEST(static_cast<float>(INF));
+
+            TEST("");
+            TEST("plain text");
+            TEST("path/to/file");
+            TEST("\"quoted\" \\ back");
+            TEST("\b\f\n\r\t\x01\x1f end");
+            TEST("caf\xc3\xa9 \xe2\x82\xac");
+            TEST("bad \xc3");
+            TEST("\xed\xa0\x80");
+            TEST(bsl::string("a bsl::string / with a slash"));
+            TEST(bsl::string("embedded\0null", 13));
+            TEST(bsl::string_view("a string_view"));
+            TEST(bsl::string(200, 'x') + "\n" + bsl::string(200, 'y'));
+
+            TEST(bdlt::Date(2024, 2, 29));
+            TEST(bdlt::Time(23, 59, 59, 999));
+            TEST(bdlt::Datetime(2024, 2, 29, 12, 30, 45, 123, 456));
+            TEST(bdlt::DatetimeTz(bdlt::Datetime(1999, 12, 31), -300));
+            TEST(bdlt::DatetimeInterval(1, 2, 3, 4, 5));
+
+#undef TEST
+        }
+        }
+
+        if (verbose) cout << "\tTesting `putNullValue`." << endl;
+
+        for (int pretty = 0; pretty < 2; ++pretty) {
+            bsl::ostringstream os;
+            Oracle             oracle(os, pretty, 1, 2);
+            bsl::string        output;
+            Obj                mX(&output, pretty, 1, 2);
+
+            apply(&oracle, &mX, '[', 0);
+            apply(&oracle, &mX, 'n', 0);
+            apply(&oracle, &mX, ';', 0);
+            apply(&oracle, &mX, 'n', 0);
+            apply(&oracle, &mX, ']', 0);
+
+            ASSERTV(pretty, os.str(), output, os.str() == output);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS, `openDocument`, AND `closeDocument`
+        //
+        // Concerns:
+        // 1. The formatter appends to the string supplied at construction,
+        //    preserving its existing contents.
+        //
+        // 2. The options supplied at construction are honored, and default as
+        //    for `baljsn::Formatter`.
+        //
+        // 3. `openDocument` appends the initial indentation, and
+        //    `closeDocument` a newline, in the pretty style only.
+        //
+        // 4. Any memory allocation is from the supplied allocator, and the
+        //    destructor releases all memory.
+        //
+        // Plan:
+        // 1. Create objects using each constructor, with varying options,
+        //    apply a sequence of operations, and compare the result with that
+        //    of `baljsn::Formatter`.  (C-1..2)
+        //
+        // 2. Verify the text appended by `openDocument` and `closeDocument`.
+        //    (C-3)
+        //
+        // 3. Supply a test allocator, and verify that the default allocator is
+        //    not used and that all memory is released.  (C-4)
+        //
+        // Testing:
+        //   BufferFormatter(string *b, style, indent, spl, *ba);
+        //   BufferFormatter(string *b, style, indent, spl, escFwd, *ba);
+        //   ~BufferFormatter();
+        //   void openDocument();
+        //   void closeDocument();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                 << "TESTING CREATORS, `openDocument`, AND `closeDocument`"
+                 << endl
+                 << "====================================================="
+                 << endl;
+
+        bslma::TestAllocator da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const char *const OPS = "{m[i;s;{m()}],ms}";
+
+        for (int ci = 0; ci < 5; ++ci) {
+            bslma::TestAllocator oa("oracle", veryVeryVerbose);
+            bslma::TestAllocator ta("test", veryVeryVerbose);
+
+            bsl::ostringstream os(&oa);
+            bsl::string        output("existing", &ta);
+            os << "existing";
+
+            const bsls::Types::Int64 NUM_DEFAULT = da.numBlocksTotal();
+
+            {
+                switch (ci) {
+                  case 0: {
+                    Oracle oracle(os, false, 0, 0, &oa);
+                    Obj    mX(&output, false, 0, 0, &ta);
+                    for (const char *op = OPS; *op; ++op) {
+                        apply(&oracle, &mX, *op, "a/b");
+                    }
+                  } break;
+                  case 1: {
+                    Oracle oracle(os, true, 0, 0, &oa);
+                    Obj    mX(&output, true, 0, 0, &ta);
+                    for (const char *op = OPS; *op; ++op) {
+                        apply(&oracle, &mX, *op, "a/b");
+                    }
+                  } break;
+                  case 2: {
+                    Oracle oracle(os, true, 2, 0, &oa);
+                    Obj    mX(&output, true, 2, 0, &ta);
+                    for (const char *op = OPS; *op; ++op) {
+                        apply(&oracle, &mX, *op, "a/b");
+                    }
+                  } break;
+                  case 3: {
+                    Oracle oracle(os, true, 2, 3, &oa);
+                    Obj    mX(&output, true, 2, 3, &ta);
+                    for (const char *op = OPS; *op; ++op) {
+                        apply(&oracle, &mX, *op, "a/b");
+                    }
+                  } break;
+                  case 4: {
+                    Oracle oracle(os, true, 2, 3, false, &oa);
+                    Obj    mX(&output, true, 2, 3, false, &ta);
+                    for (const char *op = OPS; *op; ++op) {
+                        apply(&oracle, &mX, *op, "a/b");
+                    }
+                  } break;
+                }
+            }
+            ASSERTV(ci,
+                    NUM_DEFAULT,
+                    da.numBlocksTotal(),
+                    NUM_DEFAULT == da.numBlocksTotal());
+
+            ASSERTV(ci, os.str(), output, os.str() == output);
+            ASSERTV(ci, ta.numBlocksInUse(), 1 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\tTesting `openDocument` and `closeDocument`."
+                          << endl;
+        {
+            bsl::string output;
+            {
+                Obj mX(&output);
+                mX.openDocument();
+                mX.openObject();
+                mX.closeObject();
+                mX.closeDocument();
+            }
+            ASSERTV(output, "{}" == output);
+
+            output.clear();
+            {
+                Obj mX(&output, true, 2, 3);
+                mX.openDocument();
+                mX.openObject();
+                mX.closeObject();
+                mX.closeDocument();
+            }
+            ASSERTV(output, "      {\n\n      }\n" == output);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Perform a sequence of operations, and verify the string after
+        //    each.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bsl::string output;
+
+        Obj mX(&output);
+
+        bsl::string exp;
+
+        mX.openObject();
+
+        exp += '{';
+        ASSERTV(exp, output, exp == output);
+
+        const int rc = mX.openMember("name");
+        ASSERTV(rc, 0 == rc);
+
+        exp += "\"name\":";
+        ASSERTV(exp, output, exp == output);
+
+        mX.openArray();
+        mX.putValue(12);
+        mX.addArrayElementSeparator();
+        mX.putValue(-1.25);
+        mX.addArrayElementSeparator();
+        mX.putNullValue();
+        mX.closeArray();
+
+        exp += "[12,-1.25,null]";
+        ASSERTV(exp, output, exp == output);
+
+        mX.closeMember();
+        mX.openMember("flag");
+        mX.putValue(false);
+        mX.closeObject();
+
+        exp += ",\"flag\":false}";
+        ASSERTV(exp, output, exp == output);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Compare the time taken to format a document having many short
+        //   members with a `baljsn::Formatter` writing to a stream and with a
+        //   `BufferFormatter` appending to a string.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_DOCUMENTS = argc > 2 ? bsl::atoi(argv[2]) : 20000;
+        const int NUM_RECORDS   = 50;
+
+        bsls::Stopwatch timer;
+        bsl::size_t     total = 0;
+
+        bsl::ostringstream os;
+
+        timer.start(true);
+        for (int d = 0; d < NUM_DOCUMENTS; ++d) {
+            os.str("");
+
+            Oracle f(os);
+            f.openArray();
+            for (int r = 0; r < NUM_RECORDS; ++r) {
+                if (r) {
+                    f.addArrayElementSeparator();
+                }
+                f.openObject();
+                f.openMember("id");
+                f.putValue(d * NUM_RECORDS + r);
+                f.closeMember();
+                f.openMember("price");
+                f.putValue(100.25 + r);
+                f.closeMember();
+                f.openMember("ticker");
+                f.putValue("IBM US Equity");
+                f.closeObject();
+            }
+            f.closeArray();
+            total += os.str().length();
+        }
+        timer.stop();
+
+        cout << "Formatter:       " << timer.accumulatedUserTime() << "s\n";
+
+        bsl::string output;
+
+        timer.reset();
+        timer.start(true);
+        for (int d = 0; d < NUM_DOCUMENTS; ++d) {
+            output.clear();
+
+            Obj f(&output);
+            f.openArray();
+            for (int r = 0; r < NUM_RECORDS; ++r) {
+                if (r) {
+                    f.addArrayElementSeparator();
+                }
+                f.openObject();
+                f.openMember("id");
+                f.putValue(d * NUM_RECORDS + r);
+                f.closeMember();
+                f.openMember("price");
+                f.putValue(100.25 + r);
+                f.closeMember();
+                f.openMember("ticker");
+                f.putValue("IBM US Equity");
+                f.closeObject();
+            }
+            f.closeArray();
+            total -= output.length();
+        }
+        timer.stop();
+
+        cout << "BufferFormatter: " << timer.accumulatedUserTime() << "s\n";
+
+        ASSERTV(total, 0 == total);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
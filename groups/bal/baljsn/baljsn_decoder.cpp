@@ -193,6 +193,132 @@ int Decoder::decodeAny(bsl::istream&          stream,
     return decode(stream, any, options);
 }
 
+                        // ----------------------------
+                        // class Decoder_AttributeTable
+                        // ----------------------------
+
+// PRIVATE CLASS METHODS
+unsigned int Decoder_AttributeTable::hash(const bsl::string_view& name,
+                                          unsigned int            seed)
+{
+    // FNV-1a, with the seed mixed into the offset basis.
+
+    unsigned int result = 2166136261u ^ (seed * 0x9E3779B9u);
+    for (bsl::size_t i = 0; i < name.length(); ++i) {
+        result ^= static_cast<unsigned char>(name[i]);
+        result *= 16777619u;
+    }
+    return result ^ (result >> 15);
+}
+
+// CREATORS
+Decoder_AttributeTable::Decoder_AttributeTable(
+                                              bslma::Allocator *basicAllocator)
+: d_names(basicAllocator)
+, d_ids(basicAllocator)
+, d_slots(basicAllocator)
+, d_seed(0)
+, d_isPerfect(false)
+{
+}
+
+// MANIPULATORS
+void Decoder_AttributeTable::addAttribute(const bsl::string_view& name,
+                                          int                     id)
+{
+    BSLS_ASSERT(d_slots.empty());
+
+    d_names.push_back(bsl::string(name, d_names.get_allocator()));
+    d_ids.push_back(id);
+}
+
+void Decoder_AttributeTable::build()
+{
+    enum {
+        k_MAX_SEEDS       = 16,  // seeds tried for each size of table
+
+        k_MAX_SLOT_FACTOR = 16   // maximum ratio of slots to attributes
+    };
+
+    const bsl::size_t numNames = d_names.size();
+
+    bsl::size_t minSlots = 4;
+    while (minSlots < 2 * numNames) {
+        minSlots *= 2;
+    }
+
+    // Search for a seed, and a number of slots, for which no two names hash
+    // to the same slot, so that a lookup examines a single slot.
+
+    for (bsl::size_t numSlots = minSlots;
+         numSlots <= minSlots * k_MAX_SLOT_FACTOR / 2;
+         numSlots *= 2) {
+        const unsigned int mask = static_cast<unsigned int>(numSlots - 1);
+
+        for (unsigned int seed = 0; seed < k_MAX_SEEDS; ++seed) {
+            d_slots.assign(numSlots, -1);
+
+            bsl::size_t i = 0;
+            for (; i < numNames; ++i) {
+                const unsigned int slot = hash(d_names[i], seed) & mask;
+                if (0 <= d_slots[slot]) {
+                    break;
+                }
+                d_slots[slot] = static_cast<int>(i);
+            }
+
+            if (numNames == i) {
+                d_seed      = seed;
+                d_isPerfect = true;
+                return;                                               // RETURN
+            }
+        }
+    }
+
+    // Otherwise, resolve collisions by linear probing.
+
+    const unsigned int mask = static_cast<unsigned int>(minSlots - 1);
+
+    d_slots.assign(minSlots, -1);
+    d_seed      = 0;
+    d_isPerfect = false;
+
+    for (bsl::size_t i = 0; i < numNames; ++i) {
+        unsigned int slot = hash(d_names[i], d_seed) & mask;
+        while (0 <= d_slots[slot]) {
+            slot = (slot + 1) & mask;
+        }
+        d_slots[slot] = static_cast<int>(i);
+    }
+}
+
+// ACCESSORS
+int Decoder_AttributeTable::find(const bsl::string_view& name, int hint) const
+{
+    BSLS_ASSERT(!d_slots.empty());
+
+    if (0 <= hint && hint < numAttributes() && d_names[hint] == name) {
+        return hint;                                                  // RETURN
+    }
+
+    const unsigned int mask = static_cast<unsigned int>(d_slots.size() - 1);
+
+    unsigned int slot = hash(name, d_seed) & mask;
+    while (true) {
+        const int index = d_slots[slot];
+        if (index < 0) {
+            return -1;                                                // RETURN
+        }
+        if (d_names[index] == name) {
+            return index;                                             // RETURN
+        }
+        if (d_isPerfect) {
+            return -1;                                                // RETURN
+        }
+        slot = (slot + 1) & mask;
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
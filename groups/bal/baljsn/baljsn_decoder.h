@@ -71,6 +71,21 @@ BSLS_IDENT("$Id: $")
 // ```
 // See also {`bdljsn_tokenizer`|Strict Conformance}.
 //
+///Decoding Generated Sequence Types
+///---------------------------------
+// When decoding into a sequence type generated by `bas_codegen.pl` (i.e., a
+// type for which `bdlat_IsBasicSequence` is `true`), the decoder matches the
+// name of each member of a JSON object with an attribute of the type using a
+// dispatch table built once, on first use, for each such type, and
+// manipulates the attribute by id, rather than by name.  The table is first
+// consulted at the attribute following the one most recently matched, so that
+// the members of an object appearing in the declared order of the attributes
+// of the type, as they do in JSON produced by `baljsn::Encoder`, are each
+// matched by a single comparison of names; other names are found using a hash
+// function chosen, where possible, to be free of collisions for the names of
+// the type.  Names not found in the table (e.g., the selection names of an
+// untagged choice) are looked up by name, as for other sequence types.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -174,6 +189,7 @@ BSLS_IDENT("$Id: $")
 #include <bdlat_selectioninfo.h>
 #include <bdlat_sequencefunctions.h>
 #include <bdlat_typecategory.h>
+#include <bdlat_typetraits.h>
 #include <bdlat_valuetypefunctions.h>
 
 #include <bdlb_printmethods.h>
@@ -182,8 +198,16 @@ BSLS_IDENT("$Id: $")
 
 #include <bsla_fallthrough.h>
 
+#include <bslma_allocator.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
 #include <bslmf_assert.h>
+#include <bslmf_integralconstant.h>
 #include <bslmf_isintegral.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_once.h>
 
 #include <bsls_assert.h>
 #include <bsls_types.h>
@@ -194,6 +218,7 @@ BSLS_IDENT("$Id: $")
 #include <bsl_string.h>
 #include <bsl_string_view.h>
 #include <bsl_unordered_set.h>
+#include <bsl_vector.h>
 
 namespace BloombergLP {
 namespace baljsn {
@@ -483,6 +508,116 @@ struct Decoder_RequiredAttrsVisitor {
     int operator()(TYPE *value, const INFO& info);
 };
 
+                        // ============================
+                        // class Decoder_AttributeTable
+                        // ============================
+
+/// This component-private class provides a table mapping the names of the
+/// attributes of a `bdlat` sequence type to their ids.  A table is looked up
+/// first at a hinted attribute, and then using a hash function chosen, where
+/// possible, so that the names of the attributes do not collide.
+class Decoder_AttributeTable {
+
+    // DATA
+    bsl::vector<bsl::string> d_names;      // attribute names, in order added
+
+    bsl::vector<int>         d_ids;        // attribute ids, in order added
+
+    bsl::vector<int>         d_slots;      // indices into `d_names` (or -1),
+                                           // by hash; size is a power of 2
+
+    unsigned int             d_seed;       // seed of the hash function
+
+    bool                     d_isPerfect;  // `true` if no two names hash to
+                                           // the same slot
+
+    // PRIVATE CLASS METHODS
+
+    /// Return the hash value of the specified `name` for the specified
+    /// `seed`.
+    static unsigned int hash(const bsl::string_view& name, unsigned int seed);
+
+    /// Return the address of the table of the attributes of (template
+    /// parameter) `TYPE`, building it from the specified `object` on first
+    /// use.  Select this overload if `TYPE` is a generated sequence type.
+    template <class TYPE>
+    static const Decoder_AttributeTable *lookupTableImp(const TYPE& object,
+                                                        bsl::true_type);
+
+    /// Return 0.  Select this overload if `TYPE` is not a generated sequence
+    /// type, whose attributes might vary between objects.
+    template <class TYPE>
+    static const Decoder_AttributeTable *lookupTableImp(const TYPE&,
+                                                        bsl::false_type);
+
+    // NOT IMPLEMENTED
+    Decoder_AttributeTable(const Decoder_AttributeTable&);
+    Decoder_AttributeTable& operator=(const Decoder_AttributeTable&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Decoder_AttributeTable,
+                                   bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+
+    /// Return the address of the table of the attributes of (template
+    /// parameter) `TYPE`, building it from the attributes of the specified
+    /// `object` on the first call for `TYPE`, if `TYPE` is a sequence type
+    /// generated by `bas_codegen.pl`, and return 0 otherwise.  The table
+    /// exists until the end of the program.  This function is thread-safe.
+    template <class TYPE>
+    static const Decoder_AttributeTable *lookupTable(const TYPE& object);
+
+    // CREATORS
+
+    /// Create an empty table.  Optionally specify a `basicAllocator` used to
+    /// supply memory.  If `basicAllocator` is 0, the currently installed
+    /// default allocator is used.
+    explicit Decoder_AttributeTable(bslma::Allocator *basicAllocator = 0);
+
+    // MANIPULATORS
+
+    /// Add to this table an attribute having the specified `name` and `id`.
+    /// The behavior is undefined unless no attribute having `name` has been
+    /// added, and `build` has not been called.
+    void addAttribute(const bsl::string_view& name, int id);
+
+    /// Build the hash table of the attributes added to this table.
+    void build();
+
+    // ACCESSORS
+
+    /// Return the index (in the order added) of the attribute of this table
+    /// having the specified `name`, or -1 if there is no such attribute.
+    /// Compare `name` first with the name of the attribute at the specified
+    /// `hint` index, if `0 <= hint < numAttributes()`.  The behavior is
+    /// undefined unless `build` has been called.
+    int find(const bsl::string_view& name, int hint) const;
+
+    /// Return the id of the attribute at the specified `index`.  The
+    /// behavior is undefined unless `0 <= index < numAttributes()`.
+    int id(int index) const;
+
+    /// Return the number of attributes in this table.
+    int numAttributes() const;
+};
+
+                    // ===================================
+                    // struct Decoder_AttributeTableLoader
+                    // ===================================
+
+/// This class provides a functor that adds each attribute it visits to a
+/// `Decoder_AttributeTable`.
+struct Decoder_AttributeTableLoader {
+    // PUBLIC DATA
+    Decoder_AttributeTable *d_table_p;
+
+    // MANIPULATORS
+    template <class TYPE, class INFO>
+    int operator()(const TYPE&, const INFO& info);
+};
+
 // ============================================================================
 //                            INLINE DEFINITIONS
 // ============================================================================
@@ -603,6 +738,13 @@ int Decoder::decodeImp(TYPE *value, int mode, bdlat_TypeCategory::Sequence)
             bdlat_SequenceFunctions::manipulateAttributes(value, visitor);
         }
 
+        // For a generated type, find attributes using its table, hinting at
+        // the attribute following the one last found.
+
+        const Decoder_AttributeTable *table =
+                                   Decoder_AttributeTable::lookupTable(*value);
+        int                           hint  = 0;
+
         while (Tokenizer::e_ELEMENT_NAME == d_tokenizer.tokenType()) {
 
             bslstl::StringRef elementName;
@@ -612,7 +754,10 @@ int Decoder::decodeImp(TYPE *value, int mode, bdlat_TypeCategory::Sequence)
                 return -1;                                            // RETURN
             }
 
-            if (bdlat_SequenceFunctions::hasAttribute(
+            const int index = table ? table->find(elementName, hint) : -1;
+
+            if (0 <= index
+             || bdlat_SequenceFunctions::hasAttribute(
                                      *value,
                                      elementName.data(),
                                      static_cast<int>(elementName.length()))) {
@@ -627,11 +772,22 @@ int Decoder::decodeImp(TYPE *value, int mode, bdlat_TypeCategory::Sequence)
 
                 Decoder_ElementVisitor visitor = { this, mode };
 
-                if (0 != bdlat_SequenceFunctions::manipulateAttribute(
-                                   value,
-                                   visitor,
-                                   d_elementName.data(),
-                                   static_cast<int>(d_elementName.length()))) {
+                if (0 <= index) {
+                    rc = bdlat_SequenceFunctions::manipulateAttribute(
+                                                           value,
+                                                           visitor,
+                                                           table->id(index));
+                    hint = index + 1;
+                }
+                else {
+                    rc = bdlat_SequenceFunctions::manipulateAttribute(
+                                    value,
+                                    visitor,
+                                    d_elementName.data(),
+                                    static_cast<int>(d_elementName.length()));
+                }
+
+                if (0 != rc) {
                     d_logStream << "Could not decode sequence, error decoding "
                                 << "element or bad element name '"
                                 << d_elementName << "' \n";
@@ -1310,6 +1466,88 @@ int Decoder_RequiredAttrsVisitor::operator()(TYPE *value, const INFO& info) {
     return 0;
 }
 
+                        // ----------------------------
+                        // class Decoder_AttributeTable
+                        // ----------------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE>
+const Decoder_AttributeTable *Decoder_AttributeTable::lookupTableImp(
+                                                           const TYPE& object,
+                                                           bsl::true_type)
+{
+    static const Decoder_AttributeTable *table = 0;
+
+    BSLMT_ONCE_DO {
+        // The table is never destroyed, and so uses the new-delete allocator
+        // rather than the global allocator.
+
+        bslma::Allocator *allocator = &bslma::NewDeleteAllocator::singleton();
+
+        Decoder_AttributeTable *newTable =
+                        new (*allocator) Decoder_AttributeTable(allocator);
+
+        Decoder_AttributeTableLoader loader = { newTable };
+        bdlat_SequenceFunctions::accessAttributes(object, loader);
+        newTable->build();
+
+        table = newTable;
+    }
+
+    return table;
+}
+
+template <class TYPE>
+inline
+const Decoder_AttributeTable *Decoder_AttributeTable::lookupTableImp(
+                                                               const TYPE&,
+                                                               bsl::false_type)
+{
+    return 0;
+}
+
+// CLASS METHODS
+template <class TYPE>
+inline
+const Decoder_AttributeTable *Decoder_AttributeTable::lookupTable(
+                                                            const TYPE& object)
+{
+    typedef bsl::integral_constant<bool, bdlat_IsBasicSequence<TYPE>::value>
+                                                                       IsBasic;
+
+    return lookupTableImp(object, IsBasic());
+}
+
+// ACCESSORS
+inline
+int Decoder_AttributeTable::id(int index) const
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < numAttributes());
+
+    return d_ids[index];
+}
+
+inline
+int Decoder_AttributeTable::numAttributes() const
+{
+    return static_cast<int>(d_names.size());
+}
+
+                    // -----------------------------------
+                    // struct Decoder_AttributeTableLoader
+                    // -----------------------------------
+
+// MANIPULATORS
+template <class TYPE, class INFO>
+inline
+int Decoder_AttributeTableLoader::operator()(const TYPE&, const INFO& info)
+{
+    d_table_p->addAttribute(bsl::string_view(info.name(), info.nameLength()),
+                            info.id());
+    return 0;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -54,6 +54,7 @@
 #include <bslmt_testutil.h>
 
 #include <bslim_printer.h>
+#include <bslma_testallocator.h>
 #include <bslmt_threadutil.h>
 
 #include <s_baltst_address.h>
@@ -71,6 +72,7 @@
 #include <s_baltst_generatetesttaggedvalue.h>
 #include <s_baltst_myenumerationwithfallback.h>
 #include <s_baltst_myintenumeration.h>
+#include <s_baltst_mysequencewithanonymouschoice.h>
 #include <s_baltst_mysequencewitharray.h>
 #include <s_baltst_mysequencewithchoice.h>
 #include <s_baltst_mysequencewithdefault.h>
@@ -88,6 +90,9 @@
 #include <bsla_maybeunused.h>
 
 #include <bsls_libraryfeatures.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_algorithm.h>
 
 #include <bsl_climits.h>
 #include <bsl_cstdlib.h>
@@ -153,7 +158,9 @@ namespace test = BloombergLP::s_baltst;
 // [17] MAXDEPTH IS RESPECTED
 // [18] `allowMissingRequiredAttributes` OPTION
 // [19] TESTING `Decimal64`
-// [20] USAGE EXAMPLE
+// [20] TESTING `Decoder_AttributeTable`
+// [21] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -3400,7 +3407,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 20: {
+      case 21: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -3506,6 +3513,240 @@ int main(int argc, char *argv[])
     ASSERT(21              == employee.age());
 // ```
       } break;
+      case 20: {
+        // --------------------------------------------------------------------
+        // TESTING `Decoder_AttributeTable`
+        //   The decoder finds the attributes of a generated sequence type
+        //   using a table built once for each such type.
+        //
+        // Concerns:
+        // 1. `find` returns the index of each name added to a table, for any
+        //    hint, and -1 for any other name, including prefixes and
+        //    extensions of the names added, and the empty name.
+        //
+        // 2. `find` is correct both for tables small enough that a
+        //    collision-free hash function is found, and for tables so large
+        //    that collisions are resolved by probing.
+        //
+        // 3. `lookupTable` returns, for a generated sequence type, the same
+        //    table on every call, holding the names and ids of the
+        //    attributes of the type in declared order.
+        //
+        // 4. Objects whose members appear in any order, repeated, or
+        //    interleaved with unknown members, decode to the same value.
+        //
+        // 5. The selections of an untagged choice, which are not attributes
+        //    of the sequence, are still decoded.
+        //
+        // Plan:
+        // 1. Add N generated names to a table, for several N, and verify the
+        //    result of `find` for each name, with each hint, and for names
+        //    not added.  (C-1..2)
+        //
+        // 2. Call `lookupTable` for `s_baltst::Employee` twice and verify the
+        //    table.  (C-3)
+        //
+        // 3. Decode `s_baltst::Employee` from every permutation of its
+        //    members, with and without unknown and repeated members, and
+        //    verify the result.  (C-4)
+        //
+        // 4. Decode `s_baltst::MySequenceWithAnonymousChoice` having each
+        //    selection.  (C-5)
+        //
+        // Testing:
+        //   TESTING `Decoder_AttributeTable`
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING `Decoder_AttributeTable`"
+                          << "\n================================" << endl;
+
+        typedef baljsn::Decoder_AttributeTable Table;
+
+        if (verbose) cout << "\tFinding names." << endl;
+        {
+            static const int SIZES[] = { 0, 1, 2, 3, 7, 16, 50, 200, 1000 };
+            const int        NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+            for (int ti = 0; ti < NUM_SIZES; ++ti) {
+                const int N = SIZES[ti];
+
+                if (veryVerbose) { T_; P(N); }
+
+                bslma::TestAllocator ta("table", veryVeryVerbose);
+
+                bsl::vector<bsl::string> names;
+                for (int i = 0; i < N; ++i) {
+                    bsl::ostringstream oss;
+                    oss << "attribute" << i * 7;
+                    names.push_back(oss.str());
+                }
+
+                {
+                    Table mX(&ta);  const Table& X = mX;
+
+                    for (int i = 0; i < N; ++i) {
+                        mX.addAttribute(names[i], 100 + i);
+                    }
+                    mX.build();
+
+                    ASSERTV(N, N == X.numAttributes());
+
+                    for (int i = 0; i < N; ++i) {
+                        const bsl::string& NAME = names[i];
+
+                        ASSERTV(N, i, 100 + i == X.id(i));
+
+                        for (int hint = -1; hint <= N; ++hint) {
+                            ASSERTV(N, i, hint, i == X.find(NAME, hint));
+                        }
+
+                        const bsl::string PREFIX =
+                                          NAME.substr(0, NAME.length() - 1);
+
+                        const bsl::vector<bsl::string>::const_iterator IT =
+                                bsl::find(names.begin(), names.end(), PREFIX);
+                        const int PREFIX_INDEX =
+                                        names.end() == IT
+                                        ? -1
+                                        : static_cast<int>(IT - names.begin());
+
+                        ASSERTV(N, i, -1 == X.find(NAME + "x", i));
+                        ASSERTV(N, i, -1 == X.find(NAME + "x", i + 1));
+                        ASSERTV(N, i, PREFIX_INDEX == X.find(PREFIX, i));
+                    }
+                    ASSERTV(N, -1 == X.find("", 0));
+                    ASSERTV(N, -1 == X.find("attribute1", 0));
+                    ASSERTV(N, -1 == X.find("Attribute0", 0));
+                }
+                ASSERTV(N, 0 == ta.numBytesInUse());
+            }
+        }
+
+        if (verbose) cout << "\tTable of a generated type." << endl;
+        {
+            const test::Employee EMPLOYEE;
+
+            const Table *TABLE = Table::lookupTable(EMPLOYEE);
+
+            ASSERT(0 != TABLE);
+            ASSERT(TABLE == Table::lookupTable(test::Employee()));
+
+            if (TABLE) {
+                ASSERT(3 == TABLE->numAttributes());
+                ASSERT(0 == TABLE->find("name",        0));
+                ASSERT(1 == TABLE->find("homeAddress", 1));
+                ASSERT(2 == TABLE->find("age",         2));
+                ASSERT(test::Employee::ATTRIBUTE_ID_NAME         ==
+                                                             TABLE->id(0));
+                ASSERT(test::Employee::ATTRIBUTE_ID_HOME_ADDRESS ==
+                                                             TABLE->id(1));
+                ASSERT(test::Employee::ATTRIBUTE_ID_AGE          ==
+                                                             TABLE->id(2));
+            }
+
+            ASSERT(0 != Table::lookupTable(test::Address()));
+            ASSERT(TABLE != Table::lookupTable(test::Address()));
+        }
+
+        if (verbose) cout << "\tDecoding members in any order." << endl;
+        {
+            const char *const MEMBERS[] = {
+                "\"name\":\"Bob\"",
+                "\"homeAddress\":{\"state\":\"New York\","
+                                 "\"city\":\"New York City\","
+                                 "\"street\":\"Lexington Ave\"}",
+                "\"age\":21"
+            };
+            const char *const UNKNOWN = "\"unknown\":{\"name\":[1,2]}";
+
+            int order[] = { 0, 1, 2 };
+
+            do {
+                for (int variant = 0; variant < 3; ++variant) {
+                    bsl::string input("{");
+                    for (int i = 0; i < 3; ++i) {
+                        if (i) {
+                            input += ",";
+                        }
+                        if (1 == variant) {
+                            input += UNKNOWN;
+                            input += ",";
+                        }
+                        input += MEMBERS[order[i]];
+                    }
+                    if (2 == variant) {
+                        // A repeated member replaces the earlier value.
+
+                        input += ",\"age\":22";
+                    }
+                    input += "}";
+
+                    if (veryVerbose) { T_; P(input); }
+
+                    test::Employee         employee;
+                    baljsn::Decoder        decoder;
+                    baljsn::DecoderOptions options;
+                    bsl::istringstream     is(input);
+
+                    options.setSkipUnknownElements(1 == variant);
+
+                    ASSERTV(input, decoder.loggedMessages(),
+                            0 == decoder.decode(is, &employee, options));
+                    ASSERTV(input, "Bob" == employee.name());
+                    ASSERTV(input, "Lexington Ave" ==
+                                              employee.homeAddress().street());
+                    ASSERTV(input, "New York City" ==
+                                                employee.homeAddress().city());
+                    ASSERTV(input, "New York" ==
+                                               employee.homeAddress().state());
+                    ASSERTV(input, employee.age(),
+                            (2 == variant ? 22 : 21) == employee.age());
+                    ASSERTV(input, (1 == variant ? 3 : 0) ==
+                                          decoder.numUnknownElementsSkipped());
+                }
+            } while (bsl::next_permutation(order, order + 3));
+        }
+
+        if (verbose) cout << "\tDecoding an untagged choice." << endl;
+        {
+            static const struct {
+                int         d_line;       // source line number
+                const char *d_input_p;    // JSON input
+                int         d_selection;  // expected selection id
+            } DATA[] = {
+                { L_, "{\"attribute1\":1,\"myChoice1\":2,"
+                      "\"attribute2\":\"a\"}",                             0 },
+                { L_, "{\"myChoice2\":\"b\",\"attribute2\":\"a\","
+                      "\"attribute1\":1}",                                 1 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE      = DATA[ti].d_line;
+                const char *const INPUT     = DATA[ti].d_input_p;
+                const int         SELECTION = DATA[ti].d_selection;
+
+                test::MySequenceWithAnonymousChoice value;
+                baljsn::Decoder                     decoder;
+                baljsn::DecoderOptions              options;
+                bsl::istringstream                  is(INPUT);
+
+                options.setSkipUnknownElements(false);
+
+                ASSERTV(LINE, decoder.loggedMessages(),
+                        0 == decoder.decode(is, &value, options));
+                ASSERTV(LINE, SELECTION == value.choice().selectionId());
+                ASSERTV(LINE, 1   == value.attribute1().value());
+                ASSERTV(LINE, "a" == value.attribute2().value());
+                if (0 == SELECTION) {
+                    ASSERTV(LINE, 2 == value.choice().myChoice1());
+                }
+                else {
+                    ASSERTV(LINE, "b" == value.choice().myChoice2());
+                }
+            }
+        }
+      } break;
       case 19: {
         // --------------------------------------------------------------------
         // TESTING `Decimal64`
@@ -9144,6 +9385,60 @@ int main(int argc, char *argv[])
             ASSERT(21            == bob.age());
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        // 1. Report the time taken to decode a generated sequence type whose
+        //    members appear in declared order.
+        //
+        // Plan:
+        // 1. Decode an array of `s_baltst::Employee` objects encoded by
+        //    `baljsn::Encoder`, and report the time taken.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE TEST"
+                          << "\n================" << endl;
+
+        const int NUM_EMPLOYEES  = 10000;
+        const int NUM_ITERATIONS = 20;
+
+        bsl::vector<test::Employee> employees(NUM_EMPLOYEES);
+        for (int i = 0; i < NUM_EMPLOYEES; ++i) {
+            employees[i].name()                 = "Some Employee Name";
+            employees[i].homeAddress().street() = "Lexington Ave";
+            employees[i].homeAddress().city()   = "New York City";
+            employees[i].homeAddress().state()  = "New York";
+            employees[i].age()                  = i;
+        }
+
+        bsl::ostringstream     os;
+        baljsn::Encoder        encoder;
+        baljsn::EncoderOptions encoderOptions;
+        ASSERT(0 == encoder.encode(os, employees, encoderOptions));
+
+        const bsl::string INPUT = os.str();
+
+        bsls::Stopwatch sw;
+        sw.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            bsl::vector<test::Employee> decoded;
+            baljsn::Decoder             decoder;
+            baljsn::DecoderOptions      options;
+            bsl::istringstream          is(INPUT);
+
+            ASSERT(0 == decoder.decode(is, &decoded, options));
+            ASSERT(employees == decoded);
+        }
+        sw.stop();
+
+        cout << "Decoded " << INPUT.length() << " bytes in "
+             << sw.elapsedTime() / NUM_ITERATIONS << " s" << endl;
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
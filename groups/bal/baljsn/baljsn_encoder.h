@@ -15,11 +15,13 @@ BSLS_IDENT("$Id: $")
 //@DESCRIPTION: This component provides a class, `baljsn::Encoder`, for
 // encoding value-semantic objects in the JSON format.  In particular, the
 // `class` contains a parameterized `encode` function that encodes an object
-// into a specified stream.  There are two overloaded versions of this
-// function:
+// into a specified stream or buffer.  There are four overloaded versions of
+// this function:
 //
 // * one that writes to a `bsl::streambuf`
 // * one that writes to an `bsl::ostream`
+// * one that appends to a `bsl::string`
+// * one that appends to a `bdlbb::Blob`
 //
 // This component can be used with types that support the `bdlat` framework
 // (see the `bdlat` package for details), which is a compile-time interface for
@@ -38,6 +40,27 @@ BSLS_IDENT("$Id: $")
 // Refer to the details of the JSON encoding format supported by this encoder
 // in the package documentation file (doc/baljsn.txt).
 //
+///Encoding into a Buffer
+///----------------------
+// The `encode` overloads that write to a `bsl::streambuf` or `bsl::ostream`
+// render each token of the document through a `bsl::ostream`, which (for the
+// short tokens that make up most JSON documents) accounts for a large part of
+// the cost of encoding.  The overloads that write to a `bsl::string` or a
+// `bdlbb::Blob` instead render the document with a `baljsn::BufferFormatter`,
+// which appends each token directly to a contiguous buffer and renders numbers
+// using `bslalg::NumericFormatterUtil::toChars`, and so do not use a stream
+// at all except for the (uncommon) types that `baljsn::BufferFormatter`
+// delegates to `baljsn::PrintUtil`.  The text produced is identical in all
+// cases.  When the encoded document is needed in memory (e.g., to be sent as a
+// message), encoding into a `bsl::string` that is reused from one document to
+// the next is the fastest way to use this component.  Encoding into a
+// `bdlbb::Blob` encodes into a contiguous buffer and then copies the result
+// into the blob.
+//
+// On failure, the overloads that write to a `bsl::string` or a `bdlbb::Blob`
+// leave the string or blob unchanged, whereas the overloads that write to a
+// stream may have written part of the document.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -132,6 +155,7 @@ BSLS_IDENT("$Id: $")
 
 #include <balscm_version.h>
 
+#include <baljsn_bufferformatter.h>
 #include <baljsn_encodeimplutil.h>
 #include <baljsn_encoderoptions.h>
 #include <baljsn_formatter.h>
@@ -151,6 +175,9 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlb_print.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+
 #include <bdlsb_memoutstreambuf.h>
 
 #include <bsla_maybeunused.h>
@@ -240,6 +267,45 @@ class Encoder {
                const TYPE&           value,
                const EncoderOptions *options);
 
+    /// Encode the specified `value`, of (template parameter) `TYPE`, in the
+    /// JSON format using the specified `options` and append it to the
+    /// specified `output`.  Specifying a nullptr `options` is equivalent to
+    /// passing a default-constructed EncoderOptions in `options`.  `TYPE`
+    /// shall be a `bdlat`-compatible sequence, choice, or array type, or a
+    /// `bdlat`-compatible dynamic type referring to one of those types.
+    /// Return 0 on success, and a non-zero value, leaving `output`
+    /// unchanged, otherwise.  Note that the text appended is identical to
+    /// that written by the overloads taking a `bsl::streambuf`, but is
+    /// rendered without the use of a stream (see {Encoding into a Buffer}).
+    template <class TYPE>
+    int encode(bsl::string           *output,
+               const TYPE&            value,
+               const EncoderOptions&  options);
+    template <class TYPE>
+    int encode(bsl::string          *output,
+               const TYPE&           value,
+               const EncoderOptions *options);
+
+    /// Encode the specified `value`, of (template parameter) `TYPE`, in the
+    /// JSON format using the specified `options` and append it to the
+    /// specified `output`.  Specifying a nullptr `options` is equivalent to
+    /// passing a default-constructed EncoderOptions in `options`.  `TYPE`
+    /// shall be a `bdlat`-compatible sequence, choice, or array type, or a
+    /// `bdlat`-compatible dynamic type referring to one of those types.
+    /// Return 0 on success, and a non-zero value, leaving `output`
+    /// unchanged, otherwise.  The behavior is undefined unless `output` has
+    /// a blob buffer factory.  Note that the document is encoded into a
+    /// contiguous buffer (see {Encoding into a Buffer}) that is then copied
+    /// into `output`.
+    template <class TYPE>
+    int encode(bdlbb::Blob           *output,
+               const TYPE&            value,
+               const EncoderOptions&  options);
+    template <class TYPE>
+    int encode(bdlbb::Blob          *output,
+               const TYPE&           value,
+               const EncoderOptions *options);
+
     /// Encode the specified `value` of (template parameter) `TYPE` into the
     /// specified `streamBuf`.  Return 0 on success, and a non-zero value
     /// otherwise.
@@ -443,6 +509,101 @@ int Encoder::encode(bsl::ostream&         stream,
     return encode(stream, value, options ? *options : localOpts);
 }
 
+template <class TYPE>
+int Encoder::encode(bsl::string           *output,
+                    const TYPE&            value,
+                    const EncoderOptions&  options)
+{
+    BSLS_ASSERT(output);
+
+    d_logStream.clear();
+    d_logStream.str("");
+
+    bdlat_TypeCategory::Value category =
+                                    bdlat_TypeCategoryFunctions::select(value);
+    if (bdlat_TypeCategory::e_SEQUENCE_CATEGORY != category &&
+        bdlat_TypeCategory::e_CHOICE_CATEGORY != category &&
+        bdlat_TypeCategory::e_ARRAY_CATEGORY != category) {
+        logStream()
+            << "Encoded object must be a Sequence, Choice, or Array type."
+            << bsl::endl;
+        return -1;                                                    // RETURN
+    }
+
+    const bsl::string::size_type initialLength = output->length();
+
+    BufferFormatter formatter(
+                   output,
+                   baljsn::EncoderOptions::e_PRETTY == options.encodingStyle(),
+                   options.initialIndentLevel(),
+                   options.spacesPerLevel(),
+                   options.escapeForwardSlash());
+
+    formatter.openDocument();
+
+    bool      isValueEmpty = false;
+    const int rc           = EncodeImplUtil<BufferFormatter>::encode(
+                                               &isValueEmpty,
+                                               &formatter,
+                                               &d_logStream,
+                                               value,
+                                               bdlat_FormattingMode::e_DEFAULT,
+                                               options,
+                                               false);
+    if (0 != rc) {
+        if (0 != formatter.nestingDepth()) {
+            logStream() << "Encoding failed leaving an unclosed element (rc = "
+                        << rc << ")\n";
+        }
+        output->resize(initialLength);
+        return rc;                                                    // RETURN
+    }
+
+    formatter.closeDocument();
+
+    return 0;
+}
+
+template <class TYPE>
+inline
+int Encoder::encode(bsl::string          *output,
+                    const TYPE&           value,
+                    const EncoderOptions *options)
+{
+    EncoderOptions localOpts;
+    return encode(output, value, options ? *options : localOpts);
+}
+
+template <class TYPE>
+int Encoder::encode(bdlbb::Blob           *output,
+                    const TYPE&            value,
+                    const EncoderOptions&  options)
+{
+    BSLS_ASSERT(output);
+
+    bsl::string buffer;
+
+    const int rc = encode(&buffer, value, options);
+    if (0 != rc) {
+        return rc;                                                    // RETURN
+    }
+
+    bdlbb::BlobUtil::append(output,
+                            buffer.data(),
+                            static_cast<int>(buffer.length()));
+    return 0;
+}
+
+template <class TYPE>
+inline
+int Encoder::encode(bdlbb::Blob          *output,
+                    const TYPE&           value,
+                    const EncoderOptions *options)
+{
+    EncoderOptions localOpts;
+    return encode(output, value, options ? *options : localOpts);
+}
+
 template <class TYPE>
 inline
 int Encoder::encodeAny(bsl::streambuf        *streamBuf,
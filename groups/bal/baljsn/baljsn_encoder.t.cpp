@@ -24,6 +24,10 @@
 #include <bdlb_nullablevalue.h>
 #include <bdlb_variant.h>
 
+#include <bdlbb_blob.h>
+#include <bdlbb_blobutil.h>
+#include <bdlbb_pooledblobbufferfactory.h>
+
 #include <bdldfp_decimal.h>
 
 #include <bdlpcre_regex.h>
@@ -40,6 +44,9 @@
 
 #include <bsla_maybeunused.h>
 
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
 #include <bsl_climits.h>
 #include <bsl_cstddef.h>
 #include <bsl_cstdlib.h>
@@ -103,6 +110,10 @@ using bsl::endl;
 // [14] int encode(bsl::ostream& stream, const TYPE& v, options);
 // [14] int encode(bsl::streambuf *streamBuf, const TYPE& v, &options);
 // [14] int encode(bsl::ostream& stream, const TYPE& v, &options);
+// [16] int encode(bsl::string *output, const TYPE& v, options);
+// [16] int encode(bsl::string *output, const TYPE& v, &options);
+// [16] int encode(bdlbb::Blob *output, const TYPE& v, options);
+// [16] int encode(bdlbb::Blob *output, const TYPE& v, &options);
 //
 // ACCESSORS
 // [13] bsl::string loggedMessages() const;
@@ -123,7 +134,9 @@ using bsl::endl;
 // [13] ENCODING NULL CHOICE
 // [14] ENCODING VECTORS OF VECTORS
 // [15] TESTING `Decimal64`
-// [16] USAGE EXAMPLE
+// [16] ENCODING INTO A `bsl::string` OR `bdlbb::Blob`
+// [17] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -1104,7 +1117,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 16: {
+      case 17: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1221,6 +1234,165 @@ int main(int argc, char *argv[])
     ASSERT(EXP_OUTPUT == os.str());
 // ```
       } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // ENCODING INTO A `bsl::string` OR `bdlbb::Blob`
+        //
+        // Concerns:
+        // 1. Encoding into a `bsl::string` or a `bdlbb::Blob` produces the
+        //    same text as encoding into a stream buffer, in both the pretty
+        //    and the compact style.
+        //
+        // 2. The text is appended to the existing contents of the string or
+        //    blob.
+        //
+        // 3. If encoding fails, either because the type is not a sequence,
+        //    choice, or array, or because a value within the object cannot be
+        //    encoded, the string or blob is left unchanged, and the failure
+        //    is described by `loggedMessages`.
+        //
+        // 4. The overloads taking a pointer to `EncoderOptions` treat a null
+        //    pointer as default options.
+        //
+        // Plan:
+        // 1. For each `s_baltst::FeatureTestMessage` object, encode the object
+        //    into a `bsl::string` and into a `bdlbb::Blob`, both initially
+        //    empty and having existing contents, in the pretty and the
+        //    compact style, and compare the text appended with the expected
+        //    JSON.  (C-1..2)
+        //
+        // 2. Attempt to encode an object that is not a sequence, choice, or
+        //    array, and a sequence having a string that is not valid UTF-8,
+        //    and verify that the string or blob is unchanged and that a
+        //    message is logged.  (C-3)
+        //
+        // 3. Encode using a null options pointer and compare the result with
+        //    encoding using default options.  (C-4)
+        //
+        // Testing:
+        //   int encode(bsl::string *output, const TYPE& v, options);
+        //   int encode(bsl::string *output, const TYPE& v, &options);
+        //   int encode(bdlbb::Blob *output, const TYPE& v, options);
+        //   int encode(bdlbb::Blob *output, const TYPE& v, &options);
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << "\nENCODING INTO A `bsl::string` OR `bdlbb::Blob`"
+                 << "\n==============================================" << endl;
+
+        typedef s_baltst::FeatureTestMessageUtil MessageUtil;
+
+        bsl::vector<s_baltst::FeatureTestMessage> testObjects;
+        u::constructFeatureTestMessage(&testObjects);
+
+        bdlbb::PooledBlobBufferFactory factory(7);
+
+        for (int pretty = 0; pretty < 2; ++pretty) {
+            Options options;
+            if (pretty) {
+                options.setEncodingStyle(baljsn::EncoderOptions::e_PRETTY);
+                options.setInitialIndentLevel(0);
+                options.setSpacesPerLevel(2);
+            }
+
+            for (int i = 0; i < MessageUtil::k_NUM_MESSAGES; ++i) {
+                const bsl::string EXP =
+                                   pretty
+                                   ? MessageUtil::s_PRETTY_JSON_MESSAGES[i]
+                                   : MessageUtil::s_COMPACT_JSON_MESSAGES[i];
+
+                if (veryVerbose) { T_ P_(pretty) P(i) }
+
+                Obj encoder;
+
+                for (int prefixed = 0; prefixed < 2; ++prefixed) {
+                    const bsl::string PREFIX = prefixed ? "[1,2]\n" : "";
+
+                    bsl::string output(PREFIX);
+                    ASSERTV(pretty, i, 0 == encoder.encode(&output,
+                                                           testObjects[i],
+                                                           options));
+                    ASSERTV(pretty, i, output, EXP, PREFIX + EXP == output);
+
+                    bdlbb::Blob blob(&factory);
+                    bdlbb::BlobUtil::append(&blob,
+                                            PREFIX.data(),
+                                            static_cast<int>(PREFIX.size()));
+                    ASSERTV(pretty, i, 0 == encoder.encode(&blob,
+                                                           testObjects[i],
+                                                           options));
+
+                    bsl::string blobText(blob.length(), '\0');
+                    if (blob.length()) {
+                        bdlbb::BlobUtil::copy(&blobText[0],
+                                              blob,
+                                              0,
+                                              blob.length());
+                    }
+                    ASSERTV(pretty, i, blobText, EXP,
+                            PREFIX + EXP == blobText);
+                }
+            }
+        }
+
+        if (verbose) cout << "\tTesting failures." << endl;
+        {
+            Obj encoder;
+
+            bsl::string output("existing");
+            int         rc = encoder.encode(&output, 17, Options());
+            ASSERTV(rc, 0 != rc);
+            ASSERTV(output, "existing" == output);
+            ASSERTV(encoder.loggedMessages(),
+                    !encoder.loggedMessages().empty());
+
+            s_baltst::Address address;
+            address.street() = "Lexington Ave";
+            address.city()   = "New York \xff";
+            address.state()  = "New York";
+
+            for (int pretty = 0; pretty < 2; ++pretty) {
+                Options options;
+                if (pretty) {
+                    options.setEncodingStyle(
+                                            baljsn::EncoderOptions::e_PRETTY);
+                    options.setSpacesPerLevel(4);
+                }
+
+                rc = encoder.encode(&output, address, options);
+                ASSERTV(pretty, rc, 0 != rc);
+                ASSERTV(pretty, output, "existing" == output);
+                ASSERTV(pretty, encoder.loggedMessages(),
+                        !encoder.loggedMessages().empty());
+
+                bdlbb::Blob blob(&factory);
+                bdlbb::BlobUtil::append(&blob, "existing", 8);
+
+                rc = encoder.encode(&blob, address, options);
+                ASSERTV(pretty, rc, 0 != rc);
+                ASSERTV(pretty, blob.length(), 8 == blob.length());
+            }
+        }
+
+        if (verbose) cout << "\tTesting null options." << endl;
+        {
+            Obj encoder;
+
+            const Options *NULL_OPTIONS = 0;
+
+            bsl::string exp;
+            ASSERT(0 == encoder.encode(&exp, testObjects[0], Options()));
+
+            bsl::string output;
+            ASSERT(0 == encoder.encode(&output, testObjects[0], NULL_OPTIONS));
+            ASSERTV(exp, output, exp == output);
+
+            bdlbb::Blob blob(&factory);
+            ASSERT(0 == encoder.encode(&blob, testObjects[0], NULL_OPTIONS));
+            ASSERTV(exp.size(), blob.length(),
+                    static_cast<int>(exp.size()) == blob.length());
+        }
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // TESTING `Decimal64`
@@ -3972,6 +4144,83 @@ int main(int argc, char *argv[])
 
         ASSERTV(ss.str(), "{\"simpleValue\":1}" == ss.str());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Compare the throughput of encoding into a stream buffer with that
+        //   of encoding into a `bsl::string` and into a `bdlbb::Blob`.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nPERFORMANCE TEST"
+                          << "\n================" << endl;
+
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 2000;
+
+        bsl::vector<s_baltst::FeatureTestMessage> testObjects;
+        u::constructFeatureTestMessage(&testObjects);
+
+        const int NUM_OBJECTS = static_cast<int>(testObjects.size());
+
+        for (int pretty = 0; pretty < 2; ++pretty) {
+            Options options;
+            if (pretty) {
+                options.setEncodingStyle(baljsn::EncoderOptions::e_PRETTY);
+                options.setSpacesPerLevel(2);
+            }
+
+            Obj                encoder;
+            bsls::Stopwatch    timer;
+            bsls::Types::Int64 numBytes = 0;
+
+            timer.start(true);
+            for (int n = 0; n < NUM_ITERATIONS; ++n) {
+                for (int i = 0; i < NUM_OBJECTS; ++i) {
+                    bdlsb::MemOutStreamBuf osb;
+                    encoder.encode(&osb, testObjects[i], options);
+                    numBytes += osb.length();
+                }
+            }
+            timer.stop();
+            const double streamTime = timer.accumulatedUserTime();
+
+            bsl::string output;
+
+            timer.reset();
+            timer.start(true);
+            for (int n = 0; n < NUM_ITERATIONS; ++n) {
+                for (int i = 0; i < NUM_OBJECTS; ++i) {
+                    output.clear();
+                    encoder.encode(&output, testObjects[i], options);
+                    numBytes -= output.length();
+                }
+            }
+            timer.stop();
+            const double stringTime = timer.accumulatedUserTime();
+
+            bdlbb::PooledBlobBufferFactory factory(4096);
+
+            timer.reset();
+            timer.start(true);
+            for (int n = 0; n < NUM_ITERATIONS; ++n) {
+                for (int i = 0; i < NUM_OBJECTS; ++i) {
+                    bdlbb::Blob blob(&factory);
+                    encoder.encode(&blob, testObjects[i], options);
+                }
+            }
+            timer.stop();
+            const double blobTime = timer.accumulatedUserTime();
+
+            ASSERTV(numBytes, 0 == numBytes);
+
+            cout << (pretty ? "PRETTY" : "COMPACT") << '\n'
+                 << "\tbsl::streambuf: " << streamTime << "s\n"
+                 << "\tbsl::string:    " << stringTime << "s\n"
+                 << "\tbdlbb::Blob:    " << blobTime   << "s\n";
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
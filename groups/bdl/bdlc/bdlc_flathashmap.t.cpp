@@ -143,12 +143,16 @@ using namespace bsl;
 // [ 2] void clear();
 // [12] bsl::pair<iterator, iterator> equal_range(const KEY& key);
 // [ 2] size_t erase(const KEY&);
+// [34] size_t erase(const KEY&, size_t);
 // [17] iterator erase(const_iterator);
 // [17] iterator erase(iterator);
 // [18] iterator erase(const_iterator, const_iterator);
 // [24] iterator find(const KEY& key);
+// [34] iterator find(const KEY& key, size_t);
 // [ 2] bsl::pair<iterator, bool> insert(FORWARD_REF(VALUE_TYPE) entry)
 // [28] iterator insert(const_iterator, FORWARD_REF(VALUE_TYPE) entry)
+// [34] bsl::pair<iterator, bool> insert(const value_type&, size_t);
+// [34] bsl::pair<iterator, bool> insert(MovableRef<value_type>, size_t);
 // [16] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
 // #if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
 // [23] void insert(bsl::initializer_list<value_type> values);
@@ -180,10 +184,12 @@ using namespace bsl;
 // [11] bool empty() const;
 // [12] bsl::pair<ci, ci> equal_range(const KEY&) const;
 // [ 4] const_iterator find(const KEY&) const;
+// [34] const_iterator find(const KEY&, size_t) const;
 // [ 4] HASH hash_function() const;
 // [ 4] EQUAL key_eq() const;
 // [11] float load_factor() const;
 // [ 4] float max_load_factor() const;
+// [34] void prefetch(size_t) const;
 // [ 4] size_t size() const;
 // [12] const_iterator begin() const;
 // [12] const_iterator cbegin() const;
@@ -200,7 +206,7 @@ using namespace bsl;
 // FREE FUNCTIONS
 // [ 8] void swap(FlatHashMap&, FlatHashMap&);
 // ----------------------------------------------------------------------------
-// [34] USAGE EXAMPLE
+// [35] USAGE EXAMPLE
 // [32] CONCERN: `find`             handles transparent comparators
 // [32] CONCERN: `contains`         handles transparent comparators
 // [32] CONCERN: `count`            handles transparent comparators
@@ -215,6 +221,7 @@ using namespace bsl;
 // [30] DRQS 169531176: bsl::inserter compatibility on Sun
 // [ 1] BREATHING TEST
 // [-1] PERFORMANCE TEST
+// [-2] LOOKUP THROUGHPUT BENCHMARK
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -278,6 +285,10 @@ void aSsErT(bool condition, const char *message, int line)
 
 const bsl::uint8_t k_SIZE = bdlc::FlatHashTable_GroupControl::k_SIZE;
 
+/// The capacity of a map for which a capacity of 32 is requested, which
+/// exceeds 32 if the minimum capacity (twice the group size) does.
+const bsl::size_t k_CAPACITY_32 = 2 * k_SIZE > 32 ? 2 * k_SIZE : 32;
+
 // ============================================================================
 //                     GLOBAL VARIABLES FOR TESTING
 // ----------------------------------------------------------------------------
@@ -965,6 +976,59 @@ bsls::TimeInterval performanceFindNotPresent(MAP *map)
 
     bsl::sort(results.begin(), results.end());
 
+    return results[NUM_TRIAL / 2];
+}
+
+/// Return the median time (in nanoseconds) of a `find` in a
+/// `bdlc::FlatHashMap<int, int>` having a capacity of the specified
+/// `capacity` filled to the specified `loadFactor`, where the keys searched
+/// for are present in the map if the specified `present` is `true`, and are
+/// absent otherwise.  The keys are spread through the map by a
+/// multiplicative hash so that both the table and the probe sequences are
+/// exercised, and the memory is supplied by the specified `allocator`.
+double performanceFindAtLoad(bsl::size_t       capacity,
+                             double            loadFactor,
+                             bool              present,
+                             bslma::Allocator *allocator)
+{
+    const int NUM_TRIAL = 15;
+
+    bdlc::FlatHashMap<int, int> map(capacity, allocator);
+
+    const bsl::size_t CAPACITY = map.capacity();
+    const int         NUM_KEYS = static_cast<int>(
+                                static_cast<double>(CAPACITY) * loadFactor);
+
+    // Even multiples of the multiplier are inserted, odd ones are absent.
+
+    const unsigned int MULTIPLIER = 2654435761u;
+
+    for (int i = 0; i < NUM_KEYS; ++i) {
+        map.insert(bsl::make_pair(static_cast<int>(2 * i * MULTIPLIER), i));
+    }
+    ASSERTV(CAPACITY, map.capacity(), CAPACITY == map.capacity());
+
+    const int OFFSET = present ? 0 : 1;
+
+    bsl::vector<double> results;
+    for (int trial = 0; trial < NUM_TRIAL; ++trial) {
+        bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            const int key = static_cast<int>((2 * i + OFFSET) * MULTIPLIER);
+            if (map.end() != map.find(key)) {
+                ++s_antiOptimization;
+            }
+        }
+
+        results.push_back(static_cast<double>(
+               (bsls::SystemTime::nowMonotonicClock() - start)
+                                                       .totalNanoseconds()) /
+                                                                     NUM_KEYS);
+    }
+
+    bsl::sort(results.begin(), results.end());
+
     return results[NUM_TRIAL / 2];
 }
 
@@ -1455,7 +1519,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 34: {
+      case 35: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -1604,6 +1668,124 @@ int main(int argc, char *argv[])
 //  among         3
 // ```
       } break;
+      case 34: {
+        // --------------------------------------------------------------------
+        // PRECOMPUTED HASH VALUES
+        //
+        // Concerns:
+        // 1. The overloads of `find`, `insert`, and `erase` taking a hash
+        //    value forward to the underlying table, and behave as the
+        //    corresponding overloads taking only a key (or value).
+        //
+        // 2. A hash value computed once can be used with several maps having
+        //    the same hasher.
+        //
+        // 3. `prefetch` has no observable effect.
+        //
+        // Plan:
+        // 1. Create two maps having `bsl::string` keys.  For a sequence of
+        //    keys, compute the hash value of each key once, and use it to
+        //    insert the key into both maps, using both the `const` reference
+        //    and the movable reference `insert` overloads.  (C-1,2)
+        //
+        // 2. For each key, and for some absent keys, invoke `prefetch`, and
+        //    verify that the hash-taking `find` (both `const` and non-`const`)
+        //    and `erase` agree with the key-only overloads.  (C-1..3)
+        //
+        // Testing:
+        //   size_t erase(const KEY&, size_t);
+        //   iterator find(const KEY& key, size_t);
+        //   bsl::pair<iterator, bool> insert(const value_type&, size_t);
+        //   bsl::pair<iterator, bool> insert(MovableRef<value_type>, size_t);
+        //   const_iterator find(const KEY&, size_t) const;
+        //   void prefetch(size_t) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRECOMPUTED HASH VALUES" << endl
+                          << "=======================" << endl;
+
+        typedef bdlc::FlatHashMap<bsl::string, int> Obj;
+        typedef Obj::value_type                     ValueType;
+
+        static const char *DATA[] = {
+            "", "a", "AB", "abc", "a string long enough to allocate memory",
+            "IBM", "MSFT", "AAPL", "GOOG", "AMZN", "NVDA", "TSLA", "JPM"
+        };
+        enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        bslma::TestAllocator         oa("object",  veryVeryVeryVerbose);
+        bslma::TestAllocator         sa("scratch", veryVeryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&sa);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        Obj mY(&oa);  const Obj& Y = mY;
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const bsl::string KEY(DATA[i], &oa);
+            const bsl::size_t HASH = X.hash_function()(KEY);
+
+            ASSERTV(i, HASH == Y.hash_function()(KEY));
+
+            X.prefetch(HASH);
+            Y.prefetch(HASH);
+
+            ASSERTV(i, X.end() == X.find(KEY, HASH));
+
+            bsl::pair<Obj::iterator, bool> rv;
+
+            rv = mX.insert(ValueType(KEY, i), HASH);
+            ASSERTV(i, rv.second);
+            ASSERTV(i, KEY == rv.first->first && i == rv.first->second);
+
+            ValueType value(KEY, -i, &oa);
+            rv = mY.insert(bslmf::MovableRefUtil::move(value), HASH);
+            ASSERTV(i, rv.second);
+            ASSERTV(i, KEY == rv.first->first && -i == rv.first->second);
+
+            rv = mX.insert(ValueType(KEY, -1), HASH);
+            ASSERTV(i, !rv.second);
+            ASSERTV(i, i == rv.first->second);
+
+            ASSERTV(i, static_cast<bsl::size_t>(i + 1) == X.size());
+            ASSERTV(i, static_cast<bsl::size_t>(i + 1) == Y.size());
+        }
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const bsl::string KEY(DATA[i], &oa);
+            const bsl::size_t HASH = X.hash_function()(KEY);
+
+            X.prefetch(HASH);
+
+            ASSERTV(i, X.find(KEY)  == X.find(KEY, HASH));
+            ASSERTV(i, mX.find(KEY) == mX.find(KEY, HASH));
+            ASSERTV(i, Y.find(KEY)  == Y.find(KEY, HASH));
+            ASSERTV(i, i  == X.find(KEY, HASH)->second);
+            ASSERTV(i, -i == Y.find(KEY, HASH)->second);
+
+            bsl::string absent(KEY, &oa);
+            absent += '!';
+
+            const bsl::string& ABSENT      = absent;
+            const bsl::size_t  ABSENT_HASH = X.hash_function()(ABSENT);
+
+            ASSERTV(i, X.end()  == X.find(ABSENT, ABSENT_HASH));
+            ASSERTV(i, mX.end() == mX.find(ABSENT, ABSENT_HASH));
+            ASSERTV(i, 0 == mX.erase(ABSENT, ABSENT_HASH));
+        }
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const bsl::string KEY(DATA[i], &oa);
+            const bsl::size_t HASH = X.hash_function()(KEY);
+
+            ASSERTV(i, 1 == mX.erase(KEY, HASH));
+            ASSERTV(i, 0 == mX.erase(KEY, HASH));
+            ASSERTV(i, X.end() == X.find(KEY));
+            ASSERTV(i, Y.end() != Y.find(KEY));
+
+            ASSERTV(i, static_cast<bsl::size_t>(NUM_DATA - i - 1) == X.size());
+        }
+      } break;
       case 33: {
         // --------------------------------------------------------------------
         // TESTING 'INSERT_OR_ASSIGN'
@@ -2825,7 +3007,7 @@ int main(int argc, char *argv[])
 
                 Obj mX(IDATA, 32);  const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(           1 == X.size());
                 ASSERT(        true == X.contains(1));
                 ASSERT(ExpHash()(0) == X.hash_function()(0));
@@ -2876,7 +3058,7 @@ int main(int argc, char *argv[])
 
                 Obj mX(IDATA, 32, (bslma::Allocator *)0);  const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(           1 == X.size());
                 ASSERT(        true == X.contains(1));
                 ASSERT(ExpHash()(0) == X.hash_function()(0));
@@ -2925,7 +3107,7 @@ int main(int argc, char *argv[])
 
                 Obj mX(IDATA, 32, hasher);  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(    1 == X.size());
                 ASSERT( true == X.contains(1));
                 ASSERT(    7 == X.hash_function()(0));
@@ -2976,7 +3158,7 @@ int main(int argc, char *argv[])
 
                 Obj mX(IDATA, 32, hasher, Equal());  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(    1 == X.size());
                 ASSERT( true == X.contains(1));
                 ASSERT(    7 == X.hash_function()(0));
@@ -3178,7 +3360,7 @@ int main(int argc, char *argv[])
                 Obj        mX(IDATA.begin(), ++IDATA.begin(), 32);
                 const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(           1 == X.size());
                 ASSERT(        true == X.contains(1));
                 ASSERT(ExpHash()(0) == X.hash_function()(0));
@@ -3234,7 +3416,7 @@ int main(int argc, char *argv[])
                               (bslma::Allocator *)0);
                 const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(           1 == X.size());
                 ASSERT(        true == X.contains(1));
                 ASSERT(ExpHash()(0) == X.hash_function()(0));
@@ -3285,7 +3467,7 @@ int main(int argc, char *argv[])
                 Obj        mX(IDATA.begin(), ++IDATA.begin(), 32, hasher);
                 const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(    1 == X.size());
                 ASSERT( true == X.contains(1));
                 ASSERT(    7 == X.hash_function()(0));
@@ -3346,7 +3528,7 @@ int main(int argc, char *argv[])
                               Equal());
                 const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(    1 == X.size());
                 ASSERT( true == X.contains(1));
                 ASSERT(    7 == X.hash_function()(0));
@@ -3422,7 +3604,7 @@ int main(int argc, char *argv[])
 
             mX.rehash(32);
 
-            ASSERT(32 == X.capacity());
+            ASSERT(k_CAPACITY_32 == X.capacity());
 
             mX.rehash(64);
 
@@ -3439,7 +3621,7 @@ int main(int argc, char *argv[])
 
             mX.reserve(28);
 
-            ASSERT(32 == X.capacity());
+            ASSERT(k_CAPACITY_32 == X.capacity());
 
             mX.reserve(56);
 
@@ -5022,7 +5204,7 @@ int main(int argc, char *argv[])
 
                 Obj mX(32, Hash(1), Equal(), &oa);  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(    1 == X.hash_function()(0));
                 ASSERT(false == X.key_eq()(0, 0));
                 ASSERT( true == X.key_eq()(0, 1));
@@ -5250,7 +5432,7 @@ int main(int argc, char *argv[])
 
                 Obj mX(32);  const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(ExpHash()(0) == X.hash_function()(0));
                 ASSERT(ExpHash()(1) == X.hash_function()(1));
                 ASSERT(ExpHash()(7) == X.hash_function()(7));
@@ -5301,7 +5483,7 @@ int main(int argc, char *argv[])
 
                 Obj mX(32, (bslma::Allocator *)0);  const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(ExpHash()(0) == X.hash_function()(0));
                 ASSERT(ExpHash()(1) == X.hash_function()(1));
                 ASSERT(ExpHash()(7) == X.hash_function()(7));
@@ -5350,7 +5532,7 @@ int main(int argc, char *argv[])
 
                 Obj mX(32, hasher);  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(    7 == X.hash_function()(0));
                 ASSERT(    7 == X.hash_function()(1));
                 ASSERT(    7 == X.hash_function()(7));
@@ -5401,7 +5583,7 @@ int main(int argc, char *argv[])
 
                 Obj mX(32, hasher, Equal());  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(    7 == X.hash_function()(0));
                 ASSERT(    7 == X.hash_function()(1));
                 ASSERT(    7 == X.hash_function()(7));
@@ -5543,7 +5725,7 @@ int main(int argc, char *argv[])
             mX.clear();
 
             ASSERT( 0 == X.size());
-            ASSERT(32 == X.capacity());
+            ASSERT(k_CAPACITY_32 == X.capacity());
 
             mX.insert(bsl::make_pair(1, 1));
             mX.insert(bsl::make_pair(2, 2));
@@ -5551,7 +5733,7 @@ int main(int argc, char *argv[])
             mX.clear();
 
             ASSERT( 0 == X.size());
-            ASSERT(32 == X.capacity());
+            ASSERT(k_CAPACITY_32 == X.capacity());
         }
 
         if (verbose) cout << "Testing `reset`." << endl;
@@ -5733,6 +5915,80 @@ int main(int argc, char *argv[])
             cout << "anti-optimization: " << s_antiOptimization << endl;
         }
       } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // LOOKUP THROUGHPUT BENCHMARK
+        //   Report the lookup throughput of `bdlc::FlatHashMap` for the group
+        //   control implementation selected for this build.
+        //
+        // Concerns:
+        // 1. The throughput of `find` for keys present in the map, and for
+        //    keys absent from the map, can be measured at a range of load
+        //    factors and table sizes (and so compared across builds, e.g.,
+        //    with and without `BDLC_FLATHASHTABLE_GROUPCONTROL_ENABLE_AVX2`).
+        //
+        // Plan:
+        // 1. For tables that fit in the cache and tables that do not, and for
+        //    several load factors up to the maximum, time `find` for present
+        //    and absent keys, and report the median time per lookup and the
+        //    corresponding throughput.  (C-1)
+        //
+        // Testing:
+        //   LOOKUP THROUGHPUT BENCHMARK
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LOOKUP THROUGHPUT BENCHMARK" << endl
+                          << "===========================" << endl;
+
+        bslma::NewDeleteAllocator oa;
+
+        bslma::DefaultAllocatorGuard dag(&oa);
+
+        const bsl::size_t CAPACITIES[]   = { 1 << 12, 1 << 22 };
+        const double      LOAD_FACTORS[] = { 0.25, 0.5, 0.75, 0.85 };
+
+        const int NUM_CAPACITIES   = sizeof  CAPACITIES
+                                   / sizeof *CAPACITIES;
+        const int NUM_LOAD_FACTORS = sizeof  LOAD_FACTORS
+                                   / sizeof *LOAD_FACTORS;
+
+        cout << "group size: " << bdlc::FlatHashTable_GroupControl::k_SIZE
+             << endl;
+        cout << setw(10) << "capacity"
+             << setw(6)  << "load"
+             << setw(12) << "hit ns"
+             << setw(12) << "hit M/s"
+             << setw(12) << "miss ns"
+             << setw(12) << "miss M/s" << endl;
+
+        for (int ci = 0; ci < NUM_CAPACITIES; ++ci) {
+            for (int li = 0; li < NUM_LOAD_FACTORS; ++li) {
+                const bsl::size_t CAPACITY = CAPACITIES[ci];
+                const double      LOAD     = LOAD_FACTORS[li];
+
+                const double hit  = performanceFindAtLoad(CAPACITY,
+                                                          LOAD,
+                                                          true,
+                                                          &oa);
+                const double miss = performanceFindAtLoad(CAPACITY,
+                                                          LOAD,
+                                                          false,
+                                                          &oa);
+
+                cout << setw(10) << CAPACITY
+                     << setw(6)  << LOAD
+                     << setw(12) << hit
+                     << setw(12) << 1000.0 / hit
+                     << setw(12) << miss
+                     << setw(12) << 1000.0 / miss << endl;
+            }
+        }
+
+        if (veryVeryVeryVerbose) {
+            cout << "anti-optimization: " << s_antiOptimization << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -928,6 +928,14 @@ class FlatHashMap {
     /// element.
     bsl::size_t erase(const KEY& key);
 
+    /// Remove from this map the element whose key is equal to the specified
+    /// `key`, whose hash value is the specified `hashValue`, if it exists,
+    /// and return 1; otherwise (there is no element having `key` in this
+    /// map), return 0 with no other effect.  This method invalidates all
+    /// iterators and references to the removed element.  The behavior is
+    /// undefined unless `hash_function()(key) == hashValue`.
+    bsl::size_t erase(const KEY& key, bsl::size_t hashValue);
+
 // {{{ BEGIN GENERATED CODE
 // The generated code below is a workaround for the absence of perfect
 // forwarding in some compilers.
@@ -967,6 +975,14 @@ class FlatHashMap {
     /// this map.
     iterator find(const KEY& key);
 
+    /// Return an iterator referring to the modifiable element in this map
+    /// having the specified `key`, whose hash value is the specified
+    /// `hashValue`, or `end()` if no such entry exists in this map.  The
+    /// behavior is undefined unless `hash_function()(key) == hashValue`.
+    /// Note that this method allows a key hashed once to be looked up in
+    /// several maps having the same hasher (see {Precomputed Hash Values}).
+    iterator find(const KEY& key, bsl::size_t hashValue);
+
     /// Return an `iterator` referring to the modifiable element in this map
     /// having the key equivalent to the specified `key`, or `end()` if no such
     /// entry exists in this map.
@@ -1040,6 +1056,21 @@ class FlatHashMap {
                                                            value)).first;
     }
 
+    /// Insert the specified `value`, whose key has the specified
+    /// `hashValue`, into this map if the key of `value` does not already
+    /// exist in this map; otherwise, this method has no effect.  Return a
+    /// `pair` whose `first` member is an iterator referring to the
+    /// (possibly newly inserted) modifiable element in this map whose key
+    /// is equivalent to that of the element to be inserted, and whose
+    /// `second` member is `true` if a new element was inserted, and `false`
+    /// if an element with an equivalent key was already present.  The
+    /// behavior is undefined unless
+    /// `hash_function()(value.first) == hashValue`.
+    bsl::pair<iterator, bool> insert(const value_type& value,
+                                     bsl::size_t       hashValue);
+    bsl::pair<iterator, bool> insert(bslmf::MovableRef<value_type> value,
+                                     bsl::size_t                   hashValue);
+
     /// Insert into this map the value of each element in the input iterator
     /// range specified by `first` through `last` (including `first`,
     /// excluding `last`).  The behavior is undefined unless `first` and
@@ -2695,6 +2726,12 @@ class FlatHashMap {
     /// this map.
     const_iterator find(const KEY& key) const;
 
+    /// Return a `const_iterator` referring to the element in this map
+    /// having the specified `key`, whose hash value is the specified
+    /// `hashValue`, or `end()` if no such entry exists in this map.  The
+    /// behavior is undefined unless `hash_function()(key) == hashValue`.
+    const_iterator find(const KEY& key, bsl::size_t hashValue) const;
+
     /// Return a `const_iterator` referring to the element in this map
     /// having the specified `key`, or `end()` if no such entry exists in
     /// this map.
@@ -2733,6 +2770,12 @@ class FlatHashMap {
     /// the user.
     float max_load_factor() const;
 
+    /// Issue a hint to the processor to fetch into its cache the memory at
+    /// which a search of this map for a key having the specified
+    /// `hashValue` begins.  This method has no observable effect (see
+    /// {Precomputed Hash Values}).
+    void prefetch(bsl::size_t hashValue) const;
+
     /// Return the number of elements in this map.
     bsl::size_t size() const;
 
@@ -4072,6 +4115,15 @@ bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
     return d_impl.erase(key);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(
+                                                         const KEY&  key,
+                                                         bsl::size_t hashValue)
+{
+    return d_impl.erase(key, hashValue);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
@@ -4111,6 +4163,34 @@ FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key)
     return d_impl.find(key);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY&  key,
+                                           bsl::size_t hashValue)
+{
+    return d_impl.find(key, hashValue);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(const value_type& value,
+                                             bsl::size_t       hashValue)
+{
+    return d_impl.insert(value, hashValue);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(
+                                       bslmf::MovableRef<value_type> value,
+                                       bsl::size_t                   hashValue)
+{
+    return d_impl.insert(bslmf::MovableRefUtil::move(value), hashValue);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 template <class INPUT_ITERATOR>
 void FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(INPUT_ITERATOR first,
@@ -5677,6 +5757,15 @@ FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key) const
     return d_impl.find(key);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY&  key,
+                                           bsl::size_t hashValue) const
+{
+    return d_impl.find(key, hashValue);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 HASH FlatHashMap<KEY, VALUE, HASH, EQUAL>::hash_function() const
@@ -5705,6 +5794,14 @@ float FlatHashMap<KEY, VALUE, HASH, EQUAL>::max_load_factor() const
     return d_impl.max_load_factor();
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::prefetch(
+                                                   bsl::size_t hashValue) const
+{
+    d_impl.prefetch(hashValue);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL>
 inline
 bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::size() const
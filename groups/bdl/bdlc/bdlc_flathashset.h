@@ -104,6 +104,18 @@ BSLS_IDENT("$Id: $")
 // element invalidates all pointers, references, and iterators to the erased
 // element.
 //
+///Precomputed Hash Values
+///-----------------------
+// `find`, `insert`, and `erase` each have an overload taking, in addition to
+// the key, the hash value of the key as computed by `hash_function()`.  These
+// overloads do not invoke the hasher, so a key that is looked up in several
+// containers having the same `HASH` type need be hashed only once.
+// `prefetch` takes such a hash value and issues a hint to the processor to
+// fetch the memory at which the lookup of the key will begin, so that the
+// cache misses of a batch of lookups can overlap.  The behavior of these
+// overloads is undefined if the supplied hash value differs from the one that
+// `hash_function()` computes for the key.
+//
 ///Exception Safety
 ///----------------
 // A `bdlc::FlatHashSet` is exception neutral, and all of the methods of
@@ -757,6 +769,14 @@ class FlatHashSet {
     /// element.
     bsl::size_t erase(const KEY& key);
 
+    /// Remove from this set the element whose key is equal to the specified
+    /// `key`, whose hash value is the specified `hashValue`, if it exists,
+    /// and return 1; otherwise (there is no element having `key` in this
+    /// set), return 0 with no other effect.  This method invalidates all
+    /// iterators and references to the removed element.  The behavior is
+    /// undefined unless `hash_function()(key) == hashValue`.
+    bsl::size_t erase(const KEY& key, bsl::size_t hashValue);
+
 #if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
     /// Remove from this set the element whose key is equivalent to the
     /// specified `key`, if it exists, and return 1; otherwise (there is no
@@ -822,6 +842,20 @@ class FlatHashSet {
         return d_impl.insert(BSLS_COMPILERFEATURES_FORWARD(KEY, value));
     }
 
+    /// Insert the specified `value`, having the specified `hashValue`, into
+    /// this set if the `value` does not already exist in this set;
+    /// otherwise, this method has no effect.  Return a `pair` whose `first`
+    /// member is a `const_iterator` referring to the (possibly newly
+    /// inserted) element in this set whose value is equivalent to that of
+    /// the element to be inserted, and whose `second` member is `true` if a
+    /// new element was inserted, and `false` if an equivalent value was
+    /// already present.  The behavior is undefined unless
+    /// `hash_function()(value) == hashValue`.
+    bsl::pair<const_iterator, bool> insert(const KEY&  value,
+                                           bsl::size_t hashValue);
+    bsl::pair<const_iterator, bool> insert(bslmf::MovableRef<KEY> value,
+                                           bsl::size_t            hashValue);
+
 #if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
     /// Insert the specified `key` into this set if a key equivalent to `k`
     /// does not already exist in this set; otherwise, this method has no effect.
@@ -1028,6 +1062,12 @@ class FlatHashSet {
     /// this set.
     const_iterator find(const KEY& key) const;
 
+    /// Return a `const_iterator` referring to the element in this set
+    /// having the specified `key`, whose hash value is the specified
+    /// `hashValue`, or `end()` if no such entry exists in this set.  The
+    /// behavior is undefined unless `hash_function()(key) == hashValue`.
+    const_iterator find(const KEY& key, bsl::size_t hashValue) const;
+
     /// Return a `const_iterator` referring to the element in this set
     /// having the specified `key`, or `end()` if no such entry exists in
     /// this set.
@@ -1066,6 +1106,12 @@ class FlatHashSet {
     /// the user.
     float max_load_factor() const;
 
+    /// Issue a hint to the processor to fetch into its cache the memory at
+    /// which a search of this set for a key having the specified
+    /// `hashValue` begins.  This method has no observable effect (see
+    /// {Precomputed Hash Values}).
+    void prefetch(bsl::size_t hashValue) const;
+
     /// Return the number of elements in this set.
     bsl::size_t size() const;
 
@@ -1475,6 +1521,14 @@ bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::erase(const KEY& key)
     return d_impl.erase(key);
 }
 
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::erase(const KEY&  key,
+                                                 bsl::size_t hashValue)
+{
+    return d_impl.erase(key, hashValue);
+}
+
 template <class KEY, class HASH, class EQUAL>
 inline
 typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
@@ -1493,6 +1547,23 @@ FlatHashSet<KEY, HASH, EQUAL>::erase(const_iterator first, const_iterator last)
     return d_impl.erase(first, last);
 }
 
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator, bool>
+FlatHashSet<KEY, HASH, EQUAL>::insert(const KEY& value, bsl::size_t hashValue)
+{
+    return d_impl.insert(value, hashValue);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator, bool>
+FlatHashSet<KEY, HASH, EQUAL>::insert(bslmf::MovableRef<KEY> value,
+                                      bsl::size_t            hashValue)
+{
+    return d_impl.insert(bslmf::MovableRefUtil::move(value), hashValue);
+}
+
 template <class KEY, class HASH, class EQUAL>
 template <class INPUT_ITERATOR>
 inline
@@ -1589,6 +1660,15 @@ typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
     return d_impl.find(key);
 }
 
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::find(const KEY&  key,
+                                    bsl::size_t hashValue) const
+{
+    return d_impl.find(key, hashValue);
+}
+
 template <class KEY, class HASH, class EQUAL>
 inline
 HASH FlatHashSet<KEY, HASH, EQUAL>::hash_function() const
@@ -1617,6 +1697,13 @@ float FlatHashSet<KEY, HASH, EQUAL>::max_load_factor() const
     return d_impl.max_load_factor();
 }
 
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::prefetch(bsl::size_t hashValue) const
+{
+    d_impl.prefetch(hashValue);
+}
+
 template <class KEY, class HASH, class EQUAL>
 inline
 bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::size() const
@@ -134,9 +134,12 @@ using namespace bsl;
 // #endif
 // [ 2] void clear();
 // [ 2] size_t erase(const KEY&);
+// [30] size_t erase(const KEY&, size_t);
 // [17] const_iterator erase(const_iterator);
 // [18] const_iterator erase(const_iterator, const_iterator);
 // [ 2] bsl::pair<iterator, bool> insert(FORWARD_REF(ENTRY_TYPE) entry)
+// [30] bsl::pair<iterator, bool> insert(const KEY&, size_t);
+// [30] bsl::pair<iterator, bool> insert(MovableRef<KEY>, size_t);
 // [26] iterator insert(const_iterator, FORWARD_REF(ENTRY_TYPE) entry)
 // [16] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
 // #if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
@@ -156,10 +159,12 @@ using namespace bsl;
 // [11] bool empty() const;
 // [12] bsl::pair<ci, ci> equal_range(const KEY&) const;
 // [ 4] const_iterator find(const KEY&) const;
+// [30] const_iterator find(const KEY&, size_t) const;
 // [ 4] HASH hash_function() const;
 // [ 4] EQUAL key_eq() const;
 // [11] float load_factor() const;
 // [ 4] float max_load_factor() const;
+// [30] void prefetch(size_t) const;
 // [ 4] size_t size() const;
 // [12] const_iterator begin() const;
 // [12] const_iterator cbegin() const;
@@ -176,7 +181,7 @@ using namespace bsl;
 // FREE FUNCTIONS
 // [ 8] void swap(FlatHashSet&, FlatHashSet&);
 // ----------------------------------------------------------------------------
-// [30] USAGE EXAMPLE
+// [31] USAGE EXAMPLE
 // [29] CONCERN: `find`        properly handles transparent comparators
 // [29] CONCERN: `count`       properly handles transparent comparators
 // [29] CONCERN: `contains`    properly handles transparent comparators
@@ -249,6 +254,10 @@ void aSsErT(bool condition, const char *message, int line)
 
 const bsl::uint8_t k_SIZE = bdlc::FlatHashTable_GroupControl::k_SIZE;
 
+/// The capacity of a set for which a capacity of 32 is requested, which
+/// exceeds 32 if the minimum capacity (twice the group size) does.
+const bsl::size_t k_CAPACITY_32 = 2 * k_SIZE > 32 ? 2 * k_SIZE : 32;
+
 // ============================================================================
 //                     GLOBAL VARIABLES FOR TESTING
 // ----------------------------------------------------------------------------
@@ -1570,7 +1579,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 30: {
+      case 31: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -1618,6 +1627,106 @@ int main(int argc, char *argv[])
 //  100 84
 // ```
       } break;
+      case 30: {
+        // --------------------------------------------------------------------
+        // PRECOMPUTED HASH VALUES
+        //
+        // Concerns:
+        // 1. The overloads of `find`, `insert`, and `erase` taking a hash
+        //    value forward to the underlying table, and behave as the
+        //    corresponding overloads taking only a key.
+        //
+        // 2. `prefetch` has no observable effect.
+        //
+        // Plan:
+        // 1. For a sequence of `bsl::string` keys, compute the hash value of
+        //    each key, and insert the key into a set using both the `const`
+        //    reference and the movable reference `insert` overloads.  (C-1)
+        //
+        // 2. For each key, and for some absent keys, invoke `prefetch`, and
+        //    verify that the hash-taking `find` and `erase` agree with the
+        //    key-only overloads.  (C-1,2)
+        //
+        // Testing:
+        //   size_t erase(const KEY&, size_t);
+        //   bsl::pair<iterator, bool> insert(const KEY&, size_t);
+        //   bsl::pair<iterator, bool> insert(MovableRef<KEY>, size_t);
+        //   const_iterator find(const KEY&, size_t) const;
+        //   void prefetch(size_t) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRECOMPUTED HASH VALUES" << endl
+                          << "=======================" << endl;
+
+        typedef bdlc::FlatHashSet<bsl::string> Obj;
+
+        static const char *DATA[] = {
+            "", "a", "AB", "abc", "a string long enough to allocate memory",
+            "IBM", "MSFT", "AAPL", "GOOG", "AMZN", "NVDA", "TSLA", "JPM"
+        };
+        enum { NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const bsl::string KEY(DATA[i], &oa);
+            const bsl::size_t HASH = X.hash_function()(KEY);
+
+            X.prefetch(HASH);
+
+            ASSERTV(i, X.end() == X.find(KEY, HASH));
+
+            bsl::pair<Obj::const_iterator, bool> rv;
+            if (i % 2) {
+                rv = mX.insert(KEY, HASH);
+            }
+            else {
+                bsl::string key(KEY, &oa);
+                rv = mX.insert(bslmf::MovableRefUtil::move(key), HASH);
+            }
+            ASSERTV(i, rv.second);
+            ASSERTV(i, KEY == *rv.first);
+
+            rv = mX.insert(KEY, HASH);
+            ASSERTV(i, !rv.second);
+            ASSERTV(i, KEY == *rv.first);
+
+            ASSERTV(i, static_cast<bsl::size_t>(i + 1) == X.size());
+        }
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const bsl::string KEY(DATA[i], &oa);
+            const bsl::size_t HASH = X.hash_function()(KEY);
+
+            X.prefetch(HASH);
+
+            ASSERTV(i, X.find(KEY) == X.find(KEY, HASH));
+            ASSERTV(i, X.end()     != X.find(KEY, HASH));
+
+            bsl::string absent(KEY, &oa);
+            absent += '!';
+
+            const bsl::string& ABSENT      = absent;
+            const bsl::size_t  ABSENT_HASH = X.hash_function()(ABSENT);
+
+            ASSERTV(i, X.end() == X.find(ABSENT, ABSENT_HASH));
+            ASSERTV(i, 0 == mX.erase(ABSENT, ABSENT_HASH));
+        }
+
+        for (int i = 0; i < NUM_DATA; ++i) {
+            const bsl::string KEY(DATA[i], &oa);
+            const bsl::size_t HASH = X.hash_function()(KEY);
+
+            ASSERTV(i, 1 == mX.erase(KEY, HASH));
+            ASSERTV(i, 0 == mX.erase(KEY, HASH));
+            ASSERTV(i, X.end() == X.find(KEY));
+
+            ASSERTV(i, static_cast<bsl::size_t>(NUM_DATA - i - 1) == X.size());
+        }
+      } break;
       case 29: {
         // --------------------------------------------------------------------
         // TESTING TRANSPARENT COMPARATOR
@@ -2283,7 +2392,7 @@ cout << endl
 
                 Obj mX(IDATA, 32);  const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(           1 == X.size());
                 ASSERT(        true == X.contains(1));
                 ASSERT(ExpHash()(0) == X.hash_function()(0));
@@ -2332,7 +2441,7 @@ cout << endl
 
                 Obj mX(IDATA, 32, (bslma::Allocator *)0);  const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(           1 == X.size());
                 ASSERT(        true == X.contains(1));
                 ASSERT(ExpHash()(0) == X.hash_function()(0));
@@ -2379,7 +2488,7 @@ cout << endl
 
                 Obj mX(IDATA, 32, hasher);  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(    1 == X.size());
                 ASSERT( true == X.contains(1));
                 ASSERT(    7 == X.hash_function()(0));
@@ -2428,7 +2537,7 @@ cout << endl
 
                 Obj mX(IDATA, 32, hasher, Equal());  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(    1 == X.size());
                 ASSERT( true == X.contains(1));
                 ASSERT(    7 == X.hash_function()(0));
@@ -2624,7 +2733,7 @@ cout << endl
                 Obj        mX(IDATA.begin(), IDATA.begin() + 1, 32);
                 const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(           1 == X.size());
                 ASSERT(        true == X.contains(1));
                 ASSERT(ExpHash()(0) == X.hash_function()(0));
@@ -2678,7 +2787,7 @@ cout << endl
                               (bslma::Allocator *)0);
                 const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(           1 == X.size());
                 ASSERT(        true == X.contains(1));
                 ASSERT(ExpHash()(0) == X.hash_function()(0));
@@ -2727,7 +2836,7 @@ cout << endl
                 Obj        mX(IDATA.begin(), IDATA.begin() + 1, 32, hasher);
                 const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(    1 == X.size());
                 ASSERT( true == X.contains(1));
                 ASSERT(    7 == X.hash_function()(0));
@@ -2786,7 +2895,7 @@ cout << endl
                               Equal());
                 const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(    1 == X.size());
                 ASSERT( true == X.contains(1));
                 ASSERT(    7 == X.hash_function()(0));
@@ -2862,7 +2971,7 @@ cout << endl
 
             mX.rehash(32);
 
-            ASSERT(32 == X.capacity());
+            ASSERT(k_CAPACITY_32 == X.capacity());
 
             mX.rehash(64);
 
@@ -2879,7 +2988,7 @@ cout << endl
 
             mX.reserve(28);
 
-            ASSERT(32 == X.capacity());
+            ASSERT(k_CAPACITY_32 == X.capacity());
 
             mX.reserve(56);
 
@@ -4205,7 +4314,7 @@ cout << endl
 
                 Obj mX(32, Hash(1), Equal(), &oa);  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(    1 == X.hash_function()(0));
                 ASSERT(false == X.key_eq()(0, 0));
                 ASSERT( true == X.key_eq()(0, 1));
@@ -4425,7 +4534,7 @@ cout << endl
 
                 Obj mX(32);  const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(ExpHash()(0) == X.hash_function()(0));
                 ASSERT(ExpHash()(1) == X.hash_function()(1));
                 ASSERT(ExpHash()(7) == X.hash_function()(7));
@@ -4474,7 +4583,7 @@ cout << endl
 
                 Obj mX(32, (bslma::Allocator *)0);  const Obj& X = mX;
 
-                ASSERT(          32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(ExpHash()(0) == X.hash_function()(0));
                 ASSERT(ExpHash()(1) == X.hash_function()(1));
                 ASSERT(ExpHash()(7) == X.hash_function()(7));
@@ -4521,7 +4630,7 @@ cout << endl
 
                 Obj mX(32, hasher);  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(    7 == X.hash_function()(0));
                 ASSERT(    7 == X.hash_function()(1));
                 ASSERT(    7 == X.hash_function()(7));
@@ -4570,7 +4679,7 @@ cout << endl
 
                 Obj mX(32, hasher, Equal());  const Obj& X = mX;
 
-                ASSERT(   32 == X.capacity());
+                ASSERT(k_CAPACITY_32 == X.capacity());
                 ASSERT(    7 == X.hash_function()(0));
                 ASSERT(    7 == X.hash_function()(1));
                 ASSERT(    7 == X.hash_function()(7));
@@ -4709,7 +4818,7 @@ cout << endl
             mX.clear();
 
             ASSERT( 0 == X.size());
-            ASSERT(32 == X.capacity());
+            ASSERT(k_CAPACITY_32 == X.capacity());
 
             mX.insert(1);
             mX.insert(2);
@@ -4717,7 +4826,7 @@ cout << endl
             mX.clear();
 
             ASSERT( 0 == X.size());
-            ASSERT(32 == X.capacity());
+            ASSERT(k_CAPACITY_32 == X.capacity());
         }
 
         if (verbose) cout << "Testing `reset`." << endl;
@@ -821,6 +821,14 @@ class FlatHashSet {
     /// element.
     bsl::size_t erase(const KEY& key);
 
+    /// Remove from this set the element whose key is equal to the specified
+    /// `key`, whose hash value is the specified `hashValue`, if it exists,
+    /// and return 1; otherwise (there is no element having `key` in this
+    /// set), return 0 with no other effect.  This method invalidates all
+    /// iterators and references to the removed element.  The behavior is
+    /// undefined unless `hash_function()(key) == hashValue`.
+    bsl::size_t erase(const KEY& key, bsl::size_t hashValue);
+
 // {{{ BEGIN GENERATED CODE
 // The generated code below is a workaround for the absence of perfect
 // forwarding in some compilers.
@@ -883,6 +891,20 @@ class FlatHashSet {
         return d_impl.insert(BSLS_COMPILERFEATURES_FORWARD(KEY, value));
     }
 
+    /// Insert the specified `value`, having the specified `hashValue`, into
+    /// this set if the `value` does not already exist in this set;
+    /// otherwise, this method has no effect.  Return a `pair` whose `first`
+    /// member is a `const_iterator` referring to the (possibly newly
+    /// inserted) element in this set whose value is equivalent to that of
+    /// the element to be inserted, and whose `second` member is `true` if a
+    /// new element was inserted, and `false` if an equivalent value was
+    /// already present.  The behavior is undefined unless
+    /// `hash_function()(value) == hashValue`.
+    bsl::pair<const_iterator, bool> insert(const KEY&  value,
+                                           bsl::size_t hashValue);
+    bsl::pair<const_iterator, bool> insert(bslmf::MovableRef<KEY> value,
+                                           bsl::size_t            hashValue);
+
 // {{{ BEGIN GENERATED CODE
 // The generated code below is a workaround for the absence of perfect
 // forwarding in some compilers.
@@ -1084,6 +1106,12 @@ class FlatHashSet {
     /// this set.
     const_iterator find(const KEY& key) const;
 
+    /// Return a `const_iterator` referring to the element in this set
+    /// having the specified `key`, whose hash value is the specified
+    /// `hashValue`, or `end()` if no such entry exists in this set.  The
+    /// behavior is undefined unless `hash_function()(key) == hashValue`.
+    const_iterator find(const KEY& key, bsl::size_t hashValue) const;
+
     /// Return a `const_iterator` referring to the element in this set
     /// having the specified `key`, or `end()` if no such entry exists in
     /// this set.
@@ -1122,6 +1150,12 @@ class FlatHashSet {
     /// the user.
     float max_load_factor() const;
 
+    /// Issue a hint to the processor to fetch into its cache the memory at
+    /// which a search of this set for a key having the specified
+    /// `hashValue` begins.  This method has no observable effect (see
+    /// {Precomputed Hash Values}).
+    void prefetch(bsl::size_t hashValue) const;
+
     /// Return the number of elements in this set.
     bsl::size_t size() const;
 
@@ -2406,6 +2440,14 @@ bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::erase(const KEY& key)
     return d_impl.erase(key);
 }
 
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::erase(const KEY&  key,
+                                                 bsl::size_t hashValue)
+{
+    return d_impl.erase(key, hashValue);
+}
+
 template <class KEY, class HASH, class EQUAL>
 inline
 typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
@@ -2424,6 +2466,23 @@ FlatHashSet<KEY, HASH, EQUAL>::erase(const_iterator first, const_iterator last)
     return d_impl.erase(first, last);
 }
 
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator, bool>
+FlatHashSet<KEY, HASH, EQUAL>::insert(const KEY& value, bsl::size_t hashValue)
+{
+    return d_impl.insert(value, hashValue);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator, bool>
+FlatHashSet<KEY, HASH, EQUAL>::insert(bslmf::MovableRef<KEY> value,
+                                      bsl::size_t            hashValue)
+{
+    return d_impl.insert(bslmf::MovableRefUtil::move(value), hashValue);
+}
+
 template <class KEY, class HASH, class EQUAL>
 template <class INPUT_ITERATOR>
 inline
@@ -2520,6 +2579,15 @@ typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
     return d_impl.find(key);
 }
 
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::find(const KEY&  key,
+                                    bsl::size_t hashValue) const
+{
+    return d_impl.find(key, hashValue);
+}
+
 template <class KEY, class HASH, class EQUAL>
 inline
 HASH FlatHashSet<KEY, HASH, EQUAL>::hash_function() const
@@ -2548,6 +2616,13 @@ float FlatHashSet<KEY, HASH, EQUAL>::max_load_factor() const
     return d_impl.max_load_factor();
 }
 
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::prefetch(bsl::size_t hashValue) const
+{
+    d_impl.prefetch(hashValue);
+}
+
 template <class KEY, class HASH, class EQUAL>
 inline
 bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::size() const
@@ -122,11 +122,15 @@ using namespace bsl;
 // [22] emplace(ARGS&&...);
 // [12] bsl::pair<iterator, iterator> equal_range(const KEY&);
 // [ 2] size_t erase(const KEY&);
+// [24] size_t erase(const KEY&, size_t);
 // [17] iterator erase(const_iterator);
 // [17] iterator erase(iterator);
 // [18] iterator erase(const_iterator, const_iterator);
 // [12] iterator find(const KEY&);
+// [24] iterator find(const KEY&, size_t);
 // [ 2] bsl::pair<iterator, bool> insert(FORWARD_REF(ENTRY_TYPE) entry)
+// [24] bsl::pair<iterator, bool> insert(const ENTRY&, size_t);
+// [24] bsl::pair<iterator, bool> insert(MovableRef<ENTRY>, size_t);
 // [16] void insert(INPUT_IT, INPUT_IT);
 // [19] void rehash(size_t);
 // [19] void reserve(size_t);
@@ -148,10 +152,12 @@ using namespace bsl;
 // [ 4] const ENTRY *entries() const;
 // [12] bsl::pair<ci, ci> equal_range(const KEY&) const;
 // [12] const_iterator find(const KEY&) const;
+// [24] const_iterator find(const KEY&, size_t) const;
 // [ 4] HASH hash_function() const;
 // [ 4] EQUAL key_eq() const;
 // [11] float load_factor() const;
 // [ 4] float max_load_factor() const;
+// [24] void prefetch(size_t) const;
 // [ 4] size_t size() const;
 //
 // [12] const_iterator begin() const;
@@ -182,6 +188,7 @@ using namespace bsl;
 // [23] CONCERN: `erase`             handles transparent comparators
 // [23] CONCERN: `insertTransparent` handles transparent comparators (set)
 // [23] CONCERN: `try_emplace`       handles transparent comparators (map)
+// [24] CONCERN: hash-taking overloads do not invoke the hasher
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -410,6 +417,41 @@ class IntValueIsHash {
     }
 };
 
+                          // =====================
+                          // class CountingIntHash
+                          // =====================
+
+/// This class provides a hash algorithm that returns the value of its
+/// (non-negative) key, and counts the number of hash values it computes,
+/// useful for testing the methods of a flat hash table that take a
+/// precomputed hash value.
+class CountingIntHash {
+
+    // CLASS DATA
+    static int s_numCalls;  // number of hash values computed
+
+  public:
+    // CLASS METHODS
+
+    /// Return the number of hash values computed by all objects of this
+    /// class.
+    static int numCalls()
+    {
+        return s_numCalls;
+    }
+
+    // ACCESSORS
+
+    /// Return the specified `key` converted to `bsl::size_t`.
+    bsl::size_t operator()(const int key) const
+    {
+        ++s_numCalls;
+        return static_cast<bsl::size_t>(key);
+    }
+};
+
+int CountingIntHash::s_numCalls = 0;
+
                              // ================
                              // class SeedIsHash
                              // ================
@@ -3542,6 +3584,16 @@ int main(int argc, char *argv[])
 
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
+    if (16 < k_SIZE) {
+        // The specification-based white-box tests of this driver describe
+        // the control bytes of groups of 8 or 16 entries only.  The wider
+        // (opt-in) group layouts are exercised by the 'bdlc_flathashmap'
+        // and 'bdlc_flathashset' test drivers.
+
+        cout << "Skipped: unsupported group size " << int(k_SIZE) << endl;
+        return 0;                                                     // RETURN
+    }
+
     // CONCERN: In no case does memory come from the global allocator.
 
     bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
@@ -3551,6 +3603,175 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 24: {
+        // --------------------------------------------------------------------
+        // PRECOMPUTED HASH VALUES
+        //
+        // Concerns:
+        // 1. The overloads of `find`, `insert`, and `erase` taking a hash
+        //    value behave as the corresponding overloads taking only a key
+        //    (or entry), when supplied the hash value of the key.
+        //
+        // 2. These overloads do not invoke the hasher.
+        //
+        // 3. `prefetch` has no observable effect, including on a table in the
+        //    zero-capacity state.
+        //
+        // 4. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Using a hasher that counts its invocations, insert a sequence of
+        //    keys into a table having sufficient capacity, using the
+        //    hash-taking `insert` overloads, and verify the return values and
+        //    the state of the table with the key-only `find`.  (C-1)
+        //
+        // 2. For each key, and for some absent keys, invoke `prefetch`, the
+        //    hash-taking `find` (both `const` and non-`const`), and then the
+        //    hash-taking `erase`, verifying the results against the key-only
+        //    overloads.  (C-1,3)
+        //
+        // 3. When safe assertions are disabled, verify that the hasher is not
+        //    invoked by the operations of P-1 and P-2.  (C-2)
+        //
+        // 4. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for a hash value that is not that of the key.  (C-4)
+        //
+        // Testing:
+        //   iterator find(const KEY&, size_t);
+        //   bsl::pair<iterator, bool> insert(const ENTRY&, size_t);
+        //   bsl::pair<iterator, bool> insert(MovableRef<ENTRY>, size_t);
+        //   size_t erase(const KEY&, size_t);
+        //   const_iterator find(const KEY&, size_t) const;
+        //   void prefetch(size_t) const;
+        //   CONCERN: hash-taking overloads do not invoke the hasher
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRECOMPUTED HASH VALUES" << endl
+                          << "=======================" << endl;
+
+        typedef bdlc::FlatHashTable<int,
+                                    int,
+                                    TestEntryUtil<int>,
+                                    CountingIntHash,
+                                    bsl::equal_to<int> > Obj;
+
+        const int NUM_KEYS = 100;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX(0, CountingIntHash(), bsl::equal_to<int>(), &oa);
+            const Obj& X = mX;
+
+            X.prefetch(0);
+            X.prefetch(~bsl::size_t(0));
+
+            ASSERT(X.end() == X.find(0, 0));
+            ASSERT(0       == mX.erase(0, 0));
+            ASSERT(0       == X.size());
+        }
+
+        Obj mX(0, CountingIntHash(), bsl::equal_to<int>(), &oa);
+        const Obj& X = mX;
+
+        mX.reserve(NUM_KEYS);
+
+        // In SAFE builds, the methods taking a hash value invoke the hasher
+        // only to check that the hash value matches the key: `insert` checks
+        // twice (once before, and once while, searching for the key), and
+        // `find` checks once.  Otherwise, the hasher is not invoked at all.
+
+#ifdef BSLS_ASSERT_SAFE_IS_ACTIVE
+        const int NUM_INSERT_CALLS = 2;
+        const int NUM_FIND_CALLS   = 1;
+#else
+        const int NUM_INSERT_CALLS = 0;
+        const int NUM_FIND_CALLS   = 0;
+#endif
+
+        const bsl::size_t CAPACITY  = X.capacity();
+        const int         NUM_CALLS = CountingIntHash::numCalls();
+
+        int numExpectedCalls = NUM_CALLS;
+
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            const int         KEY  = 2 * i;
+            const bsl::size_t HASH = static_cast<bsl::size_t>(KEY);
+
+            bsl::pair<Obj::iterator, bool> rv;
+
+            if (i % 2) {
+                rv = mX.insert(KEY, HASH);
+            }
+            else {
+                int value = KEY;
+                rv = mX.insert(bslmf::MovableRefUtil::move(value), HASH);
+            }
+            ASSERTV(i, rv.second);
+            ASSERTV(i, KEY == *rv.first);
+
+            rv = mX.insert(KEY, HASH);
+            numExpectedCalls += 2 * NUM_INSERT_CALLS;
+            ASSERTV(i, !rv.second);
+            ASSERTV(i, KEY == *rv.first);
+
+            ASSERTV(i, static_cast<bsl::size_t>(i + 1) == X.size());
+        }
+
+        ASSERT(CAPACITY == X.capacity());
+
+        for (int key = -1; key < 2 * NUM_KEYS + 1; ++key) {
+            const bsl::size_t HASH = static_cast<bsl::size_t>(key);
+
+            X.prefetch(HASH);
+
+            Obj::const_iterator cit = X.find(key, HASH);
+            Obj::iterator        it = mX.find(key, HASH);
+            numExpectedCalls += 2 * NUM_FIND_CALLS;
+
+            if (0 <= key && key < 2 * NUM_KEYS && 0 == key % 2) {
+                ASSERTV(key, X.end() != cit && key == *cit);
+                ASSERTV(key, mX.end() != it && key == *it);
+            }
+            else {
+                ASSERTV(key, X.end()  == cit);
+                ASSERTV(key, mX.end() == it);
+            }
+        }
+
+        ASSERTV(NUM_CALLS, numExpectedCalls, CountingIntHash::numCalls(),
+                numExpectedCalls == CountingIntHash::numCalls());
+
+        for (int key = -1; key < 2 * NUM_KEYS + 1; ++key) {
+            const bsl::size_t HASH     = static_cast<bsl::size_t>(key);
+            const bsl::size_t EXPECTED = X.count(key);
+            const bsl::size_t SIZE     = X.size();
+
+            ASSERTV(key, EXPECTED == mX.erase(key, HASH));
+            ASSERTV(key, 0        == mX.erase(key, HASH));
+            ASSERTV(key, SIZE - EXPECTED == X.size());
+            ASSERTV(key, X.end() == X.find(key));
+        }
+        ASSERT(0 == X.size());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const bsl::size_t GOOD = 1;
+            const bsl::size_t BAD  = 2;
+
+            ASSERT_SAFE_PASS(X.find(1, GOOD));
+            ASSERT_SAFE_FAIL(X.find(1, BAD));
+            ASSERT_SAFE_PASS(mX.find(1, GOOD));
+            ASSERT_SAFE_FAIL(mX.find(1, BAD));
+            ASSERT_SAFE_FAIL(mX.erase(1, BAD));
+            ASSERT_SAFE_FAIL(mX.insert(1, BAD));
+            ASSERT_SAFE_PASS(mX.insert(1, GOOD));
+            ASSERT_SAFE_PASS(mX.erase(1, GOOD));
+        }
+      } break;
       case 23: {
         // --------------------------------------------------------------------
         // TESTING TRANSPARENT OPERATIONS
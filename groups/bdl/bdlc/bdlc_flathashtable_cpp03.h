@@ -607,6 +607,14 @@ class FlatHashTable
     /// invalidates all iterators, and references to the removed element.
     bsl::size_t erase(const KEY& key);
 
+    /// Remove from this table the object having the specified `key`, whose
+    /// hash value is the specified `hashValue`, if it exists, and return 1;
+    /// otherwise (there is no object with a key equal to `key` in this
+    /// table) return 0 with no other effect.  This method invalidates all
+    /// iterators, and references to the removed element.  The behavior is
+    /// undefined unless `hash_function()(key) == hashValue`.
+    bsl::size_t erase(const KEY& key, bsl::size_t hashValue);
+
 // {{{ BEGIN GENERATED CODE
 // The generated code below is a workaround for the absence of perfect
 // forwarding in some compilers.
@@ -650,6 +658,15 @@ class FlatHashTable
     /// entry exists, and `end()` otherwise.
     iterator find(const KEY& key);
 
+    /// Return an iterator providing modifiable access to the object in this
+    /// flat hash table with a key equal to the specified `key`, whose hash
+    /// value is the specified `hashValue`, if such an entry exists, and
+    /// `end()` otherwise.  The behavior is undefined unless
+    /// `hash_function()(key) == hashValue`.  Note that this method allows a
+    /// key hashed once to be looked up in several tables having the same
+    /// hasher.
+    iterator find(const KEY& key, bsl::size_t hashValue);
+
     /// Return an iterator providing modifiable access to the object in this
     /// flat hash table with a key equivalent to the specified `key`, if such
     /// an entry exists, and `end()` otherwise.
@@ -684,6 +701,21 @@ class FlatHashTable
     bsl::pair<iterator, bool> insert(const ENTRY &entry);
     bsl::pair<iterator, bool> insert(bslmf::MovableRef<ENTRY> entry);
 
+    /// Insert the specified `entry`, whose key has the specified
+    /// `hashValue`, into this table if the key of the `entry` does not
+    /// already exist in this table; otherwise, this method has no effect.
+    /// Return a `pair` whose `first` member is an iterator referring to the
+    /// (possibly newly inserted) object in this table whose key is equal to
+    /// that of the object to be inserted, and whose `second` member is
+    /// `true` if a new entry was inserted, and `false` if an entry having an
+    /// equal key was already present.  The behavior is undefined unless
+    /// `hash_function()(key) == hashValue`, where `key` is the key of
+    /// `entry`.
+    bsl::pair<iterator, bool> insert(const ENTRY& entry,
+                                     bsl::size_t  hashValue);
+    bsl::pair<iterator, bool> insert(bslmf::MovableRef<ENTRY> entry,
+                                     bsl::size_t              hashValue);
+
 // {{{ BEGIN GENERATED CODE
 // The generated code below is a workaround for the absence of perfect
 // forwarding in some compilers.
@@ -1688,6 +1720,13 @@ class FlatHashTable
     /// entry exists in this table.
     const_iterator find(const KEY& key) const;
 
+    /// Return an iterator representing the position of the entry in this
+    /// flat hash table having the specified `key`, whose hash value is the
+    /// specified `hashValue`, or `end()` if no such entry exists in this
+    /// table.  The behavior is undefined unless
+    /// `hash_function()(key) == hashValue`.
+    const_iterator find(const KEY& key, bsl::size_t hashValue) const;
+
     /// Return an iterator representing the position of the entry in this
     /// flat hash table that is equivalent to the specified `key`, or `end()`
     //  if no such entry exists in this table.
@@ -1731,6 +1770,15 @@ class FlatHashTable
     /// implementation dependent and cannot be changed by the user.
     float max_load_factor() const;
 
+    /// Issue a hint to the processor to fetch into its cache the control
+    /// values and entries of the group of positions in this table at which
+    /// a search for a key having the specified `hashValue` begins.  This
+    /// method has no observable effect.  Note that issuing `prefetch` for a
+    /// batch of keys before looking each of them up (using the overloads of
+    /// `find`, `insert`, and `erase` taking a hash value) allows the memory
+    /// accesses of the lookups to overlap.
+    void prefetch(bsl::size_t hashValue) const;
+
     /// Return the number of entries in this table.
     bsl::size_t size() const;
 
@@ -2981,11 +3029,26 @@ inline
 bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
                                                                 const KEY& key)
 {
-    iterator it = find(key);
-    if (it == end()) {
+    return erase(key, d_hasher(key));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                         const KEY&  key,
+                                                         bsl::size_t hashValue)
+{
+    bsl::size_t index = findKey(key, hashValue);
+    if (index == d_capacity) {
         return 0;                                                     // RETURN
     }
-    erase(it);
+
+    // Unlike 'erase(const_iterator)', there is no need to search for the
+    // following element.
+
+    bslma::DestructionUtil::destroy(d_entries_p + index);
+    d_controls_p[index] = GroupControl::k_ERASED;
+    --d_size;
+
     return 1;
 }
 
@@ -3089,7 +3152,17 @@ inline
 typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
 FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key)
 {
-    bsl::size_t index = findKey(key, d_hasher(key));
+    return find(key, d_hasher(key));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(
+                                                         const KEY&  key,
+                                                         bsl::size_t hashValue)
+{
+    bsl::size_t index = findKey(key, hashValue);
     if (index < d_capacity) {
         return iterator(IteratorImp(d_entries_p  + index,
                                     d_controls_p + index,
@@ -3102,9 +3175,18 @@ template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
 inline
 bsl::pair<typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator, bool>
 FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(const ENTRY& entry)
+{
+    return insert(entry, d_hasher(ENTRY_UTIL::key(entry)));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator, bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(
+                                                     const ENTRY& entry,
+                                                     bsl::size_t  hashValue)
 {
     bool        notFound;
-    bsl::size_t hashValue = d_hasher(ENTRY_UTIL::key(entry));
     bsl::size_t index     = indexOfKey(&notFound,
                                        ENTRY_UTIL::key(entry),
                                        hashValue);
@@ -3127,9 +3209,20 @@ inline
 bsl::pair<typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator, bool>
 FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(
                                                 bslmf::MovableRef<ENTRY> entry)
+{
+    ENTRY&      lvalue    = entry;
+    bsl::size_t hashValue = d_hasher(ENTRY_UTIL::key(lvalue));
+    return insert(bslmf::MovableRefUtil::move(lvalue), hashValue);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator, bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(
+                                            bslmf::MovableRef<ENTRY> entry,
+                                            bsl::size_t              hashValue)
 {
     bool        notFound;
-    bsl::size_t hashValue = d_hasher(ENTRY_UTIL::key(entry));
     bsl::size_t index     = indexOfKey(&notFound,
                                        ENTRY_UTIL::key(entry),
                                        hashValue);
@@ -4370,7 +4463,17 @@ inline
 typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
 FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key) const
 {
-    bsl::size_t index = findKey(key, d_hasher(key));
+    return find(key, d_hasher(key));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(
+                                                   const KEY&  key,
+                                                   bsl::size_t hashValue) const
+{
+    bsl::size_t index = findKey(key, hashValue);
     if (index < d_capacity) {
         return const_iterator(IteratorImp(d_entries_p  + index,
                                           d_controls_p + index,
@@ -4418,6 +4521,20 @@ float bdlc::FlatHashTable<KEY,
          / static_cast<float>(k_MAX_LOAD_FACTOR_DENOMINATOR);
 }
 
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::prefetch(
+                                                   bsl::size_t hashValue) const
+{
+    if (d_capacity) {
+        bsl::size_t index = (hashValue >> d_groupControlShift)
+                                                        * GroupControl::k_SIZE;
+
+        bsls::PerformanceHint::prefetchForReading(d_controls_p + index);
+        bsls::PerformanceHint::prefetchForReading(d_entries_p  + index);
+    }
+}
+
 template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
 inline
 bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::size() const
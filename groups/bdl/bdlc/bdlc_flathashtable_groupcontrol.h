@@ -15,6 +15,31 @@ BSLS_IDENT("$Id: $")
 // of flat hash table control values.  Note that the number of entries in a
 // group control and the inquiry performance is platform dependant.
 //
+///Platform-Specific Implementations
+///---------------------------------
+// The group size, `k_SIZE`, and the instructions used to answer inquiries are
+// selected at compile time:
+//
+// * If `BDLC_FLATHASHTABLE_GROUPCONTROL_ENABLE_AVX2` is defined and the target
+//   supports AVX2, a group has 32 entries, compared with a single 256-bit
+//   instruction.
+// * Otherwise, on SSE2 targets, a group has 16 entries, compared with 128-bit
+//   SSE2 instructions.
+// * Otherwise, if `BDLC_FLATHASHTABLE_GROUPCONTROL_ENABLE_NEON` is defined
+//   and the target is a little-endian 64-bit ARM supporting NEON, a group has
+//   16 entries, compared with 128-bit NEON instructions (the per-byte
+//   comparison result is reduced to a bit mask with two multiplications).
+// * Otherwise, a group has 8 entries, and inquiries are answered with
+//   arithmetic on a 64-bit integer.
+//
+// The wider AVX2 group halves the number of group inquiries needed to probe
+// long collision chains (e.g., in tables near their maximum load factor, or
+// for lookups of absent keys), at the cost of a larger minimum table capacity.
+// Since `k_SIZE` determines the layout of a flat hash table, the AVX2 group
+// must be enabled (or not) consistently for every translation unit of a
+// program.  The same holds for the NEON group, which is not enabled by
+// default because it has not yet been built and tested on ARM hardware.
+//
 // The flat hash map/set/table data structures are inspired by Google's
 // flat_hash_map CppCon presentations (available on youtube).  The
 // implementations draw from Google's open source `raw_hash_set.h` file at:
@@ -35,9 +60,19 @@ BSLS_IDENT("$Id: $")
 #include <bsl_cstdint.h>
 #include <bsl_cstring.h>
 
-#if defined(BSLS_PLATFORM_CPU_SSE2)
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_ENABLE_AVX2)                      \
+ && defined(BSLS_PLATFORM_CPU_AVX2)
+#define BDLC_FLATHASHTABLE_GROUPCONTROL_AVX2 1
+#include <immintrin.h>
+#elif defined(BSLS_PLATFORM_CPU_SSE2)
+#define BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2 1
 #include <immintrin.h>
 #include <emmintrin.h>
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_ENABLE_NEON)                    \
+   && defined(BSLS_PLATFORM_CPU_ARM) && defined(BSLS_PLATFORM_CPU_64_BIT)     \
+   && defined(BSLS_PLATFORM_IS_LITTLE_ENDIAN) && defined(__ARM_NEON)
+#define BDLC_FLATHASHTABLE_GROUPCONTROL_NEON 1
+#include <arm_neon.h>
 #endif
 
 namespace BloombergLP {
@@ -53,8 +88,12 @@ class FlatHashTable_GroupControl
 {
   public:
     // TYPES
-#if defined(BSLS_PLATFORM_CPU_SSE2)
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_AVX2)
+    typedef __m256i       Storage;
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2)
     typedef __m128i       Storage;
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_NEON)
+    typedef uint8x16_t    Storage;
 #else
     typedef bsl::uint64_t Storage;
 #endif
@@ -69,6 +108,13 @@ class FlatHashTable_GroupControl
     // DATA
     Storage d_value;  // efficiently cached value for inquiries
 
+    // PRIVATE CLASS METHODS
+
+    /// Return a bit mask of the bytes of the specified `value` whose most
+    /// significant bit is set.  The bit at index `i` of the result
+    /// corresponds to the byte at index `i` of the (little-endian) `value`.
+    static bsl::uint32_t deflate(bsl::uint64_t value);
+
     // PRIVATE ACCESSORS
 
     /// Return a bit mask of the `k_SIZE` entries that have the specified
@@ -126,14 +172,32 @@ class FlatHashTable_GroupControl
                      // class FlatHashTable_GroupControl
                      // --------------------------------
 
+// PRIVATE CLASS METHODS
+inline
+bsl::uint32_t FlatHashTable_GroupControl::deflate(bsl::uint64_t value)
+{
+    return static_cast<bsl::uint32_t>(
+                        ((value & k_MSB_MASK) * k_DEFLATE) >> k_DEFLATE_SHIFT);
+}
+
 // PRIVATE ACCESSORS
 inline
 bsl::uint32_t FlatHashTable_GroupControl::matchRaw(bsl::uint8_t value) const
 {
-#if defined(BSLS_PLATFORM_CPU_SSE2)
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_AVX2)
+    return static_cast<bsl::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+                                    _mm256_set1_epi8(static_cast<char>(value)),
+                                    d_value)));
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2)
     return _mm_movemask_epi8(_mm_cmpeq_epi8(
                                        _mm_set1_epi8(static_cast<char>(value)),
                                        d_value));
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_NEON)
+    const uint64x2_t t = vreinterpretq_u64_u8(vceqq_u8(vdupq_n_u8(value),
+                                                       d_value));
+
+    return deflate(vgetq_lane_u64(t, 0))
+         | (deflate(vgetq_lane_u64(t, 1)) << 8);
 #else
     Storage t = d_value ^ (k_MULT * value);
 
@@ -141,8 +205,7 @@ bsl::uint32_t FlatHashTable_GroupControl::matchRaw(bsl::uint8_t value) const
     t = t | (t << 2);
     t = t | (t << 1);
 
-    return static_cast<bsl::uint32_t>(
-                         (((~t) & k_MSB_MASK) * k_DEFLATE) >> k_DEFLATE_SHIFT);
+    return deflate(~t);
 #endif
 }
 
@@ -151,9 +214,14 @@ inline
 FlatHashTable_GroupControl::FlatHashTable_GroupControl(
                                                       const bsl::uint8_t *data)
 {
-#if defined(BSLS_PLATFORM_CPU_SSE2)
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_AVX2)
+    d_value = _mm256_loadu_si256(static_cast<const Storage *>(
+                                             static_cast<const void *>(data)));
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2)
     d_value = _mm_loadu_si128(static_cast<const Storage *>(
                                              static_cast<const void *>(data)));
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_NEON)
+    d_value = vld1q_u8(data);
 #else
     bsl::memcpy(&d_value, data, k_SIZE);
     d_value = BSLS_BYTEORDER_HOST_U64_TO_LE(d_value);
@@ -164,18 +232,27 @@ FlatHashTable_GroupControl::FlatHashTable_GroupControl(
 inline
 bsl::uint32_t FlatHashTable_GroupControl::available() const
 {
-#if defined(BSLS_PLATFORM_CPU_SSE2)
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_AVX2)
+    return static_cast<bsl::uint32_t>(_mm256_movemask_epi8(d_value));
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2)
     return _mm_movemask_epi8(d_value);
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_NEON)
+    const uint64x2_t t = vreinterpretq_u64_u8(d_value);
+
+    return deflate(vgetq_lane_u64(t, 0))
+         | (deflate(vgetq_lane_u64(t, 1)) << 8);
 #else
-    return static_cast<bsl::uint32_t>(
-                      ((d_value & k_MSB_MASK) * k_DEFLATE) >> k_DEFLATE_SHIFT);
+    return deflate(d_value);
 #endif
 }
 
 inline
 bsl::uint32_t FlatHashTable_GroupControl::inUse() const
 {
-#if defined(BSLS_PLATFORM_CPU_SSE2)
+#if defined(BDLC_FLATHASHTABLE_GROUPCONTROL_AVX2)
+    return ~available();
+#elif defined(BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2)                           \
+   || defined(BDLC_FLATHASHTABLE_GROUPCONTROL_NEON)
     return (~available()) & 0xFFFF;
 #else
     return (~available()) & 0xFF;
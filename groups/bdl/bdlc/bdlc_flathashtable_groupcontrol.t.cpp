@@ -117,6 +117,8 @@ const bsl::uint8_t VC = 0x01;
 const bsl::uint8_t VD = 0x10;
 const bsl::uint8_t VE = 0x11;
 
+const bsl::size_t k_MAX_SIZE = 32;  // largest group size on any platform
+
 // ============================================================================
 //                    GLOBAL HELPER FUNCTIONS FOR TESTING
 // ----------------------------------------------------------------------------
@@ -271,13 +273,14 @@ int main(int argc, char *argv[])
         if (verbose) cout << "\nTesting accessors." << endl;
 
         {
-            bsl::uint8_t BACKGROUND[][16] =
-                       {
-                           { EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE },
-                           { XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX },
-                       };
-            const bsl::size_t NUM_BACKGROUND
-                                      = sizeof BACKGROUND / sizeof *BACKGROUND;
+            const bsl::uint8_t BACKGROUND_VALUE[] = { EE, XX };
+            const bsl::size_t  NUM_BACKGROUND     = sizeof  BACKGROUND_VALUE
+                                                  / sizeof *BACKGROUND_VALUE;
+
+            bsl::uint8_t BACKGROUND[NUM_BACKGROUND][k_MAX_SIZE];
+            for (bsl::size_t bi = 0; bi < NUM_BACKGROUND; ++bi) {
+                bsl::memset(BACKGROUND[bi], BACKGROUND_VALUE[bi], k_MAX_SIZE);
+            }
 
             bsl::uint8_t VALUE[] = { VA, VB, VC, VD, VE, EE, XX };
             const bsl::size_t NUM_VALUE = sizeof VALUE / sizeof *VALUE;
@@ -289,8 +292,8 @@ int main(int argc, char *argv[])
             }
             { // depth 1
                 for (bsl::size_t bi = 0; bi < NUM_BACKGROUND; ++bi) {
-                    bsl::uint8_t data[16];
-                    bsl::memcpy(data, BACKGROUND[bi], 16);
+                    bsl::uint8_t data[k_MAX_SIZE];
+                    bsl::memcpy(data, BACKGROUND[bi], k_MAX_SIZE);
 
                     for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
                         for (bsl::size_t ii = 0; ii < NUM_VALUE; ++ii) {
@@ -303,8 +306,8 @@ int main(int argc, char *argv[])
             }
             { // depth 2
                 for (bsl::size_t bi = 0; bi < NUM_BACKGROUND; ++bi) {
-                    bsl::uint8_t data[16];
-                    bsl::memcpy(data, BACKGROUND[bi], 16);
+                    bsl::uint8_t data[k_MAX_SIZE];
+                    bsl::memcpy(data, BACKGROUND[bi], k_MAX_SIZE);
             //------^
             for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
                 for (bsl::size_t ii = 0; ii < NUM_VALUE; ++ii) {
@@ -324,8 +327,8 @@ int main(int argc, char *argv[])
             }
             { // depth 3
                 for (bsl::size_t bi = 0; bi < NUM_BACKGROUND; ++bi) {
-                    bsl::uint8_t data[16];
-                    bsl::memcpy(data, BACKGROUND[bi], 16);
+                    bsl::uint8_t data[k_MAX_SIZE];
+                    bsl::memcpy(data, BACKGROUND[bi], k_MAX_SIZE);
         //----------^
         for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
             for (bsl::size_t ii = 0; ii < NUM_VALUE; ++ii) {
@@ -351,8 +354,8 @@ int main(int argc, char *argv[])
             }
             { // depth 4
                 for (bsl::size_t bi = 0; bi < NUM_BACKGROUND; ++bi) {
-                    bsl::uint8_t data[16];
-                    bsl::memcpy(data, BACKGROUND[bi], 16);
+                    bsl::uint8_t data[k_MAX_SIZE];
+                    bsl::memcpy(data, BACKGROUND[bi], k_MAX_SIZE);
 //------------------^
 for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
     for (bsl::size_t ii = 0; ii < NUM_VALUE; ++ii) {
@@ -388,8 +391,9 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
         {
             bsls::AssertTestHandlerGuard hG;
 
-            bsl::uint8_t data[16] =
-                           { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
+            bsl::uint8_t data[k_MAX_SIZE] =
+                           { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,
+                             EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
 
             Obj mX(data);  const Obj& X = mX;
 
@@ -426,8 +430,9 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
                           << "========" << endl;
 
         {
-            bsl::uint8_t data[16] =
-                           { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
+            bsl::uint8_t data[k_MAX_SIZE] =
+                           { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,
+                             EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
 
             Obj mX(data);  const Obj& X = mX;
 
@@ -440,8 +445,9 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
             ASSERT(true == X.neverFull());
         }
         {
-            bsl::uint8_t data[16] =
-                           { VA,VB,VC,VD,VE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
+            bsl::uint8_t data[k_MAX_SIZE] =
+                           { VA,VB,VC,VD,VE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,
+                             EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
 
             Obj mX(data);  const Obj& X = mX;
 
@@ -454,8 +460,9 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
             ASSERT(true == X.neverFull());
         }
         {
-            bsl::uint8_t data[16] =
-                           { XX,VA,XX,VB,VA,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX };
+            bsl::uint8_t data[k_MAX_SIZE] =
+                           { XX,VA,XX,VB,VA,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,
+                             XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX };
 
             Obj mX(data);  const Obj& X = mX;
 
@@ -488,8 +495,9 @@ for (bsl::size_t i = 0; i < Obj::k_SIZE; ++i) {
                           << "BREATHING TEST" << endl
                           << "==============" << endl;
 
-        bsl::uint8_t data[16] =
-                           { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
+        bsl::uint8_t data[k_MAX_SIZE] =
+                           { XX,VA,XX,VB,VA,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,
+                             EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE,EE };
 
         Obj mX(data);  const Obj& X = mX;
 
@@ -0,0 +1,1743 @@
+// bdlc_nodehashmap.t.cpp                                             -*-C++-*-
+
+#include <bdlc_nodehashmap.h>
+
+#include <bdlc_flathashmap.h>
+
+#include <bdlma_multipoolallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+#if defined(BDE_BUILD_TARGET_EXC)
+#include <stdexcept>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a container implementing an
+// open-addressed hash map whose elements are held in separately allocated
+// nodes.  Most of the functionality forwards to the implementation object
+// `bdlc::FlatHashTable`, which is tested in its own component; the concerns
+// here are the node handle (`bdlc::NodeHashMap_Entry`), which owns the memory
+// of each element, the iterator adaptation, the correct forwarding of the
+// container methods, and, above all, that elements do not move when the
+// table is rehashed or the container is moved.
+//
+// Global Concerns:
+//  - No memory is ever allocated from the global allocator.
+//  - Any allocated memory is always from the object allocator.
+//  - Precondition violations are detected in appropriate build modes.
+// ----------------------------------------------------------------------------
+// NodeHashMap_Entry
+// [ 2] NodeHashMap_Entry(const value_type&, Allocator *);
+// [ 2] NodeHashMap_Entry(KEY_TYPE&& key, MovableRef<VALUE>, Allocator *);
+// [ 2] NodeHashMap_Entry(const NodeHashMap_Entry&, Allocator *);
+// [ 2] NodeHashMap_Entry(MovableRef<NodeHashMap_Entry>, Allocator *);
+// [ 9] NodeHashMap_Entry(Allocator *, ARGS&&...);
+// [ 2] ~NodeHashMap_Entry();
+// [ 2] value_type& value() const;
+//
+// CREATORS
+// [ 3] NodeHashMap();
+// [ 3] NodeHashMap(Allocator *basicAllocator);
+// [ 3] NodeHashMap(size_t capacity);
+// [ 3] NodeHashMap(size_t capacity, Allocator *basicAllocator);
+// [ 3] NodeHashMap(size_t capacity, const HASH&, Allocator *bA = 0);
+// [ 3] NodeHashMap(size_t, const HASH&, const EQUAL&, Allocator * = 0);
+// [ 7] NodeHashMap(INPUT_ITERATOR, INPUT_ITERATOR, Allocator *bA = 0);
+// [ 7] NodeHashMap(INPUT_ITER, INPUT_ITER, size_t, Allocator * = 0);
+// [ 7] NodeHashMap(II, II, size_t, const HASH&, Allocator * = 0);
+// [ 7] NodeHashMap(II, II, size_t, const H&, const EQ&, Alloc * = 0);
+// #if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+// [ 7] NodeHashMap(bsl::initializer_list<v_t> values, Allocator * = 0);
+// [ 7] NodeHashMap(bsl::initializer_list<v_t>, size_t, Allocator * = 0);
+// #endif
+// [ 6] NodeHashMap(const NodeHashMap&, Allocator *bA = 0);
+// [ 6] NodeHashMap(NodeHashMap&&);
+// [ 6] NodeHashMap(NodeHashMap&&, Allocator *basicAllocator);
+// [ 3] ~NodeHashMap();
+//
+// MANIPULATORS
+// [ 6] NodeHashMap& operator=(const NodeHashMap&);
+// [ 6] NodeHashMap& operator=(NodeHashMap&&);
+// [ 4] VALUE& operator[](KEY_TYPE&& key);
+// [ 4] VALUE& at(const KEY& key);
+// [ 3] void clear();
+// [ 9] pair<iterator, bool> emplace(ARGS&&...);
+// [ 5] pair<iterator, iterator> equal_range(const KEY&);
+// [ 3] size_t erase(const KEY&);
+// [ 5] iterator erase(const_iterator);
+// [ 5] iterator erase(iterator);
+// [ 5] iterator erase(const_iterator, const_iterator);
+// [ 3] iterator find(const KEY&);
+// [ 3] pair<iterator, bool> insert(const value_type&);
+// [ 7] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// #if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+// [ 7] void insert(bsl::initializer_list<value_type> values);
+// #endif
+// [ 8] void rehash(size_t);
+// [ 8] void reserve(size_t);
+// [ 3] void reset();
+// [ 9] pair<iterator, bool> try_emplace(const KEY&, ARGS&&...);
+// [ 9] pair<iterator, bool> try_emplace(MovableRef<KEY>, ARGS&&...);
+// [ 5] iterator begin();
+// [ 5] iterator end();
+// [ 6] void swap(NodeHashMap&);
+//
+// ACCESSORS
+// [ 4] const VALUE& at(const KEY& key) const;
+// [ 3] size_t capacity() const;
+// [ 3] bool contains(const KEY&) const;
+// [ 3] size_t count(const KEY&) const;
+// [ 3] bool empty() const;
+// [ 5] pair<c_iter, c_iter> equal_range(const KEY&) const;
+// [ 3] const_iterator find(const KEY&) const;
+// [ 3] HASH hash_function() const;
+// [ 3] EQUAL key_eq() const;
+// [ 3] float load_factor() const;
+// [ 3] float max_load_factor() const;
+// [ 3] size_t size() const;
+// [ 5] const_iterator begin() const;
+// [ 5] const_iterator cbegin() const;
+// [ 5] const_iterator cend() const;
+// [ 5] const_iterator end() const;
+// [ 3] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 6] bool operator==(const NodeHashMap&, const NodeHashMap&);
+// [ 6] bool operator!=(const NodeHashMap&, const NodeHashMap&);
+//
+// FREE FUNCTIONS
+// [ 6] void swap(NodeHashMap&, NodeHashMap&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] ELEMENT STABILITY
+// [10] USAGE EXAMPLE
+// [-1] NODE HASH MAP BENCHMARK
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT  BSLIM_TESTUTIL_ASSERT
+#define ASSERTV BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q  BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P  BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_ BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_ BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_ BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::NodeHashMap<int, int>                 Obj;
+typedef bdlc::NodeHashMap<bsl::string, bsl::string> StringObj;
+typedef bdlc::NodeHashMap_Entry<int, bsl::string>   Entry;
+
+BSLMF_ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+BSLMF_ASSERT(bslma::UsesBslmaAllocator<Entry>::value);
+BSLMF_ASSERT(bslmf::IsBitwiseMoveable<Entry>::value);
+BSLMF_ASSERT(sizeof(Entry) == sizeof(void *));
+
+// ============================================================================
+//                     GLOBAL VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool verbose;
+bool veryVerbose;
+bool veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static unsigned int s_antiOptimization = 0;
+
+/// Return a string value, unique to the specified `i`, that is too long to
+/// be stored in the footprint of a `bsl::string` (so that copying it
+/// allocates memory).
+bsl::string longString(int i)
+{
+    bsl::string result("a string that will not fit in the short buffer: ");
+    result += static_cast<char>('A' + i % 26);
+    result += static_cast<char>('A' + i / 26 % 26);
+    result += static_cast<char>('A' + i / 676 % 26);
+    return result;
+}
+
+/// Load into the specified `keys` the specified `numKeys` distinct keys in
+/// an order unrelated to their value, followed by `numKeys` distinct keys
+/// different from each of the first ones.
+void makeKeys(bsl::vector<int> *keys, int numKeys)
+{
+    keys->clear();
+    keys->reserve(2 * numKeys);
+
+    // Even multiples of the multiplier are inserted, odd ones are absent.
+
+    const unsigned int MULTIPLIER = 2654435761u;
+
+    for (int i = 0; i < 2 * numKeys; ++i) {
+        keys->push_back(static_cast<int>(static_cast<unsigned int>(i)
+                                                               * MULTIPLIER));
+    }
+
+    bsl::vector<int> present, absent;
+    for (int i = 0; i < 2 * numKeys; ++i) {
+        (i % 2 ? absent : present).push_back((*keys)[i]);
+    }
+    keys->assign(present.begin(), present.end());
+    keys->insert(keys->end(), absent.begin(), absent.end());
+}
+
+/// Return the number of nanoseconds elapsed since the specified `start`.
+double elapsedNanoseconds(const bsls::TimeInterval& start)
+{
+    return static_cast<double>(
+          (bsls::SystemTime::nowMonotonicClock() - start).totalNanoseconds());
+}
+
+/// This `struct` holds the median time, in nanoseconds per operation, of
+/// each operation measured by `timeOperations`.
+struct OperationTimes {
+    double d_insert;    // insertion of a new key
+    double d_findHit;   // lookup of a present key
+    double d_findMiss;  // lookup of an absent key
+    double d_erase;     // erasure of a present key
+};
+
+/// Return the median times per operation of inserting the first half of
+/// the specified `keys` into an initially empty map of the (template
+/// parameter) type `MAP`, looking up each key of that half, looking up each
+/// key of the other (absent) half, and erasing each key of the first half,
+/// measured over the specified `numTrials` trials.  Memory is supplied by
+/// the default allocator.
+template <class MAP>
+OperationTimes timeOperations(const bsl::vector<int>& keys, int numTrials)
+{
+    const int NUM_KEYS = static_cast<int>(keys.size() / 2);
+
+    bsl::vector<double> inserts, hits, misses, erases;
+
+    for (int trial = 0; trial < numTrials; ++trial) {
+        MAP map;
+
+        bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            map.insert(typename MAP::value_type(keys[i], i));
+        }
+        inserts.push_back(elapsedNanoseconds(start) / NUM_KEYS);
+
+        start = bsls::SystemTime::nowMonotonicClock();
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            s_antiOptimization += map.find(keys[i])->second;
+        }
+        hits.push_back(elapsedNanoseconds(start) / NUM_KEYS);
+
+        start = bsls::SystemTime::nowMonotonicClock();
+        for (int i = NUM_KEYS; i < 2 * NUM_KEYS; ++i) {
+            if (map.end() != map.find(keys[i])) {
+                ++s_antiOptimization;
+            }
+        }
+        misses.push_back(elapsedNanoseconds(start) / NUM_KEYS);
+
+        start = bsls::SystemTime::nowMonotonicClock();
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            s_antiOptimization += static_cast<unsigned int>(
+                                                         map.erase(keys[i]));
+        }
+        erases.push_back(elapsedNanoseconds(start) / NUM_KEYS);
+    }
+
+    bsl::sort(inserts.begin(), inserts.end());
+    bsl::sort(hits.begin(),    hits.end());
+    bsl::sort(misses.begin(),  misses.end());
+    bsl::sort(erases.begin(),  erases.end());
+
+    OperationTimes result;
+    result.d_insert   = inserts[numTrials / 2];
+    result.d_findHit  = hits[numTrials / 2];
+    result.d_findMiss = misses[numTrials / 2];
+    result.d_erase    = erases[numTrials / 2];
+    return result;
+}
+
+/// Print to standard output the specified `times` of the container having
+/// the specified `name`.
+void printTimes(const char *name, const OperationTimes& times)
+{
+    cout << setw(16) << name
+         << setw(10) << times.d_insert
+         << setw(10) << times.d_findHit
+         << setw(10) << times.d_findMiss
+         << setw(10) << times.d_erase << endl;
+}
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+struct Order {
+    int    d_quantity;
+    double d_price;
+};
+
+}  // close namespace usage
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? atoi(argv[1]) : 0;
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 10: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&oa);
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Indexing Orders by Identifier
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain the set of live orders of a trading session in a map
+// keyed by order identifier, and, to avoid a second lookup, a secondary
+// structure (here a simple array) refers directly to the orders awaiting
+// execution.  Such direct references require that the orders not move when
+// the map grows.
+//
+// First, we define the order type and an alias for our map:
+// ```
+//  struct Order {
+//      int    d_quantity;
+//      double d_price;
+//  };
+    using usage::Order;
+
+    typedef bdlc::NodeHashMap<int, Order> OrderMap;
+// ```
+// Then, we create a map and insert an order, retaining a pointer to it:
+// ```
+    OrderMap orders;
+
+    Order  first = { 100, 25.5 };
+    Order *pending = &orders.insert(bsl::make_pair(1, first)).first->second;
+// ```
+// Next, we insert enough orders to force the map to grow several times:
+// ```
+    const bsl::size_t initialCapacity = orders.capacity();
+
+    for (int id = 2; id <= 1000; ++id) {
+        Order order = { id, 10.0 };
+        orders.insert(bsl::make_pair(id, order));
+    }
+    ASSERT(initialCapacity < orders.capacity());
+// ```
+// Finally, we observe that the pointer obtained before the map grew still
+// refers to the original order, and that modifications through it are
+// visible through the map:
+// ```
+    ASSERT(&orders[1] == pending);
+
+    pending->d_quantity = 50;
+    ASSERT(50 == orders.find(1)->second.d_quantity);
+// ```
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // EMPLACE AND TRY_EMPLACE
+        //
+        // Concerns:
+        // 1. The variadic entry constructor allocates one node from the
+        //    supplied allocator and constructs the element in it from the
+        //    arguments, using that allocator.
+        //
+        // 2. `emplace` constructs the element from any number of arguments
+        //    and inserts it if its key is absent, without moving the element
+        //    out of the node in which it was constructed.
+        //
+        // 3. `emplace` of an element whose key is present has no effect, and
+        //    releases the node of the temporary element.
+        //
+        // 4. `try_emplace` inserts an element constructed from the key and
+        //    the remaining arguments if the key is absent, and allocates
+        //    nothing and leaves the key and arguments unchanged otherwise.
+        //
+        // 5. No memory is allocated from the default allocator.
+        //
+        // Plan:
+        // 1. Construct entries from zero, one, and two arguments, and verify
+        //    the element and the allocator usage.  (C-1)
+        //
+        // 2. Emplace elements into a map of strings from a `value_type`, from
+        //    a key and a value, and piecewise, and verify the contents, the
+        //    number of blocks in use, and that the element address does not
+        //    change while the map is rehashed.  (C-2..3, 5)
+        //
+        // 3. Call both `try_emplace` overloads with absent and present keys
+        //    and verify the contents, the number of blocks in use, and the
+        //    state of the moved key.  (C-4..5)
+        //
+        // Testing:
+        //   NodeHashMap_Entry(Allocator *, ARGS&&...);
+        //   pair<iterator, bool> emplace(ARGS&&...);
+        //   pair<iterator, bool> try_emplace(const KEY&, ARGS&&...);
+        //   pair<iterator, bool> try_emplace(MovableRef<KEY>, ARGS&&...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EMPLACE AND TRY_EMPLACE" << endl
+                          << "=======================" << endl;
+
+        typedef StringObj::value_type StringValue;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const bsl::string K1(longString(1), &oa);
+        const bsl::string K2(longString(2), &oa);
+        const bsl::string K3(longString(3), &oa);
+        const bsl::string V1(longString(11), &oa);
+        const bsl::string V2(longString(12), &oa);
+        const bsl::string V3(longString(13), &oa);
+
+        const bsls::Types::Int64 NUM_STRING_BLOCKS  = oa.numBlocksInUse();
+        const bsls::Types::Int64 NUM_DEFAULT_BLOCKS = da.numBlocksTotal();
+
+        if (verbose) cout << "\tVariadic entry constructor." << endl;
+        {
+            Entry mX(&oa);  const Entry& X = mX;
+
+            ASSERT(0 == X.value().first);
+            ASSERT(X.value().second.empty());
+            ASSERT(&oa == X.value().second.get_allocator().mechanism());
+            ASSERTV(oa.numBlocksInUse(),
+                    NUM_STRING_BLOCKS + 1 == oa.numBlocksInUse());
+
+            Entry mY(&oa, 5, V1);  const Entry& Y = mY;
+
+            ASSERT(5  == Y.value().first);
+            ASSERT(V1 == Y.value().second);
+            ASSERT(&oa == Y.value().second.get_allocator().mechanism());
+            ASSERTV(oa.numBlocksInUse(),
+                    NUM_STRING_BLOCKS + 3 == oa.numBlocksInUse());
+
+            Entry mZ(&oa, Entry::value_type(6, V2, &oa));
+            const Entry& Z = mZ;
+
+            ASSERT(6  == Z.value().first);
+            ASSERT(V2 == Z.value().second);
+            ASSERT(&oa == Z.value().second.get_allocator().mechanism());
+        }
+        ASSERTV(oa.numBlocksInUse(),
+                NUM_STRING_BLOCKS == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting `emplace`." << endl;
+        {
+            StringObj mX(&oa);  const StringObj& X = mX;
+
+            bsl::pair<StringObj::iterator, bool> result =
+                                          mX.emplace(StringValue(K1, V1, &oa));
+
+            ASSERT(result.second);
+            ASSERT(K1 == result.first->first);
+            ASSERT(V1 == result.first->second);
+
+            result = mX.emplace(K2, V2);
+
+            ASSERT(result.second);
+            ASSERT(V2 == result.first->second);
+            ASSERT(&oa == result.first->second.get_allocator().mechanism());
+
+            const StringValue *ADDRESS = &*result.first;
+
+            const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksInUse();
+
+            result = mX.emplace(K2, V3);
+
+            ASSERT(!result.second);
+            ASSERT(ADDRESS == &*result.first);
+            ASSERT(V2      == X.at(K2));
+            ASSERTV(oa.numBlocksInUse(),
+                    NUM_BLOCKS == oa.numBlocksInUse());
+
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR
+            result = mX.emplace(std::piecewise_construct,
+                                std::forward_as_tuple(K3),
+                                std::forward_as_tuple(3, 'x'));
+
+            ASSERT(result.second);
+            ASSERT("xxx" == result.first->second);
+#else
+            mX.emplace(K3, bsl::string(3, 'x'));
+#endif
+
+            mX.reserve(1000);
+
+            ASSERT(ADDRESS == &*X.find(K2));
+            ASSERT(3       == X.size());
+        }
+        ASSERTV(oa.numBlocksInUse(),
+                NUM_STRING_BLOCKS == oa.numBlocksInUse());
+
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR
+        if (verbose) cout << "\tTesting `try_emplace`." << endl;
+        {
+            StringObj mX(&oa);  const StringObj& X = mX;
+
+            bsl::pair<StringObj::iterator, bool> result =
+                                                      mX.try_emplace(K1, V1);
+
+            ASSERT(result.second);
+            ASSERT(V1 == X.at(K1));
+
+            const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksInUse();
+
+            result = mX.try_emplace(K1, V2);
+
+            ASSERT(!result.second);
+            ASSERT(V1 == result.first->second);
+            ASSERTV(oa.numBlocksInUse(),
+                    NUM_BLOCKS == oa.numBlocksInUse());
+
+            result = mX.try_emplace(K2, 3, 'y');
+
+            ASSERT(result.second);
+            ASSERT("yyy" == X.at(K2));
+
+            bsl::string key(K3, &oa);
+            bsl::string value(V3, &oa);
+
+            result = mX.try_emplace(bslmf::MovableRefUtil::move(key),
+                                    bslmf::MovableRefUtil::move(value));
+
+            ASSERT(result.second);
+            ASSERT(K3 == result.first->first);
+            ASSERT(V3 == result.first->second);
+
+            bsl::string sameKey(K3, &oa);
+            bsl::string otherValue(V1, &oa);
+
+            result = mX.try_emplace(bslmf::MovableRefUtil::move(sameKey),
+                                    bslmf::MovableRefUtil::move(otherValue));
+
+            ASSERT(!result.second);
+            ASSERT(K3 == sameKey);
+            ASSERT(V1 == otherValue);
+            ASSERT(V3 == X.at(K3));
+            ASSERT(3  == X.size());
+        }
+        ASSERTV(oa.numBlocksInUse(),
+                NUM_STRING_BLOCKS == oa.numBlocksInUse());
+#endif
+
+        ASSERTV(da.numBlocksTotal(),
+                NUM_DEFAULT_BLOCKS == da.numBlocksTotal());
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // ELEMENT STABILITY
+        //
+        // Concerns:
+        // 1. The address of an element does not change when the map is
+        //    rehashed, whether by insertion beyond the maximum load factor,
+        //    `rehash`, or `reserve`.
+        //
+        // 2. The address of an element does not change when other elements
+        //    are erased.
+        //
+        // 3. Rehashing allocates no node memory: only the table arrays are
+        //    reallocated.
+        //
+        // 4. Moving a map (by construction with the same allocator,
+        //    assignment with the same allocator, or `swap`) does not move its
+        //    elements.
+        //
+        // Plan:
+        // 1. Insert elements one at a time, recording the address of each,
+        //    until the capacity has grown several times, and verify each
+        //    recorded address against the address found by `find`.  (C-1)
+        //
+        // 2. Call `rehash` and `reserve` with capacities larger than the
+        //    current one, and verify that the number of blocks in use grows
+        //    by at most two (the new entry and control arrays) and that the
+        //    recorded addresses are unchanged.  (C-1, 3)
+        //
+        // 3. Erase every other element, and verify the addresses of the
+        //    remaining elements.  (C-2)
+        //
+        // 4. Move the map into a new map with the same allocator, move-assign
+        //    it into another, and `swap` it, verifying the addresses after
+        //    each step.  (C-4)
+        //
+        // Testing:
+        //   ELEMENT STABILITY
+        //   void rehash(size_t);
+        //   void reserve(size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ELEMENT STABILITY" << endl
+                          << "=================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const int NUM_ELEMENTS = 1000;
+
+        StringObj mX(&oa);  const StringObj& X = mX;
+
+        bsl::vector<const StringObj::value_type *> addresses;
+
+        const bsl::size_t INITIAL_CAPACITY = X.capacity();
+
+        for (int i = 0; i < NUM_ELEMENTS; ++i) {
+            StringObj::iterator it = mX.insert(
+                  StringObj::value_type(longString(i), longString(i))).first;
+            addresses.push_back(&*it);
+        }
+        ASSERT(INITIAL_CAPACITY < X.capacity());
+
+        for (int i = 0; i < NUM_ELEMENTS; ++i) {
+            ASSERTV(i, addresses[i] == &*X.find(longString(i)));
+        }
+
+        if (verbose) cout << "\tTesting `rehash` and `reserve`." << endl;
+        {
+            bsls::Types::Int64 numBlocks = oa.numBlocksInUse();
+
+            mX.rehash(4 * X.capacity());
+
+            ASSERTV(numBlocks, oa.numBlocksInUse(),
+                    numBlocks == oa.numBlocksInUse());
+
+            mX.reserve(4 * X.capacity());
+
+            ASSERTV(numBlocks, oa.numBlocksInUse(),
+                    numBlocks == oa.numBlocksInUse());
+
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                ASSERTV(i, addresses[i] == &*X.find(longString(i)));
+            }
+        }
+
+        if (verbose) cout << "\tTesting `erase`." << endl;
+        {
+            for (int i = 0; i < NUM_ELEMENTS; i += 2) {
+                ASSERTV(i, 1 == mX.erase(longString(i)));
+            }
+            mX.rehash(0);
+
+            for (int i = 1; i < NUM_ELEMENTS; i += 2) {
+                ASSERTV(i, addresses[i] == &*X.find(longString(i)));
+            }
+        }
+
+        if (verbose) cout << "\tTesting move and `swap`." << endl;
+        {
+            StringObj mY(bslmf::MovableRefUtil::move(mX));
+            const StringObj& Y = mY;
+
+            for (int i = 1; i < NUM_ELEMENTS; i += 2) {
+                ASSERTV(i, addresses[i] == &*Y.find(longString(i)));
+            }
+
+            StringObj mZ(&oa);  const StringObj& Z = mZ;
+
+            mZ = bslmf::MovableRefUtil::move(mY);
+
+            for (int i = 1; i < NUM_ELEMENTS; i += 2) {
+                ASSERTV(i, addresses[i] == &*Z.find(longString(i)));
+            }
+
+            StringObj mW(&oa);  const StringObj& W = mW;
+
+            mW.swap(mZ);
+
+            ASSERT(Z.empty());
+            for (int i = 1; i < NUM_ELEMENTS; i += 2) {
+                ASSERTV(i, addresses[i] == &*W.find(longString(i)));
+            }
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // RANGE AND INITIALIZER-LIST CONSTRUCTORS AND INSERT
+        //
+        // Concerns:
+        // 1. The range constructors and range `insert` insert each element of
+        //    the range whose key is not already present, keeping the first of
+        //    equivalent keys.
+        //
+        // 2. The supplied capacity, hasher, comparator, and allocator are
+        //    used.
+        //
+        // 3. The initializer-list constructors and `insert` behave as the
+        //    range ones.
+        //
+        // Plan:
+        // 1. Construct maps from an array of values containing a duplicate
+        //    key with each constructor and verify their size and contents,
+        //    and the attributes supplied.  (C-1..3)
+        //
+        // Testing:
+        //   NodeHashMap(INPUT_ITERATOR, INPUT_ITERATOR, Allocator *bA = 0);
+        //   NodeHashMap(INPUT_ITER, INPUT_ITER, size_t, Allocator * = 0);
+        //   NodeHashMap(II, II, size_t, const HASH&, Allocator * = 0);
+        //   NodeHashMap(II, II, size_t, const H&, const EQ&, Alloc * = 0);
+        //   NodeHashMap(bsl::initializer_list<v_t> values, Allocator * = 0);
+        //   NodeHashMap(bsl::initializer_list<v_t>, size_t, Allocator * = 0);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(bsl::initializer_list<value_type> values);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "RANGE AND INITIALIZER-LIST CONSTRUCTORS AND "
+                          << "INSERT" << endl
+                          << "============================================"
+                          << "======" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const Obj::value_type VALUES[] = {
+            Obj::value_type(1, 10),
+            Obj::value_type(2, 20),
+            Obj::value_type(3, 30),
+            Obj::value_type(1, 40),
+        };
+        const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        Obj::hasher    hash;
+        Obj::key_compare equal;
+
+        {
+            Obj mX(VALUES, VALUES + NUM_VALUES, &oa);  const Obj& X = mX;
+
+            ASSERT(  3 == X.size());
+            ASSERT( 10 == X.at(1));
+            ASSERT(&oa == X.allocator());
+        }
+        {
+            Obj mX(VALUES, VALUES + NUM_VALUES, 100, &oa);
+            const Obj& X = mX;
+
+            ASSERT(   3 == X.size());
+            ASSERT(100 <= X.capacity());
+            ASSERT( &oa == X.allocator());
+        }
+        {
+            Obj mX(VALUES, VALUES + NUM_VALUES, 100, hash, &oa);
+            const Obj& X = mX;
+
+            ASSERT(   3 == X.size());
+            ASSERT(100 <= X.capacity());
+        }
+        {
+            Obj mX(VALUES, VALUES + NUM_VALUES, 100, hash, equal, &oa);
+            const Obj& X = mX;
+
+            ASSERT(   3 == X.size());
+            ASSERT(100 <= X.capacity());
+        }
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.insert(VALUES, VALUES + NUM_VALUES);
+
+            ASSERT( 3 == X.size());
+            ASSERT(10 == X.at(1));
+            ASSERT(20 == X.at(2));
+            ASSERT(30 == X.at(3));
+        }
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            Obj mX({ {1, 10}, {2, 20}, {1, 30} }, &oa);  const Obj& X = mX;
+
+            ASSERT( 2 == X.size());
+            ASSERT(10 == X.at(1));
+
+            Obj mY({ {1, 10}, {2, 20} }, 100, &oa);  const Obj& Y = mY;
+
+            ASSERT(   2 == Y.size());
+            ASSERT(100 <= Y.capacity());
+            ASSERT(   X == Y);
+
+            mY.insert({ {3, 30}, {1, 50} });
+
+            ASSERT( 3 == Y.size());
+            ASSERT(10 == Y.at(1));
+            ASSERT(30 == Y.at(3));
+        }
+#endif
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, ASSIGNMENT, EQUALITY, AND SWAP
+        //
+        // Concerns:
+        // 1. A copy has the same value as the original, its own elements, and
+        //    uses the supplied (or default) allocator.
+        //
+        // 2. A move with the same allocator transfers the elements without
+        //    allocating; a move with a different allocator copies them into
+        //    the new allocator and leaves the original's memory untouched.
+        //
+        // 3. Copy and move assignment give the target the value of the source.
+        //
+        // 4. Equality compares values, not hashers or element addresses, and
+        //    is independent of insertion order.
+        //
+        // 5. The member and free `swap` exchange values.
+        //
+        // 6. `swap` of maps having different allocators is detected in
+        //    appropriate build modes.
+        //
+        // Plan:
+        // 1. Create maps having a range of sizes, copy and move them with
+        //    the same and different allocators, and verify values, element
+        //    addresses, and allocator usage.  (C-1..3)
+        //
+        // 2. Compare maps built in different orders, and maps that differ in
+        //    a key or in a mapped value.  (C-4)
+        //
+        // 3. Swap maps and verify their values.  (C-5)
+        //
+        // 4. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for `swap` of maps with different allocators.  (C-6)
+        //
+        // Testing:
+        //   NodeHashMap(const NodeHashMap&, Allocator *bA = 0);
+        //   NodeHashMap(NodeHashMap&&);
+        //   NodeHashMap(NodeHashMap&&, Allocator *basicAllocator);
+        //   NodeHashMap& operator=(const NodeHashMap&);
+        //   NodeHashMap& operator=(NodeHashMap&&);
+        //   void swap(NodeHashMap&);
+        //   bool operator==(const NodeHashMap&, const NodeHashMap&);
+        //   bool operator!=(const NodeHashMap&, const NodeHashMap&);
+        //   void swap(NodeHashMap&, NodeHashMap&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, MOVE, ASSIGNMENT, EQUALITY, AND SWAP"
+                          << endl
+                          << "=========================================="
+                          << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const int SIZES[] = { 0, 1, 2, 15, 16, 17, 100 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            StringObj mX(&oa);  const StringObj& X = mX;
+            for (int i = 0; i < SIZE; ++i) {
+                mX[longString(i)] = longString(i + 1);
+            }
+
+            {
+                StringObj mY(X, &sa);  const StringObj& Y = mY;
+
+                ASSERTV(SIZE,   X == Y);
+                ASSERTV(SIZE, &sa == Y.allocator());
+                if (SIZE) {
+                    ASSERTV(SIZE, &*X.begin() != &*Y.find(X.begin()->first));
+                }
+
+                bslma::DefaultAllocatorGuard dag(&sa);
+
+                StringObj mZ(X);  const StringObj& Z = mZ;
+
+                ASSERTV(SIZE,   X == Z);
+                ASSERTV(SIZE, &sa == Z.allocator());
+            }
+            ASSERTV(SIZE, 0 == sa.numBlocksInUse());
+
+            {
+                StringObj mY(X, &oa);
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                StringObj mZ(bslmf::MovableRefUtil::move(mY));
+                const StringObj& Z = mZ;
+
+                ASSERTV(SIZE, oam.isTotalSame());
+                ASSERTV(SIZE,   X == Z);
+                ASSERTV(SIZE, &oa == Z.allocator());
+
+                StringObj mW(bslmf::MovableRefUtil::move(mZ), &oa);
+                const StringObj& W = mW;
+
+                ASSERTV(SIZE, oam.isTotalSame());
+                ASSERTV(SIZE, X == W);
+
+                StringObj mV(bslmf::MovableRefUtil::move(mW), &sa);
+                const StringObj& V = mV;
+
+                ASSERTV(SIZE,   X == V);
+                ASSERTV(SIZE, &sa == V.allocator());
+                ASSERTV(SIZE, oam.isInUseSame());
+                ASSERTV(SIZE, X == W);
+            }
+            ASSERTV(SIZE, 0 == sa.numBlocksInUse());
+
+            {
+                StringObj mY(&sa);  const StringObj& Y = mY;
+                mY["other"] = "value";
+
+                mY = X;
+
+                ASSERTV(SIZE, X == Y);
+
+                StringObj mZ(X, &oa);
+
+                mY.clear();
+                mY = bslmf::MovableRefUtil::move(mZ);
+
+                ASSERTV(SIZE, X == Y);
+            }
+            ASSERTV(SIZE, 0 == sa.numBlocksInUse());
+
+            {
+                StringObj mY(&oa);  const StringObj& Y = mY;
+                for (int i = SIZE - 1; 0 <= i; --i) {
+                    mY[longString(i)] = longString(i + 1);
+                }
+
+                ASSERTV(SIZE, X == Y);
+                ASSERTV(SIZE, !(X != Y));
+
+                if (SIZE) {
+                    mY[longString(0)] = "different";
+
+                    ASSERTV(SIZE, X != Y);
+                    ASSERTV(SIZE, !(X == Y));
+
+                    mY.erase(longString(0));
+                    mY["different"] = longString(1);
+
+                    ASSERTV(SIZE, X != Y);
+                }
+
+                StringObj mZ(&oa);  const StringObj& Z = mZ;
+
+                StringObj mXX(X, &oa);  const StringObj& XX = mXX;
+
+                mZ.swap(mXX);
+
+                ASSERTV(SIZE, X == Z);
+                ASSERTV(SIZE, XX.empty());
+
+                swap(mZ, mXX);
+
+                ASSERTV(SIZE, X == XX);
+                ASSERTV(SIZE, Z.empty());
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            StringObj mX(&oa);
+            StringObj mY(&oa);
+            StringObj mZ(&sa);
+
+            ASSERT_SAFE_PASS(mX.swap(mY));
+            ASSERT_SAFE_FAIL(mX.swap(mZ));
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ITERATORS AND ERASURE BY POSITION
+        //
+        // Concerns:
+        // 1. Iteration visits each element exactly once, and the iterators
+        //    refer to the elements held by the nodes.
+        //
+        // 2. Modifications through an `iterator` are visible through the map.
+        //
+        // 3. `equal_range` returns an empty range for an absent key and a
+        //    single-element range for a present one.
+        //
+        // 4. Erasure by position and by range removes exactly the indicated
+        //    elements, returns the iterator following them, and releases the
+        //    memory of their nodes.
+        //
+        // Plan:
+        // 1. Insert a set of keys, iterate with `begin`/`end` and
+        //    `cbegin`/`cend`, and verify each key is visited once.  (C-1)
+        //
+        // 2. Increment each mapped value through an `iterator` and verify
+        //    with `find`.  (C-2)
+        //
+        // 3. Verify `equal_range` for present and absent keys.  (C-3)
+        //
+        // 4. Erase elements by position and by range, verifying the returned
+        //    iterator, the size, and the number of blocks in use.  (C-4)
+        //
+        // Testing:
+        //   iterator begin();
+        //   iterator end();
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator cend() const;
+        //   const_iterator end() const;
+        //   pair<iterator, iterator> equal_range(const KEY&);
+        //   pair<c_iter, c_iter> equal_range(const KEY&) const;
+        //   iterator erase(const_iterator);
+        //   iterator erase(iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ITERATORS AND ERASURE BY POSITION" << endl
+                          << "=================================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const int NUM_ELEMENTS = 100;
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        ASSERT(X.begin()  == X.end());
+        ASSERT(X.cbegin() == X.cend());
+
+        for (int i = 0; i < NUM_ELEMENTS; ++i) {
+            mX.insert(Obj::value_type(i, i));
+        }
+
+        {
+            bsl::vector<int> seen(NUM_ELEMENTS, 0);
+
+            for (Obj::const_iterator it = X.cbegin(); it != X.cend(); ++it) {
+                ASSERTV(it->first, it->first == it->second);
+                ++seen[it->first];
+            }
+            for (Obj::iterator it = mX.begin(); it != mX.end(); ++it) {
+                ++it->second;
+            }
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                ASSERTV(i, seen[i],          1 == seen[i]);
+                ASSERTV(i, X.find(i)->second, i + 1 == X.find(i)->second);
+            }
+
+            Obj::const_iterator cit = mX.begin();  // conversion
+            ASSERT(cit == X.begin());
+        }
+
+        {
+            bsl::pair<Obj::iterator, Obj::iterator> range =
+                                                          mX.equal_range(-1);
+            ASSERT(range.first == range.second);
+            ASSERT(range.first == X.end());
+
+            range = mX.equal_range(7);
+            ASSERT(range.first  == mX.find(7));
+            ASSERT(range.second != range.first);
+            ASSERT(++range.first == range.second);
+
+            bsl::pair<Obj::const_iterator, Obj::const_iterator> crange =
+                                                           X.equal_range(7);
+            ASSERT(crange.first == X.find(7));
+            ASSERT(++crange.first == crange.second);
+        }
+
+        {
+            bsls::Types::Int64 numBlocks = oa.numBlocksInUse();
+
+            Obj::iterator it   = mX.find(7);
+            Obj::iterator next = it;
+            ++next;
+
+            ASSERT(next == mX.erase(it));
+            ASSERT(NUM_ELEMENTS - 1 == static_cast<int>(X.size()));
+            ASSERT(X.end() == X.find(7));
+            ASSERT(numBlocks - 1 == oa.numBlocksInUse());
+
+            Obj::const_iterator cit = X.find(8);
+            next = mX.find(8);
+            ++next;
+
+            ASSERT(next == mX.erase(cit));
+            ASSERT(NUM_ELEMENTS - 2 == static_cast<int>(X.size()));
+
+            Obj::const_iterator first = X.begin();
+            Obj::const_iterator last  = first;
+            for (int i = 0; i < 10; ++i) {
+                ++last;
+            }
+
+            ASSERT(last == mX.erase(first, last));
+            ASSERT(NUM_ELEMENTS - 12 == static_cast<int>(X.size()));
+            ASSERT(numBlocks - 12 == oa.numBlocksInUse());
+
+            ASSERT(X.end() == mX.erase(X.begin(), X.end()));
+            ASSERT(X.empty());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            mX.insert(Obj::value_type(1, 1));
+
+            ASSERT_SAFE_FAIL(mX.erase(X.end()));
+            ASSERT_SAFE_FAIL(mX.erase(mX.end()));
+            ASSERT_SAFE_PASS(mX.erase(X.begin()));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // `operator[]` AND `at`
+        //
+        // Concerns:
+        // 1. `operator[]` inserts an element having a default-constructed
+        //    mapped value, using the object allocator, for an absent key, and
+        //    returns a reference to the mapped value of the existing element
+        //    for a present key.
+        //
+        // 2. `at` returns the mapped value of a present key, and throws
+        //    `std::out_of_range` for an absent key.
+        //
+        // Plan:
+        // 1. Use `operator[]` with absent and present keys, verifying the
+        //    size, the returned reference, and allocator usage.  (C-1)
+        //
+        // 2. Use `at` (both overloads) with present and absent keys.  (C-2)
+        //
+        // Testing:
+        //   VALUE& operator[](KEY_TYPE&& key);
+        //   VALUE& at(const KEY& key);
+        //   const VALUE& at(const KEY& key) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "`operator[]` AND `at`" << endl
+                          << "=====================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        StringObj mX(&oa);  const StringObj& X = mX;
+
+        bsl::string& value = mX[longString(0)];
+
+        ASSERT(1 == X.size());
+        ASSERT(value.empty());
+        ASSERT(&oa == value.get_allocator().mechanism());
+
+        value = longString(1);
+
+        ASSERT(&value == &mX[longString(0)]);
+        ASSERT(1 == X.size());
+        ASSERT(longString(1) == X.at(longString(0)));
+        ASSERT(&value == &mX.at(longString(0)));
+
+        const bsl::string key = longString(2);
+
+        mX[key] = "x";
+
+        ASSERT(2   == X.size());
+        ASSERT("x" == X.at(key));
+
+#if defined(BDE_BUILD_TARGET_EXC)
+        {
+            bool caught = false;
+            try {
+                mX.at(longString(3));
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            caught = false;
+            try {
+                X.at(longString(3));
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+        }
+#endif
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        // 1. The default and capacity constructors create an empty map with
+        //    the requested capacity, hasher, comparator, and allocator.
+        //
+        // 2. `insert` adds an element for an absent key, and leaves the map
+        //    unchanged and allocates nothing for a present key.
+        //
+        // 3. `find`, `contains`, and `count` locate each inserted key, and
+        //    none that has not been inserted.
+        //
+        // 4. `erase(key)` removes exactly the indicated element, and releases
+        //    the memory of its node.
+        //
+        // 5. `clear` removes all elements and keeps the capacity; `reset`
+        //    also releases the table.
+        //
+        // 6. All memory comes from the object allocator.
+        //
+        // Plan:
+        // 1. Construct maps with each constructor and verify their
+        //    attributes.  (C-1)
+        //
+        // 2. Insert, find, and erase a sequence of keys, verifying the
+        //    accessors and the allocator usage after each operation.
+        //    (C-2..6)
+        //
+        // Testing:
+        //   NodeHashMap();
+        //   NodeHashMap(Allocator *basicAllocator);
+        //   NodeHashMap(size_t capacity);
+        //   NodeHashMap(size_t capacity, Allocator *basicAllocator);
+        //   NodeHashMap(size_t capacity, const HASH&, Allocator *bA = 0);
+        //   NodeHashMap(size_t, const HASH&, const EQUAL&, Allocator * = 0);
+        //   ~NodeHashMap();
+        //   void clear();
+        //   size_t erase(const KEY&);
+        //   iterator find(const KEY&);
+        //   pair<iterator, bool> insert(const value_type&);
+        //   void reset();
+        //   size_t capacity() const;
+        //   bool contains(const KEY&) const;
+        //   size_t count(const KEY&) const;
+        //   bool empty() const;
+        //   const_iterator find(const KEY&) const;
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS AND BASIC ACCESSORS" << endl
+                          << "========================================"
+                          << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\tTesting constructors." << endl;
+        {
+            Obj::hasher    hash;
+            Obj::key_compare equal;
+
+            Obj mA;                           const Obj& A = mA;
+            Obj mB(&oa);                      const Obj& B = mB;
+            Obj mC(100);                      const Obj& C = mC;
+            Obj mD(100, &oa);                 const Obj& D = mD;
+            Obj mE(100, hash, &oa);           const Obj& E = mE;
+            Obj mF(100, hash, equal, &oa);    const Obj& F = mF;
+
+            ASSERT(&da == A.allocator());
+            ASSERT(&oa == B.allocator());
+            ASSERT(&da == C.allocator());
+            ASSERT(&oa == D.allocator());
+            ASSERT(&oa == E.allocator());
+            ASSERT(&oa == F.allocator());
+
+            ASSERT(  0 == A.capacity());
+            ASSERT(  0 == B.capacity());
+            ASSERT(100 <= C.capacity());
+            ASSERT(100 <= D.capacity());
+            ASSERT(100 <= E.capacity());
+            ASSERT(100 <= F.capacity());
+
+            ASSERT(A.empty());
+            ASSERT(0 == F.size());
+            ASSERT(0 == F.load_factor());
+            ASSERT(0 <  F.max_load_factor());
+            ASSERT(F.max_load_factor() <= 1.0f);
+            ASSERT(F.hash_function()(7) == hash(7));
+            ASSERT(F.key_eq()(7, 7));
+            ASSERT(!F.key_eq()(7, 8));
+        }
+        ASSERT(0 == da.numBlocksInUse());
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\tTesting `insert`, `find`, and `erase`."
+                          << endl;
+        {
+            const int NUM_ELEMENTS = 200;
+
+            StringObj mX(&oa);  const StringObj& X = mX;
+
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                const bsl::string KEY   = longString(i);
+                const bsl::string VALUE = longString(i + 7);
+
+                bsl::pair<StringObj::iterator, bool> rv =
+                                  mX.insert(StringObj::value_type(KEY, VALUE));
+
+                ASSERTV(i, rv.second);
+                ASSERTV(i, KEY   == rv.first->first);
+                ASSERTV(i, VALUE == rv.first->second);
+                ASSERTV(i, i + 1 == static_cast<int>(X.size()));
+                ASSERTV(i,
+                        &oa == rv.first->second.get_allocator().mechanism());
+
+                bslma::TestAllocatorMonitor oam(&oa);
+
+                rv = mX.insert(StringObj::value_type(KEY, "ignored"));
+
+                ASSERTV(i, !rv.second);
+                ASSERTV(i, VALUE == rv.first->second);
+                ASSERTV(i, oam.isTotalSame());
+                ASSERTV(i, i + 1 == static_cast<int>(X.size()));
+            }
+
+            ASSERT(X.load_factor() <= X.max_load_factor());
+
+            for (int i = 0; i < 2 * NUM_ELEMENTS; ++i) {
+                const bool PRESENT = i < NUM_ELEMENTS;
+
+                ASSERTV(i, PRESENT == (X.end() != X.find(longString(i))));
+                ASSERTV(i, PRESENT == (mX.end() != mX.find(longString(i))));
+                ASSERTV(i, PRESENT == X.contains(longString(i)));
+                ASSERTV(i, PRESENT == (1 == X.count(longString(i))));
+            }
+
+            for (int i = 0; i < NUM_ELEMENTS; i += 2) {
+                bsls::Types::Int64 numBlocks = oa.numBlocksInUse();
+
+                ASSERTV(i, 1 == mX.erase(longString(i)));
+                ASSERTV(i, 0 == mX.erase(longString(i)));
+                ASSERTV(i, !X.contains(longString(i)));
+
+                // The node and the two strings it holds are released.
+
+                ASSERTV(i, numBlocks - 3 == oa.numBlocksInUse());
+            }
+            ASSERT(NUM_ELEMENTS / 2 == static_cast<int>(X.size()));
+
+            const bsl::size_t CAPACITY = X.capacity();
+
+            mX.clear();
+
+            ASSERT(X.empty());
+            ASSERT(CAPACITY == X.capacity());
+            ASSERT(       2 == oa.numBlocksInUse());
+
+            mX.insert(StringObj::value_type(longString(0), longString(1)));
+            mX.reset();
+
+            ASSERT(X.empty());
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // ENTRY HANDLE
+        //
+        // Concerns:
+        // 1. Each value constructor allocates one node from the supplied
+        //    allocator, and constructs the element in it using that
+        //    allocator.
+        //
+        // 2. The extended copy constructor allocates a new node holding a
+        //    copy of the element.
+        //
+        // 3. The extended move constructor transfers the node when the
+        //    allocator is that of the node, and copies the element into a
+        //    new node otherwise.
+        //
+        // 4. The destructor releases the node and the memory of its element,
+        //    and a moved-from entry releases nothing.
+        //
+        // 5. The node-handle is the size of a pointer and is bitwise
+        //    moveable, so that a rehash of the table moves only pointers.
+        //
+        // Plan:
+        // 1. Construct entries with each constructor, using test allocators,
+        //    and verify the element and the allocator usage.  (C-1..4)
+        //
+        // 2. Verify the traits and size of the entry at compile time (see the
+        //    `BSLMF_ASSERT`s at file scope).  (C-5)
+        //
+        // Testing:
+        //   NodeHashMap_Entry(const value_type&, Allocator *);
+        //   NodeHashMap_Entry(KEY_TYPE&& key, MovableRef<VALUE>, Allocator *);
+        //   NodeHashMap_Entry(const NodeHashMap_Entry&, Allocator *);
+        //   NodeHashMap_Entry(MovableRef<NodeHashMap_Entry>, Allocator *);
+        //   ~NodeHashMap_Entry();
+        //   value_type& value() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ENTRY HANDLE" << endl
+                          << "============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const Entry::value_type VALUE(7, longString(7));
+        {
+            Entry mX(VALUE, &oa);  const Entry& X = mX;
+
+            ASSERT(VALUE == X.value());
+            ASSERT(&oa   == X.value().second.get_allocator().mechanism());
+            ASSERT(2     == oa.numBlocksInUse());
+
+            Entry mY(X, &sa);  const Entry& Y = mY;
+
+            ASSERT(VALUE       == Y.value());
+            ASSERT(&X.value()  != &Y.value());
+            ASSERT(&sa == Y.value().second.get_allocator().mechanism());
+            ASSERT(2           == sa.numBlocksInUse());
+
+            Entry::value_type *address = &X.value();
+
+            Entry mZ(bslmf::MovableRefUtil::move(mX), &oa);
+            const Entry& Z = mZ;
+
+            ASSERT(address == &Z.value());
+            ASSERT(2       == oa.numBlocksInUse());
+
+            Entry mW(bslmf::MovableRefUtil::move(mZ), &sa);
+            const Entry& W = mW;
+
+            ASSERT(VALUE   == W.value());
+            ASSERT(address != &W.value());
+            ASSERT(4       == sa.numBlocksInUse());
+            ASSERT(VALUE   == Z.value());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == sa.numBlocksInUse());
+
+        {
+            bsl::string mapped(longString(8), &sa);
+
+            Entry mX(8, bslmf::MovableRefUtil::move(mapped), &oa);
+            const Entry& X = mX;
+
+            ASSERT(8              == X.value().first);
+            ASSERT(longString(8)  == X.value().second);
+            ASSERT(&oa == X.value().second.get_allocator().mechanism());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Instantiate an object and verify basic functionality.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        ASSERT(      0 == X.size());
+        ASSERT(X.end() == X.find(0));
+
+        {
+            bsl::pair<Obj::iterator, bool> rv =
+                                               mX.insert(bsl::make_pair(0, 7));
+
+            ASSERT(       1 == X.size());
+            ASSERT(    true == rv.second);
+            ASSERT( X.end() != rv.first);
+            ASSERT(       0 == rv.first->first);
+            ASSERT(       7 == rv.first->second);
+            ASSERT(rv.first == X.find(0));
+            ASSERT( X.end() == X.find(1));
+        }
+
+        const int *address = &X.find(0)->second;
+
+        for (int i = 1; i < 100; ++i) {
+            mX[i] = i;
+        }
+        ASSERT(    100 == X.size());
+        ASSERT(address == &X.find(0)->second);
+
+        Obj mY(X, &oa);  const Obj& Y = mY;
+
+        ASSERT(  100 == Y.size());
+        ASSERT(    7 == Y.find(0)->second);
+        ASSERT(    X == Y);
+
+        ASSERT(    1 == mY.erase(0));
+        ASSERT(    X != Y);
+        ASSERT(   99 == Y.size());
+        ASSERT(Y.end() == Y.find(0));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // NODE HASH MAP BENCHMARK
+        //   Compare `bdlc::NodeHashMap` to `bsl::unordered_map` (implemented
+        //   by `bslstl::HashTable`) and to `bdlc::FlatHashMap`.
+        //
+        // Concerns:
+        // 1. The cost of insertion, successful and unsuccessful lookup, and
+        //    erasure can be measured for each container, for a map that fits
+        //    in the cache and for one that does not.
+        //
+        // Plan:
+        // 1. For each of the three containers, keyed by `int`, time inserting
+        //    a set of keys (without reserving capacity), finding each of them,
+        //    finding as many absent keys, and erasing each inserted key, and
+        //    report the median time per operation over several trials.  Time
+        //    `bdlc::NodeHashMap` a second time with a multipool allocator,
+        //    which pools the nodes as `bsl::unordered_map` does internally.
+        //    (C-1)
+        //
+        // Testing:
+        //   NODE HASH MAP BENCHMARK
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "NODE HASH MAP BENCHMARK" << endl
+                          << "=======================" << endl;
+
+        bslma::NewDeleteAllocator oa;
+
+        bslma::DefaultAllocatorGuard dag(&oa);
+
+        typedef bdlc::NodeHashMap<int, int>  NodeMap;
+        typedef bsl::unordered_map<int, int> UnorderedMap;
+        typedef bdlc::FlatHashMap<int, int>  FlatMap;
+
+        const int SIZES[]   = { 1 << 10, 1 << 20 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const int NUM_KEYS   = argc > 2 ? atoi(argv[2]) : SIZES[si];
+            const int NUM_TRIALS = NUM_KEYS < (1 << 16) ? 101 : 5;
+
+            bsl::vector<int> keys;
+            makeKeys(&keys, NUM_KEYS);
+
+            cout << "keys: " << NUM_KEYS << " (ns per operation)" << endl;
+            cout << setw(16) << "container"
+                 << setw(10) << "insert"
+                 << setw(10) << "hit"
+                 << setw(10) << "miss"
+                 << setw(10) << "erase" << endl;
+
+            printTimes("NodeHashMap",
+                       timeOperations<NodeMap>(keys, NUM_TRIALS));
+            {
+                bdlma::MultipoolAllocator    pool(&oa);
+                bslma::DefaultAllocatorGuard poolGuard(&pool);
+
+                printTimes("NodeHashMap/pool",
+                           timeOperations<NodeMap>(keys, NUM_TRIALS));
+            }
+            printTimes("unordered_map",
+                       timeOperations<UnorderedMap>(keys, NUM_TRIALS));
+            printTimes("FlatHashMap",
+                       timeOperations<FlatMap>(keys, NUM_TRIALS));
+
+            if (argc > 2) {
+                break;
+            }
+        }
+
+        if (veryVeryVeryVerbose) {
+            cout << "anti-optimization: " << s_antiOptimization << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    LOOP_ASSERT(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
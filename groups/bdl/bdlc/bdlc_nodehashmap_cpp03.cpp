@@ -0,0 +1,32 @@
+// bdlc_nodehashmap_cpp03.cpp                                         -*-C++-*-
+
+// Automatically generated file.  **DO NOT EDIT**
+
+// Generated on Mon Oct 19 10:12:41 2026
+// Command line: sim_cpp11_features.pl bdlc_nodehashmap.cpp
+
+#define INCLUDED_BDLC_NODEHASHMAP_CPP03  // Disable inclusion
+#include <bdlc_nodehashmap_cpp03.h>      // Pro-forma #include
+
+// Empty file except when compiling bdlc_nodehashmap.cpp
+#ifdef COMPILING_BDLC_NODEHASHMAP_CPP
+
+// No C++03 Expansion
+
+#endif // defined(COMPILING_BDLC_NODEHASHMAP_CPP)
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
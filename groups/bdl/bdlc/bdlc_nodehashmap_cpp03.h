@@ -0,0 +1,3797 @@
+// bdlc_nodehashmap_cpp03.h                                           -*-C++-*-
+
+// Automatically generated file.  **DO NOT EDIT**
+
+#ifndef INCLUDED_BDLC_NODEHASHMAP_CPP03
+#define INCLUDED_BDLC_NODEHASHMAP_CPP03
+
+//@PURPOSE: Provide C++03 implementation for bdlc_nodehashmap.h
+//
+//@CLASSES: See bdlc_nodehashmap.h for list of classes
+//
+//@SEE_ALSO: bdlc_nodehashmap
+//
+//@DESCRIPTION:  This component is the C++03 translation of a C++11 component,
+// generated by the 'sim_cpp11_features.pl' program.  If the original header
+// contains any specially delimited regions of C++11 code, then this generated
+// file contains the C++03 equivalent, i.e., with variadic templates expanded
+// and rvalue-references replaced by 'bslmf::MovableRef' objects.  The header
+// code in this file is designed to be '#include'd into the original header
+// when compiling with a C++03 compiler.  If there are no specially delimited
+// regions of C++11 code, then this header contains no code and is not
+// '#include'd in the original header.
+//
+// Generated on Mon Oct 19 10:12:41 2026
+// Command line: sim_cpp11_features.pl bdlc_nodehashmap.h
+
+#ifdef COMPILING_BDLC_NODEHASHMAP_H
+
+namespace BloombergLP {
+namespace bdlc {
+
+// FORWARD DECLARATIONS
+template <class KEY,
+          class VALUE,
+          class HASH  = bslh::FibonacciBadHashWrapper<bsl::hash<KEY> >,
+          class EQUAL = bsl::equal_to<KEY> >
+class NodeHashMap;
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator==(const NodeHashMap<KEY, VALUE, HASH, EQUAL> &lhs,
+                const NodeHashMap<KEY, VALUE, HASH, EQUAL> &rhs);
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator!=(const NodeHashMap<KEY, VALUE, HASH, EQUAL> &lhs,
+                const NodeHashMap<KEY, VALUE, HASH, EQUAL> &rhs);
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void swap(NodeHashMap<KEY, VALUE, HASH, EQUAL>& a,
+          NodeHashMap<KEY, VALUE, HASH, EQUAL>& b);
+
+                          // =======================
+                          // class NodeHashMap_Entry
+                          // =======================
+
+/// This component-private class template is the entry type of the
+/// `FlatHashTable` underlying a `NodeHashMap`.  An object of this type owns
+/// a node, allocated from the allocator supplied at construction, holding a
+/// `bsl::pair<const KEY, VALUE>` and the address of that allocator.  Moving
+/// an entry transfers the node rather than the pair, so the address of the
+/// pair does not change when the table rehashes.
+template <class KEY, class VALUE>
+class NodeHashMap_Entry {
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::pair<typename bsl::add_const<KEY>::type, VALUE> value_type;
+
+  private:
+    // PRIVATE TYPES
+
+    /// The separately allocated storage of an element.
+    struct Node {
+        bsls::ObjectBuffer<value_type>  d_value;        // element
+        bslma::Allocator               *d_allocator_p;  // node allocator
+    };
+
+    // DATA
+    Node *d_node_p;  // owned node (0 only after being moved from)
+
+    // NOT IMPLEMENTED
+    NodeHashMap_Entry& operator=(const NodeHashMap_Entry&);
+
+    // PRIVATE CLASS METHODS
+
+    /// Return the address of an uninitialized node allocated from the
+    /// specified `basicAllocator`.
+    static Node *allocateNode(bslma::Allocator *basicAllocator);
+
+    /// Return the address of a node allocated from the specified
+    /// `basicAllocator` and holding a copy of the specified `value`.
+    static Node *copyNode(const value_type&  value,
+                          bslma::Allocator  *basicAllocator);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(NodeHashMap_Entry,
+                                   bslma::UsesBslmaAllocator);
+    BSLMF_NESTED_TRAIT_DECLARATION(NodeHashMap_Entry,
+                                   bslmf::IsBitwiseMoveable);
+
+    // CREATORS
+
+    /// Create an entry owning a new node that holds a copy of the specified
+    /// `value`, using the specified `basicAllocator` to supply memory.
+    NodeHashMap_Entry(const value_type&  value,
+                      bslma::Allocator  *basicAllocator);
+
+    /// Create an entry owning a new node that holds the specified `key` and
+    /// the specified moved `value`, using the specified `basicAllocator` to
+    /// supply memory.
+    template <class KEY_TYPE>
+    NodeHashMap_Entry(
+                  BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key,
+                  bslmf::MovableRef<VALUE>                     value,
+                  bslma::Allocator                            *basicAllocator);
+
+#if BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// Command line: sim_cpp11_features.pl bdlc_nodehashmap.h
+#ifndef BDLC_NODEHASHMAP_VARIADIC_LIMIT
+#define BDLC_NODEHASHMAP_VARIADIC_LIMIT 10
+#endif
+#ifndef BDLC_NODEHASHMAP_VARIADIC_LIMIT_A
+#define BDLC_NODEHASHMAP_VARIADIC_LIMIT_A BDLC_NODEHASHMAP_VARIADIC_LIMIT
+#endif
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_A >= 0
+    explicit NodeHashMap_Entry(bslma::Allocator *basicAllocator);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_A >= 0
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_A >= 1
+    template <class ARGS_01>
+    explicit NodeHashMap_Entry(bslma::Allocator *basicAllocator,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_A >= 1
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_A >= 2
+    template <class ARGS_01,
+              class ARGS_02>
+    explicit NodeHashMap_Entry(bslma::Allocator *basicAllocator,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_A >= 2
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_A >= 3
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03>
+    explicit NodeHashMap_Entry(bslma::Allocator *basicAllocator,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_A >= 3
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_A >= 4
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04>
+    explicit NodeHashMap_Entry(bslma::Allocator *basicAllocator,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_A >= 4
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_A >= 5
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04,
+              class ARGS_05>
+    explicit NodeHashMap_Entry(bslma::Allocator *basicAllocator,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_A >= 5
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_A >= 6
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04,
+              class ARGS_05,
+              class ARGS_06>
+    explicit NodeHashMap_Entry(bslma::Allocator *basicAllocator,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_A >= 6
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_A >= 7
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04,
+              class ARGS_05,
+              class ARGS_06,
+              class ARGS_07>
+    explicit NodeHashMap_Entry(bslma::Allocator *basicAllocator,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_A >= 7
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_A >= 8
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04,
+              class ARGS_05,
+              class ARGS_06,
+              class ARGS_07,
+              class ARGS_08>
+    explicit NodeHashMap_Entry(bslma::Allocator *basicAllocator,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_08) args_08);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_A >= 8
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_A >= 9
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04,
+              class ARGS_05,
+              class ARGS_06,
+              class ARGS_07,
+              class ARGS_08,
+              class ARGS_09>
+    explicit NodeHashMap_Entry(bslma::Allocator *basicAllocator,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_08) args_08,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_09) args_09);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_A >= 9
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_A >= 10
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04,
+              class ARGS_05,
+              class ARGS_06,
+              class ARGS_07,
+              class ARGS_08,
+              class ARGS_09,
+              class ARGS_10>
+    explicit NodeHashMap_Entry(bslma::Allocator *basicAllocator,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_08) args_08,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_09) args_09,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_10) args_10);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_A >= 10
+
+#else
+// The generated code below is a workaround for the absence of perfect
+// forwarding in some compilers.
+    template <class... ARGS>
+    explicit NodeHashMap_Entry(bslma::Allocator *basicAllocator,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args);
+// }}} END GENERATED CODE
+#endif
+
+    /// Create an entry owning a new node that holds a copy of the element
+    /// of the specified `original`.  Optionally specify a `basicAllocator`
+    /// used to supply memory.  If `basicAllocator` is 0, the currently
+    /// installed default allocator is used.
+    NodeHashMap_Entry(const NodeHashMap_Entry&  original,
+                      bslma::Allocator         *basicAllocator = 0);
+
+    /// Create an entry owning the node of the specified `original` if the
+    /// optionally specified `basicAllocator` is the allocator of that node,
+    /// leaving `original` owning no node; otherwise, create an entry owning
+    /// a new node, allocated from `basicAllocator`, that holds a copy of the
+    /// element of `original`.  If `basicAllocator` is 0, the currently
+    /// installed default allocator is used.
+    NodeHashMap_Entry(
+                 bslmf::MovableRef<NodeHashMap_Entry>  original,
+                 bslma::Allocator                     *basicAllocator = 0);
+
+    /// Destroy this object and, if it owns one, its node.
+    ~NodeHashMap_Entry();
+
+    // ACCESSORS
+
+    /// Return a reference providing modifiable access to the element held
+    /// by the node of this entry.  The behavior is undefined unless this
+    /// entry owns a node.  Note that the element is not part of the value of
+    /// this (handle) object, hence this accessor is `const`.
+    value_type& value() const;
+};
+
+                       // ============================
+                       // struct NodeHashMap_EntryUtil
+                       // ============================
+
+/// This templated utility provides methods to construct a
+/// `NodeHashMap_Entry` and a method to extract the key from it, as required
+/// of the `ENTRY_UTIL` of a `FlatHashTable`.
+template <class KEY, class VALUE>
+struct NodeHashMap_EntryUtil
+{
+    // PUBLIC TYPES
+    typedef NodeHashMap_Entry<KEY, VALUE> Entry;
+
+    // CLASS METHODS
+
+    /// Load into the specified `entry` the `Entry` value constructed from
+    /// the specified `original`, using the specified `allocator` to supply
+    /// memory.
+    template <class ORIGINAL_TYPE>
+    static void construct(
+                  Entry                                            *entry,
+                  bslma::Allocator                                 *allocator,
+                  BSLS_COMPILERFEATURES_FORWARD_REF(ORIGINAL_TYPE)  original);
+
+    /// Load into the specified `entry` the `Entry` value comprised of the
+    /// specified `key` and a default constructed `VALUE`, using the
+    /// specified `allocator` to supply memory.
+    template <class KEY_TYPE>
+    static void constructFromKey(
+                        Entry                                       *entry,
+                        bslma::Allocator                            *allocator,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key);
+
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR
+    /// Load into the specified `entry` the `Entry` value whose key and
+    /// mapped value are constructed from the elements of the specified
+    /// `keyArgs` and `valueArgs` tuples respectively, using the specified
+    /// `allocator` to supply memory.
+    template <class KEY_ARGS, class VALUE_ARGS>
+    static void construct(Entry                      *entry,
+                          bslma::Allocator           *allocator,
+                          std::piecewise_construct_t,
+                          KEY_ARGS&&                  keyArgs,
+                          VALUE_ARGS&&                valueArgs);
+#endif
+
+    /// Return the key of the specified `entry`.
+    static const KEY& key(const Entry& entry);
+};
+
+                       // =============================
+                       // class NodeHashMap_IteratorImp
+                       // =============================
+
+/// This component-private class template adapts the iterator of the
+/// `FlatHashTable` underlying a `NodeHashMap` to refer to the elements held
+/// by the nodes of the (template parameter) `ENTRY` objects, rather than to
+/// those objects themselves.  It provides the operations required of the
+/// `ITER_IMP` of a `bslstl::ForwardIterator`.
+template <class ENTRY>
+class NodeHashMap_IteratorImp {
+
+    // PRIVATE TYPES
+    typedef FlatHashTable_IteratorImp<ENTRY> TableIteratorImp;
+
+    // DATA
+    TableIteratorImp d_imp;  // iterator over the entries of the table
+
+    // FRIENDS
+    template <class OTHER_ENTRY>
+    friend bool operator==(const NodeHashMap_IteratorImp<OTHER_ENTRY>&,
+                           const NodeHashMap_IteratorImp<OTHER_ENTRY>&);
+
+  public:
+    // CREATORS
+
+    /// Create a default-constructed iterator referring to the past-the-end
+    /// entry.
+    NodeHashMap_IteratorImp();
+
+    /// Create an iterator referring to the element of the entry referred to
+    /// by the specified `tableIterator`.
+    explicit NodeHashMap_IteratorImp(const TableIteratorImp& tableIterator);
+
+    //! NodeHashMap_IteratorImp(const NodeHashMap_IteratorImp& original) =
+    //!                                                                default;
+    //! ~NodeHashMap_IteratorImp() = default;
+
+    // MANIPULATORS
+    //! NodeHashMap_IteratorImp& operator=(
+    //!                          const NodeHashMap_IteratorImp& rhs) = default;
+
+    /// Advance this iterator to the next element.  The behavior is undefined
+    /// unless this iterator refers to an element.
+    void operator++();
+
+    // ACCESSORS
+
+    /// Return a reference to the element referred to by this iterator.  The
+    /// behavior is undefined unless this iterator refers to an element.
+    typename ENTRY::value_type& operator*() const;
+
+    /// Return the iterator over the entries of the underlying table that
+    /// refers to the entry holding the element referred to by this
+    /// iterator.
+    const TableIteratorImp& tableIterator() const;
+};
+
+// FREE OPERATORS
+
+/// Return `true` if the specified `lhs` and `rhs` refer to the same element,
+/// and `false` otherwise.
+template <class ENTRY>
+bool operator==(const NodeHashMap_IteratorImp<ENTRY>& lhs,
+                const NodeHashMap_IteratorImp<ENTRY>& rhs);
+
+                            // =================
+                            // class NodeHashMap
+                            // =================
+
+/// This class template implements a value-semantic container type holding
+/// an unordered map of `KEY-VALUE` pairs having unique keys that provides a
+/// mapping from keys of (template parameter) type `KEY` to their associated
+/// mapped values of (template parameter) type `VALUE`.  The (template
+/// parameter) type `HASH` is a functor providing the hash value for `KEY`.
+/// The (template parameter) type `EQUAL` is a functor providing the
+/// equality function for two `KEY` values.  See {Requirements on `KEY`,
+/// `HASH`, and `EQUAL`} for more information.  The elements of the map do
+/// not move in memory until they are erased.
+template <class KEY, class VALUE, class HASH, class EQUAL>
+class NodeHashMap {
+
+  private:
+    // PRIVATE TYPES
+    typedef NodeHashMap_Entry<KEY, VALUE>     Entry;
+    typedef NodeHashMap_EntryUtil<KEY, VALUE> EntryUtil;
+    typedef NodeHashMap_IteratorImp<Entry>    IteratorImp;
+
+    /// This is the underlying implementation class.
+    typedef FlatHashTable<KEY, Entry, EntryUtil, HASH, EQUAL> ImplType;
+
+    // FRIENDS
+    friend bool operator==<>(const NodeHashMap&, const NodeHashMap&);
+    friend bool operator!=<>(const NodeHashMap&, const NodeHashMap&);
+
+    // The following verbose declaration is required by the xlC 12.1 compiler.
+    template <class K, class V, class H, class E>
+    friend void swap(NodeHashMap<K, V, H, E>&, NodeHashMap<K, V, H, E>&);
+
+  public:
+    // PUBLIC TYPES
+    typedef typename Entry::value_type          value_type;
+
+    typedef KEY                                 key_type;
+    typedef VALUE                               mapped_type;
+    typedef bsl::size_t                         size_type;
+    typedef bsl::ptrdiff_t                      difference_type;
+    typedef EQUAL                               key_compare;
+    typedef HASH                                hasher;
+    typedef value_type&                         reference;
+    typedef const value_type&                   const_reference;
+    typedef value_type*                         pointer;
+    typedef const value_type*                   const_pointer;
+    typedef bslstl::ForwardIterator<value_type, IteratorImp>
+                                                iterator;
+    typedef bslstl::ForwardIterator<const value_type, IteratorImp>
+                                                const_iterator;
+
+  private:
+    // DATA
+    ImplType d_impl;  // underlying flat hash table of node handles
+
+    // PRIVATE CLASS METHODS
+
+    /// Return an iterator referring to the element of the entry referred to
+    /// by the specified `tableIterator`.
+    static iterator fromTable(
+                             const typename ImplType::iterator& tableIterator);
+
+    /// Return the iterator over the entries of the underlying table
+    /// referring to the entry holding the element referred to by the
+    /// specified `position`.
+    static typename ImplType::const_iterator toTable(
+                                               const const_iterator& position);
+
+  public:
+    // CREATORS
+
+    /// Create an empty `NodeHashMap` object.  Optionally specify a
+    /// `capacity` indicating the minimum initial size of the underlying
+    /// array of entries of this container.  If `capacity` is not supplied
+    /// or is 0, no memory is allocated.  Optionally specify a `hash`
+    /// functor used to generate the hash values associated with the keys of
+    /// elements in this container.  If `hash` is not supplied, a
+    /// default-constructed object of the (template parameter) type `HASH`
+    /// is used.  Optionally specify an equality functor `equal` used to
+    /// determine whether the keys of two elements are equivalent.  If
+    /// `equal` is not supplied, a default-constructed object of the
+    /// (template parameter) type `EQUAL` is used.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is not
+    /// supplied or is 0, the currently installed default allocator is used.
+    NodeHashMap();
+    explicit NodeHashMap(bslma::Allocator *basicAllocator);
+    explicit NodeHashMap(bsl::size_t capacity);
+    NodeHashMap(bsl::size_t capacity, bslma::Allocator *basicAllocator);
+    NodeHashMap(bsl::size_t       capacity,
+                const HASH&       hash,
+                bslma::Allocator *basicAllocator = 0);
+    NodeHashMap(bsl::size_t       capacity,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+
+    /// Create a `NodeHashMap` object initialized by insertion of the values
+    /// from the input iterator range specified by `first` through `last`
+    /// (including `first`, excluding `last`).  Optionally specify a
+    /// `capacity` indicating the minimum initial size of the underlying
+    /// array of entries of this container.  If `capacity` is not supplied
+    /// or is 0, no memory is allocated.  Optionally specify a `hash`
+    /// functor used to generate hash values associated with the keys of the
+    /// elements in this container.  If `hash` is not supplied, a
+    /// default-constructed object of the (template parameter) type `HASH`
+    /// is used.  Optionally specify an equality functor `equal` used to
+    /// determine whether the keys of two elements are equivalent.  If
+    /// `equal` is not supplied, a default-constructed object of the
+    /// (template parameter) type `EQUAL` is used.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is not
+    /// supplied or is 0, the currently installed default allocator is used.
+    /// The behavior is undefined unless `first` and `last` refer to a
+    /// sequence of valid values where `first` is at a position at or before
+    /// `last`.  Note that if a member of the input sequence has an
+    /// equivalent key to an earlier member, the later member will not be
+    /// inserted.
+    template <class INPUT_ITERATOR>
+    NodeHashMap(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    NodeHashMap(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bsl::size_t       capacity,
+                bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    NodeHashMap(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bsl::size_t       capacity,
+                const HASH&       hash,
+                bslma::Allocator *basicAllocator = 0);
+    template <class INPUT_ITERATOR>
+    NodeHashMap(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bsl::size_t       capacity,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    /// Create a `NodeHashMap` object initialized by insertion of the
+    /// specified `values`.  Optionally specify a `capacity` indicating the
+    /// minimum initial size of the underlying array of entries of this
+    /// container.  If `capacity` is not supplied or is 0, no memory is
+    /// allocated.  Optionally specify a `basicAllocator` used to supply
+    /// memory.  If `basicAllocator` is not supplied or is 0, the currently
+    /// installed default allocator is used.  Note that if a member of
+    /// `values` has an equivalent key to an earlier member, the later
+    /// member will not be inserted.
+    NodeHashMap(bsl::initializer_list<value_type>  values,
+                bslma::Allocator                  *basicAllocator = 0);
+    NodeHashMap(bsl::initializer_list<value_type>  values,
+                bsl::size_t                        capacity,
+                bslma::Allocator                  *basicAllocator = 0);
+#endif
+
+    /// Create a `NodeHashMap` object having the same value, hasher, and
+    /// equality comparator as the specified `original` object.  Optionally
+    /// specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is not specified or is 0, the currently installed
+    /// default allocator is used.
+    NodeHashMap(const NodeHashMap&  original,
+                bslma::Allocator   *basicAllocator = 0);
+
+    /// Create a `NodeHashMap` object having the same value, hasher,
+    /// equality comparator, and allocator as the specified `original`
+    /// object.  The contents of `original` are moved (in constant time) to
+    /// this object, `original` is left in a (valid) unspecified state, and
+    /// no exceptions will be thrown.  Note that pointers and references to
+    /// the elements of `original` refer to the same elements of this object.
+    NodeHashMap(bslmf::MovableRef<NodeHashMap> original);
+
+    /// Create a `NodeHashMap` object having the same value, hasher, and
+    /// equality comparator as the specified `original` object, using the
+    /// specified `basicAllocator` to supply memory.  If `basicAllocator` is
+    /// 0, the currently installed default allocator is used.  The allocator
+    /// of `original` remains unchanged.  If `original` and the newly
+    /// created object have the same allocator then the contents of
+    /// `original` are moved (in constant time) to this object, `original`
+    /// is left in a (valid) unspecified state, and no exceptions will be
+    /// thrown; otherwise, `original` is unchanged (and an exception may be
+    /// thrown).
+    NodeHashMap(bslmf::MovableRef<NodeHashMap>  original,
+                bslma::Allocator               *basicAllocator);
+
+    /// Destroy this object and each of its elements.
+    ~NodeHashMap();
+
+    // MANIPULATORS
+
+    /// Assign to this object the value, hasher, and equality functor of the
+    /// specified `rhs` object, and return a reference providing modifiable
+    /// access to this object.
+    NodeHashMap& operator=(const NodeHashMap& rhs);
+
+    /// Assign to this object the value, hasher, and equality comparator of
+    /// the specified `rhs` object, and return a reference providing
+    /// modifiable access to this object.  If this object and `rhs` use the
+    /// same allocator the contents of `rhs` are moved (in constant time) to
+    /// this object.  `rhs` is left in a (valid) unspecified state.
+    NodeHashMap& operator=(bslmf::MovableRef<NodeHashMap> rhs);
+
+    /// Return a reference providing modifiable access to the mapped value
+    /// associated with the specified `key` in this map.  If this map does
+    /// not already contain an element having `key`, insert an element with
+    /// the `key` and a default-constructed `VALUE`, and return a reference
+    /// to the newly mapped value.  If `key` is movable, `key` is left in a
+    /// (valid) unspecified state.
+    template <class KEY_TYPE>
+    VALUE& operator[](BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) key);
+
+    /// Return a reference providing modifiable access to the mapped value
+    /// associated with the specified `key` in this map, if such an entry
+    /// exists; otherwise throw a `std::out_of_range` exception.  Note that
+    /// this method is not exception-neutral.
+    VALUE& at(const KEY& key);
+
+    /// Remove all elements from this map.  Note that this map will be empty
+    /// after calling this method, but allocated memory may be retained for
+    /// future use.  See the `capacity` method.
+    void clear();
+
+#if BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// Command line: sim_cpp11_features.pl bdlc_nodehashmap.h
+#ifndef BDLC_NODEHASHMAP_VARIADIC_LIMIT
+#define BDLC_NODEHASHMAP_VARIADIC_LIMIT 10
+#endif
+#ifndef BDLC_NODEHASHMAP_VARIADIC_LIMIT_B
+#define BDLC_NODEHASHMAP_VARIADIC_LIMIT_B BDLC_NODEHASHMAP_VARIADIC_LIMIT
+#endif
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_B >= 0
+    bsl::pair<iterator, bool> emplace();
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_B >= 0
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_B >= 1
+    template <class ARGS_01>
+    bsl::pair<iterator, bool> emplace(
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_B >= 1
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_B >= 2
+    template <class ARGS_01,
+              class ARGS_02>
+    bsl::pair<iterator, bool> emplace(
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_B >= 2
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_B >= 3
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03>
+    bsl::pair<iterator, bool> emplace(
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_B >= 3
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_B >= 4
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04>
+    bsl::pair<iterator, bool> emplace(
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_B >= 4
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_B >= 5
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04,
+              class ARGS_05>
+    bsl::pair<iterator, bool> emplace(
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_B >= 5
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_B >= 6
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04,
+              class ARGS_05,
+              class ARGS_06>
+    bsl::pair<iterator, bool> emplace(
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_B >= 6
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_B >= 7
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04,
+              class ARGS_05,
+              class ARGS_06,
+              class ARGS_07>
+    bsl::pair<iterator, bool> emplace(
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_B >= 7
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_B >= 8
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04,
+              class ARGS_05,
+              class ARGS_06,
+              class ARGS_07,
+              class ARGS_08>
+    bsl::pair<iterator, bool> emplace(
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_08) args_08);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_B >= 8
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_B >= 9
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04,
+              class ARGS_05,
+              class ARGS_06,
+              class ARGS_07,
+              class ARGS_08,
+              class ARGS_09>
+    bsl::pair<iterator, bool> emplace(
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_08) args_08,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_09) args_09);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_B >= 9
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_B >= 10
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04,
+              class ARGS_05,
+              class ARGS_06,
+              class ARGS_07,
+              class ARGS_08,
+              class ARGS_09,
+              class ARGS_10>
+    bsl::pair<iterator, bool> emplace(
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_08) args_08,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_09) args_09,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_10) args_10);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_B >= 10
+
+#else
+// The generated code below is a workaround for the absence of perfect
+// forwarding in some compilers.
+    template <class... ARGS>
+    bsl::pair<iterator, bool> emplace(
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args);
+// }}} END GENERATED CODE
+#endif
+
+    /// Return a pair of iterators defining the sequence of modifiable
+    /// elements in this map having the specified `key`, where the first
+    /// iterator is positioned at the start of the sequence and the second
+    /// iterator is positioned one past the end of the sequence.  If this map
+    /// contains no elements having a key equivalent to `key`, then the two
+    /// returned iterators will have the same value.  Note that since a map
+    /// maintains unique keys, the range will contain at most one element.
+    bsl::pair<iterator, iterator> equal_range(const KEY& key);
+
+    /// Remove from this map the element whose key is equal to the specified
+    /// `key`, if it exists, and return 1; otherwise (there is no element
+    /// having `key` in this map), return 0 with no other effect.  This
+    /// method invalidates all iterators, pointers, and references to the
+    /// removed element.
+    bsl::size_t erase(const KEY& key);
+
+    /// Remove from this map the element at the specified `position`, and
+    /// return the iterator referring to the modifiable element immediately
+    /// following the removed element, or to the past-the-end position if
+    /// the removed element was the last element in the sequence of elements
+    /// maintained by this map.  This method invalidates all iterators,
+    /// pointers, and references to the removed element.  The behavior is
+    /// undefined unless `position` refers to an element in this map.
+    iterator erase(const_iterator position);
+    iterator erase(iterator position);
+
+    /// Remove from this map the elements starting at the specified `first`
+    /// position up to, but not including, the specified `last` position,
+    /// and return `last`.  This method invalidates all iterators, pointers,
+    /// and references to the removed elements.  The behavior is undefined
+    /// unless `first` and `last` are valid iterators on this map, and the
+    /// `first` position is at or before the `last` position in the
+    /// iteration sequence provided by this container.
+    iterator erase(const_iterator first, const_iterator last);
+
+    /// Return an iterator referring to the modifiable element in this map
+    /// having the specified `key`, or `end()` if no such entry exists in
+    /// this map.
+    iterator find(const KEY& key);
+
+    /// Insert the specified `value` into this map if the key (the `first`
+    /// element) of `value` does not already exist in this map; otherwise,
+    /// this method has no effect (and, in particular, allocates no node).
+    /// Return a `pair` whose `first` member is an iterator referring to the
+    /// (possibly newly inserted) modifiable element in this map whose key is
+    /// equivalent to that of the element to be inserted, and whose `second`
+    /// member is `true` if a new element was inserted, and `false` if the
+    /// key was already present.
+    bsl::pair<iterator, bool> insert(const value_type& value);
+
+    /// Insert into this map the value of each element in the input iterator
+    /// range specified by `first` through `last` (including `first`,
+    /// excluding `last`).  The behavior is undefined unless `first` and
+    /// `last` refer to a sequence of valid values where `first` is at a
+    /// position at or before `last`.  Note that if the key of a member of
+    /// the input sequence is equivalent to the key of an earlier member (or
+    /// an element already in this map), the later member will not be
+    /// inserted.
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    /// Insert into this map an element having the value of each object in
+    /// the specified `values` initializer list if a value with an
+    /// equivalent key is not already contained in this map.  This method
+    /// requires that the (template parameter) types `KEY` and `VALUE` both
+    /// be copy-insertable.
+    void insert(bsl::initializer_list<value_type> values);
+#endif
+
+    /// Change the capacity of this map to at least the specified
+    /// `minimumCapacity`, and redistribute all the contained elements into
+    /// the new sequence of entries, according to their hash values.  If
+    /// `0 == minimumCapacity` and `0 == size()`, the map is returned to the
+    /// default constructed state.  After this call, `load_factor()` will be
+    /// less than or equal to `max_load_factor()`.  This method invalidates
+    /// all iterators, but no pointers or references, to elements of this
+    /// map.
+    void rehash(bsl::size_t minimumCapacity);
+
+    /// Change the capacity of this map to at least a capacity that can
+    /// accommodate the specified `numEntries` (accounting for the load
+    /// factor invariant), and redistribute all the contained elements into
+    /// the new sequence of entries, according to their hash values.  If
+    /// `0 == numEntries` and `0 == size()`, the map is returned to the
+    /// default constructed state.  After this call, `load_factor()` will be
+    /// less than or equal to `max_load_factor()`.  This method invalidates
+    /// all iterators, but no pointers or references, to elements of this
+    /// map.
+    void reserve(bsl::size_t numEntries);
+
+    /// Remove all elements from this map and release all memory from this
+    /// map, returning the map to the default constructed state.
+    void reset();
+
+#if BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// Command line: sim_cpp11_features.pl bdlc_nodehashmap.h
+#ifndef BDLC_NODEHASHMAP_VARIADIC_LIMIT
+#define BDLC_NODEHASHMAP_VARIADIC_LIMIT 10
+#endif
+#ifndef BDLC_NODEHASHMAP_VARIADIC_LIMIT_C
+#define BDLC_NODEHASHMAP_VARIADIC_LIMIT_C BDLC_NODEHASHMAP_VARIADIC_LIMIT
+#endif
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 0
+    bsl::pair<iterator, bool> try_emplace(const KEY& key);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 0
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 1
+    template <class ARGS_01>
+    bsl::pair<iterator, bool> try_emplace(const KEY& key,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 1
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 2
+    template <class ARGS_01,
+              class ARGS_02>
+    bsl::pair<iterator, bool> try_emplace(const KEY& key,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 2
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 3
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03>
+    bsl::pair<iterator, bool> try_emplace(const KEY& key,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 3
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 4
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04>
+    bsl::pair<iterator, bool> try_emplace(const KEY& key,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 4
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 5
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04,
+              class ARGS_05>
+    bsl::pair<iterator, bool> try_emplace(const KEY& key,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 5
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 6
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04,
+              class ARGS_05,
+              class ARGS_06>
+    bsl::pair<iterator, bool> try_emplace(const KEY& key,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 6
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 7
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04,
+              class ARGS_05,
+              class ARGS_06,
+              class ARGS_07>
+    bsl::pair<iterator, bool> try_emplace(const KEY& key,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 7
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 8
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04,
+              class ARGS_05,
+              class ARGS_06,
+              class ARGS_07,
+              class ARGS_08>
+    bsl::pair<iterator, bool> try_emplace(const KEY& key,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_08) args_08);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 8
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 9
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04,
+              class ARGS_05,
+              class ARGS_06,
+              class ARGS_07,
+              class ARGS_08,
+              class ARGS_09>
+    bsl::pair<iterator, bool> try_emplace(const KEY& key,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_08) args_08,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_09) args_09);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 9
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 10
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04,
+              class ARGS_05,
+              class ARGS_06,
+              class ARGS_07,
+              class ARGS_08,
+              class ARGS_09,
+              class ARGS_10>
+    bsl::pair<iterator, bool> try_emplace(const KEY& key,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_08) args_08,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_09) args_09,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_10) args_10);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 10
+
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 0
+    bsl::pair<iterator, bool> try_emplace(
+                                     BloombergLP::bslmf::MovableRef<KEY> key);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 0
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 1
+    template <class ARGS_01>
+    bsl::pair<iterator, bool> try_emplace(
+                                     BloombergLP::bslmf::MovableRef<KEY> key,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 1
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 2
+    template <class ARGS_01,
+              class ARGS_02>
+    bsl::pair<iterator, bool> try_emplace(
+                                     BloombergLP::bslmf::MovableRef<KEY> key,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 2
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 3
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03>
+    bsl::pair<iterator, bool> try_emplace(
+                                     BloombergLP::bslmf::MovableRef<KEY> key,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 3
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 4
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04>
+    bsl::pair<iterator, bool> try_emplace(
+                                     BloombergLP::bslmf::MovableRef<KEY> key,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 4
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 5
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04,
+              class ARGS_05>
+    bsl::pair<iterator, bool> try_emplace(
+                                     BloombergLP::bslmf::MovableRef<KEY> key,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 5
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 6
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04,
+              class ARGS_05,
+              class ARGS_06>
+    bsl::pair<iterator, bool> try_emplace(
+                                     BloombergLP::bslmf::MovableRef<KEY> key,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 6
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 7
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04,
+              class ARGS_05,
+              class ARGS_06,
+              class ARGS_07>
+    bsl::pair<iterator, bool> try_emplace(
+                                     BloombergLP::bslmf::MovableRef<KEY> key,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 7
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 8
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04,
+              class ARGS_05,
+              class ARGS_06,
+              class ARGS_07,
+              class ARGS_08>
+    bsl::pair<iterator, bool> try_emplace(
+                                     BloombergLP::bslmf::MovableRef<KEY> key,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_08) args_08);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 8
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 9
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04,
+              class ARGS_05,
+              class ARGS_06,
+              class ARGS_07,
+              class ARGS_08,
+              class ARGS_09>
+    bsl::pair<iterator, bool> try_emplace(
+                                     BloombergLP::bslmf::MovableRef<KEY> key,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_08) args_08,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_09) args_09);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 9
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 10
+    template <class ARGS_01,
+              class ARGS_02,
+              class ARGS_03,
+              class ARGS_04,
+              class ARGS_05,
+              class ARGS_06,
+              class ARGS_07,
+              class ARGS_08,
+              class ARGS_09,
+              class ARGS_10>
+    bsl::pair<iterator, bool> try_emplace(
+                                     BloombergLP::bslmf::MovableRef<KEY> key,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_08) args_08,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_09) args_09,
+                           BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_10) args_10);
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_C >= 10
+
+#endif   // BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR
+#else
+// The generated code below is a workaround for the absence of perfect
+// forwarding in some compilers.
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR
+    template <class... ARGS>
+    bsl::pair<iterator, bool> try_emplace(const KEY& key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args);
+
+    template <class... ARGS>
+    bsl::pair<iterator, bool> try_emplace(
+                                     BloombergLP::bslmf::MovableRef<KEY> key,
+                              BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args);
+#endif   // BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR
+// }}} END GENERATED CODE
+#endif
+
+                          // Iterators
+
+    /// Return an iterator to the first element in the sequence of
+    /// modifiable elements maintained by this map, or the `end` iterator if
+    /// this map is empty.
+    iterator begin();
+
+    /// Return an iterator to the past-the-end element in the sequence of
+    /// modifiable elements maintained by this map.
+    iterator end();
+
+                             // Aspects
+
+    /// Exchange the value of this object as well as its hasher and equality
+    /// functors with those of the specified `other` object.  The behavior
+    /// is undefined unless this object was created with the same allocator
+    /// as `other`.  Note that pointers and references to elements remain
+    /// valid and refer to the same elements, now in the other map.
+    void swap(NodeHashMap& other);
+
+    // ACCESSORS
+
+    /// Return a `const` reference to the mapped value associated with the
+    /// specified `key` in this map, if such an entry exists; otherwise throw
+    /// a `std::out_of_range` exception.  Note that this method is not
+    /// exception-neutral.
+    const VALUE& at(const KEY& key) const;
+
+    /// Return the number of elements this map could hold if the load factor
+    /// were 1.
+    bsl::size_t capacity() const;
+
+    /// Return `true` if this map contains an element having the specified
+    /// `key`, and `false` otherwise.
+    bool contains(const KEY& key) const;
+
+    /// Return the number of elements in this map having the specified
+    /// `key`.  Note that since a flat hash map maintains unique keys, the
+    /// returned value will be either 0 or 1.
+    bsl::size_t count(const KEY& key) const;
+
+    /// Return `true` if this map contains no elements, and `false`
+    /// otherwise.
+    bool empty() const;
+
+    /// Return a pair of `const_iterator`s defining the sequence of elements
+    /// in this map having the specified `key`, where the first iterator is
+    /// positioned at the start of the sequence and the second iterator is
+    /// positioned one past the end of the sequence.  If this map contains
+    /// no elements having a key equivalent to `key`, then the two returned
+    /// iterators will have the same value.  Note that since a map maintains
+    /// unique keys, the range will contain at most one element.
+    bsl::pair<const_iterator, const_iterator> equal_range(
+                                                         const KEY& key) const;
+
+    /// Return a `const_iterator` referring to the element in this map
+    /// having the specified `key`, or `end()` if no such entry exists in
+    /// this map.
+    const_iterator find(const KEY& key) const;
+
+    /// Return (a copy of) the unary hash functor used by this map to
+    /// generate a hash value (of type `bsl::size_t`) for a `KEY` object.
+    HASH hash_function() const;
+
+    /// Return (a copy of) the binary key-equality functor that returns
+    /// `true` if the value of two `KEY` objects are equivalent, and `false`
+    /// otherwise.
+    EQUAL key_eq() const;
+
+    /// Return the current ratio between the number of elements in this
+    /// container and its capacity.
+    float load_factor() const;
+
+    /// Return the maximum load factor allowed for this map.  Note that if an
+    /// insert operation would cause the load factor to exceed
+    /// `max_load_factor()`, that same insert operation will increase the
+    /// capacity and rehash the entries of the container (see {Load Factor
+    /// and Resizing} in `bdlc_flathashmap`).  Also note that the value
+    /// returned by `max_load_factor` is implementation defined and cannot
+    /// be changed by the user.
+    float max_load_factor() const;
+
+    /// Return the number of elements in this map.
+    bsl::size_t size() const;
+
+                          // Iterators
+
+    /// Return a `const_iterator` to the first element in the sequence of
+    /// elements maintained by this map, or the `end` iterator if this map
+    /// is empty.
+    const_iterator begin() const;
+
+    /// Return a `const_iterator` to the first element in the sequence of
+    /// elements maintained by this map, or the `end` iterator if this map
+    /// is empty.
+    const_iterator cbegin() const;
+
+    /// Return a `const_iterator` to the past-the-end element in the
+    /// sequence of elements maintained by this map.
+    const_iterator cend() const;
+
+    /// Return a `const_iterator` to the past-the-end element in the
+    /// sequence of elements maintained by this map.
+    const_iterator end() const;
+
+                           // Aspects
+
+    /// Return the allocator used by this map to supply memory.
+    bslma::Allocator *allocator() const;
+};
+
+// FREE OPERATORS
+
+/// Return `true` if the specified `lhs` and `rhs` objects have the same
+/// value, and `false` otherwise.  Two `NodeHashMap` objects have the same
+/// value if their sizes are the same and each element contained in one is
+/// equal to an element of the other.  The hash and equality functors are
+/// not involved in the comparison.
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator==(const NodeHashMap<KEY, VALUE, HASH, EQUAL> &lhs,
+                const NodeHashMap<KEY, VALUE, HASH, EQUAL> &rhs);
+
+/// Return `true` if the specified `lhs` and `rhs` objects do not have the
+/// same value, and `false` otherwise.  Two `NodeHashMap` objects do not
+/// have the same value if their sizes are different or one contains an
+/// element equal to no element of the other.  The hash and equality
+/// functors are not involved in the comparison.
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator!=(const NodeHashMap<KEY, VALUE, HASH, EQUAL> &lhs,
+                const NodeHashMap<KEY, VALUE, HASH, EQUAL> &rhs);
+
+// FREE FUNCTIONS
+
+/// Exchange the value, the hasher, and the key-equality functor of the
+/// specified `a` and `b` objects.  This function provides the no-throw
+/// exception-safety guarantee if the two objects were created with the same
+/// allocator and the basic guarantee otherwise.
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void swap(NodeHashMap<KEY, VALUE, HASH, EQUAL>& a,
+          NodeHashMap<KEY, VALUE, HASH, EQUAL>& b);
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class NodeHashMap_Entry
+                          // -----------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class VALUE>
+inline
+typename NodeHashMap_Entry<KEY, VALUE>::Node *
+NodeHashMap_Entry<KEY, VALUE>::allocateNode(bslma::Allocator *basicAllocator)
+{
+    Node *node = static_cast<Node *>(basicAllocator->allocate(sizeof(Node)));
+    node->d_allocator_p = basicAllocator;
+    return node;
+}
+
+template <class KEY, class VALUE>
+typename NodeHashMap_Entry<KEY, VALUE>::Node *
+NodeHashMap_Entry<KEY, VALUE>::copyNode(const value_type&  value,
+                                        bslma::Allocator  *basicAllocator)
+{
+    Node *node = allocateNode(basicAllocator);
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(node,
+                                                        basicAllocator);
+
+    bslma::ConstructionUtil::construct(node->d_value.address(),
+                                       basicAllocator,
+                                       value);
+    proctor.release();
+
+    return node;
+}
+
+// CREATORS
+template <class KEY, class VALUE>
+inline
+NodeHashMap_Entry<KEY, VALUE>::NodeHashMap_Entry(
+                                            const value_type&  value,
+                                            bslma::Allocator  *basicAllocator)
+: d_node_p(copyNode(value, basicAllocator))
+{
+}
+
+template <class KEY, class VALUE>
+template <class KEY_TYPE>
+NodeHashMap_Entry<KEY, VALUE>::NodeHashMap_Entry(
+                  BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key,
+                  bslmf::MovableRef<VALUE>                     value,
+                  bslma::Allocator                            *basicAllocator)
+: d_node_p(allocateNode(basicAllocator))
+{
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(d_node_p,
+                                                        basicAllocator);
+
+    bslma::ConstructionUtil::construct(
+                                  d_node_p->d_value.address(),
+                                  basicAllocator,
+                                  BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key),
+                                  bslmf::MovableRefUtil::move(value));
+    proctor.release();
+}
+
+#if BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// Command line: sim_cpp11_features.pl bdlc_nodehashmap.h
+#ifndef BDLC_NODEHASHMAP_VARIADIC_LIMIT
+#define BDLC_NODEHASHMAP_VARIADIC_LIMIT 10
+#endif
+#ifndef BDLC_NODEHASHMAP_VARIADIC_LIMIT_D
+#define BDLC_NODEHASHMAP_VARIADIC_LIMIT_D BDLC_NODEHASHMAP_VARIADIC_LIMIT
+#endif
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_D >= 0
+template <class KEY, class VALUE>
+NodeHashMap_Entry<KEY, VALUE>::NodeHashMap_Entry(
+                                            bslma::Allocator *basicAllocator)
+: d_node_p(allocateNode(basicAllocator))
+{
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(d_node_p,
+                                                        basicAllocator);
+
+    bslma::ConstructionUtil::construct(
+                                 d_node_p->d_value.address(),
+                                 basicAllocator);
+    proctor.release();
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_D >= 0
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_D >= 1
+template <class KEY, class VALUE>
+template <class ARGS_01>
+NodeHashMap_Entry<KEY, VALUE>::NodeHashMap_Entry(
+                                            bslma::Allocator *basicAllocator,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01)
+: d_node_p(allocateNode(basicAllocator))
+{
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(d_node_p,
+                                                        basicAllocator);
+
+    bslma::ConstructionUtil::construct(
+                                 d_node_p->d_value.address(),
+                                 basicAllocator,
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01));
+    proctor.release();
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_D >= 1
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_D >= 2
+template <class KEY, class VALUE>
+template <class ARGS_01,
+          class ARGS_02>
+NodeHashMap_Entry<KEY, VALUE>::NodeHashMap_Entry(
+                                            bslma::Allocator *basicAllocator,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02)
+: d_node_p(allocateNode(basicAllocator))
+{
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(d_node_p,
+                                                        basicAllocator);
+
+    bslma::ConstructionUtil::construct(
+                                 d_node_p->d_value.address(),
+                                 basicAllocator,
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02));
+    proctor.release();
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_D >= 2
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_D >= 3
+template <class KEY, class VALUE>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03>
+NodeHashMap_Entry<KEY, VALUE>::NodeHashMap_Entry(
+                                            bslma::Allocator *basicAllocator,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03)
+: d_node_p(allocateNode(basicAllocator))
+{
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(d_node_p,
+                                                        basicAllocator);
+
+    bslma::ConstructionUtil::construct(
+                                 d_node_p->d_value.address(),
+                                 basicAllocator,
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03));
+    proctor.release();
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_D >= 3
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_D >= 4
+template <class KEY, class VALUE>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04>
+NodeHashMap_Entry<KEY, VALUE>::NodeHashMap_Entry(
+                                            bslma::Allocator *basicAllocator,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04)
+: d_node_p(allocateNode(basicAllocator))
+{
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(d_node_p,
+                                                        basicAllocator);
+
+    bslma::ConstructionUtil::construct(
+                                 d_node_p->d_value.address(),
+                                 basicAllocator,
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04));
+    proctor.release();
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_D >= 4
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_D >= 5
+template <class KEY, class VALUE>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04,
+          class ARGS_05>
+NodeHashMap_Entry<KEY, VALUE>::NodeHashMap_Entry(
+                                            bslma::Allocator *basicAllocator,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05)
+: d_node_p(allocateNode(basicAllocator))
+{
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(d_node_p,
+                                                        basicAllocator);
+
+    bslma::ConstructionUtil::construct(
+                                 d_node_p->d_value.address(),
+                                 basicAllocator,
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_05, args_05));
+    proctor.release();
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_D >= 5
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_D >= 6
+template <class KEY, class VALUE>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04,
+          class ARGS_05,
+          class ARGS_06>
+NodeHashMap_Entry<KEY, VALUE>::NodeHashMap_Entry(
+                                            bslma::Allocator *basicAllocator,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06)
+: d_node_p(allocateNode(basicAllocator))
+{
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(d_node_p,
+                                                        basicAllocator);
+
+    bslma::ConstructionUtil::construct(
+                                 d_node_p->d_value.address(),
+                                 basicAllocator,
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_05, args_05),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_06, args_06));
+    proctor.release();
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_D >= 6
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_D >= 7
+template <class KEY, class VALUE>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04,
+          class ARGS_05,
+          class ARGS_06,
+          class ARGS_07>
+NodeHashMap_Entry<KEY, VALUE>::NodeHashMap_Entry(
+                                            bslma::Allocator *basicAllocator,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07)
+: d_node_p(allocateNode(basicAllocator))
+{
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(d_node_p,
+                                                        basicAllocator);
+
+    bslma::ConstructionUtil::construct(
+                                 d_node_p->d_value.address(),
+                                 basicAllocator,
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_05, args_05),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_06, args_06),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_07, args_07));
+    proctor.release();
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_D >= 7
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_D >= 8
+template <class KEY, class VALUE>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04,
+          class ARGS_05,
+          class ARGS_06,
+          class ARGS_07,
+          class ARGS_08>
+NodeHashMap_Entry<KEY, VALUE>::NodeHashMap_Entry(
+                                            bslma::Allocator *basicAllocator,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_08) args_08)
+: d_node_p(allocateNode(basicAllocator))
+{
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(d_node_p,
+                                                        basicAllocator);
+
+    bslma::ConstructionUtil::construct(
+                                 d_node_p->d_value.address(),
+                                 basicAllocator,
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_05, args_05),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_06, args_06),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_07, args_07),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_08, args_08));
+    proctor.release();
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_D >= 8
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_D >= 9
+template <class KEY, class VALUE>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04,
+          class ARGS_05,
+          class ARGS_06,
+          class ARGS_07,
+          class ARGS_08,
+          class ARGS_09>
+NodeHashMap_Entry<KEY, VALUE>::NodeHashMap_Entry(
+                                            bslma::Allocator *basicAllocator,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_08) args_08,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_09) args_09)
+: d_node_p(allocateNode(basicAllocator))
+{
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(d_node_p,
+                                                        basicAllocator);
+
+    bslma::ConstructionUtil::construct(
+                                 d_node_p->d_value.address(),
+                                 basicAllocator,
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_05, args_05),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_06, args_06),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_07, args_07),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_08, args_08),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_09, args_09));
+    proctor.release();
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_D >= 9
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_D >= 10
+template <class KEY, class VALUE>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04,
+          class ARGS_05,
+          class ARGS_06,
+          class ARGS_07,
+          class ARGS_08,
+          class ARGS_09,
+          class ARGS_10>
+NodeHashMap_Entry<KEY, VALUE>::NodeHashMap_Entry(
+                                            bslma::Allocator *basicAllocator,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_08) args_08,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_09) args_09,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_10) args_10)
+: d_node_p(allocateNode(basicAllocator))
+{
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(d_node_p,
+                                                        basicAllocator);
+
+    bslma::ConstructionUtil::construct(
+                                 d_node_p->d_value.address(),
+                                 basicAllocator,
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_05, args_05),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_06, args_06),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_07, args_07),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_08, args_08),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_09, args_09),
+                              BSLS_COMPILERFEATURES_FORWARD(ARGS_10, args_10));
+    proctor.release();
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_D >= 10
+
+#else
+// The generated code below is a workaround for the absence of perfect
+// forwarding in some compilers.
+template <class KEY, class VALUE>
+template <class... ARGS>
+NodeHashMap_Entry<KEY, VALUE>::NodeHashMap_Entry(
+                                            bslma::Allocator *basicAllocator,
+                               BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args)
+: d_node_p(allocateNode(basicAllocator))
+{
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(d_node_p,
+                                                        basicAllocator);
+
+    bslma::ConstructionUtil::construct(
+                                 d_node_p->d_value.address(),
+                                 basicAllocator,
+                                 BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+    proctor.release();
+}
+// }}} END GENERATED CODE
+#endif
+
+template <class KEY, class VALUE>
+inline
+NodeHashMap_Entry<KEY, VALUE>::NodeHashMap_Entry(
+                                    const NodeHashMap_Entry&  original,
+                                    bslma::Allocator         *basicAllocator)
+: d_node_p(copyNode(original.value(),
+                    bslma::Default::allocator(basicAllocator)))
+{
+}
+
+template <class KEY, class VALUE>
+NodeHashMap_Entry<KEY, VALUE>::NodeHashMap_Entry(
+                        bslmf::MovableRef<NodeHashMap_Entry>  original,
+                        bslma::Allocator                     *basicAllocator)
+: d_node_p(0)
+{
+    NodeHashMap_Entry& lvalue = original;
+
+    BSLS_ASSERT_SAFE(lvalue.d_node_p);
+
+    bslma::Allocator *allocator = bslma::Default::allocator(basicAllocator);
+
+    if (lvalue.d_node_p->d_allocator_p == allocator) {
+        d_node_p        = lvalue.d_node_p;
+        lvalue.d_node_p = 0;
+    }
+    else {
+        d_node_p = copyNode(lvalue.value(), allocator);
+    }
+}
+
+template <class KEY, class VALUE>
+inline
+NodeHashMap_Entry<KEY, VALUE>::~NodeHashMap_Entry()
+{
+    if (d_node_p) {
+        bslma::DestructionUtil::destroy(d_node_p->d_value.address());
+        d_node_p->d_allocator_p->deallocate(d_node_p);
+    }
+}
+
+// ACCESSORS
+template <class KEY, class VALUE>
+inline
+typename NodeHashMap_Entry<KEY, VALUE>::value_type&
+NodeHashMap_Entry<KEY, VALUE>::value() const
+{
+    BSLS_ASSERT_SAFE(d_node_p);
+
+    return d_node_p->d_value.object();
+}
+
+                       // ----------------------------
+                       // struct NodeHashMap_EntryUtil
+                       // ----------------------------
+
+// CLASS METHODS
+template <class KEY, class VALUE>
+template <class ORIGINAL_TYPE>
+inline
+void NodeHashMap_EntryUtil<KEY, VALUE>::construct(
+                  Entry                                            *entry,
+                  bslma::Allocator                                 *allocator,
+                  BSLS_COMPILERFEATURES_FORWARD_REF(ORIGINAL_TYPE)  original)
+{
+    BSLS_ASSERT_SAFE(entry);
+
+    bslma::ConstructionUtil::construct(
+                       entry,
+                       allocator,
+                       BSLS_COMPILERFEATURES_FORWARD(ORIGINAL_TYPE, original));
+}
+
+template <class KEY, class VALUE>
+template <class KEY_TYPE>
+inline
+void NodeHashMap_EntryUtil<KEY, VALUE>::constructFromKey(
+                        Entry                                       *entry,
+                        bslma::Allocator                            *allocator,
+                        BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE)  key)
+{
+    BSLS_ASSERT_SAFE(entry);
+
+    bsls::ObjectBuffer<VALUE> value;
+
+    bslma::ConstructionUtil::construct(value.address(), allocator);
+    bslma::DestructorGuard<VALUE> guard(value.address());
+
+    ::new (static_cast<void *>(entry)) Entry(
+                                  BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key),
+                                  bslmf::MovableRefUtil::move(value.object()),
+                                  allocator);
+}
+
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR
+template <class KEY, class VALUE>
+template <class KEY_ARGS, class VALUE_ARGS>
+inline
+void NodeHashMap_EntryUtil<KEY, VALUE>::construct(
+                                        Entry                      *entry,
+                                        bslma::Allocator           *allocator,
+                                        std::piecewise_construct_t,
+                                        KEY_ARGS&&                  keyArgs,
+                                        VALUE_ARGS&&                valueArgs)
+{
+    BSLS_ASSERT_SAFE(entry);
+
+    ::new (static_cast<void *>(entry)) Entry(
+                         allocator,
+                         std::piecewise_construct,
+                         BSLS_COMPILERFEATURES_FORWARD(KEY_ARGS, keyArgs),
+                         BSLS_COMPILERFEATURES_FORWARD(VALUE_ARGS, valueArgs));
+}
+#endif
+
+template <class KEY, class VALUE>
+inline
+const KEY& NodeHashMap_EntryUtil<KEY, VALUE>::key(const Entry& entry)
+{
+    return entry.value().first;
+}
+
+                       // -----------------------------
+                       // class NodeHashMap_IteratorImp
+                       // -----------------------------
+
+// CREATORS
+template <class ENTRY>
+inline
+NodeHashMap_IteratorImp<ENTRY>::NodeHashMap_IteratorImp()
+: d_imp()
+{
+}
+
+template <class ENTRY>
+inline
+NodeHashMap_IteratorImp<ENTRY>::NodeHashMap_IteratorImp(
+                                         const TableIteratorImp& tableIterator)
+: d_imp(tableIterator)
+{
+}
+
+// MANIPULATORS
+template <class ENTRY>
+inline
+void NodeHashMap_IteratorImp<ENTRY>::operator++()
+{
+    ++d_imp;
+}
+
+// ACCESSORS
+template <class ENTRY>
+inline
+typename ENTRY::value_type& NodeHashMap_IteratorImp<ENTRY>::operator*() const
+{
+    return (*d_imp).value();
+}
+
+template <class ENTRY>
+inline
+const typename NodeHashMap_IteratorImp<ENTRY>::TableIteratorImp&
+NodeHashMap_IteratorImp<ENTRY>::tableIterator() const
+{
+    return d_imp;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class ENTRY>
+inline
+bool bdlc::operator==(const NodeHashMap_IteratorImp<ENTRY>& lhs,
+                      const NodeHashMap_IteratorImp<ENTRY>& rhs)
+{
+    return lhs.d_imp == rhs.d_imp;
+}
+
+namespace bdlc {
+
+                            // -----------------
+                            // class NodeHashMap
+                            // -----------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::fromTable(
+                              const typename ImplType::iterator& tableIterator)
+{
+    return iterator(IteratorImp(tableIterator.imp()));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::ImplType::const_iterator
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::toTable(const const_iterator& position)
+{
+    return typename ImplType::const_iterator(position.imp().tableIterator());
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap()
+: d_impl(0, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                                              bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(bsl::size_t capacity)
+: d_impl(capacity, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                                              bsl::size_t       capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              const EQUAL&      equal,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bsl::size_t       capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              const EQUAL&      equal,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+    insert(first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                             bsl::initializer_list<value_type>  values,
+                             bslma::Allocator                  *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                             bsl::initializer_list<value_type>  values,
+                             bsl::size_t                        capacity,
+                             bslma::Allocator                  *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                                            const NodeHashMap&  original,
+                                            bslma::Allocator   *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                                       bslmf::MovableRef<NodeHashMap> original)
+: d_impl(bslmf::MovableRefUtil::move(
+                               bslmf::MovableRefUtil::access(original).d_impl))
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::NodeHashMap(
+                                bslmf::MovableRef<NodeHashMap>  original,
+                                bslma::Allocator               *basicAllocator)
+: d_impl(bslmf::MovableRefUtil::move(
+                               bslmf::MovableRefUtil::access(original).d_impl),
+         basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::~NodeHashMap()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>&
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::operator=(const NodeHashMap& rhs)
+{
+    d_impl = rhs.d_impl;
+
+    return *this;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+NodeHashMap<KEY, VALUE, HASH, EQUAL>&
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::operator=(
+                                            bslmf::MovableRef<NodeHashMap> rhs)
+{
+    NodeHashMap& lvalue = rhs;
+
+    d_impl = bslmf::MovableRefUtil::move(lvalue.d_impl);
+
+    return *this;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class KEY_TYPE>
+inline
+VALUE& NodeHashMap<KEY, VALUE, HASH, EQUAL>::operator[](
+                               BSLS_COMPILERFEATURES_FORWARD_REF(KEY_TYPE) key)
+{
+    return d_impl[BSLS_COMPILERFEATURES_FORWARD(KEY_TYPE, key)].value().second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+VALUE& NodeHashMap<KEY, VALUE, HASH, EQUAL>::at(const KEY& key)
+{
+    typename ImplType::iterator node = d_impl.find(key);
+
+    if (node == d_impl.end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                          "NodeHashMap<...>::at(key_type): "
+                                          "invalid key value");
+    }
+
+    return node->value().second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void NodeHashMap<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    d_impl.clear();
+}
+
+#if BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// Command line: sim_cpp11_features.pl bdlc_nodehashmap.h
+#ifndef BDLC_NODEHASHMAP_VARIADIC_LIMIT
+#define BDLC_NODEHASHMAP_VARIADIC_LIMIT 10
+#endif
+#ifndef BDLC_NODEHASHMAP_VARIADIC_LIMIT_E
+#define BDLC_NODEHASHMAP_VARIADIC_LIMIT_E BDLC_NODEHASHMAP_VARIADIC_LIMIT
+#endif
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_E >= 0
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::emplace()
+{
+    // The element is constructed in its node before the key is known, and
+    // the entry is then moved into the table, transferring the node rather
+    // than the element.
+
+    Entry entry(d_impl.allocator());
+
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.insert(
+                                           bslmf::MovableRefUtil::move(entry));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_E >= 0
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_E >= 1
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::emplace(
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01)
+{
+    // The element is constructed in its node before the key is known, and
+    // the entry is then moved into the table, transferring the node rather
+    // than the element.
+
+    Entry entry(d_impl.allocator(),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01));
+
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.insert(
+                                           bslmf::MovableRefUtil::move(entry));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_E >= 1
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_E >= 2
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::emplace(
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02)
+{
+    // The element is constructed in its node before the key is known, and
+    // the entry is then moved into the table, transferring the node rather
+    // than the element.
+
+    Entry entry(d_impl.allocator(),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02));
+
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.insert(
+                                           bslmf::MovableRefUtil::move(entry));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_E >= 2
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_E >= 3
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::emplace(
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03)
+{
+    // The element is constructed in its node before the key is known, and
+    // the entry is then moved into the table, transferring the node rather
+    // than the element.
+
+    Entry entry(d_impl.allocator(),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03));
+
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.insert(
+                                           bslmf::MovableRefUtil::move(entry));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_E >= 3
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_E >= 4
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::emplace(
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04)
+{
+    // The element is constructed in its node before the key is known, and
+    // the entry is then moved into the table, transferring the node rather
+    // than the element.
+
+    Entry entry(d_impl.allocator(),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04));
+
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.insert(
+                                           bslmf::MovableRefUtil::move(entry));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_E >= 4
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_E >= 5
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04,
+          class ARGS_05>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::emplace(
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05)
+{
+    // The element is constructed in its node before the key is known, and
+    // the entry is then moved into the table, transferring the node rather
+    // than the element.
+
+    Entry entry(d_impl.allocator(),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_05, args_05));
+
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.insert(
+                                           bslmf::MovableRefUtil::move(entry));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_E >= 5
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_E >= 6
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04,
+          class ARGS_05,
+          class ARGS_06>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::emplace(
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06)
+{
+    // The element is constructed in its node before the key is known, and
+    // the entry is then moved into the table, transferring the node rather
+    // than the element.
+
+    Entry entry(d_impl.allocator(),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_05, args_05),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_06, args_06));
+
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.insert(
+                                           bslmf::MovableRefUtil::move(entry));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_E >= 6
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_E >= 7
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04,
+          class ARGS_05,
+          class ARGS_06,
+          class ARGS_07>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::emplace(
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07)
+{
+    // The element is constructed in its node before the key is known, and
+    // the entry is then moved into the table, transferring the node rather
+    // than the element.
+
+    Entry entry(d_impl.allocator(),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_05, args_05),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_06, args_06),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_07, args_07));
+
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.insert(
+                                           bslmf::MovableRefUtil::move(entry));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_E >= 7
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_E >= 8
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04,
+          class ARGS_05,
+          class ARGS_06,
+          class ARGS_07,
+          class ARGS_08>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::emplace(
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_08) args_08)
+{
+    // The element is constructed in its node before the key is known, and
+    // the entry is then moved into the table, transferring the node rather
+    // than the element.
+
+    Entry entry(d_impl.allocator(),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_05, args_05),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_06, args_06),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_07, args_07),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_08, args_08));
+
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.insert(
+                                           bslmf::MovableRefUtil::move(entry));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_E >= 8
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_E >= 9
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04,
+          class ARGS_05,
+          class ARGS_06,
+          class ARGS_07,
+          class ARGS_08,
+          class ARGS_09>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::emplace(
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_08) args_08,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_09) args_09)
+{
+    // The element is constructed in its node before the key is known, and
+    // the entry is then moved into the table, transferring the node rather
+    // than the element.
+
+    Entry entry(d_impl.allocator(),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_05, args_05),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_06, args_06),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_07, args_07),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_08, args_08),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_09, args_09));
+
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.insert(
+                                           bslmf::MovableRefUtil::move(entry));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_E >= 9
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_E >= 10
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04,
+          class ARGS_05,
+          class ARGS_06,
+          class ARGS_07,
+          class ARGS_08,
+          class ARGS_09,
+          class ARGS_10>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::emplace(
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_08) args_08,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_09) args_09,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_10) args_10)
+{
+    // The element is constructed in its node before the key is known, and
+    // the entry is then moved into the table, transferring the node rather
+    // than the element.
+
+    Entry entry(d_impl.allocator(),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_05, args_05),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_06, args_06),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_07, args_07),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_08, args_08),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_09, args_09),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS_10, args_10));
+
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.insert(
+                                           bslmf::MovableRefUtil::move(entry));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_E >= 10
+
+#else
+// The generated code below is a workaround for the absence of perfect
+// forwarding in some compilers.
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class... ARGS>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::emplace(
+                               BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args)
+{
+    // The element is constructed in its node before the key is known, and
+    // the entry is then moved into the table, transferring the node rather
+    // than the element.
+
+    Entry entry(d_impl.allocator(),
+                BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.insert(
+                                           bslmf::MovableRefUtil::move(entry));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+// }}} END GENERATED CODE
+#endif
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator,
+          typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::equal_range(const KEY& key)
+{
+    bsl::pair<typename ImplType::iterator, typename ImplType::iterator>
+                                               range = d_impl.equal_range(key);
+
+    return bsl::pair<iterator, iterator>(fromTable(range.first),
+                                         fromTable(range.second));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t NodeHashMap<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return fromTable(d_impl.erase(toTable(position)));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::erase(iterator position)
+{
+    // Note that this overload is necessary to avoid ambiguity when the key
+    // is a map iterator.
+
+    BSLS_ASSERT_SAFE(position != end());
+
+    return fromTable(d_impl.erase(toTable(position)));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::erase(const_iterator first,
+                                            const_iterator last)
+{
+    return fromTable(d_impl.erase(toTable(first), toTable(last)));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key)
+{
+    return fromTable(d_impl.find(key));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::insert(const value_type& value)
+{
+    // `try_emplace` hashes the key and probes the table once, and constructs
+    // the entry (hence allocates a node) only if the key is absent.
+
+    bsl::pair<typename ImplType::iterator, bool> result =
+                                        d_impl.try_emplace(value.first, value);
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+void NodeHashMap<KEY, VALUE, HASH, EQUAL>::insert(INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        insert(*first);
+    }
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void NodeHashMap<KEY, VALUE, HASH, EQUAL>::insert(
+                                      bsl::initializer_list<value_type> values)
+{
+    insert(values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void NodeHashMap<KEY, VALUE, HASH, EQUAL>::rehash(bsl::size_t minimumCapacity)
+{
+    d_impl.rehash(minimumCapacity);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void NodeHashMap<KEY, VALUE, HASH, EQUAL>::reserve(bsl::size_t numEntries)
+{
+    d_impl.reserve(numEntries);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void NodeHashMap<KEY, VALUE, HASH, EQUAL>::reset()
+{
+    d_impl.reset();
+}
+
+#if BSLS_COMPILERFEATURES_SIMULATE_VARIADIC_TEMPLATES
+// {{{ BEGIN GENERATED CODE
+// Command line: sim_cpp11_features.pl bdlc_nodehashmap.h
+#ifndef BDLC_NODEHASHMAP_VARIADIC_LIMIT
+#define BDLC_NODEHASHMAP_VARIADIC_LIMIT 10
+#endif
+#ifndef BDLC_NODEHASHMAP_VARIADIC_LIMIT_F
+#define BDLC_NODEHASHMAP_VARIADIC_LIMIT_F BDLC_NODEHASHMAP_VARIADIC_LIMIT
+#endif
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 0
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(const KEY& key)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.try_emplace(
+          key,
+          std::piecewise_construct,
+          std::forward_as_tuple(key),
+          std::forward_as_tuple());
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 0
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 1
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(const KEY& key,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.try_emplace(
+          key,
+          std::piecewise_construct,
+          std::forward_as_tuple(key),
+          std::forward_as_tuple(
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01)));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 1
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 2
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(const KEY& key,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.try_emplace(
+          key,
+          std::piecewise_construct,
+          std::forward_as_tuple(key),
+          std::forward_as_tuple(
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02)));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 2
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 3
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(const KEY& key,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.try_emplace(
+          key,
+          std::piecewise_construct,
+          std::forward_as_tuple(key),
+          std::forward_as_tuple(
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03)));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 3
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 4
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(const KEY& key,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.try_emplace(
+          key,
+          std::piecewise_construct,
+          std::forward_as_tuple(key),
+          std::forward_as_tuple(
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04)));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 4
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 5
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04,
+          class ARGS_05>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(const KEY& key,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.try_emplace(
+          key,
+          std::piecewise_construct,
+          std::forward_as_tuple(key),
+          std::forward_as_tuple(
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_05, args_05)));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 5
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 6
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04,
+          class ARGS_05,
+          class ARGS_06>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(const KEY& key,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.try_emplace(
+          key,
+          std::piecewise_construct,
+          std::forward_as_tuple(key),
+          std::forward_as_tuple(
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_05, args_05),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_06, args_06)));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 6
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 7
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04,
+          class ARGS_05,
+          class ARGS_06,
+          class ARGS_07>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(const KEY& key,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.try_emplace(
+          key,
+          std::piecewise_construct,
+          std::forward_as_tuple(key),
+          std::forward_as_tuple(
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_05, args_05),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_06, args_06),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_07, args_07)));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 7
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 8
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04,
+          class ARGS_05,
+          class ARGS_06,
+          class ARGS_07,
+          class ARGS_08>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(const KEY& key,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_08) args_08)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.try_emplace(
+          key,
+          std::piecewise_construct,
+          std::forward_as_tuple(key),
+          std::forward_as_tuple(
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_05, args_05),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_06, args_06),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_07, args_07),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_08, args_08)));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 8
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 9
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04,
+          class ARGS_05,
+          class ARGS_06,
+          class ARGS_07,
+          class ARGS_08,
+          class ARGS_09>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(const KEY& key,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_08) args_08,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_09) args_09)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.try_emplace(
+          key,
+          std::piecewise_construct,
+          std::forward_as_tuple(key),
+          std::forward_as_tuple(
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_05, args_05),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_06, args_06),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_07, args_07),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_08, args_08),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_09, args_09)));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 9
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 10
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04,
+          class ARGS_05,
+          class ARGS_06,
+          class ARGS_07,
+          class ARGS_08,
+          class ARGS_09,
+          class ARGS_10>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(const KEY& key,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_08) args_08,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_09) args_09,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_10) args_10)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.try_emplace(
+          key,
+          std::piecewise_construct,
+          std::forward_as_tuple(key),
+          std::forward_as_tuple(
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_05, args_05),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_06, args_06),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_07, args_07),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_08, args_08),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_09, args_09),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_10, args_10)));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 10
+
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 0
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(
+                                      BloombergLP::bslmf::MovableRef<KEY> key)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.try_emplace(
+          BSLS_COMPILERFEATURES_FORWARD(KEY, key),
+          std::piecewise_construct,
+          std::forward_as_tuple(BSLS_COMPILERFEATURES_FORWARD(KEY, key)),
+          std::forward_as_tuple());
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 0
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 1
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(
+                                      BloombergLP::bslmf::MovableRef<KEY> key,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.try_emplace(
+          BSLS_COMPILERFEATURES_FORWARD(KEY, key),
+          std::piecewise_construct,
+          std::forward_as_tuple(BSLS_COMPILERFEATURES_FORWARD(KEY, key)),
+          std::forward_as_tuple(
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01)));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 1
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 2
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(
+                                      BloombergLP::bslmf::MovableRef<KEY> key,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.try_emplace(
+          BSLS_COMPILERFEATURES_FORWARD(KEY, key),
+          std::piecewise_construct,
+          std::forward_as_tuple(BSLS_COMPILERFEATURES_FORWARD(KEY, key)),
+          std::forward_as_tuple(
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02)));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 2
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 3
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(
+                                      BloombergLP::bslmf::MovableRef<KEY> key,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.try_emplace(
+          BSLS_COMPILERFEATURES_FORWARD(KEY, key),
+          std::piecewise_construct,
+          std::forward_as_tuple(BSLS_COMPILERFEATURES_FORWARD(KEY, key)),
+          std::forward_as_tuple(
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03)));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 3
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 4
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(
+                                      BloombergLP::bslmf::MovableRef<KEY> key,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.try_emplace(
+          BSLS_COMPILERFEATURES_FORWARD(KEY, key),
+          std::piecewise_construct,
+          std::forward_as_tuple(BSLS_COMPILERFEATURES_FORWARD(KEY, key)),
+          std::forward_as_tuple(
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04)));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 4
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 5
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04,
+          class ARGS_05>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(
+                                      BloombergLP::bslmf::MovableRef<KEY> key,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.try_emplace(
+          BSLS_COMPILERFEATURES_FORWARD(KEY, key),
+          std::piecewise_construct,
+          std::forward_as_tuple(BSLS_COMPILERFEATURES_FORWARD(KEY, key)),
+          std::forward_as_tuple(
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_05, args_05)));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 5
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 6
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04,
+          class ARGS_05,
+          class ARGS_06>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(
+                                      BloombergLP::bslmf::MovableRef<KEY> key,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.try_emplace(
+          BSLS_COMPILERFEATURES_FORWARD(KEY, key),
+          std::piecewise_construct,
+          std::forward_as_tuple(BSLS_COMPILERFEATURES_FORWARD(KEY, key)),
+          std::forward_as_tuple(
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_05, args_05),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_06, args_06)));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 6
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 7
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04,
+          class ARGS_05,
+          class ARGS_06,
+          class ARGS_07>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(
+                                      BloombergLP::bslmf::MovableRef<KEY> key,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.try_emplace(
+          BSLS_COMPILERFEATURES_FORWARD(KEY, key),
+          std::piecewise_construct,
+          std::forward_as_tuple(BSLS_COMPILERFEATURES_FORWARD(KEY, key)),
+          std::forward_as_tuple(
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_05, args_05),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_06, args_06),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_07, args_07)));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 7
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 8
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04,
+          class ARGS_05,
+          class ARGS_06,
+          class ARGS_07,
+          class ARGS_08>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(
+                                      BloombergLP::bslmf::MovableRef<KEY> key,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_08) args_08)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.try_emplace(
+          BSLS_COMPILERFEATURES_FORWARD(KEY, key),
+          std::piecewise_construct,
+          std::forward_as_tuple(BSLS_COMPILERFEATURES_FORWARD(KEY, key)),
+          std::forward_as_tuple(
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_05, args_05),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_06, args_06),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_07, args_07),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_08, args_08)));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 8
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 9
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04,
+          class ARGS_05,
+          class ARGS_06,
+          class ARGS_07,
+          class ARGS_08,
+          class ARGS_09>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(
+                                      BloombergLP::bslmf::MovableRef<KEY> key,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_08) args_08,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_09) args_09)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.try_emplace(
+          BSLS_COMPILERFEATURES_FORWARD(KEY, key),
+          std::piecewise_construct,
+          std::forward_as_tuple(BSLS_COMPILERFEATURES_FORWARD(KEY, key)),
+          std::forward_as_tuple(
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_05, args_05),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_06, args_06),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_07, args_07),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_08, args_08),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_09, args_09)));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 9
+
+#if BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 10
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class ARGS_01,
+          class ARGS_02,
+          class ARGS_03,
+          class ARGS_04,
+          class ARGS_05,
+          class ARGS_06,
+          class ARGS_07,
+          class ARGS_08,
+          class ARGS_09,
+          class ARGS_10>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(
+                                      BloombergLP::bslmf::MovableRef<KEY> key,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_01) args_01,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_02) args_02,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_03) args_03,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_04) args_04,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_05) args_05,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_06) args_06,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_07) args_07,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_08) args_08,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_09) args_09,
+                            BSLS_COMPILERFEATURES_FORWARD_REF(ARGS_10) args_10)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.try_emplace(
+          BSLS_COMPILERFEATURES_FORWARD(KEY, key),
+          std::piecewise_construct,
+          std::forward_as_tuple(BSLS_COMPILERFEATURES_FORWARD(KEY, key)),
+          std::forward_as_tuple(
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_01, args_01),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_02, args_02),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_03, args_03),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_04, args_04),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_05, args_05),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_06, args_06),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_07, args_07),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_08, args_08),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_09, args_09),
+                             BSLS_COMPILERFEATURES_FORWARD(ARGS_10, args_10)));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif  // BDLC_NODEHASHMAP_VARIADIC_LIMIT_F >= 10
+
+#endif   // BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR
+#else
+// The generated code below is a workaround for the absence of perfect
+// forwarding in some compilers.
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class... ARGS>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(const KEY& key,
+                               BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.try_emplace(
+          key,
+          std::piecewise_construct,
+          std::forward_as_tuple(key),
+          std::forward_as_tuple(BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class... ARGS>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::try_emplace(
+                                      BloombergLP::bslmf::MovableRef<KEY> key,
+                               BSLS_COMPILERFEATURES_FORWARD_REF(ARGS)... args)
+{
+    bsl::pair<typename ImplType::iterator, bool> result = d_impl.try_emplace(
+          BSLS_COMPILERFEATURES_FORWARD(KEY, key),
+          std::piecewise_construct,
+          std::forward_as_tuple(BSLS_COMPILERFEATURES_FORWARD(KEY, key)),
+          std::forward_as_tuple(BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...));
+
+    return bsl::pair<iterator, bool>(fromTable(result.first), result.second);
+}
+#endif   // BSLS_LIBRARYFEATURES_HAS_CPP11_PAIR_PIECEWISE_CONSTRUCTOR
+// }}} END GENERATED CODE
+#endif
+
+                          // Iterators
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::begin()
+{
+    return fromTable(d_impl.begin());
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::end()
+{
+    return fromTable(d_impl.end());
+}
+
+                             // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void NodeHashMap<KEY, VALUE, HASH, EQUAL>::swap(NodeHashMap& other)
+{
+    BSLS_ASSERT_SAFE(allocator() == other.allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+const VALUE& NodeHashMap<KEY, VALUE, HASH, EQUAL>::at(const KEY& key) const
+{
+    typename ImplType::const_iterator node = d_impl.find(key);
+
+    if (node == d_impl.end()) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                    "NodeHashMap<...>::at(key_type) const: "
+                                    "invalid key value");
+    }
+
+    return node->value().second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t NodeHashMap<KEY, VALUE, HASH, EQUAL>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool NodeHashMap<KEY, VALUE, HASH, EQUAL>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t NodeHashMap<KEY, VALUE, HASH, EQUAL>::count(const KEY& key) const
+{
+    return d_impl.count(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool NodeHashMap<KEY, VALUE, HASH, EQUAL>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator,
+          typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator>
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::equal_range(const KEY& key) const
+{
+    const_iterator it1 = find(key);
+    if (it1 == end()) {
+        return bsl::make_pair(it1, it1);                              // RETURN
+    }
+    const_iterator it2 = it1;
+    ++it2;
+    return bsl::make_pair(it1, it2);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key) const
+{
+    return const_iterator(IteratorImp(d_impl.find(key).imp()));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH NodeHashMap<KEY, VALUE, HASH, EQUAL>::hash_function() const
+{
+    return d_impl.hash_function();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL NodeHashMap<KEY, VALUE, HASH, EQUAL>::key_eq() const
+{
+    return d_impl.key_eq();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float NodeHashMap<KEY, VALUE, HASH, EQUAL>::load_factor() const
+{
+    return d_impl.load_factor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float NodeHashMap<KEY, VALUE, HASH, EQUAL>::max_load_factor() const
+{
+    return d_impl.max_load_factor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t NodeHashMap<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    return d_impl.size();
+}
+
+                          // Iterators
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::begin() const
+{
+    return const_iterator(IteratorImp(d_impl.begin().imp()));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::cbegin() const
+{
+    return begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::cend() const
+{
+    return end();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+NodeHashMap<KEY, VALUE, HASH, EQUAL>::end() const
+{
+    return const_iterator(IteratorImp(d_impl.end().imp()));
+}
+
+                           // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bslma::Allocator *NodeHashMap<KEY, VALUE, HASH, EQUAL>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool bdlc::operator==(const NodeHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                      const NodeHashMap<KEY, VALUE, HASH, EQUAL>& rhs)
+{
+    typedef typename NodeHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+                                                                 ConstIterator;
+
+    if (lhs.size() != rhs.size()) {
+        return false;                                                 // RETURN
+    }
+
+    for (ConstIterator it = lhs.begin(); it != lhs.end(); ++it) {
+        ConstIterator other = rhs.find(it->first);
+        if (other == rhs.end() || !(*it == *other)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(const NodeHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                      const NodeHashMap<KEY, VALUE, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void bdlc::swap(NodeHashMap<KEY, VALUE, HASH, EQUAL>& a,
+                NodeHashMap<KEY, VALUE, HASH, EQUAL>& b)
+{
+    bslalg::SwapUtil::swap(&a.d_impl, &b.d_impl);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslalg {
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+struct HasStlIterators<bdlc::NodeHashMap<KEY, VALUE, HASH, EQUAL> >
+: bsl::true_type {
+};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+struct UsesBslmaAllocator<bdlc::NodeHashMap<KEY, VALUE, HASH, EQUAL> >
+: bsl::true_type {
+};
+
+}  // close namespace bslma
+}  // close enterprise namespace
+
+#else // if ! defined(DEFINED_BDLC_NODEHASHMAP_H)
+# error Not valid except when included from bdlc_nodehashmap.h
+#endif // ! defined(COMPILING_BDLC_NODEHASHMAP_H)
+
+#endif // ! defined(INCLUDED_BDLC_NODEHASHMAP_CPP03)
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
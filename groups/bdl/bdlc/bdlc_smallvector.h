@@ -0,0 +1,1876 @@
+// bdlc_smallvector.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_SMALLVECTOR
+#define INCLUDED_BDLC_SMALLVECTOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a vector that holds a few elements without allocating.
+//
+//@CLASSES:
+//   bdlc::SmallVector: vector with inline storage for `INLINE_CAPACITY` items
+//
+//@SEE_ALSO: bslstl_vector
+//
+//@DESCRIPTION: This component defines a single class template,
+// `bdlc::SmallVector`, that implements a dynamically-sized, contiguous
+// sequence of elements of the (template parameter) `TYPE`, and that reserves,
+// within the footprint of the object itself, storage for up to the (template
+// parameter) `INLINE_CAPACITY` elements.  A `bdlc::SmallVector` allocates
+// memory from its allocator only when it grows past `INLINE_CAPACITY`
+// elements; while its size does not exceed `INLINE_CAPACITY`, creating,
+// populating, and destroying a `bdlc::SmallVector` does not allocate at all.
+//
+// Many sequences built by typical code are short -- the fields of a parsed
+// line, the children of a tree node, the pending requests of a single
+// connection -- and, when such a sequence is a `bsl::vector`, the cost of the
+// single allocation (and deallocation) made to hold it frequently exceeds the
+// cost of the work done with its elements.  Choosing an `INLINE_CAPACITY` that
+// covers the common case removes that cost, and also places the elements in
+// the same cache lines as the object that owns the sequence.  Sequences that
+// turn out to be longer are handled correctly, at the cost of one allocation
+// per growth step, as for `bsl::vector`.
+//
+// Elements are relocated (on growth, insertion, and erasure) using
+// `bslalg::ArrayPrimitives`, so that elements of a type having the
+// `bslmf::IsBitwiseMoveable` trait are moved with a single `memcpy` or
+// `memmove`.
+//
+// An instantiation of `bdlc::SmallVector` is an allocator-aware,
+// value-semantic type whose salient attributes are its size and the sequence
+// of values of its elements; the capacity of a `bdlc::SmallVector`, and
+// whether its elements are held inline, are not salient.
+//
+///Choosing `INLINE_CAPACITY`
+///--------------------------
+// The footprint of a `bdlc::SmallVector` is approximately
+// `INLINE_CAPACITY * sizeof(TYPE)` bytes plus four words, regardless of how
+// many elements it holds.  A `bdlc::SmallVector` is therefore best suited to
+// local variables and to members of objects whose sequences are usually no
+// longer than a small, known bound.  An `INLINE_CAPACITY` much larger than
+// the typical size wastes memory (and cache), and one smaller than the
+// typical size provides no benefit over `bsl::vector`.  Note that, unlike
+// `bsl::vector`, `bdlc::SmallVector` is *not* bitwise moveable, so that
+// containers of `bdlc::SmallVector` objects move their elements by invoking
+// the move constructor.
+//
+///Interface Differences with `vector`
+///-----------------------------------
+// A `bdlc::SmallVector` provides most of the interface of `bsl::vector`, and
+// its iterators are pointers.  Allocator use follows BDE style, and the
+// various allocator propagation attributes are not present.  The move
+// constructor, move assignment, and `swap` steal the dynamically-allocated
+// storage of a `bdlc::SmallVector` whose elements are not held inline, but
+// must move the elements one by one otherwise; consequently, moving a
+// `bdlc::SmallVector` whose elements are held inline invalidates iterators,
+// pointers, and references to elements of *both* objects.  `shrink_to_fit`
+// returns the elements of a `bdlc::SmallVector` to its inline storage when
+// they fit.
+//
+///Exception Safety
+///----------------
+// A `bdlc::SmallVector` is exception neutral, and all of the methods of
+// `bdlc::SmallVector` provide the basic exception safety guarantee (see
+// {`bsldoc_glossary`|Basic Guarantee}).
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Splitting a Line into Fields
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we parse delimited text whose lines rarely contain more than eight
+// fields.  Collecting the fields of each line into a `bdlc::SmallVector`
+// avoids allocating for all but the rare long lines.
+//
+// First, we define a function that splits a line into fields, appending the
+// offset of the start of each field to a `bdlc::SmallVector`:
+// ```
+// typedef bdlc::SmallVector<bsl::size_t, 8> FieldOffsets;
+//
+// void splitFields(FieldOffsets *result, const char *line, char delimiter)
+// {
+//     result->clear();
+//     result->push_back(0);
+//     for (bsl::size_t i = 0; line[i]; ++i) {
+//         if (delimiter == line[i]) {
+//             result->push_back(i + 1);
+//         }
+//     }
+// }
+// ```
+// Then, we create a test allocator, and a `FieldOffsets` object using it:
+// ```
+// bslma::TestAllocator ta;
+// FieldOffsets         offsets(&ta);
+// ```
+// Next, we split a typical line, and observe that no memory was allocated:
+// ```
+// splitFields(&offsets, "IBM,100,25.5", ',');
+//
+// assert(3 == offsets.size());
+// assert(4 == offsets[1]);
+// assert(8 == offsets[2]);
+// assert(offsets.isInline());
+// assert(0 == ta.numAllocations());
+// ```
+// Now, we split an unusually long line, which spills the offsets to memory
+// supplied by the allocator:
+// ```
+// splitFields(&offsets, "a,b,c,d,e,f,g,h,i,j", ',');
+//
+// assert(10 == offsets.size());
+// assert(!offsets.isInline());
+// assert(1 == ta.numBlocksInUse());
+// ```
+// Finally, we return the offsets to inline storage once they fit again:
+// ```
+// splitFields(&offsets, "x,y", ',');
+// offsets.shrink_to_fit();
+//
+// assert(2 == offsets.size());
+// assert(offsets.isInline());
+// assert(0 == ta.numBlocksInUse());
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bslalg_arraydestructionprimitives.h>
+#include <bslalg_arrayprimitives.h>
+#include <bslalg_hasstliterators.h>
+
+#include <bslma_allocator.h>
+#include <bslma_bslallocator.h>
+#include <bslma_constructionutil.h>
+#include <bslma_default.h>
+#include <bslma_destructionutil.h>
+#include <bslma_destructorguard.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_enableif.h>
+#include <bslmf_isintegral.h>
+#include <bslmf_movableref.h>
+#include <bslmf_nestedtraitdeclaration.h>
+#include <bslmf_util.h>    // 'forward(V)'
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_alignmentfromtype.h>
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_performancehint.h>
+#include <bsls_util.h>     // 'forward<T>(V)'
+
+#include <bslstl_stdexceptutil.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_iterator.h>
+#include <bsl_limits.h>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+#include <bsl_initializer_list.h>
+#endif
+
+#if BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+// clang-format off
+// Include version that can be compiled with C++03
+// Generated on Mon Oct 19 10:12:41 2026
+// Command line: sim_cpp11_features.pl bdlc_smallvector.h
+
+# define COMPILING_BDLC_SMALLVECTOR_H
+# include <bdlc_smallvector_cpp03.h>
+# undef COMPILING_BDLC_SMALLVECTOR_H
+
+// clang-format on
+#else
+
+namespace BloombergLP {
+namespace bdlc {
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+class SmallVector;
+
+                         // =========================
+                         // class SmallVector_Proctor
+                         // =========================
+
+/// This class implements a proctor that, unless its `release` method is
+/// invoked, destroys the elements of, and releases any memory allocated by,
+/// a `SmallVector` whose constructor has not completed.
+template <class VECTOR>
+class SmallVector_Proctor {
+
+    // DATA
+    VECTOR *d_vector_p;  // managed vector (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    SmallVector_Proctor(const SmallVector_Proctor&);
+    SmallVector_Proctor& operator=(const SmallVector_Proctor&);
+
+  public:
+    // CREATORS
+
+    /// Create a proctor managing the specified `vector`.
+    explicit SmallVector_Proctor(VECTOR *vector);
+
+    /// Destroy this proctor, and destroy the elements of, and release the
+    /// memory held by, the managed vector, if any.
+    ~SmallVector_Proctor();
+
+    // MANIPULATORS
+
+    /// Release from management the vector managed by this proctor.
+    void release();
+};
+
+                            // =================
+                            // class SmallVector
+                            // =================
+
+/// This class template implements a value-semantic container type holding a
+/// dynamically-sized, contiguous sequence of elements of the (template
+/// parameter) `TYPE`, and reserving storage for up to the (template
+/// parameter) `INLINE_CAPACITY` elements within its own footprint.  Memory is
+/// allocated only when the size exceeds `INLINE_CAPACITY`.
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+class SmallVector {
+
+    BSLMF_ASSERT(0 < INLINE_CAPACITY);
+
+    // PRIVATE TYPES
+    typedef bslalg::ArrayPrimitives            ArrayPrimitives;
+    typedef bslalg::ArrayDestructionPrimitives ArrayDestructionPrimitives;
+    typedef bslmf::MovableRefUtil              MoveUtil;
+
+    // DATA
+    TYPE             *d_dataBegin_p;   // first element (inline or allocated)
+
+    TYPE             *d_dataEnd_p;     // one past the last element
+
+    bsl::size_t       d_capacity;      // number of elements that fit in the
+                                       // current storage
+
+    bslma::Allocator *d_allocator_p;   // memory allocator (held, not owned)
+
+    bsls::AlignedBuffer<INLINE_CAPACITY * sizeof(TYPE),
+                        bsls::AlignmentFromType<TYPE>::VALUE>
+                      d_inlineBuffer;  // storage for up to `INLINE_CAPACITY`
+                                       // elements
+
+    // FRIENDS
+    friend class SmallVector_Proctor<SmallVector>;
+
+    // PRIVATE CLASS METHODS
+
+    /// Return the capacity to grow to from the specified `capacity` in
+    /// order to hold the specified `newSize` elements, or throw
+    /// `bsl::length_error` if `newSize` exceeds `max_size()`.  The behavior
+    /// is undefined unless `capacity < newSize`.
+    static bsl::size_t computeNewCapacity(bsl::size_t newSize,
+                                          bsl::size_t capacity);
+
+    // PRIVATE MANIPULATORS
+
+    /// Take ownership of the elements, and of the allocated storage, of the
+    /// specified `other` vector, and reset `other` to empty, inline storage.
+    /// The behavior is undefined unless this vector is empty, `other` does
+    /// not hold its elements inline, and `other` uses the same allocator as
+    /// this vector.
+    void adopt(SmallVector *other);
+
+    /// Destroy the elements of this vector, and deallocate its storage if
+    /// it is not held inline.
+    void destroyAndDeallocate();
+
+    /// Insert the values in the specified range `[first .. last)` before the
+    /// element at the specified `index`.
+    template <class INPUT_ITER>
+    void insertRange(bsl::size_t                index,
+                     INPUT_ITER                 first,
+                     INPUT_ITER                 last,
+                     bsl::input_iterator_tag);
+    template <class FWD_ITER>
+    void insertRange(bsl::size_t                index,
+                     FWD_ITER                   first,
+                     FWD_ITER                   last,
+                     bsl::forward_iterator_tag);
+
+    /// Allocate storage for at least the specified `numElements` if they
+    /// do not fit in the current storage.  The behavior is undefined unless
+    /// this vector is empty and holds its elements inline.
+    void reserveEmpty(bsl::size_t numElements);
+
+    /// Return the address of the inline storage of this vector.
+    TYPE *inlineData();
+
+    // PRIVATE ACCESSORS
+
+    /// Return the address of the inline storage of this vector.
+    const TYPE *inlineData() const;
+
+  public:
+    // TYPES
+    typedef TYPE                                  value_type;
+    typedef TYPE&                                 reference;
+    typedef const TYPE&                           const_reference;
+    typedef TYPE                                 *pointer;
+    typedef const TYPE                           *const_pointer;
+    typedef TYPE                                 *iterator;
+    typedef const TYPE                           *const_iterator;
+    typedef bsl::reverse_iterator<iterator>       reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef bsl::size_t                           size_type;
+    typedef bsl::ptrdiff_t                        difference_type;
+
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(SmallVector, bslma::UsesBslmaAllocator);
+    BSLMF_NESTED_TRAIT_DECLARATION(SmallVector, bslalg::HasStlIterators);
+
+    // CREATORS
+
+    /// Create an empty vector.  Optionally specify a `basicAllocator` used
+    /// to supply memory.  If `basicAllocator` is 0, the currently installed
+    /// default allocator is used.  Note that no memory is allocated.
+    SmallVector();
+    explicit SmallVector(bslma::Allocator *basicAllocator);
+
+    /// Create a vector of the specified `numElements` value-initialized
+    /// elements.  Optionally specify a `basicAllocator` used to supply
+    /// memory.  If `basicAllocator` is 0, the currently installed default
+    /// allocator is used.
+    explicit SmallVector(bsl::size_t       numElements,
+                         bslma::Allocator *basicAllocator = 0);
+
+    /// Create a vector of the specified `numElements` copies of the
+    /// specified `value`.  Optionally specify a `basicAllocator` used to
+    /// supply memory.  If `basicAllocator` is 0, the currently installed
+    /// default allocator is used.
+    SmallVector(bsl::size_t       numElements,
+                const TYPE&       value,
+                bslma::Allocator *basicAllocator = 0);
+
+    /// Create a vector holding copies of the values in the specified range
+    /// `[first .. last)`.  Optionally specify a `basicAllocator` used to
+    /// supply memory.  If `basicAllocator` is 0, the currently installed
+    /// default allocator is used.  The behavior is undefined unless
+    /// `[first .. last)` is a valid range.  Note that this constructor does
+    /// not participate in overload resolution if `INPUT_ITER` is an integral
+    /// type.
+    template <class INPUT_ITER>
+    SmallVector(INPUT_ITER        first,
+                INPUT_ITER        last,
+                bslma::Allocator *basicAllocator = 0,
+                typename bsl::enable_if<
+                            !bsl::is_integral<INPUT_ITER>::value>::type * = 0);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    /// Create a vector holding copies of the values in the specified
+    /// `values`.  Optionally specify a `basicAllocator` used to supply
+    /// memory.  If `basicAllocator` is 0, the currently installed default
+    /// allocator is used.
+    SmallVector(std::initializer_list<TYPE>  values,
+                bslma::Allocator            *basicAllocator = 0);
+#endif
+
+    /// Create a vector having the same value as the specified `original`.
+    /// Optionally specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.
+    SmallVector(const SmallVector&  original,
+                bslma::Allocator   *basicAllocator = 0);
+
+    /// Create a vector having the same value as the specified `original`
+    /// object by moving (in constant time) the storage of `original` if it
+    /// is not held inline, and by moving its elements one by one otherwise.
+    /// The allocator associated with `original` is propagated for use in
+    /// the newly-created vector.  `original` is left in a valid but
+    /// unspecified state.
+    SmallVector(bslmf::MovableRef<SmallVector> original);
+
+    /// Create a vector having the same value as the specified `original`
+    /// object that uses the specified `basicAllocator` to supply memory.
+    /// If `basicAllocator` is 0, the currently installed default allocator
+    /// is used.  The storage of `original` is moved (in constant time) if
+    /// it is not held inline and `basicAllocator` is the allocator of
+    /// `original`; otherwise, the elements of `original` are moved one by
+    /// one.  `original` is left in a valid but unspecified state.
+    SmallVector(bslmf::MovableRef<SmallVector>  original,
+                bslma::Allocator               *basicAllocator);
+
+    /// Destroy this object.
+    ~SmallVector();
+
+    // MANIPULATORS
+
+    /// Assign to this object the value of the specified `rhs` object, and
+    /// return a reference providing modifiable access to this object.
+    SmallVector& operator=(const SmallVector& rhs);
+
+    /// Assign to this object the value of the specified `rhs` object, and
+    /// return a reference providing modifiable access to this object.  The
+    /// storage of `rhs` is moved (in constant time) if it is not held
+    /// inline and `rhs` uses the same allocator as this object; otherwise,
+    /// the elements of `rhs` are moved one by one.  `rhs` is left in a
+    /// valid but unspecified state.
+    SmallVector& operator=(bslmf::MovableRef<SmallVector> rhs);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    /// Assign to this object copies of the values in the specified
+    /// `values`, and return a reference providing modifiable access to this
+    /// object.
+    SmallVector& operator=(std::initializer_list<TYPE> values);
+#endif
+
+    /// Return a reference providing modifiable access to the element at the
+    /// specified `position`.  The behavior is undefined unless
+    /// `position < size()`.
+    TYPE& operator[](bsl::size_t position);
+
+    /// Assign to this object the specified `numElements` copies of the
+    /// specified `value`.  Note that `value` may refer to an element of
+    /// this vector.
+    void assign(bsl::size_t numElements, const TYPE& value);
+
+    /// Assign to this object copies of the values in the specified range
+    /// `[first .. last)`.  The behavior is undefined unless
+    /// `[first .. last)` is a valid range that does not refer to elements
+    /// of this vector.  Note that this method does not participate in
+    /// overload resolution if `INPUT_ITER` is an integral type.
+    template <class INPUT_ITER>
+    typename bsl::enable_if<!bsl::is_integral<INPUT_ITER>::value>::type
+    assign(INPUT_ITER first, INPUT_ITER last);
+
+    /// Return a reference providing modifiable access to the element at the
+    /// specified `position`.  Throw `bsl::out_of_range` if
+    /// `position >= size()`.
+    TYPE& at(bsl::size_t position);
+
+    /// Return a reference providing modifiable access to the last element
+    /// of this vector.  The behavior is undefined unless this vector is not
+    /// empty.
+    TYPE& back();
+
+    /// Return an iterator to the first element of this vector, or `end()`
+    /// if this vector is empty.
+    iterator begin();
+
+    /// Remove all elements from this vector.  Note that the capacity, and
+    /// any memory held by this vector, is retained.
+    void clear();
+
+    /// Return the address of the first element of this vector.  Note that
+    /// the returned pointer need not be dereferenceable if this vector is
+    /// empty.
+    TYPE *data();
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+    /// Insert before the specified `position` an element constructed by
+    /// forwarding the allocator of this vector (if required) and the
+    /// specified `args` to the corresponding constructor of `TYPE`, and
+    /// return an iterator to the inserted element.  The behavior is
+    /// undefined unless `position` is an iterator of this vector.  Note
+    /// that `args` may refer to elements of this vector.
+    template <class... ARGS>
+    iterator emplace(const_iterator position, ARGS&&... args);
+
+    /// Append to this vector an element constructed by forwarding the
+    /// allocator of this vector (if required) and the specified `args` to
+    /// the corresponding constructor of `TYPE`, and return a reference
+    /// providing modifiable access to the appended element.  Note that
+    /// `args` may refer to elements of this vector.
+    template <class... ARGS>
+    TYPE& emplace_back(ARGS&&... args);
+#endif
+
+    /// Return the past-the-end iterator of this vector.
+    iterator end();
+
+    /// Remove the element at the specified `position` from this vector, and
+    /// return an iterator to the element that followed it.  The behavior is
+    /// undefined unless `position` is a dereferenceable iterator of this
+    /// vector.
+    iterator erase(const_iterator position);
+
+    /// Remove the elements in the specified range `[first .. last)` from
+    /// this vector, and return an iterator to the element that followed the
+    /// last element removed.  The behavior is undefined unless
+    /// `[first .. last)` is a valid range of iterators of this vector.
+    iterator erase(const_iterator first, const_iterator last);
+
+    /// Return a reference providing modifiable access to the first element
+    /// of this vector.  The behavior is undefined unless this vector is not
+    /// empty.
+    TYPE& front();
+
+    /// Insert a copy of the specified `value` before the specified
+    /// `position`, and return an iterator to the inserted element.  The
+    /// behavior is undefined unless `position` is an iterator of this
+    /// vector.  Note that `value` may refer to an element of this vector.
+    iterator insert(const_iterator position, const TYPE& value);
+
+    /// Insert the specified `value` before the specified `position` by
+    /// moving it, and return an iterator to the inserted element.  `value`
+    /// is left in a valid but unspecified state.  The behavior is undefined
+    /// unless `position` is an iterator of this vector.
+    iterator insert(const_iterator position, bslmf::MovableRef<TYPE> value);
+
+    /// Insert the specified `numElements` copies of the specified `value`
+    /// before the specified `position`, and return an iterator to the first
+    /// inserted element (or `position` if `0 == numElements`).  The
+    /// behavior is undefined unless `position` is an iterator of this
+    /// vector.  Note that `value` may refer to an element of this vector.
+    iterator insert(const_iterator position,
+                    bsl::size_t    numElements,
+                    const TYPE&    value);
+
+    /// Insert copies of the values in the specified range `[first .. last)`
+    /// before the specified `position`, and return an iterator to the first
+    /// inserted element (or `position` if `first == last`).  The behavior
+    /// is undefined unless `position` is an iterator of this vector, and
+    /// `[first .. last)` is a valid range that does not refer to elements of
+    /// this vector.  Note that this method does not participate in overload
+    /// resolution if `INPUT_ITER` is an integral type.
+    template <class INPUT_ITER>
+    typename bsl::enable_if<!bsl::is_integral<INPUT_ITER>::value,
+                            iterator>::type
+    insert(const_iterator position, INPUT_ITER first, INPUT_ITER last);
+
+    /// Remove the last element of this vector.  The behavior is undefined
+    /// unless this vector is not empty.
+    void pop_back();
+
+    /// Append a copy of the specified `value` to this vector.  Note that
+    /// `value` may refer to an element of this vector.
+    void push_back(const TYPE& value);
+
+    /// Append the specified `value` to this vector by moving it.  `value` is
+    /// left in a valid but unspecified state.
+    void push_back(bslmf::MovableRef<TYPE> value);
+
+    /// Return a reverse iterator to the last element of this vector.
+    reverse_iterator rbegin();
+
+    /// Return the past-the-end reverse iterator of this vector.
+    reverse_iterator rend();
+
+    /// Ensure that this vector has capacity for at least the specified
+    /// `numElements` elements, allocating if `numElements > capacity()`.
+    /// Throw `bsl::length_error` if `numElements > max_size()`.
+    void reserve(bsl::size_t numElements);
+
+    /// Change the size of this vector to the specified `newSize`, either
+    /// erasing elements from the end or appending value-initialized
+    /// elements.
+    void resize(bsl::size_t newSize);
+
+    /// Change the size of this vector to the specified `newSize`, either
+    /// erasing elements from the end or appending copies of the specified
+    /// `value`.
+    void resize(bsl::size_t newSize, const TYPE& value);
+
+    /// Reduce the capacity of this vector to the larger of its size and
+    /// `INLINE_CAPACITY`, returning its elements to inline storage, and
+    /// releasing any memory held by this vector, if they fit.
+    void shrink_to_fit();
+
+    /// Exchange the value of this object with that of the specified `other`
+    /// object.  This method provides the no-throw exception-safety guarantee
+    /// if neither object holds its elements inline, and the basic guarantee
+    /// otherwise.  The behavior is undefined unless this object was created
+    /// with the same allocator as `other`.
+    void swap(SmallVector& other);
+
+    // ACCESSORS
+
+    /// Return a reference providing non-modifiable access to the element at
+    /// the specified `position`.  The behavior is undefined unless
+    /// `position < size()`.
+    const TYPE& operator[](bsl::size_t position) const;
+
+    /// Return the allocator used by this vector to supply memory.
+    bslma::Allocator *allocator() const;
+
+    /// Return a reference providing non-modifiable access to the element at
+    /// the specified `position`.  Throw `bsl::out_of_range` if
+    /// `position >= size()`.
+    const TYPE& at(bsl::size_t position) const;
+
+    /// Return a reference providing non-modifiable access to the last
+    /// element of this vector.  The behavior is undefined unless this vector
+    /// is not empty.
+    const TYPE& back() const;
+
+    /// Return an iterator to the first element of this vector, or `end()`
+    /// if this vector is empty.
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+
+    /// Return the number of elements this vector can hold without
+    /// allocating memory.  Note that the capacity is never less than
+    /// `INLINE_CAPACITY`.
+    bsl::size_t capacity() const;
+
+    /// Return the past-the-end iterator of this vector.
+    const_iterator end() const;
+    const_iterator cend() const;
+
+    /// Return a reverse iterator to the last element of this vector.
+    const_reverse_iterator crbegin() const;
+    const_reverse_iterator rbegin() const;
+
+    /// Return the past-the-end reverse iterator of this vector.
+    const_reverse_iterator crend() const;
+    const_reverse_iterator rend() const;
+
+    /// Return the address of the first element of this vector.  Note that
+    /// the returned pointer need not be dereferenceable if this vector is
+    /// empty.
+    const TYPE *data() const;
+
+    /// Return `true` if this vector has no elements, and `false` otherwise.
+    bool empty() const;
+
+    /// Return a reference providing non-modifiable access to the first
+    /// element of this vector.  The behavior is undefined unless this vector
+    /// is not empty.
+    const TYPE& front() const;
+
+    /// Return `true` if the elements of this vector are held in its inline
+    /// storage, and `false` if they are held in memory supplied by its
+    /// allocator.
+    bool isInline() const;
+
+    /// Return the maximum possible size of this vector.
+    bsl::size_t max_size() const;
+
+    /// Return the number of elements in this vector.
+    bsl::size_t size() const;
+};
+
+// FREE OPERATORS
+
+/// Return `true` if the specified `lhs` and `rhs` objects have the same
+/// value, and `false` otherwise.  Two `SmallVector` objects have the same
+/// value if they have the same size and corresponding elements compare
+/// equal using `operator==`.  Note that `INLINE_CAPACITY` need not be the
+/// same for `lhs` and `rhs`.
+template <class TYPE, bsl::size_t INLINE_CAPACITY1,
+                      bsl::size_t INLINE_CAPACITY2>
+bool operator==(const SmallVector<TYPE, INLINE_CAPACITY1>& lhs,
+                const SmallVector<TYPE, INLINE_CAPACITY2>& rhs);
+
+/// Return `true` if the specified `lhs` and `rhs` objects do not have the
+/// same value, and `false` otherwise.  Two `SmallVector` objects do not have
+/// the same value if they do not have the same size or any pair of
+/// corresponding elements does not compare equal using `operator==`.
+template <class TYPE, bsl::size_t INLINE_CAPACITY1,
+                      bsl::size_t INLINE_CAPACITY2>
+bool operator!=(const SmallVector<TYPE, INLINE_CAPACITY1>& lhs,
+                const SmallVector<TYPE, INLINE_CAPACITY2>& rhs);
+
+/// Return `true` if the value of the specified `lhs` is lexicographically
+/// less than that of the specified `rhs`, using `operator<` to compare
+/// elements, and `false` otherwise.
+template <class TYPE, bsl::size_t INLINE_CAPACITY1,
+                      bsl::size_t INLINE_CAPACITY2>
+bool operator<(const SmallVector<TYPE, INLINE_CAPACITY1>& lhs,
+               const SmallVector<TYPE, INLINE_CAPACITY2>& rhs);
+
+/// Return `true` if the value of the specified `lhs` is lexicographically
+/// greater than that of the specified `rhs`, using `operator<` to compare
+/// elements, and `false` otherwise.
+template <class TYPE, bsl::size_t INLINE_CAPACITY1,
+                      bsl::size_t INLINE_CAPACITY2>
+bool operator>(const SmallVector<TYPE, INLINE_CAPACITY1>& lhs,
+               const SmallVector<TYPE, INLINE_CAPACITY2>& rhs);
+
+/// Return `true` if the value of the specified `lhs` is lexicographically
+/// less than or equal to that of the specified `rhs`, using `operator<` to
+/// compare elements, and `false` otherwise.
+template <class TYPE, bsl::size_t INLINE_CAPACITY1,
+                      bsl::size_t INLINE_CAPACITY2>
+bool operator<=(const SmallVector<TYPE, INLINE_CAPACITY1>& lhs,
+                const SmallVector<TYPE, INLINE_CAPACITY2>& rhs);
+
+/// Return `true` if the value of the specified `lhs` is lexicographically
+/// greater than or equal to that of the specified `rhs`, using `operator<`
+/// to compare elements, and `false` otherwise.
+template <class TYPE, bsl::size_t INLINE_CAPACITY1,
+                      bsl::size_t INLINE_CAPACITY2>
+bool operator>=(const SmallVector<TYPE, INLINE_CAPACITY1>& lhs,
+                const SmallVector<TYPE, INLINE_CAPACITY2>& rhs);
+
+// FREE FUNCTIONS
+
+/// Exchange the values of the specified `a` and `b` objects.  This function
+/// provides the no-throw exception-safety guarantee if the two objects were
+/// created with the same allocator and neither holds its elements inline,
+/// and the basic guarantee otherwise.
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void swap(SmallVector<TYPE, INLINE_CAPACITY>& a,
+          SmallVector<TYPE, INLINE_CAPACITY>& b);
+
+// ============================================================================
+//                  TEMPLATE AND INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+                         // -------------------------
+                         // class SmallVector_Proctor
+                         // -------------------------
+
+// CREATORS
+template <class VECTOR>
+inline
+SmallVector_Proctor<VECTOR>::SmallVector_Proctor(VECTOR *vector)
+: d_vector_p(vector)
+{
+}
+
+template <class VECTOR>
+inline
+SmallVector_Proctor<VECTOR>::~SmallVector_Proctor()
+{
+    if (d_vector_p) {
+        d_vector_p->destroyAndDeallocate();
+    }
+}
+
+// MANIPULATORS
+template <class VECTOR>
+inline
+void SmallVector_Proctor<VECTOR>::release()
+{
+    d_vector_p = 0;
+}
+
+                            // -----------------
+                            // class SmallVector
+                            // -----------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+bsl::size_t SmallVector<TYPE, INLINE_CAPACITY>::computeNewCapacity(
+                                                      bsl::size_t newSize,
+                                                      bsl::size_t capacity)
+{
+    BSLS_ASSERT_SAFE(capacity < newSize);
+
+    const bsl::size_t maxSize = bsl::numeric_limits<bsl::size_t>::max()
+                                                               / sizeof(TYPE);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(newSize > maxSize)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                                       "SmallVector<...>: vector too long");
+    }
+
+    bsl::size_t newCapacity = capacity <= maxSize / 2
+                            ? capacity * 2
+                            : maxSize;
+
+    return newCapacity < newSize ? newSize : newCapacity;
+}
+
+// PRIVATE MANIPULATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::adopt(SmallVector *other)
+{
+    BSLS_ASSERT_SAFE(d_dataBegin_p == d_dataEnd_p);
+    BSLS_ASSERT_SAFE(!other->isInline());
+    BSLS_ASSERT_SAFE(d_allocator_p == other->d_allocator_p);
+
+    if (!isInline()) {
+        d_allocator_p->deallocate(d_dataBegin_p);
+    }
+
+    d_dataBegin_p = other->d_dataBegin_p;
+    d_dataEnd_p   = other->d_dataEnd_p;
+    d_capacity    = other->d_capacity;
+
+    other->d_dataBegin_p = other->inlineData();
+    other->d_dataEnd_p   = other->d_dataBegin_p;
+    other->d_capacity    = INLINE_CAPACITY;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::destroyAndDeallocate()
+{
+    ArrayDestructionPrimitives::destroy(d_dataBegin_p, d_dataEnd_p);
+    if (!isInline()) {
+        d_allocator_p->deallocate(d_dataBegin_p);
+    }
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITER>
+void SmallVector<TYPE, INLINE_CAPACITY>::insertRange(
+                                           bsl::size_t             index,
+                                           INPUT_ITER              first,
+                                           INPUT_ITER              last,
+                                           bsl::input_iterator_tag)
+{
+    // The length of an input range is not known in advance; collect the
+    // values before inserting them in a single step.
+
+    SmallVector temp(d_allocator_p);
+    for (; first != last; ++first) {
+        temp.push_back(*first);
+    }
+    insertRange(index,
+                temp.d_dataBegin_p,
+                temp.d_dataEnd_p,
+                bsl::forward_iterator_tag());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class FWD_ITER>
+void SmallVector<TYPE, INLINE_CAPACITY>::insertRange(
+                                         bsl::size_t               index,
+                                         FWD_ITER                  first,
+                                         FWD_ITER                  last,
+                                         bsl::forward_iterator_tag)
+{
+    const bsl::size_t numElements = bsl::distance(first, last);
+    const bsl::size_t newSize     = size() + numElements;
+
+    if (newSize <= d_capacity) {
+        ArrayPrimitives::insert(d_dataBegin_p + index,
+                                d_dataEnd_p,
+                                first,
+                                last,
+                                numElements,
+                                d_allocator_p);
+        d_dataEnd_p += numElements;
+        return;                                                       // RETURN
+    }
+
+    SmallVector temp(d_allocator_p);
+    temp.reserveEmpty(computeNewCapacity(newSize, d_capacity));
+
+    ArrayPrimitives::destructiveMoveAndInsert(temp.d_dataBegin_p,
+                                              &d_dataEnd_p,
+                                              d_dataBegin_p,
+                                              d_dataBegin_p + index,
+                                              d_dataEnd_p,
+                                              first,
+                                              last,
+                                              numElements,
+                                              d_allocator_p);
+    temp.d_dataEnd_p += newSize;
+    adopt(&temp);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::reserveEmpty(bsl::size_t numElements)
+{
+    BSLS_ASSERT_SAFE(d_dataBegin_p == d_dataEnd_p);
+    BSLS_ASSERT_SAFE(isInline());
+
+    if (numElements > INLINE_CAPACITY) {
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numElements > max_size())) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            BloombergLP::bslstl::StdExceptUtil::throwLengthError(
+                                       "SmallVector<...>: vector too long");
+        }
+        d_dataBegin_p = static_cast<TYPE *>(
+                         d_allocator_p->allocate(numElements * sizeof(TYPE)));
+        d_dataEnd_p   = d_dataBegin_p;
+        d_capacity    = numElements;
+    }
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+TYPE *SmallVector<TYPE, INLINE_CAPACITY>::inlineData()
+{
+    return reinterpret_cast<TYPE *>(d_inlineBuffer.buffer());
+}
+
+// PRIVATE ACCESSORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+const TYPE *SmallVector<TYPE, INLINE_CAPACITY>::inlineData() const
+{
+    return reinterpret_cast<const TYPE *>(d_inlineBuffer.buffer());
+}
+
+// CREATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector()
+: d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator())
+{
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                              bslma::Allocator *basicAllocator)
+: d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                           bsl::size_t       numElements,
+                                           bslma::Allocator *basicAllocator)
+: d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    reserveEmpty(numElements);
+
+    SmallVector_Proctor<SmallVector> proctor(this);
+    ArrayPrimitives::defaultConstruct(d_dataBegin_p,
+                                      numElements,
+                                      d_allocator_p);
+    d_dataEnd_p += numElements;
+    proctor.release();
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                           bsl::size_t       numElements,
+                                           const TYPE&       value,
+                                           bslma::Allocator *basicAllocator)
+: d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    reserveEmpty(numElements);
+
+    SmallVector_Proctor<SmallVector> proctor(this);
+    ArrayPrimitives::uninitializedFillN(d_dataBegin_p,
+                                        numElements,
+                                        value,
+                                        d_allocator_p);
+    d_dataEnd_p += numElements;
+    proctor.release();
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITER>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+           INPUT_ITER        first,
+           INPUT_ITER        last,
+           bslma::Allocator *basicAllocator,
+           typename bsl::enable_if<!bsl::is_integral<INPUT_ITER>::value>::type
+                                                                            *)
+: d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    SmallVector_Proctor<SmallVector> proctor(this);
+    typedef typename bsl::iterator_traits<INPUT_ITER>::iterator_category Tag;
+
+    insertRange(0, first, last, Tag());
+    proctor.release();
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                   std::initializer_list<TYPE>  values,
+                                   bslma::Allocator            *basicAllocator)
+: d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    reserveEmpty(values.size());
+
+    SmallVector_Proctor<SmallVector> proctor(this);
+    ArrayPrimitives::copyConstruct(d_dataBegin_p,
+                                   values.begin(),
+                                   values.end(),
+                                   d_allocator_p);
+    d_dataEnd_p += values.size();
+    proctor.release();
+}
+#endif
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                         const SmallVector&  original,
+                                         bslma::Allocator   *basicAllocator)
+: d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    reserveEmpty(original.size());
+
+    SmallVector_Proctor<SmallVector> proctor(this);
+    ArrayPrimitives::copyConstruct(d_dataBegin_p,
+                                   original.d_dataBegin_p,
+                                   original.d_dataEnd_p,
+                                   d_allocator_p);
+    d_dataEnd_p += original.size();
+    proctor.release();
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                                       bslmf::MovableRef<SmallVector> original)
+: d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(MoveUtil::access(original).d_allocator_p)
+{
+    SmallVector& lvalue = original;
+
+    if (!lvalue.isInline()) {
+        adopt(&lvalue);
+        return;                                                       // RETURN
+    }
+
+    ArrayPrimitives::moveConstruct(d_dataBegin_p,
+                                   lvalue.d_dataBegin_p,
+                                   lvalue.d_dataEnd_p,
+                                   d_allocator_p);
+    d_dataEnd_p += lvalue.size();
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>::SmallVector(
+                               bslmf::MovableRef<SmallVector>  original,
+                               bslma::Allocator               *basicAllocator)
+: d_dataBegin_p(inlineData())
+, d_dataEnd_p(d_dataBegin_p)
+, d_capacity(INLINE_CAPACITY)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    SmallVector& lvalue = original;
+
+    if (!lvalue.isInline() && d_allocator_p == lvalue.d_allocator_p) {
+        adopt(&lvalue);
+        return;                                                       // RETURN
+    }
+
+    reserveEmpty(lvalue.size());
+
+    SmallVector_Proctor<SmallVector> proctor(this);
+    ArrayPrimitives::moveConstruct(d_dataBegin_p,
+                                   lvalue.d_dataBegin_p,
+                                   lvalue.d_dataEnd_p,
+                                   d_allocator_p);
+    d_dataEnd_p += lvalue.size();
+    proctor.release();
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+SmallVector<TYPE, INLINE_CAPACITY>::~SmallVector()
+{
+    destroyAndDeallocate();
+}
+
+// MANIPULATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>&
+SmallVector<TYPE, INLINE_CAPACITY>::operator=(const SmallVector& rhs)
+{
+    if (this != &rhs) {
+        clear();
+        reserve(rhs.size());
+        ArrayPrimitives::copyConstruct(d_dataBegin_p,
+                                       rhs.d_dataBegin_p,
+                                       rhs.d_dataEnd_p,
+                                       d_allocator_p);
+        d_dataEnd_p += rhs.size();
+    }
+    return *this;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+SmallVector<TYPE, INLINE_CAPACITY>&
+SmallVector<TYPE, INLINE_CAPACITY>::operator=(
+                                            bslmf::MovableRef<SmallVector> rhs)
+{
+    SmallVector& lvalue = rhs;
+
+    if (this != &lvalue) {
+        clear();
+        if (!lvalue.isInline() && d_allocator_p == lvalue.d_allocator_p) {
+            adopt(&lvalue);
+        }
+        else {
+            reserve(lvalue.size());
+            ArrayPrimitives::moveConstruct(d_dataBegin_p,
+                                           lvalue.d_dataBegin_p,
+                                           lvalue.d_dataEnd_p,
+                                           d_allocator_p);
+            d_dataEnd_p += lvalue.size();
+        }
+    }
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+SmallVector<TYPE, INLINE_CAPACITY>&
+SmallVector<TYPE, INLINE_CAPACITY>::operator=(
+                                            std::initializer_list<TYPE> values)
+{
+    assign(values.begin(), values.end());
+    return *this;
+}
+#endif
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+TYPE& SmallVector<TYPE, INLINE_CAPACITY>::operator[](bsl::size_t position)
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_dataBegin_p[position];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::assign(bsl::size_t numElements,
+                                                const TYPE& value)
+{
+    // Assign over the existing elements first, so that `value` remains
+    // valid if it refers to an element of this vector.
+
+    const bsl::size_t numAssigned = numElements < size() ? numElements
+                                                          : size();
+    for (bsl::size_t i = 0; i < numAssigned; ++i) {
+        d_dataBegin_p[i] = value;
+    }
+
+    if (numElements < size()) {
+        erase(d_dataBegin_p + numElements, d_dataEnd_p);
+    }
+    else {
+        insert(d_dataEnd_p, numElements - size(), value);
+    }
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITER>
+inline
+typename bsl::enable_if<!bsl::is_integral<INPUT_ITER>::value>::type
+SmallVector<TYPE, INLINE_CAPACITY>::assign(INPUT_ITER first, INPUT_ITER last)
+{
+    clear();
+    typedef typename bsl::iterator_traits<INPUT_ITER>::iterator_category Tag;
+
+    insertRange(0, first, last, Tag());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+TYPE& SmallVector<TYPE, INLINE_CAPACITY>::at(bsl::size_t position)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                 "SmallVector<...>::at(position): invalid");
+    }
+    return d_dataBegin_p[position];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+TYPE& SmallVector<TYPE, INLINE_CAPACITY>::back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return d_dataEnd_p[-1];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::begin()
+{
+    return d_dataBegin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::clear()
+{
+    ArrayDestructionPrimitives::destroy(d_dataBegin_p, d_dataEnd_p);
+    d_dataEnd_p = d_dataBegin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+TYPE *SmallVector<TYPE, INLINE_CAPACITY>::data()
+{
+    return d_dataBegin_p;
+}
+
+#if !BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class... ARGS>
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::emplace(const_iterator position,
+                                            ARGS&&...      args)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position <= cend());
+
+    const bsl::size_t index = position - d_dataBegin_p;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(size() == d_capacity)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // The new element is constructed before the existing elements are
+        // moved, so `args` may refer to one of them.
+
+        const bsl::size_t newSize = size() + 1;
+
+        SmallVector temp(d_allocator_p);
+        temp.reserveEmpty(computeNewCapacity(newSize, d_capacity));
+
+        ArrayPrimitives::destructiveMoveAndEmplace(
+                                 temp.d_dataBegin_p,
+                                 &d_dataEnd_p,
+                                 d_dataBegin_p,
+                                 d_dataBegin_p + index,
+                                 d_dataEnd_p,
+                                 bsl::allocator<TYPE>(d_allocator_p),
+                                 BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+        temp.d_dataEnd_p += newSize;
+        adopt(&temp);
+        return d_dataBegin_p + index;                                 // RETURN
+    }
+
+    if (d_dataBegin_p + index == d_dataEnd_p) {
+        bslma::ConstructionUtil::construct(
+                                 d_dataEnd_p,
+                                 d_allocator_p,
+                                 BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+        ++d_dataEnd_p;
+        return d_dataBegin_p + index;                                 // RETURN
+    }
+
+    // Construct the new element aside before shifting the tail, as `args`
+    // may refer to an element of the tail.
+
+    bsls::ObjectBuffer<TYPE> buffer;
+    bslma::ConstructionUtil::construct(
+                                 buffer.address(),
+                                 d_allocator_p,
+                                 BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+    bslma::DestructorGuard<TYPE> guard(buffer.address());
+
+    ArrayPrimitives::insert(d_dataBegin_p + index,
+                            d_dataEnd_p,
+                            MoveUtil::move(buffer.object()),
+                            d_allocator_p);
+    ++d_dataEnd_p;
+    return d_dataBegin_p + index;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class... ARGS>
+TYPE& SmallVector<TYPE, INLINE_CAPACITY>::emplace_back(ARGS&&... args)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size() < d_capacity)) {
+        bslma::ConstructionUtil::construct(
+                                 d_dataEnd_p,
+                                 d_allocator_p,
+                                 BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+        ++d_dataEnd_p;
+        return d_dataEnd_p[-1];                                       // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    return *emplace(d_dataEnd_p, BSLS_COMPILERFEATURES_FORWARD(ARGS, args)...);
+}
+#endif
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::end()
+{
+    return d_dataEnd_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position < cend());
+
+    return erase(position, position + 1);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::erase(const_iterator first,
+                                          const_iterator last)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= first);
+    BSLS_ASSERT_SAFE(first <= last);
+    BSLS_ASSERT_SAFE(last <= cend());
+
+    TYPE *from = d_dataBegin_p + (first - d_dataBegin_p);
+    TYPE *to   = d_dataBegin_p + (last  - d_dataBegin_p);
+
+    ArrayPrimitives::erase(from, to, d_dataEnd_p, d_allocator_p);
+    d_dataEnd_p -= to - from;
+    return from;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+TYPE& SmallVector<TYPE, INLINE_CAPACITY>::front()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_dataBegin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::insert(const_iterator position,
+                                           const TYPE&    value)
+{
+    return insert(position, 1, value);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::insert(const_iterator          position,
+                                           bslmf::MovableRef<TYPE> value)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position <= cend());
+
+    const bsl::size_t index = position - d_dataBegin_p;
+
+    if (size() < d_capacity) {
+        ArrayPrimitives::insert(d_dataBegin_p + index,
+                                d_dataEnd_p,
+                                MoveUtil::move(MoveUtil::access(value)),
+                                d_allocator_p);
+        ++d_dataEnd_p;
+        return d_dataBegin_p + index;                                 // RETURN
+    }
+
+    // Move `value` aside before growing, as it may refer to an element of
+    // this vector.
+
+    bsls::ObjectBuffer<TYPE> buffer;
+    bslma::ConstructionUtil::construct(
+                                      buffer.address(),
+                                      d_allocator_p,
+                                      MoveUtil::move(MoveUtil::access(value)));
+    bslma::DestructorGuard<TYPE> guard(buffer.address());
+
+    reserve(computeNewCapacity(size() + 1, d_capacity));
+    ArrayPrimitives::insert(d_dataBegin_p + index,
+                            d_dataEnd_p,
+                            MoveUtil::move(buffer.object()),
+                            d_allocator_p);
+    ++d_dataEnd_p;
+    return d_dataBegin_p + index;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+typename SmallVector<TYPE, INLINE_CAPACITY>::iterator
+SmallVector<TYPE, INLINE_CAPACITY>::insert(const_iterator position,
+                                           bsl::size_t    numElements,
+                                           const TYPE&    value)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position <= cend());
+
+    const bsl::size_t index   = position - d_dataBegin_p;
+    const bsl::size_t newSize = size() + numElements;
+
+    if (newSize <= d_capacity) {
+        ArrayPrimitives::insert(d_dataBegin_p + index,
+                                d_dataEnd_p,
+                                value,
+                                numElements,
+                                d_allocator_p);
+        d_dataEnd_p += numElements;
+        return d_dataBegin_p + index;                                 // RETURN
+    }
+
+    SmallVector temp(d_allocator_p);
+    temp.reserveEmpty(computeNewCapacity(newSize, d_capacity));
+
+    ArrayPrimitives::destructiveMoveAndInsert(temp.d_dataBegin_p,
+                                              &d_dataEnd_p,
+                                              d_dataBegin_p,
+                                              d_dataBegin_p + index,
+                                              d_dataEnd_p,
+                                              value,
+                                              numElements,
+                                              d_allocator_p);
+    temp.d_dataEnd_p += newSize;
+    adopt(&temp);
+    return d_dataBegin_p + index;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+template <class INPUT_ITER>
+inline
+typename bsl::enable_if<!bsl::is_integral<INPUT_ITER>::value,
+                        typename SmallVector<TYPE, INLINE_CAPACITY>::iterator>
+                                                                         ::type
+SmallVector<TYPE, INLINE_CAPACITY>::insert(const_iterator position,
+                                           INPUT_ITER     first,
+                                           INPUT_ITER     last)
+{
+    BSLS_ASSERT_SAFE(cbegin() <= position);
+    BSLS_ASSERT_SAFE(position <= cend());
+
+    const bsl::size_t index = position - d_dataBegin_p;
+
+    typedef typename bsl::iterator_traits<INPUT_ITER>::iterator_category Tag;
+
+    insertRange(index, first, last, Tag());
+    return d_dataBegin_p + index;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+void SmallVector<TYPE, INLINE_CAPACITY>::pop_back()
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    --d_dataEnd_p;
+    bslma::DestructionUtil::destroy(d_dataEnd_p);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::push_back(const TYPE& value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size() < d_capacity)) {
+        bslma::ConstructionUtil::construct(d_dataEnd_p, d_allocator_p, value);
+        ++d_dataEnd_p;
+        return;                                                       // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    insert(d_dataEnd_p, 1, value);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::push_back(
+                                                 bslmf::MovableRef<TYPE> value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(size() < d_capacity)) {
+        bslma::ConstructionUtil::construct(
+                                      d_dataEnd_p,
+                                      d_allocator_p,
+                                      MoveUtil::move(MoveUtil::access(value)));
+        ++d_dataEnd_p;
+        return;                                                       // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    insert(d_dataEnd_p, MoveUtil::move(MoveUtil::access(value)));
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::reverse_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::rbegin()
+{
+    return reverse_iterator(end());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::reverse_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::rend()
+{
+    return reverse_iterator(begin());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::reserve(bsl::size_t numElements)
+{
+    if (numElements <= d_capacity) {
+        return;                                                       // RETURN
+    }
+
+    SmallVector temp(d_allocator_p);
+    temp.reserveEmpty(numElements);
+
+    ArrayPrimitives::destructiveMove(temp.d_dataBegin_p,
+                                     d_dataBegin_p,
+                                     d_dataEnd_p,
+                                     d_allocator_p);
+    temp.d_dataEnd_p += size();
+    d_dataEnd_p       = d_dataBegin_p;
+    adopt(&temp);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::resize(bsl::size_t newSize)
+{
+    if (newSize <= size()) {
+        erase(d_dataBegin_p + newSize, d_dataEnd_p);
+        return;                                                       // RETURN
+    }
+
+    if (newSize <= d_capacity) {
+        ArrayPrimitives::defaultConstruct(d_dataEnd_p,
+                                          newSize - size(),
+                                          d_allocator_p);
+        d_dataEnd_p = d_dataBegin_p + newSize;
+        return;                                                       // RETURN
+    }
+
+    SmallVector temp(d_allocator_p);
+    temp.reserveEmpty(computeNewCapacity(newSize, d_capacity));
+
+    ArrayPrimitives::destructiveMoveAndInsert(temp.d_dataBegin_p,
+                                              &d_dataEnd_p,
+                                              d_dataBegin_p,
+                                              d_dataEnd_p,
+                                              d_dataEnd_p,
+                                              newSize - size(),
+                                              d_allocator_p);
+    temp.d_dataEnd_p += newSize;
+    adopt(&temp);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::resize(bsl::size_t newSize,
+                                                const TYPE& value)
+{
+    if (newSize <= size()) {
+        erase(d_dataBegin_p + newSize, d_dataEnd_p);
+    }
+    else {
+        insert(d_dataEnd_p, newSize - size(), value);
+    }
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::shrink_to_fit()
+{
+    if (isInline() || size() == d_capacity) {
+        return;                                                       // RETURN
+    }
+
+    TYPE              *oldData = d_dataBegin_p;
+    const bsl::size_t  oldSize = size();
+
+    if (oldSize <= INLINE_CAPACITY) {
+        ArrayPrimitives::destructiveMove(inlineData(),
+                                         oldData,
+                                         d_dataEnd_p,
+                                         d_allocator_p);
+        d_dataBegin_p = inlineData();
+        d_dataEnd_p   = d_dataBegin_p + oldSize;
+        d_capacity    = INLINE_CAPACITY;
+        d_allocator_p->deallocate(oldData);
+        return;                                                       // RETURN
+    }
+
+    SmallVector temp(d_allocator_p);
+    temp.reserveEmpty(oldSize);
+
+    ArrayPrimitives::destructiveMove(temp.d_dataBegin_p,
+                                     d_dataBegin_p,
+                                     d_dataEnd_p,
+                                     d_allocator_p);
+    temp.d_dataEnd_p += oldSize;
+    d_dataEnd_p       = d_dataBegin_p;
+    adopt(&temp);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void SmallVector<TYPE, INLINE_CAPACITY>::swap(SmallVector& other)
+{
+    BSLS_ASSERT_SAFE(allocator() == other.allocator());
+
+    if (!isInline() && !other.isInline()) {
+        bsl::swap(d_dataBegin_p, other.d_dataBegin_p);
+        bsl::swap(d_dataEnd_p,   other.d_dataEnd_p);
+        bsl::swap(d_capacity,    other.d_capacity);
+        return;                                                       // RETURN
+    }
+
+    SmallVector temp(MoveUtil::move(*this));
+    *this = MoveUtil::move(other);
+    other = MoveUtil::move(temp);
+}
+
+// ACCESSORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+const TYPE& SmallVector<TYPE, INLINE_CAPACITY>::operator[](
+                                                    bsl::size_t position) const
+{
+    BSLS_ASSERT_SAFE(position < size());
+
+    return d_dataBegin_p[position];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bslma::Allocator *SmallVector<TYPE, INLINE_CAPACITY>::allocator() const
+{
+    return d_allocator_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+const TYPE& SmallVector<TYPE, INLINE_CAPACITY>::at(bsl::size_t position) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(position >= size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                                 "SmallVector<...>::at(position): invalid");
+    }
+    return d_dataBegin_p[position];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+const TYPE& SmallVector<TYPE, INLINE_CAPACITY>::back() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return d_dataEnd_p[-1];
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::begin() const
+{
+    return d_dataBegin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::cbegin() const
+{
+    return d_dataBegin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bsl::size_t SmallVector<TYPE, INLINE_CAPACITY>::capacity() const
+{
+    return d_capacity;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::end() const
+{
+    return d_dataEnd_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::cend() const
+{
+    return d_dataEnd_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reverse_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::crbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reverse_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::rbegin() const
+{
+    return const_reverse_iterator(end());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reverse_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::crend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+typename SmallVector<TYPE, INLINE_CAPACITY>::const_reverse_iterator
+SmallVector<TYPE, INLINE_CAPACITY>::rend() const
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+const TYPE *SmallVector<TYPE, INLINE_CAPACITY>::data() const
+{
+    return d_dataBegin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool SmallVector<TYPE, INLINE_CAPACITY>::empty() const
+{
+    return d_dataBegin_p == d_dataEnd_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+const TYPE& SmallVector<TYPE, INLINE_CAPACITY>::front() const
+{
+    BSLS_ASSERT_SAFE(!empty());
+
+    return *d_dataBegin_p;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bool SmallVector<TYPE, INLINE_CAPACITY>::isInline() const
+{
+    return d_dataBegin_p == inlineData();
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bsl::size_t SmallVector<TYPE, INLINE_CAPACITY>::max_size() const
+{
+    return bsl::numeric_limits<bsl::size_t>::max() / sizeof(TYPE);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+inline
+bsl::size_t SmallVector<TYPE, INLINE_CAPACITY>::size() const
+{
+    return d_dataEnd_p - d_dataBegin_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class TYPE, bsl::size_t INLINE_CAPACITY1,
+                      bsl::size_t INLINE_CAPACITY2>
+inline
+bool bdlc::operator==(const SmallVector<TYPE, INLINE_CAPACITY1>& lhs,
+                      const SmallVector<TYPE, INLINE_CAPACITY2>& rhs)
+{
+    return lhs.size() == rhs.size()
+        && bsl::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY1,
+                      bsl::size_t INLINE_CAPACITY2>
+inline
+bool bdlc::operator!=(const SmallVector<TYPE, INLINE_CAPACITY1>& lhs,
+                      const SmallVector<TYPE, INLINE_CAPACITY2>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY1,
+                      bsl::size_t INLINE_CAPACITY2>
+inline
+bool bdlc::operator<(const SmallVector<TYPE, INLINE_CAPACITY1>& lhs,
+                     const SmallVector<TYPE, INLINE_CAPACITY2>& rhs)
+{
+    return bsl::lexicographical_compare(lhs.begin(),
+                                        lhs.end(),
+                                        rhs.begin(),
+                                        rhs.end());
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY1,
+                      bsl::size_t INLINE_CAPACITY2>
+inline
+bool bdlc::operator>(const SmallVector<TYPE, INLINE_CAPACITY1>& lhs,
+                     const SmallVector<TYPE, INLINE_CAPACITY2>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY1,
+                      bsl::size_t INLINE_CAPACITY2>
+inline
+bool bdlc::operator<=(const SmallVector<TYPE, INLINE_CAPACITY1>& lhs,
+                      const SmallVector<TYPE, INLINE_CAPACITY2>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class TYPE, bsl::size_t INLINE_CAPACITY1,
+                      bsl::size_t INLINE_CAPACITY2>
+inline
+bool bdlc::operator>=(const SmallVector<TYPE, INLINE_CAPACITY1>& lhs,
+                      const SmallVector<TYPE, INLINE_CAPACITY2>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class TYPE, bsl::size_t INLINE_CAPACITY>
+void bdlc::swap(SmallVector<TYPE, INLINE_CAPACITY>& a,
+                SmallVector<TYPE, INLINE_CAPACITY>& b)
+{
+    if (a.allocator() == b.allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    typedef SmallVector<TYPE, INLINE_CAPACITY> Vector;
+
+    Vector futureA(b, a.allocator());
+    Vector futureB(a, b.allocator());
+
+    a.swap(futureA);
+    b.swap(futureB);
+}
+
+}  // close enterprise namespace
+
+#endif // End C++11 code
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
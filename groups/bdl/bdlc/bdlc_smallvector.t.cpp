@@ -0,0 +1,1917 @@
+// bdlc_smallvector.t.cpp                                             -*-C++-*-
+
+#include <bdlc_smallvector.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_systemtime.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iomanip.h>
+#include <bsl_iostream.h>
+#include <bsl_iterator.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+#if defined(BDE_BUILD_TARGET_EXC)
+#include <stdexcept>
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a sequence container that holds up to a
+// fixed number of elements in its own footprint, and moves them to memory
+// supplied by its allocator when it grows past that number.  The primary
+// concerns are that no memory is allocated while the elements fit inline,
+// that the transitions between inline and allocated storage (in both
+// directions) preserve the value of the container and the number of live
+// elements, that the allocator is propagated to elements, and that moves and
+// swaps steal allocated storage but move inline elements one by one.
+//
+// Global Concerns:
+//  - No memory is ever allocated from the global allocator.
+//  - Any allocated memory is always from the object allocator.
+//  - Precondition violations are detected in appropriate build modes.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] SmallVector();
+// [ 2] SmallVector(Allocator *basicAllocator);
+// [ 3] SmallVector(size_t numElements, Allocator *bA = 0);
+// [ 3] SmallVector(size_t numElements, const TYPE&, Allocator *bA = 0);
+// [ 3] SmallVector(INPUT_ITER, INPUT_ITER, Allocator *bA = 0);
+// #if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+// [ 3] SmallVector(initializer_list<TYPE>, Allocator *bA = 0);
+// #endif
+// [ 4] SmallVector(const SmallVector&, Allocator *bA = 0);
+// [ 4] SmallVector(MovableRef<SmallVector>);
+// [ 4] SmallVector(MovableRef<SmallVector>, Allocator *);
+// [ 2] ~SmallVector();
+//
+// MANIPULATORS
+// [ 4] SmallVector& operator=(const SmallVector&);
+// [ 4] SmallVector& operator=(MovableRef<SmallVector>);
+// #if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+// [ 5] SmallVector& operator=(initializer_list<TYPE>);
+// #endif
+// [ 2] TYPE& operator[](size_t);
+// [ 5] void assign(size_t, const TYPE&);
+// [ 5] void assign(INPUT_ITER, INPUT_ITER);
+// [ 5] TYPE& at(size_t);
+// [ 5] TYPE& back();
+// [ 5] iterator begin();
+// [ 2] void clear();
+// [ 5] TYPE *data();
+// [ 7] iterator emplace(const_iterator, ARGS&&...);
+// [ 7] TYPE& emplace_back(ARGS&&...);
+// [ 5] iterator end();
+// [ 5] iterator erase(const_iterator);
+// [ 5] iterator erase(const_iterator, const_iterator);
+// [ 5] TYPE& front();
+// [ 5] iterator insert(const_iterator, const TYPE&);
+// [ 5] iterator insert(const_iterator, MovableRef<TYPE>);
+// [ 5] iterator insert(const_iterator, size_t, const TYPE&);
+// [ 5] iterator insert(const_iterator, INPUT_ITER, INPUT_ITER);
+// [ 2] void pop_back();
+// [ 2] void push_back(const TYPE&);
+// [ 2] void push_back(MovableRef<TYPE>);
+// [ 5] reverse_iterator rbegin();
+// [ 5] reverse_iterator rend();
+// [ 6] void reserve(size_t);
+// [ 6] void resize(size_t);
+// [ 6] void resize(size_t, const TYPE&);
+// [ 6] void shrink_to_fit();
+// [ 4] void swap(SmallVector&);
+//
+// ACCESSORS
+// [ 2] const TYPE& operator[](size_t) const;
+// [ 2] bslma::Allocator *allocator() const;
+// [ 5] const TYPE& at(size_t) const;
+// [ 5] const TYPE& back() const;
+// [ 5] const_iterator begin() const;
+// [ 5] const_iterator cbegin() const;
+// [ 2] size_t capacity() const;
+// [ 5] const_iterator cend() const;
+// [ 5] const_reverse_iterator crbegin() const;
+// [ 5] const_reverse_iterator crend() const;
+// [ 5] const TYPE *data() const;
+// [ 2] bool empty() const;
+// [ 5] const_iterator end() const;
+// [ 5] const TYPE& front() const;
+// [ 2] bool isInline() const;
+// [ 6] size_t max_size() const;
+// [ 5] const_reverse_iterator rbegin() const;
+// [ 5] const_reverse_iterator rend() const;
+// [ 2] size_t size() const;
+//
+// FREE OPERATORS
+// [ 3] bool operator==(const SmallVector&, const SmallVector&);
+// [ 3] bool operator!=(const SmallVector&, const SmallVector&);
+// [ 3] bool operator<(const SmallVector&, const SmallVector&);
+// [ 3] bool operator>(const SmallVector&, const SmallVector&);
+// [ 3] bool operator<=(const SmallVector&, const SmallVector&);
+// [ 3] bool operator>=(const SmallVector&, const SmallVector&);
+//
+// FREE FUNCTIONS
+// [ 4] void swap(SmallVector&, SmallVector&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 8] USAGE EXAMPLE
+// [-1] SMALL VECTOR BENCHMARK
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT  BSLIM_TESTUTIL_ASSERT
+#define ASSERTV BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q  BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P  BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_ BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_ BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_ BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+const bsl::size_t k_INLINE = 4;
+
+typedef bdlc::SmallVector<int, k_INLINE>         Obj;
+typedef bdlc::SmallVector<bsl::string, k_INLINE> StringObj;
+
+BSLMF_ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+BSLMF_ASSERT(!bslmf::IsBitwiseMoveable<Obj>::value);
+
+// ============================================================================
+//                     GLOBAL VARIABLES FOR TESTING
+// ----------------------------------------------------------------------------
+
+bool verbose;
+bool veryVerbose;
+bool veryVeryVerbose;
+bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                       GLOBAL HELPER CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+                               // =============
+                               // class Tracked
+                               // =============
+
+/// This class holds an `int` value and counts the number of its live
+/// instances.  It is *not* bitwise moveable, so that containers of `Tracked`
+/// exercise the element-by-element relocation paths.
+class Tracked {
+
+    // CLASS DATA
+    static int s_numLive;
+
+    // DATA
+    int      d_value;
+    Tracked *d_self_p;  // address of this object, to detect bitwise moves
+
+  public:
+    // CLASS METHODS
+
+    /// Return the number of live `Tracked` objects.
+    static int numLive() { return s_numLive; }
+
+    // CREATORS
+    Tracked() : d_value(0), d_self_p(this) { ++s_numLive; }
+
+    Tracked(int value) : d_value(value), d_self_p(this)             // IMPLICIT
+    {
+        ++s_numLive;
+    }
+
+    Tracked(const Tracked& original)
+    : d_value(original.d_value)
+    , d_self_p(this)
+    {
+        ++s_numLive;
+    }
+
+    ~Tracked()
+    {
+        ASSERT(this == d_self_p);
+        --s_numLive;
+    }
+
+    // MANIPULATORS
+    Tracked& operator=(const Tracked& rhs)
+    {
+        ASSERT(this == d_self_p);
+        d_value = rhs.d_value;
+        return *this;
+    }
+
+    // ACCESSORS
+
+    /// Return `true` if this object has not been moved bitwise.
+    bool isValid() const { return this == d_self_p; }
+
+    /// Return the value of this object.
+    int value() const { return d_value; }
+};
+
+int Tracked::s_numLive = 0;
+
+bool operator==(const Tracked& lhs, const Tracked& rhs)
+{
+    return lhs.value() == rhs.value();
+}
+
+                          // =======================
+                          // class TestInputIterator
+                          // =======================
+
+/// This class adapts a pointer to `const int` to provide only the interface
+/// of an input iterator.
+class TestInputIterator {
+
+    // DATA
+    const int *d_current_p;
+
+  public:
+    // TYPES
+    typedef bsl::input_iterator_tag iterator_category;
+    typedef int                     value_type;
+    typedef bsl::ptrdiff_t          difference_type;
+    typedef const int              *pointer;
+    typedef const int&              reference;
+
+    // CREATORS
+    explicit TestInputIterator(const int *current) : d_current_p(current) {}
+
+    // MANIPULATORS
+    TestInputIterator& operator++()
+    {
+        ++d_current_p;
+        return *this;
+    }
+
+    // ACCESSORS
+    const int& operator*() const { return *d_current_p; }
+
+    bool operator!=(const TestInputIterator& rhs) const
+    {
+        return d_current_p != rhs.d_current_p;
+    }
+
+    bool operator==(const TestInputIterator& rhs) const
+    {
+        return d_current_p == rhs.d_current_p;
+    }
+};
+
+                            // ====================
+                            // class ReservedVector
+                            // ====================
+
+/// This class is a `bsl::vector<int>` whose default constructor reserves
+/// capacity for eight elements, so that the benchmark can time the common
+/// mitigation for short vectors with the same driver function.
+class ReservedVector : public bsl::vector<int> {
+
+  public:
+    // CREATORS
+    ReservedVector() { reserve(8); }
+};
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static unsigned int s_antiOptimization = 0;
+
+/// Return a string value, unique to the specified `i`, that is too long to
+/// be stored in the footprint of a `bsl::string` (so that copying it
+/// allocates memory).
+bsl::string longString(int i)
+{
+    bsl::string result("a string that will not fit in the short buffer: ");
+    result += static_cast<char>('A' + i % 26);
+    result += static_cast<char>('A' + i / 26 % 26);
+    return result;
+}
+
+/// Return `true` if the specified `vector` holds the values `0`, `1`, ...,
+/// `vector.size() - 1` in order, and `false` otherwise.
+template <class VECTOR>
+bool isIota(const VECTOR& vector)
+{
+    for (bsl::size_t i = 0; i < vector.size(); ++i) {
+        if (static_cast<int>(i) != vector[i]) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+/// Return `true` if each element of the specified `vector` is equal to the
+/// specified `value`, and `false` otherwise.
+template <class VECTOR>
+bool allEqual(const VECTOR& vector, int value)
+{
+    for (bsl::size_t i = 0; i < vector.size(); ++i) {
+        if (value != vector[i]) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+/// Return the number of nanoseconds elapsed since the specified `start`.
+double elapsedNanoseconds(const bsls::TimeInterval& start)
+{
+    return static_cast<double>(
+          (bsls::SystemTime::nowMonotonicClock() - start).totalNanoseconds());
+}
+
+/// Return the median time, in nanoseconds, over the specified `numTrials`
+/// trials, of creating an object of the (template parameter) type `VECTOR`,
+/// appending the specified `numElements` integers to it, summing them, and
+/// destroying it, repeated the specified `numIterations` times per trial.
+/// Memory is supplied by the default allocator.
+template <class VECTOR>
+double timeBuildAndDestroy(int numElements, int numIterations, int numTrials)
+{
+    bsl::vector<double> times;
+
+    for (int trial = 0; trial < numTrials; ++trial) {
+        bsls::TimeInterval start = bsls::SystemTime::nowMonotonicClock();
+        for (int it = 0; it < numIterations; ++it) {
+            VECTOR vector;
+            for (int i = 0; i < numElements; ++i) {
+                vector.push_back(i + it);
+            }
+            for (int i = 0; i < numElements; ++i) {
+                s_antiOptimization += static_cast<unsigned int>(vector[i]);
+            }
+        }
+        times.push_back(elapsedNanoseconds(start) / numIterations);
+    }
+
+    bsl::sort(times.begin(), times.end());
+    return times[numTrials / 2];
+}
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace usage {
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Splitting a Line into Fields
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we parse delimited text whose lines rarely contain more than eight
+// fields.  Collecting the fields of each line into a `bdlc::SmallVector`
+// avoids allocating for all but the rare long lines.
+//
+// First, we define a function that splits a line into fields, appending the
+// offset of the start of each field to a `bdlc::SmallVector`:
+// ```
+typedef bdlc::SmallVector<bsl::size_t, 8> FieldOffsets;
+
+void splitFields(FieldOffsets *result, const char *line, char delimiter)
+{
+    result->clear();
+    result->push_back(0);
+    for (bsl::size_t i = 0; line[i]; ++i) {
+        if (delimiter == line[i]) {
+            result->push_back(i + 1);
+        }
+    }
+}
+// ```
+
+}  // close namespace usage
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int            test = argc > 1 ? atoi(argv[1]) : 0;
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    bslma::Default::setDefaultAllocatorRaw(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace usage;
+
+// Then, we create a test allocator, and a `FieldOffsets` object using it:
+// ```
+        bslma::TestAllocator ta;
+        FieldOffsets         offsets(&ta);
+// ```
+// Next, we split a typical line, and observe that no memory was allocated:
+// ```
+        splitFields(&offsets, "IBM,100,25.5", ',');
+
+        ASSERT(3 == offsets.size());
+        ASSERT(4 == offsets[1]);
+        ASSERT(8 == offsets[2]);
+        ASSERT(offsets.isInline());
+        ASSERT(0 == ta.numAllocations());
+// ```
+// Now, we split an unusually long line, which spills the offsets to memory
+// supplied by the allocator:
+// ```
+        splitFields(&offsets, "a,b,c,d,e,f,g,h,i,j", ',');
+
+        ASSERT(10 == offsets.size());
+        ASSERT(!offsets.isInline());
+        ASSERT(1 == ta.numBlocksInUse());
+// ```
+// Finally, we return the offsets to inline storage once they fit again:
+// ```
+        splitFields(&offsets, "x,y", ',');
+        offsets.shrink_to_fit();
+
+        ASSERT(2 == offsets.size());
+        ASSERT(offsets.isInline());
+        ASSERT(0 == ta.numBlocksInUse());
+// ```
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // EMPLACE
+        //
+        // Concerns:
+        // 1. `emplace` constructs the new element, from any number of
+        //    arguments, before the indicated position and returns an iterator
+        //    to it, both when the element fits in the current storage and
+        //    when it does not.
+        //
+        // 2. `emplace_back` appends the new element and returns a reference
+        //    to it.
+        //
+        // 3. The allocator of the vector is passed to the new element.
+        //
+        // 4. The arguments may refer to an element of the vector.
+        //
+        // 5. No element is leaked or destroyed twice, and elements that are
+        //    not bitwise moveable are relocated by their constructors.
+        //
+        // 6. Precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. For each position of a vector of each of several sizes on both
+        //    sides of the inline capacity, emplace `bsl::string` elements
+        //    from zero, one, and two arguments, and compare the result to the
+        //    same operation on a `bsl::vector`.  (C-1..3)
+        //
+        // 2. Emplace, at the front, the middle, and the back, copies of an
+        //    element of the vector, both when the vector is full and when it
+        //    is not.  (C-4)
+        //
+        // 3. Emplace `Tracked` elements, and verify the number of live
+        //    objects and that none was moved bitwise.  (C-5)
+        //
+        // 4. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-6)
+        //
+        // Testing:
+        //   iterator emplace(const_iterator, ARGS&&...);
+        //   TYPE& emplace_back(ARGS&&...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EMPLACE" << endl
+                          << "=======" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const char *LONG = "a string that will not fit in the short buffer";
+
+        if (verbose) cout << "\nTesting `emplace` and `emplace_back`." << endl;
+
+        for (int size = 0; size <= 2 * static_cast<int>(k_INLINE); ++size) {
+            for (int pos = 0; pos <= size; ++pos) {
+                bsl::vector<bsl::string> exp;
+                for (int i = 0; i < size; ++i) {
+                    exp.push_back(longString(i));
+                }
+
+                StringObj mX(exp.begin(), exp.end(), &oa);
+                const StringObj& X = mX;
+
+                exp.insert(exp.begin() + pos, bsl::string(LONG, 10));
+                exp.insert(exp.begin() + pos, bsl::string(40, 'x'));
+                exp.insert(exp.begin() + pos, bsl::string());
+
+                StringObj::iterator it = mX.emplace(X.begin() + pos, LONG, 10);
+                ASSERTV(size, pos, X.begin() + pos == it);
+
+                it = mX.emplace(X.begin() + pos, 40, 'x');
+                ASSERTV(size, pos, X.begin() + pos == it);
+
+                it = mX.emplace(X.begin() + pos);
+                ASSERTV(size, pos, X.begin() + pos == it);
+
+                exp.push_back(bsl::string(LONG));
+                exp.push_back(bsl::string(3, 'y'));
+
+                bsl::string& back1 = mX.emplace_back(LONG);
+                ASSERTV(size, pos, &X.back() == &back1);
+
+                bsl::string& back2 = mX.emplace_back(3, 'y');
+                ASSERTV(size, pos, &X.back() == &back2);
+
+                ASSERTV(size, pos, exp.size() == X.size());
+                ASSERTV(size, pos, bsl::equal(X.begin(), X.end(),
+                                              exp.begin()));
+                ASSERTV(size, pos, (X.size() <= k_INLINE) == X.isInline());
+
+                for (bsl::size_t i = 0; i < X.size(); ++i) {
+                    ASSERTV(size, pos, i,
+                            &oa == X[i].get_allocator().mechanism());
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting aliased arguments." << endl;
+        {
+            for (int size = 1; size <= 2 * static_cast<int>(k_INLINE);
+                                                                     ++size) {
+                StringObj mX(&oa);  const StringObj& X = mX;
+                for (int i = 0; i < size; ++i) {
+                    mX.push_back(longString(i));
+                }
+
+                // Emplace into a vector that is not full, then fill it to its
+                // capacity, so that each of the next emplacements grows it.
+
+                if (X.size() < X.capacity()) {
+                    mX.emplace(X.begin(), X.back());
+                    ASSERTV(size, X.front() == X.back());
+                }
+                while (X.size() < X.capacity()) {
+                    mX.emplace_back(X[0]);
+                }
+                const bsl::string FRONT = X.front();
+                const bsl::string BACK  = X.back();
+
+                mX.emplace_back(X.back());
+                ASSERTV(size, BACK == X.back());
+
+                while (X.size() < X.capacity()) {
+                    mX.emplace_back(X[1]);
+                }
+                mX.emplace(X.begin(), X.back());
+                ASSERTV(size, X.front() == X.back());
+
+                while (X.size() < X.capacity()) {
+                    mX.emplace_back(X[1]);
+                }
+                mX.emplace(X.begin() + X.size() / 2, X.front());
+                ASSERTV(size, X[X.size() / 2] == X.front());
+
+                for (bsl::size_t i = 0; i < X.size(); ++i) {
+                    ASSERTV(size, i, &oa == X[i].get_allocator().mechanism());
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting non-bitwise-moveable elements."
+                          << endl;
+        {
+            typedef bdlc::SmallVector<Tracked, k_INLINE> TrackedObj;
+
+            for (int size = 0; size <= 2 * static_cast<int>(k_INLINE);
+                                                                     ++size) {
+                for (int pos = 0; pos <= size; ++pos) {
+                    {
+                        TrackedObj mX(&oa);  const TrackedObj& X = mX;
+                        for (int i = 0; i < size; ++i) {
+                            mX.emplace_back(i);
+                        }
+                        mX.emplace(X.begin() + pos, -1);
+
+                        ASSERTV(size, pos, size + 1 == Tracked::numLive());
+                        ASSERTV(size, pos, -1 == X[pos].value());
+                        for (int i = 0; i <= size; ++i) {
+                            const int EXP = i < pos ? i : i - 1;
+
+                            ASSERTV(size, pos, i, X[i].isValid());
+                            ASSERTV(size, pos, i,
+                                    i == pos || EXP == X[i].value());
+                        }
+                    }
+                    ASSERTV(size, pos, 0 == Tracked::numLive());
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.push_back(1);
+
+            ASSERT_SAFE_FAIL(mX.emplace(X.end() + 1, 1));
+            ASSERT_SAFE_FAIL(mX.emplace(X.begin() - 1, 1));
+            ASSERT_SAFE_PASS(mX.emplace(X.end(), 1));
+            ASSERT_SAFE_PASS(mX.emplace(X.begin(), 1));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CAPACITY MANAGEMENT
+        //
+        // Concerns:
+        // 1. `reserve` allocates only when the requested capacity exceeds the
+        //    current capacity, and preserves the elements.
+        //
+        // 2. `resize` appends value-initialized elements or copies of the
+        //    supplied value, or erases elements from the end, growing the
+        //    storage as needed.
+        //
+        // 3. `shrink_to_fit` returns the elements to inline storage when they
+        //    fit, releasing all memory, and otherwise reduces the allocated
+        //    capacity to the size.
+        //
+        // 4. The relocations performed by these methods neither leak nor
+        //    double-destroy elements, and move elements that are not bitwise
+        //    moveable by invoking their constructors.
+        //
+        // 5. `reserve` throws `bsl::length_error` for a capacity exceeding
+        //    `max_size()`.
+        //
+        // Plan:
+        // 1. Exercise each method across the inline/allocated boundary, for
+        //    `int` elements and for `Tracked` elements, verifying the value,
+        //    capacity, storage, allocator usage, and number of live elements.
+        //    (C-1..4)
+        //
+        // 2. Call `reserve` with `max_size() + 1` and verify the exception.
+        //    (C-5)
+        //
+        // Testing:
+        //   void reserve(size_t);
+        //   void resize(size_t);
+        //   void resize(size_t, const TYPE&);
+        //   void shrink_to_fit();
+        //   size_t max_size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CAPACITY MANAGEMENT" << endl
+                          << "===================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) cout << "\nTesting `reserve`." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.reserve(k_INLINE);
+            ASSERT(X.isInline());
+            ASSERT(k_INLINE == X.capacity());
+            ASSERT(0 == oa.numAllocations());
+
+            mX.push_back(0);
+            mX.push_back(1);
+            mX.reserve(100);
+            ASSERT(!X.isInline());
+            ASSERT(100 == X.capacity());
+            ASSERT(2 == X.size());
+            ASSERT(isIota(X));
+            ASSERT(1 == oa.numBlocksInUse());
+
+            mX.reserve(50);
+            ASSERT(100 == X.capacity());
+            ASSERT(1 == oa.numAllocations());
+
+            ASSERT(X.max_size() > 0);
+#if defined(BDE_BUILD_TARGET_EXC)
+            bool caught = false;
+            try {
+                mX.reserve(X.max_size() + 1);
+            }
+            catch (const std::length_error&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(2 == X.size());
+            ASSERT(isIota(X));
+#endif
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting `resize`." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.resize(3);
+            ASSERT(3 == X.size());
+            ASSERT(0 == X[0] && 0 == X[1] && 0 == X[2]);
+            ASSERT(0 == oa.numBlocksInUse());
+
+            mX.resize(6, 7);
+            ASSERT(6 == X.size());
+            ASSERT(0 == X[2] && 7 == X[3] && 7 == X[5]);
+            ASSERT(!X.isInline());
+
+            mX.resize(10);
+            ASSERT(10 == X.size());
+            ASSERT(7 == X[5] && 0 == X[6] && 0 == X[9]);
+
+            mX.resize(1, 5);
+            ASSERT(1 == X.size());
+            ASSERT(0 == X[0]);
+
+            mX.resize(0);
+            ASSERT(X.empty());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting `shrink_to_fit`." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.shrink_to_fit();
+            ASSERT(X.isInline());
+
+            for (int i = 0; i < 20; ++i) {
+                mX.push_back(i);
+            }
+            ASSERT(!X.isInline());
+            ASSERT(20 < X.capacity());
+
+            mX.shrink_to_fit();
+            ASSERT(20 == X.capacity());
+            ASSERT(20 == X.size());
+            ASSERT(isIota(X));
+            ASSERT(1 == oa.numBlocksInUse());
+
+            mX.resize(k_INLINE);
+            mX.shrink_to_fit();
+            ASSERT(X.isInline());
+            ASSERT(k_INLINE == X.capacity());
+            ASSERT(k_INLINE == X.size());
+            ASSERT(isIota(X));
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting with non-bitwise-moveable type."
+                          << endl;
+        {
+            typedef bdlc::SmallVector<Tracked, k_INLINE> TrackedObj;
+
+            {
+                TrackedObj mX(&oa);  const TrackedObj& X = mX;
+
+                for (int i = 0; i < 10; ++i) {
+                    mX.push_back(Tracked(i));
+                    ASSERT(static_cast<int>(X.size()) == Tracked::numLive());
+                }
+                mX.reserve(40);
+                mX.resize(12);
+                mX.resize(15, Tracked(3));
+                ASSERT(15 == Tracked::numLive());
+                mX.resize(2);
+                ASSERT(2 == Tracked::numLive());
+                mX.shrink_to_fit();
+                ASSERT(X.isInline());
+                ASSERT(2 == Tracked::numLive());
+
+                for (bsl::size_t i = 0; i < X.size(); ++i) {
+                    ASSERTV(i, X[i].isValid());
+                    ASSERTV(i, static_cast<int>(i) == X[i].value());
+                }
+            }
+            ASSERT(0 == Tracked::numLive());
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // INSERT, ERASE, ASSIGN, AND ELEMENT ACCESS
+        //
+        // Concerns:
+        // 1. `insert` places the new elements before the indicated position
+        //    and returns an iterator to the first of them, both when the
+        //    elements fit in the current storage and when they do not.
+        //
+        // 2. `insert` and `assign` of copies of a value accept a value that
+        //    refers to an element of the vector.
+        //
+        // 3. `insert` of a range accepts input and forward iterators.
+        //
+        // 4. `erase` removes exactly the indicated elements and returns an
+        //    iterator to the element that followed them.
+        //
+        // 5. `assign` replaces the value of the vector.
+        //
+        // 6. The element accessors and iterators refer to the elements in
+        //    order; `at` throws `bsl::out_of_range` for an invalid position.
+        //
+        // 7. Precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. For each position of a vector of each of several sizes on both
+        //    sides of the inline capacity, insert values with each `insert`
+        //    overload and compare the result to the same operation on a
+        //    `bsl::vector`.  (C-1, 3)
+        //
+        // 2. Insert and assign copies of an element of the vector itself.
+        //    (C-2)
+        //
+        // 3. Erase single elements and ranges, comparing to `bsl::vector`.
+        //    (C-4)
+        //
+        // 4. Exercise `assign` and the accessors directly.  (C-5..6)
+        //
+        // 5. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   SmallVector& operator=(initializer_list<TYPE>);
+        //   void assign(size_t, const TYPE&);
+        //   void assign(INPUT_ITER, INPUT_ITER);
+        //   TYPE& at(size_t);
+        //   TYPE& back();
+        //   iterator begin();
+        //   TYPE *data();
+        //   iterator end();
+        //   iterator erase(const_iterator);
+        //   iterator erase(const_iterator, const_iterator);
+        //   TYPE& front();
+        //   iterator insert(const_iterator, const TYPE&);
+        //   iterator insert(const_iterator, MovableRef<TYPE>);
+        //   iterator insert(const_iterator, size_t, const TYPE&);
+        //   iterator insert(const_iterator, INPUT_ITER, INPUT_ITER);
+        //   reverse_iterator rbegin();
+        //   reverse_iterator rend();
+        //   const TYPE& at(size_t) const;
+        //   const TYPE& back() const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator cend() const;
+        //   const_reverse_iterator crbegin() const;
+        //   const_reverse_iterator crend() const;
+        //   const TYPE *data() const;
+        //   const_iterator end() const;
+        //   const TYPE& front() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator rend() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "INSERT, ERASE, ASSIGN, AND ELEMENT ACCESS"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const int VALUES[]   = { 100, 101, 102, 103, 104, 105, 106 };
+        const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        if (verbose) cout << "\nTesting `insert`." << endl;
+
+        for (int size = 0; size <= 2 * static_cast<int>(k_INLINE); ++size) {
+            for (int pos = 0; pos <= size; ++pos) {
+                for (int n = 0; n <= NUM_VALUES; ++n) {
+                    bsl::vector<int> exp;
+                    for (int i = 0; i < size; ++i) {
+                        exp.push_back(i);
+                    }
+
+                    Obj mA(exp.begin(), exp.end(), &oa);
+                    Obj mB(exp.begin(), exp.end(), &oa);
+                    Obj mC(exp.begin(), exp.end(), &oa);
+
+                    bsl::vector<int> expRange(exp);
+                    expRange.insert(expRange.begin() + pos,
+                                    VALUES,
+                                    VALUES + n);
+                    bsl::vector<int> expFill(exp);
+                    expFill.insert(expFill.begin() + pos, n, 42);
+
+                    Obj::iterator itA = mA.insert(mA.begin() + pos,
+                                                  VALUES,
+                                                  VALUES + n);
+                    Obj::iterator itB = mB.insert(
+                                                mB.begin() + pos,
+                                                TestInputIterator(VALUES),
+                                                TestInputIterator(VALUES + n));
+                    Obj::iterator itC = mC.insert(mC.begin() + pos,
+                                                  static_cast<size_t>(n),
+                                                  42);
+
+                    ASSERTV(size, pos, n, mA.begin() + pos == itA);
+                    ASSERTV(size, pos, n, mB.begin() + pos == itB);
+                    ASSERTV(size, pos, n, mC.begin() + pos == itC);
+                    ASSERTV(size, pos, n, expRange.size() == mA.size());
+                    ASSERTV(size, pos, n,
+                            bsl::equal(mA.begin(), mA.end(),
+                                       expRange.begin()));
+                    ASSERTV(size, pos, n,
+                            bsl::equal(mB.begin(), mB.end(),
+                                       expRange.begin()));
+                    ASSERTV(size, pos, n, expFill.size() == mC.size());
+                    ASSERTV(size, pos, n,
+                            bsl::equal(mC.begin(), mC.end(),
+                                       expFill.begin()));
+                    ASSERTV(size, pos, n,
+                            (mA.size() <= k_INLINE) == mA.isInline());
+                }
+
+                bsl::vector<int> exp;
+                for (int i = 0; i < size; ++i) {
+                    exp.push_back(i);
+                }
+                Obj mX(exp.begin(), exp.end(), &oa);
+                Obj mY(exp.begin(), exp.end(), &oa);
+
+                exp.insert(exp.begin() + pos, 42);
+
+                int value = 42;
+                Obj::iterator itX = mX.insert(mX.begin() + pos, value);
+                Obj::iterator itY = mY.insert(mY.begin() + pos,
+                                              bslmf::MovableRefUtil::move(
+                                                                      value));
+
+                ASSERTV(size, pos, mX.begin() + pos == itX);
+                ASSERTV(size, pos, mY.begin() + pos == itY);
+                ASSERTV(size, pos, bsl::equal(mX.begin(), mX.end(),
+                                              exp.begin()));
+                ASSERTV(size, pos, bsl::equal(mY.begin(), mY.end(),
+                                              exp.begin()));
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting aliased values." << endl;
+        {
+            for (int size = 1; size <= 2 * static_cast<int>(k_INLINE);
+                                                                     ++size) {
+                StringObj mX(&oa);  const StringObj& X = mX;
+                for (int i = 0; i < size; ++i) {
+                    mX.push_back(longString(i));
+                }
+
+                // Fill the vector to its capacity, so that the next insertion
+                // grows it.
+
+                while (X.size() < X.capacity()) {
+                    mX.push_back(longString(0));
+                }
+                const bsl::size_t SIZE = X.size();
+
+                mX.push_back(X[SIZE - 1]);
+                ASSERTV(size, X[SIZE] == X[SIZE - 1]);
+
+                mX.insert(X.begin(), X[SIZE]);
+                ASSERTV(size, X[0] == X[SIZE]);
+
+                mX.insert(X.begin() + 1, 3, X.back());
+                ASSERTV(size, X[1] == X.back());
+                ASSERTV(size, X[3] == X.back());
+
+                mX.insert(X.begin(), 2 * X.capacity(), X[2]);
+                ASSERTV(size, X.front() == X.back());
+
+                mX.assign(3, X[4]);
+                ASSERTV(size, 3 == X.size());
+                ASSERTV(size, X[0] == X.back());
+
+                for (bsl::size_t i = 0; i < X.size(); ++i) {
+                    ASSERTV(size, i, &oa == X[i].get_allocator().mechanism());
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting `erase`." << endl;
+
+        for (int size = 1; size <= 2 * static_cast<int>(k_INLINE); ++size) {
+            for (int first = 0; first <= size; ++first) {
+                for (int last = first; last <= size; ++last) {
+                    bsl::vector<int> exp;
+                    for (int i = 0; i < size; ++i) {
+                        exp.push_back(i);
+                    }
+                    Obj mX(exp.begin(), exp.end(), &oa);
+
+                    exp.erase(exp.begin() + first, exp.begin() + last);
+                    Obj::iterator it = mX.erase(mX.begin() + first,
+                                                mX.begin() + last);
+
+                    ASSERTV(size, first, last, mX.begin() + first == it);
+                    ASSERTV(size, first, last, exp.size() == mX.size());
+                    ASSERTV(size, first, last,
+                            bsl::equal(mX.begin(), mX.end(), exp.begin()));
+
+                    if (first < static_cast<int>(mX.size())) {
+                        exp.erase(exp.begin() + first);
+                        it = mX.erase(mX.begin() + first);
+
+                        ASSERTV(size, first, mX.begin() + first == it);
+                        ASSERTV(size, first,
+                                bsl::equal(mX.begin(), mX.end(),
+                                           exp.begin()));
+                    }
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting `assign`." << endl;
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            mX.assign(VALUES, VALUES + 3);
+            ASSERT(3 == X.size());
+            ASSERT(100 == X[0] && 102 == X[2]);
+
+            mX.assign(TestInputIterator(VALUES),
+                      TestInputIterator(VALUES + NUM_VALUES));
+            ASSERT(NUM_VALUES == static_cast<int>(X.size()));
+            ASSERT(bsl::equal(X.begin(), X.end(), VALUES));
+
+            mX.assign(2, 9);
+            ASSERT(2 == X.size());
+            ASSERT(9 == X[0] && 9 == X[1]);
+
+            mX.assign(10, 8);
+            ASSERT(10 == X.size());
+            ASSERT(8 == X[0] && 8 == X[9]);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            mX = { 5, 6, 7 };
+            ASSERT(3 == X.size());
+            ASSERT(5 == X[0] && 7 == X[2]);
+#endif
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting element access." << endl;
+        {
+            Obj mX(VALUES, VALUES + 3, &oa);  const Obj& X = mX;
+
+            ASSERT(100 == mX.front());
+            ASSERT(100 == X.front());
+            ASSERT(102 == mX.back());
+            ASSERT(102 == X.back());
+            ASSERT(101 == mX.at(1));
+            ASSERT(101 == X.at(1));
+            ASSERT(&mX[0] == mX.data());
+            ASSERT(&X[0]  == X.data());
+            ASSERT(mX.data() + 3 == mX.end());
+            ASSERT(X.begin()     == X.cbegin());
+            ASSERT(X.end()       == X.cend());
+
+            ASSERT(102 == *mX.rbegin());
+            ASSERT(102 == *X.rbegin());
+            ASSERT(102 == *X.crbegin());
+            ASSERT(3 == bsl::distance(mX.rbegin(), mX.rend()));
+            ASSERT(3 == bsl::distance(X.rbegin(),  X.rend()));
+            ASSERT(3 == bsl::distance(X.crbegin(), X.crend()));
+
+            mX.front() = 1;
+            mX.back()  = 3;
+            mX.at(1)   = 2;
+            ASSERT(1 == X[0] && 2 == X[1] && 3 == X[2]);
+
+#if defined(BDE_BUILD_TARGET_EXC)
+            bool caught = false;
+            try {
+                s_antiOptimization += X.at(3);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+#endif
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT_SAFE_FAIL(mX.front());
+            ASSERT_SAFE_FAIL(X.back());
+            ASSERT_SAFE_FAIL(mX.pop_back());
+            ASSERT_SAFE_FAIL(mX[0]);
+            ASSERT_SAFE_FAIL(mX.erase(X.begin()));
+
+            mX.push_back(1);
+
+            ASSERT_SAFE_PASS(mX.front());
+            ASSERT_SAFE_PASS(X.back());
+            ASSERT_SAFE_PASS(mX[0]);
+            ASSERT_SAFE_FAIL(X[1]);
+            ASSERT_SAFE_FAIL(mX.erase(X.end()));
+            ASSERT_SAFE_FAIL(mX.erase(X.end(), X.begin()));
+            ASSERT_SAFE_FAIL(mX.insert(X.end() + 1, 1));
+            ASSERT_SAFE_PASS(mX.erase(X.begin()));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, ASSIGNMENT, AND SWAP
+        //
+        // Concerns:
+        // 1. The copy constructor creates an object having the same value
+        //    using the supplied (or default) allocator.
+        //
+        // 2. The move constructor steals the storage of an object whose
+        //    elements are not held inline, allocating nothing, and moves the
+        //    elements of an object whose elements are held inline; the
+        //    allocator of the source is propagated.
+        //
+        // 3. The extended move constructor steals storage only when the
+        //    allocators match.
+        //
+        // 4. Copy and move assignment give the target the value of the
+        //    source, and do not change the allocator of the target; move
+        //    assignment steals storage only when the allocators match.
+        //
+        // 5. Self-assignment does not change the value.
+        //
+        // 6. `swap` exchanges the values of two objects, in constant time if
+        //    neither holds its elements inline, for each combination of
+        //    inline and allocated storage.  The free `swap` also accepts
+        //    objects having different allocators.
+        //
+        // 7. Precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. For vectors of `bsl::string` of sizes on both sides of the
+        //    inline capacity, create copies and moves with each constructor,
+        //    and verify value, storage, and allocator usage.  (C-1..3)
+        //
+        // 2. Assign between all pairs of such vectors, with the same and with
+        //    different allocators.  (C-4..5)
+        //
+        // 3. Swap all pairs of such vectors with the member and the free
+        //    function.  (C-6)
+        //
+        // 4. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   SmallVector(const SmallVector&, Allocator *bA = 0);
+        //   SmallVector(MovableRef<SmallVector>);
+        //   SmallVector(MovableRef<SmallVector>, Allocator *);
+        //   SmallVector& operator=(const SmallVector&);
+        //   SmallVector& operator=(MovableRef<SmallVector>);
+        //   void swap(SmallVector&);
+        //   void swap(SmallVector&, SmallVector&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "COPY, MOVE, ASSIGNMENT, AND SWAP" << endl
+                          << "================================" << endl;
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        const int SIZES[]   = { 0, 1, 3, 4, 5, 9 };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        if (verbose) cout << "\nTesting copy and move construction." << endl;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE = SIZES[ti];
+
+            StringObj mW(&oa);  const StringObj& W = mW;
+            for (int i = 0; i < SIZE; ++i) {
+                mW.push_back(longString(i));
+            }
+            const bool INLINE = SIZE <= static_cast<int>(k_INLINE);
+
+            {
+                StringObj mX(W, &sa);  const StringObj& X = mX;
+
+                ASSERTV(SIZE, W == X);
+                ASSERTV(SIZE, &sa == X.allocator());
+                ASSERTV(SIZE, INLINE == X.isInline());
+                for (int i = 0; i < SIZE; ++i) {
+                    ASSERTV(SIZE, i, &sa == X[i].get_allocator().mechanism());
+                }
+
+                StringObj mY(W);  const StringObj& Y = mY;
+                ASSERTV(SIZE, W == Y);
+                ASSERTV(SIZE, &da == Y.allocator());
+            }
+            ASSERTV(SIZE, 0 == sa.numBlocksInUse());
+            ASSERTV(SIZE, 0 == da.numBlocksInUse());
+
+            {
+                StringObj mZ(W, &oa);  const StringObj& Z = mZ;
+
+                const bsls::Types::Int64 NUM_ALLOCS = oa.numAllocations();
+                const char *DATA = Z.data()->data();
+
+                StringObj mX(MoveUtil::move(mZ));  const StringObj& X = mX;
+
+                ASSERTV(SIZE, W == X);
+                ASSERTV(SIZE, &oa == X.allocator());
+                ASSERTV(SIZE, INLINE == X.isInline());
+                ASSERTV(SIZE, NUM_ALLOCS == oa.numAllocations());
+                if (SIZE) {
+                    ASSERTV(SIZE, DATA == X.data()->data());
+                }
+                if (!INLINE) {
+                    ASSERTV(SIZE, Z.empty());
+                    ASSERTV(SIZE, Z.isInline());
+                }
+            }
+
+            {
+                StringObj mZ(W, &oa);
+
+                const bsls::Types::Int64 NUM_ALLOCS = oa.numAllocations();
+
+                StringObj mX(MoveUtil::move(mZ), &oa);
+                const StringObj& X = mX;
+
+                ASSERTV(SIZE, W == X);
+                ASSERTV(SIZE, NUM_ALLOCS == oa.numAllocations());
+
+                StringObj mY(MoveUtil::move(mX), &sa);
+                const StringObj& Y = mY;
+
+                ASSERTV(SIZE, W == Y);
+                ASSERTV(SIZE, &sa == Y.allocator());
+                for (int i = 0; i < SIZE; ++i) {
+                    ASSERTV(SIZE, i, &sa == Y[i].get_allocator().mechanism());
+                }
+            }
+            ASSERTV(SIZE, 0 == sa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting assignment and swap." << endl;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int ISIZE = SIZES[ti];
+
+            StringObj mW(&oa);  const StringObj& W = mW;
+            for (int i = 0; i < ISIZE; ++i) {
+                mW.push_back(longString(i));
+            }
+
+            for (int tj = 0; tj < NUM_SIZES; ++tj) {
+                const int JSIZE = SIZES[tj];
+
+                StringObj mV(&oa);  const StringObj& V = mV;
+                for (int i = 0; i < JSIZE; ++i) {
+                    mV.push_back(longString(100 + i));
+                }
+
+                ASSERTV(ISIZE, JSIZE, (0 == ISIZE && 0 == JSIZE) == (W == V));
+
+                for (int cross = 0; cross < 2; ++cross) {
+                    bslma::TestAllocator& xa = cross ? sa : oa;
+
+                    {
+                        StringObj mX(V, &xa);  const StringObj& X = mX;
+
+                        mX = W;
+                        ASSERTV(ISIZE, JSIZE, W == X);
+                        ASSERTV(ISIZE, JSIZE, &xa == X.allocator());
+
+                        mX = X;
+                        ASSERTV(ISIZE, JSIZE, W == X);
+                    }
+                    {
+                        StringObj mX(V, &xa);  const StringObj& X = mX;
+                        StringObj mZ(W, &oa);
+
+                        mX = MoveUtil::move(mZ);
+                        ASSERTV(ISIZE, JSIZE, W == X);
+                        ASSERTV(ISIZE, JSIZE, &xa == X.allocator());
+                        for (bsl::size_t i = 0; i < X.size(); ++i) {
+                            ASSERTV(ISIZE, JSIZE, i,
+                                    &xa == X[i].get_allocator().mechanism());
+                        }
+                    }
+                    {
+                        StringObj mX(W, &oa);  const StringObj& X = mX;
+                        StringObj mY(V, &xa);  const StringObj& Y = mY;
+
+                        if (!cross) {
+                            mX.swap(mY);
+                            ASSERTV(ISIZE, JSIZE, V == X);
+                            ASSERTV(ISIZE, JSIZE, W == Y);
+                        }
+
+                        swap(mX, mY);
+                        ASSERTV(ISIZE, JSIZE, cross ? V == X : W == X);
+                        ASSERTV(ISIZE, JSIZE, cross ? W == Y : V == Y);
+                        ASSERTV(ISIZE, JSIZE, &oa == X.allocator());
+                        ASSERTV(ISIZE, JSIZE, &xa == Y.allocator());
+                    }
+                }
+            }
+        }
+        ASSERT(0 == sa.numBlocksInUse());
+        ASSERT(0 == da.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting that `swap` steals storage." << endl;
+        {
+            StringObj mX(&oa);  const StringObj& X = mX;
+            StringObj mY(&oa);  const StringObj& Y = mY;
+
+            mX.resize(10);
+            mY.resize(20);
+
+            const bsl::string *DATA_X = X.data();
+            const bsl::string *DATA_Y = Y.data();
+
+            const bsls::Types::Int64 NUM_ALLOCS = oa.numAllocations();
+
+            mX.swap(mY);
+            ASSERT(DATA_Y == X.data());
+            ASSERT(DATA_X == Y.data());
+            ASSERT(NUM_ALLOCS == oa.numAllocations());
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            StringObj mX(&oa);
+            StringObj mY(&oa);
+            StringObj mZ(&sa);
+
+            ASSERT_SAFE_PASS(mX.swap(mY));
+            ASSERT_SAFE_FAIL(mX.swap(mZ));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // VALUE CONSTRUCTORS AND COMPARISON OPERATORS
+        //
+        // Concerns:
+        // 1. Each value constructor creates a vector of the expected value,
+        //    allocating only if that value does not fit inline.
+        //
+        // 2. The range constructor accepts input and forward iterators, and
+        //    is not selected for two integral arguments.
+        //
+        // 3. Two vectors compare equal if and only if they have the same
+        //    elements in the same order, regardless of their inline
+        //    capacities, and the relational operators provide a
+        //    lexicographical order.
+        //
+        // Plan:
+        // 1. Create vectors of sizes on both sides of the inline capacity
+        //    with each constructor, and verify their value and allocator
+        //    usage.  (C-1..2)
+        //
+        // 2. Compare all pairs of a set of vectors ordered lexicographically.
+        //    (C-3)
+        //
+        // Testing:
+        //   SmallVector(size_t numElements, Allocator *bA = 0);
+        //   SmallVector(size_t numElements, const TYPE&, Allocator *bA = 0);
+        //   SmallVector(INPUT_ITER, INPUT_ITER, Allocator *bA = 0);
+        //   SmallVector(initializer_list<TYPE>, Allocator *bA = 0);
+        //   bool operator==(const SmallVector&, const SmallVector&);
+        //   bool operator!=(const SmallVector&, const SmallVector&);
+        //   bool operator<(const SmallVector&, const SmallVector&);
+        //   bool operator>(const SmallVector&, const SmallVector&);
+        //   bool operator<=(const SmallVector&, const SmallVector&);
+        //   bool operator>=(const SmallVector&, const SmallVector&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VALUE CONSTRUCTORS AND COMPARISON OPERATORS"
+                          << endl
+                          << "==========================================="
+                          << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        const int DATA[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+        if (verbose) cout << "\nTesting value constructors." << endl;
+
+        for (int size = 0; size <= 10; ++size) {
+            const bool INLINE = size <= static_cast<int>(k_INLINE);
+            const bsls::Types::Int64 ALLOCS = INLINE ? 0 : 1;
+
+            {
+                const Obj X(static_cast<bsl::size_t>(size), &oa);
+                ASSERTV(size, static_cast<int>(X.size()) == size);
+                ASSERTV(size, allEqual(X, 0));
+                ASSERTV(size, INLINE == X.isInline());
+                ASSERTV(size, ALLOCS == oa.numBlocksInUse());
+            }
+            {
+                const Obj X(size, 7, &oa);
+                ASSERTV(size, static_cast<int>(X.size()) == size);
+                ASSERTV(size, allEqual(X, 7));
+                ASSERTV(size, ALLOCS == oa.numBlocksInUse());
+            }
+            {
+                const Obj X(DATA, DATA + size, &oa);
+                ASSERTV(size, static_cast<int>(X.size()) == size);
+                ASSERTV(size, isIota(X));
+                ASSERTV(size, ALLOCS == oa.numBlocksInUse());
+            }
+            {
+                const Obj X(TestInputIterator(DATA),
+                            TestInputIterator(DATA + size),
+                            &oa);
+                ASSERTV(size, static_cast<int>(X.size()) == size);
+                ASSERTV(size, isIota(X));
+                ASSERTV(size, ALLOCS == oa.numBlocksInUse());
+            }
+            ASSERTV(size, 0 == oa.numBlocksInUse());
+        }
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            const Obj X({ 0, 1, 2 }, &oa);
+            ASSERT(3 == X.size());
+            ASSERT(isIota(X));
+            ASSERT(0 == oa.numBlocksInUse());
+
+            const Obj Y({ 0, 1, 2, 3, 4, 5 }, &oa);
+            ASSERT(6 == Y.size());
+            ASSERT(isIota(Y));
+            ASSERT(1 == oa.numBlocksInUse());
+        }
+#endif
+
+        if (verbose) cout << "\nTesting comparison operators." << endl;
+        {
+            // Sequences in lexicographical order.
+
+            static const struct {
+                int d_line;
+                int d_size;
+                int d_values[8];
+            } SEQS[] = {
+                { L_, 0, { 0 } },
+                { L_, 1, { 0 } },
+                { L_, 6, { 0, 0, 0, 0, 0, 0 } },
+                { L_, 2, { 0, 1 } },
+                { L_, 5, { 0, 1, 2, 3, 4 } },
+                { L_, 1, { 1 } },
+                { L_, 4, { 1, 0, 0, 0 } },
+                { L_, 8, { 2, 0, 0, 0, 0, 0, 0, 0 } },
+            };
+            const int NUM_SEQS = sizeof SEQS / sizeof *SEQS;
+
+            typedef bdlc::SmallVector<int, 2> OtherObj;
+
+            for (int i = 0; i < NUM_SEQS; ++i) {
+                const Obj X(SEQS[i].d_values,
+                            SEQS[i].d_values + SEQS[i].d_size,
+                            &oa);
+                for (int j = 0; j < NUM_SEQS; ++j) {
+                    const OtherObj Y(SEQS[j].d_values,
+                                     SEQS[j].d_values + SEQS[j].d_size,
+                                     &oa);
+
+                    ASSERTV(i, j, (i == j) == (X == Y));
+                    ASSERTV(i, j, (i != j) == (X != Y));
+                    ASSERTV(i, j, (i <  j) == (X <  Y));
+                    ASSERTV(i, j, (i >  j) == (X >  Y));
+                    ASSERTV(i, j, (i <= j) == (X <= Y));
+                    ASSERTV(i, j, (i >= j) == (X >= Y));
+                }
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        // 1. A default-constructed vector is empty, holds its (absent)
+        //    elements inline, has capacity `INLINE_CAPACITY`, and uses the
+        //    supplied (or default) allocator.
+        //
+        // 2. `push_back` appends elements without allocating while the size
+        //    does not exceed `INLINE_CAPACITY`, and spills to exactly one
+        //    block from the object allocator when it does.
+        //
+        // 3. The allocator of the vector is passed to its elements.
+        //
+        // 4. `pop_back` and `clear` destroy elements but keep the storage.
+        //
+        // 5. The destructor destroys all elements and releases all memory.
+        //
+        // Plan:
+        // 1. Create vectors with each constructor and verify their
+        //    attributes.  (C-1)
+        //
+        // 2. Append `bsl::string` elements, by copy and by move, verifying the
+        //    accessors and the allocator usage after each operation.
+        //    (C-2..5)
+        //
+        // Testing:
+        //   SmallVector();
+        //   SmallVector(Allocator *basicAllocator);
+        //   ~SmallVector();
+        //   TYPE& operator[](size_t);
+        //   void clear();
+        //   void pop_back();
+        //   void push_back(const TYPE&);
+        //   void push_back(MovableRef<TYPE>);
+        //   const TYPE& operator[](size_t) const;
+        //   bslma::Allocator *allocator() const;
+        //   size_t capacity() const;
+        //   bool empty() const;
+        //   bool isInline() const;
+        //   size_t size() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS AND BASIC ACCESSORS"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator da("default", veryVeryVeryVerbose);
+
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        if (verbose) cout << "\nTesting default construction." << endl;
+        {
+            const Obj X;
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(k_INLINE == X.capacity());
+            ASSERT(X.isInline());
+            ASSERT(&da == X.allocator());
+
+            const Obj Y(&oa);
+            ASSERT(Y.empty());
+            ASSERT(&oa == Y.allocator());
+
+            const Obj Z(static_cast<bslma::Allocator *>(0));
+            ASSERT(&da == Z.allocator());
+        }
+        ASSERT(0 == da.numAllocations());
+        ASSERT(0 == oa.numAllocations());
+
+        if (verbose) cout << "\nTesting `push_back`." << endl;
+
+        for (int move = 0; move < 2; ++move) {
+            {
+                StringObj mX(&oa);  const StringObj& X = mX;
+
+                for (int i = 0; i < 20; ++i) {
+                    bsl::string value(longString(i), &da);
+
+                    const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksInUse();
+                    const bsl::size_t        CAPACITY   = X.capacity();
+
+                    if (move) {
+                        mX.push_back(bslmf::MovableRefUtil::move(value));
+                    }
+                    else {
+                        mX.push_back(value);
+                    }
+
+                    ASSERTV(move, i, static_cast<int>(X.size()) == i + 1);
+                    ASSERTV(move, i, !X.empty());
+                    ASSERTV(move, i, longString(i) == X[i]);
+                    ASSERTV(move, i,
+                            &oa == X[i].get_allocator().mechanism());
+                    ASSERTV(move, i,
+                            (i < static_cast<int>(k_INLINE)) == X.isInline());
+
+                    // One block for the element, plus one for the new storage
+                    // if the vector grew, minus one for the old storage if
+                    // it was allocated.
+
+                    const bool GREW    = X.capacity() != CAPACITY;
+                    const bool WAS_OUT = CAPACITY != k_INLINE;
+
+                    ASSERTV(move, i, NUM_BLOCKS + 1 + GREW - (GREW && WAS_OUT)
+                                                      == oa.numBlocksInUse());
+                    if (i < static_cast<int>(k_INLINE)) {
+                        ASSERTV(move, i, k_INLINE == X.capacity());
+                    }
+                }
+
+                for (int i = 0; i < 20; ++i) {
+                    ASSERTV(move, i, longString(i) == X[i]);
+                }
+
+                mX[0] = "x";
+                ASSERT("x" == X[0]);
+
+                const bsl::size_t CAPACITY = X.capacity();
+
+                mX.pop_back();
+                ASSERT(19 == X.size());
+                ASSERT(CAPACITY == X.capacity());
+
+                mX.clear();
+                ASSERT(X.empty());
+                ASSERT(CAPACITY == X.capacity());
+                ASSERT(1 == oa.numBlocksInUse());
+            }
+            ASSERT(0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting inline use allocates nothing."
+                          << endl;
+        {
+            bslma::TestAllocator ta("inline", veryVeryVeryVerbose);
+
+            Obj mX(&ta);  const Obj& X = mX;
+
+            for (int round = 0; round < 3; ++round) {
+                for (int i = 0; i < static_cast<int>(k_INLINE); ++i) {
+                    mX.push_back(i);
+                }
+                ASSERT(isIota(X));
+                while (!X.empty()) {
+                    mX.pop_back();
+                }
+            }
+            ASSERT(0 == ta.numAllocations());
+        }
+        ASSERT(0 == da.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Create a vector, append elements past the inline capacity,
+        //    copy it, erase from it, and verify its value and storage.
+        //    (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            ASSERT(X.empty());
+            ASSERT(X.isInline());
+
+            for (int i = 0; i < 10; ++i) {
+                mX.push_back(i);
+                if (veryVerbose) { T_ P_(i) P_(X.size()) P(X.capacity()) }
+            }
+            ASSERT(10 == X.size());
+            ASSERT(!X.isInline());
+            ASSERT(isIota(X));
+
+            Obj mY(X, &oa);  const Obj& Y = mY;
+            ASSERT(X == Y);
+
+            mY.erase(mY.begin() + 2, mY.end());
+            ASSERT(2 == Y.size());
+            ASSERT(X != Y);
+
+            mY.shrink_to_fit();
+            ASSERT(Y.isInline());
+            ASSERT(isIota(Y));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // SMALL VECTOR BENCHMARK
+        //   Compare `bdlc::SmallVector` to `bsl::vector` for short sequences.
+        //
+        // Concerns:
+        // 1. The cost of creating, populating, reading, and destroying a short
+        //    sequence can be measured for each container, for sizes within
+        //    and beyond the inline capacity.
+        //
+        // Plan:
+        // 1. For each of several sizes, time building an `int` sequence of
+        //    that size by appending to an empty container, summing it, and
+        //    destroying it, and report the median time per sequence over
+        //    several trials.  (C-1)
+        //
+        // Testing:
+        //   SMALL VECTOR BENCHMARK
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SMALL VECTOR BENCHMARK" << endl
+                          << "======================" << endl;
+
+        bslma::NewDeleteAllocator oa;
+
+        bslma::DefaultAllocatorGuard dag(&oa);
+
+        typedef bdlc::SmallVector<int, 8> Small;
+        typedef bsl::vector<int>          Vector;
+
+        const int SIZES[]        = { 1, 4, 8, 16, 64 };
+        const int NUM_SIZES      = sizeof SIZES / sizeof *SIZES;
+        const int NUM_ITERATIONS = argc > 2 ? atoi(argv[2]) : 100000;
+        const int NUM_TRIALS     = 21;
+
+        cout << "ns per sequence (INLINE_CAPACITY = 8)" << endl;
+        cout << setw(8)  << "size"
+             << setw(14) << "SmallVector"
+             << setw(14) << "vector"
+             << setw(14) << "vector/rsv" << endl;
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const int SIZE = SIZES[si];
+
+            cout << setw(8)  << SIZE
+                 << setw(14) << timeBuildAndDestroy<Small>(SIZE,
+                                                           NUM_ITERATIONS,
+                                                           NUM_TRIALS)
+                 << setw(14) << timeBuildAndDestroy<Vector>(SIZE,
+                                                            NUM_ITERATIONS,
+                                                            NUM_TRIALS)
+                 << setw(14) << timeBuildAndDestroy<ReservedVector>(
+                                                              SIZE,
+                                                              NUM_ITERATIONS,
+                                                              NUM_TRIALS)
+                 << endl;
+        }
+
+        if (veryVeryVeryVerbose) {
+            cout << "anti-optimization: " << s_antiOptimization << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    // CONCERN: In no case does memory come from the default allocator.
+
+    LOOP_ASSERT(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
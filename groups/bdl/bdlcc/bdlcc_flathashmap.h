@@ -0,0 +1,1177 @@
+// bdlcc_flathashmap.h                                                -*-C++-*-
+#ifndef INCLUDED_BDLCC_FLATHASHMAP
+#define INCLUDED_BDLCC_FLATHASHMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a concurrent open-addressed unordered map.
+//
+//@CLASSES:
+//  bdlcc::FlatHashMap: fully thread-safe open-addressed hash map
+//
+//@SEE_ALSO: bdlc_flathashmap, bdlcc_stripedunorderedmap
+//
+//@DESCRIPTION: This component provides a fully thread-safe associative
+// container, `bdlcc::FlatHashMap`, that stores its elements in open-addressed
+// tables having the control-byte layout of `bdlc::FlatHashMap` (see
+// `bdlc_flathashtable_groupcontrol`): each entry has a one-byte control value
+// holding seven bits of the hash value of its key (or marking the entry as
+// empty or erased), so that a lookup examines a whole group of entries with a
+// few (SIMD) instructions, and touches the entries themselves only on a
+// probable match.  Compared to `bdlcc::StripedUnorderedMap`, which chains
+// separately allocated nodes, this container trades generality (see {Element
+// Requirements}) for cache-friendly, allocation-free, and lock-free lookups.
+//
+// `bdlcc::FlatHashMap` (and concurrent containers in general) does not provide
+// iterators.  The `bdlcc::FlatHashMap` class is an *irregular* value-semantic
+// type, even if `KEY` and `VALUE` are VSTs.  This class does not implement
+// equality comparison, assignment operator, or copy constructor.
+//
+///Shards and Optimistic Reads
+///---------------------------
+// The map is partitioned, by hash value, into a (user defined) number of
+// *shards*, each having its own table and its own mutex.  The manipulators of
+// the map lock the mutex of the shard to which the key belongs, so writers
+// operating on different shards do not contend.
+//
+// Lookups (`getValue`) never lock.  Each group of entries in a table has a
+// sequence number that a writer increments before, and again after, it
+// modifies the group, so that the sequence number is odd while the group is
+// being modified.  A reader copies the key (and, on a match, the value) of
+// each candidate entry of a group, and then verifies that the sequence number
+// of the group is even and did not change, retrying the group otherwise (a
+// scheme commonly known as a *seqlock*).  A lookup therefore writes no shared
+// memory (on x86 platforms), and is delayed by a concurrent writer only if the
+// writer modifies one of the groups being examined.
+//
+///Element Requirements
+///--------------------
+// As readers may copy an entry while it is being modified (discarding the
+// copy), the `KEY` and `VALUE` types must be bitwise copyable (see
+// `bslmf_isbitwisecopyable`), which is enforced at compile time.  In addition,
+// the `EQUAL` functor may be invoked on a copy of a key that was overwritten
+// while being copied (the result of such a comparison being discarded), so it
+// must not, e.g., dereference a pointer held by a `KEY` object.  The `HASH`
+// and `EQUAL` functors must be safe to invoke concurrently.
+//
+///Incremental Resizing
+///--------------------
+// When an insertion would raise the number of used (i.e., non-empty) entries
+// of the table of a shard above 7/8 of its capacity, a new table, having
+// enough capacity for twice the number of elements in the shard, is created,
+// and the elements of the previous table are moved to the new one a few
+// groups at a time by the manipulators subsequently invoked on that shard.
+// No operation therefore rehashes a whole shard (unless a shard's new table
+// fills before the previous one is drained), and the other shards are not
+// affected.  While elements are being moved, readers search both tables.
+//
+// Since a reader may still be examining a table after it has been replaced,
+// the memory of replaced tables is not released until the map is destroyed.
+// As table capacities grow geometrically, the replaced tables of a shard
+// occupy less memory than its current table.
+//
+///Thread Safety
+///-------------
+// The `bdlcc::FlatHashMap` class template is fully thread-safe (see
+// {`bsldoc_glossary`|Fully Thread-Safe}), assuming that the allocator is fully
+// thread-safe.  Each method is executed by the calling thread.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Shared Table of Last Traded Prices
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a market data handler records the last traded price of each
+// instrument, identified by an integer, and that many threads need to read
+// those prices with as little latency as possible.
+//
+// First, we define the type of the element values, which must be bitwise
+// copyable:
+// ```
+// struct Trade {
+//     double d_price;
+//     int    d_quantity;
+//
+//     BSLMF_NESTED_TRAIT_DECLARATION(Trade, bslmf::IsBitwiseCopyable);
+// };
+// ```
+// Then, we create a map having an initial capacity sufficient for the expected
+// number of instruments:
+// ```
+// bdlcc::FlatHashMap<int, Trade> lastTrades(1024);
+// ```
+// Next, a writer thread records trades as they are reported:
+// ```
+// Trade trade = { 101.25, 300 };
+// int   rc    = lastTrades.insert(7, trade);
+// assert(1 == rc);  // inserted
+//
+// trade.d_price = 101.5;
+// rc            = lastTrades.insert(7, trade);
+// assert(0 == rc);  // updated
+// ```
+// Now, any thread can look up the last trade of an instrument without
+// blocking the writers:
+// ```
+// Trade last;
+// rc = lastTrades.getValue(&last, 7);
+// assert(1     == rc);
+// assert(101.5 == last.d_price);
+// assert(300   == last.d_quantity);
+//
+// rc = lastTrades.getValue(&last, 8);
+// assert(0 == rc);  // no trade
+// ```
+// Finally, an instrument that is delisted is removed:
+// ```
+// rc = lastTrades.erase(7);
+// assert(1 == rc);
+// assert(0 == lastTrades.size());
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bdlc_flathashtable_groupcontrol.h>
+
+#include <bslh_fibonaccibadhashwrapper.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_isbitwisecopyable.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_objectbuffer.h>
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
+#include <bsl_functional.h>
+#include <bsl_new.h>
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                             // =================
+                             // class FlatHashMap
+                             // =================
+
+/// This class template implements a fully thread-safe, open-addressed hash
+/// map from `KEY` to `VALUE`, partitioned into shards that are locked
+/// independently by writers, and searched without locking by readers.  The
+/// `KEY` and `VALUE` types must be bitwise copyable.
+template <class KEY,
+          class VALUE,
+          class HASH  = bslh::FibonacciBadHashWrapper<bsl::hash<KEY> >,
+          class EQUAL = bsl::equal_to<KEY> >
+class FlatHashMap {
+
+    BSLMF_ASSERT(bslmf::IsBitwiseCopyable<KEY>::value);
+    BSLMF_ASSERT(bslmf::IsBitwiseCopyable<VALUE>::value);
+
+    // PRIVATE TYPES
+    typedef bdlc::FlatHashTable_GroupControl GroupControl;
+
+    /// This `struct` holds the key and value of one entry of a table.  The
+    /// objects are constructed only while the control byte of the entry
+    /// holds a hashlet, and are never destroyed (being bitwise copyable).
+    struct Entry {
+        bsls::ObjectBuffer<KEY>   d_key;
+        bsls::ObjectBuffer<VALUE> d_value;
+    };
+
+    /// This `struct` describes an open-addressed table, which occupies a
+    /// single block of memory holding (in order) this header, the sequence
+    /// number of each group, the entries, and their control bytes.
+    struct Table {
+        bsl::size_t       d_capacity;     // number of entries (power of 2)
+
+        int               d_shift;        // right shift of a hash value
+                                          // yielding a group index
+
+        bsls::AtomicUint *d_sequences_p;  // sequence number of each group
+
+        Entry            *d_entries_p;    // entries
+
+        bsl::uint8_t     *d_controls_p;   // control byte of each entry
+
+        Table            *d_next_p;       // next replaced table, if any
+    };
+
+    /// This `struct` holds the state of one shard of the map.  Other than
+    /// the table pointers, which are read by readers, the state is accessed
+    /// only while `d_mutex` is locked.
+    struct Shard {
+        bslmt::Mutex               d_mutex;        // writer lock
+
+        bsls::AtomicPointer<Table> d_table;        // current table
+
+        bsls::AtomicPointer<Table> d_previous;     // table being drained
+
+        bsl::size_t                d_numDrained;   // drained groups of
+                                                   // 'd_previous'
+
+        bsl::size_t                d_numUsed;      // non-empty entries of
+                                                   // 'd_table'
+
+        bsls::AtomicUint64         d_numElements;  // elements in shard
+
+        Table                     *d_replaced_p;   // list of replaced tables
+    };
+
+    // PRIVATE CONSTANTS
+    enum {
+        k_HASHLET_MASK    = 0x7f,  // hashlet = hash & MASK
+
+        k_SHARD_SHIFT     = 7,     // shard = (hash >> SHIFT) & (shards - 1)
+
+        k_MIN_CAPACITY    = 2 * GroupControl::k_SIZE,
+
+        k_DRAIN_PER_WRITE = 2      // groups drained by each manipulator
+    };
+
+    // DATA
+    Shard            *d_shards_p;      // array of 'd_numShards' shards
+    bsl::size_t       d_numShards;     // number of shards (power of 2)
+    HASH              d_hasher;        // hashing functor
+    EQUAL             d_equal;         // key-equality functor
+    bslma::Allocator *d_allocator_p;   // memory allocator (held, not owned)
+
+    // PRIVATE CLASS METHODS
+
+    /// Begin modifying the group having the specified `group` index in the
+    /// specified `table`.
+    static void beginWrite(Table *table, bsl::size_t group);
+
+    /// Finish modifying the group having the specified `group` index in the
+    /// specified `table`.
+    static void endWrite(Table *table, bsl::size_t group);
+
+    /// Return `true` if the specified `sequence` still has the specified
+    /// `value`, after all the (non-atomic) loads that precede this call,
+    /// and `false` otherwise.
+    static bool isUnchanged(const bsls::AtomicUint& sequence,
+                            unsigned int            value);
+
+    /// Return the number of entries that a table having the specified
+    /// `capacity` may use (including erased entries) before growing.
+    static bsl::size_t maxNumUsed(bsl::size_t capacity);
+
+    // PRIVATE MANIPULATORS
+
+    /// Return a new table having the specified `capacity`, all of whose
+    /// entries are empty.  The behavior is undefined unless `capacity` is a
+    /// power of 2 no less than `k_MIN_CAPACITY`.
+    Table *createTable(bsl::size_t capacity);
+
+    /// Release the memory of the specified `table`.
+    void deleteTable(Table *table);
+
+    /// Release the memory of the tables and shards of this hash map.
+    void destroy();
+
+    /// Move to the current table of the specified `shard` the elements of
+    /// at most the specified `numGroups` groups of the table of `shard`
+    /// being drained, if any, and, once that table is fully drained, retire
+    /// it.  The behavior is undefined unless the mutex of `shard` is
+    /// locked.
+    void drain(Shard *shard, bsl::size_t numGroups);
+
+    /// Erase the entry at the specified `index` in the specified `table`.
+    /// Return `true` if the entry is marked empty (rather than erased), and
+    /// `false` otherwise.
+    bool eraseEntry(Table *table, bsl::size_t index);
+
+    /// Create the shards of this hash map, numbering the specified
+    /// `numShards` rounded up to a power of 2, each having a table able to
+    /// hold its share of the specified `initialCapacity` elements without
+    /// growing.  The behavior is undefined unless `0 < numShards`.
+    void initialize(bsl::size_t initialCapacity, bsl::size_t numShards);
+
+    /// Replace the current table of the specified `shard` with a new table
+    /// having room for at least twice the number of elements in `shard`,
+    /// after first draining the previously replaced table of
+    /// `shard`, if needed, and begin draining the replaced table.  The
+    /// behavior is undefined unless the mutex of `shard` is locked.
+    void grow(Shard *shard);
+
+    /// Insert into the specified `table` of the specified `shard` an entry
+    /// having the specified `key`, `value`, and `hashValue`.  The behavior
+    /// is undefined unless the mutex of `shard` is locked, `table` has an
+    /// available entry, and `key` is not in any table of `shard`.
+    void insertEntry(Shard        *shard,
+                     Table        *table,
+                     const KEY&    key,
+                     const VALUE&  value,
+                     bsl::size_t   hashValue);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the index of the entry in the specified `table` having the
+    /// specified `key`, whose hash value is the specified `hashValue`, or
+    /// `table.d_capacity` if there is no such entry.  The behavior is
+    /// undefined unless the mutex of the shard owning `table` is locked.
+    bsl::size_t findIndex(const Table& table,
+                          const KEY&   key,
+                          bsl::size_t  hashValue) const;
+
+    /// Load into the specified `value` the value of the entry in the
+    /// specified `table` having the specified `key`, whose hash value is the
+    /// specified `hashValue`, without locking.  Return `true` if there is
+    /// such an entry, and `false` otherwise.
+    bool findValue(VALUE        *value,
+                   const Table&  table,
+                   const KEY&    key,
+                   bsl::size_t   hashValue) const;
+
+    /// Return a reference providing modifiable access to the shard to which
+    /// a key having the specified `hashValue` belongs.
+    Shard& shard(bsl::size_t hashValue) const;
+
+    // NOT IMPLEMENTED
+    FlatHashMap(const FlatHashMap&);
+    FlatHashMap& operator=(const FlatHashMap&);
+
+  public:
+    // PUBLIC CONSTANTS
+    enum {
+        k_DEFAULT_NUM_SHARDS = 16
+    };
+
+    // CREATORS
+
+    /// Create an empty `FlatHashMap` object, a fully thread-safe hash map
+    /// partitioned into shards that are locked independently by writers and
+    /// searched without locking by readers.  Optionally specify an
+    /// `initialCapacity` indicating the number of elements the map can hold
+    /// without growing (assuming an even distribution of keys over shards),
+    /// and a `numShards` indicating the (fixed) number of shards, which is
+    /// rounded up to a power of 2.  Optionally specify a `hash` functor
+    /// and an `equal` functor used to hash and compare keys, respectively.
+    /// Optionally specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  The behavior is undefined unless `0 < numShards`.
+    explicit FlatHashMap(
+                      bsl::size_t       initialCapacity = 0,
+                      bsl::size_t       numShards       = k_DEFAULT_NUM_SHARDS,
+                      bslma::Allocator *basicAllocator  = 0);
+    explicit FlatHashMap(bslma::Allocator *basicAllocator);
+    FlatHashMap(bsl::size_t       initialCapacity,
+                bsl::size_t       numShards,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+
+    /// Destroy this hash map.
+    ~FlatHashMap();
+
+    // MANIPULATORS
+
+    /// Remove all elements from this hash map.  Note that the capacity of
+    /// this hash map is not reduced.
+    void clear();
+
+    /// Erase from this hash map the element having the specified `key`.
+    /// Return 1 on success and 0 if `key` does not exist.  Note that the
+    /// returned value equals the number of elements removed.
+    bsl::size_t erase(const KEY& key);
+
+    /// Insert into this hash map an element having the specified `key` and
+    /// `value`.  If `key` already exists in this hash map, the value
+    /// attribute of that element is set to `value`.  Return 1 if an element
+    /// is inserted, and 0 if an existing element is updated.  Note that the
+    /// return value equals the number of elements inserted.
+    bsl::size_t insert(const KEY& key, const VALUE& value);
+
+    // ACCESSORS
+
+    /// Return the sum of the capacities of the current tables of the shards
+    /// of this hash map.  Note that the value returned may be obsolete by
+    /// the time it is returned.
+    bsl::size_t capacity() const;
+
+    /// Return `true` if this hash map contains no elements, and `false`
+    /// otherwise.
+    bool empty() const;
+
+    /// Return (a copy of) the key-equality functor used by this hash map.
+    EQUAL equalFunction() const;
+
+    /// Load, into the specified `*value`, the value attribute of the
+    /// element in this hash map having the specified `key`.  Return 1 on
+    /// success and 0 if `key` does not exist in this hash map.  This method
+    /// does not lock.  Note that the return value equals the number of
+    /// values returned.
+    bsl::size_t getValue(VALUE *value, const KEY& key) const;
+
+    /// Return (a copy of) the hash functor used by this hash map.
+    HASH hashFunction() const;
+
+    /// Return the number of shards in this hash map.
+    bsl::size_t numShards() const;
+
+    /// Return the current number of elements in this hash map.
+    bsl::size_t size() const;
+
+                               // Aspects
+
+    /// Return the allocator used by this hash map to supply memory.  Note
+    /// that if no allocator was supplied at construction the default
+    /// allocator installed at that time is used.
+    bslma::Allocator *allocator() const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                             // -----------------
+                             // class FlatHashMap
+                             // -----------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::beginWrite(Table       *table,
+                                                      bsl::size_t  group)
+{
+    // The read-modify-write orders the subsequent modifications of the group
+    // after the sequence number becomes odd.
+
+    table->d_sequences_p[group].addAcqRel(1);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::endWrite(Table       *table,
+                                                    bsl::size_t  group)
+{
+    bsls::AtomicUint& sequence = table->d_sequences_p[group];
+
+    sequence.storeRelease(sequence.loadRelaxed() + 1);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::isUnchanged(
+                                        const bsls::AtomicUint& sequence,
+                                        unsigned int            value)
+{
+#if defined(BSLS_PLATFORM_CPU_X86) || defined(BSLS_PLATFORM_CPU_X86_64)
+    // Loads are not reordered with other loads on x86, so preventing the
+    // compiler from moving the preceding loads after this one suffices.
+
+    BSLS_PERFORMANCEHINT_OPTIMIZATION_FENCE;
+    return value == sequence.loadRelaxed();
+#else
+    // A read-modify-write (writing the value it reads) having release
+    // semantics orders the preceding loads before it.
+
+    return value == const_cast<bsls::AtomicUint&>(sequence).testAndSwapAcqRel(
+                                                                        value,
+                                                                        value);
+#endif
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::maxNumUsed(
+                                                         bsl::size_t capacity)
+{
+    return capacity - capacity / 8;
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::Table *
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::createTable(bsl::size_t capacity)
+{
+    BSLS_ASSERT(k_MIN_CAPACITY <= capacity);
+    BSLS_ASSERT(0 == (capacity & (capacity - 1)));
+
+    const bsl::size_t numGroups = capacity / GroupControl::k_SIZE;
+
+    const bsl::size_t headerSize    =
+                bsls::AlignmentUtil::roundUpToMaximalAlignment(sizeof(Table));
+    const bsl::size_t sequencesSize =
+                              bsls::AlignmentUtil::roundUpToMaximalAlignment(
+                                         numGroups * sizeof(bsls::AtomicUint));
+    const bsl::size_t entriesSize   = capacity * sizeof(Entry);
+
+    char *memory = static_cast<char *>(d_allocator_p->allocate(
+                         headerSize + sequencesSize + entriesSize + capacity));
+
+    Table *table = new (memory) Table();
+
+    table->d_capacity    = capacity;
+    table->d_shift       = static_cast<int>(
+                                   sizeof(bsl::size_t) * 8
+                                 - bdlb::BitUtil::log2(
+                                       static_cast<bsl::uint64_t>(numGroups)));
+    table->d_sequences_p = reinterpret_cast<bsls::AtomicUint *>(
+                                                         memory + headerSize);
+    table->d_entries_p   = reinterpret_cast<Entry *>(
+                                         memory + headerSize + sequencesSize);
+    table->d_controls_p  = reinterpret_cast<bsl::uint8_t *>(
+                           memory + headerSize + sequencesSize + entriesSize);
+    table->d_next_p      = 0;
+
+    for (bsl::size_t i = 0; i < numGroups; ++i) {
+        new (table->d_sequences_p + i) bsls::AtomicUint(0);
+    }
+    bsl::memset(table->d_controls_p, GroupControl::k_EMPTY, capacity);
+
+    return table;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::deleteTable(Table *table)
+{
+    // The header, sequence numbers, and entries are trivially destructible.
+
+    d_allocator_p->deallocate(table);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::destroy()
+{
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        Shard& shard = d_shards_p[i];
+
+        if (Table *table = shard.d_table.loadRelaxed()) {
+            deleteTable(table);
+        }
+        if (Table *previous = shard.d_previous.loadRelaxed()) {
+            deleteTable(previous);
+        }
+        while (Table *replaced = shard.d_replaced_p) {
+            shard.d_replaced_p = replaced->d_next_p;
+            deleteTable(replaced);
+        }
+        shard.~Shard();
+    }
+    if (d_shards_p) {
+        d_allocator_p->deallocate(d_shards_p);
+    }
+    d_shards_p  = 0;
+    d_numShards = 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::drain(Shard       *shard,
+                                                 bsl::size_t  numGroups)
+{
+    Table *previous = shard->d_previous.loadRelaxed();
+
+    if (!previous) {
+        return;                                                       // RETURN
+    }
+
+    Table             *table = shard->d_table.loadRelaxed();
+    const bsl::size_t  total = previous->d_capacity / GroupControl::k_SIZE;
+    const bsl::size_t  end   = total - shard->d_numDrained > numGroups
+                             ? shard->d_numDrained + numGroups
+                             : total;
+
+    for (bsl::size_t group = shard->d_numDrained; group < end; ++group) {
+        const bsl::size_t index = group * GroupControl::k_SIZE;
+
+        bsl::uint8_t  *controls = previous->d_controls_p + index;
+        Entry         *entries  = previous->d_entries_p  + index;
+        bsl::uint32_t  inUse    = GroupControl(controls).inUse();
+
+        if (0 == inUse) {
+            continue;                                               // CONTINUE
+        }
+
+        // Each element is inserted into the new table before it is erased
+        // from the previous one, so that a reader that finds the element
+        // erased (and searches the new table next) finds it in the new table.
+
+        for (bsl::uint32_t bits = inUse; bits; ) {
+            const int offset = bdlb::BitUtil::numTrailingUnsetBits(bits);
+
+            const KEY& key = entries[offset].d_key.object();
+
+            insertEntry(shard,
+                        table,
+                        key,
+                        entries[offset].d_value.object(),
+                        d_hasher(key));
+
+            bits = bdlb::BitUtil::withBitCleared(bits, offset);
+        }
+
+        beginWrite(previous, group);
+        for (bsl::uint32_t bits = inUse; bits; ) {
+            const int offset = bdlb::BitUtil::numTrailingUnsetBits(bits);
+
+            controls[offset] = GroupControl::k_ERASED;
+
+            bits = bdlb::BitUtil::withBitCleared(bits, offset);
+        }
+        endWrite(previous, group);
+    }
+
+    shard->d_numDrained = end;
+
+    if (end == total) {
+        shard->d_previous.storeRelease(0);
+
+        previous->d_next_p  = shard->d_replaced_p;
+        shard->d_replaced_p = previous;
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::eraseEntry(Table       *table,
+                                                      bsl::size_t  index)
+{
+    const bsl::size_t group = index / GroupControl::k_SIZE;
+
+    // A probe reaching a group that has an empty entry stops at that group,
+    // so an entry of such a group can be made empty rather than erased.
+
+    const bool isEmpty = GroupControl(
+                   table->d_controls_p + group * GroupControl::k_SIZE)
+                                                                  .neverFull();
+
+    beginWrite(table, group);
+    table->d_controls_p[index] = isEmpty ? GroupControl::k_EMPTY
+                                         : GroupControl::k_ERASED;
+    endWrite(table, group);
+
+    return isEmpty;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::initialize(
+                                                 bsl::size_t initialCapacity,
+                                                 bsl::size_t numShards)
+{
+    BSLS_ASSERT(0 < numShards);
+
+    const bsl::size_t shards = static_cast<bsl::size_t>(
+                                   bdlb::BitUtil::roundUpToBinaryPower(
+                                       static_cast<bsl::uint64_t>(numShards)));
+
+    const bsl::size_t perShard = (initialCapacity + shards - 1) / shards;
+
+    bsl::size_t capacity = k_MIN_CAPACITY;
+    while (maxNumUsed(capacity) < perShard) {
+        capacity *= 2;
+    }
+
+    d_shards_p = static_cast<Shard *>(
+                              d_allocator_p->allocate(shards * sizeof(Shard)));
+
+    for (bsl::size_t i = 0; i < shards; ++i) {
+        Shard *shard = new (d_shards_p + i) Shard();
+
+        shard->d_numDrained = 0;
+        shard->d_numUsed    = 0;
+        shard->d_replaced_p = 0;
+    }
+    d_numShards = shards;
+
+    BSLS_TRY {
+        for (bsl::size_t i = 0; i < shards; ++i) {
+            d_shards_p[i].d_table.storeRelaxed(createTable(capacity));
+        }
+    }
+    BSLS_CATCH(...) {
+        destroy();
+        BSLS_RETHROW;
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::grow(Shard *shard)
+{
+    drain(shard, bsl::size_t(-1));
+
+    const bsl::size_t numElements = static_cast<bsl::size_t>(
+                                         shard->d_numElements.loadRelaxed());
+
+    bsl::size_t capacity = k_MIN_CAPACITY;
+    while (maxNumUsed(capacity) < 2 * numElements) {
+        capacity *= 2;
+    }
+
+    Table *table = createTable(capacity);
+
+    // Readers load the current table before the table being drained, so the
+    // latter must be published first.
+
+    shard->d_previous.storeRelease(shard->d_table.loadRelaxed());
+    shard->d_table.storeRelease(table);
+
+    shard->d_numDrained = 0;
+    shard->d_numUsed    = 0;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::insertEntry(Shard        *shard,
+                                                       Table        *table,
+                                                       const KEY&    key,
+                                                       const VALUE&  value,
+                                                       bsl::size_t   hashValue)
+{
+    const bsl::size_t numGroups = table->d_capacity / GroupControl::k_SIZE;
+
+    bsl::size_t group = hashValue >> table->d_shift;
+
+    for (bsl::size_t i = 0; i < numGroups; ++i) {
+        bsl::uint8_t  *controls  = table->d_controls_p
+                                                + group * GroupControl::k_SIZE;
+        bsl::uint32_t  available = GroupControl(controls).available();
+
+        if (available) {
+            const int offset = bdlb::BitUtil::numTrailingUnsetBits(available);
+
+            Entry& entry = table->d_entries_p[group * GroupControl::k_SIZE
+                                                                     + offset];
+
+            if (GroupControl::k_EMPTY == controls[offset]) {
+                ++shard->d_numUsed;
+            }
+
+            beginWrite(table, group);
+            new (entry.d_key.buffer()) KEY(key);
+            new (entry.d_value.buffer()) VALUE(value);
+            controls[offset] = static_cast<bsl::uint8_t>(
+                                                   hashValue & k_HASHLET_MASK);
+            endWrite(table, group);
+
+            return;                                                   // RETURN
+        }
+
+        group = (group + 1) & (numGroups - 1);
+    }
+
+    BSLS_ASSERT_INVOKE_NORETURN("table has no available entry");
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::findIndex(
+                                                 const Table& table,
+                                                 const KEY&   key,
+                                                 bsl::size_t  hashValue) const
+{
+    const bsl::size_t  numGroups = table.d_capacity / GroupControl::k_SIZE;
+    const bsl::uint8_t hashlet   = static_cast<bsl::uint8_t>(
+                                                   hashValue & k_HASHLET_MASK);
+
+    bsl::size_t group = hashValue >> table.d_shift;
+
+    for (bsl::size_t i = 0; i < numGroups; ++i) {
+        const bsl::size_t index = group * GroupControl::k_SIZE;
+
+        GroupControl  groupControl(table.d_controls_p + index);
+        bsl::uint32_t candidates = groupControl.match(hashlet);
+        while (candidates) {
+            const int offset = bdlb::BitUtil::numTrailingUnsetBits(candidates);
+
+            if (d_equal(table.d_entries_p[index + offset].d_key.object(),
+                        key)) {
+                return index + offset;                                // RETURN
+            }
+            candidates = bdlb::BitUtil::withBitCleared(candidates, offset);
+        }
+        if (groupControl.neverFull()) {
+            break;
+        }
+
+        group = (group + 1) & (numGroups - 1);
+    }
+
+    return table.d_capacity;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::findValue(
+                                                VALUE        *value,
+                                                const Table&  table,
+                                                const KEY&    key,
+                                                bsl::size_t   hashValue) const
+{
+    const bsl::size_t  numGroups = table.d_capacity / GroupControl::k_SIZE;
+    const bsl::uint8_t hashlet   = static_cast<bsl::uint8_t>(
+                                                   hashValue & k_HASHLET_MASK);
+
+    bsl::size_t group = hashValue >> table.d_shift;
+
+    for (bsl::size_t i = 0; i < numGroups; ) {
+        const bsls::AtomicUint& sequence = table.d_sequences_p[group];
+        const unsigned int      before   = sequence.loadAcquire();
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(before & 1)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            bslmt::ThreadUtil::yield();
+            continue;                                               // CONTINUE
+        }
+
+        const bsl::size_t index = group * GroupControl::k_SIZE;
+
+        // The control bytes and entries may be modified while they are being
+        // copied; the copies are used only if the sequence number of the
+        // group is unchanged afterwards.
+
+        GroupControl  groupControl(table.d_controls_p + index);
+        bsl::uint32_t candidates = groupControl.match(hashlet);
+        bool          found      = false;
+
+        bsls::ObjectBuffer<VALUE> valueCopy;
+        while (candidates) {
+            const int    offset = bdlb::BitUtil::numTrailingUnsetBits(
+                                                                   candidates);
+            const Entry& entry  = table.d_entries_p[index + offset];
+
+            bsls::ObjectBuffer<KEY> keyCopy;
+            bsl::memcpy(static_cast<void *>(keyCopy.buffer()),
+                        entry.d_key.buffer(),
+                        sizeof(KEY));
+
+            if (d_equal(keyCopy.object(), key)) {
+                bsl::memcpy(static_cast<void *>(valueCopy.buffer()),
+                            entry.d_value.buffer(),
+                            sizeof(VALUE));
+                found = true;
+                break;
+            }
+            candidates = bdlb::BitUtil::withBitCleared(candidates, offset);
+        }
+        const bool neverFull = groupControl.neverFull();
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                             !isUnchanged(sequence, before))) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            continue;                                               // CONTINUE
+        }
+
+        if (found) {
+            *value = valueCopy.object();
+            return true;                                              // RETURN
+        }
+        if (neverFull) {
+            break;
+        }
+
+        group = (group + 1) & (numGroups - 1);
+        ++i;
+    }
+
+    return false;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::Shard&
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::shard(bsl::size_t hashValue) const
+{
+    return d_shards_p[(hashValue >> k_SHARD_SHIFT) & (d_numShards - 1)];
+}
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                          bsl::size_t       initialCapacity,
+                                          bsl::size_t       numShards,
+                                          bslma::Allocator *basicAllocator)
+: d_shards_p(0)
+, d_numShards(0)
+, d_hasher()
+, d_equal()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < numShards);
+
+    initialize(initialCapacity, numShards);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bslma::Allocator *basicAllocator)
+: d_shards_p(0)
+, d_numShards(0)
+, d_hasher()
+, d_equal()
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    initialize(0, k_DEFAULT_NUM_SHARDS);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                          bsl::size_t       initialCapacity,
+                                          bsl::size_t       numShards,
+                                          const HASH&       hash,
+                                          const EQUAL&      equal,
+                                          bslma::Allocator *basicAllocator)
+: d_shards_p(0)
+, d_numShards(0)
+, d_hasher(hash)
+, d_equal(equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < numShards);
+
+    initialize(initialCapacity, numShards);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::~FlatHashMap()
+{
+    destroy();
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        Shard&                         shard = d_shards_p[i];
+        bslmt::LockGuard<bslmt::Mutex> guard(&shard.d_mutex);
+
+        Table *tables[2] = { shard.d_previous.loadRelaxed(),
+                             shard.d_table.loadRelaxed() };
+
+        for (int t = 0; t < 2; ++t) {
+            Table *table = tables[t];
+
+            if (!table) {
+                continue;                                           // CONTINUE
+            }
+
+            const bsl::size_t numGroups = table->d_capacity
+                                                        / GroupControl::k_SIZE;
+            for (bsl::size_t group = 0; group < numGroups; ++group) {
+                beginWrite(table, group);
+                bsl::memset(table->d_controls_p + group * GroupControl::k_SIZE,
+                            GroupControl::k_EMPTY,
+                            GroupControl::k_SIZE);
+                endWrite(table, group);
+            }
+        }
+
+        if (tables[0]) {
+            shard.d_previous.storeRelease(0);
+
+            tables[0]->d_next_p = shard.d_replaced_p;
+            shard.d_replaced_p  = tables[0];
+        }
+
+        shard.d_numDrained = 0;
+        shard.d_numUsed    = 0;
+        shard.d_numElements.storeRelaxed(0);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    const bsl::size_t hashValue = d_hasher(key);
+
+    Shard&                         shard = this->shard(hashValue);
+    bslmt::LockGuard<bslmt::Mutex> guard(&shard.d_mutex);
+
+    bsl::size_t rv = 0;
+
+    if (Table *previous = shard.d_previous.loadRelaxed()) {
+        const bsl::size_t index = findIndex(*previous, key, hashValue);
+        if (index != previous->d_capacity) {
+            eraseEntry(previous, index);
+            rv = 1;
+        }
+    }
+    if (0 == rv) {
+        Table             *table = shard.d_table.loadRelaxed();
+        const bsl::size_t  index = findIndex(*table, key, hashValue);
+        if (index != table->d_capacity) {
+            if (eraseEntry(table, index)) {
+                --shard.d_numUsed;
+            }
+            rv = 1;
+        }
+    }
+
+    if (rv) {
+        shard.d_numElements.subtractRelaxed(1);
+    }
+    drain(&shard, k_DRAIN_PER_WRITE);
+
+    return rv;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(const KEY&   key,
+                                                         const VALUE& value)
+{
+    const bsl::size_t hashValue = d_hasher(key);
+
+    Shard&                         shard = this->shard(hashValue);
+    bslmt::LockGuard<bslmt::Mutex> guard(&shard.d_mutex);
+
+    Table *tables[2] = { shard.d_previous.loadRelaxed(),
+                         shard.d_table.loadRelaxed() };
+
+    for (int t = 0; t < 2; ++t) {
+        Table *table = tables[t];
+
+        if (!table) {
+            continue;                                               // CONTINUE
+        }
+
+        const bsl::size_t index = findIndex(*table, key, hashValue);
+        if (index != table->d_capacity) {
+            const bsl::size_t group = index / GroupControl::k_SIZE;
+
+            beginWrite(table, group);
+            table->d_entries_p[index].d_value.object() = value;
+            endWrite(table, group);
+
+            drain(&shard, k_DRAIN_PER_WRITE);
+            return 0;                                                 // RETURN
+        }
+    }
+
+    if (shard.d_numUsed >= maxNumUsed(tables[1]->d_capacity)) {
+        grow(&shard);
+    }
+
+    insertEntry(&shard, shard.d_table.loadRelaxed(), key, value, hashValue);
+    shard.d_numElements.addRelaxed(1);
+
+    drain(&shard, k_DRAIN_PER_WRITE);
+    return 1;
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::capacity() const
+{
+    bsl::size_t rv = 0;
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        rv += d_shards_p[i].d_table.loadAcquire()->d_capacity;
+    }
+    return rv;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::empty() const
+{
+    return 0 == size();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL FlatHashMap<KEY, VALUE, HASH, EQUAL>::equalFunction() const
+{
+    return d_equal;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::getValue(
+                                                        VALUE      *value,
+                                                        const KEY&  key) const
+{
+    BSLS_ASSERT(value);
+
+    const bsl::size_t hashValue = d_hasher(key);
+    const Shard&      shard     = this->shard(hashValue);
+
+    // A miss is reported only if the tables of the shard did not change
+    // during the search; otherwise, the element may have been moved from a
+    // table not yet searched to one already searched.
+
+    for (;;) {
+        const Table *table    = shard.d_table.loadAcquire();
+        const Table *previous = shard.d_previous.loadAcquire();
+
+        if (previous && findValue(value, *previous, key, hashValue)) {
+            return 1;                                                 // RETURN
+        }
+        if (findValue(value, *table, key, hashValue)) {
+            return 1;                                                 // RETURN
+        }
+        if (table    == shard.d_table.loadAcquire()
+         && previous == shard.d_previous.loadAcquire()) {
+            return 0;                                                 // RETURN
+        }
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH FlatHashMap<KEY, VALUE, HASH, EQUAL>::hashFunction() const
+{
+    return d_hasher;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::numShards() const
+{
+    return d_numShards;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    bsls::Types::Uint64 rv = 0;
+    for (bsl::size_t i = 0; i < d_numShards; ++i) {
+        rv += d_shards_p[i].d_numElements.loadRelaxed();
+    }
+    return static_cast<bsl::size_t>(rv);
+}
+
+                               // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bslma::Allocator *FlatHashMap<KEY, VALUE, HASH, EQUAL>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1003 @@
+// bdlcc_flathashmap.t.cpp                                            -*-C++-*-
+#include <bdlcc_flathashmap.h>
+
+#include <bdlcc_stripedunorderedmap.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bslmf_isbitwisecopyable.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_atomic.h>
+#include <bsls_review.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test defines a fully thread-safe container template,
+// `bdlcc::FlatHashMap`, that provides a sharded, open-addressed hash map whose
+// lookups do not lock.  The container is an *irregular* value-semantic type
+// (it has no equality comparison, assignment operator, or copy constructor),
+// so the canonical test cases for VSTs are of limited use here.
+//
+// Single-threaded behavior, including the incremental draining of a replaced
+// table, is tested in test cases [1 .. 3].  Concurrent lookups, insertions,
+// and erasures (during which the tables of the shards grow) are tested in
+// test case 4.
+//
+// Global Concerns:
+//  - All memory is supplied by the intended allocator.
+//  - All memory is returned on destruction.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashMap(size_t initialCapacity = 0, size_t numShards = 16, *a = 0);
+// [ 2] FlatHashMap(bslma::Allocator *basicAllocator);
+// [ 2] FlatHashMap(size_t, size_t, const HASH&, const EQUAL&, *a = 0);
+// [ 2] ~FlatHashMap();
+//
+// MANIPULATORS
+// [ 2] void clear();
+// [ 2] bsl::size_t erase(const KEY& key);
+// [ 2] bsl::size_t insert(const KEY& key, const VALUE& value);
+//
+// ACCESSORS
+// [ 3] bsl::size_t capacity() const;
+// [ 2] bool empty() const;
+// [ 2] EQUAL equalFunction() const;
+// [ 2] bsl::size_t getValue(VALUE *value, const KEY& key) const;
+// [ 2] HASH hashFunction() const;
+// [ 2] bsl::size_t numShards() const;
+// [ 2] bsl::size_t size() const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] INCREMENTAL RESIZING
+// [ 4] CONCURRENT ACCESS
+// [ 5] USAGE EXAMPLE
+// [-1] LOOKUP THROUGHPUT BENCHMARK
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                      STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bsls::Types::Uint64                 Uint64;
+typedef bdlcc::FlatHashMap<int, Uint64>     Obj;
+
+static int verbose;
+static int veryVerbose;
+static int veryVeryVerbose;
+
+/// Return the value stored for the specified `key` by the specified
+/// `version` of a writer: the key in the low 32 bits and the version in the
+/// high 32 bits, so that a reader can detect a value stored for another key.
+inline
+Uint64 encode(int key, unsigned int version)
+{
+    return (static_cast<Uint64>(version) << 32) | static_cast<unsigned>(key);
+}
+
+/// This hash functor maps every key to the same hash value, so that all keys
+/// collide.
+struct ConstantHash {
+    bsl::size_t operator()(int) const
+    {
+        return 0x5a5a5a5a;
+    }
+};
+
+/// This key-equality functor counts the number of times it is invoked.
+struct CountingEqual {
+    bsls::AtomicInt *d_count_p;
+
+    explicit CountingEqual(bsls::AtomicInt *count) : d_count_p(count) {}
+
+    bool operator()(int lhs, int rhs) const
+    {
+        ++*d_count_p;
+        return lhs == rhs;
+    }
+};
+
+// ============================================================================
+//                          CASE 4 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace FLATHASHMAP_TEST_CASE_4 {
+
+enum {
+    k_NUM_STABLE_KEYS = 1024,      // keys inserted up front, never erased
+    k_NUM_KEYS        = 1 << 15,   // keys of the stable and volatile sets
+    k_NUM_ITERATIONS  = 100000     // operations per thread
+};
+
+bsls::AtomicInt numErrors(0);
+
+/// This class implements a functor that updates the stable keys of a map,
+/// and inserts and erases its volatile keys, in a pseudo-random order.
+class Writer {
+    Obj            *d_map_p;
+    bslmt::Barrier *d_barrier_p;
+    unsigned int    d_seed;
+
+  public:
+    Writer(Obj *map, bslmt::Barrier *barrier, unsigned int seed)
+    : d_map_p(map)
+    , d_barrier_p(barrier)
+    , d_seed(seed)
+    {
+    }
+
+    void operator()()
+    {
+        d_barrier_p->wait();
+
+        unsigned int state = d_seed;
+        for (unsigned int i = 1; i <= k_NUM_ITERATIONS; ++i) {
+            state = state * 1103515245 + 12345;
+
+            const int key = static_cast<int>((state >> 8) % k_NUM_KEYS);
+
+            if (key < k_NUM_STABLE_KEYS || ((state >> 30) & 1)) {
+                d_map_p->insert(key, encode(key, i));
+            }
+            else {
+                d_map_p->erase(key);
+            }
+        }
+    }
+};
+
+/// This class implements a functor that looks up keys of a map and verifies
+/// that stable keys are always found, and that found values match keys.
+class Reader {
+    const Obj      *d_map_p;
+    bslmt::Barrier *d_barrier_p;
+    unsigned int    d_seed;
+
+  public:
+    Reader(const Obj *map, bslmt::Barrier *barrier, unsigned int seed)
+    : d_map_p(map)
+    , d_barrier_p(barrier)
+    , d_seed(seed)
+    {
+    }
+
+    void operator()()
+    {
+        d_barrier_p->wait();
+
+        unsigned int state = d_seed;
+        for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+            state = state * 1103515245 + 12345;
+
+            const int   key   = static_cast<int>((state >> 8) % k_NUM_KEYS);
+            Uint64      value = 0;
+            bsl::size_t rc    = d_map_p->getValue(&value, key);
+
+            if (1 == rc && static_cast<int>(value & 0xffffffff) != key) {
+                ++numErrors;
+            }
+            if (key < k_NUM_STABLE_KEYS && 1 != rc) {
+                ++numErrors;
+            }
+        }
+    }
+};
+
+}  // close namespace FLATHASHMAP_TEST_CASE_4
+
+// ============================================================================
+//                         CASE -1 RELATED ENTITIES
+// ----------------------------------------------------------------------------
+
+namespace FLATHASHMAP_TEST_CASE_MINUS_1 {
+
+enum { k_NUM_LOOKUPS = 2000000 };
+
+bsls::AtomicUint64 sink(0);
+
+/// This class implements a functor that looks up pseudo-random keys in the
+/// range `[0, 2 * numKeys)` of a map of type `MAP`, half of which are
+/// present.
+template <class MAP>
+class Lookup {
+    const MAP      *d_map_p;
+    int             d_numKeys;
+    bslmt::Barrier *d_barrier_p;
+    unsigned int    d_seed;
+
+  public:
+    Lookup(const MAP      *map,
+           int             numKeys,
+           bslmt::Barrier *barrier,
+           unsigned int    seed)
+    : d_map_p(map)
+    , d_numKeys(numKeys)
+    , d_barrier_p(barrier)
+    , d_seed(seed)
+    {
+    }
+
+    void operator()()
+    {
+        d_barrier_p->wait();
+
+        unsigned int state = d_seed;
+        Uint64       total = 0;
+        for (int i = 0; i < k_NUM_LOOKUPS; ++i) {
+            state = state * 1103515245 + 12345;
+
+            Uint64 value = 0;
+            total += d_map_p->getValue(
+                            &value,
+                            static_cast<int>((state >> 4) % (2 * d_numKeys)));
+            total += value;
+        }
+        sink += total;
+    }
+};
+
+/// Populate the specified `map` with the keys `[0, numKeys)`, then look up
+/// keys from the specified `numThreads` threads, and return the average
+/// number of nanoseconds per lookup per thread.
+template <class MAP>
+double timeLookups(MAP *map, int numKeys, int numThreads)
+{
+    for (int i = 0; i < numKeys; ++i) {
+        map->insert(i, encode(i, 0));
+    }
+
+    bslmt::Barrier     barrier(numThreads + 1);
+    bslmt::ThreadGroup threadGroup;
+
+    for (int i = 0; i < numThreads; ++i) {
+        threadGroup.addThread(Lookup<MAP>(map, numKeys, &barrier, i + 1));
+    }
+
+    const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+    barrier.wait();
+    threadGroup.joinAll();
+    const bsls::Types::Int64 elapsed = bsls::TimeUtil::getTimer() - start;
+
+    return static_cast<double>(elapsed) / k_NUM_LOOKUPS;
+}
+
+}  // close namespace FLATHASHMAP_TEST_CASE_MINUS_1
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Example 1: A Shared Table of Last Traded Prices
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// First, we define the type of the element values, which must be bitwise
+// copyable:
+// ```
+struct Trade {
+    double d_price;
+    int    d_quantity;
+
+    BSLMF_NESTED_TRAIT_DECLARATION(Trade, bslmf::IsBitwiseCopyable);
+};
+// ```
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: `BSLS_REVIEW` failures should lead to test failures.
+    bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultAllocatorGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Shared Table of Last Traded Prices
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a market data handler records the last traded price of each
+// instrument, identified by an integer, and that many threads need to read
+// those prices with as little latency as possible.
+//
+// First, we define the type of the element values, which must be bitwise
+// copyable (see {`Trade`} above).
+//
+// Then, we create a map having an initial capacity sufficient for the expected
+// number of instruments:
+// ```
+    bdlcc::FlatHashMap<int, Trade> lastTrades(1024);
+// ```
+// Next, a writer thread records trades as they are reported:
+// ```
+    Trade trade = { 101.25, 300 };
+    int   rc    = lastTrades.insert(7, trade);
+    ASSERT(1 == rc);  // inserted
+
+    trade.d_price = 101.5;
+    rc            = lastTrades.insert(7, trade);
+    ASSERT(0 == rc);  // updated
+// ```
+// Now, any thread can look up the last trade of an instrument without
+// blocking the writers:
+// ```
+    Trade last;
+    rc = lastTrades.getValue(&last, 7);
+    ASSERT(1     == rc);
+    ASSERT(101.5 == last.d_price);
+    ASSERT(300   == last.d_quantity);
+
+    rc = lastTrades.getValue(&last, 8);
+    ASSERT(0 == rc);  // no trade
+// ```
+// Finally, an instrument that is delisted is removed:
+// ```
+    rc = lastTrades.erase(7);
+    ASSERT(1 == rc);
+    ASSERT(0 == lastTrades.size());
+// ```
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENT ACCESS
+        //
+        // Concerns:
+        // 1. Concurrent lookups always find the elements that are present
+        //    throughout, even while the tables of their shards grow and are
+        //    drained.
+        //
+        // 2. A value returned by a lookup is a value stored for the key
+        //    looked up (i.e., lookups never return a torn or foreign entry).
+        //
+        // 3. Concurrent writers on the same and different shards leave the
+        //    map consistent: its size equals the number of keys found.
+        //
+        // Plan:
+        // 1. Insert a set of "stable" keys into a map having a small initial
+        //    capacity and few shards.  Then, concurrently run writer threads,
+        //    which update the stable keys and insert and erase "volatile"
+        //    keys (causing the tables to grow), and reader threads, which
+        //    look up random keys and verify that stable keys are found and
+        //    that found values encode the key looked up.  (C-1..2)
+        //
+        // 2. After joining the threads, verify that the size of the map
+        //    equals the number of keys found, and that all stable keys are
+        //    found.  (C-3)
+        //
+        // Testing:
+        //   CONCURRENT ACCESS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENT ACCESS" << endl
+                          << "=================" << endl;
+
+        using namespace FLATHASHMAP_TEST_CASE_4;
+
+        enum { k_NUM_WRITERS = 3, k_NUM_READERS = 4 };
+
+        const bsl::size_t NUM_SHARDS[] = { 1, 4 };
+
+        for (bsl::size_t ti = 0; ti < sizeof NUM_SHARDS / sizeof *NUM_SHARDS;
+                                                                        ++ti) {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+            {
+                Obj mX(0, NUM_SHARDS[ti], &oa);  const Obj& X = mX;
+
+                for (int key = 0; key < k_NUM_STABLE_KEYS; ++key) {
+                    mX.insert(key, encode(key, 0));
+                }
+
+                numErrors = 0;
+
+                bslmt::Barrier     barrier(k_NUM_WRITERS + k_NUM_READERS);
+                bslmt::ThreadGroup threadGroup;
+
+                for (int i = 0; i < k_NUM_WRITERS; ++i) {
+                    ASSERT(0 == threadGroup.addThread(
+                                              Writer(&mX, &barrier, 2 * i)));
+                }
+                for (int i = 0; i < k_NUM_READERS; ++i) {
+                    ASSERT(0 == threadGroup.addThread(
+                                          Reader(&X, &barrier, 2 * i + 1)));
+                }
+                threadGroup.joinAll();
+
+                ASSERTV(NUM_SHARDS[ti], numErrors, 0 == numErrors);
+
+                bsl::size_t numFound = 0;
+                for (int key = 0; key < k_NUM_KEYS; ++key) {
+                    Uint64 value;
+                    if (1 == X.getValue(&value, key)) {
+                        ++numFound;
+                        ASSERTV(key, value,
+                                key == static_cast<int>(value & 0xffffffff));
+                    }
+                    else {
+                        ASSERTV(key, k_NUM_STABLE_KEYS <= key);
+                    }
+                }
+                ASSERTV(numFound, X.size(), numFound == X.size());
+
+                if (veryVerbose) {
+                    P_(NUM_SHARDS[ti]) P_(X.size()) P(X.capacity());
+                }
+            }
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // INCREMENTAL RESIZING
+        //
+        // Concerns:
+        // 1. When an insertion would exceed the maximum load of the table of
+        //    a shard, a single table is allocated, and the elements of the
+        //    replaced table are moved a few groups at a time.
+        //
+        // 2. Every element remains accessible (and can be updated or erased)
+        //    while the replaced table is being drained.
+        //
+        // 3. `clear` removes the elements of both tables of a shard being
+        //    drained.
+        //
+        // 4. The memory of the replaced tables is released on destruction.
+        //
+        // Plan:
+        // 1. Using a map having one shard, insert keys one at a time,
+        //    verifying after each insertion that at most one block is
+        //    allocated, and that all the keys inserted so far are found.
+        //    (C-1..2)
+        //
+        // 2. Immediately after the capacity increases, update and erase keys
+        //    inserted before the increase, and verify the results.  (C-2)
+        //
+        // 3. Clear a map immediately after its capacity increases, and verify
+        //    that no key is found.  (C-3)
+        //
+        // 4. Verify that the test allocator has no blocks in use after each
+        //    map is destroyed.  (C-4)
+        //
+        // Testing:
+        //   bsl::size_t capacity() const;
+        //   INCREMENTAL RESIZING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "INCREMENTAL RESIZING" << endl
+                          << "====================" << endl;
+
+        enum { k_NUM_KEYS = 3000 };
+
+        if (verbose) cout << "\nInsert keys and verify all are found.\n";
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+            {
+                Obj mX(0, 1, &oa);  const Obj& X = mX;
+
+                bsl::size_t numGrowths = 0;
+                for (int key = 0; key < k_NUM_KEYS; ++key) {
+                    const bsl::size_t        capacity  = X.capacity();
+                    const bsls::Types::Int64 numAllocs = oa.numAllocations();
+
+                    ASSERTV(key, 1 == mX.insert(key, encode(key, 0)));
+
+                    ASSERTV(key, oa.numAllocations() - numAllocs <= 1);
+                    if (capacity != X.capacity()) {
+                        ASSERTV(key, 2 * capacity == X.capacity());
+                        ++numGrowths;
+                    }
+
+                    for (int k = 0; k <= key; ++k) {
+                        Uint64 value;
+                        ASSERTV(key, k, 1 == X.getValue(&value, k));
+                        ASSERTV(key, k, encode(k, 0) == value);
+                    }
+                    ASSERTV(key, X.size(), key + 1 == (int)X.size());
+                }
+                ASSERTV(numGrowths, 5 < numGrowths);
+            }
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nUpdate and erase while draining.\n";
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+            {
+                Obj mX(0, 1, &oa);  const Obj& X = mX;
+
+                int key = 0;
+                for (int numGrowths = 0; numGrowths < 4; ++key) {
+                    const bsl::size_t capacity = X.capacity();
+
+                    mX.insert(key, encode(key, 0));
+                    if (capacity == X.capacity()) {
+                        continue;                                   // CONTINUE
+                    }
+                    ++numGrowths;
+
+                    // Update the even keys and erase every third key.
+
+                    for (int k = 0; k < key; k += 2) {
+                        ASSERTV(k, 0 == mX.insert(k, encode(k, 1)));
+                    }
+                    for (int k = 0; k < key; k += 3) {
+                        ASSERTV(k, 1 == mX.erase(k));
+                        ASSERTV(k, 0 == mX.erase(k));
+                    }
+                    for (int k = 0; k <= key; ++k) {
+                        Uint64            value;
+                        const bsl::size_t rc = X.getValue(&value, k);
+
+                        if (0 == k % 3 && k != key) {
+                            ASSERTV(k, 0 == rc);
+                        }
+                        else {
+                            ASSERTV(k, 1 == rc);
+                            ASSERTV(k, encode(k, k % 2 || k == key ? 0 : 1)
+                                                                    == value);
+                        }
+                    }
+
+                    // Restore the erased keys.
+
+                    for (int k = 0; k < key; k += 3) {
+                        ASSERTV(k, 1 == mX.insert(k, encode(k, 0)));
+                    }
+                    for (int k = 0; k < key; k += 2) {
+                        mX.insert(k, encode(k, 0));
+                    }
+                    ASSERTV(key, X.size(), key + 1 == (int)X.size());
+                }
+            }
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nClear while draining.\n";
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+            {
+                Obj mX(0, 1, &oa);  const Obj& X = mX;
+
+                int               key      = 0;
+                const bsl::size_t capacity = X.capacity();
+                while (capacity == X.capacity()) {
+                    mX.insert(key, encode(key, 0));
+                    ++key;
+                }
+
+                mX.clear();
+                ASSERT(0 == X.size());
+                ASSERT(X.empty());
+
+                for (int k = 0; k < key; ++k) {
+                    Uint64 value;
+                    ASSERTV(k, 0 == X.getValue(&value, k));
+                }
+
+                for (int k = 0; k < key; ++k) {
+                    ASSERTV(k, 1 == mX.insert(k, encode(k, 2)));
+                }
+                for (int k = 0; k < key; ++k) {
+                    Uint64 value;
+                    ASSERTV(k, 1 == X.getValue(&value, k));
+                    ASSERTV(k, encode(k, 2) == value);
+                }
+            }
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND MANIPULATORS
+        //
+        // Concerns:
+        // 1. Each constructor creates an empty map having the requested
+        //    (rounded up) number of shards, using the intended allocator.
+        //
+        // 2. `insert` inserts new keys (returning 1) and updates existing
+        //    ones (returning 0), and `getValue` finds exactly the keys
+        //    inserted, with their latest values.
+        //
+        // 3. `erase` removes exactly the keys present (returning 1), and
+        //    returns 0 for absent keys.
+        //
+        // 4. `clear` removes all elements.
+        //
+        // 5. The supplied hash and key-equality functors are used, and keys
+        //    having colliding hash values are distinguished.
+        //
+        // 6. All memory is returned on destruction.
+        //
+        // Plan:
+        // 1. Create maps with each constructor and verify their attributes.
+        //    (C-1)
+        //
+        // 2. For several numbers of shards, insert, update, look up, and
+        //    erase keys, verifying the results against the expected state.
+        //    (C-2..4)
+        //
+        // 3. Use a hash functor mapping all keys to the same hash value and a
+        //    key-equality functor counting its invocations.  (C-5)
+        //
+        // 4. Verify that the test allocator has no blocks in use after each
+        //    map is destroyed.  (C-6)
+        //
+        // Testing:
+        //   FlatHashMap(size_t initialCapacity = 0, size_t numShards, *a = 0);
+        //   FlatHashMap(bslma::Allocator *basicAllocator);
+        //   FlatHashMap(size_t, size_t, const HASH&, const EQUAL&, *a = 0);
+        //   ~FlatHashMap();
+        //   void clear();
+        //   bsl::size_t erase(const KEY& key);
+        //   bsl::size_t insert(const KEY& key, const VALUE& value);
+        //   bool empty() const;
+        //   EQUAL equalFunction() const;
+        //   bsl::size_t getValue(VALUE *value, const KEY& key) const;
+        //   HASH hashFunction() const;
+        //   bsl::size_t numShards() const;
+        //   bsl::size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND MANIPULATORS" << endl
+                          << "=========================" << endl;
+
+        if (verbose) cout << "\nConstructors.\n";
+        {
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+            {
+                Obj mX(&oa);  const Obj& X = mX;
+
+                ASSERT(&oa == X.allocator());
+                ASSERT(Obj::k_DEFAULT_NUM_SHARDS == X.numShards());
+                ASSERT(0 == X.size());
+                ASSERT(X.empty());
+                ASSERT(0 < oa.numBlocksInUse());
+                ASSERT(0 == defaultAllocator.numBlocksInUse());
+            }
+            {
+                Obj mX(1000, 3, &oa);  const Obj& X = mX;
+
+                ASSERT(&oa == X.allocator());
+                ASSERT(4 == X.numShards());
+                ASSERT(1000 * 8 / 7 <= X.capacity());
+            }
+            {
+                Obj mX;  const Obj& X = mX;
+
+                ASSERT(&defaultAllocator == X.allocator());
+                ASSERT(Obj::k_DEFAULT_NUM_SHARDS == X.numShards());
+                ASSERT(0 < defaultAllocator.numBlocksInUse());
+            }
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nInsert, update, look up, and erase.\n";
+
+        const bsl::size_t NUM_SHARDS[] = { 1, 2, 16, 64 };
+
+        for (bsl::size_t ti = 0; ti < sizeof NUM_SHARDS / sizeof *NUM_SHARDS;
+                                                                        ++ti) {
+            enum { k_NUM_KEYS = 2000 };
+
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+            {
+                Obj mX(0, NUM_SHARDS[ti], &oa);  const Obj& X = mX;
+
+                ASSERT(NUM_SHARDS[ti] == X.numShards());
+
+                bsl::vector<int> state(k_NUM_KEYS, -1);
+
+                for (int key = 0; key < k_NUM_KEYS; key += 2) {
+                    ASSERTV(key, 1 == mX.insert(key, encode(key, 0)));
+                    state[key] = 0;
+                }
+                for (int key = 0; key < k_NUM_KEYS; key += 4) {
+                    ASSERTV(key, 0 == mX.insert(key, encode(key, 1)));
+                    state[key] = 1;
+                }
+                for (int key = 0; key < k_NUM_KEYS; key += 6) {
+                    ASSERTV(key, 1 == mX.erase(key));
+                    state[key] = -1;
+                }
+                for (int key = 1; key < k_NUM_KEYS; key += 6) {
+                    ASSERTV(key, 0 == mX.erase(key));
+                }
+
+                bsl::size_t expSize = 0;
+                for (int key = 0; key < k_NUM_KEYS; ++key) {
+                    Uint64            value = 0;
+                    const bsl::size_t rc    = X.getValue(&value, key);
+
+                    if (0 <= state[key]) {
+                        ++expSize;
+                        ASSERTV(NUM_SHARDS[ti], key, 1 == rc);
+                        ASSERTV(NUM_SHARDS[ti], key,
+                                encode(key, state[key]) == value);
+                    }
+                    else {
+                        ASSERTV(NUM_SHARDS[ti], key, 0 == rc);
+                        ASSERTV(NUM_SHARDS[ti], key, 0 == value);
+                    }
+                }
+                ASSERTV(NUM_SHARDS[ti], X.size(), expSize == X.size());
+                ASSERT(!X.empty());
+
+                mX.clear();
+
+                ASSERT(0 == X.size());
+                ASSERT(X.empty());
+                for (int key = 0; key < k_NUM_KEYS; ++key) {
+                    Uint64 value;
+                    ASSERTV(NUM_SHARDS[ti], key, 0 == X.getValue(&value, key));
+                }
+
+                ASSERT(1 == mX.insert(5, encode(5, 7)));
+                ASSERT(1 == X.size());
+            }
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nColliding hash values.\n";
+        {
+            typedef bdlcc::FlatHashMap<int, int, ConstantHash, CountingEqual>
+                                                                       CollObj;
+
+            enum { k_NUM_KEYS = 100 };
+
+            bsls::AtomicInt      count(0);
+            bslma::TestAllocator oa("object", veryVeryVerbose);
+            {
+                CollObj mX(0, 4, ConstantHash(), CountingEqual(&count), &oa);
+                const CollObj& X = mX;
+
+                ASSERT(&count == X.equalFunction().d_count_p);
+                ASSERT(0x5a5a5a5a == X.hashFunction()(17));
+
+                for (int key = 0; key < k_NUM_KEYS; ++key) {
+                    ASSERTV(key, 1 == mX.insert(key, -key));
+                }
+                ASSERT(0 < count);
+
+                for (int key = 0; key < k_NUM_KEYS; ++key) {
+                    int value;
+                    ASSERTV(key, 1 == X.getValue(&value, key));
+                    ASSERTV(key, -key == value);
+                }
+
+                int value;
+                ASSERT(0 == X.getValue(&value, k_NUM_KEYS));
+
+                for (int key = 0; key < k_NUM_KEYS; key += 2) {
+                    ASSERTV(key, 1 == mX.erase(key));
+                }
+                for (int key = 0; key < k_NUM_KEYS; ++key) {
+                    ASSERTV(key, (key % 2) == (int)X.getValue(&value, key));
+                }
+                ASSERT(k_NUM_KEYS / 2 == X.size());
+            }
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Insert, look up, update, and erase a few elements.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVerbose);
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            Uint64 value = 0;
+
+            ASSERT(0 == X.getValue(&value, 1));
+            ASSERT(1 == mX.insert(1, 10));
+            ASSERT(1 == mX.insert(2, 20));
+            ASSERT(0 == mX.insert(1, 11));
+            ASSERT(2 == X.size());
+
+            ASSERT(1 == X.getValue(&value, 1));
+            ASSERT(11 == value);
+            ASSERT(1 == X.getValue(&value, 2));
+            ASSERT(20 == value);
+
+            ASSERT(1 == mX.erase(1));
+            ASSERT(0 == mX.erase(1));
+            ASSERT(0 == X.getValue(&value, 1));
+            ASSERT(1 == X.size());
+        }
+        ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // LOOKUP THROUGHPUT BENCHMARK
+        //
+        // Concerns:
+        // 1. Concurrent lookups in a `bdlcc::FlatHashMap` scale with the
+        //    number of threads and are faster than in a
+        //    `bdlcc::StripedUnorderedMap`.
+        //
+        // Plan:
+        // 1. For several numbers of reader threads, time lookups of
+        //    pseudo-random keys (half present) in each kind of map holding
+        //    the same elements, and report the time per lookup.  (C-1)
+        //
+        // Testing:
+        //   LOOKUP THROUGHPUT BENCHMARK
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LOOKUP THROUGHPUT BENCHMARK" << endl
+                          << "===========================" << endl;
+
+        using namespace FLATHASHMAP_TEST_CASE_MINUS_1;
+
+        typedef bdlcc::StripedUnorderedMap<int, Uint64> StripedObj;
+
+        bslma::NewDeleteAllocator    oa;
+        bslma::DefaultAllocatorGuard dag(&oa);
+
+        const int NUM_KEYS[]    = { 1 << 10, 1 << 20 };
+        const int NUM_THREADS[] = { 1, 2, 4, 8 };
+
+        cout << "keys     threads  flat ns/op  striped ns/op" << endl;
+
+        for (bsl::size_t ki = 0; ki < sizeof NUM_KEYS / sizeof *NUM_KEYS;
+                                                                        ++ki) {
+            for (bsl::size_t ti = 0;
+                 ti < sizeof NUM_THREADS / sizeof *NUM_THREADS;
+                 ++ti) {
+                Obj        flat(0, Obj::k_DEFAULT_NUM_SHARDS, &oa);
+                StripedObj striped(StripedObj::k_DEFAULT_NUM_BUCKETS,
+                                   StripedObj::k_DEFAULT_NUM_STRIPES,
+                                   &oa);
+
+                const double flatNs    = timeLookups(&flat,
+                                                     NUM_KEYS[ki],
+                                                     NUM_THREADS[ti]);
+                const double stripedNs = timeLookups(&striped,
+                                                     NUM_KEYS[ki],
+                                                     NUM_THREADS[ti]);
+
+                cout << NUM_KEYS[ki] << "\t " << NUM_THREADS[ti]
+                     << "\t  " << flatNs << "\t      " << stripedNs << endl;
+            }
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -29,6 +29,16 @@ BSLS_IDENT_RCSID(bdlcc_objectpool_cpp,"$Id$ $CSID$")
 // extreme caution and only after consulting with threading experts in our
 // group (at this writing, Gino Rocha or Vlad Kliatchko).
 //
+// 'releaseResetObjects' (used by 'ObjectPoolCache' to return a batch of
+// objects) applies exactly the same reference-count protocol to each object
+// as 'releaseObject' does (see 'releaseNode'), but links the objects that
+// must be added to the free list into a chain first, and then attaches the
+// whole chain with a single compare-and-swap, exactly as 'addObjects' does
+// for newly created objects.  Nodes in the middle of the chain are never the
+// head of the free list while being linked, so a concurrent 'getObject' can
+// observe them only through a stale pointer, which the reference count
+// already handles.
+//
 // This picture describes a memory chunk returned by 'd_blockAllocator':
 //
 // padding-1 and padding-3 is necessary so that 'ObjectNode' is properly
@@ -9,6 +9,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bdlcc::ObjectPool: thread-safe container of managed objects
+//  bdlcc::ObjectPoolCache: single-threaded cache of objects from an ObjectPool
 //  bdlcc::ObjectPoolFunctors: namespace for resetter/creator implementations
 //
 //@SEE_ALSO: bdlcc_sharedobjectpool
@@ -99,6 +100,36 @@ BSLS_IDENT("$Id: $")
 // correctly passes its allocator argument to the constructor of `TYPE` if
 // `TYPE` takes an allocator.
 //
+///Per-Thread Object Caches
+///-------------------------
+// Although `getObject` and `releaseObject` are lock-free, every call performs
+// at least one atomic read-modify-write operation on the head of the free
+// list shared by all threads.  When many threads acquire and release objects
+// at a high rate, that shared head becomes a point of contention.  A
+// `bdlcc::ObjectPoolCache` removes that contention from the steady state: it
+// is an object, owned and used by a *single* thread, that retains up to a
+// configurable maximum number of idle objects obtained from (and owned by) a
+// `bdlcc::ObjectPool`.  The `getObject` and `releaseObject` methods of a
+// cache are satisfied from its idle objects without any atomic operation or
+// access to memory shared with other threads.  Only when the cache is empty
+// does it obtain a batch of objects from the pool, and only when it holds its
+// maximum number of idle objects does it return a batch of (its least
+// recently used) objects to the pool, using a single atomic operation for the
+// entire batch.
+//
+// The objects idle in a cache are not available to other threads, so the
+// maximum number of idle objects should be chosen with the number of threads
+// in mind.  A thread may additionally call `trim` (e.g., periodically, or
+// whenever it is about to become idle) to return the objects it does not
+// expect to need to the shared pool.  Destroying a cache returns all of its
+// idle objects to the pool.
+//
+// An object obtained from a cache may be returned to the pool, or to any
+// cache of the same pool (e.g., one owned by another thread), and vice versa.
+// Objects are reset (see {Creator and Resetter Template Contract}) when they
+// are returned to a cache, not when the cache returns them to the pool.  Note
+// that a cache must be destroyed before the pool it refers to.
+//
 ///Exception safety
 ///----------------
 // There are two potential sources of exceptions in this component: memory
@@ -305,6 +336,96 @@ BSLS_IDENT("$Id: $")
 // totalResponseTime1 = 199970775520
 // totalResponseTime2 = 100354490480
 // ```
+//
+///Example 2: Using a Per-Thread Object Cache
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose that each thread of a message-processing service parses a very
+// large number of short messages, and that each message requires a parser
+// object that is expensive to construct.  We could share a pool of parsers
+// among the threads, but acquiring and releasing a parser for every message
+// would make the free list of the pool a point of contention.  Instead, each
+// thread acquires parsers through its own `bdlcc::ObjectPoolCache`.
+//
+// First, we define a trivial parser type, whose `reset` method is invoked
+// whenever a parser is returned for reuse:
+// ```
+// /// This class simulates a parser of messages.
+// class my_Parser {
+//
+//     // DATA
+//     int d_numParsed;  // number of messages parsed since last `reset`
+//
+//   public:
+//     // CREATORS
+//     my_Parser()
+//     : d_numParsed(0)
+//     {
+//     }
+//
+//     // MANIPULATORS
+//
+//     /// Parse the specified `message`.
+//     void parse(const bsl::string& message)
+//     {
+//         (void)message;
+//         ++d_numParsed;
+//     }
+//
+//     void reset()
+//     {
+//         d_numParsed = 0;
+//     }
+//
+//     // ACCESSORS
+//     int numParsed() const
+//     {
+//         return d_numParsed;
+//     }
+// };
+//
+// typedef bdlcc::ObjectPool<my_Parser,
+//                           bdlcc::ObjectPoolFunctors::DefaultCreator,
+//                           bdlcc::ObjectPoolFunctors::Reset<my_Parser> >
+//                                                                 ParserPool;
+//
+// typedef bdlcc::ObjectPoolCache<my_Parser,
+//                                bdlcc::ObjectPoolFunctors::DefaultCreator,
+//                                bdlcc::ObjectPoolFunctors::Reset<my_Parser> >
+//                                                                ParserCache;
+// ```
+// Then, we define the function executed by each thread, which creates a cache
+// that retains at most 8 idle parsers from the specified shared `pool`:
+// ```
+// /// Parse the specified `numMessages` messages using parsers from the
+// /// specified `pool`.
+// void parseMessages(ParserPool *pool, int numMessages)
+// {
+//     ParserCache cache(pool, 8);
+//
+//     for (int i = 0; i < numMessages; ++i) {
+//         my_Parser *parser = cache.getObject();
+//         assert(0 == parser->numParsed());
+//
+//         parser->parse("message");
+//
+//         cache.releaseObject(parser);
+//     }
+// }
+// ```
+// Finally, we create the shared pool and run several threads that use it:
+// ```
+// ParserPool pool;
+//
+// bslmt::ThreadGroup tg;
+// tg.addThreads(bdlf::BindUtil::bind(&parseMessages, &pool, 10000), 4);
+// tg.joinAll();
+// ```
+// Since each thread has only one parser in use at any time, and its cache
+// retains it for the next message, each thread obtained only a single batch
+// of parsers from the pool, and returned them when its cache was destroyed:
+// ```
+// assert(pool.numObjects() == pool.numAvailableObjects());
+// ```
 
 #include <bdlscm_version.h>
 
@@ -335,6 +456,7 @@ BSLS_IDENT("$Id: $")
 #include <bsl_climits.h>
 #include <bsl_functional.h>
 #include <bsl_memory.h>
+#include <bsl_vector.h>
 
 #ifndef BDE_DONT_ALLOW_TRANSITIVE_INCLUDES
 #include <bslalg_typetraits.h>
@@ -597,6 +719,9 @@ struct ObjectPool_ProxyPicker<ObjectPoolFunctors::DefaultCreator>
         typedef ObjectPool_DefaultProxy<TYPE> Proxy;
     };
 };
+template <class TYPE, class CREATOR, class RESETTER>
+class ObjectPoolCache;
+
                               // ================
                               // class ObjectPool
                               // ================
@@ -774,6 +899,7 @@ class ObjectPool : public bdlma::Factory<TYPE> {
 
     // FRIENDS
     friend class AutoCleanup;
+    friend class ObjectPoolCache<TYPE, CREATOR, RESETTER>;
 
   private:
     // PRIVATE MANIPULATORS
@@ -786,6 +912,21 @@ class ObjectPool : public bdlma::Factory<TYPE> {
     /// object pool.
     void addObjects(int numObjects);
 
+    /// Release the reference to the specified `node`, whose object has
+    /// been reset, held by the thread that obtained it.  Return `true` if
+    /// the caller must add `node` to the free objects list, and `false` if
+    /// a thread concurrently attempting to acquire `node` will take it
+    /// instead.
+    bool releaseNode(ObjectNode *node);
+
+    /// Return the specified `numObjects` objects in the array starting at
+    /// the specified `objects`, each of which has already been reset, back
+    /// to this object pool, adding them to the free objects list with a
+    /// single atomic operation.  The behavior is undefined unless
+    /// `0 <= numObjects`, and each object was obtained from this object
+    /// pool and is not already in a released state.
+    void releaseResetObjects(TYPE * const *objects, int numObjects);
+
   public:
     // TYPES
     typedef RESETTER ResetterType;
@@ -926,6 +1067,126 @@ class ObjectPool : public bdlma::Factory<TYPE> {
     virtual void deleteObject(TYPE *object);
 };
 
+                           // =====================
+                           // class ObjectPoolCache
+                           // =====================
+
+/// This class provides a cache of idle objects obtained from an
+/// `ObjectPool`, intended to be used by a single thread to acquire and
+/// release objects without contending with other threads for the pool.  The
+/// cache obtains objects from the pool, and returns them to it, in batches.
+/// See {Per-Thread Object Caches}.
+template <class TYPE,
+          class CREATOR  = ObjectPoolFunctors::DefaultCreator,
+          class RESETTER = ObjectPoolFunctors::Nil<TYPE> >
+class ObjectPoolCache {
+
+  public:
+    // TYPES
+    typedef ObjectPool<TYPE, CREATOR, RESETTER> PoolType;
+
+    enum {
+        k_DEFAULT_MAX_IDLE_OBJECTS = 32  // default maximum number of idle
+                                         // objects retained by a cache
+    };
+
+  private:
+    // DATA
+    PoolType            *d_pool_p;          // pool supplying the objects
+                                            // (held, not owned)
+
+    bsl::vector<TYPE *>  d_objects;         // idle objects, least recently
+                                            // released first
+
+    int                  d_maxIdleObjects;  // maximum length of 'd_objects'
+
+    int                  d_batchSize;       // number of objects obtained
+                                            // from, or returned to, the pool
+                                            // at a time
+
+    // NOT IMPLEMENTED
+    ObjectPoolCache(const ObjectPoolCache&);
+    ObjectPoolCache& operator=(const ObjectPoolCache&);
+
+  private:
+    // PRIVATE MANIPULATORS
+
+    /// Return the address of a modifiable object obtained from the pool,
+    /// after retaining in this cache a batch of additional objects that the
+    /// pool can supply without being replenished.
+    TYPE *getObjectFromPool();
+
+    /// Return the specified `numObjects` least recently released idle
+    /// objects of this cache to the pool.  The behavior is undefined unless
+    /// `0 <= numObjects <= numIdleObjects()`.
+    void releaseObjectsToPool(int numObjects);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ObjectPoolCache,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+
+    /// Create a cache of objects obtained from the specified `pool` that
+    /// retains at most `k_DEFAULT_MAX_IDLE_OBJECTS` idle objects.
+    /// Optionally specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  The behavior is undefined unless `pool` outlives this object.
+    explicit
+    ObjectPoolCache(PoolType *pool, bslma::Allocator *basicAllocator = 0);
+
+    /// Create a cache of objects obtained from the specified `pool` that
+    /// retains at most the specified `maxIdleObjects` idle objects.
+    /// Optionally specify a `basicAllocator` used to supply memory.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.  The behavior is undefined unless `0 <= maxIdleObjects` and
+    /// `pool` outlives this object.  Note that if `maxIdleObjects` is 0,
+    /// all requests are forwarded to `pool`.
+    ObjectPoolCache(PoolType         *pool,
+                    int               maxIdleObjects,
+                    bslma::Allocator *basicAllocator = 0);
+
+    /// Return all idle objects of this cache to the pool, and destroy this
+    /// object.
+    ~ObjectPoolCache();
+
+    // MANIPULATORS
+
+    /// Return the address of a modifiable object, which is the most
+    /// recently released idle object of this cache if there is one, and
+    /// otherwise is obtained from the pool (which is replenished if
+    /// depleted), together with a batch of additional objects to be
+    /// retained by this cache.
+    TYPE *getObject();
+
+    /// Reset the specified `object` (by invoking the `RESETTER` of the
+    /// pool) and retain it as an idle object of this cache.  If this cache
+    /// already retains `maxIdleObjects()` idle objects, first return a
+    /// batch of its least recently released idle objects to the pool.  The
+    /// behavior is undefined unless `object` was obtained from the pool (or
+    /// from any cache of the pool) and is not already in a released state.
+    void releaseObject(TYPE *object);
+
+    /// Return the least recently released idle objects of this cache to the
+    /// pool, so that at most the optionally specified `numRetainedObjects`
+    /// idle objects remain.  If `numRetainedObjects` is not specified, all
+    /// idle objects are returned to the pool.  The behavior is undefined
+    /// unless `0 <= numRetainedObjects`.
+    void trim(int numRetainedObjects = 0);
+
+    // ACCESSORS
+
+    /// Return the maximum number of idle objects retained by this cache.
+    int maxIdleObjects() const;
+
+    /// Return the number of idle objects currently retained by this cache.
+    int numIdleObjects() const;
+
+    /// Return the address of the pool supplying the objects of this cache.
+    PoolType *pool() const;
+};
+
 // ============================================================================
 //                            INLINE DEFINITIONS
 // ============================================================================
@@ -1011,6 +1272,87 @@ void ObjectPool<TYPE, CREATOR, RESETTER>::addObjects(int numObjects)
     d_numAvailableObjects.addRelaxed(numObjects);
 }
 
+template <class TYPE, class CREATOR, class RESETTER>
+bool ObjectPool<TYPE, CREATOR, RESETTER>::releaseNode(ObjectNode *node)
+{
+    int refCount = bsls::AtomicOperations::getIntRelaxed(
+                                                    &node->d_inUse.d_refCount);
+    do {
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(2 == refCount)) {
+            refCount = bsls::AtomicOperations::testAndSwapInt(
+                                                     &node->d_inUse.d_refCount,
+                                                     2,
+                                                     0);
+            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(2 == refCount)) {
+                break;
+            }
+        }
+
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        const int oldRefCount = refCount;
+        refCount = bsls::AtomicOperations::testAndSwapInt(
+                                                     &node->d_inUse.d_refCount,
+                                                     refCount,
+                                                     refCount - 1);
+        if (oldRefCount == refCount) {
+            // Someone else is still trying to pop this item.  Just let them
+            // have it.
+
+            d_numAvailableObjects.addRelaxed(1);
+            return false;                                             // RETURN
+        }
+
+    } while (1);
+
+    return true;
+}
+
+template <class TYPE, class CREATOR, class RESETTER>
+void ObjectPool<TYPE, CREATOR, RESETTER>::releaseResetObjects(
+                                                      TYPE * const *objects,
+                                                      int           numObjects)
+{
+    BSLS_ASSERT(0 <= numObjects);
+
+    // Link the nodes that we must add to the free list into a chain (as in
+    // 'addObjects'), and attach the whole chain at once.
+
+    ObjectNode *first = 0;
+    ObjectNode *last  = 0;
+    int         numLinked = 0;
+
+    for (int i = 0; i < numObjects; ++i) {
+        ObjectNode *node = (ObjectNode *)(void *)objects[i] - 1;
+
+        if (releaseNode(node)) {
+            bsls::AtomicOperations::setPtrRelaxed(&node->d_inUse.d_next_p,
+                                                  first);
+            if (!last) {
+                last = node;
+            }
+            first = node;
+            ++numLinked;
+        }
+    }
+
+    if (!first) {
+        return;                                                       // RETURN
+    }
+
+    ObjectNode *head = d_freeObjectsList.loadRelaxed();
+    for (;;) {
+        bsls::AtomicOperations::setPtrRelaxed(&last->d_inUse.d_next_p, head);
+        ObjectNode * const oldHead = head;
+        head = d_freeObjectsList.testAndSwap(head, first);
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(oldHead == head)) {
+            break;
+        }
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+    }
+    d_numAvailableObjects.addRelaxed(numLinked);
+}
+
 // CREATORS
 template <class TYPE, class CREATOR, class RESETTER>
 ObjectPool<TYPE, CREATOR, RESETTER>::ObjectPool(
@@ -1241,35 +1583,10 @@ void ObjectPool<TYPE, CREATOR, RESETTER>::releaseObject(TYPE *object)
     ObjectNode *current = (ObjectNode *)(void *)object - 1;
     d_objectResetter.object()(object);
 
-    int refCount = bsls::AtomicOperations::getIntRelaxed(
-                                                 &current->d_inUse.d_refCount);
-    do {
-        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(2 == refCount)) {
-            refCount = bsls::AtomicOperations::testAndSwapInt(
-                                                  &current->d_inUse.d_refCount,
-                                                  2,
-                                                  0);
-            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(2 == refCount)) {
-                break;
-            }
-        }
-
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!releaseNode(current))) {
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
-
-        const int oldRefCount = refCount;
-        refCount = bsls::AtomicOperations::testAndSwapInt(
-                                                &current->d_inUse.d_refCount,
-                                                refCount,
-                                                refCount - 1);
-        if (oldRefCount == refCount) {
-            // Someone else is still trying to pop this item.  Just let them
-            // have it.
-
-            d_numAvailableObjects.addRelaxed(1);
-            return;                                                   // RETURN
-        }
-
-    } while (1);
+        return;                                                       // RETURN
+    }
 
     ObjectNode *head = d_freeObjectsList.loadRelaxed();
     for (;;) {
@@ -1324,6 +1641,152 @@ void ObjectPool<TYPE, CREATOR, RESETTER>::deleteObject(TYPE *object)
     releaseObject(object);
 }
 
+                           // ---------------------
+                           // class ObjectPoolCache
+                           // ---------------------
+
+// PRIVATE MANIPULATORS
+template <class TYPE, class CREATOR, class RESETTER>
+TYPE *ObjectPoolCache<TYPE, CREATOR, RESETTER>::getObjectFromPool()
+{
+    // Retain the batch before obtaining the returned object, so that no
+    // object is lost if replenishing the pool throws.  Note that the number
+    // of available objects is only a snapshot, so the pool may (rarely) be
+    // replenished anyway.
+
+    for (int i = 0;
+         i < d_batchSize && 0 < d_pool_p->numAvailableObjects();
+         ++i) {
+        d_objects.push_back(d_pool_p->getObject());
+    }
+
+    if (d_objects.empty()) {
+        return d_pool_p->getObject();                                 // RETURN
+    }
+
+    TYPE *object = d_objects.back();
+    d_objects.pop_back();
+    return object;
+}
+
+template <class TYPE, class CREATOR, class RESETTER>
+void ObjectPoolCache<TYPE, CREATOR, RESETTER>::releaseObjectsToPool(
+                                                                int numObjects)
+{
+    BSLS_ASSERT(0 <= numObjects);
+    BSLS_ASSERT(numObjects <= numIdleObjects());
+
+    d_pool_p->releaseResetObjects(d_objects.data(), numObjects);
+    d_objects.erase(d_objects.begin(), d_objects.begin() + numObjects);
+}
+
+// CREATORS
+template <class TYPE, class CREATOR, class RESETTER>
+ObjectPoolCache<TYPE, CREATOR, RESETTER>::ObjectPoolCache(
+                                              PoolType         *pool,
+                                              bslma::Allocator *basicAllocator)
+: d_pool_p(pool)
+, d_objects(basicAllocator)
+, d_maxIdleObjects(k_DEFAULT_MAX_IDLE_OBJECTS)
+, d_batchSize(k_DEFAULT_MAX_IDLE_OBJECTS / 2)
+{
+    BSLS_ASSERT(pool);
+
+    d_objects.reserve(d_maxIdleObjects);
+}
+
+template <class TYPE, class CREATOR, class RESETTER>
+ObjectPoolCache<TYPE, CREATOR, RESETTER>::ObjectPoolCache(
+                                              PoolType         *pool,
+                                              int               maxIdleObjects,
+                                              bslma::Allocator *basicAllocator)
+: d_pool_p(pool)
+, d_objects(basicAllocator)
+, d_maxIdleObjects(maxIdleObjects)
+, d_batchSize(maxIdleObjects / 2 ? maxIdleObjects / 2 : maxIdleObjects)
+{
+    BSLS_ASSERT(pool);
+    BSLS_ASSERT(0 <= maxIdleObjects);
+
+    d_objects.reserve(d_maxIdleObjects);
+}
+
+template <class TYPE, class CREATOR, class RESETTER>
+ObjectPoolCache<TYPE, CREATOR, RESETTER>::~ObjectPoolCache()
+{
+    releaseObjectsToPool(numIdleObjects());
+}
+
+// MANIPULATORS
+template <class TYPE, class CREATOR, class RESETTER>
+inline
+TYPE *ObjectPoolCache<TYPE, CREATOR, RESETTER>::getObject()
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_objects.empty())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return getObjectFromPool();                                   // RETURN
+    }
+
+    TYPE *object = d_objects.back();
+    d_objects.pop_back();
+    return object;
+}
+
+template <class TYPE, class CREATOR, class RESETTER>
+inline
+void ObjectPoolCache<TYPE, CREATOR, RESETTER>::releaseObject(TYPE *object)
+{
+    BSLS_ASSERT(object);
+
+    d_pool_p->d_objectResetter.object()(object);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(numIdleObjects() ==
+                                              d_maxIdleObjects)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        if (0 == d_maxIdleObjects) {
+            d_pool_p->releaseResetObjects(&object, 1);
+            return;                                                   // RETURN
+        }
+        releaseObjectsToPool(d_batchSize);
+    }
+
+    d_objects.push_back(object);
+}
+
+template <class TYPE, class CREATOR, class RESETTER>
+void ObjectPoolCache<TYPE, CREATOR, RESETTER>::trim(int numRetainedObjects)
+{
+    BSLS_ASSERT(0 <= numRetainedObjects);
+
+    if (numRetainedObjects < numIdleObjects()) {
+        releaseObjectsToPool(numIdleObjects() - numRetainedObjects);
+    }
+}
+
+// ACCESSORS
+template <class TYPE, class CREATOR, class RESETTER>
+inline
+int ObjectPoolCache<TYPE, CREATOR, RESETTER>::maxIdleObjects() const
+{
+    return d_maxIdleObjects;
+}
+
+template <class TYPE, class CREATOR, class RESETTER>
+inline
+int ObjectPoolCache<TYPE, CREATOR, RESETTER>::numIdleObjects() const
+{
+    return static_cast<int>(d_objects.size());
+}
+
+template <class TYPE, class CREATOR, class RESETTER>
+inline
+typename ObjectPoolCache<TYPE, CREATOR, RESETTER>::PoolType *
+ObjectPoolCache<TYPE, CREATOR, RESETTER>::pool() const
+{
+    return d_pool_p;
+}
+
                        // ---------------------------
                        // ObjectPool_CreatorConverter
                        // ---------------------------
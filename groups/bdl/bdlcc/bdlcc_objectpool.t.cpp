@@ -104,6 +104,17 @@ using namespace bsl;
 // ACCESSORS
 // [ 8] int numAvailableObjects() const;
 // [ 7] int numObjects() const;
+//
+// `ObjectPoolCache`
+// [18] ObjectPoolCache(PoolType *pool, *ba = 0);
+// [18] ObjectPoolCache(PoolType *pool, int maxIdleObjects, *ba = 0);
+// [18] ~ObjectPoolCache();
+// [18] TYPE *getObject();
+// [18] void releaseObject(TYPE *object);
+// [18] void trim(int numRetainedObjects = 0);
+// [18] int maxIdleObjects() const;
+// [18] int numIdleObjects() const;
+// [18] PoolType *pool() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 3] Verify concurrent access to underlying free object list.
@@ -111,6 +122,8 @@ using namespace bsl;
 // [ 5] Verify concurrent access to underlying free object list.
 // [ 6] Verify concurrent access to underlying free object list.
 // [10] USAGE EXAMPLE
+// [19] USAGE EXAMPLE 2
+// [-1] BENCHMARK: CONTENDED `getObject`/`releaseObject`
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACROS
@@ -498,6 +511,129 @@ void case13Processor(bdlcc::ObjectPool<Case13Type>  *mX,
 
 }  // close unnamed namespace
 
+//                         CASE -1 RELATED ENTITIES
+//-----------------------------------------------------------------------------
+
+namespace OBJECTPOOL_TEST_CASE_MINUS_1
+{
+
+/// This class is the type of the pooled objects in the benchmark.
+struct my_Object {
+    char d_buffer[64];
+};
+
+typedef bdlcc::ObjectPool<my_Object>      Pool;
+typedef bdlcc::ObjectPoolCache<my_Object> Cache;
+
+/// Acquire and release an object from the specified `pool` the specified
+/// `numIterations` times, after waiting on the specified `barrier`.  Use a
+/// per-thread cache of the pool if the specified `useCache` is `true`.
+void benchmarkThread(Pool            *pool,
+                     bslmt::Barrier  *barrier,
+                     int              numIterations,
+                     bool             useCache)
+{
+    Cache cache(pool);
+
+    barrier->wait();
+
+    if (useCache) {
+        for (int i = 0; i < numIterations; ++i) {
+            my_Object *object = cache.getObject();
+            object->d_buffer[0] = static_cast<char>(i);
+            cache.releaseObject(object);
+        }
+    }
+    else {
+        for (int i = 0; i < numIterations; ++i) {
+            my_Object *object = pool->getObject();
+            object->d_buffer[0] = static_cast<char>(i);
+            pool->releaseObject(object);
+        }
+    }
+}
+
+}  // close namespace OBJECTPOOL_TEST_CASE_MINUS_1
+
+//                         CASE 18 RELATED ENTITIES
+//-----------------------------------------------------------------------------
+
+namespace OBJECTPOOL_TEST_CASE_18
+{
+
+/// This class records the number of times it was reset.
+struct my_Resettable {
+
+    // DATA
+    int d_resetCount;
+    int d_value;
+
+    // CREATORS
+    my_Resettable()
+    : d_resetCount(0)
+    , d_value(0)
+    {
+    }
+
+    // MANIPULATORS
+    void reset()
+    {
+        ++d_resetCount;
+        d_value = 0;
+    }
+};
+
+typedef bdlcc::ObjectPool<
+                       my_Resettable,
+                       bdlcc::ObjectPoolFunctors::DefaultCreator,
+                       bdlcc::ObjectPoolFunctors::Reset<my_Resettable> > Pool;
+
+typedef bdlcc::ObjectPoolCache<
+                      my_Resettable,
+                      bdlcc::ObjectPoolFunctors::DefaultCreator,
+                      bdlcc::ObjectPoolFunctors::Reset<my_Resettable> > Cache;
+
+/// Repeatedly acquire a few objects through a cache of the specified `pool`
+/// having the specified `maxIdleObjects`, verify that they are exclusively
+/// owned and reset, and release them (alternately to the cache and directly
+/// to the pool), after waiting on the specified `barrier`.
+void cacheThread(Pool *pool, int maxIdleObjects, bslmt::Barrier *barrier)
+{
+    enum { k_NUM_ITERATIONS = 2000, k_NUM_HELD = 3 };
+
+    Cache cache(pool, maxIdleObjects);
+
+    barrier->wait();
+
+    for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+        my_Resettable *objects[k_NUM_HELD];
+
+        for (int j = 0; j < k_NUM_HELD; ++j) {
+            objects[j] = cache.getObject();
+            LOOP2_ASSERTT(i, j, 0 == objects[j]->d_value);
+            objects[j]->d_value = j + 1;
+        }
+
+        bslmt::ThreadUtil::yield();
+
+        for (int j = 0; j < k_NUM_HELD; ++j) {
+            LOOP2_ASSERTT(i, j, j + 1 == objects[j]->d_value);
+            if (i % 7 == j) {
+                pool->releaseObject(objects[j]);
+            }
+            else {
+                cache.releaseObject(objects[j]);
+            }
+        }
+
+        if (0 == i % 100) {
+            cache.trim(maxIdleObjects / 2);
+        }
+    }
+}
+
+}  // close namespace OBJECTPOOL_TEST_CASE_18
+
 //                         CASE 12 RELATED ENTITIES
 //-----------------------------------------------------------------------------
 
@@ -1238,6 +1374,90 @@ extern "C" void queryHandler2(Query *query)
 
 }  // close namespace OBJECTPOOL_TEST_USAGE_EXAMPLE
 
+namespace OBJECTPOOL_TEST_USAGE_EXAMPLE_2
+{
+
+///Example 2: Using a Per-Thread Object Cache
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose that each thread of a message-processing service parses a very
+// large number of short messages, and that each message requires a parser
+// object that is expensive to construct.  We could share a pool of parsers
+// among the threads, but acquiring and releasing a parser for every message
+// would make the free list of the pool a point of contention.  Instead, each
+// thread acquires parsers through its own `bdlcc::ObjectPoolCache`.
+//
+// First, we define a trivial parser type, whose `reset` method is invoked
+// whenever a parser is returned for reuse:
+// ```
+
+    /// This class simulates a parser of messages.
+    class my_Parser {
+
+        // DATA
+        int d_numParsed;  // number of messages parsed since last `reset`
+
+      public:
+        // CREATORS
+        my_Parser()
+        : d_numParsed(0)
+        {
+        }
+
+        // MANIPULATORS
+
+        /// Parse the specified `message`.
+        void parse(const bsl::string& message)
+        {
+            (void)message;
+            ++d_numParsed;
+        }
+
+        void reset()
+        {
+            d_numParsed = 0;
+        }
+
+        // ACCESSORS
+        int numParsed() const
+        {
+            return d_numParsed;
+        }
+    };
+
+    typedef bdlcc::ObjectPool<my_Parser,
+                              bdlcc::ObjectPoolFunctors::DefaultCreator,
+                              bdlcc::ObjectPoolFunctors::Reset<my_Parser> >
+                                                                    ParserPool;
+
+    typedef bdlcc::ObjectPoolCache<
+                                  my_Parser,
+                                  bdlcc::ObjectPoolFunctors::DefaultCreator,
+                                  bdlcc::ObjectPoolFunctors::Reset<my_Parser> >
+                                                                   ParserCache;
+// ```
+// Then, we define the function executed by each thread, which creates a cache
+// that retains at most 8 idle parsers from the specified shared `pool`:
+// ```
+
+    /// Parse the specified `numMessages` messages using parsers from the
+    /// specified `pool`.
+    void parseMessages(ParserPool *pool, int numMessages)
+    {
+        ParserCache cache(pool, 8);
+
+        for (int i = 0; i < numMessages; ++i) {
+            my_Parser *parser = cache.getObject();
+            ASSERT(0 == parser->numParsed());
+
+            parser->parse("message");
+
+            cache.releaseObject(parser);
+        }
+    }
+// ```
+
+}  // close namespace OBJECTPOOL_TEST_USAGE_EXAMPLE_2
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -1260,6 +1480,270 @@ int main(int argc, char *argv[])
                                       bsl::format("case {}", test)));
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 19: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE 2
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE 2
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE 2" << endl
+                          << "===============" << endl;
+
+        using namespace OBJECTPOOL_TEST_USAGE_EXAMPLE_2;
+
+// Finally, we create the shared pool and run several threads that use it:
+// ```
+    ParserPool pool;
+
+    bslmt::ThreadGroup tg;
+    tg.addThreads(bdlf::BindUtil::bind(&parseMessages, &pool, 10000), 4);
+    tg.joinAll();
+// ```
+// Since each thread has only one parser in use at any time, and its cache
+// retains it for the next message, each thread obtained only a single batch
+// of parsers from the pool, and returned them when its cache was destroyed:
+// ```
+    ASSERT(pool.numObjects() == pool.numAvailableObjects());
+// ```
+      } break;
+      case 18: {
+        // --------------------------------------------------------------------
+        // TESTING `ObjectPoolCache`
+        //
+        // Concerns:
+        // 1. A cache created without specifying the maximum number of idle
+        //    objects retains at most `k_DEFAULT_MAX_IDLE_OBJECTS` objects,
+        //    and `pool` returns the address of the pool.
+        //
+        // 2. `getObject` returns the most recently released idle object of
+        //    the cache, and otherwise obtains a batch of objects from the
+        //    pool, retaining all but one of them.
+        //
+        // 3. `releaseObject` resets the object and retains it; if the cache
+        //    is full, a batch of objects is first returned to the pool.
+        //
+        // 4. `trim` returns idle objects to the pool so that at most the
+        //    specified number remain.
+        //
+        // 5. A cache having a maximum of 0 idle objects forwards all requests
+        //    to the pool.
+        //
+        // 6. Objects obtained from a cache may be released to the pool, and
+        //    vice versa.
+        //
+        // 7. The destructor returns all idle objects to the pool, and the
+        //    supplied allocator is used (only) for the cache's bookkeeping.
+        //
+        // 8. Concurrent use of several caches of a single pool, together
+        //    with direct use of the pool, never hands out an object to more
+        //    than one thread at a time.
+        //
+        // Plan:
+        // 1. Perform a sequence of operations on caches of a pool having a
+        //    known number of available objects, and verify the number of
+        //    idle objects of the caches, the number of available objects of
+        //    the pool, the addresses of returned objects, and the number of
+        //    times each object was reset.  (C-1..7)
+        //
+        // 2. Run several threads, each owning a cache of a shared pool, that
+        //    repeatedly acquire, mark, verify, and release objects
+        //    (occasionally directly to the pool), and trim their caches.
+        //    Verify that all objects are available once all threads (and
+        //    their caches) are done.  (C-8)
+        //
+        // Testing:
+        //   ObjectPoolCache(PoolType *pool, *ba = 0);
+        //   ObjectPoolCache(PoolType *pool, int maxIdleObjects, *ba = 0);
+        //   ~ObjectPoolCache();
+        //   TYPE *getObject();
+        //   void releaseObject(TYPE *object);
+        //   void trim(int numRetainedObjects = 0);
+        //   int maxIdleObjects() const;
+        //   int numIdleObjects() const;
+        //   PoolType *pool() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `ObjectPoolCache`" << endl
+                          << "=========================" << endl;
+
+        using namespace OBJECTPOOL_TEST_CASE_18;
+
+        bslma::TestAllocator ta(veryVeryVerbose);  // pool allocator
+        bslma::TestAllocator ca(veryVeryVerbose);  // cache allocator
+
+        if (verbose) cout << "\nDefault maximum number of idle objects."
+                          << endl;
+        {
+            Pool pool(-1, &ta);
+
+            Cache mX(&pool, &ca);  const Cache& X = mX;
+
+            ASSERT(Cache::k_DEFAULT_MAX_IDLE_OBJECTS == X.maxIdleObjects());
+            ASSERT(0     == X.numIdleObjects());
+            ASSERT(&pool == X.pool());
+            ASSERT(0     <  ca.numBlocksInUse());
+        }
+        ASSERT(0 == ca.numBlocksInUse());
+
+        if (verbose) cout << "\nBatching, reuse, and trimming." << endl;
+        {
+            enum { k_MAX_IDLE = 4, k_BATCH = k_MAX_IDLE / 2, k_NUM = 10 };
+
+            Pool pool(-1, &ta);
+            pool.reserveCapacity(k_NUM);
+            ASSERT(k_NUM == pool.numAvailableObjects());
+
+            {
+                Cache mX(&pool, k_MAX_IDLE, &ca);  const Cache& X = mX;
+
+                ASSERT(k_MAX_IDLE == X.maxIdleObjects());
+
+                // An empty cache obtains a batch from the pool.
+
+                my_Resettable *p = mX.getObject();
+                ASSERT(k_BATCH - 1     == X.numIdleObjects());
+                ASSERT(k_NUM - k_BATCH == pool.numAvailableObjects());
+
+                // Released objects are reset, retained, and reused first.
+
+                p->d_value = 5;
+                const int RESET_COUNT = p->d_resetCount;
+
+                mX.releaseObject(p);
+                ASSERT(k_BATCH         == X.numIdleObjects());
+                ASSERT(k_NUM - k_BATCH == pool.numAvailableObjects());
+                ASSERT(RESET_COUNT + 1 == p->d_resetCount);
+                ASSERT(0               == p->d_value);
+
+                ASSERT(p == mX.getObject());
+                mX.releaseObject(p);
+
+                // A full cache returns a batch to the pool.
+
+                enum { k_NUM_HELD = k_NUM - k_BATCH };
+
+                my_Resettable *objects[k_NUM_HELD];
+                for (int i = 0; i < k_NUM_HELD; ++i) {
+                    objects[i] = pool.getObject();
+                }
+                ASSERT(0 == pool.numAvailableObjects());
+
+                for (int i = 0; i < k_MAX_IDLE - k_BATCH; ++i) {
+                    mX.releaseObject(objects[i]);
+                }
+                ASSERT(k_MAX_IDLE == X.numIdleObjects());
+
+                const int NUM_AVAILABLE = pool.numAvailableObjects();
+
+                mX.releaseObject(objects[k_MAX_IDLE - k_BATCH]);
+                ASSERT(k_MAX_IDLE - k_BATCH + 1 == X.numIdleObjects());
+                ASSERT(NUM_AVAILABLE + k_BATCH  == pool.numAvailableObjects());
+
+                // The most recently released objects were retained.
+
+                ASSERT(objects[k_MAX_IDLE - k_BATCH] == mX.getObject());
+                mX.releaseObject(objects[k_MAX_IDLE - k_BATCH]);
+
+                // Objects from the pool may be released to the cache, and
+                // objects from the cache to the pool.
+
+                p = mX.getObject();
+                pool.releaseObject(p);
+                ASSERT(NUM_AVAILABLE + k_BATCH + 1 ==
+                                                   pool.numAvailableObjects());
+                for (int i = k_MAX_IDLE - k_BATCH + 1; i < k_NUM_HELD; ++i) {
+                    pool.releaseObject(objects[i]);
+                }
+
+                // `trim` returns idle objects to the pool.
+
+                const int NUM_IDLE = X.numIdleObjects();
+                ASSERT(1 < NUM_IDLE);
+
+                mX.trim(NUM_IDLE + 1);
+                ASSERT(NUM_IDLE == X.numIdleObjects());
+
+                mX.trim(1);
+                ASSERT(1 == X.numIdleObjects());
+
+                mX.trim();
+                ASSERT(0 == X.numIdleObjects());
+                ASSERT(pool.numObjects() == pool.numAvailableObjects());
+
+                p = mX.getObject();
+                mX.releaseObject(p);
+                ASSERT(0 < X.numIdleObjects());
+            }
+
+            // The destructor returns all idle objects.
+
+            ASSERT(pool.numObjects() == pool.numAvailableObjects());
+            ASSERT(0 == ca.numBlocksInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nCaching disabled." << endl;
+        {
+            Pool pool(-1, &ta);
+            pool.reserveCapacity(2);
+
+            Cache mX(&pool, 0, &ca);  const Cache& X = mX;
+
+            ASSERT(0 == X.maxIdleObjects());
+
+            my_Resettable *p = mX.getObject();
+            ASSERT(0 == X.numIdleObjects());
+            ASSERT(1 == pool.numAvailableObjects());
+
+            const int RESET_COUNT = p->d_resetCount;
+
+            mX.releaseObject(p);
+            ASSERT(0               == X.numIdleObjects());
+            ASSERT(2               == pool.numAvailableObjects());
+            ASSERT(RESET_COUNT + 1 == p->d_resetCount);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nConcurrent use of caches." << endl;
+        {
+            enum { k_NUM_THREADS = 4 };
+
+            for (int maxIdle = 0; maxIdle < 8; maxIdle += 3) {
+                if (veryVerbose) { T_ P(maxIdle) }
+
+                Pool pool(-1, &ta);
+
+                bslmt::Barrier     barrier(k_NUM_THREADS);
+                bslmt::ThreadGroup tg;
+
+                tg.addThreads(bdlf::BindUtil::bind(&cacheThread,
+                                                   &pool,
+                                                   maxIdle,
+                                                   &barrier),
+                              k_NUM_THREADS);
+                tg.joinAll();
+
+                ASSERTV(maxIdle,
+                        pool.numObjects(),
+                        pool.numAvailableObjects(),
+                        pool.numObjects() == pool.numAvailableObjects());
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
       case 17: {
         /////////////////////////////////////////////////////////
         // bdlma::Factory test
@@ -2560,6 +3044,61 @@ int main(int argc, char *argv[])
 
       } break;
 
+      case -1: {
+        // --------------------------------------------------------------------
+        // BENCHMARK: CONTENDED `getObject`/`releaseObject`
+        //
+        // Concerns:
+        // 1. Acquiring and releasing objects through per-thread caches scales
+        //    better with the number of threads than using the pool directly.
+        //
+        // Plan:
+        // 1. For an increasing number of threads, time a fixed number of
+        //    acquire/release pairs per thread, first directly on a shared
+        //    pool, and then through a per-thread cache of the pool, and
+        //    report the elapsed times.  (C-1)
+        //
+        // Testing:
+        //   BENCHMARK: CONTENDED `getObject`/`releaseObject`
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+               << "BENCHMARK: CONTENDED `getObject`/`releaseObject`" << endl
+               << "================================================" << endl;
+
+        using namespace OBJECTPOOL_TEST_CASE_MINUS_1;
+
+        enum { k_NUM_ITERATIONS = 1000000 };
+
+        for (int numThreads = 1; numThreads <= 8; numThreads *= 2) {
+            for (int useCache = 0; useCache < 2; ++useCache) {
+                Pool pool;
+
+                bslmt::Barrier     barrier(numThreads + 1);
+                bslmt::ThreadGroup tg;
+
+                tg.addThreads(bdlf::BindUtil::bind(&benchmarkThread,
+                                                   &pool,
+                                                   &barrier,
+                                                   static_cast<int>(
+                                                             k_NUM_ITERATIONS),
+                                                   0 != useCache),
+                              numThreads);
+
+                const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+                barrier.wait();
+                tg.joinAll();
+                const bsls::Types::Int64 elapsed =
+                                          bsls::TimeUtil::getTimer() - start;
+
+                cout << (useCache ? "cache" : "pool ")
+                     << "  threads: " << numThreads
+                     << "  ns/op: "
+                     << static_cast<double>(elapsed) / k_NUM_ITERATIONS
+                     << endl;
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -8,6 +8,8 @@ BSLS_IDENT_RCSID(bdlde_base64decoder_cpp,"$Id$ $CSID$")
 
 #include <bsls_assert.h>
 
+#include <bsl_algorithm.h>
+
 namespace {
 namespace u {
 
@@ -176,6 +178,30 @@ namespace bdlde {
                          // class Base64Decoder
                          // -------------------
 
+// PRIVATE MANIPULATORS
+int Base64Decoder::decodeGroups(char       **out,
+                                const char **begin,
+                                const char  *end,
+                                int          maxNumOut)
+{
+    BSLS_ASSERT(e_INPUT_STATE == d_state);
+    BSLS_ASSERT(0 == d_bitsInStack);
+
+    bsl::size_t length = end - *begin;
+    if (0 <= maxNumOut) {
+        length = bsl::min(length, static_cast<bsl::size_t>(maxNumOut / 3 * 4));
+    }
+
+    const bsl::size_t numConsumed = BulkCodecUtil::decodeBase64(*out,
+                                                                *begin,
+                                                                length,
+                                                                d_alphabet);
+    *begin += numConsumed;
+    *out   += numConsumed / 4 * 3;
+
+    return static_cast<int>(numConsumed);
+}
+
 // CREATORS
 Base64Decoder::Base64Decoder(const Base64DecoderOptions& options)
 : d_outputLength(0)
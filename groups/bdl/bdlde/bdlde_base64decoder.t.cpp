@@ -241,6 +241,7 @@ using bsl::ptrdiff_t;
 // [13] TABLE PLUS RANDOM TESTING, UNPADDED MODE, INJECTED GARBAGE
 // [14] 0 == U_ENABLE_DEPRECATIONS
 // [15] Constructors.
+// [16] CONCERN: contiguous input is decoded in bulk.
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -682,6 +683,53 @@ void removePadding(bsl::string *result)
     }
 }
 
+/// Decode the sequence `[begin, end)` using the specified `object` by
+/// calling `convert` until all input is consumed, followed by `endConvert`
+/// until no output remains, writing to the specified `out` and passing the
+/// specified `maxNumOut` to each call.  Append the status, `numOut`, and
+/// (for `convert`) `numIn` results of each call to the specified `trace`.
+/// Stop after the first call returning a negative status.
+template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
+void convertInChunks(bsl::vector<int> *trace,
+                     Obj              *object,
+                     OUTPUT_ITERATOR   out,
+                     INPUT_ITERATOR    begin,
+                     INPUT_ITERATOR    end,
+                     int               maxNumOut)
+{
+    int rc;
+    while (begin != end) {
+        int numOut = -1;
+        int numIn  = -1;
+
+        rc = object->convert(out, &numOut, &numIn, begin, end, maxNumOut);
+        trace->push_back(rc);
+        trace->push_back(numOut);
+        trace->push_back(numIn);
+        if (rc < 0 || (0 == numOut && 0 == numIn)) {
+            return;                                                   // RETURN
+        }
+
+        for (int ii = 0; ii < numOut; ++ii) {
+            ++out;
+        }
+        bsl::advance(begin, numIn);
+    }
+
+    int numOut;
+    do {
+        numOut = -1;
+
+        rc = object->endConvert(out, &numOut, maxNumOut);
+        trace->push_back(rc);
+        trace->push_back(numOut);
+
+        for (int ii = 0; ii < numOut; ++ii) {
+            ++out;
+        }
+    } while (0 < rc && 0 < numOut);
+}
+
 }  // close namespace u
 }  // close unnamed namespace
 
@@ -2455,6 +2503,188 @@ void testCase##NUMBER(bool verbose,                                           \
                       bool veryVeryVerbose,                                   \
                       bool veryVeryVeryVerbose)
 
+DEFINE_TEST_CASE(16)
+{
+    // ------------------------------------------------------------------------
+    // TESTING BULK DECODING OF CONTIGUOUS INPUT
+    //   `convert` decodes runs of complete groups of input supplied as a range
+    //   of `char` pointers in bulk (see `bdlde_bulkcodecutil`), and all other
+    //   input a character at a time.
+    //
+    // Concerns:
+    // 1. Decoding valid contiguous input yields the original data, and
+    //    decoding any contiguous input in chunks limited by `maxNumOut`
+    //    yields a prefix of the output of decoding it with no limit, all of
+    //    which is written unless an error is detected.
+    //
+    // 2. Bulk decoding resumes correctly after whitespace (e.g., line breaks)
+    //    and stops at padding and at invalid characters.
+    //
+    // 3. A `maxNumOut` limit falling anywhere within a group is observed.
+    //
+    // 4. Contiguous input is decoded in bulk regardless of the type of the
+    //    output iterator.
+    //
+    // Plan:
+    // 1. For random inputs of a variety of lengths, encode the input with
+    //    each alphabet and padding mode, with and without line breaks, and
+    //    optionally inject whitespace or garbage into the encoding.  For each
+    //    ignore mode and `maxNumOut` from a table, decode the result,
+    //    supplied as a range of `const char *`, by a sequence of calls to
+    //    `convert` followed by `endConvert`, with both `char *` and
+    //    back-insert iterator output.  Verify that the sequences of results
+    //    are identical, that the outputs are consistent with the output
+    //    obtained with no `maxNumOut` limit, and that valid input yields the
+    //    original data.  Note that `bdlde_bulkcodecutil` verifies that
+    //    contiguous input is decoded exactly as the same input supplied
+    //    through non-contiguous iterators.  (C-1..4)
+    //
+    // Testing:
+    //   CONCERN: contiguous input is decoded in bulk.
+    // ------------------------------------------------------------------------
+
+    (void)veryVeryVeryVerbose;
+    (void)veryVeryVerbose;
+
+    if (verbose) cout << endl
+                      << "TESTING BULK DECODING OF CONTIGUOUS INPUT" << endl
+                      << "=========================================" << endl;
+
+    static const int LENGTHS[] = { 0, 1, 2, 3, 4, 5, 6, 11, 12, 13, 47, 48,
+                                   49, 96, 200, 575, 576, 577, 2000 };
+    enum { k_NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS };
+
+    static const int MAX_NUM_OUTS[] = { -1, 1, 2, 3, 5, 13, 64, 1000 };
+    enum { k_NUM_MAX_NUM_OUTS = sizeof MAX_NUM_OUTS / sizeof *MAX_NUM_OUTS };
+
+    u::RandGen rand;
+
+    for (int ti = 0; ti < k_NUM_LENGTHS; ++ti) {
+        const int LENGTH = LENGTHS[ti];
+
+        bsl::string plain;
+        rand.randString(&plain, LENGTH);
+
+        for (int ai = 0; ai < k_NUM_ALPHA; ++ai) {
+        for (int pi = 0; pi < 2; ++pi) {
+        for (int ii = 0; ii < 4; ++ii) {
+            const Alpha::Enum ALPHABET    = ai ? Alpha::e_URL : Alpha::e_BASIC;
+            const bool        PADDED      = pi;
+            const bool        LINE_BREAKS = ii & 1;
+            const bool        WHITESPACE  = 2 == ii;
+            const bool        GARBAGE     = 3 == ii;
+
+            bsl::string input;
+            {
+                bdlde::Base64Encoder encoder(EncoderOptions::custom(
+                                                          LINE_BREAKS ? 76 : 0,
+                                                          ALPHABET,
+                                                          PADDED));
+                ASSERT(0 == encoder.convert(bsl::back_inserter(input),
+                                            plain.begin(),
+                                            plain.end()));
+                ASSERT(0 == encoder.endConvert(bsl::back_inserter(input)));
+            }
+            if (WHITESPACE) {
+                rand.injectWhitespace(&input);
+            }
+            if (GARBAGE) {
+                rand.injectGarbage(&input, false, ai);
+            }
+
+            const char *const BEGIN = input.data();
+            const char *const END   = BEGIN + input.length();
+
+            for (int gi = 0; gi < k_NUM_IGNORE; ++gi) {
+            for (int mi = 0; mi < k_NUM_MAX_NUM_OUTS; ++mi) {
+                const Ignore::Enum IGNORE      = static_cast<Ignore::Enum>(gi);
+                const int          MAX_NUM_OUT = MAX_NUM_OUTS[mi];
+
+                const Options OPTIONS = Options::custom(IGNORE,
+                                                        ALPHABET,
+                                                        PADDED);
+
+                if (veryVerbose) {
+                    T_ P_(LENGTH) P_(ALPHABET) P_(PADDED) P_(ii) P_(IGNORE)
+                    P(MAX_NUM_OUT)
+                }
+
+                bsl::vector<int>  unlimitedTrace;
+                bsl::vector<char> expected(input.length() + 1, '?');
+                int               expectedLength;
+                {
+                    Obj mX(OPTIONS);
+                    u::convertInChunks(&unlimitedTrace,
+                                       &mX,
+                                       &expected[0],
+                                       BEGIN,
+                                       END,
+                                       -1);
+                    expectedLength = mX.outputLength();
+                }
+
+                // A `maxNumOut` limit may prevent output preceding an error
+                // from being written, so only successfully decoded input is
+                // required to yield all of the unlimited output.
+
+                bsl::vector<int>  expTrace;
+                bsl::vector<char> result(input.length() + 1, '?');
+                {
+                    Obj mX(OPTIONS);
+                    u::convertInChunks(&expTrace,
+                                       &mX,
+                                       &result[0],
+                                       BEGIN,
+                                       END,
+                                       MAX_NUM_OUT);
+                    if (!GARBAGE && (LINE_BREAKS || WHITESPACE)
+                                 && Ignore::e_IGNORE_NONE != IGNORE) {
+                        ASSERTV(LENGTH, ii, IGNORE, MAX_NUM_OUT, mX.isDone());
+                        ASSERTV(LENGTH, ii, IGNORE, MAX_NUM_OUT,
+                                LENGTH == mX.outputLength());
+                        ASSERTV(LENGTH, ii, IGNORE, MAX_NUM_OUT,
+                                bsl::equal(plain.begin(),
+                                           plain.end(),
+                                           result.begin()));
+                    }
+
+                    const int resultLength = mX.outputLength();
+
+                    ASSERTV(LENGTH, ii, IGNORE, MAX_NUM_OUT,
+                            mX.isError() || expectedLength == resultLength);
+                    ASSERTV(LENGTH, ii, IGNORE, MAX_NUM_OUT,
+                            resultLength <= expectedLength &&
+                            bsl::equal(result.begin(),
+                                       result.begin() + resultLength,
+                                       expected.begin()));
+                }
+
+                bsl::vector<int> appendedTrace;
+                bsl::string      appended;
+                {
+                    Obj mX(OPTIONS);
+                    u::convertInChunks(&appendedTrace,
+                                       &mX,
+                                       bsl::back_inserter(appended),
+                                       BEGIN,
+                                       END,
+                                       MAX_NUM_OUT);
+                }
+                ASSERTV(LENGTH, ii, IGNORE, MAX_NUM_OUT,
+                        expTrace == appendedTrace);
+                ASSERTV(LENGTH, ii, IGNORE, MAX_NUM_OUT,
+                        appended.length() <= input.length() &&
+                        bsl::equal(appended.begin(),
+                                   appended.end(),
+                                   expected.begin()));
+            }
+            }
+        }
+        }
+        }
+    }
+}
+
 DEFINE_TEST_CASE(15)
 {
     // ------------------------------------------------------------------------
@@ -8194,6 +8424,7 @@ int main(int argc, char *argv[])
   case NUMBER: testCase##NUMBER(verbose, veryVerbose, veryVeryVerbose,        \
                                                     veryVeryVeryVerbose); break
 
+        CASE(16);
         CASE(15);
         CASE(14);
         CASE(13);
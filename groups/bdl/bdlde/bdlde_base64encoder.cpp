@@ -6,6 +6,8 @@ BSLS_IDENT_RCSID(bdlde_base64encoder_cpp,"$Id$ $CSID$")
 
 #include <bsls_assert.h>
 
+#include <bsl_algorithm.h>
+
 namespace {
 namespace u {
 
@@ -53,6 +55,77 @@ namespace bdlde {
                          // class Base64Encoder
                          // -------------------
 
+// PRIVATE MANIPULATORS
+int Base64Encoder::encodeGroups(char       **out,
+                                const char **begin,
+                                const char  *end,
+                                int          maxNumOut)
+{
+    BSLS_ASSERT(0 == d_bitsInStack);
+
+    // A group written by 'append' is 4 characters, preceded or interrupted
+    // by at most 4 line breaks.
+
+    enum { k_MAX_APPENDED_GROUP_LENGTH = 4 + 4 * 2 };
+
+    const char  *input     = *begin;
+    bsl::size_t  numGroups = (end - input) / 3;
+    bsl::size_t  room      = 0 <= maxNumOut
+                           ? static_cast<bsl::size_t>(maxNumOut)
+                           : bsl::numeric_limits<bsl::size_t>::max();
+
+    while (numGroups) {
+        // Encode as many groups as fit in the rest of the current line.
+
+        bsl::size_t n = bsl::min(numGroups, room / 4);
+        if (d_maxLineLength) {
+            n = d_lineLength < d_maxLineLength
+              ? bsl::min(n,
+                         static_cast<bsl::size_t>(
+                                       (d_maxLineLength - d_lineLength) / 4))
+              : 0;
+        }
+
+        if (n) {
+            BulkCodecUtil::encodeBase64(*out, input, 3 * n, d_alphabet);
+
+            const int length = static_cast<int>(4 * n);
+
+            input          += 3 * n;
+            *out           += length;
+            d_outputLength += length;
+            d_lineLength   += length;
+            room           -= length;
+            numGroups      -= n;
+            continue;                                               // CONTINUE
+        }
+
+        // The next group needs, or straddles, a line break: let 'append'
+        // insert it, provided that there is room for the whole group.
+
+        if (!d_maxLineLength || room < k_MAX_APPENDED_GROUP_LENGTH) {
+            break;                                                     // BREAK
+        }
+
+        char group[4];
+        BulkCodecUtil::encodeBase64(group, input, 3, d_alphabet);
+
+        const int initialLength = d_outputLength;
+        const int noLimit       = d_outputLength - 1;
+        for (int i = 0; i < 4; ++i) {
+            append(out, group[i], noLimit);
+        }
+
+        input     += 3;
+        room      -= d_outputLength - initialLength;
+        numGroups -= 1;
+    }
+
+    const int numConsumed = static_cast<int>(input - *begin);
+    *begin = input;
+    return numConsumed;
+}
+
 // CREATORS
 Base64Encoder::Base64Encoder(const EncoderOptions& options)
 : d_maxLineLength(options.maxLineLength())
@@ -429,6 +429,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlde_base64alphabet.h>
 #include <bdlde_base64encoderoptions.h>
+#include <bdlde_bulkcodecutil.h>
 
 #include <bsls_assert.h>
 #include <bsls_deprecatefeature.h>
@@ -513,6 +514,33 @@ class Base64Encoder {
     template <class OUTPUT_ITERATOR>
     void encode(OUTPUT_ITERATOR *out, int maxLength);
 
+    /// Encode, using `BulkCodecUtil`, the complete groups of three bytes at
+    /// the start of the input sequence from the specified `*begin` up to,
+    /// but not including, the specified `end`, inserting soft line breaks
+    /// as necessary, and writing them to the specified `*out`, until fewer
+    /// than three bytes remain or the output of the next group might exceed
+    /// the specified `maxNumOut` characters (no limit if `maxNumOut` is
+    /// negative).  Advance `*begin` and `*out` past the bytes consumed and
+    /// the characters written, and return the number of bytes consumed.
+    /// The behavior is undefined unless the internal buffer is empty.
+    int encodeGroups(char **out, const char **begin, const char *end,
+                     int maxNumOut);
+    template <class OUTPUT_ITERATOR>
+    int encodeGroups(OUTPUT_ITERATOR  *out,
+                     const char      **begin,
+                     const char       *end,
+                     int               maxNumOut);
+    template <class OUTPUT_ITERATOR>
+    int encodeGroups(OUTPUT_ITERATOR  *out,
+                     char            **begin,
+                     char             *end,
+                     int               maxNumOut);
+
+    /// Return 0.  Note that input sequences that are not contiguous arrays
+    /// of `char` are encoded a byte at a time by `convert`.
+    template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
+    int encodeGroups(OUTPUT_ITERATOR *, INPUT_ITERATOR *, INPUT_ITERATOR, int);
+
     /// Set the state to the specified `newState`.
     void setState(State newState);
 
@@ -843,6 +871,68 @@ void Base64Encoder::encode(OUTPUT_ITERATOR *out, int maxLength)
     ++d_lineLength;
 }
 
+template <class OUTPUT_ITERATOR>
+int Base64Encoder::encodeGroups(OUTPUT_ITERATOR  *out,
+                                const char      **begin,
+                                const char       *end,
+                                int               maxNumOut)
+{
+    // Encode into a local buffer and copy the result to 'out'.
+
+    enum { k_BUFFER_SIZE = 1024 };
+
+    char buffer[k_BUFFER_SIZE];
+    int  numConsumed = 0;
+
+    while (true) {
+        const int limit = 0 <= maxNumOut && maxNumOut < k_BUFFER_SIZE
+                          ? maxNumOut
+                          : k_BUFFER_SIZE;
+
+        char      *cursor = buffer;
+        const int  numIn  = encodeGroups(&cursor, begin, end, limit);
+        if (0 == numIn) {
+            break;                                                     // BREAK
+        }
+        numConsumed += numIn;
+
+        for (const char *p = buffer; p != cursor; ++p) {
+            **out = *p;
+            ++*out;
+        }
+
+        if (0 <= maxNumOut) {
+            maxNumOut -= static_cast<int>(cursor - buffer);
+        }
+    }
+
+    return numConsumed;
+}
+
+template <class OUTPUT_ITERATOR>
+inline
+int Base64Encoder::encodeGroups(OUTPUT_ITERATOR  *out,
+                                char            **begin,
+                                char             *end,
+                                int               maxNumOut)
+{
+    const char *cursor      = *begin;
+    const int   numConsumed = encodeGroups(out, &cursor, end, maxNumOut);
+
+    *begin += numConsumed;
+    return numConsumed;
+}
+
+template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
+inline
+int Base64Encoder::encodeGroups(OUTPUT_ITERATOR *,
+                                INPUT_ITERATOR  *,
+                                INPUT_ITERATOR,
+                                int)
+{
+    return 0;
+}
+
 inline
 void Base64Encoder::setState(State newState)
 {
@@ -998,10 +1088,19 @@ int Base64Encoder::convert(OUTPUT_ITERATOR  out,
         encode(&out, maxLength);
     }
 
-    // Consume as many input bytes as possible.
+    // Consume as many input bytes as possible, encoding any complete groups
+    // in bulk.
 
     int tmpNumIn = 0;
 
+    if (0 == d_bitsInStack) {
+        tmpNumIn = encodeGroups(&out,
+                                &begin,
+                                end,
+                                0 <= maxNumOut ? maxLength - d_outputLength
+                                               : -1);
+    }
+
     while (4 >= d_bitsInStack && begin != end) {
         const unsigned char byte = static_cast<unsigned char>(*begin);
 
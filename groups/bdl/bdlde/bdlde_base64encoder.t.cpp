@@ -135,6 +135,7 @@ using bsl::ptrdiff_t;
 // [ 1] BREATHING TEST -- (developer's sandbox)
 // [15] USAGE EXAMPLE
 // [14] 0 == U_ENABLE_DEPRECATIONS
+// [16] CONCERN: contiguous input is encoded in bulk.
 // [ ?] That the input iterator can have *minimal* functionality.
 // [ ?] That the output iterator can have *minimal* functionality.
 // [ 1] ::myMin(const T& a, const T& b);
@@ -584,6 +585,52 @@ char RandGen::getChar()
     return static_cast<char>((*this)() & 0xff);
 }
 
+/// Encode the sequence `[begin, end)` using the specified `object` by
+/// calling `convert` until all input is consumed, followed by `endConvert`
+/// until no output remains, writing to the specified `out` and passing the
+/// specified `maxNumOut` to each call.  Append the status, `numOut`, and
+/// (for `convert`) `numIn` results of each call to the specified `trace`.
+template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
+void convertInChunks(bsl::vector<int> *trace,
+                     Obj              *object,
+                     OUTPUT_ITERATOR   out,
+                     INPUT_ITERATOR    begin,
+                     INPUT_ITERATOR    end,
+                     int               maxNumOut)
+{
+    int rc;
+    while (begin != end) {
+        int numOut = -1;
+        int numIn  = -1;
+
+        rc = object->convert(out, &numOut, &numIn, begin, end, maxNumOut);
+        trace->push_back(rc);
+        trace->push_back(numOut);
+        trace->push_back(numIn);
+        if (rc < 0 || (0 == numOut && 0 == numIn)) {
+            return;                                                   // RETURN
+        }
+
+        for (int ii = 0; ii < numOut; ++ii) {
+            ++out;
+        }
+        bsl::advance(begin, numIn);
+    }
+
+    int numOut;
+    do {
+        numOut = -1;
+
+        rc = object->endConvert(out, &numOut, maxNumOut);
+        trace->push_back(rc);
+        trace->push_back(numOut);
+
+        for (int ii = 0; ii < numOut; ++ii) {
+            ++out;
+        }
+    } while (0 < rc && 0 < numOut);
+}
+
 }  // close namespace u
 }  // close unnamed namespace
 
@@ -1921,6 +1968,146 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING BULK ENCODING OF CONTIGUOUS INPUT
+        //   `convert` encodes input supplied as a range of `char` pointers in
+        //   bulk (see `bdlde_bulkcodecutil`), and all other input a byte at a
+        //   time.
+        //
+        // Concerns:
+        // 1. Encoding contiguous input in chunks limited by `maxNumOut`
+        //    yields the same output as encoding it with no limit.
+        //
+        // 2. Line breaks are emitted at the same places for every maximum
+        //    line length, including ones that are not multiples of 4.
+        //
+        // 3. A `maxNumOut` limit falling anywhere within a group or a line
+        //    break is observed.
+        //
+        // 4. Contiguous input is encoded in bulk regardless of the type of
+        //    the output iterator.
+        //
+        // Plan:
+        // 1. For random inputs of a variety of lengths, and for each
+        //    alphabet, padding mode, maximum line length, and `maxNumOut`
+        //    from a table, encode the input, supplied as a range of
+        //    `const char *`, by a sequence of calls to `convert` followed by
+        //    `endConvert`, with both `char *` and back-insert iterator
+        //    output.  Verify that the sequences of results are identical, and
+        //    that the outputs are those obtained with no `maxNumOut` limit.
+        //    Note that `bdlde_bulkcodecutil` verifies that contiguous input
+        //    is encoded exactly as the same input supplied through
+        //    non-contiguous iterators.  (C-1..4)
+        //
+        // Testing:
+        //   CONCERN: contiguous input is encoded in bulk.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BULK ENCODING OF CONTIGUOUS INPUT"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        static const int LENGTHS[] = { 0, 1, 2, 3, 4, 5, 6, 11, 12, 13, 47,
+                                       48, 49, 96, 200, 767, 768, 769, 3000 };
+        enum { k_NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS };
+
+        static const int LINE_LENGTHS[] = { 0, 1, 2, 3, 4, 5, 7, 76, 77 };
+        enum { k_NUM_LINE_LENGTHS = sizeof  LINE_LENGTHS
+                                  / sizeof *LINE_LENGTHS };
+
+        static const int MAX_NUM_OUTS[] = { -1, 1, 2, 3, 5, 13, 64, 1000 };
+        enum { k_NUM_MAX_NUM_OUTS = sizeof  MAX_NUM_OUTS
+                                  / sizeof *MAX_NUM_OUTS };
+
+        u::RandGen rand;
+
+        for (int ti = 0; ti < k_NUM_LENGTHS; ++ti) {
+            const int LENGTH = LENGTHS[ti];
+
+            bsl::string input;
+            for (int ii = 0; ii < LENGTH; ++ii) {
+                input.push_back(rand.getChar());
+            }
+            const char *const BEGIN = input.data();
+            const char *const END   = BEGIN + LENGTH;
+
+            for (int ai = 0; ai < 2; ++ai) {
+            for (int pi = 0; pi < 2; ++pi) {
+            for (int li = 0; li < k_NUM_LINE_LENGTHS; ++li) {
+            for (int mi = 0; mi < k_NUM_MAX_NUM_OUTS; ++mi) {
+                const Alphabet::Enum ALPHABET    = ai ? Alphabet::e_URL
+                                                      : Alphabet::e_BASIC;
+                const bool           PADDED      = pi;
+                const int            LINE_LENGTH = LINE_LENGTHS[li];
+                const int            MAX_NUM_OUT = MAX_NUM_OUTS[mi];
+
+                const EncoderOptions OPTIONS = EncoderOptions::custom(
+                                                                   LINE_LENGTH,
+                                                                   ALPHABET,
+                                                                   PADDED);
+                const bsl::size_t    EXPECTED_LENGTH =
+                                         Obj::encodedLength(OPTIONS, LENGTH);
+
+                if (veryVerbose) {
+                    T_ P_(LENGTH) P_(ALPHABET) P_(PADDED) P_(LINE_LENGTH)
+                    P(MAX_NUM_OUT)
+                }
+
+                bsl::vector<int>  unlimitedTrace;
+                bsl::vector<char> expected(EXPECTED_LENGTH + 1, '?');
+                {
+                    Obj mX(OPTIONS);
+                    u::convertInChunks(&unlimitedTrace,
+                                       &mX,
+                                       &expected[0],
+                                       BEGIN,
+                                       END,
+                                       -1);
+                }
+
+                bsl::vector<int>  expTrace;
+                bsl::vector<char> result(EXPECTED_LENGTH + 1, '?');
+                {
+                    Obj mX(OPTIONS);
+                    u::convertInChunks(&expTrace,
+                                       &mX,
+                                       &result[0],
+                                       BEGIN,
+                                       END,
+                                       MAX_NUM_OUT);
+                    ASSERTV(LENGTH, LINE_LENGTH, MAX_NUM_OUT, mX.isDone());
+                    ASSERTV(LENGTH, LINE_LENGTH, MAX_NUM_OUT,
+                            EXPECTED_LENGTH == bsl::size_t(mX.outputLength()));
+                }
+                ASSERTV(LENGTH, LINE_LENGTH, MAX_NUM_OUT, expected == result);
+
+                bsl::vector<int> appendedTrace;
+                bsl::string      appended;
+                {
+                    Obj mX(OPTIONS);
+                    u::convertInChunks(&appendedTrace,
+                                       &mX,
+                                       bsl::back_inserter(appended),
+                                       BEGIN,
+                                       END,
+                                       MAX_NUM_OUT);
+                }
+                ASSERTV(LENGTH, LINE_LENGTH, MAX_NUM_OUT,
+                        expTrace == appendedTrace);
+                ASSERTV(LENGTH, LINE_LENGTH, MAX_NUM_OUT,
+                        EXPECTED_LENGTH == appended.length() &&
+                        bsl::equal(appended.begin(),
+                                   appended.end(),
+                                   expected.begin()));
+            }
+            }
+            }
+            }
+        }
+      } break;
       case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
@@ -0,0 +1,1144 @@
+// bdlde_bulkcodecutil.cpp                                            -*-C++-*-
+#include <bdlde_bulkcodecutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlde_bulkcodecutil_cpp,"$Id$ $CSID$")
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#include <bsl_cstring.h>
+
+#if defined(BSLS_PLATFORM_CPU_SSE4_1)
+#include <emmintrin.h>
+#include <smmintrin.h>
+#include <tmmintrin.h>
+#define BDLDE_BULKCODECUTIL_SSE_ENABLED 1
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_AVX2) && defined(BDLDE_BULKCODECUTIL_SSE_ENABLED)
+#include <immintrin.h>
+#define BDLDE_BULKCODECUTIL_AVX2_ENABLED 1
+#endif
+
+#if defined(BDLDE_BULKCODECUTIL_ENABLE_NEON)                                  \
+ && defined(BSLS_PLATFORM_CPU_ARM)                                            \
+ && defined(BSLS_PLATFORM_CPU_64_BIT)                                         \
+ && defined(BSLS_PLATFORM_IS_LITTLE_ENDIAN)                                   \
+ && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define BDLDE_BULKCODECUTIL_NEON_ENABLED 1
+#endif
+
+///Implementation Notes
+///--------------------
+// Every conversion is performed by a chain of kernels of decreasing width:
+// each kernel converts as many complete groups as it can without reading
+// beyond the end of its input, and returns the number of groups converted;
+// the next kernel picks up where the previous one left off, and the portable
+// table-driven kernel finishes the job.  A decoding kernel that encounters an
+// invalid character simply stops, leaving the precise location of the first
+// invalid group to be found by the narrower kernels that follow it.
+//
+// The x86 Base64 kernels follow the approach described by Wojciech Muła in
+// http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html: input triplets
+// are spread into 32-bit lanes with `PSHUFB`, the four 6-bit indices of each
+// lane are isolated with a pair of 16-bit multiplies, and indices are mapped
+// to ASCII by adding an offset selected (again with `PSHUFB`) by the range
+// the index falls in.  Decoding translates characters by chaining lookups of
+// the 16-byte slices of the 256-entry decode table (as previously done inline
+// in `bdlde_base64decoder`), and packs the resulting 6-bit values with
+// `PMADDUBSW` and `PMADDWD`.  The NEON kernels instead use the structured
+// loads and stores `LD3`/`ST4` (encoding) and `LD4`/`ST3` (decoding) to
+// (de)interleave the groups, and `TBL` to perform 64-entry table lookups.
+//
+// The hexadecimal kernels split bytes into nibbles and map them to digits
+// with a 16-entry table lookup when encoding; when decoding, digits and
+// letters are validated and translated arithmetically, and pairs of nibbles
+// are combined with a multiply-add.
+
+namespace BloombergLP {
+namespace {
+namespace u {
+
+                // ======================
+                // FILE-SCOPE STATIC DATA
+                // ======================
+
+// The following tables map a 6-bit index to the corresponding character of
+// the basic and of the URL and Filename Safe Base64 alphabets, respectively.
+
+const char basicEncodeTable[64] = {
+//   0    1    2    3    4    5    6    7
+    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',  // 000
+    'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',  // 010
+    'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',  // 020
+    'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',  // 030
+    'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n',  // 040
+    'o', 'p', 'q', 'r', 's', 't', 'u', 'v',  // 050
+    'w', 'x', 'y', 'z', '0', '1', '2', '3',  // 060
+    '4', '5', '6', '7', '8', '9', '+', '/',  // 070
+};
+
+const char urlEncodeTable[64] = {
+//   0    1    2    3    4    5    6    7
+    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',  // 000
+    'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',  // 010
+    'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',  // 020
+    'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',  // 030
+    'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n',  // 040
+    'o', 'p', 'q', 'r', 's', 't', 'u', 'v',  // 050
+    'w', 'x', 'y', 'z', '0', '1', '2', '3',  // 060
+    '4', '5', '6', '7', '8', '9', '-', '_',  // 070
+};
+
+// The following tables map a character to its 6-bit index in the basic and in
+// the URL and Filename Safe Base64 alphabets, respectively, or to 0xff if the
+// character is not in the alphabet.
+
+const unsigned char ff = 0xff;
+
+const unsigned char basicDecodeTable[256] = {
+    //  0   1   2   3   4   5   6   7   8   9   A   B   C   D   E   F
+    // --  --  --  --  --  --  --  --  --  --  --  --  --  --  --  --
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 00
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 10
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, 62, ff, ff, ff, 63,  // 20
+       52, 53, 54, 55, 56, 57, 58, 59, 60, 61, ff, ff, ff, ff, ff, ff,  // 30
+       ff,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,  // 40
+       15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, ff, ff, ff, ff, ff,  // 50
+       ff, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,  // 60
+       41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, ff, ff, ff, ff, ff,  // 70
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 80
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 90
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // A0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // B0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // C0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // D0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // E0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // F0
+};
+
+const unsigned char urlDecodeTable[256] = {
+    //  0   1   2   3   4   5   6   7   8   9   A   B   C   D   E   F
+    // --  --  --  --  --  --  --  --  --  --  --  --  --  --  --  --
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 00
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 10
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, 62, ff, ff,  // 20
+       52, 53, 54, 55, 56, 57, 58, 59, 60, 61, ff, ff, ff, ff, ff, ff,  // 30
+       ff,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,  // 40
+       15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, ff, ff, ff, ff, 63,  // 50
+       ff, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,  // 60
+       41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, ff, ff, ff, ff, ff,  // 70
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 80
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 90
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // A0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // B0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // C0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // D0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // E0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // F0
+};
+
+// The following tables map a 4-bit value to the corresponding lowercase and
+// uppercase hexadecimal digit, respectively.
+
+const char lowerHexTable[16] = {
+    '0', '1', '2', '3', '4', '5', '6', '7',
+    '8', '9', 'a', 'b', 'c', 'd', 'e', 'f',
+};
+
+const char upperHexTable[16] = {
+    '0', '1', '2', '3', '4', '5', '6', '7',
+    '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
+};
+
+// The following table maps a hexadecimal digit (in either case) to its 4-bit
+// value, or to 0xff if the character is not a hexadecimal digit.
+
+const unsigned char hexDecodeTable[256] = {
+    //  0   1   2   3   4   5   6   7   8   9   A   B   C   D   E   F
+    // --  --  --  --  --  --  --  --  --  --  --  --  --  --  --  --
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 00
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 10
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 20
+        0,  1,  2,  3,  4,  5,  6,  7,  8,  9, ff, ff, ff, ff, ff, ff,  // 30
+       ff, 10, 11, 12, 13, 14, 15, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 40
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 50
+       ff, 10, 11, 12, 13, 14, 15, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 60
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 70
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 80
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // 90
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // A0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // B0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // C0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // D0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // E0
+       ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff, ff,  // F0
+};
+
+                        // ========================
+                        // portable implementations
+                        // ========================
+
+/// Encode the specified `numGroups` three-byte groups of the specified
+/// `input` to the specified `result` using the specified 64-entry
+/// `encodeTable`.
+void encodeBase64Portable(char                *result,
+                          const unsigned char *input,
+                          bsl::size_t          numGroups,
+                          const char          *encodeTable)
+{
+    for (; numGroups; --numGroups, input += 3, result += 4) {
+        const unsigned int triplet = (input[0] << 16)
+                                   | (input[1] <<  8)
+                                   |  input[2];
+
+        result[0] = encodeTable[ triplet >> 18        ];
+        result[1] = encodeTable[(triplet >> 12) & 0x3f];
+        result[2] = encodeTable[(triplet >>  6) & 0x3f];
+        result[3] = encodeTable[ triplet        & 0x3f];
+    }
+}
+
+/// Decode at most the specified `numGroups` four-character groups of the
+/// specified `input` to the specified `result` using the specified 256-entry
+/// `decodeTable`, stopping at the first group containing a character that is
+/// not in the alphabet, and return the number of groups decoded.
+bsl::size_t decodeBase64Portable(char                *result,
+                                 const unsigned char *input,
+                                 bsl::size_t          numGroups,
+                                 const unsigned char *decodeTable)
+{
+    bsl::size_t i = 0;
+    for (; i < numGroups; ++i, input += 4, result += 3) {
+        const unsigned int a = decodeTable[input[0]];
+        const unsigned int b = decodeTable[input[1]];
+        const unsigned int c = decodeTable[input[2]];
+        const unsigned int d = decodeTable[input[3]];
+
+        if ((a | b | c | d) & 0x80) {
+            break;                                                     // BREAK
+        }
+
+        result[0] = static_cast<char>((a << 2) | (b >> 4));
+        result[1] = static_cast<char>((b << 4) | (c >> 2));
+        result[2] = static_cast<char>((c << 6) |  d);
+    }
+    return i;
+}
+
+/// Encode the specified `length` bytes of the specified `input` to the
+/// specified `result` using the specified 16-entry `hexTable`.
+void encodeHexPortable(char                *result,
+                       const unsigned char *input,
+                       bsl::size_t          length,
+                       const char          *hexTable)
+{
+    for (; length; --length, ++input, result += 2) {
+        result[0] = hexTable[*input >> 4];
+        result[1] = hexTable[*input & 0x0f];
+    }
+}
+
+/// Decode at most the specified `numPairs` pairs of hexadecimal digits of
+/// the specified `input` to the specified `result`, stopping at the first
+/// pair containing a character that is not a hexadecimal digit, and return
+/// the number of pairs decoded.
+bsl::size_t decodeHexPortable(char                *result,
+                              const unsigned char *input,
+                              bsl::size_t          numPairs)
+{
+    bsl::size_t i = 0;
+    for (; i < numPairs; ++i, input += 2) {
+        const unsigned int high = hexDecodeTable[input[0]];
+        const unsigned int low  = hexDecodeTable[input[1]];
+
+        if ((high | low) & 0x80) {
+            break;                                                     // BREAK
+        }
+
+        result[i] = static_cast<char>((high << 4) | low);
+    }
+    return i;
+}
+
+#if defined(BDLDE_BULKCODECUTIL_SSE_ENABLED)
+
+                        // ===================
+                        // SSE implementations
+                        // ===================
+
+/// Return the 6-bit indices, one per byte, of the four three-byte groups
+/// held in the low 12 bytes of the specified `input`.
+inline
+__m128i base64IndicesSse(__m128i input)
+{
+    // Spread each group 'b0 b1 b2' into a 32-bit lane holding 'b1 b0 b2 b1',
+    // so that each 6-bit field can be moved into its own byte with a 16-bit
+    // multiply.
+
+    input = _mm_shuffle_epi8(input,
+                             _mm_set_epi8(10, 11,  9, 10,  7,  8,  6,  7,
+                                           4,  5,  3,  4,  1,  2,  0,  1));
+
+    const __m128i t0 = _mm_and_si128(input, _mm_set1_epi32(0x0fc0fc00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(input, _mm_set1_epi32(0x003f03f0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+
+    return _mm_or_si128(t1, t3);
+}
+
+/// Return the characters corresponding to the specified 6-bit `indices`,
+/// given the specified `offsets` table holding, for each range of indices,
+/// the value to add to an index to obtain its character.
+inline
+__m128i base64CharactersSse(__m128i indices, __m128i offsets)
+{
+    // Map '[0 .. 25]' to 13, '[26 .. 51]' to 0, and '[52 .. 63]' to
+    // '[1 .. 12]', then look up the offset for each range.
+
+    __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    const __m128i isUpper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    range = _mm_or_si128(range, _mm_and_si128(isUpper, _mm_set1_epi8(13)));
+
+    return _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, range));
+}
+
+/// Return the table of offsets to be supplied to `base64CharactersSse` for
+/// the specified `alphabet`.
+inline
+__m128i base64OffsetsSse(bdlde::Base64Alphabet::Enum alphabet)
+{
+    const char c62 = bdlde::Base64Alphabet::e_BASIC == alphabet ? '+' : '-';
+    const char c63 = bdlde::Base64Alphabet::e_BASIC == alphabet ? '/' : '_';
+
+    return _mm_setr_epi8(static_cast<char>('a' - 26),
+                         static_cast<char>('0' - 52),
+                         static_cast<char>('0' - 52),
+                         static_cast<char>('0' - 52),
+                         static_cast<char>('0' - 52),
+                         static_cast<char>('0' - 52),
+                         static_cast<char>('0' - 52),
+                         static_cast<char>('0' - 52),
+                         static_cast<char>('0' - 52),
+                         static_cast<char>('0' - 52),
+                         static_cast<char>('0' - 52),
+                         static_cast<char>(c62 - 62),
+                         static_cast<char>(c63 - 63),
+                         'A',
+                         0,
+                         0);
+}
+
+/// Encode groups of the specified `input` having the specified `numGroups`
+/// three-byte groups to the specified `result` using the specified
+/// `alphabet`, four groups at a time, and return the number of groups
+/// encoded.
+bsl::size_t encodeBase64Sse(char                        *result,
+                            const char                  *input,
+                            bsl::size_t                  numGroups,
+                            bdlde::Base64Alphabet::Enum  alphabet)
+{
+    const __m128i offsets = base64OffsetsSse(alphabet);
+
+    // Each iteration consumes 12 bytes but loads 16, so at least 6 groups
+    // must remain.
+
+    bsl::size_t i = 0;
+    for (; numGroups - i >= 6; i += 4, input += 12, result += 16) {
+        const __m128i in = _mm_loadu_si128(
+                                     reinterpret_cast<const __m128i *>(input));
+
+        _mm_storeu_si128(
+                   reinterpret_cast<__m128i *>(result),
+                   base64CharactersSse(base64IndicesSse(in), offsets));
+    }
+    return i;
+}
+
+/// Return the 6-bit values of the 16 characters in the specified `input`,
+/// translated by chaining lookups of the specified xor-ed `slices` of a
+/// 256-entry decode table, and load the specified `invalid` with a value
+/// having the high bit of a byte set for each character not in the
+/// alphabet.
+inline
+__m128i base64ValuesSse(__m128i *invalid, __m128i input, const __m128i *slices)
+{
+    // Offset characters so that the first populated slice starts at 0.
+    // Characters less than 0x20 (or greater than 0x7f) become negative, and
+    // negative indices yield 0 from '_mm_shuffle_epi8'.
+
+    __m128i x = _mm_subs_epi8(input, _mm_set1_epi8(0x20));
+    const __m128i tooSmall = x;
+
+    // Look up each slice in turn; once an index has passed its slice it
+    // becomes negative and subsequent lookups xor in 0, and for the index's
+    // own slice the pre-xor-ing of adjacent slices cancels out the previous
+    // lookups.
+
+    __m128i values = _mm_shuffle_epi8(slices[0], x);
+    for (int i = 1; i < 6; ++i) {
+        x      = _mm_subs_epi8(x, _mm_set1_epi8(0x10));
+        values = _mm_xor_si128(values, _mm_shuffle_epi8(slices[i], x));
+    }
+    x = _mm_subs_epi8(x, _mm_set1_epi8(0x10));
+
+    // Flag characters below the table, characters whose index is still
+    // non-negative (i.e., above the table), and 0xff table entries.
+
+    *invalid = _mm_or_si128(_mm_or_si128(tooSmall, values),
+                            _mm_andnot_si128(x, _mm_set1_epi8(-1)));
+    return values;
+}
+
+/// Load the specified `slices` with the six 16-byte slices covering the
+/// characters '[0x20 .. 0x7f]' of the specified 256-entry `decodeTable`,
+/// each xor-ed with the slice preceding it.
+inline
+void base64SlicesSse(__m128i *slices, const unsigned char *decodeTable)
+{
+    const __m128i *table = reinterpret_cast<const __m128i *>(decodeTable);
+
+    __m128i previous = _mm_setzero_si128();
+    for (int i = 0; i < 6; ++i) {
+        const __m128i slice = _mm_loadu_si128(table + 2 + i);
+        slices[i] = _mm_xor_si128(slice, previous);
+        previous  = slice;
+    }
+}
+
+/// Return the 12 bytes, in the low bytes of the result, obtained by packing
+/// the specified 16 6-bit `values`.
+inline
+__m128i base64PackSse(__m128i values)
+{
+    // '|00aaaaaa|00bbbbbb|00cccccc|00dddddd|' becomes
+    // '|0000aaaa aabbbbbb|0000cccc ccdddddd|', and then
+    // '|00000000 aaaaaabb bbbbcccc ccdddddd|'; finally, bytes are put in
+    // memory order and the gaps removed.
+
+    values = _mm_maddubs_epi16(values, _mm_set1_epi16(0x0140));
+    values = _mm_madd_epi16(values, _mm_set1_epi32(0x00011000));
+    return _mm_shuffle_epi8(values,
+                            _mm_setr_epi8( 2,  1,  0,  6,  5,  4, 10,  9,
+                                           8, 14, 13, 12, -1, -1, -1, -1));
+}
+
+/// Decode groups of the specified `input` having the specified `numGroups`
+/// four-character groups to the specified `result` using the specified
+/// `decodeTable`, four groups at a time, stopping before the first four
+/// groups that contain an invalid character, and return the number of groups
+/// decoded.
+bsl::size_t decodeBase64Sse(char                *result,
+                            const char          *input,
+                            bsl::size_t          numGroups,
+                            const unsigned char *decodeTable)
+{
+    __m128i slices[6];
+    base64SlicesSse(slices, decodeTable);
+
+    bsl::size_t i = 0;
+    for (; numGroups - i >= 4; i += 4, input += 16, result += 12) {
+        __m128i invalid;
+        const __m128i values = base64ValuesSse(
+                     &invalid,
+                     _mm_loadu_si128(reinterpret_cast<const __m128i *>(input)),
+                     slices);
+
+        if (0 != _mm_movemask_epi8(invalid)) {
+            break;                                                     // BREAK
+        }
+
+        const __m128i bytes = base64PackSse(values);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(result), bytes);
+        const int last = _mm_extract_epi32(bytes, 2);
+        bsl::memcpy(result + 8, &last, 4);
+    }
+    return i;
+}
+
+/// Encode the specified `length` bytes of the specified `input` to the
+/// specified `result` using the specified 16-entry `hexTable`, 16 bytes at
+/// a time, and return the number of bytes encoded.
+bsl::size_t encodeHexSse(char        *result,
+                         const char  *input,
+                         bsl::size_t  length,
+                         const char  *hexTable)
+{
+    const __m128i digits = _mm_loadu_si128(
+                                  reinterpret_cast<const __m128i *>(hexTable));
+    const __m128i mask   = _mm_set1_epi8(0x0f);
+
+    bsl::size_t i = 0;
+    for (; length - i >= 16; i += 16, input += 16, result += 32) {
+        const __m128i in   = _mm_loadu_si128(
+                                     reinterpret_cast<const __m128i *>(input));
+        const __m128i high = _mm_shuffle_epi8(
+                            digits,
+                            _mm_and_si128(_mm_srli_epi16(in, 4), mask));
+        const __m128i low  = _mm_shuffle_epi8(digits, _mm_and_si128(in, mask));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(result),
+                         _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(result + 16),
+                         _mm_unpackhi_epi8(high, low));
+    }
+    return i;
+}
+
+/// Return the 4-bit values of the 16 hexadecimal digits in the specified
+/// `input`, and load the specified `valid` with a value having all bits of a
+/// byte set for each character that is a hexadecimal digit.
+inline
+__m128i hexValuesSse(__m128i *valid, __m128i input)
+{
+    const __m128i digit   = _mm_sub_epi8(input, _mm_set1_epi8('0'));
+    const __m128i isDigit = _mm_cmpeq_epi8(
+                                   _mm_min_epu8(digit, _mm_set1_epi8(9)),
+                                   digit);
+
+    const __m128i letter  = _mm_sub_epi8(
+                                   _mm_or_si128(input, _mm_set1_epi8(0x20)),
+                                   _mm_set1_epi8('a'));
+    const __m128i isAlpha = _mm_cmpeq_epi8(
+                                   _mm_min_epu8(letter, _mm_set1_epi8(5)),
+                                   letter);
+
+    *valid = _mm_or_si128(isDigit, isAlpha);
+
+    return _mm_or_si128(
+             _mm_and_si128(isDigit, digit),
+             _mm_andnot_si128(isDigit,
+                              _mm_add_epi8(letter, _mm_set1_epi8(10))));
+}
+
+/// Decode pairs of hexadecimal digits of the specified `input` having the
+/// specified `numPairs` pairs to the specified `result`, 16 pairs at a time,
+/// stopping before the first 16 pairs that contain an invalid character,
+/// and return the number of pairs decoded.
+bsl::size_t decodeHexSse(char *result, const char *input, bsl::size_t numPairs)
+{
+    const __m128i weights = _mm_set1_epi16(0x0110);
+
+    bsl::size_t i = 0;
+    for (; numPairs - i >= 16; i += 16, input += 32, result += 16) {
+        __m128i valid0;
+        __m128i valid1;
+        const __m128i values0 = hexValuesSse(
+                   &valid0,
+                   _mm_loadu_si128(reinterpret_cast<const __m128i *>(input)));
+        const __m128i values1 = hexValuesSse(
+              &valid1,
+              _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + 16)));
+
+        if (0xffff != _mm_movemask_epi8(_mm_and_si128(valid0, valid1))) {
+            break;                                                     // BREAK
+        }
+
+        // Combine each pair of nibbles as '16 * high + low'.
+
+        _mm_storeu_si128(
+                     reinterpret_cast<__m128i *>(result),
+                     _mm_packus_epi16(_mm_maddubs_epi16(values0, weights),
+                                      _mm_maddubs_epi16(values1, weights)));
+    }
+    return i;
+}
+
+#endif  // BDLDE_BULKCODECUTIL_SSE_ENABLED
+
+#if defined(BDLDE_BULKCODECUTIL_AVX2_ENABLED)
+
+                        // ====================
+                        // AVX2 implementations
+                        // ====================
+
+/// Return the 6-bit indices, one per byte, of the four three-byte groups
+/// held in the low 12 bytes of each 128-bit lane of the specified `input`.
+inline
+__m256i base64IndicesAvx2(__m256i input)
+{
+    const __m128i spread = _mm_set_epi8(10, 11,  9, 10,  7,  8,  6,  7,
+                                         4,  5,  3,  4,  1,  2,  0,  1);
+
+    input = _mm256_shuffle_epi8(input, _mm256_broadcastsi128_si256(spread));
+
+    const __m256i t0 = _mm256_and_si256(input, _mm256_set1_epi32(0x0fc0fc00));
+    const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    const __m256i t2 = _mm256_and_si256(input, _mm256_set1_epi32(0x003f03f0));
+    const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+
+    return _mm256_or_si256(t1, t3);
+}
+
+/// Return the characters corresponding to the specified 6-bit `indices`,
+/// given the specified `offsets` table (see `base64CharactersSse`).
+inline
+__m256i base64CharactersAvx2(__m256i indices, __m256i offsets)
+{
+    __m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+    const __m256i isUpper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+    range = _mm256_or_si256(range,
+                            _mm256_and_si256(isUpper, _mm256_set1_epi8(13)));
+
+    return _mm256_add_epi8(indices, _mm256_shuffle_epi8(offsets, range));
+}
+
+/// Encode groups of the specified `input` having the specified `numGroups`
+/// three-byte groups to the specified `result` using the specified
+/// `alphabet`, eight groups at a time, and return the number of groups
+/// encoded.
+bsl::size_t encodeBase64Avx2(char                        *result,
+                             const char                  *input,
+                             bsl::size_t                  numGroups,
+                             bdlde::Base64Alphabet::Enum  alphabet)
+{
+    const __m256i offsets = _mm256_broadcastsi128_si256(
+                                                   base64OffsetsSse(alphabet));
+
+    // Each iteration consumes 24 bytes, loading 16 bytes at offsets 0 and 12,
+    // so at least 10 groups must remain.
+
+    bsl::size_t i = 0;
+    for (; numGroups - i >= 10; i += 8, input += 24, result += 32) {
+        const __m128i low  = _mm_loadu_si128(
+                                     reinterpret_cast<const __m128i *>(input));
+        const __m128i high = _mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(input + 12));
+        const __m256i in   = _mm256_inserti128_si256(
+                                       _mm256_castsi128_si256(low), high, 1);
+
+        _mm256_storeu_si256(
+                    reinterpret_cast<__m256i *>(result),
+                    base64CharactersAvx2(base64IndicesAvx2(in), offsets));
+    }
+    return i;
+}
+
+/// Decode groups of the specified `input` having the specified `numGroups`
+/// four-character groups to the specified `result` using the specified
+/// `decodeTable`, eight groups at a time, stopping before the first eight
+/// groups that contain an invalid character, and return the number of
+/// groups decoded.
+bsl::size_t decodeBase64Avx2(char                *result,
+                             const char          *input,
+                             bsl::size_t          numGroups,
+                             const unsigned char *decodeTable)
+{
+    __m128i narrowSlices[6];
+    base64SlicesSse(narrowSlices, decodeTable);
+
+    __m256i slices[6];
+    for (int i = 0; i < 6; ++i) {
+        slices[i] = _mm256_broadcastsi128_si256(narrowSlices[i]);
+    }
+
+    const __m256i sixteen = _mm256_set1_epi8(0x10);
+    const __m256i gather  = _mm256_broadcastsi128_si256(
+                               _mm_setr_epi8( 2,  1,  0,  6,  5,  4, 10,  9,
+                                              8, 14, 13, 12, -1, -1, -1, -1));
+
+    bsl::size_t i = 0;
+    for (; numGroups - i >= 8; i += 8, input += 32, result += 24) {
+        __m256i x = _mm256_subs_epi8(
+                  _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input)),
+                  _mm256_set1_epi8(0x20));
+        const __m256i tooSmall = x;
+
+        __m256i values = _mm256_shuffle_epi8(slices[0], x);
+        for (int j = 1; j < 6; ++j) {
+            x      = _mm256_subs_epi8(x, sixteen);
+            values = _mm256_xor_si256(values,
+                                      _mm256_shuffle_epi8(slices[j], x));
+        }
+        x = _mm256_subs_epi8(x, sixteen);
+
+        const __m256i invalid = _mm256_or_si256(
+                                _mm256_or_si256(tooSmall, values),
+                                _mm256_andnot_si256(x, _mm256_set1_epi8(-1)));
+
+        if (0 != _mm256_movemask_epi8(invalid)) {
+            break;                                                     // BREAK
+        }
+
+        values = _mm256_maddubs_epi16(values, _mm256_set1_epi16(0x0140));
+        values = _mm256_madd_epi16(values, _mm256_set1_epi32(0x00011000));
+        values = _mm256_shuffle_epi8(values, gather);
+
+        // Each lane now holds 12 bytes in its low 3 words; bring the 6 words
+        // together.
+
+        values = _mm256_permutevar8x32_epi32(
+                                values,
+                                _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(result),
+                         _mm256_castsi256_si128(values));
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(result + 16),
+                         _mm256_extracti128_si256(values, 1));
+    }
+    return i;
+}
+
+/// Encode the specified `length` bytes of the specified `input` to the
+/// specified `result` using the specified 16-entry `hexTable`, 32 bytes at
+/// a time, and return the number of bytes encoded.
+bsl::size_t encodeHexAvx2(char        *result,
+                          const char  *input,
+                          bsl::size_t  length,
+                          const char  *hexTable)
+{
+    const __m256i digits = _mm256_broadcastsi128_si256(
+                _mm_loadu_si128(reinterpret_cast<const __m128i *>(hexTable)));
+    const __m256i mask   = _mm256_set1_epi8(0x0f);
+
+    bsl::size_t i = 0;
+    for (; length - i >= 32; i += 32, input += 32, result += 64) {
+        const __m256i in   = _mm256_loadu_si256(
+                                     reinterpret_cast<const __m256i *>(input));
+        const __m256i high = _mm256_shuffle_epi8(
+                            digits,
+                            _mm256_and_si256(_mm256_srli_epi16(in, 4), mask));
+        const __m256i low  = _mm256_shuffle_epi8(digits,
+                                                 _mm256_and_si256(in, mask));
+
+        // The unpacks operate within 128-bit lanes, producing the digits of
+        // bytes '[0 .. 7]' and '[16 .. 23]', and '[8 .. 15]' and '[24 .. 31]'.
+
+        const __m256i first  = _mm256_unpacklo_epi8(high, low);
+        const __m256i second = _mm256_unpackhi_epi8(high, low);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(result),
+                            _mm256_permute2x128_si256(first, second, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(result + 32),
+                            _mm256_permute2x128_si256(first, second, 0x31));
+    }
+    return i;
+}
+
+/// Return the 4-bit values of the 32 hexadecimal digits in the specified
+/// `input`, and load the specified `valid` with a value having all bits of a
+/// byte set for each character that is a hexadecimal digit.
+inline
+__m256i hexValuesAvx2(__m256i *valid, __m256i input)
+{
+    const __m256i digit   = _mm256_sub_epi8(input, _mm256_set1_epi8('0'));
+    const __m256i isDigit = _mm256_cmpeq_epi8(
+                                _mm256_min_epu8(digit, _mm256_set1_epi8(9)),
+                                digit);
+
+    const __m256i letter  = _mm256_sub_epi8(
+                                _mm256_or_si256(input, _mm256_set1_epi8(0x20)),
+                                _mm256_set1_epi8('a'));
+    const __m256i isAlpha = _mm256_cmpeq_epi8(
+                                _mm256_min_epu8(letter, _mm256_set1_epi8(5)),
+                                letter);
+
+    *valid = _mm256_or_si256(isDigit, isAlpha);
+
+    return _mm256_or_si256(
+          _mm256_and_si256(isDigit, digit),
+          _mm256_andnot_si256(isDigit,
+                              _mm256_add_epi8(letter, _mm256_set1_epi8(10))));
+}
+
+/// Decode pairs of hexadecimal digits of the specified `input` having the
+/// specified `numPairs` pairs to the specified `result`, 32 pairs at a time,
+/// stopping before the first 32 pairs that contain an invalid character,
+/// and return the number of pairs decoded.
+bsl::size_t decodeHexAvx2(char        *result,
+                          const char  *input,
+                          bsl::size_t  numPairs)
+{
+    const __m256i weights = _mm256_set1_epi16(0x0110);
+
+    bsl::size_t i = 0;
+    for (; numPairs - i >= 32; i += 32, input += 64, result += 32) {
+        __m256i valid0;
+        __m256i valid1;
+        const __m256i *in = reinterpret_cast<const __m256i *>(input);
+        const __m256i  values0 = hexValuesAvx2(&valid0,
+                                               _mm256_loadu_si256(in));
+        const __m256i  values1 = hexValuesAvx2(&valid1,
+                                               _mm256_loadu_si256(in + 1));
+
+        if (-1 != _mm256_movemask_epi8(_mm256_and_si256(valid0, valid1))) {
+            break;                                                     // BREAK
+        }
+
+        // The pack operates within 128-bit lanes, producing bytes
+        // '[0 .. 7]', '[16 .. 23]', '[8 .. 15]', and '[24 .. 31]'.
+
+        const __m256i bytes = _mm256_packus_epi16(
+                                      _mm256_maddubs_epi16(values0, weights),
+                                      _mm256_maddubs_epi16(values1, weights));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(result),
+                            _mm256_permute4x64_epi64(bytes, 0xd8));
+    }
+    return i;
+}
+
+#endif  // BDLDE_BULKCODECUTIL_AVX2_ENABLED
+
+#if defined(BDLDE_BULKCODECUTIL_NEON_ENABLED)
+
+                        // ====================
+                        // NEON implementations
+                        // ====================
+
+/// Return the 64 bytes at the specified `table`.
+inline
+uint8x16x4_t loadTableNeon(const void *table)
+{
+    const uint8_t *bytes = static_cast<const uint8_t *>(table);
+
+    uint8x16x4_t result;
+    result.val[0] = vld1q_u8(bytes);
+    result.val[1] = vld1q_u8(bytes + 16);
+    result.val[2] = vld1q_u8(bytes + 32);
+    result.val[3] = vld1q_u8(bytes + 48);
+    return result;
+}
+
+/// Encode groups of the specified `input` having the specified `numGroups`
+/// three-byte groups to the specified `result` using the specified 64-entry
+/// `encodeTable`, 16 groups at a time, and return the number of groups
+/// encoded.
+bsl::size_t encodeBase64Neon(char                *result,
+                             const unsigned char *input,
+                             bsl::size_t          numGroups,
+                             const char          *encodeTable)
+{
+    const uint8x16x4_t table = loadTableNeon(encodeTable);
+    const uint8x16_t   mask  = vdupq_n_u8(0x3f);
+
+    bsl::size_t i = 0;
+    for (; numGroups - i >= 16; i += 16, input += 48, result += 64) {
+        const uint8x16x3_t in = vld3q_u8(input);
+
+        uint8x16x4_t indices;
+        indices.val[0] = vshrq_n_u8(in.val[0], 2);
+        indices.val[1] = vandq_u8(vorrq_u8(vshrq_n_u8(in.val[1], 4),
+                                           vshlq_n_u8(in.val[0], 4)),
+                                  mask);
+        indices.val[2] = vandq_u8(vorrq_u8(vshrq_n_u8(in.val[2], 6),
+                                           vshlq_n_u8(in.val[1], 2)),
+                                  mask);
+        indices.val[3] = vandq_u8(in.val[2], mask);
+
+        uint8x16x4_t characters;
+        characters.val[0] = vqtbl4q_u8(table, indices.val[0]);
+        characters.val[1] = vqtbl4q_u8(table, indices.val[1]);
+        characters.val[2] = vqtbl4q_u8(table, indices.val[2]);
+        characters.val[3] = vqtbl4q_u8(table, indices.val[3]);
+
+        vst4q_u8(reinterpret_cast<uint8_t *>(result), characters);
+    }
+    return i;
+}
+
+/// Return the 6-bit values of the specified `characters` using the specified
+/// `low` and `high` halves of the first 128 entries of a decode table, with
+/// the high bit set for each character not in the alphabet.
+inline
+uint8x16_t base64ValuesNeon(uint8x16_t          characters,
+                            const uint8x16x4_t& low,
+                            const uint8x16x4_t& high)
+{
+    // Out-of-range indices yield 0 from 'TBL', so at most one of the two
+    // lookups below is non-zero for a character less than 0x80; characters
+    // not less than 0x80 are flagged by or-ing in the character itself.
+
+    const uint8x16_t values = vorrq_u8(
+                     vqtbl4q_u8(low, characters),
+                     vqtbl4q_u8(high, veorq_u8(characters, vdupq_n_u8(0x40))));
+    return vorrq_u8(values, vandq_u8(characters, vdupq_n_u8(0x80)));
+}
+
+/// Decode groups of the specified `input` having the specified `numGroups`
+/// four-character groups to the specified `result` using the specified
+/// `decodeTable`, 16 groups at a time, stopping before the first 16 groups
+/// that contain an invalid character, and return the number of groups
+/// decoded.
+bsl::size_t decodeBase64Neon(char                *result,
+                             const unsigned char *input,
+                             bsl::size_t          numGroups,
+                             const unsigned char *decodeTable)
+{
+    const uint8x16x4_t low  = loadTableNeon(decodeTable);
+    const uint8x16x4_t high = loadTableNeon(decodeTable + 64);
+
+    bsl::size_t i = 0;
+    for (; numGroups - i >= 16; i += 16, input += 64, result += 48) {
+        const uint8x16x4_t in = vld4q_u8(input);
+
+        const uint8x16_t a = base64ValuesNeon(in.val[0], low, high);
+        const uint8x16_t b = base64ValuesNeon(in.val[1], low, high);
+        const uint8x16_t c = base64ValuesNeon(in.val[2], low, high);
+        const uint8x16_t d = base64ValuesNeon(in.val[3], low, high);
+
+        if (vmaxvq_u8(vorrq_u8(vorrq_u8(a, b), vorrq_u8(c, d))) & 0x80) {
+            break;                                                     // BREAK
+        }
+
+        uint8x16x3_t bytes;
+        bytes.val[0] = vorrq_u8(vshlq_n_u8(a, 2), vshrq_n_u8(b, 4));
+        bytes.val[1] = vorrq_u8(vshlq_n_u8(b, 4), vshrq_n_u8(c, 2));
+        bytes.val[2] = vorrq_u8(vshlq_n_u8(c, 6), d);
+
+        vst3q_u8(reinterpret_cast<uint8_t *>(result), bytes);
+    }
+    return i;
+}
+
+/// Encode the specified `length` bytes of the specified `input` to the
+/// specified `result` using the specified 16-entry `hexTable`, 16 bytes at
+/// a time, and return the number of bytes encoded.
+bsl::size_t encodeHexNeon(char                *result,
+                          const unsigned char *input,
+                          bsl::size_t          length,
+                          const char          *hexTable)
+{
+    const uint8x16_t digits = vld1q_u8(
+                              reinterpret_cast<const uint8_t *>(hexTable));
+
+    bsl::size_t i = 0;
+    for (; length - i >= 16; i += 16, input += 16, result += 32) {
+        const uint8x16_t in = vld1q_u8(input);
+
+        uint8x16x2_t characters;
+        characters.val[0] = vqtbl1q_u8(digits, vshrq_n_u8(in, 4));
+        characters.val[1] = vqtbl1q_u8(digits,
+                                       vandq_u8(in, vdupq_n_u8(0x0f)));
+
+        vst2q_u8(reinterpret_cast<uint8_t *>(result), characters);
+    }
+    return i;
+}
+
+/// Return the 4-bit values of the specified hexadecimal `digits`, with the
+/// high bit set for each character that is not a hexadecimal digit.
+inline
+uint8x16_t hexValuesNeon(uint8x16_t digits)
+{
+    const uint8x16_t digit   = vsubq_u8(digits, vdupq_n_u8('0'));
+    const uint8x16_t letter  = vsubq_u8(vorrq_u8(digits, vdupq_n_u8(0x20)),
+                                        vdupq_n_u8('a'));
+    const uint8x16_t isDigit = vcleq_u8(digit, vdupq_n_u8(9));
+    const uint8x16_t isAlpha = vcleq_u8(letter, vdupq_n_u8(5));
+
+    const uint8x16_t values = vbslq_u8(isDigit,
+                                       digit,
+                                       vaddq_u8(letter, vdupq_n_u8(10)));
+
+    return vorrq_u8(values,
+                    vbicq_u8(vdupq_n_u8(0x80), vorrq_u8(isDigit, isAlpha)));
+}
+
+/// Decode pairs of hexadecimal digits of the specified `input` having the
+/// specified `numPairs` pairs to the specified `result`, 16 pairs at a time,
+/// stopping before the first 16 pairs that contain an invalid character,
+/// and return the number of pairs decoded.
+bsl::size_t decodeHexNeon(char                *result,
+                          const unsigned char *input,
+                          bsl::size_t          numPairs)
+{
+    bsl::size_t i = 0;
+    for (; numPairs - i >= 16; i += 16, input += 32, result += 16) {
+        const uint8x16x2_t in = vld2q_u8(input);
+
+        const uint8x16_t high = hexValuesNeon(in.val[0]);
+        const uint8x16_t low  = hexValuesNeon(in.val[1]);
+
+        if (vmaxvq_u8(vorrq_u8(high, low)) & 0x80) {
+            break;                                                     // BREAK
+        }
+
+        vst1q_u8(reinterpret_cast<uint8_t *>(result),
+                 vorrq_u8(vshlq_n_u8(high, 4), low));
+    }
+    return i;
+}
+
+#endif  // BDLDE_BULKCODECUTIL_NEON_ENABLED
+
+}  // close namespace u
+}  // close unnamed namespace
+
+namespace bdlde {
+
+                            // --------------------
+                            // struct BulkCodecUtil
+                            // --------------------
+
+// CLASS METHODS
+bsl::size_t BulkCodecUtil::decodeBase64(char                 *result,
+                                        const char           *input,
+                                        bsl::size_t           length,
+                                        Base64Alphabet::Enum  alphabet)
+{
+    BSLS_ASSERT(result || 4 > length);
+    BSLS_ASSERT(input  || 0 == length);
+
+    const unsigned char *decodeTable = Base64Alphabet::e_BASIC == alphabet
+                                     ? u::basicDecodeTable
+                                     : u::urlDecodeTable;
+
+    const bsl::size_t numGroups = length / 4;
+    bsl::size_t       done      = 0;
+
+#if defined(BDLDE_BULKCODECUTIL_AVX2_ENABLED)
+    done += u::decodeBase64Avx2(result, input, numGroups, decodeTable);
+#endif
+#if defined(BDLDE_BULKCODECUTIL_SSE_ENABLED)
+    done += u::decodeBase64Sse(result + 3 * done,
+                               input  + 4 * done,
+                               numGroups - done,
+                               decodeTable);
+#endif
+#if defined(BDLDE_BULKCODECUTIL_NEON_ENABLED)
+    done += u::decodeBase64Neon(
+                    result + 3 * done,
+                    reinterpret_cast<const unsigned char *>(input + 4 * done),
+                    numGroups - done,
+                    decodeTable);
+#endif
+
+    done += u::decodeBase64Portable(
+                    result + 3 * done,
+                    reinterpret_cast<const unsigned char *>(input + 4 * done),
+                    numGroups - done,
+                    decodeTable);
+
+    return 4 * done;
+}
+
+bsl::size_t BulkCodecUtil::decodeHex(char        *result,
+                                     const char  *input,
+                                     bsl::size_t  length)
+{
+    BSLS_ASSERT(result || 2 > length);
+    BSLS_ASSERT(input  || 0 == length);
+
+    const bsl::size_t numPairs = length / 2;
+    bsl::size_t       done     = 0;
+
+#if defined(BDLDE_BULKCODECUTIL_AVX2_ENABLED)
+    done += u::decodeHexAvx2(result, input, numPairs);
+#endif
+#if defined(BDLDE_BULKCODECUTIL_SSE_ENABLED)
+    done += u::decodeHexSse(result + done, input + 2 * done, numPairs - done);
+#endif
+#if defined(BDLDE_BULKCODECUTIL_NEON_ENABLED)
+    done += u::decodeHexNeon(
+                    result + done,
+                    reinterpret_cast<const unsigned char *>(input + 2 * done),
+                    numPairs - done);
+#endif
+
+    done += u::decodeHexPortable(
+                    result + done,
+                    reinterpret_cast<const unsigned char *>(input + 2 * done),
+                    numPairs - done);
+
+    return 2 * done;
+}
+
+void BulkCodecUtil::encodeBase64(char                 *result,
+                                 const char           *input,
+                                 bsl::size_t           length,
+                                 Base64Alphabet::Enum  alphabet)
+{
+    BSLS_ASSERT(0 == length % 3);
+    BSLS_ASSERT(result || 0 == length);
+    BSLS_ASSERT(input  || 0 == length);
+
+    const bsl::size_t numGroups = length / 3;
+    bsl::size_t       done      = 0;
+
+#if defined(BDLDE_BULKCODECUTIL_AVX2_ENABLED)
+    done += u::encodeBase64Avx2(result, input, numGroups, alphabet);
+#endif
+#if defined(BDLDE_BULKCODECUTIL_SSE_ENABLED)
+    done += u::encodeBase64Sse(result + 4 * done,
+                               input  + 3 * done,
+                               numGroups - done,
+                               alphabet);
+#endif
+
+    const char *encodeTable = Base64Alphabet::e_BASIC == alphabet
+                            ? u::basicEncodeTable
+                            : u::urlEncodeTable;
+
+#if defined(BDLDE_BULKCODECUTIL_NEON_ENABLED)
+    done += u::encodeBase64Neon(
+                    result + 4 * done,
+                    reinterpret_cast<const unsigned char *>(input + 3 * done),
+                    numGroups - done,
+                    encodeTable);
+#endif
+
+    u::encodeBase64Portable(
+                    result + 4 * done,
+                    reinterpret_cast<const unsigned char *>(input + 3 * done),
+                    numGroups - done,
+                    encodeTable);
+}
+
+void BulkCodecUtil::encodeHex(char        *result,
+                              const char  *input,
+                              bsl::size_t  length,
+                              bool         upperCase)
+{
+    BSLS_ASSERT(result || 0 == length);
+    BSLS_ASSERT(input  || 0 == length);
+
+    const char *hexTable = upperCase ? u::upperHexTable : u::lowerHexTable;
+
+    bsl::size_t done = 0;
+
+#if defined(BDLDE_BULKCODECUTIL_AVX2_ENABLED)
+    done += u::encodeHexAvx2(result, input, length, hexTable);
+#endif
+#if defined(BDLDE_BULKCODECUTIL_SSE_ENABLED)
+    done += u::encodeHexSse(result + 2 * done,
+                            input  + done,
+                            length - done,
+                            hexTable);
+#endif
+#if defined(BDLDE_BULKCODECUTIL_NEON_ENABLED)
+    done += u::encodeHexNeon(
+                        result + 2 * done,
+                        reinterpret_cast<const unsigned char *>(input + done),
+                        length - done,
+                        hexTable);
+#endif
+
+    u::encodeHexPortable(
+                        result + 2 * done,
+                        reinterpret_cast<const unsigned char *>(input + done),
+                        length - done,
+                        hexTable);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
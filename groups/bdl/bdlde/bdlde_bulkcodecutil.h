@@ -0,0 +1,181 @@
+// bdlde_bulkcodecutil.h                                              -*-C++-*-
+#ifndef INCLUDED_BDLDE_BULKCODECUTIL
+#define INCLUDED_BDLDE_BULKCODECUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$")
+
+//@PURPOSE: Provide vectorized bulk Base64 and hexadecimal conversions.
+//
+//@CLASSES:
+//  bdlde::BulkCodecUtil: namespace for bulk Base64 and hex conversions
+//
+//@SEE_ALSO: bdlde_base64encoder, bdlde_base64decoder, bdlde_hexencoder,
+//           bdlde_hexdecoder
+//
+//@DESCRIPTION: This component provides a `struct`, `bdlde::BulkCodecUtil`,
+// that provides a namespace for functions converting contiguous buffers of
+// data to and from their Base64 (see RFC 4648) and hexadecimal
+// representations.  These functions operate only on *complete* groups of
+// input -- three bytes (or four characters) for Base64, and one byte (or two
+// characters) for hexadecimal -- and do not deal with padding, line breaks,
+// whitespace, or error reporting.  The incremental state machines
+// `bdlde::Base64Encoder`, `bdlde::Base64Decoder`, `bdlde::HexEncoder`, and
+// `bdlde::HexDecoder` use these functions to convert runs of complete groups,
+// and handle everything else themselves; clients needing any of those
+// features should use those components instead.
+//
+// The decoding functions convert the longest prefix of their input made up of
+// complete groups of valid characters, and return the number of input
+// characters so converted.  This allows a caller to hand off the remainder of
+// its input (which starts with a padding character, a line break, an invalid
+// character, or an incomplete group) to slower, more general, code.
+//
+///Hardware Acceleration
+///---------------------
+// The conversions are vectorized at compile time when building for a
+// supported architecture:
+// * x86: SSE4.1 is used to convert 16 (Base64) or 32 (hexadecimal) characters
+//   at a time, and AVX2, when enabled (e.g., `-mavx2`), to convert twice as
+//   many
+// * ARM: NEON, when enabled by defining `BDLDE_BULKCODECUTIL_ENABLE_NEON`, is
+//   used on 64-bit little-endian targets to convert 64 (Base64) or 32
+//   (hexadecimal) characters at a time; it is not enabled by default because
+//   it has not yet been built and tested on ARM hardware
+//
+// Other platforms, and the tail of each input, use portable table-driven
+// implementations.  All implementations produce identical results.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Round-Tripping a Buffer Through Base64
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a buffer whose length is a multiple of three, and we wish to
+// obtain its Base64 encoding, and then decode it back.
+//
+// First, we prepare the input and an output buffer of the appropriate size:
+// ```
+// const char        input[] = "Hello, bulk Base64 world!!!";
+// const bsl::size_t length  = sizeof input - 1;
+// assert(0 == length % 3);
+//
+// char encoded[length / 3 * 4];
+// ```
+// Then, we encode the buffer using the basic Base64 alphabet:
+// ```
+// bdlde::BulkCodecUtil::encodeBase64(encoded,
+//                                    input,
+//                                    length,
+//                                    bdlde::Base64Alphabet::e_BASIC);
+// assert(0 == bsl::memcmp(encoded, "SGVsbG8sIGJ1bGsgQmFzZTY0IHdvcmxkISEh",
+//                         sizeof encoded));
+// ```
+// Next, we decode the result, and verify that the entire encoded buffer was
+// consumed and that the original input was recovered:
+// ```
+// char decoded[length];
+//
+// const bsl::size_t numConsumed =
+//     bdlde::BulkCodecUtil::decodeBase64(decoded,
+//                                        encoded,
+//                                        sizeof encoded,
+//                                        bdlde::Base64Alphabet::e_BASIC);
+// assert(sizeof encoded == numConsumed);
+// assert(0 == bsl::memcmp(decoded, input, length));
+// ```
+// Finally, we observe that decoding stops at the first group that contains a
+// character outside of the alphabet, such as the `=` padding character:
+// ```
+// assert(4 == bdlde::BulkCodecUtil::decodeBase64(
+//                                            decoded,
+//                                            "SGVsbG8=",
+//                                            8,
+//                                            bdlde::Base64Alphabet::e_BASIC));
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdlde_base64alphabet.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace bdlde {
+
+                            // ====================
+                            // struct BulkCodecUtil
+                            // ====================
+
+/// This `struct` provides a namespace for functions converting contiguous
+/// buffers of complete groups to and from Base64 and hexadecimal.
+struct BulkCodecUtil {
+
+    // CLASS METHODS
+
+    /// Decode the longest prefix of the specified `input` having the
+    /// specified `length` that consists of complete four-character groups
+    /// of characters from the specified `alphabet`, write the resulting
+    /// bytes to the specified `result`, and return the number of characters
+    /// of `input` so decoded.  The returned value is a multiple of 4, and
+    /// three bytes are written to `result` for each group decoded.  Note
+    /// that decoding stops at the first group containing a character not in
+    /// `alphabet` (including padding and whitespace), and at any incomplete
+    /// group at the end of `input`.
+    static bsl::size_t decodeBase64(char                 *result,
+                                    const char           *input,
+                                    bsl::size_t           length,
+                                    Base64Alphabet::Enum  alphabet);
+
+    /// Decode the longest prefix of the specified `input` having the
+    /// specified `length` that consists of complete pairs of hexadecimal
+    /// digits (in either case), write the resulting bytes to the specified
+    /// `result`, and return the number of characters of `input` so decoded.
+    /// The returned value is a multiple of 2, and one byte is written to
+    /// `result` for each pair decoded.
+    static bsl::size_t decodeHex(char        *result,
+                                 const char  *input,
+                                 bsl::size_t  length);
+
+    /// Write the Base64 encoding of the specified `input` having the
+    /// specified `length`, using the specified `alphabet`, to the specified
+    /// `result`.  Exactly `length / 3 * 4` characters are written.  No
+    /// padding or line breaks are emitted.  The behavior is undefined unless
+    /// `length` is a multiple of 3.
+    static void encodeBase64(char                 *result,
+                             const char           *input,
+                             bsl::size_t           length,
+                             Base64Alphabet::Enum  alphabet);
+
+    /// Write the hexadecimal encoding of the specified `input` having the
+    /// specified `length` to the specified `result`, using uppercase letters
+    /// if the specified `upperCase` is `true`, and lowercase letters
+    /// otherwise.  Exactly `2 * length` characters are written, the more
+    /// significant digit of each byte first.
+    static void encodeHex(char        *result,
+                          const char  *input,
+                          bsl::size_t  length,
+                          bool         upperCase);
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1025 @@
+// bdlde_bulkcodecutil.t.cpp                                          -*-C++-*-
+#include <bdlde_bulkcodecutil.h>
+
+#include <bdlde_base64decoder.h>        // for testing only
+#include <bdlde_base64encoder.h>        // for testing only
+#include <bdlde_hexdecoder.h>           // for testing only
+#include <bdlde_hexencoder.h>           // for testing only
+
+#include <bslim_testutil.h>
+
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_list.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a utility of four pure functions, each of which
+// dispatches to a chain of vectorized kernels of decreasing width followed by
+// a portable implementation.  Every function is tested against a simple
+// reference implementation defined in this test driver, over inputs whose
+// lengths and alignments are chosen so that every kernel, and every hand-off
+// between kernels, is exercised.  The decoding functions are additionally
+// tested with an invalid character placed at every position of the input, to
+// verify that decoding stops exactly at the group containing it regardless of
+// which kernel encounters it.  Finally, the streaming codecs that use this
+// component are tested to convert contiguous input, which they hand to this
+// component, exactly as they convert the same input supplied through
+// non-contiguous iterators, which they process a byte at a time.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] size_t decodeBase64(char *, const char *, size_t, Alphabet);
+// [ 5] size_t decodeHex(char *, const char *, size_t);
+// [ 2] void encodeBase64(char *, const char *, size_t, Alphabet);
+// [ 4] void encodeHex(char *, const char *, size_t, bool);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] CONCERN: codecs convert contiguous input as non-contiguous input.
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlde::BulkCodecUtil  Util;
+typedef bdlde::Base64Alphabet Alphabet;
+
+// Lengths (in groups) exercising every kernel and the hand-offs between them.
+
+const bsl::size_t k_MAX_GROUPS = 80;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// Return the alphabet of 64 characters for the specified `alphabet`.
+const char *alphabetChars(Alphabet::Enum alphabet)
+{
+    return Alphabet::e_BASIC == alphabet
+         ? "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"
+         : "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+}
+
+/// Return the Base64 encoding, using the specified `alphabet`, of the
+/// specified `length` bytes at the specified `input`, computed one bit at a
+/// time.  The behavior is undefined unless `length` is a multiple of 3.
+bsl::string referenceBase64(const char     *input,
+                            bsl::size_t     length,
+                            Alphabet::Enum  alphabet)
+{
+    const char *chars = alphabetChars(alphabet);
+
+    bsl::string result;
+    for (bsl::size_t bit = 0; bit < 8 * length; bit += 6) {
+        int index = 0;
+        for (bsl::size_t i = bit; i < bit + 6; ++i) {
+            const unsigned char byte = static_cast<unsigned char>(
+                                                                input[i / 8]);
+            index = (index << 1) | ((byte >> (7 - i % 8)) & 1);
+        }
+        result.push_back(chars[index]);
+    }
+    return result;
+}
+
+/// Return the hexadecimal encoding of the specified `length` bytes at the
+/// specified `input`, using uppercase letters if the specified `upperCase`
+/// is `true`.
+bsl::string referenceHex(const char *input, bsl::size_t length, bool upperCase)
+{
+    const char *digits = upperCase ? "0123456789ABCDEF" : "0123456789abcdef";
+
+    bsl::string result;
+    for (bsl::size_t i = 0; i < length; ++i) {
+        const unsigned char byte = static_cast<unsigned char>(input[i]);
+        result.push_back(digits[byte >> 4]);
+        result.push_back(digits[byte & 0x0f]);
+    }
+    return result;
+}
+
+/// Load into the specified `buffer` the specified `length` pseudo-random
+/// bytes generated from the specified `seed`.
+void fillRandom(char *buffer, bsl::size_t length, unsigned int seed)
+{
+    for (bsl::size_t i = 0; i < length; ++i) {
+        seed = seed * 1103515245 + 12345;
+        buffer[i] = static_cast<char>(seed >> 16);
+    }
+}
+
+/// Call `endConvert` on the specified `codec` until no output remains,
+/// writing to the specified `out` and passing the specified `maxNumOut` to
+/// each call, and append the status and `numOut` results of each call to
+/// the specified `trace`.
+template <class CODEC>
+void endConvertInChunks(bsl::vector<int> *trace,
+                        CODEC            *codec,
+                        char             *out,
+                        int               maxNumOut)
+{
+    int rc;
+    int numOut;
+    do {
+        numOut = -1;
+
+        rc = codec->endConvert(out, &numOut, maxNumOut);
+        trace->push_back(rc);
+        trace->push_back(numOut);
+
+        out += numOut;
+    } while (0 < rc && 0 < numOut);
+}
+
+/// Call `endConvert` on the specified `codec`, and append its status to the
+/// specified `trace`.  Note that `HexDecoder::endConvert` produces no
+/// output.
+void endConvertInChunks(bsl::vector<int>  *trace,
+                        bdlde::HexDecoder *codec,
+                        char              *,
+                        int                )
+{
+    trace->push_back(codec->endConvert());
+}
+
+/// Convert the sequence `[begin, end)` using the specified `codec` by
+/// calling `convert` until all input is consumed, writing to the specified
+/// `out` and passing the specified `maxNumOut` to each call, and then
+/// terminate the conversion.  Append the status, `numOut`, and `numIn`
+/// results of each call to `convert`, followed by those of
+/// `endConvertInChunks`, to the specified `trace`.  Stop after the first
+/// call returning a negative status.
+template <class CODEC, class INPUT_ITERATOR>
+void convertInChunks(bsl::vector<int> *trace,
+                     CODEC            *codec,
+                     char             *out,
+                     INPUT_ITERATOR    begin,
+                     INPUT_ITERATOR    end,
+                     int               maxNumOut)
+{
+    while (begin != end) {
+        int numOut = -1;
+        int numIn  = -1;
+
+        const int rc = codec->convert(out,
+                                      &numOut,
+                                      &numIn,
+                                      begin,
+                                      end,
+                                      maxNumOut);
+        trace->push_back(rc);
+        trace->push_back(numOut);
+        trace->push_back(numIn);
+        if (rc < 0 || (0 == numOut && 0 == numIn)) {
+            return;                                                   // RETURN
+        }
+
+        out += numOut;
+        bsl::advance(begin, numIn);
+    }
+
+    endConvertInChunks(trace, codec, out, maxNumOut);
+}
+
+/// Convert the specified `input` using the specified `listCodec`, supplying
+/// it as a range of `bsl::list<char>` iterators, and using the specified
+/// `pointerCodec`, supplying it as a range of `const char *`, by calls to
+/// `convertInChunks` passing the specified `maxNumOut`, and verify that the
+/// outputs and the sequences of results are identical.  Use the specified
+/// `line` to identify failures.  The behavior is undefined unless both
+/// codecs are in their initial state.
+template <class CODEC>
+void verifyNonContiguousInput(int                line,
+                              CODEC             *listCodec,
+                              CODEC             *pointerCodec,
+                              const bsl::string&  input,
+                              int                maxNumOut)
+{
+    bsl::list<char> inputList;
+    for (bsl::size_t i = 0; i < input.length(); ++i) {
+        inputList.push_back(input[i]);
+    }
+
+    // Neither codec writes more than three characters per input character,
+    // plus the end of a line and a final group.
+
+    const bsl::size_t maxLength = 3 * input.length() + 8;
+
+    bsl::vector<int>  expTrace;
+    bsl::vector<char> expected(maxLength, '?');
+    convertInChunks(&expTrace,
+                    listCodec,
+                    &expected[0],
+                    inputList.begin(),
+                    inputList.end(),
+                    maxNumOut);
+
+    bsl::vector<int>  trace;
+    bsl::vector<char> result(maxLength, '?');
+    convertInChunks(&trace,
+                    pointerCodec,
+                    &result[0],
+                    input.data(),
+                    input.data() + input.length(),
+                    maxNumOut);
+
+    ASSERTV(line, maxNumOut, expTrace == trace);
+    ASSERTV(line, maxNumOut, expected == result);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Round-Tripping a Buffer Through Base64
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a buffer whose length is a multiple of three, and we wish to
+// obtain its Base64 encoding, and then decode it back.
+//
+// First, we prepare the input and an output buffer of the appropriate size:
+// ```
+    const char        input[] = "Hello, bulk Base64 world!!!";
+    const bsl::size_t length  = sizeof input - 1;
+    ASSERT(0 == length % 3);
+
+    char encoded[length / 3 * 4];
+// ```
+// Then, we encode the buffer using the basic Base64 alphabet:
+// ```
+    bdlde::BulkCodecUtil::encodeBase64(encoded,
+                                       input,
+                                       length,
+                                       bdlde::Base64Alphabet::e_BASIC);
+    ASSERT(0 == bsl::memcmp(encoded, "SGVsbG8sIGJ1bGsgQmFzZTY0IHdvcmxkISEh",
+                            sizeof encoded));
+// ```
+// Next, we decode the result, and verify that the entire encoded buffer was
+// consumed and that the original input was recovered:
+// ```
+    char decoded[length];
+
+    const bsl::size_t numConsumed =
+        bdlde::BulkCodecUtil::decodeBase64(decoded,
+                                           encoded,
+                                           sizeof encoded,
+                                           bdlde::Base64Alphabet::e_BASIC);
+    ASSERT(sizeof encoded == numConsumed);
+    ASSERT(0 == bsl::memcmp(decoded, input, length));
+// ```
+// Finally, we observe that decoding stops at the first group that contains a
+// character outside of the alphabet, such as the `=` padding character:
+// ```
+    ASSERT(4 == bdlde::BulkCodecUtil::decodeBase64(
+                                              decoded,
+                                              "SGVsbG8=",
+                                              8,
+                                              bdlde::Base64Alphabet::e_BASIC));
+// ```
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCERN: CODECS CONVERT CONTIGUOUS AS NON-CONTIGUOUS INPUT
+        //   `Base64Encoder`, `Base64Decoder`, `HexEncoder`, and `HexDecoder`
+        //   hand runs of complete groups in input supplied as a range of
+        //   `char` pointers to this component, and convert all other input a
+        //   byte at a time.
+        //
+        // Concerns:
+        // 1. Each codec yields the same output, and the same sequence of
+        //    status, `numOut`, and `numIn` values, for contiguous input as for
+        //    the same input supplied through non-contiguous iterators.
+        //
+        // 2. The same holds for input long enough to be converted by every
+        //    kernel, for input containing line breaks, whitespace, invalid
+        //    characters, or an incomplete final group, and for a `maxNumOut`
+        //    limit falling anywhere within a group.
+        //
+        // Plan:
+        // 1. For each of a table of inputs, repeated to a variety of lengths,
+        //    and for each `maxNumOut` from a table, convert the input with
+        //    each codec under a variety of options by a sequence of calls to
+        //    `convert` followed by `endConvert`, supplying it both as a range
+        //    of `const char *` and as a range of `bsl::list<char>` iterators.
+        //    Verify that the outputs and the sequences of results are
+        //    identical.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: codecs convert contiguous input as non-contiguous input.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: CODECS CONVERT CONTIGUOUS AS "
+                             "NON-CONTIGUOUS INPUT" << endl
+                          << "======================================"
+                             "====================" << endl;
+
+        typedef bdlde::Base64EncoderOptions EncoderOptions;
+        typedef bdlde::Base64DecoderOptions DecoderOptions;
+        typedef bdlde::Base64IgnoreMode     Ignore;
+
+        static const struct {
+            int         d_line;
+            const char *d_plain;   // input to the encoders
+            const char *d_base64;  // input to `Base64Decoder`
+            const char *d_hex;     // input to `HexDecoder`
+            int         d_repeat;  // number of repetitions of each input
+        } DATA[] = {
+            //LINE PLAIN    BASE64          HEX          REPEAT
+            //---- -------  --------------  -----------  ------
+            { L_,  "",      "",             "",               1 },
+            { L_,  "a",     "YQ==",         "6",              1 },
+            { L_,  "ab",    "YWI=",         "6162",           1 },
+            { L_,  "abc",   "YWJj",         "616",            2 },
+            { L_,  "abc",   "YWJj",         "616263",        64 },
+            { L_,  "abcd",  "YWJj\r\nZA",   "61 62\n6",      64 },
+            { L_,  "abcde", "YWJjZG Vm",    "6162636g",      33 },
+            { L_,  "?!",    "YW*J",         "4a4B4c4D",     100 },
+            { L_,  "xyz",   "eHl6eHl6\t",   "7a7A",         301 },
+        };
+        enum { k_NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        static const int MAX_NUM_OUTS[] = { -1, 1, 2, 3, 5, 64, 1000 };
+        enum { k_NUM_MAX_NUM_OUTS = sizeof  MAX_NUM_OUTS
+                                  / sizeof *MAX_NUM_OUTS };
+
+        for (int ti = 0; ti < k_NUM_DATA; ++ti) {
+            const int LINE   = DATA[ti].d_line;
+            const int REPEAT = DATA[ti].d_repeat;
+
+            bsl::string plain, base64, hex;
+            for (int ri = 0; ri < REPEAT; ++ri) {
+                plain  += DATA[ti].d_plain;
+                base64 += DATA[ti].d_base64;
+                hex    += DATA[ti].d_hex;
+            }
+
+            for (int mi = 0; mi < k_NUM_MAX_NUM_OUTS; ++mi) {
+                const int MAX_NUM_OUT = MAX_NUM_OUTS[mi];
+
+                if (veryVerbose) { T_ P_(LINE) P_(REPEAT) P(MAX_NUM_OUT) }
+
+                for (int oi = 0; oi < 3; ++oi) {
+                    const EncoderOptions OPTIONS =
+                                   0 == oi ? EncoderOptions::mime()
+                                 : 1 == oi ? EncoderOptions::standard(false)
+                                 : EncoderOptions::custom(
+                                                      7,
+                                                      Alphabet::e_URL,
+                                                      true);
+
+                    bdlde::Base64Encoder mL(OPTIONS);
+                    bdlde::Base64Encoder mP(OPTIONS);
+                    verifyNonContiguousInput(LINE,
+                                             &mL,
+                                             &mP,
+                                             plain,
+                                             MAX_NUM_OUT);
+                }
+
+                for (int oi = 0; oi < 3; ++oi) {
+                    const DecoderOptions OPTIONS =
+                      0 == oi ? DecoderOptions::mime()
+                    : 1 == oi ? DecoderOptions::standard()
+                    : DecoderOptions::standard(Ignore::e_IGNORE_UNRECOGNIZED,
+                                               false);
+
+                    bdlde::Base64Decoder mL(OPTIONS);
+                    bdlde::Base64Decoder mP(OPTIONS);
+                    verifyNonContiguousInput(LINE,
+                                             &mL,
+                                             &mP,
+                                             base64,
+                                             MAX_NUM_OUT);
+                }
+
+                for (int ui = 0; ui < 2; ++ui) {
+                    const bool UPPER_CASE = ui;
+
+                    bdlde::HexEncoder mL(UPPER_CASE);
+                    bdlde::HexEncoder mP(UPPER_CASE);
+                    verifyNonContiguousInput(LINE,
+                                             &mL,
+                                             &mP,
+                                             plain,
+                                             MAX_NUM_OUT);
+                }
+
+                {
+                    bdlde::HexDecoder mL;
+                    bdlde::HexDecoder mP;
+                    verifyNonContiguousInput(LINE,
+                                             &mL,
+                                             &mP,
+                                             hex,
+                                             MAX_NUM_OUT);
+                }
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING `decodeHex`
+        //
+        // Concerns:
+        // 1. Pairs of hexadecimal digits, in either case, are decoded to the
+        //    bytes they represent.
+        //
+        // 2. Decoding stops at the first pair containing a character that is
+        //    not a hexadecimal digit, whatever the position of that pair, and
+        //    the number of characters decoded is returned.
+        //
+        // 3. A trailing unpaired digit is not decoded.
+        //
+        // 4. No byte of `result` is written beyond those decoded.
+        //
+        // Plan:
+        // 1. For every length up to a limit, and several input offsets,
+        //    encode pseudo-random bytes with the reference implementation
+        //    (alternating cases), decode them, and compare.  Also decode
+        //    with one character appended.  (C-1, 3)
+        //
+        // 2. For every position of a long encoded input, replace the
+        //    character at that position by each of several characters that
+        //    are not hexadecimal digits, and verify the returned length and
+        //    the decoded prefix.  (C-2, 4)
+        //
+        // Testing:
+        //   size_t decodeHex(char *, const char *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `decodeHex`" << endl
+                          << "===================" << endl;
+
+        const bsl::size_t k_MAX_LENGTH = 160;
+
+        char bytes[k_MAX_LENGTH];
+        fillRandom(bytes, sizeof bytes, 5);
+
+        if (verbose) cout << "\nValid input." << endl;
+        for (bsl::size_t length = 0; length <= k_MAX_LENGTH; ++length) {
+            for (bsl::size_t offset = 0; offset < 8; ++offset) {
+                bsl::string text(offset, 'x');
+                text += referenceHex(bytes, length, length % 2);
+                text += "A";
+
+                bsl::vector<char> result(length + 2, '\x5a');
+
+                ASSERTV(length, offset, 2 * length == Util::decodeHex(
+                                                   result.data(),
+                                                   text.data() + offset,
+                                                   2 * length));
+                ASSERTV(length, offset,
+                        0 == bsl::memcmp(result.data(), bytes, length));
+                ASSERTV(length, offset, '\x5a' == result[length]);
+
+                ASSERTV(length, offset, 2 * length == Util::decodeHex(
+                                                   result.data(),
+                                                   text.data() + offset,
+                                                   2 * length + 1));
+            }
+        }
+
+        if (verbose) cout << "\nInvalid characters." << endl;
+        {
+            static const char k_INVALID[] = { ' ', '/', ':', '@', 'G', '`',
+                                              'g', '\0', '\x80', '\xb0' };
+
+            const bsl::string valid = referenceHex(bytes, k_MAX_LENGTH, true);
+
+            for (bsl::size_t pos = 0; pos < valid.length(); ++pos) {
+                for (bsl::size_t i = 0; i < sizeof k_INVALID; ++i) {
+                    bsl::string text(valid);
+                    text[pos] = k_INVALID[i];
+
+                    bsl::vector<char> result(k_MAX_LENGTH, '\x5a');
+
+                    const bsl::size_t EXP = pos / 2 * 2;
+
+                    ASSERTV(pos, i, EXP == Util::decodeHex(result.data(),
+                                                           text.data(),
+                                                           text.length()));
+                    ASSERTV(pos, i,
+                            0 == bsl::memcmp(result.data(), bytes, EXP / 2));
+                    ASSERTV(pos, i, '\x5a' == result[EXP / 2]);
+                }
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING `encodeHex`
+        //
+        // Concerns:
+        // 1. Each byte is encoded as two hexadecimal digits, the more
+        //    significant first, in the requested case.
+        //
+        // 2. Exactly `2 * length` characters are written.
+        //
+        // 3. Every byte value is encoded correctly.
+        //
+        // Plan:
+        // 1. For every length up to a limit, and several input offsets,
+        //    encode pseudo-random bytes in both cases into a buffer filled
+        //    with a sentinel, and compare with the reference implementation.
+        //    (C-1, 2)
+        //
+        // 2. Encode all 256 byte values in a single call.  (C-3)
+        //
+        // Testing:
+        //   void encodeHex(char *, const char *, size_t, bool);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `encodeHex`" << endl
+                          << "===================" << endl;
+
+        const bsl::size_t k_MAX_LENGTH = 160;
+
+        char bytes[k_MAX_LENGTH + 8];
+        fillRandom(bytes, sizeof bytes, 4);
+
+        for (int upper = 0; upper < 2; ++upper) {
+            for (bsl::size_t length = 0; length <= k_MAX_LENGTH; ++length) {
+                for (bsl::size_t offset = 0; offset < 8; ++offset) {
+                    const char *INPUT = bytes + offset;
+
+                    bsl::vector<char> result(2 * length + 1, '\x5a');
+
+                    Util::encodeHex(result.data(), INPUT, length, upper);
+
+                    const bsl::string EXP = referenceHex(INPUT,
+                                                         length,
+                                                         upper);
+
+                    ASSERTV(upper, length, offset,
+                            EXP == bsl::string(result.data(), 2 * length));
+                    ASSERTV(upper, length, offset,
+                            '\x5a' == result[2 * length]);
+                }
+            }
+        }
+
+        char allBytes[256];
+        for (int i = 0; i < 256; ++i) {
+            allBytes[i] = static_cast<char>(i);
+        }
+
+        for (int upper = 0; upper < 2; ++upper) {
+            char result[512];
+            Util::encodeHex(result, allBytes, sizeof allBytes, upper);
+
+            ASSERTV(upper, referenceHex(allBytes, sizeof allBytes, upper) ==
+                                          bsl::string(result, sizeof result));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING `decodeBase64`
+        //
+        // Concerns:
+        // 1. Complete groups of characters of either alphabet are decoded to
+        //    the bytes they represent.
+        //
+        // 2. Decoding stops at the first group containing a character that is
+        //    not in the alphabet, whatever the position of that group, and the
+        //    number of characters decoded is returned.
+        //
+        // 3. Characters of the other alphabet, padding, whitespace, and
+        //    non-ASCII characters are all treated as invalid.
+        //
+        // 4. A trailing incomplete group is not decoded.
+        //
+        // 5. No byte of `result` is written beyond those decoded.
+        //
+        // Plan:
+        // 1. For every number of groups up to a limit, several input
+        //    offsets, and both alphabets, encode pseudo-random bytes with
+        //    the reference implementation, decode them, and compare.  Also
+        //    decode with one to three characters appended.  (C-1, 4)
+        //
+        // 2. For every position of a long encoded input, and both alphabets,
+        //    replace the character at that position by each of several
+        //    characters that are not in the alphabet, and verify the returned
+        //    length and the decoded prefix.  (C-2, 3, 5)
+        //
+        // Testing:
+        //   size_t decodeBase64(char *, const char *, size_t, Alphabet);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `decodeBase64`" << endl
+                          << "======================" << endl;
+
+        char bytes[3 * k_MAX_GROUPS];
+        fillRandom(bytes, sizeof bytes, 3);
+
+        const Alphabet::Enum ALPHABETS[] = { Alphabet::e_BASIC,
+                                             Alphabet::e_URL };
+
+        if (verbose) cout << "\nValid input." << endl;
+        for (int a = 0; a < 2; ++a) {
+            const Alphabet::Enum ALPHABET = ALPHABETS[a];
+
+            for (bsl::size_t groups = 0; groups <= k_MAX_GROUPS; ++groups) {
+                for (bsl::size_t offset = 0; offset < 8; ++offset) {
+                    bsl::string text(offset, '#');
+                    text += referenceBase64(bytes, 3 * groups, ALPHABET);
+                    text += "QUJ";
+
+                    for (bsl::size_t extra = 0; extra < 4; ++extra) {
+                        bsl::vector<char> result(3 * groups + 1, '\x5a');
+
+                        ASSERTV(a, groups, offset, extra,
+                                4 * groups == Util::decodeBase64(
+                                                     result.data(),
+                                                     text.data() + offset,
+                                                     4 * groups + extra,
+                                                     ALPHABET));
+                        ASSERTV(a, groups, offset, extra,
+                                0 == bsl::memcmp(result.data(),
+                                                 bytes,
+                                                 3 * groups));
+                        ASSERTV(a, groups, offset, extra,
+                                '\x5a' == result[3 * groups]);
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nInvalid characters." << endl;
+        for (int a = 0; a < 2; ++a) {
+            const Alphabet::Enum ALPHABET = ALPHABETS[a];
+
+            const char *INVALID = Alphabet::e_BASIC == ALPHABET
+                                ? "-_= \r\n\t.@[`{\x7f\x80\xc1\xff"
+                                : "+/= \r\n\t.@[`{\x7f\x80\xc1\xff";
+            const bsl::size_t NUM_INVALID = bsl::strlen(INVALID);
+
+            const bsl::string valid = referenceBase64(bytes,
+                                                      sizeof bytes,
+                                                      ALPHABET);
+
+            for (bsl::size_t pos = 0; pos < valid.length(); ++pos) {
+                for (bsl::size_t i = 0; i <= NUM_INVALID; ++i) {
+                    bsl::string text(valid);
+                    text[pos] = INVALID[i];  // includes the null character
+
+                    bsl::vector<char> result(sizeof bytes, '\x5a');
+
+                    const bsl::size_t EXP = pos / 4 * 4;
+
+                    ASSERTV(a, pos, i, EXP == Util::decodeBase64(
+                                                             result.data(),
+                                                             text.data(),
+                                                             text.length(),
+                                                             ALPHABET));
+                    ASSERTV(a, pos, i,
+                            0 == bsl::memcmp(result.data(),
+                                             bytes,
+                                             EXP / 4 * 3));
+                    ASSERTV(a, pos, i, '\x5a' == result[EXP / 4 * 3]);
+                }
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING `encodeBase64`
+        //
+        // Concerns:
+        // 1. Each group of three bytes is encoded as four characters of the
+        //    requested alphabet.
+        //
+        // 2. Exactly `length / 3 * 4` characters are written.
+        //
+        // 3. The test vectors of RFC 4648 are reproduced.
+        //
+        // Plan:
+        // 1. For every number of groups up to a limit, several input
+        //    offsets, and both alphabets, encode pseudo-random bytes into a
+        //    buffer filled with a sentinel, and compare with the reference
+        //    implementation.  (C-1, 2)
+        //
+        // 2. Encode the complete groups of the RFC 4648 test vectors.  (C-3)
+        //
+        // Testing:
+        //   void encodeBase64(char *, const char *, size_t, Alphabet);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `encodeBase64`" << endl
+                          << "======================" << endl;
+
+        char bytes[3 * k_MAX_GROUPS + 8];
+        fillRandom(bytes, sizeof bytes, 2);
+
+        const Alphabet::Enum ALPHABETS[] = { Alphabet::e_BASIC,
+                                             Alphabet::e_URL };
+
+        for (int a = 0; a < 2; ++a) {
+            const Alphabet::Enum ALPHABET = ALPHABETS[a];
+
+            for (bsl::size_t groups = 0; groups <= k_MAX_GROUPS; ++groups) {
+                for (bsl::size_t offset = 0; offset < 8; ++offset) {
+                    const char *INPUT = bytes + offset;
+
+                    bsl::vector<char> result(4 * groups + 1, '\x5a');
+
+                    Util::encodeBase64(result.data(),
+                                       INPUT,
+                                       3 * groups,
+                                       ALPHABET);
+
+                    const bsl::string EXP = referenceBase64(INPUT,
+                                                            3 * groups,
+                                                            ALPHABET);
+
+                    ASSERTV(a, groups, offset,
+                            EXP == bsl::string(result.data(), 4 * groups));
+                    ASSERTV(a, groups, offset,
+                            '\x5a' == result[4 * groups]);
+                }
+            }
+        }
+
+        static const struct {
+            int         d_line;
+            const char *d_input;
+            const char *d_expected;
+        } DATA[] = {
+            { L_, "",       ""         },
+            { L_, "foo",    "Zm9v"     },
+            { L_, "foobar", "Zm9vYmFy" },
+            { L_, "\xfb\xff\xbf", "+/+/" },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int          LINE   = DATA[ti].d_line;
+            const char *const  INPUT  = DATA[ti].d_input;
+            const bsl::size_t  LENGTH = bsl::strlen(INPUT);
+            const bsl::string  EXP    = DATA[ti].d_expected;
+
+            char result[8];
+            Util::encodeBase64(result, INPUT, LENGTH, Alphabet::e_BASIC);
+            ASSERTV(LINE, EXP == bsl::string(result, LENGTH / 3 * 4));
+
+            bsl::string urlExp(EXP);
+            for (bsl::size_t i = 0; i < urlExp.length(); ++i) {
+                urlExp[i] = '+' == urlExp[i] ? '-'
+                          : '/' == urlExp[i] ? '_'
+                          : urlExp[i];
+            }
+            Util::encodeBase64(result, INPUT, LENGTH, Alphabet::e_URL);
+            ASSERTV(LINE, urlExp == bsl::string(result, LENGTH / 3 * 4));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Round-trip a short buffer through each encoding.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const char INPUT[] = "The quick brown fox jumps over the lazy dog!!";
+        const bsl::size_t LENGTH = sizeof INPUT - 1;
+        ASSERT(0 == LENGTH % 3);
+
+        char encoded[2 * LENGTH];
+        char decoded[LENGTH];
+
+        Util::encodeBase64(encoded, INPUT, LENGTH, Alphabet::e_BASIC);
+        if (veryVerbose) {
+            P(bsl::string(encoded, LENGTH / 3 * 4));
+        }
+        ASSERT(LENGTH / 3 * 4 == Util::decodeBase64(decoded,
+                                                    encoded,
+                                                    LENGTH / 3 * 4,
+                                                    Alphabet::e_BASIC));
+        ASSERT(0 == bsl::memcmp(decoded, INPUT, LENGTH));
+
+        Util::encodeHex(encoded, INPUT, LENGTH, false);
+        if (veryVerbose) {
+            P(bsl::string(encoded, 2 * LENGTH));
+        }
+        ASSERT(2 * LENGTH == Util::decodeHex(decoded, encoded, 2 * LENGTH));
+        ASSERT(0 == bsl::memcmp(decoded, INPUT, LENGTH));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        // 1. The bulk conversions are substantially faster than converting a
+        //    byte at a time.
+        //
+        // Plan:
+        // 1. Time each conversion of a buffer of about 1 MiB, and report
+        //    the throughput.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const bsl::size_t k_SIZE       = 1024 * 1024 - 1;  // multiple of 3
+        const int         k_ITERATIONS = 200;
+
+        bsl::vector<char> bytes(k_SIZE);
+        bsl::vector<char> encoded(2 * k_SIZE);
+        bsl::vector<char> decoded(k_SIZE);
+        fillRandom(bytes.data(), k_SIZE, 1);
+
+        const double k_MB = static_cast<double>(k_SIZE) * k_ITERATIONS
+                                                             / (1024 * 1024);
+
+        bsls::Stopwatch timer;
+
+        timer.start();
+        for (int i = 0; i < k_ITERATIONS; ++i) {
+            Util::encodeBase64(encoded.data(),
+                               bytes.data(),
+                               k_SIZE,
+                               Alphabet::e_BASIC);
+        }
+        timer.stop();
+        cout << "encodeBase64: " << k_MB / timer.elapsedTime() << " MB/s"
+             << endl;
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < k_ITERATIONS; ++i) {
+            ASSERT(k_SIZE / 3 * 4 == Util::decodeBase64(decoded.data(),
+                                                        encoded.data(),
+                                                        k_SIZE / 3 * 4,
+                                                        Alphabet::e_BASIC));
+        }
+        timer.stop();
+        cout << "decodeBase64: " << k_MB / timer.elapsedTime() << " MB/s"
+             << endl;
+        ASSERT(decoded == bytes);
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < k_ITERATIONS; ++i) {
+            Util::encodeHex(encoded.data(), bytes.data(), k_SIZE, true);
+        }
+        timer.stop();
+        cout << "encodeHex:    " << k_MB / timer.elapsedTime() << " MB/s"
+             << endl;
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < k_ITERATIONS; ++i) {
+            ASSERT(2 * k_SIZE == Util::decodeHex(decoded.data(),
+                                                 encoded.data(),
+                                                 2 * k_SIZE));
+        }
+        timer.stop();
+        cout << "decodeHex:    " << k_MB / timer.elapsedTime() << " MB/s"
+             << endl;
+        ASSERT(decoded == bytes);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -5,6 +5,7 @@
 BSLS_IDENT("$Id$ $CSID$")
 
 #include <bdlde_charconvertstatus.h>
+#include <bdlde_utf8bulkutil.h>
 
 #include <bsla_maybeunused.h>
 #include <bslmf_assert.h>
@@ -338,13 +339,18 @@ struct Capacity {
     void operator--() { --d_capacity; }
 
     /// Decrement `d_capacity` by the specified `delta`.
-    void operator-=(int delta) { d_capacity -= delta; }
+    void operator-=(bsl::size_t delta) { d_capacity -= delta; }
 
     // ACCESSORS
 
     /// Return `true` if `d_capacity` is less than the specified `rhs`, and
     /// `false` otherwise.
     bool operator<(bsl::size_t rhs) const { return d_capacity < rhs; }
+
+    /// Return the number of words that can be written while still leaving
+    /// room for the terminating null.  The behavior is undefined unless
+    /// `0 < d_capacity`.
+    bsl::size_t headroom() const { return d_capacity - 1; }
 };
 
 /// Functor passed to `localUtf8ToUtf16` and `localUtf16ToUtf8` in cases
@@ -360,12 +366,15 @@ struct NoOpCapacity {
     void operator--() {}
 
     /// No-op.
-    void operator-=(int) {}
+    void operator-=(bsl::size_t) {}
 
     // ACCESSORS
 
     /// Return `false`.
     bool operator<(bsl::size_t) const { return false; }
+
+    /// Return the largest value of `bsl::size_t`.
+    bsl::size_t headroom() const { return ~bsl::size_t(0); }
 };
 
 // LOCAL HELPER STRUCT
@@ -437,6 +446,14 @@ struct Utf8 {
             }
         }
 
+        /// Return the number of octets from the specified `position` to the
+        /// end of input.  The behavior is undefined unless
+        /// `position <= d_end`.
+        bsl::size_t numReadable(const OctetType *position) const
+        {
+            return d_end - position;
+        }
+
         /// Return a pointer to after all the consecutive continuation
         /// bytes following the specified `octets` that are prior to
         /// `d_end`.  The behavior is undefined unless `octets <= d_end`.
@@ -500,6 +517,13 @@ struct Utf8 {
             return 0 == *position;
         }
 
+        /// Return 1, the number of octets known to be readable at the
+        /// specified `position`, which must not be at the end of input.
+        bsl::size_t numReadable(const OctetType *) const
+        {
+            return 1;
+        }
+
         /// Return a pointer to after all the consecutive continuation
         /// bytes following the specified `octets`.  The behavior is
         /// undefined unless `octets <= d_end`.
@@ -776,6 +800,14 @@ struct Utf16 {
                 return true;                                          // RETURN
             }
         }
+
+        /// Return the number of words from the specified `utf16Buf` to the
+        /// end of input.  The behavior is undefined unless
+        /// `utf16Buf <= d_end`.
+        bsl::size_t numReadable(const UTF16_WORD *utf16Buf) const
+        {
+            return d_end - utf16Buf;
+        }
     };
 
     /// The `class` determines whether translation is at the end of input by
@@ -798,6 +830,13 @@ struct Utf16 {
         {
             return !*u16Buf;
         }
+
+        /// Return 1, the number of words known to be readable at the
+        /// specified `utf16Buf`, which must not be at the end of input.
+        bsl::size_t numReadable(const UTF16_WORD *) const
+        {
+            return 1;
+        }
     };
 
     // CLASS METHODS
@@ -1032,6 +1071,95 @@ struct NoOpSwapper {
     }
 };
 
+/// Translate the longest prefix of the specified `octets`, of at most the
+/// specified `maxLength` octets, consisting solely of single-octet code
+/// points into words at the specified `dstBuffer`, using the specified
+/// `SWAPPER` to encode them, and return the number of octets translated.
+/// The behavior is undefined unless `0 < maxLength` and `*octets` is a
+/// single-octet code point.
+template <class UTF16_WORD, class SWAPPER>
+inline
+bsl::size_t translateAsciiRun(UTF16_WORD            *dstBuffer,
+                              const Utf8::OctetType *octets,
+                              bsl::size_t            maxLength,
+                              SWAPPER                )
+{
+    bsl::size_t ii = 0;
+    do {
+        dstBuffer[ii] = SWAPPER::encodeSingleWord(octets[ii]);
+        ++ii;
+    } while (ii < maxLength && Utf8::isSingleOctet(octets[ii]));
+
+    return ii;
+}
+
+/// Translate the longest prefix of the specified `octets`, of at most the
+/// specified `maxLength` octets, consisting solely of single-octet code
+/// points into host-order words at the specified `dstBuffer`, and return
+/// the number of octets translated.  The behavior is undefined unless
+/// `0 < maxLength` and `*octets` is a single-octet code point.
+inline
+bsl::size_t translateAsciiRun(unsigned short              *dstBuffer,
+                              const Utf8::OctetType       *octets,
+                              bsl::size_t                  maxLength,
+                              NoOpSwapper<unsigned short>  )
+{
+    if (1 == maxLength) {
+        *dstBuffer = *octets;
+        return 1;                                                     // RETURN
+    }
+
+    return bdlde::Utf8BulkUtil::widenAsciiPrefix(
+                                 dstBuffer,
+                                 reinterpret_cast<const char *>(octets),
+                                 maxLength);
+}
+
+/// Translate the longest prefix of the specified `srcBuffer`, of at most the
+/// specified `maxLength` words, consisting solely of words that encode as a
+/// single UTF-8 octet, decoding each using the specified `SWAPPER`, into
+/// the specified `dstBuffer`, and return the number of words translated.
+/// The behavior is undefined unless `0 < maxLength` and `*srcBuffer`
+/// encodes as a single octet.
+template <class UTF16_WORD, class SWAPPER>
+inline
+bsl::size_t translateAsciiRun(char             *dstBuffer,
+                              const UTF16_WORD *srcBuffer,
+                              bsl::size_t       maxLength,
+                              SWAPPER           )
+{
+    bsl::size_t ii = 0;
+    do {
+        dstBuffer[ii] = Utf16::getUtf8Value(
+                                 SWAPPER::decodeSingleWord(srcBuffer + ii));
+        ++ii;
+    } while (ii < maxLength &&
+             Utf16::isSingleUtf8(SWAPPER::decodeSingleWord(srcBuffer + ii)));
+
+    return ii;
+}
+
+/// Translate the longest prefix of the specified host-order `srcBuffer`, of
+/// at most the specified `maxLength` words, consisting solely of words that
+/// encode as a single UTF-8 octet into the specified `dstBuffer`, and
+/// return the number of words translated.  The behavior is undefined unless
+/// `0 < maxLength` and `*srcBuffer` encodes as a single octet.
+inline
+bsl::size_t translateAsciiRun(char                        *dstBuffer,
+                              const unsigned short        *srcBuffer,
+                              bsl::size_t                  maxLength,
+                              NoOpSwapper<unsigned short>  )
+{
+    if (1 == maxLength) {
+        *dstBuffer = static_cast<char>(*srcBuffer);
+        return 1;                                                     // RETURN
+    }
+
+    return bdlde::Utf8BulkUtil::narrowAsciiPrefix(dstBuffer,
+                                                  srcBuffer,
+                                                  maxLength);
+}
+
 // These compile-time asserts aren't strictly necessary, but we may plan to
 // expand this component to support UTF-16 wstrings someday, which won't work
 // if the size of a 'wchar_t' is less than that of a 'short' on any platform
@@ -1216,11 +1344,16 @@ int localUtf8ToUtf16(UTF16_WORD       *dstBuffer,
                 break;
             }
 
-            *dstBuffer = SWAPPER::encodeSingleWord(*octets);
-            ++octets;
-            ++dstBuffer;
-            --dstCapacity;
-            ++nCodePoints;
+            const bsl::size_t n = translateAsciiRun(
+                                   dstBuffer,
+                                   octets,
+                                   bsl::min(endFunctor.numReadable(octets),
+                                            dstCapacity.headroom()),
+                                   swapper);
+            octets      += n;
+            dstBuffer   += n;
+            dstCapacity -= n;
+            nCodePoints += n;
             continue;
         }
 
@@ -1521,11 +1654,16 @@ int localUtf16ToUtf8(char             *dstBuffer,
                 returnStatus |= OUT_OF_SPACE_BIT;
                 break;
             }
-            *dstBuffer = Utf16::getUtf8Value(word0);
-            ++srcBuffer;
-            ++dstBuffer;
-            --dstCapacity;
-            ++nCodePoints;
+            const bsl::size_t n = translateAsciiRun(
+                                   dstBuffer,
+                                   srcBuffer,
+                                   bsl::min(endFunctor.numReadable(srcBuffer),
+                                            dstCapacity.headroom()),
+                                   swapper);
+            srcBuffer   += n;
+            dstBuffer   += n;
+            dstCapacity -= n;
+            nCodePoints += n;
             continue;
         }
 
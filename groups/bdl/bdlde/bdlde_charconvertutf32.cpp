@@ -4,6 +4,7 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_charconvertutf32_cpp,"$Id$ $CSID$")
 
+#include <bdlde_utf8bulkutil.h>
 #include <bdlde_utf8util.h>    // for testing only
 
 #include <bslmf_assert.h>     // 'BSLMF_ASSERT'
@@ -179,7 +180,7 @@ struct Capacity {
     void operator--();
 
     /// Decrement `d_capacity` by the specified `delta`.
-    void operator-=(int delta);
+    void operator-=(bsl::size_t delta);
 
     // ACCESSORS
 
@@ -190,6 +191,11 @@ struct Capacity {
     /// Return `true` if `d_capacity` is greater than or equal to the
     /// specified `rhs`, and `false` otherwise.
     bool operator>=(bsl::size_t rhs) const;
+
+    /// Return the number of units of output that can be written while still
+    /// leaving room for the terminating null.  The behavior is undefined
+    /// unless `0 < d_capacity`.
+    bsl::size_t headroom() const;
 };
 
                            // ---------------------
@@ -213,7 +219,7 @@ void Capacity::operator--()
 
 /// Decrement `d_capacity` by `delta`.
 inline
-void Capacity::operator-=(int delta)
+void Capacity::operator-=(bsl::size_t delta)
 {
     d_capacity -= delta;
 }
@@ -236,6 +242,12 @@ bool Capacity::operator>=(bsl::size_t rhs) const
     return d_capacity >= rhs;
 }
 
+inline
+bsl::size_t Capacity::headroom() const
+{
+    return d_capacity - 1;
+}
+
                          // =========================
                          // local struct NoopCapacity
                          // =========================
@@ -259,7 +271,7 @@ struct NoopCapacity {
     void operator--();
 
     /// No-op.
-    void operator-=(int);
+    void operator-=(bsl::size_t);
 
     // ACCESSORS
 
@@ -268,6 +280,9 @@ struct NoopCapacity {
 
     /// Return `true`.
     bool operator>=(bsl::size_t) const;
+
+    /// Return the largest value of `bsl::size_t`.
+    bsl::size_t headroom() const;
 };
 
                          // -------------------------
@@ -290,7 +305,7 @@ void NoopCapacity::operator--()
 
 /// No-op.
 inline
-void NoopCapacity::operator-=(int)
+void NoopCapacity::operator-=(bsl::size_t)
 {}
 
 // ACCESSORS
@@ -309,6 +324,13 @@ bool NoopCapacity::operator>=(bsl::size_t) const
     return true;
 }
 
+/// Return the largest value of `bsl::size_t`.
+inline
+bsl::size_t NoopCapacity::headroom() const
+{
+    return ~bsl::size_t(0);
+}
+
                             // ====================
                             // local struct Swapper
                             // ====================
@@ -379,6 +401,10 @@ class Utf8PtrBasedEnd {
     /// `position <= d_end`.
     bool isFinished(const OctetType *position) const;
 
+    /// Return the number of octets from the specified `position` to the end
+    /// of input.  The behavior is undefined unless `position <= d_end`.
+    bsl::size_t numReadable(const OctetType *position) const;
+
     /// Return a pointer to after the specified `skipBy` consecutive
     /// continuation bytes following the specified `octets` that are prior
     /// to `d_end`.  The behavior is undefined unless `octets <= d_end`.
@@ -415,6 +441,12 @@ bool Utf8PtrBasedEnd::isFinished(const OctetType *position) const
     }
 }
 
+inline
+bsl::size_t Utf8PtrBasedEnd::numReadable(const OctetType *position) const
+{
+    return d_end - position;
+}
+
 inline
 const OctetType *Utf8PtrBasedEnd::skipContinuations(
                                                  const OctetType *octets,
@@ -473,6 +505,10 @@ struct Utf8ZeroBasedEnd {
     /// and `false` otherwise.
     bool isFinished(const OctetType *position) const;
 
+    /// Return 1, the number of octets known to be readable at the specified
+    /// `position`, which must not be at the end of input.
+    bsl::size_t numReadable(const OctetType *position) const;
+
     /// Return a pointer to after up to the specified `skipBy` consecutive
     /// continuation bytes following the specified `octets`.  The function
     /// will skip over less than `skipBy` octets if it encounters end of
@@ -504,6 +540,12 @@ bool Utf8ZeroBasedEnd::isFinished(const OctetType *position) const
     return 0 == *position;
 }
 
+inline
+bsl::size_t Utf8ZeroBasedEnd::numReadable(const OctetType *) const
+{
+    return 1;
+}
+
 inline
 const OctetType *Utf8ZeroBasedEnd::skipContinuations(
                                                  const OctetType *octets,
@@ -567,6 +609,10 @@ class Utf32PtrBasedEnd {
     /// `false` otherwise.  The behavior is undefined unless
     /// `position <= d_end`.
     bool isFinished(const unsigned int *position) const;
+
+    /// Return the number of words from the specified `position` to the end
+    /// of input.  The behavior is undefined unless `position <= d_end`.
+    bsl::size_t numReadable(const unsigned int *position) const;
 };
 
                         // ---------------------------
@@ -592,6 +638,12 @@ bool Utf32PtrBasedEnd::isFinished(const unsigned int *position) const
     }
 }
 
+inline
+bsl::size_t Utf32PtrBasedEnd::numReadable(const unsigned int *position) const
+{
+    return d_end_p - position;
+}
+
                        // ==============================
                        // local struct Utf32ZeroBasedEnd
                        // ==============================
@@ -607,6 +659,10 @@ struct Utf32ZeroBasedEnd {
     /// Return `true` if the specified `position` is at the end of input,
     /// and `false` otherwise.
     bool isFinished(const unsigned int *position) const;
+
+    /// Return 1, the number of words known to be readable at the specified
+    /// `position`, which must not be at the end of input.
+    bsl::size_t numReadable(const unsigned int *position) const;
 };
 
                        // ------------------------------
@@ -626,6 +682,12 @@ bool Utf32ZeroBasedEnd::isFinished(const unsigned int *position) const
     return 0 == *position;
 }
 
+inline
+bsl::size_t Utf32ZeroBasedEnd::numReadable(const unsigned int *) const
+{
+    return 1;
+}
+
 }  // close unnamed namespace
 
 /// Return the specified `ptr` cast to a `const OctetType *`.  Note that
@@ -933,6 +995,95 @@ bsl::size_t utf8BufferLengthNeeded(const unsigned int *input,
     return ret + 1;
 }
 
+/// Translate the longest prefix of the specified `input`, of at most the
+/// specified `maxLength` octets, consisting solely of single-octet code
+/// points to the specified `output`, using the specified `SWAPPER` to set
+/// the byte order of the words written, and return the number of octets
+/// translated.  The behavior is undefined unless `0 < maxLength` and
+/// `*input` is a single-octet code point.
+template <class SWAPPER>
+static inline
+bsl::size_t widenAsciiRun(unsigned int    *output,
+                          const OctetType *input,
+                          bsl::size_t      maxLength,
+                          SWAPPER          )
+{
+    bsl::size_t ii = 0;
+    do {
+        output[ii] = SWAPPER::swapBytes(input[ii]);
+        ++ii;
+    } while (ii < maxLength && isSingleOctet(input[ii]));
+
+    return ii;
+}
+
+/// Translate the longest prefix of the specified `input`, of at most the
+/// specified `maxLength` octets, consisting solely of single-octet code
+/// points to host-order words at the specified `output`, and return the
+/// number of octets translated.  The behavior is undefined unless
+/// `0 < maxLength` and `*input` is a single-octet code point.
+static inline
+bsl::size_t widenAsciiRun(unsigned int    *output,
+                          const OctetType *input,
+                          bsl::size_t      maxLength,
+                          NoopSwapper      )
+{
+    if (1 == maxLength) {
+        *output = *input;
+        return 1;                                                     // RETURN
+    }
+
+    return BloombergLP::bdlde::Utf8BulkUtil::widenAsciiPrefix(
+                                       output,
+                                       reinterpret_cast<const char *>(input),
+                                       maxLength);
+}
+
+/// Translate the longest prefix of the specified `input`, of at most the
+/// specified `maxLength` words, consisting solely of words that, once
+/// brought to host byte order using the specified `SWAPPER`, fit in a
+/// single octet, to the specified `output`, and return the number of words
+/// translated.  The behavior is undefined unless `0 < maxLength` and
+/// `*input` fits in a single octet.
+template <class SWAPPER>
+static inline
+bsl::size_t narrowAsciiRun(OctetType          *output,
+                           const unsigned int *input,
+                           bsl::size_t         maxLength,
+                           SWAPPER             )
+{
+    bsl::size_t ii = 0;
+    do {
+        output[ii] = static_cast<OctetType>(SWAPPER::swapBytes(input[ii]));
+        ++ii;
+    } while (ii < maxLength &&
+                             fitsInSingleOctet(SWAPPER::swapBytes(input[ii])));
+
+    return ii;
+}
+
+/// Translate the longest prefix of the specified host-order `input`, of at
+/// most the specified `maxLength` words, consisting solely of words that
+/// fit in a single octet, to the specified `output`, and return the number
+/// of words translated.  The behavior is undefined unless `0 < maxLength`
+/// and `*input` fits in a single octet.
+static inline
+bsl::size_t narrowAsciiRun(OctetType          *output,
+                           const unsigned int *input,
+                           bsl::size_t         maxLength,
+                           NoopSwapper         )
+{
+    if (1 == maxLength) {
+        *output = static_cast<OctetType>(*input);
+        return 1;                                                     // RETURN
+    }
+
+    return BloombergLP::bdlde::Utf8BulkUtil::narrowAsciiPrefix(
+                                             reinterpret_cast<char *>(output),
+                                             input,
+                                             maxLength);
+}
+
 namespace {
     // Second unnamed namespace -- the static routines that precede this use
     // constants from the first unnamed namespace.  Now we are declaring two
@@ -1021,6 +1172,13 @@ class Utf8ToUtf32Translator {
     /// is undefined unless `d_capacity >= 2`.
     void handleInvalidSequence();
 
+    /// Translate the run of single-octet code points at the start of
+    /// `d_input`, stopping early if the output has room for no more than the
+    /// terminating null, and update the output and the state of this object
+    /// accordingly.  The behavior is undefined unless `*d_input` is a
+    /// single-octet code point and `d_capacity >= 2`.
+    void translateAsciiRun();
+
     /// Read one Unicode code point of UTF-8 from the input stream
     /// `d_input`, and update the output and the state of this object
     /// accordingly.  Return a non-zero value if there was insufficient
@@ -1157,6 +1315,23 @@ Utf8ToUtf32Translator<CAPACITY, END_FUNCTOR, SWAPPER>::handleInvalidSequence()
     }
 }
 
+template <class CAPACITY, class END_FUNCTOR, class SWAPPER>
+inline
+void Utf8ToUtf32Translator<CAPACITY, END_FUNCTOR, SWAPPER>::translateAsciiRun()
+{
+    BSLS_ASSERT(d_capacity >= 2);
+
+    const bsl::size_t maxLength = bsl::min(d_endFunctor.numReadable(d_input),
+                                           d_capacity.headroom());
+    const bsl::size_t n = widenAsciiRun(d_output,
+                                        d_input,
+                                        maxLength,
+                                        SWAPPER());
+    d_input    += n;
+    d_output   += n;
+    d_capacity -= n;
+}
+
 // CLASS METHODS
 template <class CAPACITY, class END_FUNCTOR, class SWAPPER>
 int Utf8ToUtf32Translator<CAPACITY, END_FUNCTOR, SWAPPER>::translate(
@@ -1177,6 +1352,10 @@ int Utf8ToUtf32Translator<CAPACITY, END_FUNCTOR, SWAPPER>::translate(
 
     int ret = 0;
     while (!endFunctor.isFinished(translator.d_input)) {
+        if (isSingleOctet(*translator.d_input) && translator.d_capacity >= 2) {
+            translator.translateAsciiRun();
+            continue;
+        }
         if (0 != translator.decodeCodePoint()) {
             BSLS_ASSERT((bsl::is_same<CAPACITY, Capacity>::value));
             ret = k_OUT_OF_SPACE_BIT;
@@ -1290,6 +1469,14 @@ class Utf32ToUtf8Translator {
     /// there are at least 2 bytes of room in the output buffer.
     int decodeCodePoint(const unsigned int uc);
 
+    /// Translate the run of words at the start of `d_input` that fit in a
+    /// single octet, without reading past the end of input as determined by
+    /// the specified `endFunctor` and stopping early if the output has room
+    /// for no more than the terminating null, and update the output and the
+    /// state of this object accordingly.  The behavior is undefined unless
+    /// `*d_input` fits in a single octet and `d_capacity >= 2`.
+    void translateAsciiRun(const END_FUNCTOR& endFunctor);
+
   public:
     // PUBLIC CLASS METHOD
 
@@ -1430,6 +1617,25 @@ int Utf32ToUtf8Translator<CAPACITY, END_FUNCTOR, SWAPPER>::decodeCodePoint(
     return 0;
 }
 
+template <class CAPACITY, class END_FUNCTOR, class SWAPPER>
+inline
+void Utf32ToUtf8Translator<CAPACITY, END_FUNCTOR, SWAPPER>::translateAsciiRun(
+                                                 const END_FUNCTOR& endFunctor)
+{
+    BSLS_ASSERT(d_capacity >= 2);
+
+    const bsl::size_t maxLength = bsl::min(endFunctor.numReadable(d_input),
+                                           d_capacity.headroom());
+    const bsl::size_t n = narrowAsciiRun(d_output,
+                                         d_input,
+                                         maxLength,
+                                         SWAPPER());
+    d_input                += n;
+    d_output               += n;
+    d_capacity             -= n;
+    d_numCodePointsWritten += n;
+}
+
 // CLASS METHODS
 template <class CAPACITY, class END_FUNCTOR, class SWAPPER>
 int Utf32ToUtf8Translator<CAPACITY, END_FUNCTOR, SWAPPER>::translate(
@@ -1453,7 +1659,12 @@ int Utf32ToUtf8Translator<CAPACITY, END_FUNCTOR, SWAPPER>::translate(
     int          ret = 0;
     unsigned int uc;
     while (!endFunctor.isFinished(translator.d_input)) {
-        uc = SWAPPER::swapBytes(*translator.d_input++);
+        uc = SWAPPER::swapBytes(*translator.d_input);
+        if (fitsInSingleOctet(uc) && translator.d_capacity >= 2) {
+            translator.translateAsciiRun(endFunctor);
+            continue;
+        }
+        ++translator.d_input;
         if (0 != translator.decodeCodePoint(uc)) {
             BSLS_ASSERT((bsl::is_same<CAPACITY, Capacity>::value));
             ret |= k_OUT_OF_SPACE_BIT;
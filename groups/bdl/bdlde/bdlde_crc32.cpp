@@ -7,6 +7,15 @@ BSLS_IDENT_RCSID(bdlde_crc32_cpp,"$Id$ $CSID$")
 #include <bslmf_assert.h>
 
 #include <bsls_annotation.h>
+#include <bsls_platform.h>
+
+#if defined(BSLS_PLATFORM_CPU_SSE2) && defined(__PCLMUL__) &&                 \
+   (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+# include <cpuid.h>
+# include <emmintrin.h>
+# include <wmmintrin.h>
+# define BDLDE_CRC32_PCLMUL_ENABLED
+#endif
 
 ///IMPLEMENTATION NOTES
 ///--------------------
@@ -85,6 +94,20 @@ BSLS_IDENT_RCSID(bdlde_crc32_cpp,"$Id$ $CSID$")
 //..
 //  http://ravenphpscripts.com/modules.php?name=Forums&file=viewtopic&t=614
 //..
+//
+// When compiled for x86 with carry-less multiplication enabled (`-mpclmul`),
+// and the running processor reports support for `PCLMULQDQ`, long inputs are
+// first reduced by "folding" (see Intel White Paper: "Fast CRC Computation
+// for Generic Polynomials Using PCLMULQDQ Instruction").  Four 128-bit
+// accumulators are each multiplied by `x^512 mod P` and `x^576 mod P` (one
+// constant per 64-bit half) and combined with the next 64 bytes of input; the
+// four accumulators are then folded into one (with `x^128 mod P` and
+// `x^192 mod P`), which absorbs any remaining complete 16-byte blocks.  The
+// final 16-byte accumulator is congruent, modulo the CRC polynomial, to the
+// input consumed, so the checksum is completed by running the accumulator
+// followed by the remaining (fewer than 16) input bytes through the table.
+// The folding constants are stored bit-reflected and shifted left by one, as
+// `reflect32(x^(E - 32) mod P) << 1` for a shift of `E` bits.
 
 #include <bsls_assert.h>
 #include <bsl_ostream.h>
@@ -150,42 +173,144 @@ static const unsigned int CRC_TABLE[256] = {
     0x2d02ef8d
 };
 
-namespace bdlde {
-                                // -----------
-                                // class Crc32
-                                // -----------
+namespace {
 
-// MANIPULATORS
-void Crc32::update(const void *data, bsl::size_t length)
+/// Return the specified `crc` (the bitwise inverse of a checksum) updated
+/// with the specified `length` bytes at the specified `data`, using
+/// `CRC_TABLE`.
+inline
+unsigned int updateTable(unsigned int         crc,
+                         const unsigned char *data,
+                         bsl::size_t          length)
 {
-    BSLS_ASSERT(data || !length);
-
     // The following is a Duff's Device-based implementation of a common
     // algorithm (see end of RFC 1952).
 
-    const unsigned char *d   = (const unsigned char *)data;
-    unsigned int         tmp = d_crc;
-
     switch (length % 4) {
-      case 3: tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
+      case 3: crc = CRC_TABLE[(crc ^ *data++) & 0xff] ^ (crc >> 8);
           BSLS_ANNOTATION_FALLTHROUGH;
-      case 2: tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
+      case 2: crc = CRC_TABLE[(crc ^ *data++) & 0xff] ^ (crc >> 8);
           BSLS_ANNOTATION_FALLTHROUGH;
-      case 1: tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
+      case 1: crc = CRC_TABLE[(crc ^ *data++) & 0xff] ^ (crc >> 8);
           BSLS_ANNOTATION_FALLTHROUGH;
       default: ;
     }
 
     bsl::size_t n = length / 4;
     while (n) {
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
-        tmp = CRC_TABLE[(tmp ^ *d++) & 0xff] ^ (tmp >> 8);
+        crc = CRC_TABLE[(crc ^ *data++) & 0xff] ^ (crc >> 8);
+        crc = CRC_TABLE[(crc ^ *data++) & 0xff] ^ (crc >> 8);
+        crc = CRC_TABLE[(crc ^ *data++) & 0xff] ^ (crc >> 8);
+        crc = CRC_TABLE[(crc ^ *data++) & 0xff] ^ (crc >> 8);
         --n;
     }
 
-    d_crc = tmp;
+    return crc;
+}
+
+#ifdef BDLDE_CRC32_PCLMUL_ENABLED
+
+enum {
+    k_FOLD_MIN_LENGTH = 64  // shortest input that is folded with `PCLMULQDQ`
+};
+
+/// Return `true` if the running processor supports the `PCLMULQDQ`
+/// instruction, and `false` otherwise.
+bool isPclmulSupported()
+{
+    unsigned int eax, ebx, ecx, edx;
+    __cpuid(1, eax, ebx, ecx, edx);
+    return 0 != (ecx & bit_PCLMUL);
+}
+
+/// Return the specified `accumulator` shifted by the distance encoded in the
+/// specified `constants`, reduced to 128 bits, and combined with the
+/// specified `next` block of input.
+inline
+__m128i fold(__m128i accumulator, __m128i constants, __m128i next)
+{
+    const __m128i lo = _mm_clmulepi64_si128(accumulator, constants, 0x00);
+    const __m128i hi = _mm_clmulepi64_si128(accumulator, constants, 0x11);
+    return _mm_xor_si128(_mm_xor_si128(lo, hi), next);
+}
+
+/// Load into the specified `result` 16 bytes whose CRC-32 (computed from a
+/// zero register) equals the CRC-32 register obtained by processing the
+/// specified `length` bytes at the specified `data` from the specified
+/// `crc` register.  The behavior is undefined unless
+/// `k_FOLD_MIN_LENGTH <= length` and `0 == length % 16`.
+void foldPclmul(unsigned char       *result,
+                const unsigned char *data,
+                bsl::size_t          length,
+                unsigned int         crc)
+{
+    BSLS_ASSERT(k_FOLD_MIN_LENGTH <= length);
+    BSLS_ASSERT(0 == length % 16);
+
+    const __m128i k512 = _mm_set_epi64x(0x01c6e41596LL, 0x0154442bd4LL);
+    const __m128i k128 = _mm_set_epi64x(0x00ccaa009eLL, 0x01751997d0LL);
+
+    const __m128i *p = reinterpret_cast<const __m128i *>(data);
+
+    __m128i x0 = _mm_xor_si128(_mm_loadu_si128(p),
+                               _mm_cvtsi32_si128(static_cast<int>(crc)));
+    __m128i x1 = _mm_loadu_si128(p + 1);
+    __m128i x2 = _mm_loadu_si128(p + 2);
+    __m128i x3 = _mm_loadu_si128(p + 3);
+    p      += 4;
+    length -= 64;
+
+    for (; length >= 64; p += 4, length -= 64) {
+        x0 = fold(x0, k512, _mm_loadu_si128(p));
+        x1 = fold(x1, k512, _mm_loadu_si128(p + 1));
+        x2 = fold(x2, k512, _mm_loadu_si128(p + 2));
+        x3 = fold(x3, k512, _mm_loadu_si128(p + 3));
+    }
+
+    x0 = fold(x0, k128, x1);
+    x0 = fold(x0, k128, x2);
+    x0 = fold(x0, k128, x3);
+
+    for (; length; ++p, length -= 16) {
+        x0 = fold(x0, k128, _mm_loadu_si128(p));
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(result), x0);
+}
+
+#endif  // BDLDE_CRC32_PCLMUL_ENABLED
+
+}  // close unnamed namespace
+
+namespace bdlde {
+                                // -----------
+                                // class Crc32
+                                // -----------
+
+// MANIPULATORS
+void Crc32::update(const void *data, bsl::size_t length)
+{
+    BSLS_ASSERT(data || !length);
+
+    const unsigned char *d   = (const unsigned char *)data;
+    unsigned int         tmp = d_crc;
+
+#ifdef BDLDE_CRC32_PCLMUL_ENABLED
+    static const bool hasPclmul = isPclmulSupported();
+
+    if (k_FOLD_MIN_LENGTH <= length && hasPclmul) {
+        unsigned char     remainder[16];
+        const bsl::size_t folded = length & ~static_cast<bsl::size_t>(15);
+
+        foldPclmul(remainder, d, folded, tmp);
+
+        tmp     = updateTable(0, remainder, sizeof remainder);
+        d      += folded;
+        length -= folded;
+    }
+#endif
+
+    d_crc = updateTable(tmp, d, length);
 }
 
 // ACCESSORS
@@ -21,6 +21,15 @@ BSLS_IDENT("$Id: $")
 // SHA-256, it is relatively easy to find alternate texts with identical
 // checksum.
 //
+///Hardware Acceleration
+///---------------------
+// When this component is compiled for x86 with carry-less multiplication
+// enabled (e.g., `-mpclmul`), and the running processor supports the
+// `PCLMULQDQ` instruction, `update` reduces inputs of 64 bytes or more by
+// folding them 16 bytes at a time, which is more than an order of magnitude
+// faster than the table-driven implementation used otherwise.  The resulting
+// checksum is identical in either case.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
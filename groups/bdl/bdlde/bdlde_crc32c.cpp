@@ -33,6 +33,27 @@ BSLS_IDENT_RCSID(bdlde_crc32c_cpp,"$Id$ $CSID$")
 # define BDLDE_CRC32C_CPUID_SSE4_2_BIT_MASK bit_SSE42
 #endif
 
+#if defined(BDLDE_CRC32C_SSE4_2_ENABLED) && defined(__PCLMUL__) &&            \
+    defined(BSLS_PLATFORM_CPU_64_BIT)
+# include <emmintrin.h>
+# include <wmmintrin.h>
+# define BDLDE_CRC32C_PCLMUL_ENABLED
+#endif
+
+#if defined(BDLDE_CRC32C_ENABLE_ARM_CRC32) &&                                 \
+    defined(BSLS_PLATFORM_CPU_ARM) && defined(BSLS_PLATFORM_CPU_64_BIT) &&    \
+    defined(__ARM_FEATURE_CRC32) &&                                           \
+   (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+# include <arm_acle.h>
+# if defined(BSLS_PLATFORM_OS_LINUX)
+#  include <sys/auxv.h>
+#  ifndef HWCAP_CRC32
+#   define HWCAP_CRC32 (1 << 7)
+#  endif
+# endif
+# define BDLDE_CRC32C_ARM_CRC32_ENABLED
+#endif
+
 // #define BDLDE_SUPPORT_SPARC_HARDWARE_OPTIMIZATION
     // The Sparc hardware optimization is implemented in a third-party library
     // provided by Oracle.  For the time being we remove optimized crc32
@@ -1171,6 +1192,242 @@ unsigned int crc32cSse64bit(const unsigned char *data,
     return ~crc;
 }
 
+#   ifdef BDLDE_CRC32C_PCLMUL_ENABLED
+
+const unsigned int k_CLMUL_COMBINE_TABLE[256][2] =
+    // The following table holds, for three interleaved streams of
+    // `blockLength = 8 * (i + 1)` bytes each, the bit-reflected constants
+    // `x^(16 * blockLength - 33) mod P` and `x^(8 * blockLength - 33) mod P`
+    // (in that order) used to shift the CRC registers of the first and second
+    // streams over the stream(s) that follow them, where `P` is the
+    // Castagnoli polynomial 0x1EDC6F41.
+{
+    { 0x493C7D27, 0x00000001 }, { 0xBA4FC28E, 0x493C7D27 },
+    { 0xDDC0152B, 0xF20C0DFE }, { 0x9E4ADDF8, 0xBA4FC28E },
+    { 0x39D3B296, 0x3DA6D0CB }, { 0x0715CE53, 0xDDC0152B },
+    { 0x47DB8317, 0x1C291D04 }, { 0x0D3B6092, 0x9E4ADDF8 },
+    { 0xC96CFDC0, 0x740EEF02 }, { 0x878A92A7, 0x39D3B296 },
+    { 0xDAECE73E, 0x083A6EEC }, { 0xAB7AFF2A, 0x0715CE53 },
+    { 0x2162D385, 0xC49F4F67 }, { 0x83348832, 0x47DB8317 },
+    { 0x299847D5, 0x2AD91C30 }, { 0xB9E02B86, 0x0D3B6092 },
+    { 0x18B33A4E, 0x6992CEA2 }, { 0xB6DD949B, 0xC96CFDC0 },
+    { 0x78D9CCB7, 0x7E908048 }, { 0xBAC2FD7B, 0x878A92A7 },
+    { 0xA60CE07B, 0x1B3D8F29 }, { 0xCE7F39F4, 0xDAECE73E },
+    { 0x61D82E56, 0xF1D0F55E }, { 0xD270F1A2, 0xAB7AFF2A },
+    { 0xC619809D, 0xA87AB8A8 }, { 0x2B3CAC5D, 0x2162D385 },
+    { 0x65863B64, 0x8462D800 }, { 0x1B03397F, 0x83348832 },
+    { 0xEBB883BD, 0x71D111A8 }, { 0xB3E32C28, 0x299847D5 },
+    { 0x064F7F26, 0xFFD852C6 }, { 0xDD7E3B0C, 0xB9E02B86 },
+    { 0xF285651C, 0xDCB17AA4 }, { 0x10746F3C, 0x18B33A4E },
+    { 0xC7A68855, 0xF37C5AEE }, { 0x271D9844, 0xB6DD949B },
+    { 0x8E766A0C, 0x6051D5A2 }, { 0x93A5F730, 0x78D9CCB7 },
+    { 0x6CB08E5C, 0x18B0D4FF }, { 0x6B749FB2, 0xBAC2FD7B },
+    { 0x1393E203, 0x21F3D99C }, { 0xCEC3662E, 0xA60CE07B },
+    { 0x96C515BB, 0x8F158014 }, { 0xE6FC4E6A, 0xCE7F39F4 },
+    { 0x8227BB8A, 0xA00457F7 }, { 0xB0CD4768, 0x61D82E56 },
+    { 0x39C7FF35, 0x8D6D2C43 }, { 0xD7A4825C, 0xD270F1A2 },
+    { 0x0AB3844B, 0x00AC29CF }, { 0x0167D312, 0xC619809D },
+    { 0xF6076544, 0xE9ADF796 }, { 0x26F6A60A, 0x2B3CAC5D },
+    { 0xA741C1BF, 0x96638B34 }, { 0x98D8D9CB, 0x65863B64 },
+    { 0x49C3CC9C, 0xE0E9F351 }, { 0x68BCE87A, 0x1B03397F },
+    { 0x57A3D037, 0x9AF01F2D }, { 0x6956FC3B, 0xEBB883BD },
+    { 0x42D98888, 0x2CFF42CF }, { 0x3771E98F, 0xB3E32C28 },
+    { 0xB42AE3D9, 0x88F25A3A }, { 0x2178513A, 0x064F7F26 },
+    { 0xE0AC139E, 0x4E36F0B0 }, { 0x170076FA, 0xDD7E3B0C },
+    { 0x444DD413, 0xBD6F81F8 }, { 0x6F345E45, 0xF285651C },
+    { 0x41D17B64, 0x91C9BD4B }, { 0xFF0DBA97, 0x10746F3C },
+    { 0xA2B73DF1, 0x885F087B }, { 0xF872E54C, 0xC7A68855 },
+    { 0x1E41E9FC, 0x4C144932 }, { 0x86D8E4D2, 0x271D9844 },
+    { 0x651BD98B, 0x52148F02 }, { 0x5BB8F1BC, 0x8E766A0C },
+    { 0xA90FD27A, 0xA3C6F37A }, { 0xB3AF077A, 0x93A5F730 },
+    { 0x4984D782, 0xD7C0557F }, { 0xCA6EF3AC, 0x6CB08E5C },
+    { 0x234E0B26, 0x63DED06A }, { 0xDD66CBBB, 0x6B749FB2 },
+    { 0x4597456A, 0x4D56973C }, { 0xE9E28EB4, 0x1393E203 },
+    { 0x7B3FF57A, 0x9669C9DF }, { 0xC9C8B782, 0xCEC3662E },
+    { 0x3F70CC6F, 0xE417F38A }, { 0x93E106A4, 0x96C515BB },
+    { 0x62EC6C6D, 0x4B9E0F71 }, { 0xD813B325, 0xE6FC4E6A },
+    { 0x0DF04680, 0xD104B8FC }, { 0x2342001E, 0x8227BB8A },
+    { 0x0A2A8D7E, 0x5B397730 }, { 0x6D9A4957, 0xB0CD4768 },
+    { 0xE8B6368B, 0xE78EB416 }, { 0xD2C3ED1A, 0x39C7FF35 },
+    { 0x995A5724, 0x61FF0E01 }, { 0x9EF68D35, 0xD7A4825C },
+    { 0x0C139B31, 0x8D96551C }, { 0xF2271E60, 0x0AB3844B },
+    { 0x0B0BF8CA, 0x0BF80DD2 }, { 0x2664FD8B, 0x0167D312 },
+    { 0xED64812D, 0x8821ABED }, { 0x02EE03B2, 0xF6076544 },
+    { 0x8604AE0F, 0x6A45D2B2 }, { 0x363BD6B3, 0x26F6A60A },
+    { 0x135C83FD, 0xD8D26619 }, { 0x5FABE670, 0xA741C1BF },
+    { 0x35EC3279, 0xDE87806C }, { 0x00BCF5F6, 0x98D8D9CB },
+    { 0x8AE00689, 0x14338754 }, { 0x17F27698, 0x49C3CC9C },
+    { 0x58CA5F00, 0x5BD2011F }, { 0xAA7C7AD5, 0x68BCE87A },
+    { 0xB5CFCA28, 0xDD07448E }, { 0xDED288F8, 0x57A3D037 },
+    { 0x59F229BC, 0xDDE8F5B9 }, { 0x6D390DEC, 0x6956FC3B },
+    { 0x37170390, 0xA3E3E02C }, { 0x6353C1CC, 0x42D98888 },
+    { 0xC4584F5C, 0xD73C7BEA }, { 0xF48642E9, 0x3771E98F },
+    { 0x531377E2, 0x80FF0093 }, { 0xDD35BC8D, 0xB42AE3D9 },
+    { 0xB25B29F2, 0x8FE4C34D }, { 0x9A5EDE41, 0x2178513A },
+    { 0xA563905D, 0xDF99FC11 }, { 0x45CDDF4E, 0xE0AC139E },
+    { 0xACFA3103, 0x6C23E841 }, { 0xA51B6135, 0x170076FA },
+    { 0xDFD94FB2, 0xFE314258 }, { 0x80F2886B, 0x444DD413 },
+    { 0x67969A6A, 0x0D8373A0 }, { 0x021AC5EF, 0x6F345E45 },
+    { 0xE8310AFA, 0x19E3635E }, { 0x75451B04, 0x41D17B64 },
+    { 0x8E1450F7, 0x29F268B4 }, { 0xCBBE4EE1, 0xFF0DBA97 },
+    { 0x3A83DE21, 0x1DC0632A }, { 0xE0CDCF86, 0xA2B73DF1 },
+    { 0x453C1679, 0x1614F396 }, { 0xDEFBA41C, 0xF872E54C },
+    { 0x613EEE91, 0x9E2993D3 }, { 0xDDAF5114, 0x1E41E9FC },
+    { 0x1F1DD124, 0x6BEBD73C }, { 0xBEDC6BA1, 0x86D8E4D2 },
+    { 0xECA08FFE, 0x63AE91E6 }, { 0x3AE30875, 0x651BD98B },
+    { 0x0CD1526A, 0xF8C9DA7A }, { 0xB1630F04, 0x5BB8F1BC },
+    { 0xFF47317B, 0x945A19C1 }, { 0xD6C3A807, 0xA90FD27A },
+    { 0x9A7781E0, 0xEE8213B7 }, { 0x63D097E9, 0xB3AF077A },
+    { 0x1D31175F, 0x93781DC7 }, { 0x94EB256E, 0x4984D782 },
+    { 0x13184649, 0xCCC4A1B9 }, { 0x4BE7FD90, 0xCA6EF3AC },
+    { 0x7D5C1D64, 0xA2C2D971 }, { 0x80BA859A, 0x234E0B26 },
+    { 0x6EEED1C9, 0x1CAD4452 }, { 0x22C3799F, 0xDD66CBBB },
+    { 0xD8ECC578, 0x74922601 }, { 0xB3A6DA94, 0x4597456A },
+    { 0xCAF933FE, 0xC55F7EAB }, { 0x50BFAADE, 0xE9E28EB4 },
+    { 0x2E7D11A7, 0xA1962329 }, { 0x7D14748F, 0x7B3FF57A },
+    { 0x32D8041C, 0x2D370749 }, { 0x889774E1, 0xC9C8B782 },
+    { 0x6CC8A0FF, 0x397D84A1 }, { 0x5AA1F3CF, 0x3F70CC6F },
+    { 0x8A074012, 0x79113270 }, { 0x33BC58B3, 0x93E106A4 },
+    { 0x9F2B002A, 0xBC817803 }, { 0xBD0BB25F, 0x62EC6C6D },
+    { 0x60BF0A6A, 0x88EB3C07 }, { 0x8515C07F, 0xD813B325 },
+    { 0x3BE3C09B, 0x6E4CB630 }, { 0xD8440525, 0x0DF04680 },
+    { 0x682D085D, 0x71971D5C }, { 0x465A4EEE, 0x2342001E },
+    { 0x28B5DE82, 0xF33B8BC6 }, { 0x077D54E0, 0x0A2A8D7E },
+    { 0x2E5F3C8C, 0x9FB3BBC0 }, { 0xC00DF280, 0x6D9A4957 },
+    { 0xD0A37F43, 0x6EF22B23 }, { 0xA52F58EC, 0xE8B6368B },
+    { 0x00712E86, 0xCE2DF768 }, { 0xD6748E82, 0xD2C3ED1A },
+    { 0x47972100, 0xE53A4FC7 }, { 0x51AEEF66, 0x995A5724 },
+    { 0x71900712, 0xBE60A91A }, { 0x359674F7, 0x9EF68D35 },
+    { 0x647FBD15, 0x1DFA0A15 }, { 0x1BAAA809, 0x0C139B31 },
+    { 0x469AEF86, 0x8EC52396 }, { 0x86D42D06, 0xF2271E60 },
+    { 0x4ABA1470, 0x0E766B11 }, { 0x1C2CCE0A, 0x0B0BF8CA },
+    { 0xAA0CD2D3, 0x475846A4 }, { 0xF8448640, 0x2664FD8B },
+    { 0xAC4FCDEC, 0xB2A3DFA6 }, { 0xE81CF154, 0xED64812D },
+    { 0xC2C7385C, 0xDC1A160C }, { 0x95FFD7DC, 0x02EE03B2 },
+    { 0x91DE6176, 0x79AFDF1C }, { 0x84EE89AC, 0x8604AE0F },
+    { 0x533E308D, 0x07AC6E46 }, { 0x5F0E0438, 0x363BD6B3 },
+    { 0x604D6E09, 0x15F85253 }, { 0xAEB3E622, 0x135C83FD },
+    { 0x4263EB04, 0x1BEC24DD }, { 0x50C2CB16, 0x5FABE670 },
+    { 0x6667AFE7, 0x4C36CD5B }, { 0x1A6889B8, 0x35EC3279 },
+    { 0xDE42C92A, 0xE0A22E29 }, { 0x7F47463D, 0x00BCF5F6 },
+    { 0xB82B6080, 0x7C2B6ED9 }, { 0x828D550B, 0x8AE00689 },
+    { 0xDCA2B4DA, 0x06FF88FD }, { 0x4AC726EB, 0x17F27698 },
+    { 0x529295E6, 0xF7317CF0 }, { 0x5E9F28EB, 0x58CA5F00 },
+    { 0x40C14FFF, 0x61B6E40B }, { 0x96A1F19B, 0xAA7C7AD5 },
+    { 0x997157E1, 0xDE8A97F8 }, { 0xB0ED8196, 0xB5CFCA28 },
+    { 0x097E41E6, 0x88F61445 }, { 0x4CE8BFE5, 0xDED288F8 },
+    { 0xE36841AD, 0xD4520E9E }, { 0xD1A9427C, 0x59F229BC },
+    { 0x93F3319C, 0x0C592BD5 }, { 0xB58AC6FE, 0x6D390DEC },
+    { 0xE3809241, 0x38EDFAF3 }, { 0xF22FD3E2, 0x37170390 },
+    { 0x83C2DF88, 0x72CBFCDB }, { 0xD6B1825A, 0x6353C1CC },
+    { 0x4E4FF232, 0x348331A5 }, { 0x6664D9C1, 0xC4584F5C },
+    { 0x836B5A6E, 0xC3977C19 }, { 0x23D5E7E5, 0xF48642E9 },
+    { 0x65065343, 0xDAFAEA7C }, { 0x1495D20D, 0x531377E2 },
+    { 0xA29C82EB, 0x73DB4C04 }, { 0xF370B37F, 0xDD35BC8D },
+    { 0xEA6DD7DC, 0x72675CE8 }, { 0xE9415BCE, 0xB25B29F2 },
+    { 0x96309B0F, 0x3EC2FF83 }, { 0xC776B648, 0x9A5EDE41 },
+    { 0xC22C52C5, 0xE8C7A017 }, { 0xCECFCD43, 0xA563905D },
+    { 0xD8311EE7, 0xCF4BFAEF }, { 0x24E6FE8F, 0x45CDDF4E },
+    { 0xD0C6D7C9, 0x6BDE1AC7 }, { 0x45AA5D4A, 0xACFA3103 },
+    { 0xCF067065, 0xAE1175C2 }, { 0x82F89C77, 0xA51B6135 }
+};
+
+/// Return the CRC32-C register obtained by processing the
+/// `3 * blockLength` bytes at the specified `data` from the specified
+/// `crc` register, where `blockLength` is the specified `blockLength`.  The
+/// three blocks are processed as independent streams so that the latency of
+/// the `crc32` instruction is hidden, and the stream registers are then
+/// recombined using carry-less multiplication by constants from
+/// `k_CLMUL_COMBINE_TABLE`.  The behavior is undefined unless `blockLength`
+/// is a multiple of 8 in the range `[8 .. 2048]`.  Note that `data` need not
+/// be at an alignment boundary.  See Intel White Paper for details: "Fast
+/// CRC Computation for iSCSI Polynomial Using CRC32 Instruction".
+inline
+unsigned int crc32c3WayClmul(const unsigned char *data,
+                             bsl::size_t          blockLength,
+                             unsigned int         crc)
+{
+    BSLS_ASSERT(data);
+    BSLS_ASSERT(8 <= blockLength && blockLength <= 2048);
+    BSLS_ASSERT(0 == blockLength % 8);
+
+    const unsigned int *k = k_CLMUL_COMBINE_TABLE[blockLength / 8 - 1];
+
+    const unsigned char *a = data;
+    const unsigned char *b = a + blockLength;
+    const unsigned char *c = b + blockLength;
+
+    const unsigned char *const end = b - sizeof(bsls::Types::Uint64);
+
+    bsls::Types::Uint64 c1 = crc, c2 = 0, c3 = 0;
+
+    for (; a < end; a += 8, b += 8, c += 8) {
+        c1 = unalignedBuiltinCrc32di(c1, a);
+        c2 = unalignedBuiltinCrc32di(c2, b);
+        c3 = unalignedBuiltinCrc32di(c3, c);
+    }
+    c1 = unalignedBuiltinCrc32di(c1, a);
+    c2 = unalignedBuiltinCrc32di(c2, b);
+
+    // Shift 'c1' and 'c2' over the blocks that follow them and fold both into
+    // the last word of the third block.
+
+    const __m128i constants = _mm_set_epi64x(k[1], k[0]);
+    const __m128i shifted   = _mm_xor_si128(
+              _mm_clmulepi64_si128(_mm_cvtsi32_si128(static_cast<int>(c1)),
+                                   constants,
+                                   0x00),
+              _mm_clmulepi64_si128(_mm_cvtsi32_si128(static_cast<int>(c2)),
+                                   constants,
+                                   0x10));
+
+    bsls::Types::Uint64 tmp;
+    memcpy(&tmp, c, sizeof(tmp));
+    tmp ^= static_cast<bsls::Types::Uint64>(_mm_cvtsi128_si64(shifted));
+
+    return static_cast<unsigned int>(__builtin_ia32_crc32di(c3, tmp));
+}
+
+/// Calculate the CRC32-C value (using SSE4.2 and PCLMULQDQ intrinsics) for
+/// the specified `data` over the specified `length` number of bytes, using
+/// the specified `crc` value as the starting point for the calculation.
+/// Processing is in three interleaved streams of 2048 bytes, then in three
+/// interleaved streams sized to cover all but at most 23 of the remaining
+/// bytes, which are processed serially.  Note that the `data` is permitted
+/// to be null if the `length` is 0.
+unsigned int crc32cSse64bitClmul(const unsigned char *data,
+                                 bsl::size_t          length,
+                                 unsigned int         crc)
+{
+    BSLS_ASSERT(data || 0 == length);
+
+    enum {
+        k_MAX_BLOCK  = 2048,  // longest stream
+        k_MIN_LENGTH = 96     // shortest input processed in three streams
+    };
+
+    crc = ~crc;
+
+    for (; length >= 3 * k_MAX_BLOCK; length -= 3 * k_MAX_BLOCK) {
+        crc   = crc32c3WayClmul(data, k_MAX_BLOCK, crc);
+        data += 3 * k_MAX_BLOCK;
+    }
+
+    if (length >= k_MIN_LENGTH) {
+        const bsl::size_t blockLength = length / 24 * 8;
+
+        crc     = crc32c3WayClmul(data, blockLength, crc);
+        data   += 3 * blockLength;
+        length -= 3 * blockLength;
+    }
+
+    crc = crc32c8s(data, length, crc);
+
+    return ~crc;
+}
+
+#   endif // BDLDE_CRC32C_PCLMUL_ENABLED
+
 #  endif // BSLS_PLATFORM_CPU_64_BIT
 
 /// Calculate the CRC32-C value (using SSE intrinsic) for the specified
@@ -1222,6 +1479,55 @@ unsigned int crc32cHardwareSerial(const unsigned char *data,
 
 #endif  // BDLDE_CRC32C_SSE4_2_ENABLED
 
+#ifdef BDLDE_CRC32C_ARM_CRC32_ENABLED
+
+/// Return `true` if the running processor supports the ARMv8 CRC32
+/// instructions, and `false` otherwise.
+bool isArmCrc32Supported()
+{
+# if defined(BSLS_PLATFORM_OS_LINUX)
+    return 0 != (::getauxval(AT_HWCAP) & HWCAP_CRC32);
+# else
+    // The instructions are part of the target architecture that the compiler
+    // was instructed to generate code for.
+
+    return true;
+# endif
+}
+
+/// Calculate the CRC32-C value (using the ARMv8 CRC32 instructions) for the
+/// specified `data` over the specified `length` number of bytes, using the
+/// specified `crc` value as the starting point for the calculation.  Note
+/// that the `data` is permitted to be null if the `length` is 0.
+unsigned int crc32cArmHardware(const unsigned char *data,
+                               bsl::size_t          length,
+                               unsigned int         crc)
+{
+    BSLS_ASSERT(data || 0 == length);
+
+    crc = ~crc;
+
+    // Process bytes one at a time until we reach an 8-byte boundary.
+    for (; length && (reinterpret_cast<bsls::Types::UintPtr>(data) & 7);
+         ++data, --length) {
+        crc = __crc32cb(crc, *data);
+    }
+
+    for (; length >= 8; data += 8, length -= 8) {
+        bsls::Types::Uint64 word;
+        memcpy(&word, data, sizeof(word));
+        crc = __crc32cd(crc, word);
+    }
+
+    for (; length; ++data, --length) {
+        crc = __crc32cb(crc, *data);
+    }
+
+    return ~crc;
+}
+
+#endif  // BDLDE_CRC32C_ARM_CRC32_ENABLED
+
                         //-----------------------
                         // class Crc32cCalculator
                         //-----------------------
@@ -1241,7 +1547,19 @@ Crc32cCalculator::Crc32cCalculator()
 
     // Check SSE 4.2 Support for CRC32-C.
     if (ecx & BDLDE_CRC32C_CPUID_SSE4_2_BIT_MASK) {
-# ifdef BSLS_PLATFORM_CPU_64_BIT
+# if defined(BDLDE_CRC32C_PCLMUL_ENABLED)
+        if (ecx & bit_PCLMUL) {
+            BSLS_LOG_INFO("Using hardware version for CRC32-C computation "
+                          "(SSE4.2 and PCLMULQDQ instructions available, "
+                          "64-bit mode)");
+            s_crc32cFn = crc32cSse64bitClmul;
+        }
+        else {
+            BSLS_LOG_INFO("Using hardware version for CRC32-C computation "
+                          "(SSE4.2 instructions available, 64-bit mode)");
+            s_crc32cFn = crc32cSse64bit;
+        }
+# elif defined(BSLS_PLATFORM_CPU_64_BIT)
         BSLS_LOG_INFO("Using hardware version for CRC32-C computation "
                       "(SSE4.2 instructions available, 64-bit mode)");
         s_crc32cFn = crc32cSse64bit;
@@ -1258,6 +1576,23 @@ Crc32cCalculator::Crc32cCalculator()
                       "(SSE4.2 instructions not available)");
         s_crc32cFn = crc32cSoftware;
     }
+#elif defined(BDLDE_CRC32C_ARM_CRC32_ENABLED)
+    // ARMv8 CRC32 intrinsics are available on the target platform and use of
+    // these intrinsics has been enabled.  Note that this is the case when
+    // compiling for AArch64 with Clang or GCC, the "+crc" architecture
+    // extension is enabled (e.g., "-march=armv8-a+crc"), and
+    // 'BDLDE_CRC32C_ENABLE_ARM_CRC32' is defined.
+
+    if (isArmCrc32Supported()) {
+        BSLS_LOG_INFO("Using hardware version for CRC32-C computation "
+                      "(ARMv8 CRC32 instructions available)");
+        s_crc32cFn = crc32cArmHardware;
+    }
+    else {
+        BSLS_LOG_INFO("Using software version for CRC32-C computation "
+                      "(ARMv8 CRC32 instructions not available)");
+        s_crc32cFn = crc32cSoftware;
+    }
 #elif defined(BSLS_PLATFORM_CPU_SPARC) && \
       defined(BDLDE_SUPPORT_SPARC_HARDWARE_OPTIMIZATION)
     // Sparc CRC32-C intrinsics are available on the target platform and use
@@ -1280,9 +1615,11 @@ Crc32cCalculator::Crc32cCalculator()
     //:   does not support the compiler's SSE4.2 intrinsics (if they exist),
     //: 2 the current platform is x86 but does not support SSE4.2,
     //: 3 the current platform is Sparc but the Sparc CRC32-C intrinsics are
-    //:   not enabled, or
-    //: 4 the current platform is any other architecture
-    // Note that #1 is true when compiling with Microsoft Visual Studio, and #4
+    //:   not enabled,
+    //: 4 the current platform is ARM but the ARMv8 CRC32 extension, or its
+    //:   use by this component, is not enabled at compile time, or
+    //: 5 the current platform is any other architecture
+    // Note that #1 is true when compiling with Microsoft Visual Studio, and #5
     // is true when compiling for AIX or PowerPC platforms.
 
     BSLS_LOG_INFO("Using software version for CRC32-C computation "
@@ -35,7 +35,14 @@ BSLS_IDENT("$Id$")
 // on a supported architecture with a compatible compiler.  In addition,
 // runtime checks are performed to detect whether the running platform has the
 // required hardware support:
-// * x86:   SSE4.2 instructions are required
+// * x86:   SSE4.2 instructions are required; in 64-bit builds compiled with
+//   `-mpclmul`, long inputs are additionally split into three interleaved
+//   streams recombined with the `PCLMULQDQ` instruction when it is present
+// * ARM:   `BDLDE_CRC32C_ENABLE_ARM_CRC32` must be defined (the ARM
+//   implementation has not yet been built and tested on ARM hardware), and
+//   the ARMv8 CRC32 extension must be enabled at compile time (e.g.,
+//   `-march=armv8-a+crc`); on Linux its presence is confirmed through
+//   `getauxval`
 // * sparc: runtime check is detected by the `is_sparc_crc32c_avail` system
 //   call
 //
@@ -227,11 +227,12 @@ using namespace bsl;
 // [3] int Crc32c_Impl::calculateSoftware(const void *, size_t, uint);
 // [4] int Crc32c_Impl::calculateSoftware(const void *, size_t, uint);
 // [6] int Crc32c_Impl::calculateSoftware(const void *, size_t, uint);
+// [7] int Crc32c::calculate(const void *, size_t, unsigned int);
 // [2] int Crc32c_Impl::calculateHardwareSerial(const void *, size_t, uint);
 // [3] int Crc32c_Impl::calculateHardwareSerial(const void *, size_t, uint);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
 // [-1] DEFAULT PERFORMANCE TEST
 // [-2] SOFTWARE PERFORMANCE TEST
 // [-3] THROUGPUT DEFAULT & SOFTWARE BENCHMARK
@@ -1317,6 +1318,82 @@ void test6_multithreadedCrc32cSoftware()
     }
 }
 
+void test7_calculateOnLongBuffer()
+    // ------------------------------------------------------------------------
+    // CALCULATE CRC32-C ON LONG BUFFER
+    //
+    // Concerns:
+    // 1. Long buffers, which the hardware-accelerated implementation may
+    //    split into interleaved streams that are recombined at the end, yield
+    //    the same CRC32-C as the software implementation, whatever their
+    //    length and alignment.
+    //
+    // 2. The recombination honors a previous CRC passed as the starting
+    //    point.
+    //
+    // Plan:
+    // 1. For every length up to 2000 bytes, and for lengths on either side of
+    //    multiples of the 768 and 6144 byte blocks up to 20000 bytes, compute
+    //    the CRC32-C of a pseudo-random buffer at each offset in `[0 .. 8)`
+    //    with `calculate` and with `calculateSoftware`, and verify that they
+    //    are equal.  (C-1)
+    //
+    // 2. Repeat P-1 passing a non-zero previous CRC.  (C-2)
+    //
+    // Testing:
+    //   bdlde::Crc32c::calculate(const void *, size_t, unsigned int);
+    // ------------------------------------------------------------------------
+{
+    if (verbose) bsl::cout << bsl::endl
+                           << "CALCULATE CRC32-C ON LONG BUFFER" << bsl::endl
+                           << "================================" << bsl::endl;
+
+    enum { k_MAX_LENGTH = 20000, k_MAX_OFFSET = 8 };
+
+    bsl::vector<char> buffer(k_MAX_LENGTH + k_MAX_OFFSET);
+
+    unsigned int seed = 54321;
+    for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+        seed      = seed * 1103515245 + 12345;
+        buffer[i] = static_cast<char>(seed >> 16);
+    }
+
+    bsl::vector<bsl::size_t> lengths;
+    for (bsl::size_t length = 0; length < 2000; ++length) {
+        lengths.push_back(length);
+    }
+    for (bsl::size_t block = 768; block < k_MAX_LENGTH; block += 768) {
+        lengths.push_back(block - 1);
+        lengths.push_back(block);
+        lengths.push_back(block + 9);
+    }
+    for (bsl::size_t block = 6144; block < k_MAX_LENGTH; block += 6144) {
+        lengths.push_back(block - 8);
+        lengths.push_back(block + 1);
+        lengths.push_back(block + 768 + 3);
+    }
+    lengths.push_back(k_MAX_LENGTH);
+
+    static const unsigned int PREVIOUS[] = { 0, 0xDEADBEEF };
+
+    for (bsl::size_t pi = 0; pi < sizeof PREVIOUS / sizeof *PREVIOUS; ++pi) {
+        const unsigned int PREV = PREVIOUS[pi];
+
+        for (bsl::size_t offset = 0; offset < k_MAX_OFFSET; ++offset) {
+            for (bsl::size_t li = 0; li < lengths.size(); ++li) {
+                const bsl::size_t  LENGTH = lengths[li];
+                const char        *DATA   = buffer.data() + offset;
+
+                const unsigned int EXP =
+                         Crc32c_Impl::calculateSoftware(DATA, LENGTH, PREV);
+
+                LOOP4_ASSERT(PREV, offset, LENGTH, EXP,
+                             EXP == Crc32c::calculate(DATA, LENGTH, PREV));
+            }
+        }
+    }
+}
+
 // ============================================================================
 //                              PERFORMANCE TESTS
 // ----------------------------------------------------------------------------
@@ -1870,7 +1947,7 @@ int main(int argc, char* argv[])
     bsls::Log::setSeverityThreshold(bsls::LogSeverity::e_INFO);
 
     switch(test) { case 0:
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE 1
         //
@@ -1913,6 +1990,9 @@ int main(int argc, char* argv[])
                                             checksum);
 // ```
       } break;
+      case  7: {
+        test7_calculateOnLongBuffer();
+      } break;
       case  6: {
         test6_multithreadedCrc32cSoftware();
       } break;
@@ -77,6 +77,7 @@ using namespace bsl;  // automatically added by script
 // [ 4] bsls::Types::Uint64 checksumAndReset();
 // [13] void reset();
 // [11] void update(const void *data, int length);
+// [15] void update(const void *data, int length);
 //
 // ACCESSORS
 // [10] STREAM& bdexStreamOut(STREAM& stream, int version) const;
@@ -89,10 +90,11 @@ using namespace bsl;  // automatically added by script
 // [ 5] bsl::ostream& operator<<(bsl::ostream&, const bdlde::Crc64&);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [15] USAGE EXAMPLE
+// [16] USAGE EXAMPLE
 // [ 2] BOOTSTRAP: void update(const void *data, int length);
 // [14] CRC_TABLE TEST
 // [-1] PERFORMANCE TEST
+// [-2] THROUGHPUT TEST
 //
 // [ 3] int ggg(bdlde::Crc64 *object, const char *spec, int vF = 1);
 // [ 3] bdlde::Crc64& gg(bdlde::Crc64 *object, const char *spec);
@@ -486,7 +488,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 16: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -516,6 +518,86 @@ int main(int argc, char *argv[])
 
         receiverExample(in);
 
+      } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING `update` ON LONG INPUT
+        //   Where the platform supports carry-less multiplication, inputs of
+        //   64 bytes or more are folded 16 bytes at a time before the
+        //   remainder is run through the table.
+        //
+        // Concerns:
+        // 1. The checksum of an input of any length, at any alignment, is the
+        //    same as that computed one byte at a time by the table-driven
+        //    oracle.
+        //
+        // 2. The checksum does not depend on how the input is divided among
+        //    calls to `update`.
+        //
+        // Plan:
+        // 1. For every length in `[0 .. 1100)` and every offset in
+        //    `[0 .. 16)` into a pseudo-random buffer, compare the checksum of
+        //    an object updated once with the value returned by `crc`.  (C-1)
+        //
+        // 2. For a selection of lengths, divide the input into two `update`
+        //    calls at each of a set of positions, and compare the checksum
+        //    with that returned by `crc`.  (C-2)
+        //
+        // Testing:
+        //   void update(const void *data, int length);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING `update` ON LONG INPUT"
+                          << "\n==============================" << endl;
+
+        enum { k_MAX_LENGTH = 1100, k_MAX_OFFSET = 16 };
+
+        char buffer[k_MAX_LENGTH + k_MAX_OFFSET];
+
+        unsigned int seed = 12345;
+        for (int i = 0; i < k_MAX_LENGTH + k_MAX_OFFSET; ++i) {
+            seed      = seed * 1103515245 + 12345;
+            buffer[i] = static_cast<char>(seed >> 16);
+        }
+
+        if (verbose) cout << "\tCompare with the oracle." << endl;
+
+        for (int offset = 0; offset < k_MAX_OFFSET; ++offset) {
+            for (int length = 0; length < k_MAX_LENGTH; ++length) {
+                const char *DATA = buffer + offset;
+
+                Obj mX;  const Obj& X = mX;
+                mX.update(DATA, length);
+
+                LOOP2_ASSERT(offset,
+                             length,
+                             crc(DATA, length) == X.checksum());
+            }
+        }
+
+        if (verbose) cout << "\tDivide the input between two calls." << endl;
+
+        static const int LENGTHS[] = {
+            64, 65, 127, 128, 200, 511, 1024, 1099
+        };
+        const int NUM_LENGTHS = static_cast<int>(sizeof LENGTHS
+                                                 / sizeof *LENGTHS);
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int  LENGTH = LENGTHS[ti];
+            const char *DATA  = buffer + ti;
+
+            const bsls::Types::Uint64 EXP = crc(DATA, LENGTH);
+
+            for (int split = 0; split <= LENGTH; split += 7) {
+                Obj mX;  const Obj& X = mX;
+                mX.update(DATA, split);
+                mX.update(DATA + split, LENGTH - split);
+
+                LOOP2_ASSERT(LENGTH, split, EXP == X.checksum());
+            }
+        }
+
       } break;
       case 14: {
         // --------------------------------------------------------------------
@@ -2660,6 +2742,73 @@ int main(int argc, char *argv[])
                       << bsl::endl;
         }
 
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // THROUGHPUT TEST
+        //
+        // Concerns:
+        // 1. Report the throughput of `update` on long inputs, where it may
+        //    use carry-less multiplication, relative to the byte-at-a-time
+        //    oracle.
+        //
+        // Plan:
+        // 1. Time repeated calls to `update` and to `crc` on buffers of
+        //    several sizes and report the throughput of each in MB/s.  (C-1)
+        //
+        // Testing:
+        //   THROUGHPUT TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTHROUGHPUT TEST"
+                          << "\n===============" << endl;
+
+        enum { k_TOTAL_BYTES = 256 * 1024 * 1024 };
+
+        static const int SIZES[] = { 64, 256, 1024, 16 * 1024, 1024 * 1024 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        bsl::vector<char> buffer(SIZES[NUM_SIZES - 1]);
+        for (bsl::size_t i = 0; i < buffer.size(); ++i) {
+            buffer[i] = static_cast<char>(i * 7 + (i >> 8));
+        }
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int SIZE       = SIZES[ti];
+            const int ITERATIONS = k_TOTAL_BYTES / SIZE;
+
+            Obj mX;  const Obj& X = mX;
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < ITERATIONS; ++i) {
+                mX.update(buffer.data(), SIZE);
+            }
+            timer.stop();
+            const double updateTime = timer.elapsedTime();
+
+            bsls::Types::Uint64 oracle = 0;
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < ITERATIONS / 8; ++i) {
+                oracle = update_crc(oracle, buffer.data(), SIZE);
+            }
+            timer.stop();
+            const double oracleTime = timer.elapsedTime() * 8;
+
+            if (veryVerbose) {
+                P_(X.checksum());  P(oracle);
+            }
+
+            cout << "size = " << SIZE
+                 << "\tupdate: "
+                 << k_TOTAL_BYTES / updateTime / (1024 * 1024) << " MB/s"
+                 << "\toracle: "
+                 << k_TOTAL_BYTES / oracleTime / (1024 * 1024) << " MB/s"
+                 << endl;
+        }
+
       } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
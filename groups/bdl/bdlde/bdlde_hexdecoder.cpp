@@ -5,6 +5,8 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_hexdecoder_cpp,"$Id$ $CSID$")
 
+#include <bsl_algorithm.h>
+
 namespace {
 namespace u {
 
@@ -163,6 +165,29 @@ HexDecoder::HexDecoder()
 {
 }
 
+// PRIVATE MANIPULATORS
+int HexDecoder::decodePairs(char       **out,
+                            const char **begin,
+                            const char  *end,
+                            int          maxNumOut)
+{
+    BSLS_ASSERT(e_INPUT_STATE == d_state);
+    BSLS_ASSERT(0 == d_firstDigit);
+
+    bsl::ptrdiff_t length = end - *begin;
+    if (0 <= maxNumOut) {
+        length = bsl::min<bsl::ptrdiff_t>(length, 2 * maxNumOut);
+    }
+
+    const bsl::size_t numConsumed = BulkCodecUtil::decodeHex(*out,
+                                                             *begin,
+                                                             length);
+
+    *begin += numConsumed;
+    *out   += numConsumed / 2;
+    return static_cast<int>(numConsumed);
+}
+
 // MANIPULATORS
 int HexDecoder::endConvert()
 {
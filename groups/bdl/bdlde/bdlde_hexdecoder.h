@@ -263,6 +263,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlscm_version.h>
 
+#include <bdlde_bulkcodecutil.h>
+
 #include <bsls_assert.h>
 
 #include <bsl_iterator.h>
@@ -299,6 +301,32 @@ class HexDecoder {
     /// `false` otherwise.
     static bool isXdigit(char character);
 
+    // PRIVATE MANIPULATORS
+
+    /// Decode, using `BulkCodecUtil`, the longest run of complete pairs of
+    /// hex digits starting at the specified `*begin` and ending no later
+    /// than the specified `end` to the specified `*out`, writing no more
+    /// than the specified `maxNumOut` bytes (no limit if `maxNumOut` is
+    /// negative).  Advance `*begin` and `*out` past the characters consumed
+    /// and the bytes written, and return the number of characters consumed.
+    int decodePairs(char **out, const char **begin, const char *end,
+                    int maxNumOut);
+    template <class OUTPUT_ITERATOR>
+    int decodePairs(OUTPUT_ITERATOR  *out,
+                    const char      **begin,
+                    const char       *end,
+                    int               maxNumOut);
+    template <class OUTPUT_ITERATOR>
+    int decodePairs(OUTPUT_ITERATOR  *out,
+                    char            **begin,
+                    char             *end,
+                    int               maxNumOut);
+
+    /// Return 0.  Note that input sequences that are not contiguous arrays
+    /// of `char` are decoded a character at a time by `convert`.
+    template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
+    int decodePairs(OUTPUT_ITERATOR *, INPUT_ITERATOR *, INPUT_ITERATOR, int);
+
     // NOT IMPLEMENTED
     HexDecoder(const HexDecoder&);
     HexDecoder& operator=(const HexDecoder&);
@@ -428,6 +456,69 @@ bool HexDecoder::isXdigit(char character)
     return k_XDIGIT_TABLE[static_cast<unsigned char>(character)];
 }
 
+// PRIVATE MANIPULATORS
+template <class OUTPUT_ITERATOR>
+int HexDecoder::decodePairs(OUTPUT_ITERATOR  *out,
+                            const char      **begin,
+                            const char       *end,
+                            int               maxNumOut)
+{
+    // Decode into a local buffer and copy the result to 'out'.
+
+    enum { k_BUFFER_SIZE = 512 };
+
+    char buffer[k_BUFFER_SIZE];
+    int  numConsumed = 0;
+
+    while (true) {
+        const int limit = 0 <= maxNumOut && maxNumOut < k_BUFFER_SIZE
+                          ? maxNumOut
+                          : k_BUFFER_SIZE;
+
+        char      *cursor = buffer;
+        const int  numIn  = decodePairs(&cursor, begin, end, limit);
+        if (0 == numIn) {
+            break;                                                     // BREAK
+        }
+        numConsumed += numIn;
+
+        for (const char *p = buffer; p != cursor; ++p) {
+            **out = *p;
+            ++*out;
+        }
+
+        if (0 <= maxNumOut) {
+            maxNumOut -= static_cast<int>(cursor - buffer);
+        }
+    }
+
+    return numConsumed;
+}
+
+template <class OUTPUT_ITERATOR>
+inline
+int HexDecoder::decodePairs(OUTPUT_ITERATOR  *out,
+                            char            **begin,
+                            char             *end,
+                            int               maxNumOut)
+{
+    const char *cursor      = *begin;
+    const int   numConsumed = decodePairs(out, &cursor, end, maxNumOut);
+
+    *begin += numConsumed;
+    return numConsumed;
+}
+
+template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
+inline
+int HexDecoder::decodePairs(OUTPUT_ITERATOR *,
+                            INPUT_ITERATOR  *,
+                            INPUT_ITERATOR,
+                            int)
+{
+    return 0;
+}
+
 // MANIPULATORS
 template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
 int HexDecoder::convert(OUTPUT_ITERATOR out,
@@ -468,11 +559,27 @@ int HexDecoder::convert(OUTPUT_ITERATOR  out,
     INPUT_ITERATOR originalBegin = begin;
     int            numEmitted = 0;
 
+    if (0 == d_firstDigit) {
+        numEmitted += decodePairs(&out, &begin, end, maxNumOut) / 2;
+    }
+
     while (begin != end && numEmitted != maxNumOut) {
         const char digit = static_cast<char>(*begin);
         ++begin;
 
-        if (!isSpace(digit)) {
+        if (isSpace(digit)) {
+            if (0 == d_firstDigit) {
+                // Resume decoding in bulk after the whitespace.
+
+                numEmitted += decodePairs(&out,
+                                          &begin,
+                                          end,
+                                          0 <= maxNumOut
+                                          ? maxNumOut - numEmitted
+                                          : -1) / 2;
+            }
+        }
+        else {
             if (!isXdigit(digit)) {
                 *numOut = numEmitted;
                 d_outputLength += numEmitted;
@@ -46,7 +46,8 @@ using namespace bsl;
 // [ 4] bool isMaximal() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 6] USAGE EXAMPLE
+// [ 6] CONCERN: contiguous input is decoded in bulk.
+// [ 7] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -275,6 +276,47 @@ void decode(char *output, const char *input, bsl::size_t inputSize)
     }
 }
 
+/// Decode the sequence `[begin, end)` using the specified `object` by
+/// calling `convert` until all input is consumed, followed by `endConvert`,
+/// writing to the specified `out` and passing the specified `maxNumOut` to
+/// each call to `convert`.  Append the status, `numOut`, and `numIn` results
+/// of each call to `convert`, and the status of `endConvert`, to the
+/// specified `trace`.  Stop after the first call returning a negative
+/// status.
+template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
+void convertInChunks(bsl::vector<int> *trace,
+                     Obj              *object,
+                     OUTPUT_ITERATOR   out,
+                     INPUT_ITERATOR    begin,
+                     INPUT_ITERATOR    end,
+                     int               maxNumOut)
+{
+    while (begin != end) {
+        int numOut = -1;
+        int numIn  = -1;
+
+        const int rc = object->convert(out,
+                                       &numOut,
+                                       &numIn,
+                                       begin,
+                                       end,
+                                       maxNumOut);
+        trace->push_back(rc);
+        trace->push_back(numOut);
+        trace->push_back(numIn);
+        if (rc < 0 || (0 == numOut && 0 == numIn)) {
+            return;                                                   // RETURN
+        }
+
+        for (int i = 0; i < numOut; ++i) {
+            ++out;
+        }
+        bsl::advance(begin, numIn);
+    }
+
+    trace->push_back(object->endConvert());
+}
+
 //=============================================================================
 //                              USAGE EXAMPLE
 //-----------------------------------------------------------------------------
@@ -481,7 +523,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 6: {
+      case 7: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -523,6 +565,167 @@ int main(int argc, char *argv[])
     ASSERT(0 == strcmp(BLOOMBERG_NEWS, backInStream.str().c_str()));
 // ```
       } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING BULK DECODING OF CONTIGUOUS INPUT
+        //   `convert` decodes runs of complete pairs of hex digits supplied as
+        //   a range of `char` pointers in bulk (see `bdlde_bulkcodecutil`),
+        //   and all other input a character at a time.
+        //
+        // Concerns:
+        // 1. Decoding valid contiguous input yields the original data, and
+        //    decoding any contiguous input in chunks limited by `maxNumOut`
+        //    yields the same output as decoding it with no limit.
+        //
+        // 2. Bulk decoding resumes correctly after whitespace, including
+        //    whitespace separating the two digits of a byte, and stops at
+        //    invalid characters.
+        //
+        // 3. A `maxNumOut` limit is observed.
+        //
+        // 4. Contiguous input is decoded in bulk regardless of the type of
+        //    the output iterator.
+        //
+        // Plan:
+        // 1. For pseudo-random inputs of a variety of lengths, encode the
+        //    input in mixed case, and optionally inject whitespace, an invalid
+        //    character, or a trailing unpaired digit.  For each `maxNumOut`
+        //    from a table, decode the result, supplied as a range of
+        //    `const char *`, by a sequence of calls to `convert` followed by
+        //    `endConvert`, with both `char *` and back-insert iterator
+        //    output.  Verify that the sequences of results are identical,
+        //    that the outputs are those obtained with no `maxNumOut` limit,
+        //    and that valid input yields the original data.  Note that
+        //    `bdlde_bulkcodecutil` verifies that contiguous input is decoded
+        //    exactly as the same input supplied through non-contiguous
+        //    iterators.  (C-1..4)
+        //
+        // Testing:
+        //   CONCERN: contiguous input is decoded in bulk.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BULK DECODING OF CONTIGUOUS INPUT"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        const int LENGTHS[] = { 0, 1, 2, 15, 16, 17, 31, 32, 33, 255, 256,
+                                257, 1000 };
+        enum { NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS };
+
+        const int MAX_NUM_OUTS[] = { -1, 1, 2, 3, 7, 64, 513 };
+        enum { NUM_MAX_NUM_OUTS = sizeof MAX_NUM_OUTS / sizeof *MAX_NUM_OUTS };
+
+        const char DIGITS[] = "0123456789abcdefABCDEF";
+        const char SPACES[] = " \t\n\v\f\r";
+
+        unsigned seed = 12345;
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+        for (int ii = 0; ii < 4; ++ii) {
+            const int  LENGTH     = LENGTHS[ti];
+            const bool WHITESPACE = 1 == ii;
+            const bool INVALID    = 2 == ii;
+            const bool UNPAIRED   = 3 == ii;
+
+            bsl::string input;
+            bsl::string plain;
+            for (int i = 0; i < 2 * LENGTH; ++i) {
+                seed = seed * 1103515245 + 12345;
+
+                const int index = static_cast<int>((seed >> 16) % 22);
+                const int digit = index < 16 ? index : index - 6;
+
+                input.push_back(DIGITS[index]);
+                if (i % 2) {
+                    plain.back() = static_cast<char>(16 * plain.back()
+                                                     + digit);
+                }
+                else {
+                    plain.push_back(static_cast<char>(digit));
+                }
+            }
+            if (WHITESPACE) {
+                for (int i = 0; i <= LENGTH / 8; ++i) {
+                    seed = seed * 1103515245 + 12345;
+                    input.insert((seed >> 16) % (input.length() + 1),
+                                 1,
+                                 SPACES[(seed >> 8) % 6]);
+                }
+            }
+            if (INVALID) {
+                seed = seed * 1103515245 + 12345;
+                input.insert((seed >> 16) % (input.length() + 1), 1, 'g');
+            }
+            if (UNPAIRED) {
+                input.push_back('7');
+            }
+
+            const char *const BEGIN = input.data();
+            const char *const END   = BEGIN + input.length();
+
+            for (int mi = 0; mi < NUM_MAX_NUM_OUTS; ++mi) {
+                const int MAX_NUM_OUT = MAX_NUM_OUTS[mi];
+
+                if (veryVerbose) {
+                    T_ P_(LENGTH) P_(ii) P(MAX_NUM_OUT)
+                }
+
+                bsl::vector<int>  unlimitedTrace;
+                bsl::vector<char> expected(LENGTH + 1, '?');
+                {
+                    Obj mX;
+                    convertInChunks(&unlimitedTrace,
+                                    &mX,
+                                    &expected[0],
+                                    BEGIN,
+                                    END,
+                                    -1);
+                }
+
+                bsl::vector<int>  expTrace;
+                bsl::vector<char> result(LENGTH + 1, '?');
+                {
+                    Obj mX;
+                    convertInChunks(&expTrace,
+                                    &mX,
+                                    &result[0],
+                                    BEGIN,
+                                    END,
+                                    MAX_NUM_OUT);
+                    if (!INVALID && !UNPAIRED) {
+                        ASSERTV(LENGTH, ii, MAX_NUM_OUT,
+                                LENGTH == mX.outputLength());
+                        ASSERTV(LENGTH, ii, MAX_NUM_OUT,
+                                bsl::equal(plain.begin(),
+                                           plain.end(),
+                                           result.begin()));
+                    }
+                }
+                ASSERTV(LENGTH, ii, MAX_NUM_OUT, expected == result);
+
+                bsl::vector<int> appendedTrace;
+                bsl::string      appended;
+                {
+                    Obj mX;
+                    convertInChunks(&appendedTrace,
+                                    &mX,
+                                    bsl::back_inserter(appended),
+                                    BEGIN,
+                                    END,
+                                    MAX_NUM_OUT);
+                }
+                ASSERTV(LENGTH, ii, MAX_NUM_OUT, expTrace == appendedTrace);
+                ASSERTV(LENGTH, ii, MAX_NUM_OUT,
+                        appended.length() <= bsl::size_t(LENGTH) &&
+                        bsl::equal(appended.begin(),
+                                   appended.end(),
+                                   expected.begin()));
+            }
+        }
+        }
+      } break;
       case 5: {
         // --------------------------------------------------------------------
         // TESTING `reset`
@@ -4,6 +4,8 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_hexencoder_cpp,"$Id$ $CSID$")
 
+#include <bsl_algorithm.h>
+
 namespace {
 namespace u {
                 // ======================
@@ -71,6 +73,27 @@ HexEncoder::HexEncoder(bool upperCaseLetters)
 {
 }
 
+// PRIVATE MANIPULATORS
+int HexEncoder::encodeBytes(char       **out,
+                            const char **begin,
+                            const char  *end,
+                            int          maxNumOut)
+{
+    BSLS_ASSERT(e_INPUT_STATE == d_state);
+    BSLS_ASSERT(0 == d_deferred);
+
+    bsl::ptrdiff_t numBytes = end - *begin;
+    if (0 <= maxNumOut) {
+        numBytes = bsl::min<bsl::ptrdiff_t>(numBytes, maxNumOut / 2);
+    }
+
+    BulkCodecUtil::encodeHex(*out, *begin, numBytes, d_upperCaseFlag);
+
+    *begin += numBytes;
+    *out   += 2 * numBytes;
+    return static_cast<int>(numBytes);
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -287,6 +287,8 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlscm_version.h>
 
+#include <bdlde_bulkcodecutil.h>
+
 #include <bsls_assert.h>
 
 namespace BloombergLP {
@@ -321,6 +323,32 @@ class HexEncoder {
 
     const char *d_encodeTable_p;  // hexadecimal alphabet
 
+    // PRIVATE MANIPULATORS
+
+    /// Encode, using `BulkCodecUtil`, the bytes of the input sequence from
+    /// the specified `*begin` up to, but not including, the specified `end`
+    /// to the specified `*out`, writing no more than the specified
+    /// `maxNumOut` characters (no limit if `maxNumOut` is negative).
+    /// Advance `*begin` and `*out` past the bytes consumed and the
+    /// characters written, and return the number of bytes consumed.  Note
+    /// that a byte is consumed only if both of its digits are written.
+    int encodeBytes(char **out, const char **begin, const char *end,
+                    int maxNumOut);
+    template <class OUTPUT_ITERATOR>
+    int encodeBytes(OUTPUT_ITERATOR  *out,
+                    const char      **begin,
+                    const char       *end,
+                    int               maxNumOut);
+    template <class OUTPUT_ITERATOR>
+    int encodeBytes(OUTPUT_ITERATOR  *out,
+                    char            **begin,
+                    char             *end,
+                    int               maxNumOut);
+
+    /// Return 0.  Note that input sequences that are not contiguous arrays
+    /// of `char` are encoded a byte at a time by `convert`.
+    template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
+    int encodeBytes(OUTPUT_ITERATOR *, INPUT_ITERATOR *, INPUT_ITERATOR, int);
 
     // NOT IMPLEMENTED
     HexEncoder(const HexEncoder&);
@@ -439,6 +467,69 @@ class HexEncoder {
 //                             INLINE DEFINITIONS
 // ============================================================================
 
+// PRIVATE MANIPULATORS
+template <class OUTPUT_ITERATOR>
+int HexEncoder::encodeBytes(OUTPUT_ITERATOR  *out,
+                            const char      **begin,
+                            const char       *end,
+                            int               maxNumOut)
+{
+    // Encode into a local buffer and copy the result to 'out'.
+
+    enum { k_BUFFER_SIZE = 512 };
+
+    char buffer[k_BUFFER_SIZE];
+    int  numConsumed = 0;
+
+    while (true) {
+        const int limit = 0 <= maxNumOut && maxNumOut < k_BUFFER_SIZE
+                          ? maxNumOut
+                          : k_BUFFER_SIZE;
+
+        char      *cursor = buffer;
+        const int  numIn  = encodeBytes(&cursor, begin, end, limit);
+        if (0 == numIn) {
+            break;                                                     // BREAK
+        }
+        numConsumed += numIn;
+
+        for (const char *p = buffer; p != cursor; ++p) {
+            **out = *p;
+            ++*out;
+        }
+
+        if (0 <= maxNumOut) {
+            maxNumOut -= static_cast<int>(cursor - buffer);
+        }
+    }
+
+    return numConsumed;
+}
+
+template <class OUTPUT_ITERATOR>
+inline
+int HexEncoder::encodeBytes(OUTPUT_ITERATOR  *out,
+                            char            **begin,
+                            char             *end,
+                            int               maxNumOut)
+{
+    const char *cursor      = *begin;
+    const int   numConsumed = encodeBytes(out, &cursor, end, maxNumOut);
+
+    *begin += numConsumed;
+    return numConsumed;
+}
+
+template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
+inline
+int HexEncoder::encodeBytes(OUTPUT_ITERATOR *,
+                            INPUT_ITERATOR  *,
+                            INPUT_ITERATOR,
+                            int)
+{
+    return 0;
+}
+
 // MANIPULATORS
 template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
 int HexEncoder::convert(OUTPUT_ITERATOR out,
@@ -488,7 +579,15 @@ int HexEncoder::convert(OUTPUT_ITERATOR  out,
         d_deferred = 0;
     }
 
-    // Then we can handle new input.
+    // Then we can handle new input, encoding as much as possible in bulk.
+
+    const int numEncoded = encodeBytes(&out,
+                                       &begin,
+                                       end,
+                                       0 <= maxNumOut ? maxNumOut - numEmitted
+                                                      : -1);
+    numConsumed += numEncoded;
+    numEmitted  += 2 * numEncoded;
 
     while (begin != end && numEmitted != maxNumOut) {
         if (d_deferred) {
@@ -47,7 +47,8 @@ using namespace bsl;
 // [ 4] bool isAcceptable() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 6] USAGE EXAMPLE
+// [ 6] CONCERN: contiguous input is encoded in bulk.
+// [ 7] USAGE EXAMPLE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -220,6 +221,56 @@ const char *BLOOMBERG_NEWS =
 "To contact the writer of this column: Chet Currier in New York \n"
 "(1) (212) 318-2605 or ccurrier@bloomberg.net.";
 
+// ============================================================================
+//                           TEST HELPER FUNCTIONS
+// ----------------------------------------------------------------------------
+
+/// Encode the sequence `[begin, end)` using the specified `object` by
+/// calling `convert` until all input is consumed, followed by `endConvert`
+/// until no output remains, writing to the specified `out` and passing the
+/// specified `maxNumOut` to each call.  Append the status, `numOut`, and
+/// (for `convert`) `numIn` results of each call to the specified `trace`.
+template <class OUTPUT_ITERATOR, class INPUT_ITERATOR>
+void convertInChunks(bsl::vector<int> *trace,
+                     Obj              *object,
+                     OUTPUT_ITERATOR   out,
+                     INPUT_ITERATOR    begin,
+                     INPUT_ITERATOR    end,
+                     int               maxNumOut)
+{
+    int rc;
+    while (begin != end) {
+        int numOut = -1;
+        int numIn  = -1;
+
+        rc = object->convert(out, &numOut, &numIn, begin, end, maxNumOut);
+        trace->push_back(rc);
+        trace->push_back(numOut);
+        trace->push_back(numIn);
+        if (rc < 0 || (0 == numOut && 0 == numIn)) {
+            return;                                                   // RETURN
+        }
+
+        for (int i = 0; i < numOut; ++i) {
+            ++out;
+        }
+        bsl::advance(begin, numIn);
+    }
+
+    int numOut;
+    do {
+        numOut = -1;
+
+        rc = object->endConvert(out, &numOut, maxNumOut);
+        trace->push_back(rc);
+        trace->push_back(numOut);
+
+        for (int i = 0; i < numOut; ++i) {
+            ++out;
+        }
+    } while (0 < rc && 0 < numOut);
+}
+
 //=============================================================================
 //                              USAGE EXAMPLE
 //-----------------------------------------------------------------------------
@@ -360,7 +411,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 6: {
+      case 7: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -408,6 +459,119 @@ int main(int argc, char *argv[])
 // This example does *not* decode the resulting hexidecimal text, for a
 // more complete example, see `bdlde_hexdecoder`.
       } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING BULK ENCODING OF CONTIGUOUS INPUT
+        //   `convert` encodes input supplied as a range of `char` pointers in
+        //   bulk (see `bdlde_bulkcodecutil`), and all other input a byte at a
+        //   time.
+        //
+        // Concerns:
+        // 1. Encoding contiguous input yields the hexadecimal digits of each
+        //    byte, in either case.
+        //
+        // 2. A `maxNumOut` limit falling between the two digits of a byte is
+        //    observed.
+        //
+        // 3. Contiguous input is encoded in bulk regardless of the type of
+        //    the output iterator.
+        //
+        // Plan:
+        // 1. For pseudo-random inputs of a variety of lengths, and for each
+        //    case and `maxNumOut` from a table, encode the input, supplied as
+        //    a range of `const char *`, by a sequence of calls to `convert`
+        //    followed by `endConvert`, with both `char *` and back-insert
+        //    iterator output.  Verify that the sequences of results are
+        //    identical, and that the outputs are the digits of the input
+        //    computed by the test driver.  Note that `bdlde_bulkcodecutil`
+        //    verifies that contiguous input is encoded exactly as the same
+        //    input supplied through non-contiguous iterators.  (C-1..3)
+        //
+        // Testing:
+        //   CONCERN: contiguous input is encoded in bulk.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BULK ENCODING OF CONTIGUOUS INPUT"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        const int LENGTHS[] = { 0, 1, 2, 15, 16, 17, 31, 32, 33, 255, 256,
+                                257, 1000 };
+        enum { NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS };
+
+        const int MAX_NUM_OUTS[] = { -1, 1, 2, 3, 7, 64, 513 };
+        enum { NUM_MAX_NUM_OUTS = sizeof MAX_NUM_OUTS / sizeof *MAX_NUM_OUTS };
+
+        unsigned seed = 12345;
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int LENGTH = LENGTHS[ti];
+
+            bsl::string input;
+            for (int i = 0; i < LENGTH; ++i) {
+                seed = seed * 1103515245 + 12345;
+                input.push_back(static_cast<char>(seed >> 16));
+            }
+            const char *const BEGIN = input.data();
+            const char *const END   = BEGIN + LENGTH;
+
+            for (int ui = 0; ui < 2; ++ui) {
+            for (int mi = 0; mi < NUM_MAX_NUM_OUTS; ++mi) {
+                const bool UPPER_CASE  = ui;
+                const int  MAX_NUM_OUT = MAX_NUM_OUTS[mi];
+
+                const char *const DIGITS = UPPER_CASE ? "0123456789ABCDEF"
+                                                      : "0123456789abcdef";
+
+                bsl::string expected;
+                for (int i = 0; i < LENGTH; ++i) {
+                    const unsigned char byte =
+                                          static_cast<unsigned char>(input[i]);
+                    expected.push_back(DIGITS[byte >> 4]);
+                    expected.push_back(DIGITS[byte & 0x0f]);
+                }
+
+                if (veryVerbose) {
+                    T_ P_(LENGTH) P_(UPPER_CASE) P(MAX_NUM_OUT)
+                }
+
+                bsl::vector<int>  expTrace;
+                bsl::vector<char> result(2 * LENGTH + 1, '?');
+                {
+                    Obj mX(UPPER_CASE);
+                    convertInChunks(&expTrace,
+                                    &mX,
+                                    &result[0],
+                                    BEGIN,
+                                    END,
+                                    MAX_NUM_OUT);
+                    ASSERTV(LENGTH, MAX_NUM_OUT, 2 * LENGTH ==
+                                                            mX.outputLength());
+                }
+                ASSERTV(LENGTH, MAX_NUM_OUT,
+                        expected == bsl::string(result.begin(),
+                                                result.begin() + 2 * LENGTH));
+                ASSERTV(LENGTH, MAX_NUM_OUT, '?' == result[2 * LENGTH]);
+
+                bsl::vector<int> appendedTrace;
+                bsl::string      appended;
+                {
+                    Obj mX(UPPER_CASE);
+                    convertInChunks(&appendedTrace,
+                                    &mX,
+                                    bsl::back_inserter(appended),
+                                    BEGIN,
+                                    END,
+                                    MAX_NUM_OUT);
+                }
+                ASSERTV(LENGTH, MAX_NUM_OUT, expTrace == appendedTrace);
+                ASSERTV(LENGTH, MAX_NUM_OUT, expected == appended);
+            }
+            }
+        }
+      } break;
       case 5: {
         // --------------------------------------------------------------------
         // TESTING `reset`
@@ -4,12 +4,55 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_sha1_cpp,"$Id$ $CSID$")
 
+#include <bslmf_assert.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_climits.h>
 #include <bsl_iterator.h>
 #include <bsl_ostream.h>
 #include <bsl_type_traits.h>
-#include <bslmf_assert.h>
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#include <cpuid.h>
+#include <immintrin.h>
+#define BDLDE_SHA1_X86_ENABLED 1
+#define BDLDE_SHA1_SHANI_TARGET __attribute__((target("sha,sse4.1")))
+#define BDLDE_SHA1_AVX2_TARGET  __attribute__((target("avx2")))
+#endif
+
+#if defined(BDLDE_SHA1_ENABLE_ARM_SHA)                                        \
+ && defined(BSLS_PLATFORM_CPU_ARM)                                            \
+ && defined(BSLS_PLATFORM_CPU_64_BIT)                                         \
+ && defined(__ARM_FEATURE_SHA2)                                               \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#include <arm_neon.h>
+# if defined(BSLS_PLATFORM_OS_LINUX)
+#  include <sys/auxv.h>
+#  ifndef HWCAP_SHA1
+#   define HWCAP_SHA1 (1 << 5)
+#  endif
+# endif
+#define BDLDE_SHA1_ARM_SHA1_ENABLED 1
+#endif
+
+///Implementation Notes
+///--------------------
+// Blocks are compressed with the x86 SHA extensions (SHA-NI) or the ARMv8
+// cryptographic extensions when the processor on which the program is running
+// supports them, which is detected once at run-time, and otherwise by the
+// portable `transformPortable`.  All paths produce identical results.
+//
+// `Sha1::loadDigests` hashes several independent messages at once.  On x86
+// processors supporting AVX2 but not the SHA extensions, messages are
+// assigned to the eight 32-bit lanes of 256-bit registers, which are advanced
+// one block at a time by the same instructions; as each message completes,
+// its lane is refilled with the next pending message.  (A single stream of
+// SHA extension instructions is faster than eight AVX2 lanes, so processors
+// having both hash the messages one at a time.)
 
 namespace BloombergLP {
 namespace bdlde {
@@ -28,6 +71,12 @@ typedef Sha1Word      Sha1State[5];
 /// `Sha1::k_BLOCK_SIZE`.
 const bsl::size_t k_SHA1_BLOCK_SIZE = 512 / 8;
 
+/// The initial state of the SHA-1 algorithm, defined in section 5.3.1 of
+/// FIPS 180-4.
+const Sha1State k_SHA1_INITIAL_STATE = {
+    0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0
+};
+
 const Sha1Word k_SHA1_CONSTANTS[80] = {
     // The SHA-1 constants defined in section 4.2.1 of FIPS 180-4.
     0x5a827999, 0x5a827999, 0x5a827999, 0x5a827999, 0x5a827999,
@@ -149,9 +198,9 @@ void toHex(char *output, const unsigned char (&input)[Sha1::k_DIGEST_SIZE])
 /// Update the specified `state` with the hashed contents of the specified
 /// `message` having a length equal to the specified `numMessageBlocks`
 /// times `k_SHA1_BLOCK_SIZE`.
-void transform(Sha1State           *state,
-               const unsigned char *message,
-               bsl::uint64_t        numMessageBlocks)
+void transformPortable(Sha1State           *state,
+                       const unsigned char *message,
+                       bsl::uint64_t        numMessageBlocks)
 {
     const unsigned char *messageEnd =
         message + k_SHA1_BLOCK_SIZE * numMessageBlocks;
@@ -191,6 +240,404 @@ void transform(Sha1State           *state,
     }
 }
 
+#if defined(BDLDE_SHA1_X86_ENABLED)
+
+                            // ================
+                            // x86 SHA Routines
+                            // ================
+
+/// Return `true` if the processor on which this program is running supports
+/// the SHA extensions, and `false` otherwise.  Note that every processor
+/// implementing the SHA extensions also implements SSE4.1, which the SHA-NI
+/// routines below use.
+bool isShaNiSupported()
+{
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid_max(0, 0) < 7) {
+        return false;                                                 // RETURN
+    }
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    return 0 != (ebx & bit_SHA);
+}
+
+/// Return the result of `isShaNiSupported`, computed once.
+bool hasShaNi()
+{
+    static const bool result = isShaNiSupported();
+    return result;
+}
+
+/// Perform the four SHA-1 rounds numbered `4 * GROUP` through
+/// `4 * GROUP + 3` on the specified `abcd`, using the specified `e` (which
+/// holds the working variable "E" of the first of those rounds) and storing
+/// into the specified `nextE` the value from which the "E" of the next
+/// group is derived, after loading (for the first four groups) the
+/// corresponding message words from the specified `message` into the
+/// appropriate element of the specified `schedule`, which holds the message
+/// words of the four most recent groups, and advancing the computation of
+/// the later words.
+template <int GROUP>
+BDLDE_SHA1_SHANI_TARGET inline
+void roundsShaNi(__m128i             *abcd,
+                 __m128i             *e,
+                 __m128i             *nextE,
+                 __m128i             *schedule,
+                 const unsigned char *message)
+{
+    __m128i& words = schedule[GROUP & 3];
+    if (GROUP < 4) {
+        const __m128i byteSwap = _mm_set_epi64x(0x0001020304050607ULL,
+                                                0x08090a0b0c0d0e0fULL);
+        words = _mm_shuffle_epi8(
+              _mm_loadu_si128(reinterpret_cast<const __m128i *>(message) +
+                              GROUP),
+              byteSwap);
+    }
+
+    *e     = 0 == GROUP ? _mm_add_epi32(*e, words)
+                        : _mm_sha1nexte_epu32(*e, words);
+    *nextE = *abcd;
+    if (3 <= GROUP && GROUP <= 18) {
+        __m128i& next = schedule[(GROUP + 1) & 3];
+        next = _mm_sha1msg2_epu32(next, words);
+    }
+    *abcd = _mm_sha1rnds4_epu32(*abcd, *e, GROUP / 5);
+    if (1 <= GROUP && GROUP <= 16) {
+        __m128i& previous = schedule[(GROUP - 1) & 3];
+        previous = _mm_sha1msg1_epu32(previous, words);
+    }
+    if (2 <= GROUP && GROUP <= 17) {
+        __m128i& afterNext = schedule[(GROUP + 2) & 3];
+        afterNext = _mm_xor_si128(afterNext, words);
+    }
+}
+
+/// Update the specified `state` with the hashed contents of the specified
+/// `message` having a length equal to the specified `numMessageBlocks`
+/// times `k_SHA1_BLOCK_SIZE`, using the SHA extensions.
+BDLDE_SHA1_SHANI_TARGET
+void transformShaNi(Sha1State           *state,
+                    const unsigned char *message,
+                    bsl::uint64_t        numMessageBlocks)
+{
+    // The 'sha1rnds4' instruction expects "A" in the most significant
+    // element, and "E" alone in the most significant element of another
+    // vector.
+
+    __m128i abcd = _mm_shuffle_epi32(
+                   _mm_loadu_si128(reinterpret_cast<const __m128i *>(*state)),
+                   0x1b);
+    __m128i e0   = _mm_set_epi32(static_cast<int>((*state)[4]), 0, 0, 0);
+
+    for (; numMessageBlocks; --numMessageBlocks, message += k_SHA1_BLOCK_SIZE)
+    {
+        const __m128i abcdSaved = abcd;
+        const __m128i e0Saved   = e0;
+        __m128i       e1;
+
+        __m128i schedule[4];
+        roundsShaNi< 0>(&abcd, &e0, &e1, schedule, message);
+        roundsShaNi< 1>(&abcd, &e1, &e0, schedule, message);
+        roundsShaNi< 2>(&abcd, &e0, &e1, schedule, message);
+        roundsShaNi< 3>(&abcd, &e1, &e0, schedule, message);
+        roundsShaNi< 4>(&abcd, &e0, &e1, schedule, message);
+        roundsShaNi< 5>(&abcd, &e1, &e0, schedule, message);
+        roundsShaNi< 6>(&abcd, &e0, &e1, schedule, message);
+        roundsShaNi< 7>(&abcd, &e1, &e0, schedule, message);
+        roundsShaNi< 8>(&abcd, &e0, &e1, schedule, message);
+        roundsShaNi< 9>(&abcd, &e1, &e0, schedule, message);
+        roundsShaNi<10>(&abcd, &e0, &e1, schedule, message);
+        roundsShaNi<11>(&abcd, &e1, &e0, schedule, message);
+        roundsShaNi<12>(&abcd, &e0, &e1, schedule, message);
+        roundsShaNi<13>(&abcd, &e1, &e0, schedule, message);
+        roundsShaNi<14>(&abcd, &e0, &e1, schedule, message);
+        roundsShaNi<15>(&abcd, &e1, &e0, schedule, message);
+        roundsShaNi<16>(&abcd, &e0, &e1, schedule, message);
+        roundsShaNi<17>(&abcd, &e1, &e0, schedule, message);
+        roundsShaNi<18>(&abcd, &e0, &e1, schedule, message);
+        roundsShaNi<19>(&abcd, &e1, &e0, schedule, message);
+
+        e0   = _mm_sha1nexte_epu32(e0, e0Saved);
+        abcd = _mm_add_epi32(abcd, abcdSaved);
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(*state),
+                     _mm_shuffle_epi32(abcd, 0x1b));
+    (*state)[4] = static_cast<Sha1Word>(_mm_extract_epi32(e0, 3));
+}
+
+                            // ==================
+                            // AVX2 Lane Routines
+                            // ==================
+
+/// Return `true` if the processor on which this program is running, and the
+/// operating system, support AVX2 instructions, and `false` otherwise.
+bool isAvx2Supported()
+{
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)
+     || bit_OSXSAVE != (ecx & bit_OSXSAVE)
+     || bit_AVX     != (ecx & bit_AVX)) {
+        return false;                                                 // RETURN
+    }
+
+    unsigned int xcr0Lo, xcr0Hi;
+    __asm__ __volatile__("xgetbv" : "=a"(xcr0Lo), "=d"(xcr0Hi) : "c"(0));
+    if (6 != (xcr0Lo & 6)) {
+        // The operating system does not preserve the YMM registers.
+
+        return false;                                                 // RETURN
+    }
+
+    if (__get_cpuid_max(0, 0) < 7) {
+        return false;                                                 // RETURN
+    }
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    return 0 != (ebx & bit_AVX2);
+}
+
+/// Return the result of `isAvx2Supported`, computed once.
+bool hasAvx2()
+{
+    static const bool result = isAvx2Supported();
+    return result;
+}
+
+/// The number of messages hashed together by `transformLanes`.
+const int k_NUM_LANES = 8;
+
+/// Return the specified `x` rotated left by `SHIFT` bits in each lane.
+template <int SHIFT>
+BDLDE_SHA1_AVX2_TARGET inline
+__m256i rotateLeftLanes(__m256i x)
+{
+    return _mm256_or_si256(_mm256_slli_epi32(x, SHIFT),
+                           _mm256_srli_epi32(x, 32 - SHIFT));
+}
+
+/// Update the specified `state`, holding word `i` of the state of each lane
+/// in `state[i]`, with the hashed contents of the specified
+/// `numMessageBlocks` consecutive blocks beginning at each of the specified
+/// `blocks`.
+BDLDE_SHA1_AVX2_TARGET
+void transformLanes(Sha1Word                  (*state)[k_NUM_LANES],
+                    const unsigned char *const *blocks,
+                    bsl::uint64_t               numMessageBlocks)
+{
+    const __m256i byteSwap = _mm256_setr_epi8(
+                                      3,  2,  1,  0,  7,  6,  5,  4,
+                                     11, 10,  9,  8, 15, 14, 13, 12,
+                                      3,  2,  1,  0,  7,  6,  5,  4,
+                                     11, 10,  9,  8, 15, 14, 13, 12);
+
+    __m256i s[5];
+    for (int index = 0; index < 5; ++index) {
+        const Sha1Word *column = state[index];
+        s[index] = _mm256_loadu_si256(
+                                   reinterpret_cast<const __m256i *>(column));
+    }
+
+    for (bsl::uint64_t offset = 0;
+         offset != numMessageBlocks * k_SHA1_BLOCK_SIZE;
+         offset += k_SHA1_BLOCK_SIZE) {
+        // Load the message words, transposing each 8x8 matrix of words so
+        // that 'w[i]' holds word 'i' of every lane.
+
+        __m256i w[16];
+        for (int half = 0; half < 2; ++half) {
+            __m256i r[k_NUM_LANES];
+            for (int lane = 0; lane < k_NUM_LANES; ++lane) {
+                r[lane] = _mm256_shuffle_epi8(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i *>(
+                                         blocks[lane] + offset + 32 * half)),
+                    byteSwap);
+            }
+
+            __m256i t[8];
+            for (int i = 0; i < 8; i += 2) {
+                t[i]     = _mm256_unpacklo_epi32(r[i], r[i + 1]);
+                t[i + 1] = _mm256_unpackhi_epi32(r[i], r[i + 1]);
+            }
+            __m256i u[8];
+            for (int i = 0; i < 8; i += 4) {
+                u[i]     = _mm256_unpacklo_epi64(t[i],     t[i + 2]);
+                u[i + 1] = _mm256_unpackhi_epi64(t[i],     t[i + 2]);
+                u[i + 2] = _mm256_unpacklo_epi64(t[i + 1], t[i + 3]);
+                u[i + 3] = _mm256_unpackhi_epi64(t[i + 1], t[i + 3]);
+            }
+            __m256i *out = w + 8 * half;
+            for (int i = 0; i < 4; ++i) {
+                out[i]     = _mm256_permute2x128_si256(u[i], u[i + 4], 0x20);
+                out[i + 4] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x31);
+            }
+        }
+
+        __m256i wv[5];
+        bsl::copy(s, s + 5, wv);
+        for (int index = 0; index != 80; ++index) {
+            if (index >= 16) {
+                w[index & 15] = rotateLeftLanes<1>(
+                    _mm256_xor_si256(
+                        _mm256_xor_si256(w[(index - 3) & 15],
+                                         w[(index - 8) & 15]),
+                        _mm256_xor_si256(w[(index - 14) & 15],
+                                         w[index & 15])));
+            }
+
+            __m256i f;
+            if (index <= 19) {
+                f = _mm256_xor_si256(
+                          _mm256_and_si256(wv[1],
+                                           _mm256_xor_si256(wv[2], wv[3])),
+                          wv[3]);
+            }
+            else if (index >= 40 && index <= 59) {
+                f = _mm256_or_si256(
+                          _mm256_and_si256(wv[1], wv[2]),
+                          _mm256_and_si256(_mm256_or_si256(wv[1], wv[2]),
+                                           wv[3]));
+            }
+            else {
+                f = _mm256_xor_si256(_mm256_xor_si256(wv[1], wv[2]), wv[3]);
+            }
+
+            const __m256i t = _mm256_add_epi32(
+                _mm256_add_epi32(_mm256_add_epi32(rotateLeftLanes<5>(wv[0]),
+                                                  f),
+                                 wv[4]),
+                _mm256_add_epi32(
+                    _mm256_set1_epi32(
+                                 static_cast<int>(k_SHA1_CONSTANTS[index])),
+                    w[index & 15]));
+            wv[4] = wv[3];
+            wv[3] = wv[2];
+            wv[2] = rotateLeftLanes<30>(wv[1]);
+            wv[1] = wv[0];
+            wv[0] = t;
+        }
+
+        for (int index = 0; index < 5; ++index) {
+            s[index] = _mm256_add_epi32(s[index], wv[index]);
+        }
+    }
+
+    for (int index = 0; index < 5; ++index) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(state[index]),
+                            s[index]);
+    }
+}
+
+#endif  // BDLDE_SHA1_X86_ENABLED
+
+#if defined(BDLDE_SHA1_ARM_SHA1_ENABLED)
+
+                            // ================
+                            // ARM SHA Routines
+                            // ================
+
+/// Return `true` if the running processor supports the ARMv8 SHA-1
+/// instructions, and `false` otherwise.
+bool isArmSha1Supported()
+{
+# if defined(BSLS_PLATFORM_OS_LINUX)
+    return 0 != (::getauxval(AT_HWCAP) & HWCAP_SHA1);
+# else
+    // The instructions are part of the target architecture that the compiler
+    // was instructed to generate code for.
+
+    return true;
+# endif
+}
+
+/// Return the result of `isArmSha1Supported`, computed once.
+bool hasArmSha1()
+{
+    static const bool result = isArmSha1Supported();
+    return result;
+}
+
+/// Update the specified `state` with the hashed contents of the specified
+/// `message` having a length equal to the specified `numMessageBlocks`
+/// times `k_SHA1_BLOCK_SIZE`, using the ARMv8 SHA-1 instructions.
+void transformArmSha1(Sha1State           *state,
+                      const unsigned char *message,
+                      bsl::uint64_t        numMessageBlocks)
+{
+    uint32x4_t abcd = vld1q_u32(*state);
+    Sha1Word   e    = (*state)[4];
+
+    for (; numMessageBlocks; --numMessageBlocks, message += k_SHA1_BLOCK_SIZE)
+    {
+        const uint32x4_t abcdSaved = abcd;
+        const Sha1Word   eSaved    = e;
+
+        uint32x4_t w[4];
+        for (int index = 0; index < 4; ++index) {
+            w[index] = vreinterpretq_u32_u8(
+                                   vrev32q_u8(vld1q_u8(message + 16 * index)));
+        }
+
+        for (int group = 0; group < 20; ++group) {
+            uint32x4_t& words = w[group & 3];
+
+            const uint32x4_t k     = vaddq_u32(
+                               words,
+                               vdupq_n_u32(k_SHA1_CONSTANTS[4 * group]));
+            const Sha1Word   nextE = vsha1h_u32(vgetq_lane_u32(abcd, 0));
+            if (group < 5) {
+                abcd = vsha1cq_u32(abcd, e, k);
+            }
+            else if (group >= 10 && group < 15) {
+                abcd = vsha1mq_u32(abcd, e, k);
+            }
+            else {
+                abcd = vsha1pq_u32(abcd, e, k);
+            }
+            e = nextE;
+
+            if (group < 16) {
+                // Compute the words of group 'group + 4' in place.
+
+                words = vsha1su1q_u32(vsha1su0q_u32(words,
+                                                    w[(group + 1) & 3],
+                                                    w[(group + 2) & 3]),
+                                      w[(group + 3) & 3]);
+            }
+        }
+
+        abcd  = vaddq_u32(abcd, abcdSaved);
+        e    += eSaved;
+    }
+
+    vst1q_u32(*state, abcd);
+    (*state)[4] = e;
+}
+
+#endif  // BDLDE_SHA1_ARM_SHA1_ENABLED
+
+/// Update the specified `state` with the hashed contents of the specified
+/// `message` having a length equal to the specified `numMessageBlocks`
+/// times `k_SHA1_BLOCK_SIZE`, using the SHA instructions of the processor if
+/// available.
+void transform(Sha1State           *state,
+               const unsigned char *message,
+               bsl::uint64_t        numMessageBlocks)
+{
+#if defined(BDLDE_SHA1_X86_ENABLED)
+    if (hasShaNi()) {
+        transformShaNi(state, message, numMessageBlocks);
+        return;                                                       // RETURN
+    }
+#endif
+#if defined(BDLDE_SHA1_ARM_SHA1_ENABLED)
+    if (hasArmSha1()) {
+        transformArmSha1(state, message, numMessageBlocks);
+        return;                                                       // RETURN
+    }
+#endif
+    transformPortable(state, message, numMessageBlocks);
+}
+
 /// Update the specified `state` with the contents of the specified `buffer`
 /// followed by the contents of the specified `message` having the specified
 /// `messageSize` in bytes.  Update the specified `totalSize` to have the
@@ -232,14 +679,17 @@ void updateImpl(Sha1State           *state,
     bsl::copy(epilogue, epilogue + *bufferSize, *buffer);
 }
 
-/// Mix into the specified `state` the remaining contents of the specified
-/// `buffer` as indicated by the specified `bufferSize` followed by a
-/// sequence of padding bytes computed from the specified `totalSize` using
-/// the formula specified by section 5.1.1 of FIPS 180-4.
-void finalize(Sha1State            *state,
-              bsl::uint64_t         totalSize,
-              bsl::uint64_t         bufferSize,
-              const unsigned char (&buffer)[k_SHA1_BLOCK_SIZE])
+/// Load into the specified `finalBlocks` the specified `bufferSize` bytes at
+/// the specified `buffer`, which are the last bytes of a message having the
+/// specified `totalSize`, followed by a sequence of padding bytes computed
+/// using the formula specified by section 5.1.1 of FIPS 180-4, and return
+/// the number (1 or 2) of blocks so loaded.  The behavior is undefined
+/// unless `bufferSize < k_SHA1_BLOCK_SIZE`.
+bsl::uint64_t padFinalBlocks(
+                      unsigned char      (*finalBlocks)[k_SHA1_BLOCK_SIZE * 2],
+                      const unsigned char *buffer,
+                      bsl::uint64_t        bufferSize,
+                      bsl::uint64_t        totalSize)
 {
     const bsl::uint64_t totalSizeInBits = totalSize * 8;
     const bsl::uint64_t unpaddedSize = bufferSize + 1 + sizeof(bsl::uint64_t);
@@ -249,14 +699,226 @@ void finalize(Sha1State            *state,
     // At the end of the message, we write a special marker byte, followed by
     // the total size of the message.  Insert '0' bytes between those to pad
     // the message to a multiple of k_SHA1_BLOCK_SIZE.
-    unsigned char finalBlocks[k_SHA1_BLOCK_SIZE * 2] = {};
-    bsl::copy(buffer, buffer + bufferSize, finalBlocks);
-    finalBlocks[bufferSize] = 1 << 7;
-    unsigned char *end = finalBlocks + remainingBlocks * k_SHA1_BLOCK_SIZE;
+    bsl::fill(bsl::begin(*finalBlocks), bsl::end(*finalBlocks), 0);
+    bsl::copy(buffer, buffer + bufferSize, *finalBlocks);
+    (*finalBlocks)[bufferSize] = 1 << 7;
+    unsigned char *end = *finalBlocks + remainingBlocks * k_SHA1_BLOCK_SIZE;
     unpack(end - sizeof(totalSizeInBits), totalSizeInBits);
+    return remainingBlocks;
+}
+
+/// Mix into the specified `state` the remaining contents of the specified
+/// `buffer` as indicated by the specified `bufferSize` followed by a
+/// sequence of padding bytes computed from the specified `totalSize` using
+/// the formula specified by section 5.1.1 of FIPS 180-4.
+void finalize(Sha1State            *state,
+              bsl::uint64_t         totalSize,
+              bsl::uint64_t         bufferSize,
+              const unsigned char (&buffer)[k_SHA1_BLOCK_SIZE])
+{
+    unsigned char       finalBlocks[k_SHA1_BLOCK_SIZE * 2];
+    const bsl::uint64_t remainingBlocks = padFinalBlocks(&finalBlocks,
+                                                         buffer,
+                                                         bufferSize,
+                                                         totalSize);
     transform(state, finalBlocks, remainingBlocks);
 }
 
+/// Store into the specified `result` the digest of the specified `message`
+/// having the specified `length`.
+void hashMessage(unsigned char       *result,
+                 const unsigned char *message,
+                 bsl::uint64_t        length)
+{
+    Sha1State state;
+    bsl::copy(bsl::begin(k_SHA1_INITIAL_STATE),
+              bsl::end(k_SHA1_INITIAL_STATE),
+              bsl::begin(state));
+
+    const bsl::uint64_t numBlocks = length / k_SHA1_BLOCK_SIZE;
+    transform(&state, message, numBlocks);
+
+    const unsigned char *tail     = message + numBlocks * k_SHA1_BLOCK_SIZE;
+    const bsl::uint64_t  tailSize = length % k_SHA1_BLOCK_SIZE;
+    unsigned char        buffer[k_SHA1_BLOCK_SIZE];
+    bsl::copy(tail, tail + tailSize, buffer);
+    finalize(&state, length, tailSize, buffer);
+    unpackArray(result, state);
+}
+
+#if defined(BDLDE_SHA1_X86_ENABLED)
+
+/// This `struct` describes the progress of the hashing of one message
+/// assigned to a lane by `loadDigestsLanes`.  The message's complete blocks
+/// are hashed in place, followed by its final, padded, blocks, which are
+/// prepared in `d_finalBlocks` when the message is assigned.
+struct LaneProgress {
+
+    // DATA
+    const unsigned char *d_next_p;         // next block to hash
+
+    bsl::uint64_t        d_numBlocks;      // number of blocks at 'd_next_p'
+
+    bsl::uint64_t        d_numFinalBlocks; // number of padded blocks not yet
+                                           // reached, or 0 if 'd_next_p'
+                                           // refers to them
+
+    bsl::size_t          d_messageIndex;   // index of the message
+
+    unsigned char        d_finalBlocks[k_SHA1_BLOCK_SIZE * 2];
+                                           // final, padded, blocks
+};
+
+/// Assign to the specified `lane` the message having the specified
+/// `messageIndex` in the specified `messages` and `lengths`.
+void assignLane(LaneProgress      *lane,
+                const void *const *messages,
+                const bsl::size_t *lengths,
+                bsl::size_t        messageIndex)
+{
+    const unsigned char *message = static_cast<const unsigned char *>(
+                                                       messages[messageIndex]);
+    const bsl::uint64_t  length    = lengths[messageIndex];
+    const bsl::uint64_t  numBlocks = length / k_SHA1_BLOCK_SIZE;
+
+    lane->d_messageIndex   = messageIndex;
+    lane->d_numFinalBlocks = padFinalBlocks(
+                                     &lane->d_finalBlocks,
+                                     message + numBlocks * k_SHA1_BLOCK_SIZE,
+                                     length % k_SHA1_BLOCK_SIZE,
+                                     length);
+    if (numBlocks) {
+        lane->d_next_p    = message;
+        lane->d_numBlocks = numBlocks;
+    }
+    else {
+        lane->d_next_p         = lane->d_finalBlocks;
+        lane->d_numBlocks      = lane->d_numFinalBlocks;
+        lane->d_numFinalBlocks = 0;
+    }
+}
+
+/// Store into the specified `results`, at offset `Sha1::k_DIGEST_SIZE`
+/// times the index of each message, the digest of each of the specified
+/// `numMessages` messages whose addresses and lengths are given by the
+/// specified `messages` and `lengths`, hashing them in the lanes of
+/// `transformLanes`.  The behavior is undefined unless the processor
+/// supports AVX2.
+void loadDigestsLanes(unsigned char     *results,
+                      const void *const *messages,
+                      const bsl::size_t *lengths,
+                      bsl::size_t        numMessages)
+{
+    // Once no messages remain to be assigned, the messages in at most this
+    // many active lanes are completed one at a time.
+
+    const bsl::size_t k_MAX_LANES_TO_FINISH_SINGLY = k_NUM_LANES / 4;
+
+    LaneProgress lanes[k_NUM_LANES];
+    bool         isActive[k_NUM_LANES];
+    Sha1Word     state[5][k_NUM_LANES];
+
+    bsl::size_t nextMessage = 0;
+    bsl::size_t numActive   = 0;
+    for (int lane = 0; lane < k_NUM_LANES; ++lane) {
+        for (int index = 0; index < 5; ++index) {
+            state[index][lane] = k_SHA1_INITIAL_STATE[index];
+        }
+        isActive[lane] = nextMessage < numMessages;
+        if (isActive[lane]) {
+            assignLane(&lanes[lane], messages, lengths, nextMessage);
+            ++nextMessage;
+            ++numActive;
+        }
+    }
+
+    while (numMessages != nextMessage
+        || numActive > k_MAX_LANES_TO_FINISH_SINGLY) {
+        // Advance every active lane by the number of blocks available to all
+        // of them.  Idle lanes hash the blocks of an active lane, and their
+        // results are ignored.
+
+        const unsigned char *blocks[k_NUM_LANES];
+        bsl::uint64_t        numBlocks   = ~0ULL;
+        int                  firstActive = -1;
+        for (int lane = 0; lane < k_NUM_LANES; ++lane) {
+            if (isActive[lane]) {
+                if (firstActive < 0) {
+                    firstActive = lane;
+                }
+                numBlocks = bsl::min(numBlocks, lanes[lane].d_numBlocks);
+            }
+        }
+        for (int lane = 0; lane < k_NUM_LANES; ++lane) {
+            blocks[lane] = lanes[isActive[lane] ? lane : firstActive].d_next_p;
+        }
+
+        transformLanes(state, blocks, numBlocks);
+
+        for (int lane = 0; lane < k_NUM_LANES; ++lane) {
+            if (!isActive[lane]) {
+                continue;                                           // CONTINUE
+            }
+            LaneProgress& progress = lanes[lane];
+            progress.d_next_p    += numBlocks * k_SHA1_BLOCK_SIZE;
+            progress.d_numBlocks -= numBlocks;
+            if (progress.d_numBlocks) {
+                continue;                                           // CONTINUE
+            }
+            if (progress.d_numFinalBlocks) {
+                progress.d_next_p         = progress.d_finalBlocks;
+                progress.d_numBlocks      = progress.d_numFinalBlocks;
+                progress.d_numFinalBlocks = 0;
+                continue;                                           // CONTINUE
+            }
+
+            // The message is complete.
+
+            Sha1State laneState;
+            for (int index = 0; index < 5; ++index) {
+                laneState[index] = state[index][lane];
+            }
+            unpackArray(
+                      results + progress.d_messageIndex * Sha1::k_DIGEST_SIZE,
+                      laneState);
+
+            if (nextMessage != numMessages) {
+                for (int index = 0; index < 5; ++index) {
+                    state[index][lane] = k_SHA1_INITIAL_STATE[index];
+                }
+                assignLane(&progress, messages, lengths, nextMessage);
+                ++nextMessage;
+            }
+            else {
+                isActive[lane] = false;
+                --numActive;
+            }
+        }
+    }
+
+    // Complete the remaining messages one at a time.
+
+    for (int lane = 0; lane < k_NUM_LANES; ++lane) {
+        if (!isActive[lane]) {
+            continue;                                               // CONTINUE
+        }
+        const LaneProgress& progress = lanes[lane];
+
+        Sha1State laneState;
+        for (int index = 0; index < 5; ++index) {
+            laneState[index] = state[index][lane];
+        }
+        transform(&laneState, progress.d_next_p, progress.d_numBlocks);
+        transform(&laneState,
+                  progress.d_finalBlocks,
+                  progress.d_numFinalBlocks);
+        unpackArray(results + progress.d_messageIndex * Sha1::k_DIGEST_SIZE,
+                    laneState);
+    }
+}
+
+#endif  // BDLDE_SHA1_X86_ENABLED
+
 }  // close unnamed namespace
 
                                  // ----------
@@ -267,6 +929,30 @@ void finalize(Sha1State            *state,
 const bsl::size_t Sha1::k_BLOCK_SIZE;
 const bsl::size_t Sha1::k_DIGEST_SIZE;
 
+// CLASS METHODS
+void Sha1::loadDigests(unsigned char     *results,
+                       const void *const *messages,
+                       const bsl::size_t *lengths,
+                       bsl::size_t        numMessages)
+{
+    BSLS_ASSERT(results  || 0 == numMessages);
+    BSLS_ASSERT(messages || 0 == numMessages);
+    BSLS_ASSERT(lengths  || 0 == numMessages);
+
+#if defined(BDLDE_SHA1_X86_ENABLED)
+    if (numMessages > 1 && hasAvx2() && !hasShaNi()) {
+        loadDigestsLanes(results, messages, lengths, numMessages);
+        return;                                                       // RETURN
+    }
+#endif
+
+    for (bsl::size_t index = 0; index != numMessages; ++index) {
+        hashMessage(results + index * k_DIGEST_SIZE,
+                    static_cast<const unsigned char *>(messages[index]),
+                    lengths[index]);
+    }
+}
+
 // CREATORS
 Sha1::Sha1()
 {
@@ -301,11 +987,9 @@ void Sha1::reset()
 {
     d_totalSize = 0;
     d_bufferSize = 0;
-    d_state[0] = 0x67452301;
-    d_state[1] = 0xefcdab89;
-    d_state[2] = 0x98badcfe;
-    d_state[3] = 0x10325476;
-    d_state[4] = 0xc3d2e1f0;
+    bsl::copy(bsl::begin(k_SHA1_INITIAL_STATE),
+              bsl::end(k_SHA1_INITIAL_STATE),
+              bsl::begin(d_state));
 }
 
 void Sha1::update(const void *data, bsl::size_t length)
@@ -41,6 +41,23 @@ BSLS_IDENT("$Id$ $CSID$")
 // considerations, and the availability of SHA-2 and SHA-3 as alternatives,
 // there is no justification for using SHA-1 unless you absolutely have to.
 //
+///Hashing Many Messages
+///---------------------
+// The class method `Sha1::loadDigests` computes the digests of several
+// independent, complete, messages in a single call.  The results are
+// identical to those obtained by hashing each message with a separate object,
+// but on x86 processors supporting AVX2 (and not the SHA extensions) the
+// messages are hashed eight at a time in the lanes of vector registers.
+//
+///Hardware Acceleration
+///---------------------
+// The x86 SHA extensions, or the ARMv8 SHA-1 instructions, are used when the
+// processor on which the program is running supports them, which is detected
+// once at run-time; otherwise, a portable implementation is used.  All
+// implementations produce identical results.  The ARMv8 implementation is
+// compiled only if `BDLDE_SHA1_ENABLE_ARM_SHA` is defined, since it has not
+// yet been built and tested on ARM hardware.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -156,6 +173,23 @@ class Sha1 {
     /// The size (in bytes) of the output
     static const bsl::size_t k_DIGEST_SIZE = 160 / 8;
 
+    // CLASS METHODS
+
+    /// Load into the specified `results` the SHA-1 digests of the specified
+    /// `numMessages` messages whose addresses and lengths, in bytes, are the
+    /// corresponding elements of the specified `messages` and `lengths`
+    /// arrays, storing the digest of message `i` at `results + i *
+    /// k_DIGEST_SIZE`.  Each digest is identical to the one computed by a
+    /// `Sha1` object to which only the corresponding message has been
+    /// supplied.  The behavior is undefined unless `results` refers to at
+    /// least `numMessages * k_DIGEST_SIZE` bytes, and, for each `i` in
+    /// `[0 .. numMessages)`, `messages[i]` refers to at least `lengths[i]`
+    /// bytes (`messages[i]` may be null if `0 == lengths[i]`).
+    static void loadDigests(unsigned char     *results,
+                            const void *const *messages,
+                            const bsl::size_t *lengths,
+                            bsl::size_t        numMessages);
+
     // CREATORS
 
     /// Construct a SHA-1 digest having the value corresponding to no data
@@ -5,6 +5,7 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
@@ -14,6 +15,7 @@
 #include <bsl_iterator.h>
 #include <bsl_string.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -71,6 +73,9 @@ using namespace bsl;
 //    o `void loadDigest(unsigned char *result) const;`
 //
 //-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 7] void loadDigests(uchar *, const void *const *, const size_t *, n);
+//
 // CREATORS
 // [ 2] Sha1::Sha1();
 // [ 5] Sha1::Sha1(const void *data, bsl::size_t length);
@@ -90,7 +95,8 @@ using namespace bsl;
 // [ 6] bsl::ostream& operator<<(bsl::ostream&, const Sha1&);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE EXAMPLE
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: loadDigests
 // [ *] CONCERN: This test driver is reusable w/other, similar components.
 // [ *] CONCERN: In no case does memory come from the global allocator.
 
@@ -522,6 +528,87 @@ void testTwoArgumentConstructor(const char *message)
     ASSERT(digest1 == digest2);
 }
 
+/// Verify that `bdlde::Sha1::loadDigests` produces, for batches of various
+/// sizes of messages having various lengths and alignments, the same digests
+/// as hashing each message with a separate `bdlde::Sha1` object, and that it
+/// writes nothing beyond the digests.
+void testLoadDigests()
+{
+    const bsl::size_t k_DIGEST_SIZE  = bdlde::Sha1::k_DIGEST_SIZE;
+    const bsl::size_t k_MAX_MESSAGES = 20;
+    const bsl::size_t k_MAX_LENGTH   = 600;
+
+    // Lengths around the block boundaries, to be mixed with pseudo-random
+    // lengths.
+
+    const bsl::size_t k_EDGE_LENGTHS[] = {
+        0, 1, 55, 56, 63, 64, 65, 119, 120, 127, 128, 129
+    };
+    const bsl::size_t k_NUM_EDGE_LENGTHS = sizeof  k_EDGE_LENGTHS
+                                         / sizeof *k_EDGE_LENGTHS;
+
+    bsl::vector<unsigned char> data(k_MAX_LENGTH + 8);
+    for (bsl::size_t index = 0; index != data.size(); ++index) {
+        data[index] = static_cast<unsigned char>(index * 7 + index / 256);
+    }
+
+    unsigned int seed = 12345;
+    for (bsl::size_t numMessages = 0;
+         numMessages <= k_MAX_MESSAGES;
+         ++numMessages) {
+        for (int trial = 0; trial < 10; ++trial) {
+            const void    *messages[k_MAX_MESSAGES];
+            bsl::size_t    lengths[k_MAX_MESSAGES];
+            unsigned char  results[(k_MAX_MESSAGES + 1) * k_DIGEST_SIZE];
+
+            for (bsl::size_t index = 0; index != numMessages; ++index) {
+                seed = seed * 1103515245 + 12345;
+                const unsigned int random = seed >> 8;
+                lengths[index] = 0 == random % 3
+                               ? k_EDGE_LENGTHS[random / 3
+                                                % k_NUM_EDGE_LENGTHS]
+                               : random / 3 % (k_MAX_LENGTH + 1);
+                messages[index] = 0 == lengths[index] && trial % 2
+                                ? 0
+                                : &data[random % 8];
+            }
+            bsl::fill(bsl::begin(results), bsl::end(results), 0xa5);
+
+            bdlde::Sha1::loadDigests(results, messages, lengths, numMessages);
+
+            for (bsl::size_t index = 0; index != numMessages; ++index) {
+                unsigned char expected[k_DIGEST_SIZE];
+                bdlde::Sha1(messages[index], lengths[index]).loadDigest(
+                                                                     expected);
+                ASSERTV(numMessages, trial, index, lengths[index],
+                        bsl::equal(bsl::begin(expected),
+                                   bsl::end(expected),
+                                   results + index * k_DIGEST_SIZE));
+            }
+            for (bsl::size_t index = numMessages * k_DIGEST_SIZE;
+                 index != sizeof results;
+                 ++index) {
+                ASSERTV(numMessages, trial, index, 0xa5 == results[index]);
+            }
+        }
+    }
+
+    // Messages of very different lengths in the same batch.
+
+    bsl::vector<unsigned char> large(100000, 'x');
+    const void        *messages[] = { &large[0], "abc", &large[1], "" };
+    const bsl::size_t  lengths[]  = { large.size(), 3, 3000, 0 };
+    unsigned char      results[4 * k_DIGEST_SIZE];
+    bdlde::Sha1::loadDigests(results, messages, lengths, 4);
+    for (bsl::size_t index = 0; index != 4; ++index) {
+        unsigned char expected[k_DIGEST_SIZE];
+        bdlde::Sha1(messages[index], lengths[index]).loadDigest(expected);
+        ASSERTV(index, bsl::equal(bsl::begin(expected),
+                                  bsl::end(expected),
+                                  results + index * k_DIGEST_SIZE));
+    }
+}
+
 }  // close unnamed namespace
 
 //=============================================================================
@@ -537,7 +624,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << '\n';
 
     switch (test) { case 0:
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -559,6 +646,40 @@ int main(int argc, char *argv[])
 
         assertPasswordIsExpected();
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // TESTING `loadDigests`
+        //
+        // Concerns:
+        // 1. Each digest loaded by `loadDigests` is the same as the digest of
+        //    the corresponding message computed by an object, for messages of
+        //    any length and alignment, and regardless of the number of
+        //    messages hashed together and of the lengths of the others.
+        //
+        // 2. Nothing is written beyond the last digest, and nothing at all is
+        //    written if no messages are supplied.
+        //
+        // 3. A null address may be supplied for a message of length 0.
+        //
+        // Plan:
+        // 1. For batches of 0 to 20 messages having pseudo-random lengths
+        //    (biased towards the boundaries of the blocks) and alignments,
+        //    compare the result of `loadDigests` with the digests computed by
+        //    objects, and verify that the bytes following the digests are
+        //    unchanged.  (C-1..3)
+        //
+        // 2. Hash together messages of very different lengths, and compare
+        //    the results as in P-1.  (C-1)
+        //
+        // Testing:
+        //   void loadDigests(uchar *, const void *const *, const size_t *, n);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING `loadDigests`" "\n"
+                          << "=====================" "\n";
+
+        testLoadDigests();
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // TESTING PRINTING AND OUTPUT (<<) OPERATOR
@@ -760,6 +881,72 @@ int main(int argc, char *argv[])
         bdlde::Sha1 hasher;
         ASSERT(hasher == hasher);
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: loadDigests
+        //
+        // Concerns:
+        // 1. Hashing many short messages with `loadDigests` is at least as
+        //    fast as hashing them one at a time.
+        //
+        // Plan:
+        // 1. Time hashing a batch of messages of several lengths both ways,
+        //    and report the throughput.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: loadDigests
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE TEST: loadDigests" "\n"
+                          << "=============================" "\n";
+
+        const bsl::size_t k_LENGTHS[]  = { 64, 1024, 4096 };
+        const int         k_ITERATIONS = 20;
+
+        for (bsl::size_t i = 0; i != sizeof k_LENGTHS / sizeof *k_LENGTHS;
+             ++i) {
+            const bsl::size_t length      = k_LENGTHS[i];
+            const bsl::size_t numMessages = 16 * 1024 * 1024 / length / 4;
+
+            bsl::vector<unsigned char> data(numMessages * length + 1, 'a');
+            bsl::vector<const void *>  messages(numMessages);
+            bsl::vector<bsl::size_t>   lengths(numMessages, length);
+            bsl::vector<unsigned char> results(numMessages *
+                                               bdlde::Sha1::k_DIGEST_SIZE);
+            for (bsl::size_t index = 0; index != numMessages; ++index) {
+                messages[index] = &data[index * length];
+            }
+
+            const double k_MB = static_cast<double>(numMessages * length) *
+                                                  k_ITERATIONS / (1024 * 1024);
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int j = 0; j < k_ITERATIONS; ++j) {
+                for (bsl::size_t index = 0; index != numMessages; ++index) {
+                    bdlde::Sha1(messages[index], length).loadDigest(
+                                &results[index * bdlde::Sha1::k_DIGEST_SIZE]);
+                }
+            }
+            timer.stop();
+            const double single = k_MB / timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int j = 0; j < k_ITERATIONS; ++j) {
+                bdlde::Sha1::loadDigests(&results[0],
+                                         &messages[0],
+                                         &lengths[0],
+                                         numMessages);
+            }
+            timer.stop();
+            const double batch = k_MB / timer.elapsedTime();
+
+            cout << numMessages << " x " << length << " bytes: " << single
+                 << " MB/s singly, " << batch << " MB/s by loadDigests"
+                 << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." "\n";
         testStatus = -1;
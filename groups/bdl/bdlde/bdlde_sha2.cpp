@@ -1,10 +1,56 @@
 // bdlde_sha2.cpp                                                     -*-C++-*-
 #include <bdlde_sha2.h>
 
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
 #include <bsl_algorithm.h>
 #include <bsl_climits.h>
 #include <bsl_ostream.h>
 
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#include <cpuid.h>
+#include <immintrin.h>
+#define BDLDE_SHA2_X86_ENABLED 1
+#define BDLDE_SHA2_SHANI_TARGET __attribute__((target("sha,sse4.1")))
+#define BDLDE_SHA2_AVX2_TARGET  __attribute__((target("avx2")))
+#endif
+
+#if defined(BDLDE_SHA2_ENABLE_ARM_SHA)                                        \
+ && defined(BSLS_PLATFORM_CPU_ARM)                                            \
+ && defined(BSLS_PLATFORM_CPU_64_BIT)                                         \
+ && defined(__ARM_FEATURE_SHA2)                                               \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#include <arm_neon.h>
+# if defined(BSLS_PLATFORM_OS_LINUX)
+#  include <sys/auxv.h>
+#  ifndef HWCAP_SHA2
+#   define HWCAP_SHA2 (1 << 6)
+#  endif
+# endif
+#define BDLDE_SHA2_ARM_SHA2_ENABLED 1
+#endif
+
+///Implementation Notes
+///--------------------
+// SHA-224 and SHA-256 blocks are compressed with the x86 SHA extensions
+// (SHA-NI) or the ARMv8 cryptographic extensions when the processor on which
+// the program is running supports them, which is detected once at run-time;
+// otherwise, and for SHA-384 and SHA-512 (for which neither architecture
+// provides instructions), the portable `transformPortable` is used.  All
+// paths produce identical results.
+//
+// The `loadDigests` class methods hash several independent messages at once.
+// On x86 processors supporting AVX2, messages are assigned to "lanes" of
+// 256-bit registers (eight lanes of 32-bit words for SHA-224 and SHA-256, four
+// lanes of 64-bit words for SHA-384 and SHA-512), and all lanes are advanced
+// one block at a time by the same instructions.  As each message's final
+// (padded) block is compressed, its lane is refilled with the next pending
+// message.  Once no messages are pending, and too few lanes remain active to
+// make the vector kernel worthwhile, the remaining messages are completed one
+// at a time by `transform`.
+
 namespace BloombergLP {
 namespace bdlde {
 namespace {
@@ -196,12 +242,37 @@ const bsl::uint64_t sha512Constants[80] =
              0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL,
              0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL};
 
+// Initial states of the four algorithms.  SHA-224 uses the second 32 bits of
+// the fractional parts of the square roots of the 9th through 16th primes,
+// SHA-256 the first 32 bits of the fractional parts of the square roots of
+// the first 8 primes, and SHA-384 and SHA-512 the first 64 bits of the same
+// values.
+const bsl::uint32_t sha224InitialState[8] =
+            {0xc1059ed8, 0x367cd507, 0x3070dd17, 0xf70e5939,
+             0xffc00b31, 0x68581511, 0x64f98fa7, 0xbefa4fa4};
+
+const bsl::uint32_t sha256InitialState[8] =
+            {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+             0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
+const bsl::uint64_t sha384InitialState[8] =
+            {0xcbbb9d5dc1059ed8ULL, 0x629a292a367cd507ULL,
+             0x9159015a3070dd17ULL, 0x152fecd8f70e5939ULL,
+             0x67332667ffc00b31ULL, 0x8eb44a8768581511ULL,
+             0xdb0c2e0d64f98fa7ULL, 0x47b5481dbefa4fa4ULL};
+
+const bsl::uint64_t sha512InitialState[8] =
+            {0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL,
+             0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+             0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL,
+             0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL};
+
 /// Update the specified `state` with the hashed contents of the specified
 /// `message` having a length equal to the specified `bufferSize` times the
 /// specified `numberOfBuffers`, mixing it with the values in the specified
 /// `constants`.
 template<class INTEGER, bsl::size_t ARRAY_SIZE>
-void transform(INTEGER             *state,
+void transformPortable(INTEGER             *state,
                const unsigned char *message,
                bsl::uint64_t        numberOfBuffers,
                bsl::uint64_t        bufferSize,
@@ -247,6 +318,598 @@ void transform(INTEGER             *state,
     }
 }
 
+#if defined(BDLDE_SHA2_X86_ENABLED)
+
+                            // ================
+                            // x86 SHA Routines
+                            // ================
+
+/// Return `true` if the processor on which this program is running supports
+/// the SHA extensions, and `false` otherwise.  Note that every processor
+/// implementing the SHA extensions also implements SSE4.1, which the SHA-NI
+/// routines below use to shuffle the state.
+bool isShaNiSupported()
+{
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid_max(0, 0) < 7) {
+        return false;                                                 // RETURN
+    }
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    return 0 != (ebx & bit_SHA);
+}
+
+/// Return the result of `isShaNiSupported`, computed once.
+bool hasShaNi()
+{
+    static const bool result = isShaNiSupported();
+    return result;
+}
+
+/// Perform the four SHA-256 rounds numbered `4 * GROUP` through
+/// `4 * GROUP + 3` on the specified `abef` and `cdgh` halves of the state,
+/// first loading (for the first four groups) or computing (for the rest) the
+/// corresponding message words into the appropriate element of the
+/// specified `schedule`, which holds the message words of the four most
+/// recent groups, from the specified `message` using the specified
+/// `constants`.
+template <int GROUP>
+BDLDE_SHA2_SHANI_TARGET inline
+void roundsShaNi(__m128i             *abef,
+                 __m128i             *cdgh,
+                 __m128i             *schedule,
+                 const unsigned char *message,
+                 const bsl::uint32_t *constants)
+{
+    __m128i& words = schedule[GROUP & 3];
+    if (GROUP < 4) {
+        const __m128i byteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL,
+                                                0x0405060700010203ULL);
+        words = _mm_shuffle_epi8(
+              _mm_loadu_si128(reinterpret_cast<const __m128i *>(message) +
+                              GROUP),
+              byteSwap);
+    }
+    else {
+        const __m128i& w1 = schedule[(GROUP + 1) & 3];
+        const __m128i& w2 = schedule[(GROUP + 2) & 3];
+        const __m128i& w3 = schedule[(GROUP + 3) & 3];
+        words = _mm_sha256msg2_epu32(
+                            _mm_add_epi32(_mm_sha256msg1_epu32(words, w1),
+                                          _mm_alignr_epi8(w3, w2, 4)),
+                            w3);
+    }
+
+    const __m128i k = _mm_add_epi32(
+                words,
+                _mm_loadu_si128(reinterpret_cast<const __m128i *>(constants) +
+                                GROUP));
+    *cdgh = _mm_sha256rnds2_epu32(*cdgh, *abef, k);
+    *abef = _mm_sha256rnds2_epu32(*abef, *cdgh, _mm_shuffle_epi32(k, 0x0e));
+}
+
+/// Update the specified `state` with the hashed contents of the specified
+/// `message` having a length equal to the specified `numberOfBuffers` times
+/// 64, using the SHA extensions.
+BDLDE_SHA2_SHANI_TARGET
+void transformShaNi(bsl::uint32_t       *state,
+                    const unsigned char *message,
+                    bsl::uint64_t        numberOfBuffers)
+{
+    // The 'sha256rnds2' instruction expects the state as the two vectors
+    // "ABEF" and "CDGH" (most significant element first).
+
+    const __m128i dcba = _mm_loadu_si128(
+                                    reinterpret_cast<const __m128i *>(state));
+    const __m128i hgfe = _mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(state + 4));
+    const __m128i cdab = _mm_shuffle_epi32(dcba, 0xb1);
+    const __m128i efgh = _mm_shuffle_epi32(hgfe, 0x1b);
+
+    __m128i abef = _mm_alignr_epi8(cdab, efgh, 8);
+    __m128i cdgh = _mm_blend_epi16(efgh, cdab, 0xf0);
+
+    const bsl::uint32_t *k = sha256Constants;
+    for (; numberOfBuffers; --numberOfBuffers, message += 64) {
+        const __m128i abefSaved = abef;
+        const __m128i cdghSaved = cdgh;
+
+        __m128i schedule[4];
+        roundsShaNi< 0>(&abef, &cdgh, schedule, message, k);
+        roundsShaNi< 1>(&abef, &cdgh, schedule, message, k);
+        roundsShaNi< 2>(&abef, &cdgh, schedule, message, k);
+        roundsShaNi< 3>(&abef, &cdgh, schedule, message, k);
+        roundsShaNi< 4>(&abef, &cdgh, schedule, message, k);
+        roundsShaNi< 5>(&abef, &cdgh, schedule, message, k);
+        roundsShaNi< 6>(&abef, &cdgh, schedule, message, k);
+        roundsShaNi< 7>(&abef, &cdgh, schedule, message, k);
+        roundsShaNi< 8>(&abef, &cdgh, schedule, message, k);
+        roundsShaNi< 9>(&abef, &cdgh, schedule, message, k);
+        roundsShaNi<10>(&abef, &cdgh, schedule, message, k);
+        roundsShaNi<11>(&abef, &cdgh, schedule, message, k);
+        roundsShaNi<12>(&abef, &cdgh, schedule, message, k);
+        roundsShaNi<13>(&abef, &cdgh, schedule, message, k);
+        roundsShaNi<14>(&abef, &cdgh, schedule, message, k);
+        roundsShaNi<15>(&abef, &cdgh, schedule, message, k);
+
+        abef = _mm_add_epi32(abef, abefSaved);
+        cdgh = _mm_add_epi32(cdgh, cdghSaved);
+    }
+
+    const __m128i feba = _mm_shuffle_epi32(abef, 0x1b);
+    const __m128i dchg = _mm_shuffle_epi32(cdgh, 0xb1);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state),
+                     _mm_blend_epi16(feba, dchg, 0xf0));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(state + 4),
+                     _mm_alignr_epi8(dchg, feba, 8));
+}
+
+                            // ==================
+                            // AVX2 Lane Routines
+                            // ==================
+
+/// Return `true` if the processor on which this program is running, and the
+/// operating system, support AVX2 instructions, and `false` otherwise.
+bool isAvx2Supported()
+{
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)
+     || bit_OSXSAVE != (ecx & bit_OSXSAVE)
+     || bit_AVX     != (ecx & bit_AVX)) {
+        return false;                                                 // RETURN
+    }
+
+    unsigned int xcr0Lo, xcr0Hi;
+    __asm__ __volatile__("xgetbv" : "=a"(xcr0Lo), "=d"(xcr0Hi) : "c"(0));
+    if (6 != (xcr0Lo & 6)) {
+        // The operating system does not preserve the YMM registers.
+
+        return false;                                                 // RETURN
+    }
+
+    if (__get_cpuid_max(0, 0) < 7) {
+        return false;                                                 // RETURN
+    }
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    return 0 != (ebx & bit_AVX2);
+}
+
+/// Return the result of `isAvx2Supported`, computed once.
+bool hasAvx2()
+{
+    static const bool result = isAvx2Supported();
+    return result;
+}
+
+/// This `struct` template provides the word-size-specific operations on
+/// 256-bit vectors holding one `INTEGER` word of each of several messages
+/// needed by `transformLanes`.
+template <class INTEGER>
+struct Avx2Lanes;
+
+/// This specialization holds eight lanes of 32-bit words, for SHA-224 and
+/// SHA-256.
+template <>
+struct Avx2Lanes<bsl::uint32_t> {
+
+    enum { k_NUM_LANES = 8 };
+
+    BDLDE_SHA2_AVX2_TARGET static
+    __m256i add(__m256i x, __m256i y)
+    {
+        return _mm256_add_epi32(x, y);
+    }
+
+    BDLDE_SHA2_AVX2_TARGET static
+    __m256i broadcast(bsl::uint32_t value)
+    {
+        return _mm256_set1_epi32(static_cast<int>(value));
+    }
+
+    template <int SHIFT>
+    BDLDE_SHA2_AVX2_TARGET static
+    __m256i rotateRight(__m256i x)
+    {
+        return _mm256_or_si256(_mm256_srli_epi32(x, SHIFT),
+                               _mm256_slli_epi32(x, 32 - SHIFT));
+    }
+
+    BDLDE_SHA2_AVX2_TARGET static
+    __m256i f1(__m256i x)
+    {
+        return _mm256_xor_si256(
+                      _mm256_xor_si256(rotateRight< 2>(x), rotateRight<13>(x)),
+                      rotateRight<22>(x));
+    }
+
+    BDLDE_SHA2_AVX2_TARGET static
+    __m256i f2(__m256i x)
+    {
+        return _mm256_xor_si256(
+                      _mm256_xor_si256(rotateRight< 6>(x), rotateRight<11>(x)),
+                      rotateRight<25>(x));
+    }
+
+    BDLDE_SHA2_AVX2_TARGET static
+    __m256i f3(__m256i x)
+    {
+        return _mm256_xor_si256(
+                      _mm256_xor_si256(rotateRight< 7>(x), rotateRight<18>(x)),
+                      _mm256_srli_epi32(x, 3));
+    }
+
+    BDLDE_SHA2_AVX2_TARGET static
+    __m256i f4(__m256i x)
+    {
+        return _mm256_xor_si256(
+                      _mm256_xor_si256(rotateRight<17>(x), rotateRight<19>(x)),
+                      _mm256_srli_epi32(x, 10));
+    }
+
+    /// Load into the specified `words` the 16 big-endian message words of
+    /// the block at the specified `offset` from each of the specified
+    /// `blocks`, with `words[i]` holding word `i` of every lane.
+    BDLDE_SHA2_AVX2_TARGET static
+    void loadMessage(__m256i                    *words,
+                     const unsigned char *const *blocks,
+                     bsl::uint64_t               offset)
+    {
+        const __m256i byteSwap = _mm256_setr_epi8(
+                                      3,  2,  1,  0,  7,  6,  5,  4,
+                                     11, 10,  9,  8, 15, 14, 13, 12,
+                                      3,  2,  1,  0,  7,  6,  5,  4,
+                                     11, 10,  9,  8, 15, 14, 13, 12);
+
+        for (int half = 0; half < 2; ++half) {
+            __m256i r[8];
+            for (int lane = 0; lane < 8; ++lane) {
+                r[lane] = _mm256_shuffle_epi8(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i *>(
+                                         blocks[lane] + offset + 32 * half)),
+                    byteSwap);
+            }
+
+            // Transpose the 8x8 matrix of words.
+
+            __m256i t[8];
+            for (int i = 0; i < 8; i += 2) {
+                t[i]     = _mm256_unpacklo_epi32(r[i], r[i + 1]);
+                t[i + 1] = _mm256_unpackhi_epi32(r[i], r[i + 1]);
+            }
+            __m256i u[8];
+            for (int i = 0; i < 8; i += 4) {
+                u[i]     = _mm256_unpacklo_epi64(t[i],     t[i + 2]);
+                u[i + 1] = _mm256_unpackhi_epi64(t[i],     t[i + 2]);
+                u[i + 2] = _mm256_unpacklo_epi64(t[i + 1], t[i + 3]);
+                u[i + 3] = _mm256_unpackhi_epi64(t[i + 1], t[i + 3]);
+            }
+            __m256i *out = words + 8 * half;
+            for (int i = 0; i < 4; ++i) {
+                out[i]     = _mm256_permute2x128_si256(u[i], u[i + 4], 0x20);
+                out[i + 4] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x31);
+            }
+        }
+    }
+};
+
+/// This specialization holds four lanes of 64-bit words, for SHA-384 and
+/// SHA-512.
+template <>
+struct Avx2Lanes<bsl::uint64_t> {
+
+    enum { k_NUM_LANES = 4 };
+
+    BDLDE_SHA2_AVX2_TARGET static
+    __m256i add(__m256i x, __m256i y)
+    {
+        return _mm256_add_epi64(x, y);
+    }
+
+    BDLDE_SHA2_AVX2_TARGET static
+    __m256i broadcast(bsl::uint64_t value)
+    {
+        return _mm256_set1_epi64x(static_cast<long long>(value));
+    }
+
+    template <int SHIFT>
+    BDLDE_SHA2_AVX2_TARGET static
+    __m256i rotateRight(__m256i x)
+    {
+        return _mm256_or_si256(_mm256_srli_epi64(x, SHIFT),
+                               _mm256_slli_epi64(x, 64 - SHIFT));
+    }
+
+    BDLDE_SHA2_AVX2_TARGET static
+    __m256i f1(__m256i x)
+    {
+        return _mm256_xor_si256(
+                      _mm256_xor_si256(rotateRight<28>(x), rotateRight<34>(x)),
+                      rotateRight<39>(x));
+    }
+
+    BDLDE_SHA2_AVX2_TARGET static
+    __m256i f2(__m256i x)
+    {
+        return _mm256_xor_si256(
+                      _mm256_xor_si256(rotateRight<14>(x), rotateRight<18>(x)),
+                      rotateRight<41>(x));
+    }
+
+    BDLDE_SHA2_AVX2_TARGET static
+    __m256i f3(__m256i x)
+    {
+        return _mm256_xor_si256(
+                      _mm256_xor_si256(rotateRight< 1>(x), rotateRight< 8>(x)),
+                      _mm256_srli_epi64(x, 7));
+    }
+
+    BDLDE_SHA2_AVX2_TARGET static
+    __m256i f4(__m256i x)
+    {
+        return _mm256_xor_si256(
+                      _mm256_xor_si256(rotateRight<19>(x), rotateRight<61>(x)),
+                      _mm256_srli_epi64(x, 6));
+    }
+
+    /// Load into the specified `words` the 16 big-endian message words of
+    /// the block at the specified `offset` from each of the specified
+    /// `blocks`, with `words[i]` holding word `i` of every lane.
+    BDLDE_SHA2_AVX2_TARGET static
+    void loadMessage(__m256i                    *words,
+                     const unsigned char *const *blocks,
+                     bsl::uint64_t               offset)
+    {
+        const __m256i byteSwap = _mm256_setr_epi8(
+                                      7,  6,  5,  4,  3,  2,  1,  0,
+                                     15, 14, 13, 12, 11, 10,  9,  8,
+                                      7,  6,  5,  4,  3,  2,  1,  0,
+                                     15, 14, 13, 12, 11, 10,  9,  8);
+
+        for (int quarter = 0; quarter < 4; ++quarter) {
+            __m256i r[4];
+            for (int lane = 0; lane < 4; ++lane) {
+                r[lane] = _mm256_shuffle_epi8(
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i *>(
+                                      blocks[lane] + offset + 32 * quarter)),
+                    byteSwap);
+            }
+
+            // Transpose the 4x4 matrix of words.
+
+            const __m256i t0 = _mm256_unpacklo_epi64(r[0], r[1]);
+            const __m256i t1 = _mm256_unpackhi_epi64(r[0], r[1]);
+            const __m256i t2 = _mm256_unpacklo_epi64(r[2], r[3]);
+            const __m256i t3 = _mm256_unpackhi_epi64(r[2], r[3]);
+
+            __m256i *out = words + 4 * quarter;
+            out[0] = _mm256_permute2x128_si256(t0, t2, 0x20);
+            out[1] = _mm256_permute2x128_si256(t1, t3, 0x20);
+            out[2] = _mm256_permute2x128_si256(t0, t2, 0x31);
+            out[3] = _mm256_permute2x128_si256(t1, t3, 0x31);
+        }
+    }
+};
+
+/// Update the specified `state`, holding word `i` of the state of each lane
+/// in `state[i]`, with the hashed contents of the specified `numberOfBuffers`
+/// consecutive blocks of the specified `bufferSize` beginning at each of the
+/// specified `blocks`, mixing them with the values in the specified
+/// `constants`.
+template <class INTEGER, bsl::size_t ARRAY_SIZE>
+BDLDE_SHA2_AVX2_TARGET
+void transformLanes(INTEGER                   (*state)[32 / sizeof(INTEGER)],
+                    const unsigned char *const *blocks,
+                    bsl::uint64_t               numberOfBuffers,
+                    bsl::uint64_t               bufferSize,
+                    const INTEGER             (&constants)[ARRAY_SIZE])
+{
+    typedef Avx2Lanes<INTEGER> Lanes;
+
+    __m256i s[8];
+    for (int index = 0; index < 8; ++index) {
+        const INTEGER *column = state[index];
+        s[index] = _mm256_loadu_si256(
+                                   reinterpret_cast<const __m256i *>(column));
+    }
+
+    for (bsl::uint64_t offset = 0;
+         offset != numberOfBuffers * bufferSize;
+         offset += bufferSize) {
+        __m256i w[16];
+        Lanes::loadMessage(w, blocks, offset);
+
+        __m256i wv[8];
+        bsl::copy(s, s + 8, wv);
+        for (int index = 0; index != static_cast<int>(ARRAY_SIZE); ++index) {
+            if (index >= 16) {
+                w[index & 15] = Lanes::add(
+                          Lanes::add(Lanes::f4(w[(index -  2) & 15]),
+                                                w[(index -  7) & 15]),
+                          Lanes::add(Lanes::f3(w[(index - 15) & 15]),
+                                                w[index & 15]));
+            }
+
+            const __m256i ch = _mm256_xor_si256(
+                          _mm256_and_si256(wv[4],
+                                           _mm256_xor_si256(wv[5], wv[6])),
+                          wv[6]);
+            const __m256i maj = _mm256_or_si256(
+                          _mm256_and_si256(wv[0], wv[1]),
+                          _mm256_and_si256(_mm256_or_si256(wv[0], wv[1]),
+                                           wv[2]));
+            const __m256i t1 = Lanes::add(
+                         Lanes::add(Lanes::add(wv[7], Lanes::f2(wv[4])), ch),
+                         Lanes::add(Lanes::broadcast(constants[index]),
+                                    w[index & 15]));
+            const __m256i t2 = Lanes::add(Lanes::f1(wv[0]), maj);
+            wv[7] = wv[6];
+            wv[6] = wv[5];
+            wv[5] = wv[4];
+            wv[4] = Lanes::add(wv[3], t1);
+            wv[3] = wv[2];
+            wv[2] = wv[1];
+            wv[1] = wv[0];
+            wv[0] = Lanes::add(t1, t2);
+        }
+
+        for (int index = 0; index < 8; ++index) {
+            s[index] = Lanes::add(s[index], wv[index]);
+        }
+    }
+
+    for (int index = 0; index < 8; ++index) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(state[index]),
+                            s[index]);
+    }
+}
+
+#endif  // BDLDE_SHA2_X86_ENABLED
+
+#if defined(BDLDE_SHA2_ARM_SHA2_ENABLED)
+
+                            // ================
+                            // ARM SHA Routines
+                            // ================
+
+/// Return `true` if the running processor supports the ARMv8 SHA-256
+/// instructions, and `false` otherwise.
+bool isArmSha2Supported()
+{
+# if defined(BSLS_PLATFORM_OS_LINUX)
+    return 0 != (::getauxval(AT_HWCAP) & HWCAP_SHA2);
+# else
+    // The instructions are part of the target architecture that the compiler
+    // was instructed to generate code for.
+
+    return true;
+# endif
+}
+
+/// Return the result of `isArmSha2Supported`, computed once.
+bool hasArmSha2()
+{
+    static const bool result = isArmSha2Supported();
+    return result;
+}
+
+/// Update the specified `state` with the hashed contents of the specified
+/// `message` having a length equal to the specified `numberOfBuffers` times
+/// 64, using the ARMv8 SHA-256 instructions.
+void transformArmSha2(bsl::uint32_t       *state,
+                      const unsigned char *message,
+                      bsl::uint64_t        numberOfBuffers)
+{
+    uint32x4_t abcd = vld1q_u32(state);
+    uint32x4_t efgh = vld1q_u32(state + 4);
+
+    for (; numberOfBuffers; --numberOfBuffers, message += 64) {
+        const uint32x4_t abcdSaved = abcd;
+        const uint32x4_t efghSaved = efgh;
+
+        uint32x4_t w[4];
+        for (int index = 0; index < 4; ++index) {
+            w[index] = vreinterpretq_u32_u8(
+                                   vrev32q_u8(vld1q_u8(message + 16 * index)));
+        }
+
+        for (int group = 0; group < 16; ++group) {
+            uint32x4_t& words = w[group & 3];
+
+            const uint32x4_t k = vaddq_u32(words,
+                                           vld1q_u32(sha256Constants +
+                                                     4 * group));
+            if (group < 12) {
+                // Compute the words of group 'group + 4' in place.
+
+                words = vsha256su1q_u32(vsha256su0q_u32(words,
+                                                        w[(group + 1) & 3]),
+                                        w[(group + 2) & 3],
+                                        w[(group + 3) & 3]);
+            }
+
+            const uint32x4_t abcdPrevious = abcd;
+            abcd = vsha256hq_u32(abcd, efgh, k);
+            efgh = vsha256h2q_u32(efgh, abcdPrevious, k);
+        }
+
+        abcd = vaddq_u32(abcd, abcdSaved);
+        efgh = vaddq_u32(efgh, efghSaved);
+    }
+
+    vst1q_u32(state,     abcd);
+    vst1q_u32(state + 4, efgh);
+}
+
+#endif  // BDLDE_SHA2_ARM_SHA2_ENABLED
+
+/// Update the specified `state` with the hashed contents of the specified
+/// `message` having a length equal to the specified `bufferSize` times the
+/// specified `numberOfBuffers`, mixing it with the values in the specified
+/// `constants`, using the SHA instructions of the processor if available.
+void transform(bsl::uint32_t        *state,
+               const unsigned char  *message,
+               bsl::uint64_t         numberOfBuffers,
+               bsl::uint64_t         bufferSize,
+               const bsl::uint32_t (&constants)[64])
+{
+#if defined(BDLDE_SHA2_X86_ENABLED)
+    if (hasShaNi()) {
+        transformShaNi(state, message, numberOfBuffers);
+        return;                                                       // RETURN
+    }
+#endif
+#if defined(BDLDE_SHA2_ARM_SHA2_ENABLED)
+    if (hasArmSha2()) {
+        transformArmSha2(state, message, numberOfBuffers);
+        return;                                                       // RETURN
+    }
+#endif
+    transformPortable(state, message, numberOfBuffers, bufferSize, constants);
+}
+
+/// Update the specified `state` with the hashed contents of the specified
+/// `message` having a length equal to the specified `bufferSize` times the
+/// specified `numberOfBuffers`, mixing it with the values in the specified
+/// `constants`.
+void transform(bsl::uint64_t        *state,
+               const unsigned char  *message,
+               bsl::uint64_t         numberOfBuffers,
+               bsl::uint64_t         bufferSize,
+               const bsl::uint64_t (&constants)[80])
+{
+    transformPortable(state, message, numberOfBuffers, bufferSize, constants);
+}
+
+/// Load into the specified `finalBuffers` the specified `bufferSize` bytes
+/// at the specified `buffer`, which are the last bytes of a message having
+/// the specified `totalSize`, followed by the SHA-2 padding and metadata for
+/// a message of that size, and return the number (1 or 2) of blocks of
+/// `FINAL_BUFFERS_SIZE / 2` bytes so loaded.  The behavior is undefined
+/// unless `bufferSize < FINAL_BUFFERS_SIZE / 2`.
+template<class INTEGER, bsl::size_t FINAL_BUFFERS_SIZE>
+bsl::uint64_t padFinalBuffers(
+                         unsigned char      (&finalBuffers)[FINAL_BUFFERS_SIZE],
+                         const unsigned char *buffer,
+                         bsl::uint64_t        bufferSize,
+                         bsl::uint64_t        totalSize)
+{
+    const bsl::uint64_t BUFFER_CAPACITY  = FINAL_BUFFERS_SIZE / 2;
+    const bsl::uint64_t totalSizeInBits  = totalSize * 8;
+    const bsl::uint64_t unpaddedSize     = bufferSize
+                                         + 1
+                                         + sizeof(INTEGER) * 2;
+    const bsl::uint64_t remainingBuffers =
+                                     (unpaddedSize <= BUFFER_CAPACITY) ? 1 : 2;
+    // At the end of the message, we write a special marker byte, followed by
+    // the total size of the message.  Insert '0' bytes between those to pad
+    // the message to a multiple of BUFFER_CAPACITY.
+    bsl::fill(finalBuffers, finalBuffers + FINAL_BUFFERS_SIZE, 0);
+    bsl::copy(buffer, buffer + bufferSize, finalBuffers);
+    finalBuffers[bufferSize] = 1 << 7;
+    unsigned char *end = finalBuffers + remainingBuffers * BUFFER_CAPACITY;
+    unpack(totalSizeInBits, end - sizeof(totalSizeInBits));
+    return remainingBuffers;
+}
+
 /// Update the specified `state` with the contents of the specified `buffer`
 /// followed by the contents of the specified `message` having the specified
 /// `messageSize`, mixed with the data in the specified `constants`.  Update
@@ -306,20 +969,12 @@ void finalize(unsigned char        *result,
               const unsigned char (&buffer)[BUFFER_CAPACITY],
               const INTEGER       (&constants)[ARRAY_SIZE])
 {
-    const bsl::uint64_t totalSizeInBits  = totalSize * 8;
-    const bsl::uint64_t unpaddedSize     = bufferSize
-                                         + 1
-                                         + sizeof(INTEGER) * 2;
-    const bsl::uint64_t remainingBuffers =
-                                     (unpaddedSize <= BUFFER_CAPACITY) ? 1 : 2;
-    // At the end of the message, we write a special marker byte, followed by
-    // the total size of the message.  Insert '0' bytes between those to pad
-    // the message to a multiple of BUFFER_CAPACITY.
-    unsigned char       finalBuffers[BUFFER_CAPACITY * 2] = {};
-    bsl::copy(buffer, buffer + bufferSize, finalBuffers);
-    finalBuffers[bufferSize] = 1 << 7;
-    unsigned char *end = finalBuffers + remainingBuffers * BUFFER_CAPACITY;
-    unpack(totalSizeInBits, end - sizeof(totalSizeInBits));
+    unsigned char       finalBuffers[BUFFER_CAPACITY * 2];
+    const bsl::uint64_t remainingBuffers = padFinalBuffers<INTEGER>(
+                                                                 finalBuffers,
+                                                                 buffer,
+                                                                 bufferSize,
+                                                                 totalSize);
     transform(state,
               finalBuffers,
               remainingBuffers,
@@ -331,6 +986,283 @@ void finalize(unsigned char        *result,
     }
 }
 
+/// Store into the specified `result` having the specified `digestSize` the
+/// digest of the specified `message` having the specified `length`, computed
+/// from the specified `initialState` using the specified `constants`.
+template<bsl::size_t BUFFER_CAPACITY, class INTEGER, bsl::size_t ARRAY_SIZE>
+void hashMessage(unsigned char        *result,
+                 bsl::size_t           digestSize,
+                 const INTEGER       (&initialState)[8],
+                 const unsigned char  *message,
+                 bsl::uint64_t         length,
+                 const INTEGER       (&constants)[ARRAY_SIZE])
+{
+    INTEGER state[8];
+    bsl::copy(initialState, initialState + 8, state);
+
+    const bsl::uint64_t numBuffers = length / BUFFER_CAPACITY;
+    transform(state, message, numBuffers, BUFFER_CAPACITY, constants);
+
+    const unsigned char *tail     = message + numBuffers * BUFFER_CAPACITY;
+    const bsl::uint64_t  tailSize = length % BUFFER_CAPACITY;
+    unsigned char        buffer[BUFFER_CAPACITY];
+    bsl::copy(tail, tail + tailSize, buffer);
+    finalize(result, digestSize, state, length, tailSize, buffer, constants);
+}
+
+#if defined(BDLDE_SHA2_X86_ENABLED)
+
+/// This `struct` template describes the progress of the hashing of one
+/// message assigned to a lane by `loadDigestsLanes`.  The message's complete
+/// blocks are hashed in place, followed by its final, padded, blocks, which
+/// are prepared in `d_finalBuffers` when the message is assigned.
+template <bsl::size_t BUFFER_CAPACITY>
+struct LaneProgress {
+
+    // DATA
+    const unsigned char *d_next_p;          // next block to hash
+
+    bsl::uint64_t        d_numBuffers;      // number of blocks at 'd_next_p'
+
+    bsl::uint64_t        d_numFinalBuffers; // number of padded blocks not yet
+                                            // reached, or 0 if 'd_next_p'
+                                            // refers to them
+
+    bsl::size_t          d_messageIndex;    // index of the message
+
+    unsigned char        d_finalBuffers[BUFFER_CAPACITY * 2];
+                                            // final, padded, blocks
+};
+
+/// Assign to the specified `lane` the message having the specified
+/// `messageIndex` in the specified `messages` and `lengths`.
+template <class INTEGER, bsl::size_t BUFFER_CAPACITY>
+void assignLane(LaneProgress<BUFFER_CAPACITY> *lane,
+                const void *const             *messages,
+                const bsl::size_t             *lengths,
+                bsl::size_t                    messageIndex)
+{
+    const unsigned char *message = static_cast<const unsigned char *>(
+                                                       messages[messageIndex]);
+    const bsl::uint64_t  length     = lengths[messageIndex];
+    const bsl::uint64_t  numBuffers = length / BUFFER_CAPACITY;
+
+    lane->d_messageIndex    = messageIndex;
+    lane->d_numFinalBuffers = padFinalBuffers<INTEGER>(
+                                        lane->d_finalBuffers,
+                                        message + numBuffers * BUFFER_CAPACITY,
+                                        length % BUFFER_CAPACITY,
+                                        length);
+    if (numBuffers) {
+        lane->d_next_p     = message;
+        lane->d_numBuffers = numBuffers;
+    }
+    else {
+        lane->d_next_p          = lane->d_finalBuffers;
+        lane->d_numBuffers      = lane->d_numFinalBuffers;
+        lane->d_numFinalBuffers = 0;
+    }
+}
+
+/// Store into the specified `results`, at offset `digestSize` times the
+/// index of each message, the digest having the specified `digestSize` of
+/// each of the specified `numMessages` messages whose addresses and lengths
+/// are given by the specified `messages` and `lengths`, computed from the
+/// specified `initialState` using the specified `constants`.  Messages are
+/// hashed in the lanes of `transformLanes`.  The behavior is undefined
+/// unless the processor supports AVX2.
+template<bsl::size_t BUFFER_CAPACITY, class INTEGER, bsl::size_t ARRAY_SIZE>
+void loadDigestsLanes(unsigned char        *results,
+                      bsl::size_t           digestSize,
+                      const INTEGER       (&initialState)[8],
+                      const void *const    *messages,
+                      const bsl::size_t    *lengths,
+                      bsl::size_t           numMessages,
+                      const INTEGER       (&constants)[ARRAY_SIZE])
+{
+    enum {
+        k_NUM_LANES = 32 / sizeof(INTEGER),
+
+        // Once no messages remain to be assigned, the messages in at most
+        // this many active lanes are completed one at a time.
+
+        k_MAX_LANES_TO_FINISH_SINGLY = k_NUM_LANES / 4
+    };
+
+    LaneProgress<BUFFER_CAPACITY> lanes[k_NUM_LANES];
+    bool                          isActive[k_NUM_LANES];
+    INTEGER                       state[8][k_NUM_LANES];
+
+    bsl::size_t nextMessage = 0;
+    bsl::size_t numActive   = 0;
+    for (int lane = 0; lane < k_NUM_LANES; ++lane) {
+        for (int index = 0; index < 8; ++index) {
+            state[index][lane] = initialState[index];
+        }
+        isActive[lane] = nextMessage < numMessages;
+        if (isActive[lane]) {
+            assignLane<INTEGER>(&lanes[lane], messages, lengths, nextMessage);
+            ++nextMessage;
+            ++numActive;
+        }
+    }
+
+    while (numMessages != nextMessage
+        || numActive > k_MAX_LANES_TO_FINISH_SINGLY) {
+        // Advance every active lane by the number of blocks available to all
+        // of them.  Idle lanes hash the blocks of an active lane, and their
+        // results are ignored.
+
+        const unsigned char *blocks[k_NUM_LANES];
+        bsl::uint64_t        numBuffers = ~0ULL;
+        int                  firstActive = -1;
+        for (int lane = 0; lane < k_NUM_LANES; ++lane) {
+            if (isActive[lane]) {
+                if (firstActive < 0) {
+                    firstActive = lane;
+                }
+                numBuffers = bsl::min(numBuffers, lanes[lane].d_numBuffers);
+            }
+        }
+        for (int lane = 0; lane < k_NUM_LANES; ++lane) {
+            blocks[lane] = lanes[isActive[lane] ? lane : firstActive].d_next_p;
+        }
+
+        transformLanes(state, blocks, numBuffers, BUFFER_CAPACITY, constants);
+
+        for (int lane = 0; lane < k_NUM_LANES; ++lane) {
+            if (!isActive[lane]) {
+                continue;                                           // CONTINUE
+            }
+            LaneProgress<BUFFER_CAPACITY>& progress = lanes[lane];
+            progress.d_next_p     += numBuffers * BUFFER_CAPACITY;
+            progress.d_numBuffers -= numBuffers;
+            if (progress.d_numBuffers) {
+                continue;                                           // CONTINUE
+            }
+            if (progress.d_numFinalBuffers) {
+                progress.d_next_p          = progress.d_finalBuffers;
+                progress.d_numBuffers      = progress.d_numFinalBuffers;
+                progress.d_numFinalBuffers = 0;
+                continue;                                           // CONTINUE
+            }
+
+            // The message is complete.
+
+            unsigned char *result = results +
+                                          progress.d_messageIndex * digestSize;
+            for (bsl::size_t index = 0;
+                 index < digestSize / sizeof(INTEGER);
+                 ++index) {
+                unpack(state[index][lane], result + index * sizeof(INTEGER));
+            }
+
+            if (nextMessage != numMessages) {
+                for (int index = 0; index < 8; ++index) {
+                    state[index][lane] = initialState[index];
+                }
+                assignLane<INTEGER>(&progress, messages, lengths, nextMessage);
+                ++nextMessage;
+            }
+            else {
+                isActive[lane] = false;
+                --numActive;
+            }
+        }
+    }
+
+    // Complete the remaining messages one at a time.
+
+    for (int lane = 0; lane < k_NUM_LANES; ++lane) {
+        if (!isActive[lane]) {
+            continue;                                               // CONTINUE
+        }
+        const LaneProgress<BUFFER_CAPACITY>& progress = lanes[lane];
+
+        INTEGER laneState[8];
+        for (int index = 0; index < 8; ++index) {
+            laneState[index] = state[index][lane];
+        }
+        transform(laneState,
+                  progress.d_next_p,
+                  progress.d_numBuffers,
+                  BUFFER_CAPACITY,
+                  constants);
+        transform(laneState,
+                  progress.d_finalBuffers,
+                  progress.d_numFinalBuffers,
+                  BUFFER_CAPACITY,
+                  constants);
+
+        unsigned char *result = results + progress.d_messageIndex * digestSize;
+        for (bsl::size_t index = 0;
+             index < digestSize / sizeof(INTEGER);
+             ++index) {
+            unpack(laneState[index], result + index * sizeof(INTEGER));
+        }
+    }
+}
+
+#endif  // BDLDE_SHA2_X86_ENABLED
+
+/// Return `true` if hashing several messages of the algorithm using words of
+/// the (template parameter) `INTEGER` type in parallel lanes is supported and
+/// faster than hashing them one at a time, and `false` otherwise.
+template <class INTEGER>
+bool useLanes()
+{
+#if defined(BDLDE_SHA2_X86_ENABLED)
+    // A single stream of SHA extension instructions hashes SHA-256 about as
+    // fast as eight AVX2 lanes, without the overhead of the lane schedule.
+
+    return hasAvx2() && (sizeof(INTEGER) == 8 || !hasShaNi());
+#else
+    return false;
+#endif
+}
+
+/// Store into the specified `results`, at offset `digestSize` times the
+/// index of each message, the digest having the specified `digestSize` of
+/// each of the specified `numMessages` messages whose addresses and lengths
+/// are given by the specified `messages` and `lengths`, computed from the
+/// specified `initialState` using the specified `constants`.
+template<bsl::size_t BUFFER_CAPACITY, class INTEGER, bsl::size_t ARRAY_SIZE>
+void loadDigestsImp(unsigned char        *results,
+                    bsl::size_t           digestSize,
+                    const INTEGER       (&initialState)[8],
+                    const void *const    *messages,
+                    const bsl::size_t    *lengths,
+                    bsl::size_t           numMessages,
+                    const INTEGER       (&constants)[ARRAY_SIZE])
+{
+    BSLS_ASSERT(results  || 0 == numMessages);
+    BSLS_ASSERT(messages || 0 == numMessages);
+    BSLS_ASSERT(lengths  || 0 == numMessages);
+
+#if defined(BDLDE_SHA2_X86_ENABLED)
+    if (numMessages > 1 && useLanes<INTEGER>()) {
+        loadDigestsLanes<BUFFER_CAPACITY>(results,
+                                          digestSize,
+                                          initialState,
+                                          messages,
+                                          lengths,
+                                          numMessages,
+                                          constants);
+        return;                                                       // RETURN
+    }
+#endif
+
+    for (bsl::size_t index = 0; index != numMessages; ++index) {
+        hashMessage<BUFFER_CAPACITY>(
+                           results + index * digestSize,
+                           digestSize,
+                           initialState,
+                           static_cast<const unsigned char *>(messages[index]),
+                           lengths[index],
+                           constants);
+    }
+}
+
 /// Store into the specified `output` the hex representation of the bytes in
 /// the specified `input`.
 template<bsl::size_t SIZE>
@@ -346,6 +1278,64 @@ void toHex(char *output, const unsigned char (&input)[SIZE])
 
 } // close unnamed namespace
 
+// CLASS METHODS
+void Sha224::loadDigests(unsigned char     *results,
+                         const void *const *messages,
+                         const bsl::size_t *lengths,
+                         bsl::size_t        numMessages)
+{
+    loadDigestsImp<64>(results,
+                       k_DIGEST_SIZE,
+                       sha224InitialState,
+                       messages,
+                       lengths,
+                       numMessages,
+                       sha256Constants);
+}
+
+void Sha256::loadDigests(unsigned char     *results,
+                         const void *const *messages,
+                         const bsl::size_t *lengths,
+                         bsl::size_t        numMessages)
+{
+    loadDigestsImp<64>(results,
+                       k_DIGEST_SIZE,
+                       sha256InitialState,
+                       messages,
+                       lengths,
+                       numMessages,
+                       sha256Constants);
+}
+
+void Sha384::loadDigests(unsigned char     *results,
+                         const void *const *messages,
+                         const bsl::size_t *lengths,
+                         bsl::size_t        numMessages)
+{
+    loadDigestsImp<128>(results,
+                        k_DIGEST_SIZE,
+                        sha384InitialState,
+                        messages,
+                        lengths,
+                        numMessages,
+                        sha512Constants);
+}
+
+void Sha512::loadDigests(unsigned char     *results,
+                         const void *const *messages,
+                         const bsl::size_t *lengths,
+                         bsl::size_t        numMessages)
+{
+    loadDigestsImp<128>(results,
+                        k_DIGEST_SIZE,
+                        sha512InitialState,
+                        messages,
+                        lengths,
+                        numMessages,
+                        sha512Constants);
+}
+
+// CREATORS
 Sha224::Sha224()
 {
     reset();
@@ -394,64 +1384,28 @@ void Sha224::reset()
 {
     d_totalSize = 0;
     d_bufferSize = 0;
-    // Second 32 bits of the fractional parts of the square root of the 9th
-    // through 16th primes.
-    d_state[0] = 0xc1059ed8;
-    d_state[1] = 0x367cd507;
-    d_state[2] = 0x3070dd17;
-    d_state[3] = 0xf70e5939;
-    d_state[4] = 0xffc00b31;
-    d_state[5] = 0x68581511;
-    d_state[6] = 0x64f98fa7;
-    d_state[7] = 0xbefa4fa4;
+    bsl::copy(sha224InitialState, sha224InitialState + 8, d_state);
 }
 
 void Sha256::reset()
 {
     d_totalSize = 0;
     d_bufferSize = 0;
-    // First 32 bits of the fractional part of the square root of the first 8
-    // primes.
-    d_state[0] = 0x6a09e667;
-    d_state[1] = 0xbb67ae85;
-    d_state[2] = 0x3c6ef372;
-    d_state[3] = 0xa54ff53a;
-    d_state[4] = 0x510e527f;
-    d_state[5] = 0x9b05688c;
-    d_state[6] = 0x1f83d9ab;
-    d_state[7] = 0x5be0cd19;
+    bsl::copy(sha256InitialState, sha256InitialState + 8, d_state);
 }
 
 void Sha384::reset()
 {
     d_totalSize = 0;
     d_bufferSize = 0;
-    // First 64 bits of the fractional parts of the square root of the 9th
-    // through 16th primes.
-    d_state[0] = 0xcbbb9d5dc1059ed8ULL;
-    d_state[1] = 0x629a292a367cd507ULL;
-    d_state[2] = 0x9159015a3070dd17ULL;
-    d_state[3] = 0x152fecd8f70e5939ULL;
-    d_state[4] = 0x67332667ffc00b31ULL;
-    d_state[5] = 0x8eb44a8768581511ULL;
-    d_state[6] = 0xdb0c2e0d64f98fa7ULL;
-    d_state[7] = 0x47b5481dbefa4fa4ULL;
+    bsl::copy(sha384InitialState, sha384InitialState + 8, d_state);
 }
 
 void Sha512::reset()
 {
     d_totalSize = 0;
     d_bufferSize = 0;
-    // First 64 bits of the fractional part of the square root of the first 8
-    // primes.
-    d_state[0] = 0x6a09e667f3bcc908ULL;
-    d_state[1] = 0xbb67ae8584caa73bULL;
-    d_state[2] = 0x3c6ef372fe94f82bULL;
-    d_state[3] = 0xa54ff53a5f1d36f1ULL;
-    d_state[4] = 0x510e527fade682d1ULL;
-    d_state[5] = 0x9b05688c2b3e6c1fULL;
-    d_state[6] = 0x1f83d9abfb41bd6bULL;
-    d_state[7] = 0x5be0cd19137e2179ULL;
+    bsl::copy(sha512InitialState, sha512InitialState + 8, d_state);
 }
 
 void Sha224::update(const void *message, bsl::size_t length)
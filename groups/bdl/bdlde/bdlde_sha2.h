@@ -25,6 +25,27 @@ BSLS_IDENT("$Id$ $CSID$")
 //
 // Note that a SHA-2 digest does not aid in error correction.
 //
+///Hashing Many Messages
+///---------------------
+// Each class provides a class method, `loadDigests`, that computes the digests
+// of several independent, complete, messages in a single call.  The results
+// are identical to those obtained by hashing each message with a separate
+// object, but on x86 processors supporting AVX2 the messages may be hashed
+// several at a time in the lanes of vector registers, which is substantially
+// faster for workloads, such as verifying the blocks of a file or the leaves
+// of a Merkle tree, that hash many short messages.
+//
+///Hardware Acceleration
+///---------------------
+// `Sha224` and `Sha256` use the x86 SHA extensions, or the ARMv8 SHA-256
+// instructions, when the processor on which the program is running supports
+// them, which is detected once at run-time.  No widely-deployed processor
+// provides instructions for the 64-bit algorithms, so `Sha384` and `Sha512`
+// hash single messages with a portable implementation.  All implementations
+// produce identical results.  The ARMv8 implementation is compiled only if
+// `BDLDE_SHA2_ENABLE_ARM_SHA` is defined, since it has not yet been built and
+// tested on ARM hardware.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -76,6 +97,37 @@ BSLS_IDENT("$Id$ $CSID$")
 //     ASSERT(validatePassword(password, salt, expected));
 // }
 // ```
+//
+///Example 2: Hashing Many Messages at Once
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose we store a file as a sequence of blocks, and wish to compute the
+// SHA-256 digest of each block to later detect corruption.
+//
+// First, we describe the blocks, which need not have the same length:
+// ```
+// const char        *blocks[]  = { "first block", "second", "" };
+// const bsl::size_t  lengths[] = { 11, 6, 0 };
+// const bsl::size_t  numBlocks = 3;
+// ```
+// Then, we compute all of the digests with a single call:
+// ```
+// unsigned char digests[numBlocks * bdlde::Sha256::k_DIGEST_SIZE];
+// bdlde::Sha256::loadDigests(digests,
+//                            reinterpret_cast<const void *const *>(blocks),
+//                            lengths,
+//                            numBlocks);
+// ```
+// Finally, we verify that each digest is the same as the one computed by a
+// `Sha256` object:
+// ```
+// for (bsl::size_t i = 0; i != numBlocks; ++i) {
+//     unsigned char expected[bdlde::Sha256::k_DIGEST_SIZE];
+//     bdlde::Sha256(blocks[i], lengths[i]).loadDigest(expected);
+//     ASSERT(bsl::equal(expected,
+//                       expected + bdlde::Sha256::k_DIGEST_SIZE,
+//                       digests  + i * bdlde::Sha256::k_DIGEST_SIZE));
+// }
+// ```
 
 #include <bdlscm_version.h>
 
@@ -125,6 +177,23 @@ class Sha224 {
     /// The size (in bytes) of the output
     static const bsl::size_t k_DIGEST_SIZE = 224 / 8;
 
+    // CLASS METHODS
+
+    /// Load into the specified `results` the SHA-224 digests of the specified
+    /// `numMessages` messages whose addresses and lengths, in bytes, are
+    /// the corresponding elements of the specified `messages` and `lengths`
+    /// arrays, storing the digest of message `i` at `results + i *
+    /// k_DIGEST_SIZE`.  Each digest is identical to the one computed by an
+    /// object of this class to which only the corresponding message has
+    /// been supplied.  The behavior is undefined unless `results` refers to
+    /// at least `numMessages * k_DIGEST_SIZE` bytes, and, for each `i` in
+    /// `[0 .. numMessages)`, `messages[i]` refers to at least `lengths[i]`
+    /// bytes (`messages[i]` may be null if `0 == lengths[i]`).
+    static void loadDigests(unsigned char     *results,
+                            const void *const *messages,
+                            const bsl::size_t *lengths,
+                            bsl::size_t        numMessages);
+
     // CREATORS
 
     /// Construct a SHA-2 digest having the value corresponding to no data
@@ -209,6 +278,23 @@ class Sha256 {
     /// The size (in bytes) of the output
     static const bsl::size_t k_DIGEST_SIZE = 256 / 8;
 
+    // CLASS METHODS
+
+    /// Load into the specified `results` the SHA-256 digests of the specified
+    /// `numMessages` messages whose addresses and lengths, in bytes, are
+    /// the corresponding elements of the specified `messages` and `lengths`
+    /// arrays, storing the digest of message `i` at `results + i *
+    /// k_DIGEST_SIZE`.  Each digest is identical to the one computed by an
+    /// object of this class to which only the corresponding message has
+    /// been supplied.  The behavior is undefined unless `results` refers to
+    /// at least `numMessages * k_DIGEST_SIZE` bytes, and, for each `i` in
+    /// `[0 .. numMessages)`, `messages[i]` refers to at least `lengths[i]`
+    /// bytes (`messages[i]` may be null if `0 == lengths[i]`).
+    static void loadDigests(unsigned char     *results,
+                            const void *const *messages,
+                            const bsl::size_t *lengths,
+                            bsl::size_t        numMessages);
+
     // CREATORS
 
     /// Construct a SHA-2 digest having the value corresponding to no data
@@ -293,6 +379,23 @@ class Sha384 {
     /// The size (in bytes) of the output
     static const bsl::size_t k_DIGEST_SIZE = 384 / 8;
 
+    // CLASS METHODS
+
+    /// Load into the specified `results` the SHA-384 digests of the specified
+    /// `numMessages` messages whose addresses and lengths, in bytes, are
+    /// the corresponding elements of the specified `messages` and `lengths`
+    /// arrays, storing the digest of message `i` at `results + i *
+    /// k_DIGEST_SIZE`.  Each digest is identical to the one computed by an
+    /// object of this class to which only the corresponding message has
+    /// been supplied.  The behavior is undefined unless `results` refers to
+    /// at least `numMessages * k_DIGEST_SIZE` bytes, and, for each `i` in
+    /// `[0 .. numMessages)`, `messages[i]` refers to at least `lengths[i]`
+    /// bytes (`messages[i]` may be null if `0 == lengths[i]`).
+    static void loadDigests(unsigned char     *results,
+                            const void *const *messages,
+                            const bsl::size_t *lengths,
+                            bsl::size_t        numMessages);
+
     // CREATORS
 
     /// Construct a SHA-2 digest having the value corresponding to no data
@@ -377,6 +480,23 @@ class Sha512 {
     /// The size (in bytes) of the output
     static const bsl::size_t k_DIGEST_SIZE = 512 / 8;
 
+    // CLASS METHODS
+
+    /// Load into the specified `results` the SHA-512 digests of the specified
+    /// `numMessages` messages whose addresses and lengths, in bytes, are
+    /// the corresponding elements of the specified `messages` and `lengths`
+    /// arrays, storing the digest of message `i` at `results + i *
+    /// k_DIGEST_SIZE`.  Each digest is identical to the one computed by an
+    /// object of this class to which only the corresponding message has
+    /// been supplied.  The behavior is undefined unless `results` refers to
+    /// at least `numMessages * k_DIGEST_SIZE` bytes, and, for each `i` in
+    /// `[0 .. numMessages)`, `messages[i]` refers to at least `lengths[i]`
+    /// bytes (`messages[i]` may be null if `0 == lengths[i]`).
+    static void loadDigests(unsigned char     *results,
+                            const void *const *messages,
+                            const bsl::size_t *lengths,
+                            bsl::size_t        numMessages);
+
     // CREATORS
 
     /// Construct a SHA-2 digest having the value corresponding to no data
@@ -5,6 +5,7 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
@@ -86,6 +87,12 @@ using namespace bsl;
 //    o void loadDigest(unsigned char *result) const;
 //
 //-----------------------------------------------------------------------------
+// CLASS METHODS
+// [26] void Sha224::loadDigests(uchar *, const void *const *, size_t *, n);
+// [26] void Sha256::loadDigests(uchar *, const void *const *, size_t *, n);
+// [26] void Sha384::loadDigests(uchar *, const void *const *, size_t *, n);
+// [26] void Sha512::loadDigests(uchar *, const void *const *, size_t *, n);
+//
 // CREATORS
 // [ 2] Sha224::Sha224();
 // [ 3] Sha256::Sha256();
@@ -135,7 +142,8 @@ using namespace bsl;
 // [25] bsl::ostream& operator<<(bsl::ostream& stream, const Sha512& digest);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [26] USAGE EXAMPLE
+// [27] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: loadDigests
 // [ *] CONCERN: This test driver is reusable w/other, similar components.
 // [ *] CONCERN: In no case does memory come from the global allocator.
 // [  ] CONCERN: All memory allocation is from the object's allocator.
@@ -340,6 +348,43 @@ void assertPasswordIsExpected()
 
     ASSERT(validatePassword(password, salt, expected));
 }
+// ```
+//
+///Example 2: Hashing Many Messages at Once
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose we store a file as a sequence of blocks, and wish to compute the
+// SHA-256 digest of each block to later detect corruption.
+
+/// Compute the digests of several blocks with a single call, and verify
+/// them against digests computed one block at a time.
+void hashBlocks()
+{
+    // First, we describe the blocks, which need not have the same length:
+    // ```
+    const char        *blocks[]  = { "first block", "second", "" };
+    const bsl::size_t  lengths[] = { 11, 6, 0 };
+    const bsl::size_t  numBlocks = 3;
+    // ```
+    // Then, we compute all of the digests with a single call:
+    // ```
+    unsigned char digests[numBlocks * bdlde::Sha256::k_DIGEST_SIZE];
+    bdlde::Sha256::loadDigests(digests,
+                               reinterpret_cast<const void *const *>(blocks),
+                               lengths,
+                               numBlocks);
+    // ```
+    // Finally, we verify that each digest is the same as the one computed by
+    // a `Sha256` object:
+    // ```
+    for (bsl::size_t i = 0; i != numBlocks; ++i) {
+        unsigned char expected[bdlde::Sha256::k_DIGEST_SIZE];
+        bdlde::Sha256(blocks[i], lengths[i]).loadDigest(expected);
+        ASSERT(bsl::equal(expected,
+                          expected + bdlde::Sha256::k_DIGEST_SIZE,
+                          digests  + i * bdlde::Sha256::k_DIGEST_SIZE));
+    }
+    // ```
+}
 
 // ============================================================================
 //                    GLOBAL HELPER FUNCTIONS FOR TESTING
@@ -450,6 +495,133 @@ void testLoadDigestAndReset(const char (&message)[LENGTH])
     ASSERT(digest1 == digest2);
 }
 
+/// Verify that `HASHER::loadDigests` produces, for batches of various sizes
+/// of messages having various lengths and alignments, the same digests as
+/// hashing each message with a separate `HASHER` object, and that it writes
+/// nothing beyond the digests.
+template<class HASHER>
+void testLoadDigests()
+{
+    const bsl::size_t k_DIGEST_SIZE  = HASHER::k_DIGEST_SIZE;
+    const bsl::size_t k_MAX_MESSAGES = 20;
+    const bsl::size_t k_MAX_LENGTH   = 600;
+
+    // Lengths around the block boundaries of both block sizes, to be mixed
+    // with pseudo-random lengths.
+
+    const bsl::size_t k_EDGE_LENGTHS[] = {
+        0, 1, 55, 56, 63, 64, 65, 111, 112, 119, 120, 127, 128, 129, 255, 256
+    };
+
+    bsl::vector<unsigned char> data(k_MAX_LENGTH + 8);
+    for (bsl::size_t index = 0; index != data.size(); ++index) {
+        data[index] = static_cast<unsigned char>(index * 7 + index / 256);
+    }
+
+    unsigned int seed = 12345;
+    for (bsl::size_t numMessages = 0;
+         numMessages <= k_MAX_MESSAGES;
+         ++numMessages) {
+        for (int trial = 0; trial < 10; ++trial) {
+            const void    *messages[k_MAX_MESSAGES];
+            bsl::size_t    lengths[k_MAX_MESSAGES];
+            unsigned char  results[(k_MAX_MESSAGES + 1) * k_DIGEST_SIZE];
+
+            for (bsl::size_t index = 0; index != numMessages; ++index) {
+                seed = seed * 1103515245 + 12345;
+                const unsigned int random = seed >> 8;
+                lengths[index] = 0 == random % 3
+                             ? k_EDGE_LENGTHS[random / 3
+                                              % arraySize(k_EDGE_LENGTHS)]
+                             : random / 3 % (k_MAX_LENGTH + 1);
+                messages[index] = 0 == lengths[index] && trial % 2
+                                ? 0
+                                : &data[random % 8];
+            }
+            bsl::fill(results, results + sizeof results, 0xa5);
+
+            HASHER::loadDigests(results, messages, lengths, numMessages);
+
+            for (bsl::size_t index = 0; index != numMessages; ++index) {
+                unsigned char expected[k_DIGEST_SIZE];
+                HASHER(messages[index], lengths[index]).loadDigest(expected);
+                ASSERTV(numMessages, trial, index, lengths[index],
+                        bsl::equal(expected,
+                                   expected + k_DIGEST_SIZE,
+                                   results + index * k_DIGEST_SIZE));
+            }
+            for (bsl::size_t index = numMessages * k_DIGEST_SIZE;
+                 index != sizeof results;
+                 ++index) {
+                ASSERTV(numMessages, trial, index, 0xa5 == results[index]);
+            }
+        }
+    }
+
+    // Messages of very different lengths in the same batch.
+
+    bsl::vector<unsigned char> large(100000, 'x');
+    const void        *messages[] = { &large[0], "abc", &large[1], "" };
+    const bsl::size_t  lengths[]  = { large.size(), 3, 3000, 0 };
+    unsigned char      results[4 * k_DIGEST_SIZE];
+    HASHER::loadDigests(results, messages, lengths, 4);
+    for (bsl::size_t index = 0; index != 4; ++index) {
+        unsigned char expected[k_DIGEST_SIZE];
+        HASHER(messages[index], lengths[index]).loadDigest(expected);
+        ASSERTV(index, bsl::equal(expected,
+                                  expected + k_DIGEST_SIZE,
+                                  results + index * k_DIGEST_SIZE));
+    }
+}
+
+/// Report the throughput of hashing the specified `numMessages` messages of
+/// the specified `length` with `HASHER` objects and with
+/// `HASHER::loadDigests`, labeling the output with the specified `name`.
+template<class HASHER>
+void timeLoadDigests(const char  *name,
+                     bsl::size_t  numMessages,
+                     bsl::size_t  length)
+{
+    const int k_ITERATIONS = 20;
+
+    bsl::vector<unsigned char>  data(numMessages * length + 1, 'a');
+    bsl::vector<const void *>   messages(numMessages);
+    bsl::vector<bsl::size_t>    lengths(numMessages, length);
+    bsl::vector<unsigned char>  results(numMessages * HASHER::k_DIGEST_SIZE);
+    for (bsl::size_t index = 0; index != numMessages; ++index) {
+        messages[index] = &data[index * length];
+    }
+
+    const double k_MB = static_cast<double>(numMessages * length) *
+                                                  k_ITERATIONS / (1024 * 1024);
+
+    bsls::Stopwatch timer;
+    timer.start();
+    for (int i = 0; i < k_ITERATIONS; ++i) {
+        for (bsl::size_t index = 0; index != numMessages; ++index) {
+            HASHER(messages[index], length).loadDigest(
+                                      &results[index * HASHER::k_DIGEST_SIZE]);
+        }
+    }
+    timer.stop();
+    const double single = k_MB / timer.elapsedTime();
+
+    timer.reset();
+    timer.start();
+    for (int i = 0; i < k_ITERATIONS; ++i) {
+        HASHER::loadDigests(&results[0],
+                            &messages[0],
+                            &lengths[0],
+                            numMessages);
+    }
+    timer.stop();
+    const double batch = k_MB / timer.elapsedTime();
+
+    cout << name << ", " << numMessages << " x " << length << " bytes: "
+         << single << " MB/s singly, " << batch << " MB/s by loadDigests"
+         << endl;
+}
+
 /// Test that the member function `print` and the stream operator (`<<`)
 /// both output the correct value when for each element of the specified
 /// `expected`.
@@ -513,7 +685,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << '\n';
 
     switch (test) { case 0:
-      case 26: {
+      case 27: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -524,7 +696,8 @@ int main(int argc, char *argv[])
         //   compile, link, and run on all platforms as shown.
         //
         // Plan:
-        //   Run the usage example function `assertPasswordIsExpected`.
+        //   Run the usage example functions `assertPasswordIsExpected` and
+        //   `hashBlocks`.
         //
         // Testing:
         //   Usage example.
@@ -534,6 +707,47 @@ int main(int argc, char *argv[])
                           << "=====================" "\n";
 
         assertPasswordIsExpected();
+        hashBlocks();
+      } break;
+      case 26: {
+        // --------------------------------------------------------------------
+        // TESTING `loadDigests`
+        //
+        // Concerns:
+        // 1. Each digest loaded by `loadDigests` is the same as the digest of
+        //    the corresponding message computed by an object, for messages of
+        //    any length and alignment, and regardless of the number of
+        //    messages hashed together and of the lengths of the others.
+        //
+        // 2. Nothing is written beyond the last digest, and nothing at all is
+        //    written if no messages are supplied.
+        //
+        // 3. A null address may be supplied for a message of length 0.
+        //
+        // Plan:
+        // 1. For each class, and for batches of 0 to 20 messages having
+        //    pseudo-random lengths (biased towards the boundaries of the
+        //    blocks) and alignments, compare the result of `loadDigests` with
+        //    the digests computed by objects, and verify that the bytes
+        //    following the digests are unchanged.  (C-1..3)
+        //
+        // 2. For each class, hash together messages of very different
+        //    lengths, and compare the results as in P-1.  (C-1)
+        //
+        // Testing:
+        //   void Sha224::loadDigests(uchar *, const void *const *, ...);
+        //   void Sha256::loadDigests(uchar *, const void *const *, ...);
+        //   void Sha384::loadDigests(uchar *, const void *const *, ...);
+        //   void Sha512::loadDigests(uchar *, const void *const *, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING `loadDigests`" "\n"
+                          << "=====================" "\n";
+
+        testLoadDigests<bdlde::Sha224>();
+        testLoadDigests<bdlde::Sha256>();
+        testLoadDigests<bdlde::Sha384>();
+        testLoadDigests<bdlde::Sha512>();
       } break;
       case 25: {
         // --------------------------------------------------------------------
@@ -1254,6 +1468,34 @@ int main(int argc, char *argv[])
             ASSERT(hasher == hasher);
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: loadDigests
+        //
+        // Concerns:
+        // 1. Hashing many short messages with `loadDigests` is at least as
+        //    fast as hashing them one at a time.
+        //
+        // Plan:
+        // 1. For each class, time hashing a batch of messages of several
+        //    lengths both ways, and report the throughput.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: loadDigests
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "PERFORMANCE TEST: loadDigests" "\n"
+                          << "=============================" "\n";
+
+        const bsl::size_t k_LENGTHS[] = { 64, 1024, 4096 };
+        for (bsl::size_t index = 0; index != arraySize(k_LENGTHS); ++index) {
+            const bsl::size_t length      = k_LENGTHS[index];
+            const bsl::size_t numMessages = 16 * 1024 * 1024 / length / 4;
+
+            timeLoadDigests<bdlde::Sha256>("SHA-256", numMessages, length);
+            timeLoadDigests<bdlde::Sha512>("SHA-512", numMessages, length);
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." "\n";
         testStatus = -1;
@@ -0,0 +1,758 @@
+// bdlde_utf8bulkutil.cpp                                             -*-C++-*-
+#include <bdlde_utf8bulkutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlde_utf8bulkutil_cpp,"$Id$ $CSID$")
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstring.h>
+
+#if defined(BSLS_PLATFORM_CPU_SSE4_1)
+#include <emmintrin.h>
+#include <smmintrin.h>
+#include <tmmintrin.h>
+#define BDLDE_UTF8BULKUTIL_SSE_ENABLED 1
+#endif
+
+#if defined(BDLDE_UTF8BULKUTIL_SSE_ENABLED)                                   \
+ && defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ && (defined(BSLS_PLATFORM_CMP_GNU) || defined(BSLS_PLATFORM_CMP_CLANG))
+#include <cpuid.h>
+#include <immintrin.h>
+#define BDLDE_UTF8BULKUTIL_AVX2_ENABLED 1
+#define BDLDE_UTF8BULKUTIL_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+///Implementation Notes
+///--------------------
+// Validation follows Keiser and Lemire: every byte is checked together with
+// the one to three bytes preceding it, so a block of input is validated by
+// shifting in the trailing bytes of the previous block.  Most errors are
+// detected by looking up the high nibble of the preceding byte, the low nibble
+// of the preceding byte, and the high nibble of the current byte in three
+// 16-entry tables, each of whose entries is a set of bits naming the errors
+// that are *possible* given that nibble; an error is present exactly where
+// all three lookups share a bit.  The remaining error -- a missing second or
+// third continuation byte after a three- or four-byte lead -- is detected by
+// comparing the bytes two and three positions back against `0xe0` and `0xf0`.
+// A block made up entirely of ASCII needs no checking beyond verifying that
+// the previous block did not end inside a multi-byte sequence.
+//
+// A vector kernel stops at the first block in which an error is detected (or
+// when fewer than a full block of input remains), backs up to the start of the
+// last sequence that might extend into that block, and leaves the remainder to
+// the portable scalar validator, which finds the precise end of the longest
+// valid prefix.  Code points are counted by counting the bytes that are not
+// continuation bytes (i.e., not of the form `10xxxxxx`).
+
+namespace BloombergLP {
+namespace {
+namespace u {
+
+typedef unsigned long long Uint64;
+
+enum {
+    k_BLOCK_SIZE = 16  // number of bytes processed by one SSE iteration
+};
+
+// the high bit of each byte of an 8-byte word
+const Uint64 k_HIGH_BITS_8 = 0x8080808080808080ULL;
+
+                          // ===============
+                          // Scalar Routines
+                          // ===============
+
+/// Return `true` if the specified `byte` is a continuation byte (i.e., of the
+/// form `10xxxxxx`), and `false` otherwise.
+inline
+bool isContinuation(unsigned char byte)
+{
+    return 0x80 == (byte & 0xc0);
+}
+
+/// Return `true` if none of the 8 bytes beginning at the specified `input`
+/// have their high bit set, and `false` otherwise.
+inline
+bool isAscii8(const char *input)
+{
+    Uint64 word;
+    bsl::memcpy(&word, input, sizeof word);
+    return 0 == (word & k_HIGH_BITS_8);
+}
+
+/// Return the length of the longest prefix of the specified `input` having
+/// the specified `length` that consists of ASCII characters, examining 8
+/// bytes at a time.
+bsl::size_t numAsciiBytesScalar(const char *input, bsl::size_t length)
+{
+    bsl::size_t ii = 0;
+    for (; ii + 8 <= length && isAscii8(input + ii); ii += 8) {
+    }
+    for (; ii < length && 0 == (0x80 & input[ii]); ++ii) {
+    }
+    return ii;
+}
+
+/// Return the length of the longest prefix of the specified `input` having
+/// the specified `length` that is valid UTF-8, and add the number of code
+/// points in that prefix to the specified `numCodePoints`.
+bsl::size_t validateScalar(bsl::size_t *numCodePoints,
+                           const char  *input,
+                           bsl::size_t  length)
+{
+    const unsigned char *p   = reinterpret_cast<const unsigned char *>(input);
+    const unsigned char *end = p + length;
+
+    bsl::size_t count = 0;
+
+    while (p < end) {
+        const unsigned char c = *p;
+
+        if (c < 0x80) {
+            if (8 <= end - p && isAscii8(reinterpret_cast<const char *>(p))) {
+                p     += 8;
+                count += 8;
+            }
+            else {
+                ++p;
+                ++count;
+            }
+            continue;
+        }
+
+        const bsls::Types::IntPtr left = end - p;
+
+        if (c < 0xc2) {
+            // Continuation byte, or the lead of an overlong two-byte
+            // sequence.
+
+            break;
+        }
+        else if (c < 0xe0) {
+            if (left < 2 || !isContinuation(p[1])) {
+                break;
+            }
+            p += 2;
+        }
+        else if (c < 0xf0) {
+            if (left < 3 || !isContinuation(p[2])) {
+                break;
+            }
+            const unsigned char lo = 0xe0 == c ? 0xa0 : 0x80;
+            const unsigned char hi = 0xed == c ? 0x9f : 0xbf;
+            if (p[1] < lo || hi < p[1]) {
+                break;
+            }
+            p += 3;
+        }
+        else if (c < 0xf5) {
+            if (left < 4 || !isContinuation(p[2]) || !isContinuation(p[3])) {
+                break;
+            }
+            const unsigned char lo = 0xf0 == c ? 0x90 : 0x80;
+            const unsigned char hi = 0xf4 == c ? 0x8f : 0xbf;
+            if (p[1] < lo || hi < p[1]) {
+                break;
+            }
+            p += 4;
+        }
+        else {
+            break;
+        }
+        ++count;
+    }
+
+    *numCodePoints += count;
+    return p - reinterpret_cast<const unsigned char *>(input);
+}
+
+#if defined(BDLDE_UTF8BULKUTIL_SSE_ENABLED)
+
+                          // =====================
+                          // Validation Error Bits
+                          // =====================
+
+// Each of the following bits names a way in which a byte, taken together with
+// the byte preceding it, can fail to be valid UTF-8.
+
+enum {
+    e_TOO_SHORT      = 1 << 0,  // lead byte not followed by a continuation
+    e_TOO_LONG       = 1 << 1,  // ASCII byte followed by a continuation
+    e_OVERLONG_3     = 1 << 2,  // `e0 [80 .. 9f]`
+    e_TOO_LARGE      = 1 << 3,  // `f4 [90 .. bf]`, or `[f5 .. ff] cont`
+    e_SURROGATE      = 1 << 4,  // `ed [a0 .. bf]`
+    e_OVERLONG_2     = 1 << 5,  // `[c0 .. c1] cont`
+    e_TOO_LARGE_1000 = 1 << 6,  // `[f5 .. ff] 80`, ...
+    e_OVERLONG_4     = 1 << 6,  // `f0 [80 .. 8f]`
+    e_TWO_CONTS      = 1 << 7,  // two continuation bytes in a row
+    e_CARRY          = e_TOO_SHORT | e_TOO_LONG | e_TWO_CONTS
+};
+
+// The following tables are indexed by the high nibble of the preceding byte,
+// by the low nibble of the preceding byte, and by the high nibble of the
+// current byte, respectively.
+
+const unsigned char byte1HighTable[16] = {
+    // 0xxx: ASCII
+    e_TOO_LONG, e_TOO_LONG, e_TOO_LONG, e_TOO_LONG,
+    e_TOO_LONG, e_TOO_LONG, e_TOO_LONG, e_TOO_LONG,
+    // 10xx: continuation
+    e_TWO_CONTS, e_TWO_CONTS, e_TWO_CONTS, e_TWO_CONTS,
+    // 1100: two-byte lead, possibly overlong
+    e_TOO_SHORT | e_OVERLONG_2,
+    // 1101: two-byte lead
+    e_TOO_SHORT,
+    // 1110: three-byte lead
+    e_TOO_SHORT | e_OVERLONG_3 | e_SURROGATE,
+    // 1111: four-byte lead
+    e_TOO_SHORT | e_TOO_LARGE | e_TOO_LARGE_1000 | e_OVERLONG_4
+};
+
+const unsigned char byte1LowTable[16] = {
+    // xxxx0000
+    e_CARRY | e_OVERLONG_3 | e_OVERLONG_2 | e_OVERLONG_4,
+    // xxxx0001
+    e_CARRY | e_OVERLONG_2,
+    // xxxx001x
+    e_CARRY,
+    e_CARRY,
+    // xxxx0100
+    e_CARRY | e_TOO_LARGE,
+    // xxxx0101 .. xxxx1100
+    e_CARRY | e_TOO_LARGE | e_TOO_LARGE_1000,
+    e_CARRY | e_TOO_LARGE | e_TOO_LARGE_1000,
+    e_CARRY | e_TOO_LARGE | e_TOO_LARGE_1000,
+    e_CARRY | e_TOO_LARGE | e_TOO_LARGE_1000,
+    e_CARRY | e_TOO_LARGE | e_TOO_LARGE_1000,
+    e_CARRY | e_TOO_LARGE | e_TOO_LARGE_1000,
+    e_CARRY | e_TOO_LARGE | e_TOO_LARGE_1000,
+    e_CARRY | e_TOO_LARGE | e_TOO_LARGE_1000,
+    // xxxx1101
+    e_CARRY | e_TOO_LARGE | e_TOO_LARGE_1000 | e_SURROGATE,
+    // xxxx111x
+    e_CARRY | e_TOO_LARGE | e_TOO_LARGE_1000,
+    e_CARRY | e_TOO_LARGE | e_TOO_LARGE_1000
+};
+
+const unsigned char byte2HighTable[16] = {
+    // 0xxx: ASCII
+    e_TOO_SHORT, e_TOO_SHORT, e_TOO_SHORT, e_TOO_SHORT,
+    e_TOO_SHORT, e_TOO_SHORT, e_TOO_SHORT, e_TOO_SHORT,
+    // 1000
+    e_TOO_LONG | e_OVERLONG_2 | e_TWO_CONTS | e_OVERLONG_3 |
+                                             e_TOO_LARGE_1000 | e_OVERLONG_4,
+    // 1001
+    e_TOO_LONG | e_OVERLONG_2 | e_TWO_CONTS | e_OVERLONG_3 | e_TOO_LARGE,
+    // 101x
+    e_TOO_LONG | e_OVERLONG_2 | e_TWO_CONTS | e_SURROGATE  | e_TOO_LARGE,
+    e_TOO_LONG | e_OVERLONG_2 | e_TWO_CONTS | e_SURROGATE  | e_TOO_LARGE,
+    // 11xx: lead
+    e_TOO_SHORT, e_TOO_SHORT, e_TOO_SHORT, e_TOO_SHORT
+};
+
+// The following table holds, for each position in a block, the greatest byte
+// value that does not start a sequence extending past the end of the block.
+
+const unsigned char maxCompleteTable[16] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdf, 0xbf
+};
+
+                            // ============
+                            // SSE Routines
+                            // ============
+
+/// Return the offset, within the specified `input`, of the start of the last
+/// sequence beginning in the three bytes before the specified `offset` that
+/// might not be complete within the first `offset` bytes, or `offset` if
+/// there is no such sequence, and, in the former case, decrement the
+/// specified `numCodePoints` to reflect that the sequence is excluded.  The
+/// behavior is undefined unless the first `offset` bytes of `input` are valid
+/// UTF-8 except, possibly, for a truncated sequence at their end.
+bsl::size_t backUpToCodePoint(bsl::size_t *numCodePoints,
+                              const char  *input,
+                              bsl::size_t  offset)
+{
+    const unsigned char *p = reinterpret_cast<const unsigned char *>(input);
+
+    for (bsl::size_t ii = 1; ii <= 3 && ii <= offset; ++ii) {
+        const unsigned char c = p[offset - ii];
+        if (c < 0x80) {
+            break;
+        }
+        if (0xc0 <= c) {
+            --*numCodePoints;
+            return offset - ii;                                       // RETURN
+        }
+    }
+    return offset;
+}
+
+/// Return a vector of error bits for each byte of the specified `input`
+/// block, given the specified `previous` block.  The result is zero if and
+/// only if no error is detected.
+inline
+__m128i checkBlockSse(__m128i input, __m128i previous)
+{
+    const __m128i nibbleMask = _mm_set1_epi8(0x0f);
+
+    const __m128i prev1 = _mm_alignr_epi8(input, previous, 15);
+    const __m128i prev2 = _mm_alignr_epi8(input, previous, 14);
+    const __m128i prev3 = _mm_alignr_epi8(input, previous, 13);
+
+    const __m128i byte1High = _mm_shuffle_epi8(
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(byte1HighTable)),
+            _mm_and_si128(_mm_srli_epi16(prev1, 4), nibbleMask));
+    const __m128i byte1Low = _mm_shuffle_epi8(
+             _mm_loadu_si128(reinterpret_cast<const __m128i *>(byte1LowTable)),
+             _mm_and_si128(prev1, nibbleMask));
+    const __m128i byte2High = _mm_shuffle_epi8(
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(byte2HighTable)),
+            _mm_and_si128(_mm_srli_epi16(input, 4), nibbleMask));
+
+    const __m128i special = _mm_and_si128(_mm_and_si128(byte1High, byte1Low),
+                                          byte2High);
+
+    const __m128i isThird  = _mm_subs_epu8(prev2, _mm_set1_epi8(0x60));
+    const __m128i isFourth = _mm_subs_epu8(prev3, _mm_set1_epi8(0x70));
+    const __m128i must23   = _mm_and_si128(_mm_or_si128(isThird, isFourth),
+                                           _mm_set1_epi8(char(0x80)));
+
+    return _mm_xor_si128(must23, special);
+}
+
+/// Return the length of a prefix of the specified `input` having the
+/// specified `length` that is valid UTF-8, processing 16 bytes at a time, and
+/// add the number of code points in that prefix to the specified
+/// `numCodePoints`.  The returned prefix is not necessarily the longest.
+bsl::size_t validateSse(bsl::size_t *numCodePoints,
+                        const char  *input,
+                        bsl::size_t  length)
+{
+    const __m128i maxComplete = _mm_loadu_si128(
+                         reinterpret_cast<const __m128i *>(maxCompleteTable));
+    const __m128i lastCont    = _mm_set1_epi8(-64);  // `0xc0`
+
+    __m128i     previous   = _mm_setzero_si128();
+    __m128i     incomplete = _mm_setzero_si128();
+    bsl::size_t count      = 0;
+    bsl::size_t ii         = 0;
+
+    for (; ii + k_BLOCK_SIZE <= length; ii += k_BLOCK_SIZE) {
+        const __m128i block = _mm_loadu_si128(
+                            reinterpret_cast<const __m128i *>(input + ii));
+        const int     nonAscii = _mm_movemask_epi8(block);
+
+        if (0 == nonAscii) {
+            if (!_mm_testz_si128(incomplete, incomplete)) {
+                break;
+            }
+            count += k_BLOCK_SIZE;
+        }
+        else {
+            const __m128i error = checkBlockSse(block, previous);
+            if (!_mm_testz_si128(error, error)) {
+                break;
+            }
+            const int conts = _mm_movemask_epi8(_mm_cmplt_epi8(block,
+                                                               lastCont));
+            count += k_BLOCK_SIZE - __builtin_popcount(conts);
+        }
+        previous   = block;
+        incomplete = _mm_subs_epu8(block, maxComplete);
+    }
+
+    ii = backUpToCodePoint(&count, input, ii);
+
+    *numCodePoints += count;
+    return ii;
+}
+
+/// Return the length of the longest prefix of the specified `input` having
+/// the specified `length` that consists of ASCII characters, examining 16
+/// bytes at a time.
+bsl::size_t numAsciiBytesSse(const char *input, bsl::size_t length)
+{
+    bsl::size_t ii = 0;
+    for (; ii + k_BLOCK_SIZE <= length; ii += k_BLOCK_SIZE) {
+        const int nonAscii = _mm_movemask_epi8(_mm_loadu_si128(
+                               reinterpret_cast<const __m128i *>(input + ii)));
+        if (nonAscii) {
+            return ii + __builtin_ctz(nonAscii);                      // RETURN
+        }
+    }
+    return ii + numAsciiBytesScalar(input + ii, length - ii);
+}
+
+#endif  // BDLDE_UTF8BULKUTIL_SSE_ENABLED
+
+#if defined(BDLDE_UTF8BULKUTIL_AVX2_ENABLED)
+
+                            // =============
+                            // AVX2 Routines
+                            // =============
+
+/// Return `true` if the processor on which this program is running, and the
+/// operating system, support AVX2 instructions, and `false` otherwise.
+bool isAvx2Supported()
+{
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)
+     || bit_OSXSAVE != (ecx & bit_OSXSAVE)
+     || bit_AVX     != (ecx & bit_AVX)) {
+        return false;                                                 // RETURN
+    }
+
+    unsigned int xcr0Lo, xcr0Hi;
+    __asm__ __volatile__("xgetbv" : "=a"(xcr0Lo), "=d"(xcr0Hi) : "c"(0));
+    if (6 != (xcr0Lo & 6)) {
+        // The operating system does not preserve the YMM registers.
+
+        return false;                                                 // RETURN
+    }
+
+    if (__get_cpuid_max(0, 0) < 7) {
+        return false;                                                 // RETURN
+    }
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    return 0 != (ebx & bit_AVX2);
+}
+
+/// Return the result of `isAvx2Supported`, computed once.
+bool hasAvx2()
+{
+    static const bool result = isAvx2Supported();
+    return result;
+}
+
+/// Return the specified `input` block shifted up by the specified `N` bytes,
+/// with the trailing `N` bytes of the specified `previous` block shifted in.
+template <int N>
+BDLDE_UTF8BULKUTIL_AVX2_TARGET inline
+__m256i prevAvx2(__m256i input, __m256i previous)
+{
+    return _mm256_alignr_epi8(input,
+                              _mm256_permute2x128_si256(previous, input, 0x21),
+                              16 - N);
+}
+
+/// Load the specified 16-byte `table` into both lanes of a vector.
+BDLDE_UTF8BULKUTIL_AVX2_TARGET inline
+__m256i loadTableAvx2(const unsigned char *table)
+{
+    const __m128i *lane = reinterpret_cast<const __m128i *>(table);
+    return _mm256_broadcastsi128_si256(_mm_loadu_si128(lane));
+}
+
+/// Return a vector of error bits for each byte of the specified `input`
+/// block, given the specified `previous` block.  The result is zero if and
+/// only if no error is detected.
+BDLDE_UTF8BULKUTIL_AVX2_TARGET inline
+__m256i checkBlockAvx2(__m256i input, __m256i previous)
+{
+    const __m256i nibbleMask = _mm256_set1_epi8(0x0f);
+
+    const __m256i prev1 = prevAvx2<1>(input, previous);
+    const __m256i prev2 = prevAvx2<2>(input, previous);
+    const __m256i prev3 = prevAvx2<3>(input, previous);
+
+    const __m256i byte1High = _mm256_shuffle_epi8(
+                          loadTableAvx2(byte1HighTable),
+                          _mm256_and_si256(_mm256_srli_epi16(prev1, 4),
+                                           nibbleMask));
+    const __m256i byte1Low = _mm256_shuffle_epi8(
+                                      loadTableAvx2(byte1LowTable),
+                                      _mm256_and_si256(prev1, nibbleMask));
+    const __m256i byte2High = _mm256_shuffle_epi8(
+                          loadTableAvx2(byte2HighTable),
+                          _mm256_and_si256(_mm256_srli_epi16(input, 4),
+                                           nibbleMask));
+
+    const __m256i special = _mm256_and_si256(
+                                      _mm256_and_si256(byte1High, byte1Low),
+                                      byte2High);
+
+    const __m256i isThird  = _mm256_subs_epu8(prev2, _mm256_set1_epi8(0x60));
+    const __m256i isFourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8(0x70));
+    const __m256i must23   = _mm256_and_si256(
+                                        _mm256_or_si256(isThird, isFourth),
+                                        _mm256_set1_epi8(char(0x80)));
+
+    return _mm256_xor_si256(must23, special);
+}
+
+/// Return the length of a prefix of the specified `input` having the
+/// specified `length` that is valid UTF-8, processing 32 bytes at a time, and
+/// add the number of code points in that prefix to the specified
+/// `numCodePoints`.  The returned prefix is not necessarily the longest.
+BDLDE_UTF8BULKUTIL_AVX2_TARGET
+bsl::size_t validateAvx2(bsl::size_t *numCodePoints,
+                         const char  *input,
+                         bsl::size_t  length)
+{
+    const __m256i maxComplete = _mm256_inserti128_si256(
+                                    _mm256_set1_epi8(char(0xff)),
+                                    _mm_loadu_si128(
+                         reinterpret_cast<const __m128i *>(maxCompleteTable)),
+                                    1);
+    const __m256i lastCont    = _mm256_set1_epi8(-64);  // `0xc0`
+
+    __m256i     previous   = _mm256_setzero_si256();
+    __m256i     incomplete = _mm256_setzero_si256();
+    bsl::size_t count      = 0;
+    bsl::size_t ii         = 0;
+
+    for (; ii + 2 * k_BLOCK_SIZE <= length; ii += 2 * k_BLOCK_SIZE) {
+        const __m256i block = _mm256_loadu_si256(
+                            reinterpret_cast<const __m256i *>(input + ii));
+        const int     nonAscii = _mm256_movemask_epi8(block);
+
+        if (0 == nonAscii) {
+            if (!_mm256_testz_si256(incomplete, incomplete)) {
+                break;
+            }
+            count += 2 * k_BLOCK_SIZE;
+        }
+        else {
+            const __m256i error = checkBlockAvx2(block, previous);
+            if (!_mm256_testz_si256(error, error)) {
+                break;
+            }
+            const unsigned int conts = _mm256_movemask_epi8(
+                                         _mm256_cmpgt_epi8(lastCont, block));
+            count += 2 * k_BLOCK_SIZE - __builtin_popcount(conts);
+        }
+        previous   = block;
+        incomplete = _mm256_subs_epu8(block, maxComplete);
+    }
+
+    ii = backUpToCodePoint(&count, input, ii);
+
+    *numCodePoints += count;
+    return ii;
+}
+
+/// Return the length of the longest prefix of the specified `input` having
+/// the specified `length` that consists of ASCII characters, examining 32
+/// bytes at a time.
+BDLDE_UTF8BULKUTIL_AVX2_TARGET
+bsl::size_t numAsciiBytesAvx2(const char *input, bsl::size_t length)
+{
+    bsl::size_t ii = 0;
+    for (; ii + 2 * k_BLOCK_SIZE <= length; ii += 2 * k_BLOCK_SIZE) {
+        const unsigned int nonAscii = _mm256_movemask_epi8(
+                             _mm256_loadu_si256(
+                               reinterpret_cast<const __m256i *>(input + ii)));
+        if (nonAscii) {
+            return ii + __builtin_ctz(nonAscii);                      // RETURN
+        }
+    }
+    return ii + numAsciiBytesSse(input + ii, length - ii);
+}
+
+#endif  // BDLDE_UTF8BULKUTIL_AVX2_ENABLED
+
+}  // close namespace u
+}  // close unnamed namespace
+
+namespace bdlde {
+
+                            // -------------------
+                            // struct Utf8BulkUtil
+                            // -------------------
+
+// CLASS METHODS
+bsl::size_t Utf8BulkUtil::narrowAsciiPrefix(char                 *result,
+                                            const unsigned short *input,
+                                            bsl::size_t           length)
+{
+    BSLS_ASSERT(result || 0 == length);
+    BSLS_ASSERT(input  || 0 == length);
+
+    bsl::size_t ii = 0;
+
+#if defined(BDLDE_UTF8BULKUTIL_SSE_ENABLED)
+    const __m128i highBits = _mm_set1_epi16(static_cast<short>(0xff80));
+
+    for (; ii + u::k_BLOCK_SIZE <= length; ii += u::k_BLOCK_SIZE) {
+        const __m128i *src = reinterpret_cast<const __m128i *>(input + ii);
+        const __m128i  lo  = _mm_loadu_si128(src);
+        const __m128i  hi  = _mm_loadu_si128(src + 1);
+        if (!_mm_testz_si128(_mm_or_si128(lo, hi), highBits)) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(result + ii),
+                         _mm_packus_epi16(lo, hi));
+    }
+#endif
+
+    for (; ii < length && input[ii] < 0x80; ++ii) {
+        result[ii] = static_cast<char>(input[ii]);
+    }
+    return ii;
+}
+
+bsl::size_t Utf8BulkUtil::narrowAsciiPrefix(char                 *result,
+                                            const unsigned int   *input,
+                                            bsl::size_t           length)
+{
+    BSLS_ASSERT(result || 0 == length);
+    BSLS_ASSERT(input  || 0 == length);
+
+    bsl::size_t ii = 0;
+
+#if defined(BDLDE_UTF8BULKUTIL_SSE_ENABLED)
+    const __m128i highBits = _mm_set1_epi32(static_cast<int>(0xffffff80));
+
+    for (; ii + u::k_BLOCK_SIZE <= length; ii += u::k_BLOCK_SIZE) {
+        const __m128i *src = reinterpret_cast<const __m128i *>(input + ii);
+        const __m128i  w0  = _mm_loadu_si128(src);
+        const __m128i  w1  = _mm_loadu_si128(src + 1);
+        const __m128i  w2  = _mm_loadu_si128(src + 2);
+        const __m128i  w3  = _mm_loadu_si128(src + 3);
+        const __m128i  all = _mm_or_si128(_mm_or_si128(w0, w1),
+                                          _mm_or_si128(w2, w3));
+        if (!_mm_testz_si128(all, highBits)) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(result + ii),
+                         _mm_packus_epi16(_mm_packus_epi32(w0, w1),
+                                          _mm_packus_epi32(w2, w3)));
+    }
+#endif
+
+    for (; ii < length && input[ii] < 0x80; ++ii) {
+        result[ii] = static_cast<char>(input[ii]);
+    }
+    return ii;
+}
+
+bsl::size_t Utf8BulkUtil::numAsciiBytes(const char *input, bsl::size_t length)
+{
+    BSLS_ASSERT(input || 0 == length);
+
+#if defined(BDLDE_UTF8BULKUTIL_AVX2_ENABLED)
+    if (u::hasAvx2()) {
+        return u::numAsciiBytesAvx2(input, length);                   // RETURN
+    }
+#endif
+#if defined(BDLDE_UTF8BULKUTIL_SSE_ENABLED)
+    return u::numAsciiBytesSse(input, length);
+#else
+    return u::numAsciiBytesScalar(input, length);
+#endif
+}
+
+bsl::size_t Utf8BulkUtil::validatePrefix(bsl::size_t *numCodePoints,
+                                         const char  *input,
+                                         bsl::size_t  length)
+{
+    BSLS_ASSERT(numCodePoints);
+    BSLS_ASSERT(input || 0 == length);
+
+    bsl::size_t count  = 0;
+    bsl::size_t offset = 0;
+
+#if defined(BDLDE_UTF8BULKUTIL_AVX2_ENABLED)
+    if (u::hasAvx2()) {
+        offset = u::validateAvx2(&count, input, length);
+    }
+    else
+#endif
+    {
+#if defined(BDLDE_UTF8BULKUTIL_SSE_ENABLED)
+        offset = u::validateSse(&count, input, length);
+#endif
+    }
+
+    offset += u::validateScalar(&count, input + offset, length - offset);
+
+    *numCodePoints = count;
+    return offset;
+}
+
+bsl::size_t Utf8BulkUtil::widenAsciiPrefix(unsigned short *result,
+                                           const char     *input,
+                                           bsl::size_t     length)
+{
+    BSLS_ASSERT(result || 0 == length);
+    BSLS_ASSERT(input  || 0 == length);
+
+    bsl::size_t ii = 0;
+
+#if defined(BDLDE_UTF8BULKUTIL_SSE_ENABLED)
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; ii + u::k_BLOCK_SIZE <= length; ii += u::k_BLOCK_SIZE) {
+        const __m128i block = _mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(input + ii));
+        if (_mm_movemask_epi8(block)) {
+            break;
+        }
+        __m128i *dst = reinterpret_cast<__m128i *>(result + ii);
+        _mm_storeu_si128(dst,     _mm_unpacklo_epi8(block, zero));
+        _mm_storeu_si128(dst + 1, _mm_unpackhi_epi8(block, zero));
+    }
+#endif
+
+    for (; ii < length && 0 == (0x80 & input[ii]); ++ii) {
+        result[ii] = static_cast<unsigned char>(input[ii]);
+    }
+    return ii;
+}
+
+bsl::size_t Utf8BulkUtil::widenAsciiPrefix(unsigned int   *result,
+                                           const char     *input,
+                                           bsl::size_t     length)
+{
+    BSLS_ASSERT(result || 0 == length);
+    BSLS_ASSERT(input  || 0 == length);
+
+    bsl::size_t ii = 0;
+
+#if defined(BDLDE_UTF8BULKUTIL_SSE_ENABLED)
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; ii + u::k_BLOCK_SIZE <= length; ii += u::k_BLOCK_SIZE) {
+        const __m128i block = _mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(input + ii));
+        if (_mm_movemask_epi8(block)) {
+            break;
+        }
+        const __m128i lo  = _mm_unpacklo_epi8(block, zero);
+        const __m128i hi  = _mm_unpackhi_epi8(block, zero);
+        __m128i      *dst = reinterpret_cast<__m128i *>(result + ii);
+        _mm_storeu_si128(dst,     _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128(dst + 1, _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128(dst + 2, _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128(dst + 3, _mm_unpackhi_epi16(hi, zero));
+    }
+#endif
+
+    for (; ii < length && 0 == (0x80 & input[ii]); ++ii) {
+        result[ii] = static_cast<unsigned char>(input[ii]);
+    }
+    return ii;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,181 @@
+// bdlde_utf8bulkutil.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLDE_UTF8BULKUTIL
+#define INCLUDED_BDLDE_UTF8BULKUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$")
+
+//@PURPOSE: Provide vectorized validation and ASCII conversion of UTF-8.
+//
+//@CLASSES:
+//  bdlde::Utf8BulkUtil: namespace for bulk UTF-8 validation and conversion
+//
+//@SEE_ALSO: bdlde_utf8util, bdlde_charconvertutf16, bdlde_charconvertutf32
+//
+//@DESCRIPTION: This component provides a `struct`, `bdlde::Utf8BulkUtil`,
+// that provides a namespace for functions that operate on contiguous buffers
+// of UTF-8 (and of UTF-16 and UTF-32) many bytes at a time.  These functions
+// are the building blocks used by `bdlde::Utf8Util`,
+// `bdlde::CharConvertUtf16`, and `bdlde::CharConvertUtf32` to process the
+// bulk of their input; they do not classify errors, deal with byte order, or
+// null-terminate their output, and clients needing any of those features
+// should use those components instead.
+//
+// Each function processes the longest *prefix* of its input having some
+// property (being valid UTF-8, or consisting solely of ASCII characters), and
+// returns the length of that prefix.  This allows a caller to hand off the
+// remainder of its input, which (if non-empty) starts with an invalid or
+// non-ASCII sequence, to slower, more general, code.
+//
+// Following the conventions of `bdlde_utf8util`, a sequence of bytes is valid
+// UTF-8 if it conforms to RFC 3629, and in particular does not contain
+// overlong encodings, encodings of the surrogate values in the range
+// `[0xd800 .. 0xdfff]`, encodings of values above `0x10ffff`, or truncated
+// sequences.  Null bytes are valid (ASCII) characters.
+//
+///Hardware Acceleration
+///---------------------
+// On x86 platforms built with SSE4.1 enabled, the functions of this component
+// process 16 bytes at a time.  In addition, validation and the search for
+// non-ASCII bytes process 32 bytes at a time if the processor on which the
+// program is running supports AVX2, which is detected at run-time.  Validation
+// uses the lookup-table-based algorithm described by Keiser and Lemire in
+// "Validating UTF-8 In Less Than One Instruction Per Byte" (2021), in which
+// every pair of adjacent bytes is classified by three 16-entry table lookups.
+// Other platforms, and the tail of each input, use portable implementations
+// that examine 8 bytes at a time while scanning ASCII.  All implementations
+// produce identical results.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Validating and Counting Code Points
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a buffer that we expect to contain UTF-8, and we wish to
+// know how many Unicode code points it holds.
+//
+// First, we prepare a buffer containing the five-letter German word for
+// "greetings" (whose third and fourth letters are encoded as two-byte
+// sequences), followed by a truncated three-byte sequence:
+// ```
+// const char        input[] = "Gr\xc3\xbc\xc3\x9f" "e" "\xe2\x82";
+// const bsl::size_t length  = sizeof input - 1;
+// ```
+// Then, we validate the buffer:
+// ```
+// bsl::size_t       numCodePoints;
+// const bsl::size_t numValid = bdlde::Utf8BulkUtil::validatePrefix(
+//                                                              &numCodePoints,
+//                                                              input,
+//                                                              length);
+// ```
+// Finally, we observe that the first seven bytes, holding five code points,
+// are valid, and that the truncated sequence at the end is not:
+// ```
+// assert(7 == numValid);
+// assert(5 == numCodePoints);
+// ```
+//
+///Example 2: Widening ASCII
+///- - - - - - - - - - - - -
+// Suppose we are translating UTF-8 to UTF-16, and wish to handle the (usually
+// long) runs of ASCII characters quickly.
+//
+// First, we prepare the input, and a buffer for the output:
+// ```
+// const char     input[] = "plain ASCII text, then \xc3\xa9";
+// unsigned short output[sizeof input];
+// ```
+// Then, we widen the ASCII prefix of `input`:
+// ```
+// const bsl::size_t numAscii = bdlde::Utf8BulkUtil::widenAsciiPrefix(
+//                                                           output,
+//                                                           input,
+//                                                           sizeof input - 1);
+// ```
+// Finally, we observe that widening stopped at the first non-ASCII byte, which
+// must be translated by other means:
+// ```
+// assert(23  == numAscii);
+// assert('p' == output[0]);
+// assert(' ' == output[22]);
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bsl_cstddef.h>
+
+namespace BloombergLP {
+namespace bdlde {
+
+                            // ===================
+                            // struct Utf8BulkUtil
+                            // ===================
+
+/// This `struct` provides a namespace for functions that validate UTF-8, and
+/// convert ASCII to and from UTF-16 and UTF-32, many bytes at a time.
+struct Utf8BulkUtil {
+
+    // CLASS METHODS
+
+    /// Copy, to the specified `result`, the longest prefix of the specified
+    /// `input` having the specified `length` whose words are all less than
+    /// `0x80` (i.e., are ASCII characters), storing each word into a single
+    /// byte, and return the number of words so copied.  Note that null words
+    /// are copied.
+    static bsl::size_t narrowAsciiPrefix(char                 *result,
+                                         const unsigned short *input,
+                                         bsl::size_t           length);
+    static bsl::size_t narrowAsciiPrefix(char                 *result,
+                                         const unsigned int   *input,
+                                         bsl::size_t           length);
+
+    /// Return the length of the longest prefix of the specified `input`
+    /// having the specified `length` that consists solely of bytes less than
+    /// `0x80` (i.e., of ASCII characters).
+    static bsl::size_t numAsciiBytes(const char *input, bsl::size_t length);
+
+    /// Return the length of the longest prefix of the specified `input`
+    /// having the specified `length` that is valid UTF-8, and load into the
+    /// specified `numCodePoints` the number of Unicode code points in that
+    /// prefix.  Note that the returned value is `length` if and only if all
+    /// of `input` is valid UTF-8, and that otherwise it is the offset of the
+    /// first byte of the first invalid (or truncated) sequence in `input`.
+    static bsl::size_t validatePrefix(bsl::size_t *numCodePoints,
+                                      const char  *input,
+                                      bsl::size_t  length);
+
+    /// Copy, to the specified `result`, the longest prefix of the specified
+    /// `input` having the specified `length` that consists solely of bytes
+    /// less than `0x80` (i.e., of ASCII characters), zero-extending each
+    /// byte into a word, and return the number of bytes so copied.  Note
+    /// that null bytes are copied.
+    static bsl::size_t widenAsciiPrefix(unsigned short *result,
+                                        const char     *input,
+                                        bsl::size_t     length);
+    static bsl::size_t widenAsciiPrefix(unsigned int   *result,
+                                        const char     *input,
+                                        bsl::size_t     length);
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,865 @@
+// bdlde_utf8bulkutil.t.cpp                                           -*-C++-*-
+#include <bdlde_utf8bulkutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a utility of pure functions, each of which
+// dispatches to vectorized kernels (chosen, in part, at run-time) followed by
+// a portable implementation.  Every function is tested against a simple
+// reference implementation defined in this test driver, over inputs whose
+// lengths and alignments are chosen so that every kernel, and every hand-off
+// between kernels, is exercised.  `validatePrefix` is additionally tested
+// with every possible two-byte and three-byte sequence placed at positions
+// straddling the block boundaries of the kernels, and with errors injected at
+// every position of random valid UTF-8.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 5] size_t narrowAsciiPrefix(char *, const unsigned short *, size_t);
+// [ 5] size_t narrowAsciiPrefix(char *, const unsigned int *, size_t);
+// [ 2] size_t numAsciiBytes(const char *, size_t);
+// [ 3] size_t validatePrefix(size_t *, const char *, size_t);
+// [ 4] size_t widenAsciiPrefix(unsigned short *, const char *, size_t);
+// [ 4] size_t widenAsciiPrefix(unsigned int *, const char *, size_t);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlde::Utf8BulkUtil Util;
+
+// Lengths exercising every kernel and the hand-offs between them.
+
+const bsl::size_t k_MAX_LENGTH = 200;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// Return the next pseudo-random number generated from the specified
+/// `*seed`, and update `*seed`.
+unsigned int nextRandom(unsigned int *seed)
+{
+    *seed = *seed * 1103515245 + 12345;
+    return *seed >> 16;
+}
+
+/// Return the length of the longest prefix of the specified `input` having
+/// the specified `length` that is valid UTF-8, and load into the specified
+/// `numCodePoints` the number of code points in that prefix, decoding each
+/// code point and checking its value.
+bsl::size_t referenceValidate(bsl::size_t *numCodePoints,
+                              const char  *input,
+                              bsl::size_t  length)
+{
+    static const unsigned int minValue[] = { 0, 0, 0x80, 0x800, 0x10000 };
+
+    const unsigned char *p = reinterpret_cast<const unsigned char *>(input);
+
+    bsl::size_t ii    = 0;
+    bsl::size_t count = 0;
+    while (ii < length) {
+        const unsigned int c = p[ii];
+
+        bsl::size_t  len;
+        unsigned int value;
+        if      (c < 0x80)          { len = 1; value = c;        }
+        else if ((c & 0xe0) == 0xc0) { len = 2; value = c & 0x1f; }
+        else if ((c & 0xf0) == 0xe0) { len = 3; value = c & 0x0f; }
+        else if ((c & 0xf8) == 0xf0) { len = 4; value = c & 0x07; }
+        else                         { break;                     }
+
+        if (length - ii < len) {
+            break;
+        }
+
+        bool good = true;
+        for (bsl::size_t jj = 1; jj < len; ++jj) {
+            if ((p[ii + jj] & 0xc0) != 0x80) {
+                good = false;
+            }
+            value = (value << 6) | (p[ii + jj] & 0x3f);
+        }
+        if (!good
+         || value < minValue[len]
+         || (0xd800 <= value && value <= 0xdfff)
+         || 0x10ffff < value) {
+            break;
+        }
+
+        ii += len;
+        ++count;
+    }
+
+    *numCodePoints = count;
+    return ii;
+}
+
+/// Append to the specified `result` the UTF-8 encoding of the specified
+/// `value`.
+void appendUtf8(bsl::string *result, unsigned int value)
+{
+    if (value < 0x80) {
+        result->push_back(static_cast<char>(value));
+    }
+    else if (value < 0x800) {
+        result->push_back(static_cast<char>(0xc0 | (value >> 6)));
+        result->push_back(static_cast<char>(0x80 | (value & 0x3f)));
+    }
+    else if (value < 0x10000) {
+        result->push_back(static_cast<char>(0xe0 | (value >> 12)));
+        result->push_back(static_cast<char>(0x80 | ((value >> 6) & 0x3f)));
+        result->push_back(static_cast<char>(0x80 | (value & 0x3f)));
+    }
+    else {
+        result->push_back(static_cast<char>(0xf0 | (value >> 18)));
+        result->push_back(static_cast<char>(0x80 | ((value >> 12) & 0x3f)));
+        result->push_back(static_cast<char>(0x80 | ((value >> 6) & 0x3f)));
+        result->push_back(static_cast<char>(0x80 | (value & 0x3f)));
+    }
+}
+
+/// Return a string of at least the specified `length` bytes of valid UTF-8
+/// generated from the specified `*seed`, in which a code point is ASCII with
+/// a probability of about the specified `asciiPercent` percent, and is
+/// otherwise equally likely to be encoded in two, three, or four bytes.
+bsl::string randomUtf8(bsl::size_t   length,
+                       int           asciiPercent,
+                       unsigned int *seed)
+{
+    bsl::string result;
+    while (result.length() < length) {
+        const unsigned int r = nextRandom(seed);
+        unsigned int       value;
+        if (static_cast<int>(r % 100) < asciiPercent) {
+            value = nextRandom(seed) % 0x80;
+        }
+        else {
+            switch (r % 3) {
+              case 0: {
+                value = 0x80 + nextRandom(seed) % (0x800 - 0x80);
+              } break;
+              case 1: {
+                do {
+                    value = 0x800 + nextRandom(seed) % (0x10000 - 0x800);
+                } while (0xd800 <= value && value <= 0xdfff);
+              } break;
+              default: {
+                const unsigned int bits = nextRandom(seed) << 8
+                                        ^ nextRandom(seed);
+                value = 0x10000 + bits % (0x110000 - 0x10000);
+              } break;
+            }
+        }
+        appendUtf8(&result, value);
+    }
+    return result;
+}
+
+/// Verify that `validatePrefix` agrees with `referenceValidate` on the
+/// specified `length` bytes at the specified `input`, reporting failures
+/// using the specified `line`, and return `true` if they agree.
+bool checkValidate(int line, const char *input, bsl::size_t length)
+{
+    bsl::size_t expCount;
+    bsl::size_t count = 12345;
+
+    const bsl::size_t expValid = referenceValidate(&expCount, input, length);
+    const bsl::size_t valid    = Util::validatePrefix(&count, input, length);
+
+    ASSERTV(line, length, expValid, valid,    expValid == valid);
+    ASSERTV(line, length, expCount, count,    expCount == count);
+
+    return expValid == valid && expCount == count;
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    (void)veryVerbose;
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Validating and Counting Code Points
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a buffer that we expect to contain UTF-8, and we wish to
+// know how many Unicode code points it holds.
+//
+// First, we prepare a buffer containing the five-letter German word for
+// "greetings" (whose third and fourth letters are encoded as two-byte
+// sequences), followed by a truncated three-byte sequence:
+// ```
+        {
+            const char        input[] = "Gr\xc3\xbc\xc3\x9f" "e" "\xe2\x82";
+            const bsl::size_t length  = sizeof input - 1;
+// ```
+// Then, we validate the buffer:
+// ```
+            bsl::size_t       numCodePoints;
+            const bsl::size_t numValid = bdlde::Utf8BulkUtil::validatePrefix(
+                                                              &numCodePoints,
+                                                              input,
+                                                              length);
+// ```
+// Finally, we observe that the first seven bytes, holding five code points,
+// are valid, and that the truncated sequence at the end is not:
+// ```
+            ASSERT(7 == numValid);
+            ASSERT(5 == numCodePoints);
+        }
+// ```
+//
+///Example 2: Widening ASCII
+///- - - - - - - - - - - - -
+// Suppose we are translating UTF-8 to UTF-16, and wish to handle the (usually
+// long) runs of ASCII characters quickly.
+//
+// First, we prepare the input, and a buffer for the output:
+// ```
+        {
+            const char     input[] = "plain ASCII text, then \xc3\xa9";
+            unsigned short output[sizeof input];
+// ```
+// Then, we widen the ASCII prefix of `input`:
+// ```
+            const bsl::size_t numAscii = bdlde::Utf8BulkUtil::widenAsciiPrefix(
+                                                           output,
+                                                           input,
+                                                           sizeof input - 1);
+// ```
+// Finally, we observe that widening stopped at the first non-ASCII byte, which
+// must be translated by other means:
+// ```
+            ASSERT(23  == numAscii);
+            ASSERT('p' == output[0]);
+            ASSERT(' ' == output[22]);
+        }
+// ```
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING `narrowAsciiPrefix`
+        //
+        // Concerns:
+        // 1. Words less than `0x80`, including null words, are copied to
+        //    single bytes.
+        //
+        // 2. Copying stops at the first word not less than `0x80`, whatever
+        //    its position, and whichever of its bits are set, and the number
+        //    of words copied is returned.
+        //
+        // 3. No byte of the output beyond those copied is modified.
+        //
+        // Plan:
+        // 1. For every length up to `k_MAX_LENGTH`, and for every position in
+        //    an input of that length, narrow an input of random ASCII words
+        //    in which the word at that position is replaced by each of a set
+        //    of non-ASCII values, and compare the result to that of a simple
+        //    loop.  Verify that a guard byte past the output is not modified.
+        //    (C-1..3)
+        //
+        // Testing:
+        //   size_t narrowAsciiPrefix(char *, const unsigned short *, size_t);
+        //   size_t narrowAsciiPrefix(char *, const unsigned int *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `narrowAsciiPrefix`" << endl
+                          << "===========================" << endl;
+
+        const unsigned int BAD[] = { 0x80, 0xff, 0x100, 0x8000, 0xffff,
+                                     0x10000, 0x80000000 };
+        const int          NUM_BAD = sizeof BAD / sizeof *BAD;
+
+        unsigned int seed = 1;
+
+        for (bsl::size_t len = 0; len <= k_MAX_LENGTH; ++len) {
+            bsl::vector<unsigned short> in16(len + 1);
+            bsl::vector<unsigned int>   in32(len + 1);
+            for (bsl::size_t i = 0; i < len; ++i) {
+                in32[i] = nextRandom(&seed) % 0x80;
+                in16[i] = static_cast<unsigned short>(in32[i]);
+            }
+
+            for (bsl::size_t pos = 0; pos <= len; ++pos) {
+                for (int bi = 0; bi < NUM_BAD; ++bi) {
+                    bsl::vector<unsigned short> x16(in16);
+                    bsl::vector<unsigned int>   x32(in32);
+                    if (pos < len) {
+                        x32[pos] = BAD[bi];
+                        x16[pos] = static_cast<unsigned short>(
+                                          BAD[bi] < 0x10000 ? BAD[bi] : 0x80);
+                    }
+
+                    bsl::string result(len + 1, '#');
+
+                    ASSERTV(len, pos, bi, pos == Util::narrowAsciiPrefix(
+                                                             &result[0],
+                                                             x16.data(),
+                                                             len));
+                    for (bsl::size_t i = 0; i < pos; ++i) {
+                        ASSERTV(len, pos, i, char(in16[i]) == result[i]);
+                    }
+                    for (bsl::size_t i = pos; i <= len; ++i) {
+                        ASSERTV(len, pos, i, '#' == result[i]);
+                    }
+
+                    result.assign(len + 1, '#');
+
+                    ASSERTV(len, pos, bi, pos == Util::narrowAsciiPrefix(
+                                                             &result[0],
+                                                             x32.data(),
+                                                             len));
+                    for (bsl::size_t i = 0; i < pos; ++i) {
+                        ASSERTV(len, pos, i, char(in32[i]) == result[i]);
+                    }
+                    for (bsl::size_t i = pos; i <= len; ++i) {
+                        ASSERTV(len, pos, i, '#' == result[i]);
+                    }
+                    if (pos == len) {
+                        break;
+                    }
+                }
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING `widenAsciiPrefix`
+        //
+        // Concerns:
+        // 1. ASCII bytes, including null bytes, are zero-extended to words.
+        //
+        // 2. Copying stops at the first byte not less than `0x80`, whatever
+        //    its position, and the number of bytes copied is returned.
+        //
+        // 3. No word of the output beyond those copied is modified.
+        //
+        // Plan:
+        // 1. For every length up to `k_MAX_LENGTH`, and for every position in
+        //    an input of that length, widen an input of random ASCII bytes in
+        //    which the byte at that position is replaced by each of a set of
+        //    non-ASCII values, and compare the result to that of a simple
+        //    loop.  Verify that a guard word past the output is not modified.
+        //    (C-1..3)
+        //
+        // Testing:
+        //   size_t widenAsciiPrefix(unsigned short *, const char *, size_t);
+        //   size_t widenAsciiPrefix(unsigned int *, const char *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `widenAsciiPrefix`" << endl
+                          << "==========================" << endl;
+
+        const char BAD[]   = { '\x80', '\xc3', '\xff' };
+        const int  NUM_BAD = sizeof BAD / sizeof *BAD;
+
+        unsigned int seed = 2;
+
+        for (bsl::size_t len = 0; len <= k_MAX_LENGTH; ++len) {
+            bsl::string input(len, '\0');
+            for (bsl::size_t i = 0; i < len; ++i) {
+                input[i] = static_cast<char>(nextRandom(&seed) % 0x80);
+            }
+
+            for (bsl::size_t pos = 0; pos <= len; ++pos) {
+                for (int bi = 0; bi < NUM_BAD; ++bi) {
+                    bsl::string x(input);
+                    if (pos < len) {
+                        x[pos] = BAD[bi];
+                    }
+
+                    bsl::vector<unsigned short> r16(len + 1, 0xabcd);
+                    bsl::vector<unsigned int>   r32(len + 1, 0xabcdef);
+
+                    ASSERTV(len, pos, bi, pos == Util::widenAsciiPrefix(
+                                                                  r16.data(),
+                                                                  x.data(),
+                                                                  len));
+                    ASSERTV(len, pos, bi, pos == Util::widenAsciiPrefix(
+                                                                  r32.data(),
+                                                                  x.data(),
+                                                                  len));
+                    for (bsl::size_t i = 0; i < pos; ++i) {
+                        ASSERTV(len, pos, i, unsigned(input[i]) == r16[i]);
+                        ASSERTV(len, pos, i, unsigned(input[i]) == r32[i]);
+                    }
+                    for (bsl::size_t i = pos; i <= len; ++i) {
+                        ASSERTV(len, pos, i, 0xabcd   == r16[i]);
+                        ASSERTV(len, pos, i, 0xabcdef == r32[i]);
+                    }
+                    if (pos == len) {
+                        break;
+                    }
+                }
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING `validatePrefix`
+        //
+        // Concerns:
+        // 1. Valid UTF-8 of any mix of one- to four-byte sequences is found
+        //    to be valid in its entirety, and its code points are counted.
+        //
+        // 2. Every kind of invalid sequence (unexpected continuation bytes,
+        //    missing continuation bytes, overlong encodings, surrogates,
+        //    values above `0x10ffff`, and invalid lead bytes) is detected,
+        //    whatever its position relative to the blocks processed by the
+        //    vectorized kernels, and the returned length is the offset of the
+        //    invalid sequence.
+        //
+        // 3. A sequence truncated by the end of input is detected.
+        //
+        // 4. The code points of only the valid prefix are counted.
+        //
+        // Plan:
+        // 1. Validate random valid UTF-8 of various lengths and mixes of
+        //    sequence lengths, and every prefix (and, therefore, every
+        //    truncation) of each, and compare the results to those of a
+        //    reference implementation that decodes each code point.
+        //    (C-1, 3..4)
+        //
+        // 2. For each of those inputs, replace the byte at each position
+        //    with each of a set of bytes, and compare the results with those
+        //    of the reference implementation.  (C-2, 4)
+        //
+        // 3. Embed every possible pair of bytes, followed by two continuation
+        //    bytes, at positions straddling 16- and 32-byte boundaries of
+        //    ASCII and non-ASCII backgrounds, and compare the results with
+        //    those of the reference implementation.  Repeat for every
+        //    possible triple of bytes beginning with a three- or four-byte
+        //    lead byte.  (C-2, 4)
+        //
+        // Testing:
+        //   size_t validatePrefix(size_t *, const char *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `validatePrefix`" << endl
+                          << "========================" << endl;
+
+        if (verbose) cout << "\nRandom valid input, and its prefixes." << endl;
+
+        const int ASCII_PERCENT[] = { 100, 95, 50, 0 };
+        const int NUM_ASCII_PERCENT = sizeof ASCII_PERCENT
+                                                      / sizeof *ASCII_PERCENT;
+
+        unsigned int seed = 3;
+
+        for (int pi = 0; pi < NUM_ASCII_PERCENT; ++pi) {
+            const int PERCENT = ASCII_PERCENT[pi];
+
+            for (int ti = 0; ti < 20; ++ti) {
+                const bsl::string input = randomUtf8(k_MAX_LENGTH,
+                                                     PERCENT,
+                                                     &seed);
+
+                bsl::size_t count;
+                ASSERTV(PERCENT, ti, input.length() == Util::validatePrefix(
+                                                              &count,
+                                                              input.data(),
+                                                              input.length()));
+
+                for (bsl::size_t len = 0; len <= input.length(); ++len) {
+                    checkValidate(L_, input.data(), len);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nErrors injected into valid input." << endl;
+
+        const char BAD[] = { '\x00', '\x41', '\x80', '\xbf', '\xc0', '\xc1',
+                             '\xc2', '\xdf', '\xe0', '\xed', '\xef', '\xf0',
+                             '\xf4', '\xf5', '\xf8', '\xff' };
+        const int  NUM_BAD = sizeof BAD / sizeof *BAD;
+
+        for (int pi = 0; pi < NUM_ASCII_PERCENT; ++pi) {
+            const int PERCENT = ASCII_PERCENT[pi];
+
+            for (int ti = 0; ti < 4; ++ti) {
+                const bsl::string input = randomUtf8(k_MAX_LENGTH / 2,
+                                                     PERCENT,
+                                                     &seed);
+
+                for (bsl::size_t pos = 0; pos < input.length(); ++pos) {
+                    for (int bi = 0; bi < NUM_BAD; ++bi) {
+                        bsl::string x(input);
+                        x[pos] = BAD[bi];
+                        if (!checkValidate(L_, x.data(), x.length())) {
+                            ASSERTV(PERCENT, ti, pos, bi, false);
+                        }
+                    }
+                }
+            }
+        }
+
+        if (verbose) cout << "\nEvery pair and triple of bytes." << endl;
+
+        const char *BACKGROUND[] = {
+            "abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijkl",
+            "\xc3\xa9\xc3\xa9\xc3\xa9\xc3\xa9\xc3\xa9\xc3\xa9\xc3\xa9\xc3\xa9"
+            "\xe2\x82\xac\xe2\x82\xac\xe2\x82\xac\xe2\x82\xac\xe2\x82\xac"
+            "\xf0\x9f\x98\x80\xf0\x9f\x98\x80\xf0\x9f\x98\x80"
+            "abcdefghijklmnopqrstu"
+        };
+        const int NUM_BACKGROUND = sizeof BACKGROUND / sizeof *BACKGROUND;
+
+        const bsl::size_t POSITION[] = { 0, 13, 14, 15, 16, 29, 30, 31, 32 };
+        const int         NUM_POSITION = sizeof POSITION / sizeof *POSITION;
+
+        for (int gi = 0; gi < NUM_BACKGROUND; ++gi) {
+            const bsl::string background(BACKGROUND[gi]);
+            ASSERT(64 == background.length());
+
+            for (int ni = 0; ni < NUM_POSITION; ++ni) {
+                const bsl::size_t POS = POSITION[ni];
+
+                for (int b1 = 0; b1 < 256; ++b1) {
+                    for (int b2 = 0; b2 < 256; ++b2) {
+                        bsl::string x(background);
+                        x[POS]     = static_cast<char>(b1);
+                        x[POS + 1] = static_cast<char>(b2);
+                        x[POS + 2] = '\x80';
+                        x[POS + 3] = '\x80';
+                        if (!checkValidate(L_, x.data(), x.length())) {
+                            ASSERTV(gi, POS, b1, b2, false);
+                        }
+                    }
+                }
+
+                for (int b1 = 0xe0; b1 < 0xf8; ++b1) {
+                    for (int b2 = 0x70; b2 < 0xd0; ++b2) {
+                        for (int b3 = 0x70; b3 < 0xd0; ++b3) {
+                            bsl::string x(background);
+                            x[POS]     = static_cast<char>(b1);
+                            x[POS + 1] = static_cast<char>(b2);
+                            x[POS + 2] = static_cast<char>(b3);
+                            x[POS + 3] = '\xbf';
+                            if (!checkValidate(L_, x.data(), x.length())) {
+                                ASSERTV(gi, POS, b1, b2, b3, false);
+                            }
+
+                            // Follow the triple with ASCII, so that the
+                            // (possibly incomplete) sequence is followed by an
+                            // all-ASCII block.
+
+                            for (bsl::size_t i = POS + 3; i < 64; ++i) {
+                                x[i] = 'z';
+                            }
+                            if (!checkValidate(L_, x.data(), x.length())) {
+                                ASSERTV(gi, POS, b1, b2, b3, false);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING `numAsciiBytes`
+        //
+        // Concerns:
+        // 1. The length of the prefix of ASCII bytes, including null bytes,
+        //    is returned, whatever the position of the first non-ASCII byte.
+        //
+        // Plan:
+        // 1. For every length up to `k_MAX_LENGTH`, and for every position in
+        //    an input of that length, place a non-ASCII byte at that position
+        //    of a buffer of random ASCII, and verify that the position is
+        //    returned.  (C-1)
+        //
+        // Testing:
+        //   size_t numAsciiBytes(const char *, size_t);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `numAsciiBytes`" << endl
+                          << "=======================" << endl;
+
+        unsigned int seed = 4;
+
+        for (bsl::size_t len = 0; len <= k_MAX_LENGTH; ++len) {
+            bsl::string input(len + 1, '\0');
+            for (bsl::size_t i = 0; i < len; ++i) {
+                input[i] = static_cast<char>(nextRandom(&seed) % 0x80);
+            }
+            input[len] = '\x80';  // beyond the end; must not be examined
+
+            ASSERTV(len, len == Util::numAsciiBytes(input.data(), len));
+
+            for (bsl::size_t pos = 0; pos < len; ++pos) {
+                bsl::string x(input);
+                x[pos] = static_cast<char>(0x80 | nextRandom(&seed));
+                ASSERTV(len, pos, pos == Util::numAsciiBytes(x.data(), len));
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Validate, and convert, a few short strings.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const char INPUT[] = "The quick brown fox \xe2\x80\x94 jumps over "
+                             "the lazy dog, \xf0\x9f\x90\x95.";
+        const bsl::size_t LENGTH = sizeof INPUT - 1;
+
+        bsl::size_t count;
+        ASSERT(LENGTH == Util::validatePrefix(&count, INPUT, LENGTH));
+        ASSERT(LENGTH - 2 - 3 == count);
+
+        ASSERT(20 == Util::numAsciiBytes(INPUT, LENGTH));
+
+        ASSERT(0 == Util::validatePrefix(&count, "\x80", 1));
+        ASSERT(0 == count);
+        ASSERT(1 == Util::validatePrefix(&count, "a\xed\xa0\x80", 4));
+        ASSERT(1 == count);
+
+        unsigned int wide[LENGTH];
+        char         narrow[LENGTH];
+        ASSERT(20 == Util::widenAsciiPrefix(wide, INPUT, LENGTH));
+        ASSERT(20 == Util::narrowAsciiPrefix(narrow, wide, 20));
+        ASSERT(0 == bsl::memcmp(narrow, INPUT, 20));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        // 1. Validation and conversion are substantially faster than a
+        //    byte-at-a-time implementation.
+        //
+        // Plan:
+        // 1. Time `validatePrefix` and the reference implementation on about
+        //    1 MiB of UTF-8 of various mixes of ASCII and non-ASCII, and time
+        //    the conversions on 1 MiB of ASCII, and report the throughput.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const bsl::size_t k_SIZE       = 1024 * 1024;
+        const int         k_ITERATIONS = 100;
+
+        const int ASCII_PERCENT[] = { 100, 95, 50, 0 };
+        const int NUM_ASCII_PERCENT = sizeof ASCII_PERCENT
+                                                      / sizeof *ASCII_PERCENT;
+
+        unsigned int seed = 5;
+
+        bsls::Stopwatch timer;
+
+        for (int pi = 0; pi < NUM_ASCII_PERCENT; ++pi) {
+            const int         PERCENT = ASCII_PERCENT[pi];
+            const bsl::string input   = randomUtf8(k_SIZE, PERCENT, &seed);
+            const double      k_MB    = static_cast<double>(input.length())
+                                           * k_ITERATIONS / (1024 * 1024);
+
+            bsl::size_t count;
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < k_ITERATIONS; ++i) {
+                ASSERT(input.length() == Util::validatePrefix(
+                                                              &count,
+                                                              input.data(),
+                                                              input.length()));
+            }
+            timer.stop();
+            cout << PERCENT << "% ASCII: validatePrefix:    "
+                 << k_MB / timer.elapsedTime() << " MB/s" << endl;
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < k_ITERATIONS; ++i) {
+                ASSERT(input.length() == referenceValidate(&count,
+                                                           input.data(),
+                                                           input.length()));
+            }
+            timer.stop();
+            cout << PERCENT << "% ASCII: referenceValidate: "
+                 << k_MB / timer.elapsedTime() << " MB/s" << endl;
+        }
+
+        const bsl::string           ascii = randomUtf8(k_SIZE, 100, &seed);
+        bsl::vector<unsigned short> wide(ascii.length());
+        bsl::string                 narrow(ascii.length(), ' ');
+        const double                k_MB  = static_cast<double>(k_SIZE)
+                                              * k_ITERATIONS / (1024 * 1024);
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < k_ITERATIONS; ++i) {
+            ASSERT(ascii.length() == Util::widenAsciiPrefix(wide.data(),
+                                                            ascii.data(),
+                                                            ascii.length()));
+        }
+        timer.stop();
+        cout << "widenAsciiPrefix:  " << k_MB / timer.elapsedTime() << " MB/s"
+             << endl;
+
+        timer.reset();
+        timer.start();
+        for (int i = 0; i < k_ITERATIONS; ++i) {
+            ASSERT(ascii.length() == Util::narrowAsciiPrefix(&narrow[0],
+                                                             wide.data(),
+                                                             wide.size()));
+        }
+        timer.stop();
+        cout << "narrowAsciiPrefix: " << k_MB / timer.elapsedTime() << " MB/s"
+             << endl;
+        ASSERT(ascii == narrow);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -4,6 +4,8 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_utf8util_cpp,"$Id$ $CSID$")
 
+#include <bdlde_utf8bulkutil.h>
+
 #include <bsla_fallthrough.h>
 #include <bsla_unused.h>
 
@@ -11,6 +13,7 @@ BSLS_IDENT_RCSID(bdlde_utf8util_cpp,"$Id$ $CSID$")
 #include <bsls_performancehint.h>
 #include <bsls_platform.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_fstream.h>
@@ -63,6 +66,10 @@ enum {
     k_MULTIPLEBYTE_TEST  = 0xC0,   // continuation byte
     k_MULTIPLEBYTE_RES   = 0X80,
 
+    k_MIN_BULK_LENGTH    = 16,     // shortest input worth handing to
+                                   // 'Utf8BulkUtil' in 'advanceIfValid' and
+                                   // 'readIfValid'
+
     k_END_OF_INPUT_TRUNCATION      = Utf8Util::k_END_OF_INPUT_TRUNCATION,
     k_UNEXPECTED_CONTINUATION_OCTET= Utf8Util::k_UNEXPECTED_CONTINUATION_OCTET,
     k_NON_CONTINUATION_OCTET       = Utf8Util::k_NON_CONTINUATION_OCTET,
@@ -181,6 +188,23 @@ bool isSurrogateValue(int value)
     return (k_SURROGATE_MASK & value) == k_MIN_SURROGATE;
 }
 
+/// Return the next byte of input as an `int_type` of `bsl::streambuf`,
+/// taken from the specified `*pending`, which is then advanced, if it is
+/// short of the specified `pendingEnd`, and from the specified `input`
+/// otherwise.
+inline
+int nextByte(const char     **pending,
+             const char      *pendingEnd,
+             bsl::streambuf  *input)
+{
+    if (*pending < pendingEnd) {
+        return bsl::char_traits<char>::to_int_type(*(*pending)++);
+                                                                      // RETURN
+    }
+
+    return input->sbumpc();
+}
+
 /// Return the integral value of the single code point represented by the
 /// 2-byte UTF-8 sequence referred to by the specified `pc`.  The behavior
 /// is undefined unless the 2 bytes starting at `pc` contain a UTF-8
@@ -453,10 +477,26 @@ int validateAndCountCodePoints(const char             **invalidString,
         return 0;                                                     // RETURN
     }
 
+    // Validate as much of the input as possible with the vectorized
+    // validator, which stops before the first invalid sequence, leaving only
+    // that sequence (if any) for the loops below to classify.
+
+    bsl::size_t       numCodePoints;
+    const bsl::size_t numValid = bdlde::Utf8BulkUtil::validatePrefix(
+                                                                &numCodePoints,
+                                                                string,
+                                                                length);
+    if (LIKELY(numValid == length)) {
+        return static_cast<int>(numCodePoints);                       // RETURN
+    }
+
+    string += numValid;
+    length -= numValid;
+
     const char       *pc     = string;
     const char *const pcEnd4 = string + length - 4;
 
-    int count = 0;
+    int count = static_cast<int>(numCodePoints);
 
     while (pc <= pcEnd4) {
         switch (static_cast<unsigned char>(*pc) >> 4) {
@@ -1093,6 +1133,27 @@ Utf8Util::IntPtr Utf8Util::advanceIfValid(int         *status,
     IntPtr  ret = 0;      // return value -- number of code points advanced
     const char * const endOfInput = string + length;
 
+    // First advance over as much valid input as possible with the vectorized
+    // validator.  Since every code point occupies at least one byte,
+    // validating no more than 'numCodePoints - ret' bytes cannot advance too
+    // far.  Each pass advances over at least a quarter of the remaining code
+    // points, unless it stops at invalid input or at the end of input.
+
+    while (u::k_MIN_BULK_LENGTH <= numCodePoints - ret) {
+        const size_type maxLength = bsl::min<size_type>(endOfInput - string,
+                                                        numCodePoints - ret);
+        bsl::size_t       numAdvanced;
+        const bsl::size_t numValid = Utf8BulkUtil::validatePrefix(
+                                                                  &numAdvanced,
+                                                                  string,
+                                                                  maxLength);
+        if (0 == numValid) {
+            break;
+        }
+        string += numValid;
+        ret    += numAdvanced;
+    }
+
     // Note that we keep 'string' pointing to the beginning of the Unicode code
     // point being processed, and only advance it to the next code point
     // between iterations.
@@ -1745,6 +1806,20 @@ Utf8Util::size_type Utf8Util::readIfValid(int            *status,
     int              rc  = 0;
     int              c;
 
+    // Whenever enough input is available in the get area of '*input', we
+    // read a block of it directly into 'outputBuffer' and validate it with
+    // the vectorized validator.  Whatever follows the valid prefix of the
+    // block -- an invalid sequence, or a sequence truncated by the end of the
+    // block -- is put back with 'sputbackc', which cannot fail for bytes that
+    // were still in the get area, and is then read a byte at a time below.
+    // Should a put back nevertheless fail, the bytes not put back are read
+    // from 'outputBuffer' instead, in the range '[pending, pendingEnd)'.  Note
+    // that the byte-at-a-time code writes no more output than it has read, so
+    // its output never overtakes 'pending'.
+
+    const char *pending    = 0;
+    const char *pendingEnd = 0;
+
     while (true) {
         BSLS_ASSERT(0 == rc);
 
@@ -1755,7 +1830,52 @@ Utf8Util::size_type Utf8Util::readIfValid(int            *status,
             break;
         }
 
-        if (UNLIKELY(eof == (c = input->sbumpc()))) {
+        const bsl::streamsize numAvailable = pending < pendingEnd
+                                           ? 0
+                                           : input->in_avail();
+
+        if (u::k_MIN_BULK_LENGTH <= numAvailable
+         && u::k_MIN_BULK_LENGTH <= end - out) {
+            const bsl::streamsize numRead = input->sgetn(
+                                    out,
+                                    bsl::min<bsl::streamsize>(numAvailable,
+                                                              end - out));
+
+            bsl::size_t       numCodePoints;
+            const bsl::size_t numValid = Utf8BulkUtil::validatePrefix(
+                                                                &numCodePoints,
+                                                                out,
+                                                                numRead);
+            const char *putBack = out + numRead;
+
+            out += numValid;
+
+            if (LIKELY(out == putBack && 0 != numRead)) {
+                continue;
+            }
+
+            // What follows the valid prefix, if anything, is an invalid
+            // sequence, or a valid sequence that was truncated by the end of
+            // the block; put it back, and fall through to read it a byte at a
+            // time.
+
+            while (out < putBack && eof != input->sputbackc(putBack[-1])) {
+                --putBack;
+            }
+
+            if (UNLIKELY(out < putBack)) {
+                BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+                pending    = out;
+                pendingEnd = putBack;
+            }
+        }
+
+        const bool fromInput = pending == pendingEnd;
+
+        if (UNLIKELY(eof == (c = u::nextByte(&pending,
+                                             pendingEnd,
+                                             input)))) {
             BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
             break;
@@ -1785,7 +1905,9 @@ Utf8Util::size_type Utf8Util::readIfValid(int            *status,
           } break;
           case 0xc: BSLA_FALLTHROUGH;
           case 0xd: {
-            if (UNLIKELY(eof == (c = input->sbumpc()))) {
+            if (UNLIKELY(eof == (c = u::nextByte(&pending,
+                                                 pendingEnd,
+                                                 input)))) {
                 BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
                 rc = k_END_OF_INPUT_TRUNCATION;
@@ -1809,7 +1931,9 @@ Utf8Util::size_type Utf8Util::readIfValid(int            *status,
           } continue;
           case 0xe: {
             for (int ii = 1; ii <= 2; ++ii) {
-                if (UNLIKELY(eof == (c = input->sbumpc()))) {
+                if (UNLIKELY(eof == (c = u::nextByte(&pending,
+                                                     pendingEnd,
+                                                     input)))) {
                     BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
                     rc = k_END_OF_INPUT_TRUNCATION;
@@ -1853,7 +1977,9 @@ Utf8Util::size_type Utf8Util::readIfValid(int            *status,
             }
 
             for (int ii = 1; ii <= 3; ++ii) {
-                if (UNLIKELY(eof == (c = input->sbumpc()))) {
+                if (UNLIKELY(eof == (c = u::nextByte(&pending,
+                                                     pendingEnd,
+                                                     input)))) {
                     BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
                     rc = k_END_OF_INPUT_TRUNCATION;
@@ -1891,22 +2017,28 @@ Utf8Util::size_type Utf8Util::readIfValid(int            *status,
         }
         BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
 
+        // If the invalid sequence was read (in part) from 'outputBuffer'
+        // because a put back failed, '*input' cannot be repositioned before
+        // it, and is left in an unspecified state.
+
+        if (!fromInput) {
+            break;
+        }
+
         // Windows and AIX have a problem with 'std::filebuf::sputbackc'
         // malfunctions under some circumstances when called multiple times, so
         // we use 'pubseekoff' to move backward.  However, some 'streambuf's
         // (including the 'streambuf' in a 'std::stringstream' on Unix) are not
-        // seekable, so we do not check the return value here.
+        // seekable, so if the seek fails we fall back to 'sputbackc'.
 
         const pos_type pos = input->pubseekoff(tmpBuf - tmpPtr,
                                                bsl::ios_base::cur,
                                                bsl::ios_base::in);
-
-        // If the seek succeeds, it will return a non-negative value.  This may
-        // be the case if '*input' is non-seekable (which is rare).  Check it
-        // with a safe assert, so we will find out about it in development, but
-        // just continue on if the problem occurs in production.
-
-        BSLS_ASSERT_SAFE(0 <= pos);    (void) pos;
+        if (pos_type(-1) == pos) {
+            while (tmpBuf < tmpPtr && eof != input->sputbackc(tmpPtr[-1])) {
+                --tmpPtr;
+            }
+        }
 
         break;
     }
@@ -2715,6 +2715,105 @@ bool containsAscii(const char *str)
     return *str != 0;
 }
 
+                         // ==========================
+                         // class NonSeekableStreamBuf
+                         // ==========================
+
+/// This class implements a `bsl::streambuf` that reads a fixed buffer
+/// through its get area, like `bdlsb::FixedMemInStreamBuf`, but that, like
+/// a wrapper of a stream buffer that is not seekable, reports the current
+/// position for a seek by a zero offset from the current position and fails
+/// every other seek.
+class NonSeekableStreamBuf : public bsl::streambuf {
+
+  public:
+    // CREATORS
+
+    /// Create a stream buffer reading the specified `length` bytes at the
+    /// specified `buffer`.
+    NonSeekableStreamBuf(const char *buffer, bsl::size_t length)
+    {
+        char *begin = const_cast<char *>(buffer);
+        setg(begin, begin, begin + length);
+    }
+
+  protected:
+    // PROTECTED MANIPULATORS
+
+    /// Return the current position if the specified `offset` is 0 and the
+    /// specified `whence` is `bsl::ios_base::cur`, and `pos_type(-1)`
+    /// otherwise.
+    pos_type seekoff(off_type                offset,
+                     bsl::ios_base::seekdir  whence,
+                     bsl::ios_base::openmode)
+    {
+        return 0 == offset && bsl::ios_base::cur == whence
+             ? pos_type(gptr() - eback())
+             : pos_type(-1);
+    }
+};
+
+                          // ========================
+                          // class NoPutBackStreamBuf
+                          // ========================
+
+/// This class implements a `bsl::streambuf` that reads a fixed buffer
+/// without a get area, so that no byte read from it can be put back, and
+/// that cannot seek.
+class NoPutBackStreamBuf : public bsl::streambuf {
+
+    // DATA
+    const char *d_next_p;  // next byte to be read
+    const char *d_end_p;   // end of the buffer
+
+  public:
+    // CREATORS
+
+    /// Create a stream buffer reading the specified `length` bytes at the
+    /// specified `buffer`.
+    NoPutBackStreamBuf(const char *buffer, bsl::size_t length)
+    : d_next_p(buffer)
+    , d_end_p(buffer + length)
+    {
+    }
+
+  protected:
+    // PROTECTED MANIPULATORS
+
+    /// Return the number of bytes remaining to be read.
+    bsl::streamsize showmanyc()
+    {
+        return d_end_p - d_next_p;
+    }
+
+    /// Return the next byte without consuming it, or `eof` if none remain.
+    int_type underflow()
+    {
+        return d_next_p < d_end_p ? traits_type::to_int_type(*d_next_p)
+                                  : traits_type::eof();
+    }
+
+    /// Consume and return the next byte, or return `eof` if none remain.
+    int_type uflow()
+    {
+        return d_next_p < d_end_p ? traits_type::to_int_type(*d_next_p++)
+                                  : traits_type::eof();
+    }
+
+    /// Consume up to the specified `numBytes` bytes, copying them to the
+    /// specified `buffer`, and return the number of bytes consumed.
+    bsl::streamsize xsgetn(char *buffer, bsl::streamsize numBytes)
+    {
+        const bsl::streamsize numRead = bsl::min<bsl::streamsize>(
+                                                         numBytes,
+                                                         d_end_p - d_next_p);
+        bsl::memcpy(buffer, d_next_p, numRead);
+        d_next_p += numRead;
+
+        return numRead;
+    }
+};
+
 }  // close namespace u
 }  // close unnamed namespace
 
@@ -6016,6 +6115,10 @@ int main(int argc, char *argv[])
         //    `bsl::streambuf` positioned right after the end of the leading
         //    valid UTF-8 (if any) and before the invalid UTF-8 code point.
         //
+        // 4. That `readIfValid` does so for a `bsl::streambuf` that cannot
+        //    seek, and that it loses no valid UTF-8 read from a
+        //    `bsl::streambuf` that can neither seek nor put back.
+        //
         // PLAN:
         // 1. In this test case, we test incorrect UTF-8 sequences both
         //    preceded by, and sometimes followed by, correct UTF-8 input.
@@ -6058,6 +6161,13 @@ int main(int argc, char *argv[])
         //
         // 9. We now repeat step '6'.
         //
+        // 10. Finally, we call `readIfValid` for a variety of invalid
+        //     sequences preceded by valid UTF-8 of various lengths, with
+        //     output buffers of every length, on a stream buffer that cannot
+        //     seek and on one that can neither seek nor put back, and verify
+        //     the status, the output, and (where required) the position of
+        //     the stream buffer.
+        //
         // Testing:
         //   IntPtr advanceIfValid(int *, cchar **,  cchar *, IntPtr);
         //   IntPtr advanceIfValid(int *, cchar **, cchar *, size_t, IntPtr);
@@ -6458,6 +6568,114 @@ int main(int argc, char *argv[])
                 }
             }
         }
+
+        if (verbose) cout << "Reading from stream buffers that cannot seek"
+                             " or cannot put back\n";
+        {
+            // A stream buffer that cannot seek must still be left positioned
+            // at the end of the valid UTF-8 read, since bytes read from its
+            // get area can be put back; one that cannot put back need not
+            // be, but no valid UTF-8 read from it may be lost.
+
+            static const struct {
+                int         d_line;
+                const char *d_invalid;  // invalid sequence
+                int         d_status;   // expected status
+            } DATA[] = {
+                //LINE INVALID               STATUS
+                //---- --------------------  ------
+                { L_,  "\x80",               UCO },
+                { L_,  "\xc3(",              NCO },
+                { L_,  "\xe2\x82(",          NCO },
+                { L_,  "\xc0\x80",           OLE },
+                { L_,  "\xed\xa0\x80",       SUR },
+                { L_,  "\xf8",               IIO },
+                { L_,  "\xf4\x90\x80\x80",   VTL },
+                { L_,  "\xf0\x9f\x98",       EIT },
+            };
+            enum { k_NUM_DATA = sizeof DATA / sizeof *DATA };
+
+            static const int REPEATS[] = { 0, 1, 2, 5, 20 };
+            enum { k_NUM_REPEATS = sizeof REPEATS / sizeof *REPEATS };
+
+            for (int ti = 0; ti < k_NUM_DATA; ++ti) {
+            for (int ri = 0; ri < k_NUM_REPEATS; ++ri) {
+                const int         LINE    = DATA[ti].d_line;
+                const char *const INVALID = DATA[ti].d_invalid;
+                const int         STATUS  = DATA[ti].d_status;
+                const int         REPEAT  = REPEATS[ri];
+
+                // Code points of each length, so that blocks of input end
+                // within sequences of every length.
+
+                bsl::string str;
+                for (int i = 0; i < REPEAT; ++i) {
+                    str += "a\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80";
+                }
+                const IntPtr VALID_LEN = str.length();
+
+                str += INVALID;
+                if (EIT != STATUS) {
+                    str += "xyz";
+                }
+                const IntPtr STR_LEN = str.length();
+
+                for (IntPtr outLen = 4; outLen <= STR_LEN + 4; ++outLen) {
+                    if (veryVerbose) { T_ P_(LINE) P_(REPEAT) P(outLen) }
+
+                    bsl::string out(outLen, '?');
+                    int         sts;
+
+                    u::NonSeekableStreamBuf nssb(str.data(), STR_LEN);
+
+                    IntPtr len = Obj::readIfValid(&sts,
+                                                  &out[0],
+                                                  outLen,
+                                                  &nssb);
+                    ASSERTV(LINE, REPEAT, outLen, len, len <= VALID_LEN);
+                    ASSERTV(LINE, REPEAT, outLen,
+                            str.substr(0, len) == out.substr(0, len));
+                    if (sts < 0) {
+                        ASSERTV(LINE, REPEAT, outLen, sts, STATUS == sts);
+                        ASSERTV(LINE, REPEAT, outLen, len, VALID_LEN == len);
+                    }
+                    else {
+                        ASSERTV(LINE, REPEAT, outLen, sts, 0 < sts);
+                        ASSERTV(LINE, REPEAT, outLen, len, outLen - 3 <= len);
+                    }
+
+                    bsl::string remainder(STR_LEN, '?');
+                    remainder.resize(nssb.sgetn(&remainder[0], STR_LEN));
+                    ASSERTV(LINE, REPEAT, outLen, len,
+                            str.substr(len) == remainder);
+
+                    u::NoPutBackStreamBuf npsb(str.data(), STR_LEN);
+
+                    IntPtr npLen = Obj::readIfValid(&sts,
+                                                    &out[0],
+                                                    outLen,
+                                                    &npsb);
+                    ASSERTV(LINE, REPEAT, outLen, len, npLen, len == npLen);
+                    ASSERTV(LINE, REPEAT, outLen,
+                            str.substr(0, npLen) == out.substr(0, npLen));
+                    if (sts < 0) {
+                        ASSERTV(LINE, REPEAT, outLen, sts, STATUS == sts);
+                    }
+                    else {
+                        ASSERTV(LINE, REPEAT, outLen, sts, 0 < sts);
+
+                        // No invalid UTF-8 was read, so `npsb` must be left
+                        // positioned at the end of the valid UTF-8 read.
+
+                        remainder.resize(STR_LEN);
+                        remainder.resize(npsb.sgetn(&remainder[0], STR_LEN));
+                        ASSERTV(LINE, REPEAT, outLen, npLen,
+                                str.substr(npLen) == remainder);
+                    }
+                }
+            }
+            }
+        }
       } break;
       case 8: {
         // --------------------------------------------------------------------
@@ -0,0 +1,117 @@
+// bdljsn_jsondocument.cpp                                            -*-C++-*-
+#include <bdljsn_jsondocument.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdljsn_jsondocument_cpp,"$Id$ $CSID$")
+
+#include <bdljsn_jsonutil.h>
+
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+
+#include <bsl_new.h>
+
+namespace BloombergLP {
+namespace bdljsn {
+
+// Implementation Note: The value is held in a `bsls::ObjectBuffer` so that
+// its destructor is never run: all of its memory belongs to `d_arena`, which
+// is rewound or released as a whole, and a new null value is then created in
+// the buffer.  Since `Json` propagates its allocator to every element, no
+// memory reachable from the value is supplied by any other allocator.
+
+                             // ------------------
+                             // class JsonDocument
+                             // ------------------
+
+// PRIVATE MANIPULATORS
+void JsonDocument::discard(bool release)
+{
+    if (release) {
+        d_arena.release();
+    }
+    else {
+        d_arena.rewind();
+    }
+
+    new (d_value.buffer()) Json(&d_arena);
+}
+
+// CREATORS
+JsonDocument::JsonDocument(bslma::Allocator *basicAllocator)
+: d_arena(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    new (d_value.buffer()) Json(&d_arena);
+}
+
+JsonDocument::JsonDocument(bsls::Types::size_type  initialSize,
+                           bslma::Allocator       *basicAllocator)
+: d_arena(initialSize, basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < initialSize);
+
+    new (d_value.buffer()) Json(&d_arena);
+}
+
+JsonDocument::~JsonDocument()
+{
+    // The value is not destroyed: `d_arena` releases all of its memory.
+}
+
+// MANIPULATORS
+int JsonDocument::read(Error                   *errorDescription,
+                       const bsl::string_view&  input,
+                       const ReadOptions&       options)
+{
+    BSLS_ASSERT(errorDescription);
+
+    reset();
+
+    const int rc = JsonUtil::read(&value(), errorDescription, input, options);
+    if (0 != rc) {
+        // Reclaim the memory of any partially read value.
+
+        reset();
+    }
+    return rc;
+}
+
+int JsonDocument::read(Error              *errorDescription,
+                       bsl::streambuf     *input,
+                       const ReadOptions&  options)
+{
+    BSLS_ASSERT(errorDescription);
+    BSLS_ASSERT(input);
+
+    reset();
+
+    const int rc = JsonUtil::read(&value(), errorDescription, input, options);
+    if (0 != rc) {
+        // Reclaim the memory of any partially read value.
+
+        reset();
+    }
+    return rc;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,322 @@
+// bdljsn_jsondocument.h                                              -*-C++-*-
+#ifndef INCLUDED_BDLJSN_JSONDOCUMENT
+#define INCLUDED_BDLJSN_JSONDOCUMENT
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a JSON value held in an arena owned by the value.
+//
+//@CLASSES:
+//  bdljsn::JsonDocument: a `Json` value whose memory is one sequential arena
+//
+//@SEE_ALSO: bdljsn_json, bdljsn_jsonutil, bdlma_sequentialallocator
+//
+//@DESCRIPTION: This component provides a mechanism, `bdljsn::JsonDocument`,
+// that holds a `bdljsn::Json` value all of whose memory is supplied by a
+// `bdlma::SequentialAllocator` (the *arena*) owned by the document.  A
+// `JsonDocument` is intended for the common case of a document that is read,
+// examined, and then discarded as a whole:
+//
+// * Reading a document into a `JsonDocument` (using one of the `read`
+//   methods, which forward to `bdljsn::JsonUtil::read`) allocates every
+//   string, number, array, and object of the document by advancing a pointer
+//   in the arena, rather than by a call to a general-purpose allocator.
+//
+// * Discarding the value (by `reset`, by reading another document, or by
+//   destroying the `JsonDocument`) does not visit the elements of the value:
+//   the arena is rewound or released as a whole.  Note that destroying a
+//   `bdljsn::Json` object having a typical allocator takes time comparable to
+//   building it, since every string and container is deallocated
+//   individually.
+//
+// * `reset` and `read` *rewind* the arena, retaining the memory obtained from
+//   the underlying allocator for use by the next document, so that reading a
+//   sequence of similar documents into the same `JsonDocument` quickly
+//   reaches a steady state in which no memory is obtained from the underlying
+//   allocator at all.
+//
+// The value of a `JsonDocument` is accessed, and may be modified, through the
+// `value` method.  Memory released by modifications (e.g., by erasing a
+// member of an object, or by assigning a new value to a string) is not
+// reclaimed until the next call to `reset`, `read`, or `release`, so a
+// `JsonDocument` is not appropriate for a value that is modified repeatedly
+// over a long lifetime: use a `bdljsn::Json` object for such values.
+//
+///Memory Use
+///----------
+// The value is constructed using the arena, and every `bdljsn::Json`,
+// `bdljsn::JsonArray`, `bdljsn::JsonObject`, and string it contains uses the
+// arena, as all of those types propagate their allocator to their elements.
+// Short strings (including most member names) are held within their
+// `bsl::string` objects, and do not allocate.  Since `JsonDocument` never runs
+// the destructor of its value (the arena is simply rewound), the behavior is
+// undefined if a `bdljsn::Json` object reachable from `value()` holds memory
+// from any other allocator.  No such object can be created through the
+// interface of `bdljsn::Json`, which always copies into its own allocator.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reading a Sequence of Documents
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose a service receives a sequence of JSON messages, each of which is
+// processed and then discarded.
+//
+// First, we create a `JsonDocument` once, outside of the loop that processes
+// the messages:
+// ```
+// const char *const MESSAGES[] = {
+//     "{\"symbol\": \"IBM\", \"price\": 143.5, \"size\": 100}",
+//     "{\"symbol\": \"AAPL\", \"price\": 190.25, \"size\": 300}",
+//     "{\"symbol\": \"IBM\", \"price\": 143.75, \"size\": 200}",
+// };
+// const int NUM_MESSAGES = sizeof MESSAGES / sizeof *MESSAGES;
+//
+// bdljsn::JsonDocument document;
+// bdljsn::Error        error;
+// ```
+// Then, for each message, we read the message into the document and extract
+// the fields of interest.  Each call to `read` discards the previous message
+// in constant time, and reuses its memory:
+// ```
+// int totalSize = 0;
+// for (int i = 0; i < NUM_MESSAGES; ++i) {
+//     int rc = document.read(&error, MESSAGES[i]);
+//     assert(0 == rc);
+//
+//     const bdljsn::Json& message = document.value();
+//
+//     if ("IBM" == message["symbol"].theString()) {
+//         int size;
+//         rc = message["size"].asInt(&size);
+//         assert(0 == rc);
+//
+//         totalSize += size;
+//     }
+// }
+// assert(300 == totalSize);
+// ```
+// Finally, we observe that an invalid message is reported in the same way as
+// by `bdljsn::JsonUtil::read`, and leaves the document with the null value:
+// ```
+// int rc = document.read(&error, "{\"symbol\": }");
+// assert(0 != rc);
+// assert(!error.message().empty());
+// assert(document.value().isNull());
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdljsn_error.h>
+#include <bdljsn_json.h>
+#include <bdljsn_readoptions.h>
+
+#include <bdlma_sequentialallocator.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_objectbuffer.h>
+#include <bsls_types.h>
+
+#include <bsl_streambuf.h>
+#include <bsl_string_view.h>
+
+namespace BloombergLP {
+namespace bdljsn {
+
+                             // ==================
+                             // class JsonDocument
+                             // ==================
+
+/// This mechanism class holds a `Json` value whose memory is supplied by a
+/// sequential arena owned by this object, and which is discarded, without
+/// visiting its elements, by rewinding the arena.
+class JsonDocument {
+
+    // DATA
+    bdlma::SequentialAllocator d_arena;        // supplies all memory of the
+                                               // value
+
+    bsls::ObjectBuffer<Json>   d_value;        // value, constructed using
+                                               // `d_arena`, and never
+                                               // destroyed
+
+    bslma::Allocator          *d_allocator_p;  // underlying allocator (held,
+                                               // not owned)
+
+    // NOT IMPLEMENTED
+    JsonDocument(const JsonDocument&);
+    JsonDocument& operator=(const JsonDocument&);
+
+    // PRIVATE MANIPULATORS
+
+    /// Discard the value of this document, and create a null value using the
+    /// arena.  Rewind the arena if the specified `release` is `false`, and
+    /// release it otherwise.
+    void discard(bool release);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(JsonDocument, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+
+    /// Create a document having the null value.  Optionally specify a
+    /// `basicAllocator` used to supply the memory of the arena.  If
+    /// `basicAllocator` is 0, the currently installed default allocator is
+    /// used.
+    explicit JsonDocument(bslma::Allocator *basicAllocator = 0);
+
+    /// Create a document having the null value, whose arena initially
+    /// obtains a buffer of the specified `initialSize` (in bytes).
+    /// Optionally specify a `basicAllocator` used to supply the memory of
+    /// the arena.  If `basicAllocator` is 0, the currently installed default
+    /// allocator is used.  The behavior is undefined unless
+    /// `0 < initialSize`.
+    explicit JsonDocument(bsls::Types::size_type  initialSize,
+                          bslma::Allocator       *basicAllocator = 0);
+
+    /// Destroy this document, releasing all memory of its arena without
+    /// visiting the elements of its value.
+    ~JsonDocument();
+
+    // MANIPULATORS
+
+    /// Discard the value of this document and load the value of the JSON
+    /// document in the specified `input` using the arena, as if by
+    /// `JsonUtil::read(&value(), errorDescription, input, options)`.
+    /// Optionally specify `options` controlling the reading of the document.
+    /// If `options` is not specified, a default `ReadOptions` is used.
+    /// Return 0 on success, and a non-zero value otherwise, loading a
+    /// description of the error into the specified `errorDescription` and
+    /// leaving this document with the null value.  The memory of the
+    /// previous value is retained by the arena for use by the new value.
+    /// The behavior is undefined unless `errorDescription` is not 0.
+    int read(Error *errorDescription, const bsl::string_view& input);
+    int read(Error                   *errorDescription,
+             const bsl::string_view&  input,
+             const ReadOptions&       options);
+
+    /// Discard the value of this document and load the value of the JSON
+    /// document read from the specified `input` using the arena, as if by
+    /// `JsonUtil::read(&value(), errorDescription, input, options)`.
+    /// Optionally specify `options` controlling the reading of the document.
+    /// If `options` is not specified, a default `ReadOptions` is used.
+    /// Return 0 on success, and a non-zero value otherwise, loading a
+    /// description of the error into the specified `errorDescription` and
+    /// leaving this document with the null value.  The memory of the
+    /// previous value is retained by the arena for use by the new value.
+    /// The behavior is undefined unless `errorDescription` and `input` are
+    /// not 0.
+    int read(Error *errorDescription, bsl::streambuf *input);
+    int read(Error              *errorDescription,
+             bsl::streambuf     *input,
+             const ReadOptions&  options);
+
+    /// Discard the value of this document, leaving it with the null value,
+    /// and return all memory of the arena to the underlying allocator.
+    void release();
+
+    /// Discard the value of this document, leaving it with the null value.
+    /// The memory of the previous value is retained by the arena for use by
+    /// subsequent values.
+    void reset();
+
+    /// Return a reference providing modifiable access to the value of this
+    /// document.  Note that memory released by modifying the value is not
+    /// reclaimed until the next call to `read`, `release`, or `reset`.
+    Json& value();
+
+    // ACCESSORS
+
+    /// Return a reference providing non-modifiable access to the value of
+    /// this document.
+    const Json& value() const;
+
+                                  // Aspects
+
+    /// Return the allocator used by this document to supply the memory of
+    /// its arena.  Note that if no allocator was supplied at construction
+    /// the default allocator in effect at construction is used.
+    bslma::Allocator *allocator() const;
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                             // ------------------
+                             // class JsonDocument
+                             // ------------------
+
+// MANIPULATORS
+inline
+int JsonDocument::read(Error *errorDescription, const bsl::string_view& input)
+{
+    return read(errorDescription, input, ReadOptions());
+}
+
+inline
+int JsonDocument::read(Error *errorDescription, bsl::streambuf *input)
+{
+    return read(errorDescription, input, ReadOptions());
+}
+
+inline
+void JsonDocument::release()
+{
+    discard(true);
+}
+
+inline
+void JsonDocument::reset()
+{
+    discard(false);
+}
+
+inline
+Json& JsonDocument::value()
+{
+    return d_value.object();
+}
+
+// ACCESSORS
+inline
+const Json& JsonDocument::value() const
+{
+    return d_value.object();
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *JsonDocument::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
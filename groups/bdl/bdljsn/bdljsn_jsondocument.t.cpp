@@ -0,0 +1,688 @@
+// bdljsn_jsondocument.t.cpp                                          -*-C++-*-
+#include <bdljsn_jsondocument.h>
+
+#include <bdljsn_error.h>
+#include <bdljsn_json.h>
+#include <bdljsn_jsonutil.h>
+#include <bdljsn_readoptions.h>
+
+#include <bdlsb_fixedmeminstreambuf.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The component under test is a mechanism that holds a `bdljsn::Json` value in
+// an arena, and forwards its `read` methods to `bdljsn::JsonUtil::read`.  We
+// verify that the values read, and the errors reported, are those of
+// `JsonUtil::read`, and that the memory of the value comes from the arena,
+// whose memory is in turn supplied by the allocator given at construction, and
+// is reused by subsequent values.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit JsonDocument(bslma::Allocator *basicAllocator = 0);
+// [ 2] explicit JsonDocument(size_type initialSize, Allocator *ba = 0);
+// [ 2] ~JsonDocument();
+//
+// MANIPULATORS
+// [ 3] int read(Error *, const bsl::string_view&);
+// [ 3] int read(Error *, const bsl::string_view&, const ReadOptions&);
+// [ 3] int read(Error *, bsl::streambuf *);
+// [ 3] int read(Error *, bsl::streambuf *, const ReadOptions&);
+// [ 2] void release();
+// [ 2] void reset();
+// [ 2] Json& value();
+//
+// ACCESSORS
+// [ 2] const Json& value() const;
+// [ 2] bslma::Allocator *allocator() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdljsn::JsonDocument Obj;
+typedef bdljsn::Json         Json;
+typedef bdljsn::JsonUtil     Util;
+typedef bdljsn::Error        Error;
+typedef bdljsn::ReadOptions  ReadOptions;
+
+static int verbose = 0;
+static int veryVerbose = 0;
+static int veryVeryVerbose = 0;
+static int veryVeryVeryVerbose = 0;
+
+// ============================================================================
+//                          HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// Load into the specified `result` a valid JSON text of at least the
+/// specified `length` consisting of an array of objects of typical shape.
+void makeDocument(bsl::string *result, bsl::size_t length)
+{
+    result->assign("[");
+    for (int i = 0; result->length() < length; ++i) {
+        if (i) {
+            result->append(",\n");
+        }
+        result->append("  {\"id\": 12345, \"name\": \"Some Security Name\", "
+                       "\"price\": 101.25, \"active\": true, "
+                       "\"tags\": [\"alpha\", \"beta\", \"gam\\\"ma\"], "
+                       "\"description\": \"A longer description of the "
+                       "security, typical of reference data.\"}");
+    }
+    result->append("]");
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Example 1: Reading a Sequence of Documents
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose a service receives a sequence of JSON messages, each of which is
+// processed and then discarded.
+//
+// First, we create a `JsonDocument` once, outside of the loop that processes
+// the messages:
+// ```
+    const char *const MESSAGES[] = {
+        "{\"symbol\": \"IBM\", \"price\": 143.5, \"size\": 100}",
+        "{\"symbol\": \"AAPL\", \"price\": 190.25, \"size\": 300}",
+        "{\"symbol\": \"IBM\", \"price\": 143.75, \"size\": 200}",
+    };
+    const int NUM_MESSAGES = sizeof MESSAGES / sizeof *MESSAGES;
+
+    bdljsn::JsonDocument document;
+    bdljsn::Error        error;
+// ```
+// Then, for each message, we read the message into the document and extract
+// the fields of interest.  Each call to `read` discards the previous message
+// in constant time, and reuses its memory:
+// ```
+    int totalSize = 0;
+    for (int i = 0; i < NUM_MESSAGES; ++i) {
+        int rc = document.read(&error, MESSAGES[i]);
+        ASSERT(0 == rc);
+
+        const bdljsn::Json& message = document.value();
+
+        if ("IBM" == message["symbol"].theString()) {
+            int size;
+            rc = message["size"].asInt(&size);
+            ASSERT(0 == rc);
+
+            totalSize += size;
+        }
+    }
+    ASSERT(300 == totalSize);
+// ```
+// Finally, we observe that an invalid message is reported in the same way as
+// by `bdljsn::JsonUtil::read`, and leaves the document with the null value:
+// ```
+    int rc = document.read(&error, "{\"symbol\": }");
+    ASSERT(0 != rc);
+    ASSERT(!error.message().empty());
+    ASSERT(document.value().isNull());
+// ```
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING `read`
+        //
+        // Concerns:
+        // 1. Each `read` method loads the value, or reports the error, that
+        //    `JsonUtil::read` does for the same input and options.
+        //
+        // 2. On failure, the value is null.
+        //
+        // 3. All memory of the value is supplied by the arena, and so by the
+        //    allocator supplied at construction.
+        //
+        // 4. Reading a document no larger than the previous one obtains no
+        //    memory from the underlying allocator.
+        //
+        // 5. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Using the table-driven technique, read a set of valid and
+        //    invalid texts, both from a `bsl::string_view` and from a
+        //    `bsl::streambuf`, with default and non-default options, and
+        //    compare the status, value, and error with those of
+        //    `JsonUtil::read`.  (C-1..2)
+        //
+        // 2. Verify that the default allocator is not used while reading,
+        //    other than by `JsonUtil::read` itself for temporary memory, by
+        //    comparing `numBytesInUse` of the object allocator with the
+        //    default allocator before and after.  (C-3)
+        //
+        // 3. Read a large document twice and verify that the second read
+        //    obtains no blocks from the object allocator.  (C-4)
+        //
+        // 4. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   int read(Error *, const bsl::string_view&);
+        //   int read(Error *, const bsl::string_view&, const ReadOptions&);
+        //   int read(Error *, bsl::streambuf *);
+        //   int read(Error *, bsl::streambuf *, const ReadOptions&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `read`" << endl
+                          << "==============" << endl;
+
+        static const struct {
+            int         d_line;     // source line number
+            const char *d_input_p;  // text to read
+        } DATA[] = {
+            //LINE  INPUT
+            //----  -------------------------------------------------------
+            { L_,   "null"                                                  },
+            { L_,   "true"                                                  },
+            { L_,   "-1.5e10"                                               },
+            { L_,   "\"a string longer than the short string buffer\""      },
+            { L_,   "[1, [2, [3]], {}]"                                     },
+            { L_,   "{\"a\": {\"b\": {\"c\": [\"deeply nested value\"]}}}"  },
+            { L_,   "{\"k\": 1, \"k\": 2}"                                  },
+            { L_,   "[1, 2] "                                               },
+            { L_,   "[1, 2] 3"                                              },
+            { L_,   ""                                                      },
+            { L_,   "[1, 2"                                                 },
+            { L_,   "{\"a\": }"                                             },
+            { L_,   "\"\\uD800\""                                           },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        ReadOptions trailingAndShallow;
+        trailingAndShallow.setAllowTrailingText(true).setMaxNestedDepth(2);
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int              LINE = DATA[ti].d_line;
+            const bsl::string_view INPUT(DATA[ti].d_input_p);
+
+            if (veryVerbose) { T_ P_(LINE) P(INPUT) }
+
+            for (int cfg = 0; cfg < 4; ++cfg) {
+                const bool         USE_STREAM  = cfg & 1;
+                const bool         USE_OPTIONS = cfg & 2;
+                const ReadOptions  OPTIONS     = USE_OPTIONS
+                                               ? trailingAndShallow
+                                               : ReadOptions();
+
+                // Start from a non-null value to verify that it is
+                // discarded.
+
+                mX.value().makeString("previous value of the document");
+
+                Json  expected;
+                Error expectedError;
+                Error error(&oa);
+
+                bdlsb::FixedMemInStreamBuf expectedBuffer(INPUT.data(),
+                                                          INPUT.size());
+                const int EXPECTED_RC = Util::read(&expected,
+                                                   &expectedError,
+                                                   &expectedBuffer,
+                                                   OPTIONS);
+
+                bdlsb::FixedMemInStreamBuf buffer(INPUT.data(), INPUT.size());
+
+                int rc;
+                if (USE_STREAM) {
+                    rc = USE_OPTIONS ? mX.read(&error, &buffer, OPTIONS)
+                                     : mX.read(&error, &buffer);
+                }
+                else {
+                    rc = USE_OPTIONS ? mX.read(&error, INPUT, OPTIONS)
+                                     : mX.read(&error, INPUT);
+                }
+
+                ASSERTV(LINE, cfg, rc, EXPECTED_RC,
+                        (0 == rc) == (0 == EXPECTED_RC));
+                ASSERTV(LINE, cfg, error, expectedError,
+                        expectedError == error);
+
+                if (0 == EXPECTED_RC) {
+                    ASSERTV(LINE, cfg, X.value(), expected,
+                            expected == X.value());
+                }
+                else {
+                    ASSERTV(LINE, cfg, X.value(), X.value().isNull());
+                }
+
+                ASSERTV(LINE, cfg, X.value().allocator() != &da);
+            }
+        }
+
+        if (verbose) cout << "\tMemory is supplied by the arena." << endl;
+        {
+            bsl::string text;
+            makeDocument(&text, 256 * 1024);
+
+            bslma::TestAllocator         sa("supplied", veryVeryVeryVerbose);
+            bslma::TestAllocator         ta("default", veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard guard(&ta);
+
+            Obj   mY(&sa);  const Obj& Y = mY;
+            Error error(&sa);
+
+            ASSERT(0 == mY.read(&error, text));
+            ASSERT(Y.value().isArray());
+            ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+
+            const bsls::Types::Int64 NUM_BLOCKS = sa.numBlocksTotal();
+            const bsls::Types::Int64 NUM_BYTES  = sa.numBytesInUse();
+
+            const bsls::Types::Int64 LENGTH = text.length();
+
+            ASSERTV(NUM_BYTES, LENGTH < NUM_BYTES);
+
+            if (verbose) cout << "\tMemory is reused." << endl;
+
+            ASSERT(0 == mY.read(&error, text));
+            ASSERT(Y.value().isArray());
+            ASSERTV(NUM_BLOCKS, sa.numBlocksTotal(),
+                    NUM_BLOCKS == sa.numBlocksTotal());
+            ASSERTV(NUM_BYTES, sa.numBytesInUse(),
+                    NUM_BYTES == sa.numBytesInUse());
+
+            bdlsb::FixedMemInStreamBuf buffer(text.data(), text.length());
+
+            ASSERT(0 == mY.read(&error, &buffer));
+            ASSERT(Y.value().isArray());
+            ASSERTV(NUM_BLOCKS, sa.numBlocksTotal(),
+                    NUM_BLOCKS == sa.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj                        mZ(&oa);
+            Error                      error;
+            bdlsb::FixedMemInStreamBuf buffer("1", 1);
+
+            ASSERT_PASS(mZ.read(&error, bsl::string_view("1")));
+            ASSERT_FAIL(mZ.read(0,      bsl::string_view("1")));
+            ASSERT_PASS(mZ.read(&error, &buffer));
+            ASSERT_FAIL(mZ.read(0,      &buffer));
+            ASSERT_FAIL(mZ.read(&error, static_cast<bsl::streambuf *>(0)));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, `reset`, `release`, AND ACCESSORS
+        //
+        // Concerns:
+        // 1. A newly created document has the null value, and obtains no
+        //    memory until its value requires some.
+        //
+        // 2. The value uses the arena, whose memory is supplied by the
+        //    allocator passed at construction, or the default allocator.
+        //
+        // 3. When an initial size is specified, the arena obtains a buffer
+        //    of that size.
+        //
+        // 4. `reset` discards the value, leaving the document null, and
+        //    retains the memory of the arena; `release` also returns that
+        //    memory to the underlying allocator.
+        //
+        // 5. The destructor returns all memory.
+        //
+        // 6. The object has the `bslma::UsesBslmaAllocator` trait.
+        //
+        // Plan:
+        // 1. Create documents with and without an allocator and an initial
+        //    size, fill their values, and observe the memory of the test
+        //    allocators before and after `reset`, `release`, and
+        //    destruction.  (C-1..5)
+        //
+        // 2. Verify the trait with `BSLMF_ASSERT`.  (C-6)
+        //
+        // Testing:
+        //   explicit JsonDocument(bslma::Allocator *basicAllocator = 0);
+        //   explicit JsonDocument(size_type initialSize, Allocator *ba = 0);
+        //   ~JsonDocument();
+        //   void release();
+        //   void reset();
+        //   Json& value();
+        //   const Json& value() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                  << "CREATORS, `reset`, `release`, AND ACCESSORS" << endl
+                  << "===========================================" << endl;
+
+        BSLMF_ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+
+        for (char cfg = 'a'; cfg <= 'd'; ++cfg) {
+            const char CONFIG = cfg;
+
+            if (veryVerbose) { T_ P(CONFIG) }
+
+            bslma::TestAllocator sa("supplied", veryVeryVeryVerbose);
+
+            Obj *objPtr = 0;
+            switch (CONFIG) {
+              case 'a': objPtr = new Obj();                           break;
+              case 'b': objPtr = new Obj(&sa);                        break;
+              case 'c': objPtr = new Obj(4096);                       break;
+              case 'd': objPtr = new Obj(4096, &sa);                  break;
+            }
+
+            Obj&                  mX = *objPtr;  const Obj& X = mX;
+            bslma::TestAllocator& oa = ('a' == CONFIG || 'c' == CONFIG)
+                                     ? da
+                                     : sa;
+
+            ASSERTV(CONFIG, &oa == X.allocator());
+            ASSERTV(CONFIG, X.value().isNull());
+            ASSERTV(CONFIG, &mX.value() == &X.value());
+
+            if ('c' == CONFIG || 'd' == CONFIG) {
+                ASSERTV(CONFIG, oa.numBytesInUse(),
+                        4096 <= oa.numBytesInUse());
+            }
+            else {
+                ASSERTV(CONFIG, oa.numBytesInUse(), 0 == oa.numBytesInUse());
+            }
+
+            mX.value().makeArray();
+            for (int i = 0; i < 100; ++i) {
+                mX.value().theArray().pushBack(
+                               Json("a string value longer than the buffer"));
+            }
+            ASSERTV(CONFIG, 100 == X.value().size());
+            ASSERTV(CONFIG,
+                    X.value().allocator() ==
+                         X.value()[0].theString().get_allocator().mechanism());
+
+            const bsls::Types::Int64 IN_USE = oa.numBytesInUse();
+            ASSERTV(CONFIG, IN_USE, 4096 < IN_USE);
+
+            mX.reset();
+
+            ASSERTV(CONFIG, X.value().isNull());
+            ASSERTV(CONFIG, IN_USE, oa.numBytesInUse(),
+                    0 < oa.numBytesInUse());
+
+            mX.value().makeString("another string value longer than the "
+                                  "short string buffer");
+            ASSERTV(CONFIG, X.value().isString());
+
+            mX.release();
+
+            ASSERTV(CONFIG, X.value().isNull());
+            if ('a' == CONFIG || 'b' == CONFIG) {
+                ASSERTV(CONFIG, oa.numBytesInUse(), 0 == oa.numBytesInUse());
+            }
+
+            mX.value().makeString("a string value after `release`, longer "
+                                  "than the short string buffer");
+
+            delete objPtr;
+
+            ASSERTV(CONFIG, oa.numBytesInUse(), 0 == oa.numBytesInUse());
+            ASSERTV(CONFIG, sa.numBytesInUse(), 0 == sa.numBytesInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Read a valid and an invalid document, and reset the document.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj   mX(&oa);  const Obj& X = mX;
+        Error error;
+
+        ASSERT(X.value().isNull());
+
+        ASSERT(0 == mX.read(&error, "{\"name\": [1, \"two\", null]}"));
+        ASSERT(X.value().isObject());
+        ASSERT(3 == X.value()["name"].size());
+        ASSERT("two" == X.value()["name"][1].theString());
+
+        ASSERT(0 != mX.read(&error, "{\"name\": "));
+        ASSERT(X.value().isNull());
+        ASSERT(!error.message().empty());
+
+        ASSERT(0 == mX.read(&error, "[true]"));
+        ASSERT(X.value().isArray());
+
+        mX.reset();
+        ASSERT(X.value().isNull());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        // 1. Reading a document into, and discarding it from, a
+        //    `JsonDocument` is faster than doing the same with a `Json`
+        //    object using a general-purpose allocator.
+        //
+        // Plan:
+        // 1. Read and discard a large generated document repeatedly both
+        //    ways, using the new-delete allocator, and report the time taken
+        //    by each, and by the destruction of the `Json` object alone.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        bslma::DefaultAllocatorGuard guard(
+                                      &bslma::NewDeleteAllocator::singleton());
+
+        bsl::string text;
+        makeDocument(&text, 16 * 1024 * 1024);
+
+        const int NUM_ITERATIONS = 5;
+
+        double destroyTime = 0;
+
+        bsls::Stopwatch sw;
+        sw.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            Json *json = new Json();
+
+            ASSERT(0 == Util::read(json, text));
+
+            bsls::Stopwatch destroyWatch;
+            destroyWatch.start();
+            delete json;
+            destroyWatch.stop();
+
+            destroyTime += destroyWatch.elapsedTime();
+        }
+        sw.stop();
+
+        cout << "Json:         " << sw.elapsedTime() / NUM_ITERATIONS
+             << " s per document (of which destruction "
+             << destroyTime / NUM_ITERATIONS << " s)" << endl;
+
+        Obj   mX;
+        Error error;
+
+        sw.reset();
+        sw.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            ASSERT(0 == mX.read(&error, text));
+        }
+        mX.reset();
+        sw.stop();
+
+        cout << "JsonDocument: " << sw.elapsedTime() / NUM_ITERATIONS
+             << " s per document" << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
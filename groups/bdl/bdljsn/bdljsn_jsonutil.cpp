@@ -10,6 +10,7 @@ BSLS_IDENT_RCSID(bdljsn_jsonutil_cpp, "$Id$ $CSID$")
 #include <bdljsn_location.h>
 #include <bdljsn_readoptions.h>
 #include <bdljsn_stringutil.h>
+#include <bdljsn_structuralindexutil.h>
 #include <bdljsn_tokenizer.h>
 #include <bdljsn_writeoptions.h>
 #include <bdljsn_writestyle.h>
@@ -22,6 +23,7 @@ BSLS_IDENT_RCSID(bdljsn_jsonutil_cpp, "$Id$ $CSID$")
 #include <bsls_assert.h>
 #include <bsls_compilerfeatures.h>
 
+#include <bsl_cstring.h>
 #include <bsl_ostream.h>
 #include <bsl_unordered_map.h>
 #include <bsl_vector.h>
@@ -225,6 +227,352 @@ int read(Json *result, Error *error, Tokenizer *tokenizer, int maxNestedDepth)
       } break;
     }
 
+    return 0;
+}
+
+                                // Indexed Read Implementation
+
+// Implementation Note:  When the input is held in contiguous memory, 'read'
+// first attempts to parse it in two stages: 'StructuralIndexUtil::buildIndex'
+// locates the structural positions of the text (using vector instructions
+// where available), and 'IndexedReader' then builds the 'Json' object by
+// visiting those positions in order.  'IndexedReader' reports only whether
+// the text is a valid JSON document; if it is not (or if the document uses a
+// feature the indexed reader does not handle), 'read' falls back to the
+// 'Tokenizer'-based implementation above, which reproduces the error
+// description of earlier versions of this component exactly.  Therefore,
+// 'IndexedReader' must never accept a text that the 'Tokenizer'-based
+// implementation (in strict conformance mode) rejects, and must produce the
+// same 'Json' value for every text it accepts; it may, however, reject more
+// texts (e.g., a text using '\v' as white space).
+
+bool hasEscapes(const bsl::string_view& contents)
+    // Return 'true' if the specified 'contents' of a JSON string contain an
+    // escape sequence, and 'false' otherwise.
+{
+    return 0 != bsl::memchr(contents.data(), '\\', contents.size());
+}
+
+class IndexedReader {
+    // This class provides a mechanism for building a 'Json' object from a
+    // JSON text and the index of its structural positions.
+
+    // PRIVATE TYPES
+    typedef StructuralIndexUtil::Offset Offset;
+
+    // DATA
+    const char   *d_text_p;      // text being read (held, not owned)
+    bsl::size_t   d_length;      // length of the text
+    const Offset *d_position_p;  // next structural position to visit
+    const Offset *d_end_p;       // end of the structural positions
+
+    // NOT IMPLEMENTED
+    IndexedReader(const IndexedReader&);
+    IndexedReader& operator=(const IndexedReader&);
+
+    // PRIVATE MANIPULATORS
+    int readArray(JsonArray *result, int maxNestedDepth);
+        // Read into the specified 'result' the array whose '[' is at the
+        // current position, not exceeding the specified 'maxNestedDepth'.
+        // Return 0 on success, and a non-zero value otherwise.
+
+    int readObject(JsonObject *result, int maxNestedDepth);
+        // Read into the specified 'result' the object whose '{' is at the
+        // current position, not exceeding the specified 'maxNestedDepth'.
+        // Return 0 on success, and a non-zero value otherwise.
+
+    int readScalar(Json *result);
+        // Read into the specified 'result' the literal or number starting at
+        // the current position.  Return 0 on success, and a non-zero value
+        // otherwise.
+
+    int readString(Json *result);
+        // Read into the specified 'result' the string whose opening quote is
+        // at the current position.  Return 0 on success, and a non-zero value
+        // otherwise.
+
+    bsl::string_view readStringContents();
+        // Return the characters between the quotes of the string whose
+        // opening quote is at the current position, and advance past its
+        // closing quote.  Note that escape sequences are not replaced.
+
+    // PRIVATE ACCESSORS
+    char current() const;
+        // Return the character at the current position.  The behavior is
+        // undefined if 'isAtEnd()'.
+
+  public:
+    // CREATORS
+    IndexedReader(const bsl::string_view&    text,
+                  const bsl::vector<Offset>& index)
+        // Create an 'IndexedReader' positioned at the start of the specified
+        // 'text' having the specified 'index' of structural positions.
+    : d_text_p(text.data())
+    , d_length(text.length())
+    , d_position_p(index.data())
+    , d_end_p(index.data() + index.size())
+    {
+    }
+
+    // MANIPULATORS
+    int readValue(Json *result, int maxNestedDepth);
+        // Read into the specified 'result' the value starting at the current
+        // position, not exceeding the specified 'maxNestedDepth'.  Return 0
+        // on success, and a non-zero value otherwise.
+
+    // ACCESSORS
+    bool isAtEnd() const
+        // Return 'true' if every structural position has been visited, and
+        // 'false' otherwise.
+    {
+        return d_position_p == d_end_p;
+    }
+};
+
+// PRIVATE MANIPULATORS
+int IndexedReader::readArray(JsonArray *result, int maxNestedDepth)
+{
+    if (maxNestedDepth < 0) {
+        return -1;                                                    // RETURN
+    }
+
+    ++d_position_p;  // '['
+
+    if (isAtEnd()) {
+        return -1;                                                    // RETURN
+    }
+    if (']' == current()) {
+        ++d_position_p;
+        return 0;                                                     // RETURN
+    }
+
+    while (true) {
+        result->pushBack(Json());
+
+        if (0 != readValue(&result->back(), maxNestedDepth)) {
+            return -1;                                                // RETURN
+        }
+
+        if (isAtEnd()) {
+            return -1;                                                // RETURN
+        }
+
+        const char separator = current();
+        ++d_position_p;
+
+        if (']' == separator) {
+            return 0;                                                 // RETURN
+        }
+        if (',' != separator) {
+            return -1;                                                // RETURN
+        }
+    }
+}
+
+int IndexedReader::readObject(JsonObject *result, int maxNestedDepth)
+{
+    if (maxNestedDepth < 0) {
+        return -1;                                                    // RETURN
+    }
+
+    ++d_position_p;  // '{'
+
+    if (isAtEnd()) {
+        return -1;                                                    // RETURN
+    }
+    if ('}' == current()) {
+        ++d_position_p;
+        return 0;                                                     // RETURN
+    }
+
+    bsl::string keyBuffer;
+
+    while (true) {
+        if (isAtEnd() || '"' != current()) {
+            return -1;                                                // RETURN
+        }
+
+        bsl::string_view key = readStringContents();
+        if (hasEscapes(key)) {
+            keyBuffer.clear();
+            if (0 != StringUtil::readUnquotedString(&keyBuffer, key)) {
+                return -1;                                            // RETURN
+            }
+            key = keyBuffer;
+        }
+
+        if (isAtEnd() || ':' != current()) {
+            return -1;                                                // RETURN
+        }
+        ++d_position_p;
+
+        // Keep the first value found for a given key, and discard others.
+
+        int rc;
+        if (result->contains(key)) {
+            Json temp;
+
+            rc = readValue(&temp, maxNestedDepth);
+        }
+        else {
+            rc = readValue(&(*result)[key], maxNestedDepth);
+        }
+
+        if (0 != rc || isAtEnd()) {
+            return -1;                                                // RETURN
+        }
+
+        const char separator = current();
+        ++d_position_p;
+
+        if ('}' == separator) {
+            return 0;                                                 // RETURN
+        }
+        if (',' != separator) {
+            return -1;                                                // RETURN
+        }
+    }
+}
+
+int IndexedReader::readScalar(Json *result)
+{
+    // A literal or number ends at the next white space or at the next
+    // structural position, whichever comes first.
+
+    const bsl::size_t begin = *d_position_p;
+    ++d_position_p;
+
+    const bsl::size_t limit = isAtEnd() ? d_length : *d_position_p;
+
+    bsl::size_t end = begin + 1;
+    while (end < limit
+        && ' '  != d_text_p[end]
+        && '\n' != d_text_p[end]
+        && '\t' != d_text_p[end]
+        && '\r' != d_text_p[end]) {
+        ++end;
+    }
+
+    const bsl::string_view value(d_text_p + begin, end - begin);
+
+    if ("null" == value) {
+        BSLS_ASSERT(result->type() == JsonType::e_NULL);
+        return 0;                                                     // RETURN
+    }
+
+    if ("true" == value || "false" == value) {
+        result->makeBoolean("true" == value);
+        return 0;                                                     // RETURN
+    }
+
+    if (NumberUtil::isValidNumber(value)) {
+        result->makeNumber(JsonNumber(value));
+        return 0;                                                     // RETURN
+    }
+
+    return -1;
+}
+
+int IndexedReader::readString(Json *result)
+{
+    const bsl::string_view contents = readStringContents();
+
+    if (!hasEscapes(contents)) {
+        result->makeString(contents);
+        return 0;                                                     // RETURN
+    }
+
+    bsl::string value(result->allocator());
+    if (0 != StringUtil::readUnquotedString(&value, contents)) {
+        return -1;                                                    // RETURN
+    }
+
+    result->makeString(bslmf::MovableRefUtil::move(value));
+    return 0;
+}
+
+bsl::string_view IndexedReader::readStringContents()
+{
+    // 'buildIndex' guarantees that the closing quote of a string is the
+    // structural position following its opening quote.
+
+    const bsl::size_t open = *d_position_p;
+    ++d_position_p;
+
+    BSLS_ASSERT(!isAtEnd());
+    BSLS_ASSERT('"' == current());
+
+    const bsl::size_t close = *d_position_p;
+    ++d_position_p;
+
+    return bsl::string_view(d_text_p + open + 1, close - open - 1);
+}
+
+// PRIVATE ACCESSORS
+inline
+char IndexedReader::current() const
+{
+    BSLS_ASSERT(!isAtEnd());
+
+    return d_text_p[*d_position_p];
+}
+
+// MANIPULATORS
+int IndexedReader::readValue(Json *result, int maxNestedDepth)
+{
+    if (isAtEnd()) {
+        return -1;                                                    // RETURN
+    }
+
+    int rc;
+    switch (current()) {
+      case '{': {
+        rc = readObject(&result->makeObject(), maxNestedDepth - 1);
+      } break;
+      case '[': {
+        rc = readArray(&result->makeArray(), maxNestedDepth - 1);
+      } break;
+      case '"': {
+        rc = readString(result);
+      } break;
+      case '}':
+      case ']':
+      case ':':
+      case ',': {
+        rc = -1;
+      } break;
+      default: {
+        rc = readScalar(result);
+      } break;
+    }
+
+    return rc;
+}
+
+int readIndexed(Json                    *result,
+                const bsl::string_view&  input,
+                int                      maxNestedDepth)
+    // Read into the specified 'result' the JSON text in the specified 'input'
+    // using the two-stage indexed reader, not exceeding the specified
+    // 'maxNestedDepth'.  Return 0 on success, and a non-zero value if 'input'
+    // is not a valid JSON document, or is one that the indexed reader does
+    // not accept, in which case 'result' is unchanged.  Note that the text
+    // must not be followed by anything other than white space.
+{
+    bsl::vector<StructuralIndexUtil::Offset> index;
+
+    if (0 != StructuralIndexUtil::buildIndex(&index, input)) {
+        return -1;                                                    // RETURN
+    }
+
+    IndexedReader reader(input, index);
+
+    Json json(result->allocator());
+    if (0 != reader.readValue(&json, maxNestedDepth) || !reader.isAtEnd()) {
+        return -1;                                                    // RETURN
+    }
+
+    result->swap(json);
     return 0;
 }
 
@@ -750,6 +1098,28 @@ int JsonUtil::read(Json               *result,
     result->swap(json);
     return 0;
 }
+
+int JsonUtil::read(Json                    *result,
+                   Error                   *errorDescription,
+                   const bsl::string_view&  input,
+                   const ReadOptions&       options)
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(errorDescription);
+
+    if (!options.allowTrailingText()
+     && 0 == u::readIndexed(result, input, options.maxNestedDepth())) {
+        return 0;                                                     // RETURN
+    }
+
+    // Either 'input' is not a valid document, or it requires handling (e.g.,
+    // of trailing text) that the indexed reader does not provide: use the
+    // 'Tokenizer'-based implementation, which also describes any error.
+
+    bdlsb::FixedMemInStreamBuf inputBuf(input.data(), input.size());
+    return read(result, errorDescription, &inputBuf, options);
+}
+
 bsl::ostream& JsonUtil::printError(bsl::ostream&   stream,
                                    bsl::streambuf *input,
                                    const Error&    error)
@@ -106,6 +106,24 @@ BSLS_IDENT("$Id: $")
 // +-----------+------------------------+-------------+-----------+
 // ```
 //
+///Reading from Contiguous Memory
+///-------------------------------
+// `read` is fastest when the JSON text is supplied as a `bsl::string_view`
+// and `allowTrailingText` is `false` (the default).  The text is then parsed
+// in two stages: the positions of its structural characters (braces,
+// brackets, colons, commas, the quotes of strings, and the first characters
+// of literals and numbers) are located using vector instructions (see
+// `bdljsn_structuralindexutil`), and the `Json` object is then built by
+// visiting those positions in order, so that most characters, in particular
+// the contents of strings, are not examined one at a time.  The overloads
+// taking a `bsl::istream` or a `bsl::streambuf` read the text incrementally
+// using a `bdljsn::Tokenizer` instead.
+//
+// If a text supplied as a `bsl::string_view` is not a valid JSON document,
+// `read` parses it again using a `bdljsn::Tokenizer` to describe the error,
+// so that the result and the error description do not depend on the overload
+// used.
+//
 ///Usage
 ///-----
 // This section illustrates the intended use of this component.
@@ -544,16 +562,6 @@ int JsonUtil::read(Json           *result,
     return read(result, errorDescription, input, options);
 }
 
-inline
-int JsonUtil::read(Json                    *result,
-                   Error                   *errorDescription,
-                   const bsl::string_view&  input,
-                   const ReadOptions&       options)
-{
-    bdlsb::FixedMemInStreamBuf inputBuf(input.data(), input.size());
-    return read(result, errorDescription, &inputBuf, options);
-}
-
 inline
 int JsonUtil::read(Json                    *result,
                    Error                   *errorDescription,
@@ -36,6 +36,7 @@
 #include <bsls_libraryfeatures.h>
 #include <bsls_platform.h>
 #include <bsls_review.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_cstddef.h>  // `bsl::size_t`
@@ -100,8 +101,10 @@ using bsl::ends;
 // [ 6] static ostream& printError(ostream&, string_view&, const Error&);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 8] USAGE EXAMPLE
+// [ 9] USAGE EXAMPLE
 // [ 7] CONCERN: JSON TEST SUITE COMPLIANCE
+// [ 8] CONCERN: `string_view` READ MATCHES `streambuf` READ
+// [-1] PERFORMANCE TEST
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -494,6 +497,57 @@ void checkResult(int                     line,
     }
 }
 
+/// Read the specified `input` with the specified `options` both from a
+/// `bsl::string_view` and from a `bsl::streambuf`, and verify that the two
+/// reads produce the same status, value, and error, using the specified
+/// `line` in diagnostics.
+void verifyReadsAgree(int                     line,
+                      const bsl::string_view& input,
+                      const ReadOptions&      options)
+{
+    Json  fromView;
+    Json  fromStream;
+    Error viewError;
+    Error streamError;
+
+    // Start from non-null values to verify that both reads leave the result
+    // unchanged on failure.
+
+    fromView.makeBoolean(true);
+    fromStream.makeBoolean(true);
+
+    const int viewRc = Util::read(&fromView, &viewError, input, options);
+
+    bdlsb::FixedMemInStreamBuf buffer(input.data(), input.size());
+
+    const int streamRc = Util::read(&fromStream,
+                                    &streamError,
+                                    &buffer,
+                                    options);
+
+    ASSERTV(line, input, viewRc, streamRc, (0 == viewRc) == (0 == streamRc));
+    ASSERTV(line, input, fromView, fromStream, fromView == fromStream);
+    ASSERTV(line, input, viewError, streamError, viewError == streamError);
+}
+
+/// Load into the specified `result` a valid JSON text of at least the
+/// specified `length` consisting of an array of objects of typical shape.
+void makeDocument(bsl::string *result, bsl::size_t length)
+{
+    result->assign("[");
+    for (int i = 0; result->length() < length; ++i) {
+        if (i) {
+            result->append(",\n");
+        }
+        result->append("  {\"id\": 12345, \"name\": \"Some Security Name\", "
+                       "\"price\": 101.25, \"active\": true, "
+                       "\"tags\": [\"alpha\", \"beta\", \"gam\\\"ma\"], "
+                       "\"description\": \"A longer description of the "
+                       "security, typical of reference data.\"}");
+    }
+    result->append("]");
+}
+
 // ============================================================================
 //                              FUZZ TESTING
 // ----------------------------------------------------------------------------
@@ -686,7 +740,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) {
-      case 8: { case 0:
+      case 9: { case 0:
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   First usage example extracted from component header file.
@@ -942,6 +996,124 @@ int main(int argc, char *argv[])
 #endif //  BSLS_COMPILERFEATURES_SUPPORT_RAW_STRINGS
         }
       } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // CONCERN: `string_view` READ MATCHES `streambuf` READ
+        //
+        // Concerns:
+        // 1. Reading from a `bsl::string_view`, which uses the indexed reader
+        //    for contiguous input, produces the same status, value, and
+        //    `Error` as reading the same text from a `bsl::streambuf`, which
+        //    uses the tokenizer, for valid and invalid texts alike.
+        //
+        // 2. The two reads agree for all values of `allowTrailingText` and
+        //    `maxNestedDepth`.
+        //
+        // 3. The two reads agree for texts longer than a block, and a chunk,
+        //    of the structural index.
+        //
+        // Plan:
+        // 1. For each text of the JSON Test Suite, and for every text obtained
+        //    from `SIMPLE_JSON` and a few short texts by deleting, replacing,
+        //    or duplicating one character, read the text both ways using a
+        //    variety of options, and verify that the results are the same.
+        //    (C-1..2)
+        //
+        // 2. Repeat P-1 for large generated documents, and for variations of
+        //    them at their ends.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: `string_view` READ MATCHES `streambuf` READ
+        // --------------------------------------------------------------------
+
+        if (verbose)
+            cout << endl
+                 << "CONCERN: `string_view` READ MATCHES `streambuf` READ"
+                 << endl
+                 << "===================================================="
+                 << endl;
+
+        ReadOptions options[5];
+        options[1].setAllowTrailingText(true);
+        options[2].setMaxNestedDepth(1);
+        options[3].setMaxNestedDepth(2);
+        options[4].setMaxNestedDepth(3).setAllowTrailingText(true);
+        const int NUM_OPTIONS = sizeof options / sizeof *options;
+
+        if (verbose) cout << "\tJSON Test Suite." << endl;
+
+        for (bsl::size_t ti = 0; ti < JTSU::numData(); ++ti) {
+            const int              LINE = JTSU::data(ti)->d_line;
+            const bsl::string_view INPUT(JTSU::data(ti)->d_JSON_p,
+                                         JTSU::data(ti)->d_length);
+
+            for (int oi = 0; oi < NUM_OPTIONS; ++oi) {
+                verifyReadsAgree(LINE, INPUT, options[oi]);
+            }
+        }
+
+        if (verbose) cout << "\tMutated texts." << endl;
+
+        static const char *const TEXTS[] = {
+            SIMPLE_JSON,
+            "[1, -2.5e3, true, false, null, \"a\\u00e9\\\"\"]",
+            "{\"a\": {\"b\": [[]], \"a\": 1}, \"\\u0061\": \"x\"}",
+            "\"\xC3\xA9\\n\"",
+        };
+        const int NUM_TEXTS = sizeof TEXTS / sizeof *TEXTS;
+
+        static const char REPLACEMENTS[] = "\"\\{}[]:, 0-.etx\x01\xC3";
+        const int NUM_REPLACEMENTS = sizeof REPLACEMENTS - 1;
+
+        for (int ti = 0; ti < NUM_TEXTS; ++ti) {
+            const bsl::string TEXT(TEXTS[ti]);
+
+            for (bsl::size_t i = 0; i <= TEXT.length(); ++i) {
+                bsl::string mutated(TEXT);
+
+                if (i < TEXT.length()) {
+                    mutated.erase(i, 1);
+                    verifyReadsAgree(L_, mutated, options[i % NUM_OPTIONS]);
+
+                    mutated = TEXT;
+                    mutated.insert(i, 1, TEXT[i]);
+                    verifyReadsAgree(L_, mutated, options[i % NUM_OPTIONS]);
+                }
+
+                for (int ri = 0; ri < NUM_REPLACEMENTS; ++ri) {
+                    mutated = TEXT;
+                    if (i < TEXT.length()) {
+                        mutated[i] = REPLACEMENTS[ri];
+                    }
+                    else {
+                        mutated.push_back(REPLACEMENTS[ri]);
+                    }
+                    verifyReadsAgree(L_, mutated, options[ri % NUM_OPTIONS]);
+                }
+            }
+        }
+
+        if (verbose) cout << "\tLarge texts." << endl;
+
+        for (bsl::size_t length = 1; length < 300 * 1000; length *= 5) {
+            bsl::string text;
+            makeDocument(&text, length);
+
+            for (int oi = 0; oi < NUM_OPTIONS; ++oi) {
+                verifyReadsAgree(L_, text, options[oi]);
+            }
+
+            text.push_back(' ');
+            verifyReadsAgree(L_, text, options[0]);
+
+            text.push_back('[');
+            verifyReadsAgree(L_, text, options[0]);
+            verifyReadsAgree(L_, text, options[1]);
+
+            text.resize(text.length() / 2);
+            verifyReadsAgree(L_, text, options[0]);
+        }
+      } break;
       case 7: {
         // --------------------------------------------------------------------
         // TESTING JSON TEST SUITE COMPLIANCE
@@ -4302,6 +4474,57 @@ int main(int argc, char *argv[])
                     location == result.location().offset());
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        // 1. Reading from a `bsl::string_view` is faster than reading the same
+        //    text from a `bsl::streambuf`.
+        //
+        // Plan:
+        // 1. Read a large generated document repeatedly both ways, and report
+        //    the throughput of each.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        bsl::string text;
+        makeDocument(&text, 16 * 1024 * 1024);
+
+        const int    NUM_ITERATIONS = 5;
+        const double MEGABYTES      = static_cast<double>(text.length()) *
+                                            NUM_ITERATIONS / (1024.0 * 1024.0);
+
+        bsls::Stopwatch sw;
+        sw.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            bdlsb::FixedMemInStreamBuf buffer(text.data(), text.length());
+
+            Json result;
+            ASSERT(0 == Util::read(&result, &buffer));
+        }
+        sw.stop();
+
+        cout << "streambuf:   " << MEGABYTES / sw.elapsedTime() << " MB/s"
+             << endl;
+
+        sw.reset();
+        sw.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            Json result;
+            ASSERT(0 == Util::read(&result, text));
+        }
+        sw.stop();
+
+        cout << "string_view: " << MEGABYTES / sw.elapsedTime() << " MB/s"
+             << endl;
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
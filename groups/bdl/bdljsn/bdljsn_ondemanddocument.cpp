@@ -0,0 +1,524 @@
+// bdljsn_ondemanddocument.cpp                                        -*-C++-*-
+#include <bdljsn_ondemanddocument.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdljsn_ondemanddocument_cpp,"$Id$ $CSID$")
+
+#include <bdljsn_numberutil.h>
+#include <bdljsn_stringutil.h>
+
+#include <bdlma_localsequentialallocator.h>
+
+#include <bsl_cstring.h>
+
+///Implementation Notes
+///--------------------
+// `OnDemandDocument::load` checks the structure of the text with a state
+// machine over the structural positions (never over the characters in
+// between), using `d_ends` as a stack of the positions of the arrays and
+// objects that are open: the entry of `d_ends` for an open array or object
+// holds the position of the enclosing open array or object, and is
+// overwritten with the position of its closing bracket once that is found.
+// The state machine relies on the following properties of the index, all
+// guaranteed by `StructuralIndexUtil::buildIndex`:
+//
+// * the opening quote of a string is immediately followed, in the index, by
+//   its closing quote, and
+// * a literal or number occupies exactly one position (its first character),
+//   so that a literal or number directly followed by a string, or another
+//   literal or number, is rejected as two adjacent values.
+//
+// Once a text is loaded, the navigation methods of `OnDemandValue` can
+// therefore assume its structure, and need only distinguish a `,` from a
+// closing bracket after each value.
+
+namespace BloombergLP {
+namespace bdljsn {
+namespace {
+namespace u {
+
+/// Return `true` if the specified `character` is JSON white space, and
+/// `false` otherwise.
+inline
+bool isWhitespace(char character)
+{
+    return ' '  == character
+        || '\n' == character
+        || '\t' == character
+        || '\r' == character;
+}
+
+/// Return `true` if the specified `encoded` contents of a JSON string (i.e.,
+/// without quotes) represent the specified `name`, and `false` otherwise.
+bool isName(const bsl::string_view& encoded, const bsl::string_view& name)
+{
+    if (0 == bsl::memchr(encoded.data(), '\\', encoded.length())) {
+        return encoded == name;                                       // RETURN
+    }
+
+    // Escape sequences never make the decoded string longer.
+
+    if (encoded.length() < name.length()) {
+        return false;                                                 // RETURN
+    }
+
+    bdlma::LocalSequentialAllocator<256> arena;
+    bsl::string                          decoded(&arena);
+
+    return 0 == StringUtil::readUnquotedString(&decoded, encoded)
+        && decoded == name;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                            // -------------------
+                            // class OnDemandValue
+                            // -------------------
+
+// PRIVATE CLASS DATA
+const OnDemandValue::Position OnDemandValue::k_NOT_A_MEMBER;
+
+// PRIVATE ACCESSORS
+bsl::string_view OnDemandValue::contentsAt(Position position) const
+{
+    const bsl::size_t begin = d_document_p->d_index[position] + 1;
+    const bsl::size_t end   = d_document_p->d_index[position + 1];
+
+    return d_document_p->d_text.substr(begin, end - begin);
+}
+
+bsl::string_view OnDemandValue::scalarText() const
+{
+    // A literal or number ends at the next white space or at the next
+    // structural position, whichever comes first.
+
+    const bsl::string_view& text  = d_document_p->d_text;
+    const bsl::size_t       begin = d_document_p->d_index[d_position];
+    const bsl::size_t       limit = d_position + 1 <
+                                                  d_document_p->d_index.size()
+                                  ? d_document_p->d_index[d_position + 1]
+                                  : text.length();
+
+    bsl::size_t end = begin + 1;
+    while (end < limit && !u::isWhitespace(text[end])) {
+        ++end;
+    }
+    return text.substr(begin, end - begin);
+}
+
+// ACCESSORS
+int OnDemandValue::elementAt(OnDemandValue *result, bsl::size_t index) const
+{
+    BSLS_ASSERT(result);
+
+    if (!isArray()) {
+        return -1;                                                    // RETURN
+    }
+
+    Position position = d_position + 1;
+    for (bsl::size_t i = 0; ']' != charAt(position); ++i) {
+        if (i == index) {
+            *result = OnDemandValue(d_document_p, position, k_NOT_A_MEMBER);
+            return 0;                                                 // RETURN
+        }
+
+        position = d_document_p->skip(position);
+        if (',' == charAt(position)) {
+            ++position;
+        }
+    }
+    return -1;
+}
+
+int OnDemandValue::find(OnDemandValue           *result,
+                        const bsl::string_view&  name) const
+{
+    BSLS_ASSERT(result);
+
+    if (!isObject()) {
+        return -1;                                                    // RETURN
+    }
+
+    // Each member occupies the positions of the two quotes of its name, of
+    // the `:`, and of its value.
+
+    Position position = d_position + 1;
+    while ('}' != charAt(position)) {
+        if (u::isName(contentsAt(position), name)) {
+            *result = OnDemandValue(d_document_p, position + 3, position);
+            return 0;                                                 // RETURN
+        }
+
+        position = d_document_p->skip(position + 3);
+        if (',' == charAt(position)) {
+            ++position;
+        }
+    }
+    return -1;
+}
+
+int OnDemandValue::first(OnDemandValue *result) const
+{
+    BSLS_ASSERT(result);
+
+    const Position position = d_position + 1;
+
+    switch (charAt(d_position)) {
+      case '[': {
+        if (']' == charAt(position)) {
+            return -1;                                                // RETURN
+        }
+        *result = OnDemandValue(d_document_p, position, k_NOT_A_MEMBER);
+      } break;
+      case '{': {
+        if ('}' == charAt(position)) {
+            return -1;                                                // RETURN
+        }
+        *result = OnDemandValue(d_document_p, position + 3, position);
+      } break;
+      default: {
+        return -1;                                                    // RETURN
+      }
+    }
+    return 0;
+}
+
+int OnDemandValue::next(OnDemandValue *result) const
+{
+    BSLS_ASSERT(result);
+
+    const Position position = d_document_p->skip(d_position);
+
+    if (position == d_document_p->d_index.size()
+     || ',' != charAt(position)) {
+        return -1;                                                    // RETURN
+    }
+
+    if (k_NOT_A_MEMBER == d_keyPosition) {
+        *result = OnDemandValue(d_document_p, position + 1, k_NOT_A_MEMBER);
+    }
+    else {
+        *result = OnDemandValue(d_document_p, position + 4, position + 1);
+    }
+    return 0;
+}
+
+int OnDemandValue::size(bsl::size_t *result) const
+{
+    BSLS_ASSERT(result);
+
+    if (!isArray() && !isObject()) {
+        return -1;                                                    // RETURN
+    }
+
+    bsl::size_t   count = 0;
+    OnDemandValue element;
+    for (int rc = first(&element); 0 == rc; rc = element.next(&element)) {
+        ++count;
+    }
+
+    *result = count;
+    return 0;
+}
+
+int OnDemandValue::key(bsl::string *result) const
+{
+    BSLS_ASSERT(result);
+
+    if (k_NOT_A_MEMBER == d_keyPosition) {
+        return -1;                                                    // RETURN
+    }
+    return StringUtil::readUnquotedString(result, contentsAt(d_keyPosition));
+}
+
+JsonType::Enum OnDemandValue::type() const
+{
+    switch (charAt(d_position)) {
+      case '{': return JsonType::e_OBJECT;                            // RETURN
+      case '[': return JsonType::e_ARRAY;                             // RETURN
+      case '"': return JsonType::e_STRING;                            // RETURN
+      case 't':
+      case 'f': return JsonType::e_BOOLEAN;                           // RETURN
+      case 'n': return JsonType::e_NULL;                              // RETURN
+    }
+    return JsonType::e_NUMBER;
+}
+
+bool OnDemandValue::isNull() const
+{
+    return 'n' == charAt(d_position) && "null" == scalarText();
+}
+
+bsl::string_view OnDemandValue::text() const
+{
+    const bsl::string_view& text  = d_document_p->d_text;
+    const bsl::size_t       begin = d_document_p->d_index[d_position];
+
+    switch (charAt(d_position)) {
+      case '{':
+      case '[': {
+        const bsl::size_t end =
+                  d_document_p->d_index[d_document_p->d_ends[d_position]] + 1;
+        return text.substr(begin, end - begin);                       // RETURN
+      }
+      case '"': {
+        const bsl::size_t end = d_document_p->d_index[d_position + 1] + 1;
+        return text.substr(begin, end - begin);                       // RETURN
+      }
+    }
+    return scalarText();
+}
+
+                                  // Decoding
+
+int OnDemandValue::asBoolean(bool *result) const
+{
+    BSLS_ASSERT(result);
+
+    const char first = charAt(d_position);
+    if ('t' != first && 'f' != first) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsl::string_view value = scalarText();
+    if ("true" == value) {
+        *result = true;
+        return 0;                                                     // RETURN
+    }
+    if ("false" == value) {
+        *result = false;
+        return 0;                                                     // RETURN
+    }
+    return -1;
+}
+
+int OnDemandValue::asString(bsl::string *result) const
+{
+    BSLS_ASSERT(result);
+
+    if ('"' != charAt(d_position)) {
+        return -1;                                                    // RETURN
+    }
+    return StringUtil::readUnquotedString(result, contentsAt(d_position));
+}
+
+int OnDemandValue::asDecimal64(bdldfp::Decimal64 *result) const
+{
+    BSLS_ASSERT(result);
+
+    const bsl::string_view value = scalarText();
+    if (!NumberUtil::isValidNumber(value)) {
+        return -1;                                                    // RETURN
+    }
+    *result = NumberUtil::asDecimal64(value);
+    return 0;
+}
+
+int OnDemandValue::asDouble(double *result) const
+{
+    BSLS_ASSERT(result);
+
+    const bsl::string_view value = scalarText();
+    if (!NumberUtil::isValidNumber(value)) {
+        return -1;                                                    // RETURN
+    }
+    *result = NumberUtil::asDouble(value);
+    return 0;
+}
+
+int OnDemandValue::asInt(int *result) const
+{
+    BSLS_ASSERT(result);
+
+    const bsl::string_view value = scalarText();
+    if (!NumberUtil::isValidNumber(value)) {
+        return -1;                                                    // RETURN
+    }
+    return NumberUtil::asInt(result, value);
+}
+
+int OnDemandValue::asInt64(bsls::Types::Int64 *result) const
+{
+    BSLS_ASSERT(result);
+
+    const bsl::string_view value = scalarText();
+    if (!NumberUtil::isValidNumber(value)) {
+        return -1;                                                    // RETURN
+    }
+    return NumberUtil::asInt64(result, value);
+}
+
+int OnDemandValue::asUint64(bsls::Types::Uint64 *result) const
+{
+    BSLS_ASSERT(result);
+
+    const bsl::string_view value = scalarText();
+    if (!NumberUtil::isValidNumber(value)) {
+        return -1;                                                    // RETURN
+    }
+    return NumberUtil::asUint64(result, value);
+}
+
+                           // ----------------------
+                           // class OnDemandDocument
+                           // ----------------------
+
+// CREATORS
+OnDemandDocument::OnDemandDocument(bslma::Allocator *basicAllocator)
+: d_text()
+, d_index(basicAllocator)
+, d_ends(basicAllocator)
+{
+}
+
+OnDemandDocument::~OnDemandDocument()
+{
+}
+
+// MANIPULATORS
+int OnDemandDocument::load(const bsl::string_view& text)
+{
+    enum State {
+        e_VALUE,            // a value is expected
+        e_VALUE_OR_CLOSE,   // a value or `]` is expected (after `[`)
+        e_NAME,             // a member name is expected (after `,`)
+        e_NAME_OR_CLOSE,    // a member name or `}` is expected (after `{`)
+        e_COLON,            // a `:` is expected (after a member name)
+        e_COMMA_OR_CLOSE,   // a `,` or a closing bracket is expected
+        e_END               // the end of the text is expected
+    };
+
+    const Offset k_NONE = ~Offset(0);  // no enclosing array or object
+
+    reset();
+
+    if (0 != StructuralIndexUtil::buildIndex(&d_index, text)) {
+        reset();
+        return -1;                                                    // RETURN
+    }
+
+    const bsl::size_t numPositions = d_index.size();
+
+    d_ends.resize(numPositions);
+
+    State  state = e_VALUE;
+    Offset open  = k_NONE;   // innermost open array or object
+
+    for (bsl::size_t position = 0; position < numPositions; ++position) {
+        const char character = text[d_index[position]];
+        bool       isClose   = false;
+
+        switch (state) {
+          case e_VALUE:
+          case e_VALUE_OR_CLOSE: {
+            switch (character) {
+              case '{':
+              case '[': {
+                d_ends[position] = open;
+                open             = static_cast<Offset>(position);
+                state            = '{' == character ? e_NAME_OR_CLOSE
+                                                    : e_VALUE_OR_CLOSE;
+              } break;
+              case '"': {
+                ++position;  // closing quote
+                state = k_NONE == open ? e_END : e_COMMA_OR_CLOSE;
+              } break;
+              case ']': {
+                if (e_VALUE_OR_CLOSE != state) {
+                    reset();
+                    return -1;                                        // RETURN
+                }
+                isClose = true;
+              } break;
+              case '}':
+              case ':':
+              case ',': {
+                reset();
+                return -1;                                            // RETURN
+              }
+              default: {
+                state = k_NONE == open ? e_END : e_COMMA_OR_CLOSE;
+              } break;
+            }
+          } break;
+          case e_NAME:
+          case e_NAME_OR_CLOSE: {
+            if ('"' == character) {
+                ++position;  // closing quote
+                state = e_COLON;
+            }
+            else if ('}' == character && e_NAME_OR_CLOSE == state) {
+                isClose = true;
+            }
+            else {
+                reset();
+                return -1;                                            // RETURN
+            }
+          } break;
+          case e_COLON: {
+            if (':' != character) {
+                reset();
+                return -1;                                            // RETURN
+            }
+            state = e_VALUE;
+          } break;
+          case e_COMMA_OR_CLOSE: {
+            if (',' == character) {
+                state = '{' == text[d_index[open]] ? e_NAME : e_VALUE;
+            }
+            else if ('}' == character || ']' == character) {
+                isClose = true;
+            }
+            else {
+                reset();
+                return -1;                                            // RETURN
+            }
+          } break;
+          case e_END: {
+            reset();
+            return -1;                                                // RETURN
+          }
+        }
+
+        if (isClose) {
+            const char opening = text[d_index[open]];
+            if (('{' == opening) != ('}' == character)) {
+                reset();
+                return -1;                                            // RETURN
+            }
+
+            const Offset enclosing = d_ends[open];
+            d_ends[open] = static_cast<Offset>(position);
+            open         = enclosing;
+            state        = k_NONE == open ? e_END : e_COMMA_OR_CLOSE;
+        }
+    }
+
+    if (e_END != state) {
+        reset();
+        return -1;                                                    // RETURN
+    }
+
+    d_text = text;
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
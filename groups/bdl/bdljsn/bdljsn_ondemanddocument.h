@@ -0,0 +1,536 @@
+// bdljsn_ondemanddocument.h                                          -*-C++-*-
+#ifndef INCLUDED_BDLJSN_ONDEMANDDOCUMENT
+#define INCLUDED_BDLJSN_ONDEMANDDOCUMENT
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide lazy, non-allocating navigation of a JSON text.
+//
+//@CLASSES:
+//  bdljsn::OnDemandDocument: index of a JSON text supporting lazy navigation
+//  bdljsn::OnDemandValue: handle to a value in an `OnDemandDocument`
+//
+//@SEE_ALSO: bdljsn_structuralindexutil, bdljsn_jsonutil, bdljsn_json
+//
+//@DESCRIPTION: This component provides a mechanism,
+// `bdljsn::OnDemandDocument`, that refers to a JSON text held in contiguous
+// memory, and a handle, `bdljsn::OnDemandValue`, that refers to one value of
+// such a document.  Together, they allow a few values to be extracted from a
+// large JSON text without building a `bdljsn::Json` object, and so without
+// allocating memory for, or even decoding, the values that are not needed.
+//
+// `OnDemandDocument::load` builds the index of the structural positions of the
+// text (see `bdljsn_structuralindexutil`), and then verifies, in a single pass
+// over the index, that the structure of the text is valid: that the brackets
+// and braces are balanced, that the members of objects are name-value pairs,
+// that elements and members are separated by commas, and that the text holds
+// exactly one value.  While doing so, `load` records, for each array and
+// object, the position at which it ends, so that navigating past an unneeded
+// array or object takes constant time.
+//
+// The value at the root of the document is obtained from the `root` method.
+// `OnDemandValue` provides methods to navigate to the member of an object
+// having a given name (`find`), to the element of an array at a given index
+// (`elementAt`), and to iterate over the elements or members of an array or
+// object (`first` and `next`).  These methods do not allocate memory, except
+// to decode a member name containing escape sequences while searching for a
+// name.
+//
+// Strings, numbers, and literals (`true`, `false`, and `null`) are decoded,
+// and validated, only when accessed, by one of the `as*` methods or `isNull`.
+// Therefore, a text that is loaded successfully may contain invalid literals,
+// numbers, or escape sequences in strings, but such errors are reported when,
+// and only when, the offending value is accessed.  Note that every string of a
+// loaded text is known to be valid UTF-8 free of unescaped control
+// characters, as `load` verifies both.  Note also that, unlike
+// `bdljsn::JsonUtil::read`, `load` imposes no limit on the nesting depth of
+// the text, since neither `load` nor any navigation method is recursive.
+//
+// An `OnDemandValue` (and the `bsl::string_view` objects returned by its
+// methods) refer to the memory of the `OnDemandDocument` and of its text, and
+// are invalidated by the next call to `load` or `reset` on the document, or by
+// the destruction of either.
+//
+///Duplicate Member Names
+///----------------------
+// If an object has several members having the same name, `find` returns the
+// first such member, as does the `bdljsn::Json` object produced by
+// `bdljsn::JsonUtil::read`.  Iterating over the members of the object with
+// `first` and `next` visits each member.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Extracting a Few Fields of a Message
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we receive messages describing trades, from each of which we need
+// only the symbol and the price of the first fill, and a large part of each of
+// which is an audit trail that we do not need.
+//
+// First, we load the text of a message into an `OnDemandDocument`, which we
+// would normally reuse for each message so that the memory of its index is
+// reused:
+// ```
+// const char *MESSAGE =
+//     "{\n"
+//     "  \"audit\": [{\"user\": \"a\", \"t\": 1},\n"
+//     "            {\"user\": \"b\", \"t\": 2}],\n"
+//     "  \"symbol\": \"IBM\",\n"
+//     "  \"fills\": [{\"price\": 143.5, \"size\": 100},\n"
+//     "            {\"price\": 143.75, \"size\": 200}]\n"
+//     "}";
+//
+// bdljsn::OnDemandDocument document;
+//
+// int rc = document.load(MESSAGE);
+// assert(0 == rc);
+// ```
+// Then, we navigate to the values we need.  The `audit` member is skipped
+// without examining its contents:
+// ```
+// bdljsn::OnDemandValue symbol;
+// bdljsn::OnDemandValue price;
+//
+// rc = document.root().find(&symbol, "symbol");
+// assert(0 == rc);
+//
+// bdljsn::OnDemandValue fills;
+// bdljsn::OnDemandValue firstFill;
+//
+// rc = document.root().find(&fills, "fills");
+// assert(0 == rc);
+// rc = fills.elementAt(&firstFill, 0);
+// assert(0 == rc);
+// rc = firstFill.find(&price, "price");
+// assert(0 == rc);
+// ```
+// Next, we decode only those two values:
+// ```
+// bsl::string symbolValue;
+// double      priceValue;
+//
+// rc = symbol.asString(&symbolValue);
+// assert(0 == rc);
+// assert("IBM" == symbolValue);
+//
+// rc = price.asDouble(&priceValue);
+// assert(0 == rc);
+// assert(143.5 == priceValue);
+// ```
+// Finally, we compute the total size of the fills by iterating over the
+// elements of the array:
+// ```
+// int                   totalSize = 0;
+// bdljsn::OnDemandValue fill;
+//
+// for (rc = fills.first(&fill); 0 == rc; rc = fill.next(&fill)) {
+//     bdljsn::OnDemandValue size;
+//     int                   sizeValue;
+//
+//     rc = fill.find(&size, "size");
+//     assert(0 == rc);
+//     rc = size.asInt(&sizeValue);
+//     assert(0 == rc);
+//
+//     totalSize += sizeValue;
+// }
+// assert(300 == totalSize);
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdljsn_jsontype.h>
+#include <bdljsn_structuralindexutil.h>
+
+#include <bdldfp_decimal.h>
+
+#include <bslma_allocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdljsn {
+
+class OnDemandDocument;
+
+                            // ===================
+                            // class OnDemandValue
+                            // ===================
+
+/// This in-core value-semantic class refers to one value of an
+/// `OnDemandDocument`, and provides methods to navigate to the values it
+/// contains, and to decode it.  The behavior of every method other than
+/// assignment is undefined for a default-constructed `OnDemandValue`, or
+/// for one whose document has since been loaded again, reset, or destroyed.
+class OnDemandValue {
+
+    // PRIVATE TYPES
+    typedef bsl::size_t Position;
+
+    // DATA
+    const OnDemandDocument *d_document_p;   // document (held, not owned)
+
+    Position                d_position;     // index of the first structural
+                                            // position of the value
+
+    Position                d_keyPosition;  // index of the opening quote of
+                                            // the member name, or
+                                            // `k_NOT_A_MEMBER`
+
+    // PRIVATE CLASS DATA
+    static const Position k_NOT_A_MEMBER = ~Position(0);
+
+    // FRIENDS
+    friend class OnDemandDocument;
+
+    // PRIVATE CREATORS
+
+    /// Create a handle to the value of the specified `document` beginning at
+    /// the specified `position` of its index, that is a member of an object
+    /// whose name begins at the specified `keyPosition` of its index, or is
+    /// not a member if `keyPosition` is `k_NOT_A_MEMBER`.
+    OnDemandValue(const OnDemandDocument *document,
+                  Position                position,
+                  Position                keyPosition);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the character at the specified `position` of the index of the
+    /// document.
+    char charAt(Position position) const;
+
+    /// Return the contents, between the quotes, of the string whose opening
+    /// quote is at the specified `position` of the index of the document.
+    bsl::string_view contentsAt(Position position) const;
+
+    /// Return the text of the literal or number beginning at the position
+    /// of this value.
+    bsl::string_view scalarText() const;
+
+  public:
+    // CREATORS
+
+    /// Create a handle that does not refer to any value.
+    OnDemandValue();
+
+    // ACCESSORS
+
+    /// Load into the specified `result` the element at the specified `index`
+    /// of the array referred to by this object.  Return 0 on success, and a
+    /// non-zero value, with no effect on `result`, if this value is not an
+    /// array, or if `size() <= index`.  This method takes time linear in
+    /// `index`, but constant in the size of the preceding elements.
+    int elementAt(OnDemandValue *result, bsl::size_t index) const;
+
+    /// Load into the specified `result` the value of the first member of the
+    /// object, having the specified `name` (after decoding any escape
+    /// sequences), that is referred to by this object.  Return 0 on
+    /// success, and a non-zero value, with no effect on `result`, if this
+    /// value is not an object, or if it has no member named `name`.  This
+    /// method takes time linear in the number of members preceding the one
+    /// found, but constant in the size of their values.
+    int find(OnDemandValue *result, const bsl::string_view& name) const;
+
+    /// Load into the specified `result` the first element of the array, or
+    /// the value of the first member of the object, referred to by this
+    /// object.  Return 0 on success, and a non-zero value, with no effect on
+    /// `result`, if this value is neither an array nor an object, or is
+    /// empty.
+    int first(OnDemandValue *result) const;
+
+    /// Load into the specified `result` the element or member following the
+    /// one referred to by this object in its enclosing array or object.
+    /// Return 0 on success, and a non-zero value, with no effect on
+    /// `result`, if this value is the last of its enclosing array or object,
+    /// or is the root value of the document.  Note that `result` may be the
+    /// address of this object.
+    int next(OnDemandValue *result) const;
+
+    /// Load into the specified `result` the number of elements of the array,
+    /// or of members of the object, referred to by this object.  Return 0 on
+    /// success, and a non-zero value, with no effect on `result`, if this
+    /// value is neither an array nor an object.  This method takes time
+    /// linear in the number of elements or members.
+    int size(bsl::size_t *result) const;
+
+    /// Load into the specified `result` the name of the member of an object
+    /// whose value is referred to by this object, after decoding any escape
+    /// sequences.  Return 0 on success, and a non-zero value if this value
+    /// is not the value of a member, or if its name contains an invalid
+    /// escape sequence.
+    int key(bsl::string *result) const;
+
+    /// Return the type of this value, determined from its first character.
+    /// Note that the value is not validated: for example, the type of the
+    /// value `tru` is `JsonType::e_BOOLEAN`, and that of `-x` is
+    /// `JsonType::e_NUMBER`, and accessing either value fails.
+    JsonType::Enum type() const;
+
+    /// Return `true` if this value is an array, and `false` otherwise.
+    bool isArray() const;
+
+    /// Return `true` if this value is `null`, and `false` otherwise.
+    bool isNull() const;
+
+    /// Return `true` if this value is an object, and `false` otherwise.
+    bool isObject() const;
+
+    /// Return the JSON text of this value, as it appears in the text of the
+    /// document (e.g., including the quotes of a string, and the contents of
+    /// an array or object).
+    bsl::string_view text() const;
+
+                                  // Decoding
+
+    /// Load into the specified `result` the value of the `true` or `false`
+    /// literal referred to by this object.  Return 0 on success, and a
+    /// non-zero value, with no effect on `result`, otherwise.
+    int asBoolean(bool *result) const;
+
+    /// Load into the specified `result` the value of the string referred to
+    /// by this object, after decoding any escape sequences.  Return 0 on
+    /// success, and a non-zero value otherwise, with an unspecified value in
+    /// `result` if this value is a string containing an invalid escape
+    /// sequence, and with no effect on `result` otherwise.
+    int asString(bsl::string *result) const;
+
+    /// Load into the specified `result` the closest representation of the
+    /// number referred to by this object.  Return 0 on success, and a
+    /// non-zero value, with no effect on `result`, if this value is not a
+    /// valid JSON number.
+    int asDecimal64(bdldfp::Decimal64 *result) const;
+    int asDouble(double *result) const;
+
+    /// Load into the specified `result` the value of the number referred to
+    /// by this object.  Return 0 on success, and a non-zero value otherwise.
+    /// If this value is a valid JSON number, the result and the status are
+    /// as described for the corresponding function of
+    /// `bdljsn::NumberUtil` (e.g., `result` is loaded with the closest
+    /// representable integer on overflow, and `NumberUtil::k_OVERFLOW` is
+    /// returned); otherwise, `result` is unchanged.
+    int asInt(int *result) const;
+    int asInt64(bsls::Types::Int64 *result) const;
+    int asUint64(bsls::Types::Uint64 *result) const;
+};
+
+                           // ======================
+                           // class OnDemandDocument
+                           // ======================
+
+/// This mechanism class holds the index of a JSON text, supporting lazy
+/// navigation of the text through `OnDemandValue` handles.
+class OnDemandDocument {
+
+    // PRIVATE TYPES
+    typedef StructuralIndexUtil::Offset Offset;
+
+    // DATA
+    bsl::string_view    d_text;   // text of the document (held, not owned)
+
+    bsl::vector<Offset> d_index;  // structural positions of `d_text`
+
+    bsl::vector<Offset> d_ends;   // for each array or object, the index of
+                                  // its closing position in `d_index`; for
+                                  // other positions, unspecified (also used
+                                  // as a stack while loading)
+
+    // FRIENDS
+    friend class OnDemandValue;
+
+    // NOT IMPLEMENTED
+    OnDemandDocument(const OnDemandDocument&);
+    OnDemandDocument& operator=(const OnDemandDocument&);
+
+    // PRIVATE ACCESSORS
+
+    /// Return the index of the first structural position following the
+    /// value beginning at the specified `position` of `d_index`.
+    bsl::size_t skip(bsl::size_t position) const;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(OnDemandDocument,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+
+    /// Create a document that holds no text.  Optionally specify a
+    /// `basicAllocator` used to supply memory.  If `basicAllocator` is 0,
+    /// the currently installed default allocator is used.
+    explicit OnDemandDocument(bslma::Allocator *basicAllocator = 0);
+
+    /// Destroy this object.
+    ~OnDemandDocument();
+
+    // MANIPULATORS
+
+    /// Index the JSON text in the specified `text`, and verify its
+    /// structure (see {Description}).  Return 0 on success, and a non-zero
+    /// value, leaving this document holding no text, if `text` does not
+    /// have the structure of a JSON document, contains an unterminated
+    /// string or a string containing an unescaped control character, or is
+    /// not valid UTF-8.  The memory of the previous index of this document
+    /// is reused.  The behavior is undefined unless `text` remains valid,
+    /// and unmodified, until this document is loaded again, reset, or
+    /// destroyed.
+    int load(const bsl::string_view& text);
+
+    /// Discard the text held by this document, if any.  The memory of the
+    /// index is retained for use by the next call to `load`.
+    void reset();
+
+    // ACCESSORS
+
+    /// Return `true` if this document holds a text, and `false` otherwise.
+    bool isLoaded() const;
+
+    /// Return a handle to the root value of this document.  The behavior is
+    /// undefined unless `isLoaded()`.
+    OnDemandValue root() const;
+
+    /// Return the text held by this document, or an empty string if
+    /// `!isLoaded()`.
+    const bsl::string_view& text() const;
+
+                                  // Aspects
+
+    /// Return the allocator used by this object to supply memory.
+    bslma::Allocator *allocator() const;
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // class OnDemandValue
+                            // -------------------
+
+// PRIVATE CREATORS
+inline
+OnDemandValue::OnDemandValue(const OnDemandDocument *document,
+                             Position                position,
+                             Position                keyPosition)
+: d_document_p(document)
+, d_position(position)
+, d_keyPosition(keyPosition)
+{
+}
+
+// PRIVATE ACCESSORS
+inline
+char OnDemandValue::charAt(Position position) const
+{
+    return d_document_p->d_text[d_document_p->d_index[position]];
+}
+
+// CREATORS
+inline
+OnDemandValue::OnDemandValue()
+: d_document_p(0)
+, d_position(0)
+, d_keyPosition(k_NOT_A_MEMBER)
+{
+}
+
+// ACCESSORS
+inline
+bool OnDemandValue::isArray() const
+{
+    return '[' == charAt(d_position);
+}
+
+inline
+bool OnDemandValue::isObject() const
+{
+    return '{' == charAt(d_position);
+}
+
+                           // ----------------------
+                           // class OnDemandDocument
+                           // ----------------------
+
+// PRIVATE ACCESSORS
+inline
+bsl::size_t OnDemandDocument::skip(bsl::size_t position) const
+{
+    switch (d_text[d_index[position]]) {
+      case '{':
+      case '[': {
+        return d_ends[position] + 1;                                  // RETURN
+      }
+      case '"': {
+        return position + 2;                                          // RETURN
+      }
+    }
+    return position + 1;
+}
+
+// MANIPULATORS
+inline
+void OnDemandDocument::reset()
+{
+    d_text = bsl::string_view();
+    d_index.clear();
+}
+
+// ACCESSORS
+inline
+bool OnDemandDocument::isLoaded() const
+{
+    return !d_index.empty();
+}
+
+inline
+OnDemandValue OnDemandDocument::root() const
+{
+    BSLS_ASSERT(isLoaded());
+
+    return OnDemandValue(this, 0, OnDemandValue::k_NOT_A_MEMBER);
+}
+
+inline
+const bsl::string_view& OnDemandDocument::text() const
+{
+    return d_text;
+}
+
+                                  // Aspects
+
+inline
+bslma::Allocator *OnDemandDocument::allocator() const
+{
+    return d_index.get_allocator().mechanism();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
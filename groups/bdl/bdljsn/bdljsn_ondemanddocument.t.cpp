@@ -0,0 +1,1181 @@
+// bdljsn_ondemanddocument.t.cpp                                      -*-C++-*-
+#include <bdljsn_ondemanddocument.h>
+
+#include <bdljsn_json.h>
+#include <bdljsn_jsontestsuiteutil.h>
+#include <bdljsn_jsonutil.h>
+#include <bdljsn_numberutil.h>
+
+#include <bdldfp_decimal.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_assert.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The component under test provides lazy navigation of a JSON text.  We verify
+// `load` by comparing its result with that of `bdljsn::JsonUtil::read` for
+// texts whose literals, numbers, and strings are valid (which `load` does not
+// verify), and verify navigation and decoding by comparing the values reached
+// through an `OnDemandValue` with the corresponding values of the
+// `bdljsn::Json` object produced by `JsonUtil::read` for the same text.
+// ----------------------------------------------------------------------------
+// OnDemandDocument
+// [ 2] explicit OnDemandDocument(bslma::Allocator *basicAllocator = 0);
+// [ 2] ~OnDemandDocument();
+// [ 2] int load(const bsl::string_view& text);
+// [ 2] void reset();
+// [ 2] bool isLoaded() const;
+// [ 2] OnDemandValue root() const;
+// [ 2] const bsl::string_view& text() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// OnDemandValue
+// [ 3] OnDemandValue();
+// [ 3] int elementAt(OnDemandValue *result, bsl::size_t index) const;
+// [ 3] int find(OnDemandValue *result, const bsl::string_view& name) const;
+// [ 3] int first(OnDemandValue *result) const;
+// [ 3] int next(OnDemandValue *result) const;
+// [ 3] int size(bsl::size_t *result) const;
+// [ 3] int key(bsl::string *result) const;
+// [ 3] JsonType::Enum type() const;
+// [ 3] bool isArray() const;
+// [ 4] bool isNull() const;
+// [ 3] bool isObject() const;
+// [ 3] bsl::string_view text() const;
+// [ 4] int asBoolean(bool *result) const;
+// [ 4] int asString(bsl::string *result) const;
+// [ 4] int asDecimal64(bdldfp::Decimal64 *result) const;
+// [ 4] int asDouble(double *result) const;
+// [ 4] int asInt(int *result) const;
+// [ 4] int asInt64(bsls::Types::Int64 *result) const;
+// [ 4] int asUint64(bsls::Types::Uint64 *result) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdljsn::OnDemandDocument  Obj;
+typedef bdljsn::OnDemandValue     Value;
+typedef bdljsn::Json              Json;
+typedef bdljsn::JsonType          JsonType;
+typedef bdljsn::JsonUtil          Util;
+typedef bdljsn::JsonTestSuiteUtil JTSU;
+
+static int verbose = 0;
+static int veryVerbose = 0;
+static int veryVeryVerbose = 0;
+static int veryVeryVeryVerbose = 0;
+
+// ============================================================================
+//                          HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// Verify that the specified `value` represents the same JSON value as the
+/// specified `json`, navigating the whole of `value`, and using the specified
+/// `line` in diagnostics.
+void verifySame(int line, const Value& value, const Json& json)
+{
+    ASSERTV(line, value.text(), value.type(), json.type(),
+            json.type() == value.type());
+    if (json.type() != value.type()) {
+        return;                                                       // RETURN
+    }
+
+    switch (json.type()) {
+      case JsonType::e_OBJECT: {
+        ASSERTV(line, value.isObject());
+
+        bsl::size_t numMembers = 0;
+        Value       member;
+        int         rc;
+        for (rc = value.first(&member); 0 == rc; rc = member.next(&member)) {
+            bsl::string name;
+            ASSERTV(line, 0 == member.key(&name));
+
+            // With duplicate names, `Json` and `find` both keep the first
+            // member.
+
+            Value found;
+            ASSERTV(line, name, 0 == value.find(&found, name));
+            ASSERTV(line, name, json.theObject().contains(name));
+            if (json.theObject().contains(name)) {
+                verifySame(line, found, json.theObject()[name]);
+            }
+            ++numMembers;
+        }
+
+        bsl::size_t size = 0;
+        ASSERTV(line, 0 == value.size(&size));
+        ASSERTV(line, numMembers, size, numMembers == size);
+        ASSERTV(line, numMembers, json.size(), json.size() <= numMembers);
+
+        Value notFound;
+        ASSERTV(line, 0 != value.find(&notFound, "no such member name"));
+        ASSERTV(line, 0 != value.elementAt(&notFound, 0));
+      } break;
+      case JsonType::e_ARRAY: {
+        ASSERTV(line, value.isArray());
+
+        bsl::size_t size = 0;
+        ASSERTV(line, 0 == value.size(&size));
+        ASSERTV(line, size, json.size(), json.size() == size);
+
+        Value       element;
+        bsl::size_t i = 0;
+        int         rc;
+        for (rc = value.first(&element);
+             0 == rc;
+             rc = element.next(&element), ++i) {
+            Value byIndex;
+            ASSERTV(line, i, 0 == value.elementAt(&byIndex, i));
+            ASSERTV(line, i, byIndex.text() == element.text());
+
+            bsl::string name;
+            ASSERTV(line, 0 != element.key(&name));
+
+            if (i < json.size()) {
+                verifySame(line, element, json[i]);
+            }
+        }
+        ASSERTV(line, i, json.size() == i);
+
+        Value notFound;
+        ASSERTV(line, 0 != value.elementAt(&notFound, size));
+        ASSERTV(line, 0 != value.find(&notFound, ""));
+      } break;
+      case JsonType::e_STRING: {
+        bsl::string result;
+        ASSERTV(line, 0 == value.asString(&result));
+        ASSERTV(line, result, json.theString(), json.theString() == result);
+      } break;
+      case JsonType::e_NUMBER: {
+        ASSERTV(line, value.text(), json.theNumber().value(),
+                json.theNumber().value() == value.text());
+
+        double result;
+        ASSERTV(line, 0 == value.asDouble(&result));
+        ASSERTV(line, result, json.theNumber().asDouble() == result);
+      } break;
+      case JsonType::e_BOOLEAN: {
+        bool result;
+        ASSERTV(line, 0 == value.asBoolean(&result));
+        ASSERTV(line, result, json.theBoolean() == result);
+      } break;
+      case JsonType::e_NULL: {
+        ASSERTV(line, value.isNull());
+      } break;
+    }
+
+    if (JsonType::e_NULL != json.type()) {
+        ASSERTV(line, !value.isNull());
+    }
+
+    // The text of a value is itself a JSON text having the same value.
+
+    Json fromText;
+    ASSERTV(line, value.text(), 0 == Util::read(&fromText, value.text()));
+    ASSERTV(line, value.text(), fromText == json);
+}
+
+/// Load into the specified `result` a valid JSON text of at least the
+/// specified `length` consisting of an array of objects of typical shape.
+void makeDocument(bsl::string *result, bsl::size_t length)
+{
+    result->assign("[");
+    for (int i = 0; result->length() < length; ++i) {
+        if (i) {
+            result->append(",\n");
+        }
+        result->append("  {\"id\": 12345, \"name\": \"Some Security Name\", "
+                       "\"price\": 101.25, \"active\": true, "
+                       "\"tags\": [\"alpha\", \"beta\", \"gam\\\"ma\"], "
+                       "\"description\": \"A longer description of the "
+                       "security, typical of reference data.\"}");
+    }
+    result->append("]");
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Example 1: Extracting a Few Fields of a Message
+///- - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we receive messages describing trades, from each of which we need
+// only the symbol and the price of the first fill, and a large part of each of
+// which is an audit trail that we do not need.
+//
+// First, we load the text of a message into an `OnDemandDocument`, which we
+// would normally reuse for each message so that the memory of its index is
+// reused:
+// ```
+    const char *MESSAGE =
+        "{\n"
+        "  \"audit\": [{\"user\": \"a\", \"t\": 1},\n"
+        "            {\"user\": \"b\", \"t\": 2}],\n"
+        "  \"symbol\": \"IBM\",\n"
+        "  \"fills\": [{\"price\": 143.5, \"size\": 100},\n"
+        "            {\"price\": 143.75, \"size\": 200}]\n"
+        "}";
+
+    bdljsn::OnDemandDocument document;
+
+    int rc = document.load(MESSAGE);
+    ASSERT(0 == rc);
+// ```
+// Then, we navigate to the values we need.  The `audit` member is skipped
+// without examining its contents:
+// ```
+    bdljsn::OnDemandValue symbol;
+    bdljsn::OnDemandValue price;
+
+    rc = document.root().find(&symbol, "symbol");
+    ASSERT(0 == rc);
+
+    bdljsn::OnDemandValue fills;
+    bdljsn::OnDemandValue firstFill;
+
+    rc = document.root().find(&fills, "fills");
+    ASSERT(0 == rc);
+    rc = fills.elementAt(&firstFill, 0);
+    ASSERT(0 == rc);
+    rc = firstFill.find(&price, "price");
+    ASSERT(0 == rc);
+// ```
+// Next, we decode only those two values:
+// ```
+    bsl::string symbolValue;
+    double      priceValue;
+
+    rc = symbol.asString(&symbolValue);
+    ASSERT(0 == rc);
+    ASSERT("IBM" == symbolValue);
+
+    rc = price.asDouble(&priceValue);
+    ASSERT(0 == rc);
+    ASSERT(143.5 == priceValue);
+// ```
+// Finally, we compute the total size of the fills by iterating over the
+// elements of the array:
+// ```
+    int                   totalSize = 0;
+    bdljsn::OnDemandValue fill;
+
+    for (rc = fills.first(&fill); 0 == rc; rc = fill.next(&fill)) {
+        bdljsn::OnDemandValue size;
+        int                   sizeValue;
+
+        rc = fill.find(&size, "size");
+        ASSERT(0 == rc);
+        rc = size.asInt(&sizeValue);
+        ASSERT(0 == rc);
+
+        totalSize += sizeValue;
+    }
+    ASSERT(300 == totalSize);
+// ```
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING DECODING
+        //
+        // Concerns:
+        // 1. Each `as*` method, and `isNull`, decodes a valid value of the
+        //    corresponding type.
+        //
+        // 2. Each fails, with no effect on its result, for a value of another
+        //    type, and for an invalid literal or number, which `load` does
+        //    not detect.
+        //
+        // 3. The integer conversions report overflow and fractional values as
+        //    `NumberUtil` does.
+        //
+        // 4. `asString` decodes escape sequences, and fails for invalid
+        //    ones.
+        //
+        // Plan:
+        // 1. Using the table-driven technique, load an array holding a
+        //    single value, and verify the result of each decoding method.
+        //    (C-1..4)
+        //
+        // Testing:
+        //   bool isNull() const;
+        //   int asBoolean(bool *result) const;
+        //   int asString(bsl::string *result) const;
+        //   int asDecimal64(bdldfp::Decimal64 *result) const;
+        //   int asDouble(double *result) const;
+        //   int asInt(int *result) const;
+        //   int asInt64(bsls::Types::Int64 *result) const;
+        //   int asUint64(bsls::Types::Uint64 *result) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING DECODING" << endl
+                          << "================" << endl;
+
+        typedef bdljsn::NumberUtil NU;
+
+        static const struct {
+            int         d_line;         // source line number
+            const char *d_value_p;      // JSON text of the value
+            int         d_boolRc;       // status of `asBoolean` (0 or 1)
+            int         d_stringRc;     // status of `asString` (0 or 1)
+            int         d_numberRc;     // status of `asDouble` (0 or 1)
+            int         d_intRc;        // status of `asInt`
+            int         d_int;          // result of `asInt`
+            bool        d_isNull;       // result of `isNull`
+        } DATA[] = {
+          //LINE  VALUE                     BOOL STR NUM  INT_RC           INT
+          //----  ------------------------  ---- --- ---  --------------   ---
+          { L_,   "true",                   0,   1,  1,   1,               0,
+                                                                     false },
+          { L_,   "false",                  0,   1,  1,   1,               0,
+                                                                     false },
+          { L_,   "null",                   1,   1,  1,   1,               0,
+                                                                     true  },
+          { L_,   "tru",                    1,   1,  1,   1,               0,
+                                                                     false },
+          { L_,   "truex",                  1,   1,  1,   1,               0,
+                                                                     false },
+          { L_,   "nul",                    1,   1,  1,   1,               0,
+                                                                     false },
+          { L_,   "0",                      1,   1,  0,   0,               0,
+                                                                     false },
+          { L_,   "-17",                    1,   1,  0,   0,             -17,
+                                                                     false },
+          { L_,   "1.5",                    1,   1,  0,   NU::k_NOT_INTEGRAL,
+                                                                       1,
+                                                                     false },
+          { L_,   "1e2",                    1,   1,  0,   0,             100,
+                                                                     false },
+          { L_,   "99999999999",            1,   1,  0,   NU::k_OVERFLOW,
+                                                                 2147483647,
+                                                                     false },
+          { L_,   "-99999999999",           1,   1,  0,   NU::k_UNDERFLOW,
+                                                            -2147483647 - 1,
+                                                                     false },
+          { L_,   "01",                     1,   1,  1,   1,               0,
+                                                                     false },
+          { L_,   "1.",                     1,   1,  1,   1,               0,
+                                                                     false },
+          { L_,   "-",                      1,   1,  1,   1,               0,
+                                                                     false },
+          { L_,   "x",                      1,   1,  1,   1,               0,
+                                                                     false },
+          { L_,   "\"\"",                   1,   0,  1,   1,               0,
+                                                                     false },
+          { L_,   "\"1\"",                  1,   0,  1,   1,               0,
+                                                                     false },
+          { L_,   "\"a\\n\\u00e9\\\"\"",    1,   0,  1,   1,               0,
+                                                                     false },
+          { L_,   "\"\\x\"",                1,   1,  1,   1,               0,
+                                                                     false },
+          { L_,   "\"\\ud800\"",            1,   1,  1,   1,               0,
+                                                                     false },
+          { L_,   "[]",                     1,   1,  1,   1,               0,
+                                                                     false },
+          { L_,   "{}",                     1,   1,  1,   1,               0,
+                                                                     false },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE      = DATA[ti].d_line;
+            const char *const VALUE     = DATA[ti].d_value_p;
+            const int         BOOL_RC   = DATA[ti].d_boolRc;
+            const int         STRING_RC = DATA[ti].d_stringRc;
+            const int         NUMBER_RC = DATA[ti].d_numberRc;
+            const int         INT_RC    = DATA[ti].d_intRc;
+            const int         INT       = DATA[ti].d_int;
+            const bool        IS_NULL   = DATA[ti].d_isNull;
+
+            if (veryVerbose) { T_ P_(LINE) P(VALUE) }
+
+            const bsl::string TEXT = bsl::string("[") + VALUE + "]";
+
+            ASSERTV(LINE, 0 == mX.load(TEXT));
+
+            Value value;
+            ASSERTV(LINE, 0 == mX.root().elementAt(&value, 0));
+            ASSERTV(LINE, VALUE == value.text());
+
+            // Compare with `JsonUtil::read` where it accepts the text.
+
+            Json json;
+            const bool IS_VALID = 0 == Util::read(&json, TEXT);
+
+            bool flag = false;
+            ASSERTV(LINE, BOOL_RC, (0 == BOOL_RC) == (0 == value.asBoolean(
+                                                                     &flag)));
+            if (0 == BOOL_RC) {
+                ASSERTV(LINE, flag, IS_VALID && json[0].theBoolean() == flag);
+            }
+            else {
+                ASSERTV(LINE, !flag);
+            }
+
+            bsl::string string("unchanged");
+            const int   sRc = value.asString(&string);
+            ASSERTV(LINE, STRING_RC, sRc, (0 == STRING_RC) == (0 == sRc));
+            if (0 == STRING_RC) {
+                ASSERTV(LINE, string, IS_VALID
+                                   && json[0].theString() == string);
+            }
+            else if ('"' != VALUE[0]) {
+                ASSERTV(LINE, string, "unchanged" == string);
+            }
+
+            double             d  = -1;
+            bdldfp::Decimal64  d64(-1);
+            bsls::Types::Int64 i64 = -1;
+            const int          dRc = value.asDouble(&d);
+            ASSERTV(LINE, NUMBER_RC, dRc, (0 == NUMBER_RC) == (0 == dRc));
+            ASSERTV(LINE, (0 == NUMBER_RC) == (0 == value.asDecimal64(&d64)));
+            if (0 == NUMBER_RC) {
+                ASSERTV(LINE, d, IS_VALID && json[0].theNumber().asDouble()
+                                                                        == d);
+                ASSERTV(LINE, json[0].theNumber().asDecimal64() == d64);
+            }
+            else {
+                ASSERTV(LINE, d, -1 == d);
+                ASSERTV(LINE, bdldfp::Decimal64(-1) == d64);
+                ASSERTV(LINE, 0 != value.asInt64(&i64));
+                ASSERTV(LINE, -1 == i64);
+            }
+
+            int       i     = -1;
+            const int intRc = value.asInt(&i);
+            if (0 == NUMBER_RC) {
+                ASSERTV(LINE, INT_RC, intRc, INT_RC == intRc);
+                ASSERTV(LINE, INT, i, INT == i);
+            }
+            else {
+                ASSERTV(LINE, intRc, 0 != intRc);
+                ASSERTV(LINE, i, -1 == i);
+            }
+
+            bsls::Types::Uint64 u64 = 0;
+            if (0 == NUMBER_RC && 0 == INT_RC && 0 <= INT) {
+                ASSERTV(LINE, 0 == value.asUint64(&u64));
+                ASSERTV(LINE, u64, static_cast<bsls::Types::Uint64>(INT)
+                                                                       == u64);
+                ASSERTV(LINE, 0 == value.asInt64(&i64));
+                ASSERTV(LINE, i64, INT == i64);
+            }
+
+            ASSERTV(LINE, IS_NULL == value.isNull());
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT(0 == mX.load("[1, \"a\", true]"));
+
+            Value value;
+            ASSERT(0 == mX.root().first(&value));
+
+            bool                flag;
+            bsl::string         string;
+            bdldfp::Decimal64   d64;
+            double              d;
+            int                 i;
+            bsls::Types::Int64  i64;
+            bsls::Types::Uint64 u64;
+
+            ASSERT_PASS(value.asBoolean(&flag));
+            ASSERT_FAIL(value.asBoolean(0));
+            ASSERT_PASS(value.asString(&string));
+            ASSERT_FAIL(value.asString(0));
+            ASSERT_PASS(value.asDecimal64(&d64));
+            ASSERT_FAIL(value.asDecimal64(0));
+            ASSERT_PASS(value.asDouble(&d));
+            ASSERT_FAIL(value.asDouble(0));
+            ASSERT_PASS(value.asInt(&i));
+            ASSERT_FAIL(value.asInt(0));
+            ASSERT_PASS(value.asInt64(&i64));
+            ASSERT_FAIL(value.asInt64(0));
+            ASSERT_PASS(value.asUint64(&u64));
+            ASSERT_FAIL(value.asUint64(0));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING NAVIGATION
+        //
+        // Concerns:
+        // 1. `find`, `elementAt`, `first`, and `next` reach every value of a
+        //    text, and the value reached is that of the `Json` object read
+        //    from the same text.
+        //
+        // 2. `find` returns the first of several members having the same
+        //    name, and compares names after decoding escape sequences.
+        //
+        // 3. `size` returns the number of elements or members.
+        //
+        // 4. `text` returns the JSON text of a value, including the contents
+        //    of an array or object.
+        //
+        // 5. Navigation methods fail, with no effect on their result, for a
+        //    value of the wrong type, for a missing member, for an index out
+        //    of range, and at the end of an array or object.
+        //
+        // 6. Navigation does not allocate memory, except to compare names
+        //    having escape sequences longer than a local buffer.
+        //
+        // 7. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. For every text of the JSON Test Suite accepted by
+        //    `JsonUtil::read`, and a few texts having duplicate and escaped
+        //    names, load the text and verify that the value reached through
+        //    the root value is the same as that read by `JsonUtil::read`,
+        //    using `verifySame`.  (C-1..5)
+        //
+        // 2. Navigate a document using a default allocator that is a test
+        //    allocator, and verify that it is not used.  (C-6)
+        //
+        // 3. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   OnDemandValue();
+        //   int elementAt(OnDemandValue *result, bsl::size_t index) const;
+        //   int find(OnDemandValue *result, const bsl::string_view& name);
+        //   int first(OnDemandValue *result) const;
+        //   int next(OnDemandValue *result) const;
+        //   int size(bsl::size_t *result) const;
+        //   int key(bsl::string *result) const;
+        //   JsonType::Enum type() const;
+        //   bool isArray() const;
+        //   bool isObject() const;
+        //   bsl::string_view text() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING NAVIGATION" << endl
+                          << "==================" << endl;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        if (verbose) cout << "\tJSON Test Suite." << endl;
+
+        for (bsl::size_t ti = 0; ti < JTSU::numData(); ++ti) {
+            const int              LINE = JTSU::data(ti)->d_line;
+            const bsl::string_view TEXT(JTSU::data(ti)->d_JSON_p,
+                                        JTSU::data(ti)->d_length);
+
+            Json json;
+            if (0 != Util::read(&json, TEXT)) {
+                continue;                                           // CONTINUE
+            }
+
+            if (veryVerbose) { T_ P_(LINE) P(TEXT) }
+
+            ASSERTV(LINE, 0 == mX.load(TEXT));
+            if (X.isLoaded()) {
+                verifySame(LINE, X.root(), json);
+            }
+        }
+
+        if (verbose) cout << "\tDuplicate and escaped names." << endl;
+
+        static const struct {
+            int         d_line;     // source line number
+            const char *d_text_p;   // JSON text
+            const char *d_name_p;   // name to find
+            const char *d_value_p;  // text of the value found
+        } DATA[] = {
+            //LINE  TEXT                                  NAME  VALUE
+            //----  ------------------------------------  ----  -----------
+            { L_,   "{\"a\": 1, \"a\": 2}",               "a",  "1"         },
+            { L_,   "{\"a\": {\"a\": 3}, \"a\": 2}",      "a",  "{\"a\": 3}"},
+            { L_,   "{\"\\u0061\": 1, \"a\": 2}",         "a",  "1"         },
+            { L_,   "{\"b\": 1, \"\\u0061\": 2}",         "a",  "2"         },
+            { L_,   "{\"\\\"\": [], \"a\": 2}",           "\"", "[]"        },
+            { L_,   "{\"\\n\": 1}",                       "\n", "1"         },
+            { L_,   "{\"\": 1}",                          "",   "1"         },
+            { L_,   "{\"ab\": 1, \"a\": 2}",              "a",  "2"         },
+            { L_,   "{\"\\x\": 1, \"\\\\x\": 2}",         "\\x", "2"        },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE  = DATA[ti].d_line;
+            const char *const TEXT  = DATA[ti].d_text_p;
+            const char *const NAME  = DATA[ti].d_name_p;
+            const char *const VALUE = DATA[ti].d_value_p;
+
+            if (veryVerbose) { T_ P_(LINE) P_(TEXT) P(NAME) }
+
+            ASSERTV(LINE, 0 == mX.load(TEXT));
+
+            Value value;
+            ASSERTV(LINE, 0 == X.root().find(&value, NAME));
+            ASSERTV(LINE, value.text(), VALUE == value.text());
+
+            Json json;
+            if (0 == Util::read(&json, TEXT)) {
+                verifySame(LINE, X.root(), json);
+            }
+        }
+
+        if (verbose) cout << "\tNavigation failures." << endl;
+        {
+            ASSERT(0 == mX.load("[1, {\"a\": [2]}, \"s\", []]"));
+
+            Value root = X.root();
+            Value value;
+            Value unchanged;
+
+            ASSERT(0 == root.elementAt(&unchanged, 0));
+
+            value = unchanged;
+            ASSERT(0 != root.find(&value, "a"));
+            ASSERT(value.text() == unchanged.text());
+            ASSERT(0 != root.elementAt(&value, 4));
+            ASSERT(value.text() == unchanged.text());
+            ASSERT(0 != root.next(&value));
+            ASSERT(value.text() == unchanged.text());
+
+            ASSERT(0 != unchanged.first(&value));
+            ASSERT(0 != unchanged.elementAt(&value, 0));
+            ASSERT(0 != unchanged.find(&value, "a"));
+            bsl::size_t size = 99;
+            ASSERT(0 != unchanged.size(&size));
+            ASSERT(99 == size);
+            ASSERT(value.text() == unchanged.text());
+
+            ASSERT(0 == root.elementAt(&value, 3));
+            ASSERT(value.isArray());
+            ASSERT(0 != value.first(&value));
+            ASSERT(0 == value.size(&size));
+            ASSERT(0 == size);
+            ASSERT(0 != value.next(&value));
+            ASSERT("[]" == value.text());
+
+            ASSERT(0 == root.elementAt(&value, 1));
+            ASSERT(value.isObject());
+            ASSERT(JsonType::e_OBJECT == value.type());
+            ASSERT("{\"a\": [2]}" == value.text());
+        }
+
+        if (verbose) cout << "\tNavigation does not allocate." << endl;
+        {
+            bsl::string text;
+            makeDocument(&text, 100 * 1000);
+
+            ASSERT(0 == mX.load(text));
+
+            bslma::TestAllocator         ta("default", veryVeryVeryVerbose);
+            bslma::DefaultAllocatorGuard guard(&ta);
+
+            Value       element;
+            Value member;
+            bsl::size_t count = 0;
+            for (int rc = X.root().first(&element);
+                 0 == rc;
+                 rc = element.next(&element)) {
+                ASSERT(0 == element.find(&member, "price"));
+                ASSERT(0 == element.find(&member, "description"));
+                ASSERT(0 != element.find(&member, "missing"));
+                ++count;
+            }
+
+            bsl::size_t size;
+            ASSERT(0 == X.root().size(&size));
+            ASSERT(count == size);
+            ASSERT(0 == X.root().elementAt(&element, size - 1));
+
+            ASSERTV(ta.numBlocksTotal(), 0 == ta.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\tNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT(0 == mX.load("[{\"a\": 1}]"));
+
+            const Value ROOT = X.root();
+            Value       value;
+            bsl::size_t size;
+            bsl::string name;
+
+            ASSERT_PASS(ROOT.elementAt(&value, 0));
+            ASSERT_FAIL(ROOT.elementAt(0,      0));
+            ASSERT_PASS(value.find(&value, "a"));
+            ASSERT_FAIL(ROOT.find(0, "a"));
+            ASSERT_PASS(ROOT.first(&value));
+            ASSERT_FAIL(ROOT.first(0));
+            ASSERT_PASS(value.next(&value));
+            ASSERT_FAIL(value.next(0));
+            ASSERT_PASS(ROOT.size(&size));
+            ASSERT_FAIL(ROOT.size(0));
+            ASSERT_PASS(value.key(&name));
+            ASSERT_FAIL(value.key(0));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING `load`
+        //
+        // Concerns:
+        // 1. `load` succeeds if and only if the text has the structure of a
+        //    JSON document, its strings are terminated and free of unescaped
+        //    control characters, and it is valid UTF-8.
+        //
+        // 2. On failure, the document holds no text.
+        //
+        // 3. `reset` discards the text, and loading again reuses the memory
+        //    of the index.
+        //
+        // 4. `load` imposes no limit on nesting depth.
+        //
+        // 5. Memory is supplied by the allocator given at construction.
+        //
+        // Plan:
+        // 1. Using the table-driven technique, load a set of valid and
+        //    invalid texts, and verify the status, `isLoaded`, and `text`.
+        //    Where `JsonUtil::read` accepts a text, so must `load`.  (C-1..2)
+        //
+        // 2. For every text of the JSON Test Suite, verify that `load`
+        //    succeeds whenever `JsonUtil::read` does.  (C-1)
+        //
+        // 3. Load a large document twice and verify that the second load does
+        //    not allocate, then `reset`.  (C-3, 5)
+        //
+        // 4. Load a text nested 100000 levels deep.  (C-4)
+        //
+        // Testing:
+        //   explicit OnDemandDocument(bslma::Allocator *basicAllocator = 0);
+        //   ~OnDemandDocument();
+        //   int load(const bsl::string_view& text);
+        //   void reset();
+        //   bool isLoaded() const;
+        //   OnDemandValue root() const;
+        //   const bsl::string_view& text() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `load`" << endl
+                          << "==============" << endl;
+
+        BSLMF_ASSERT(bslma::UsesBslmaAllocator<Obj>::value);
+
+        static const struct {
+            int         d_line;     // source line number
+            const char *d_text_p;   // JSON text
+            bool        d_isValid;  // expected success
+        } DATA[] = {
+            //LINE  TEXT                                          VALID
+            //----  --------------------------------------------  -----
+            { L_,   "1",                                          true  },
+            { L_,   " \"a\" ",                                    true  },
+            { L_,   "[]",                                         true  },
+            { L_,   "{}",                                         true  },
+            { L_,   "[1, [2, [3, {}]], {\"a\": {\"b\": []}}]",    true  },
+            { L_,   "{\"a\": 1, \"b\": [true, null]}",            true  },
+            { L_,   "tru",                                        true  },
+            { L_,   "[1x, \"\\q\"]",                              true  },
+            { L_,   "",                                           false },
+            { L_,   "  \n ",                                      false },
+            { L_,   "1 2",                                        false },
+            { L_,   "\"a\" \"b\"",                                false },
+            { L_,   "1\"a\"",                                     false },
+            { L_,   "[] []",                                      false },
+            { L_,   "[",                                          false },
+            { L_,   "]",                                          false },
+            { L_,   "[}",                                         false },
+            { L_,   "{]",                                         false },
+            { L_,   "[1,]",                                       false },
+            { L_,   "[,1]",                                       false },
+            { L_,   "[1 2]",                                      false },
+            { L_,   "[1,,2]",                                     false },
+            { L_,   "{\"a\"}",                                    false },
+            { L_,   "{\"a\":}",                                   false },
+            { L_,   "{\"a\" 1}",                                  false },
+            { L_,   "{\"a\": 1,}",                                false },
+            { L_,   "{1: 2}",                                     false },
+            { L_,   "{\"a\": 1 \"b\": 2}",                        false },
+            { L_,   "{\"a\": 1, \"b\"}",                          false },
+            { L_,   "[\"a\": 1]",                                 false },
+            { L_,   ":",                                          false },
+            { L_,   ",",                                          false },
+            { L_,   "\"abc",                                      false },
+            { L_,   "\"a\tb\"",                                   false },
+            { L_,   "\"\xC3\"",                                   false },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        ASSERT(&oa == X.allocator());
+        ASSERT(!X.isLoaded());
+        ASSERT(X.text().empty());
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int              LINE     = DATA[ti].d_line;
+            const bsl::string_view TEXT     = DATA[ti].d_text_p;
+            const bool             IS_VALID = DATA[ti].d_isValid;
+
+            if (veryVerbose) { T_ P_(LINE) P_(TEXT) P(IS_VALID) }
+
+            // Start from a loaded document.
+
+            ASSERTV(LINE, 0 == mX.load("[0]"));
+
+            const int RC = mX.load(TEXT);
+
+            ASSERTV(LINE, RC, IS_VALID == (0 == RC));
+            ASSERTV(LINE, IS_VALID == X.isLoaded());
+            if (IS_VALID) {
+                ASSERTV(LINE, TEXT.data() == X.text().data());
+                ASSERTV(LINE, TEXT.length() == X.text().length());
+
+                ASSERTV(LINE, X.root().text(),
+                        X.root().text() == bsl::string_view(TEXT.data()
+                                      + TEXT.find_first_not_of(" \n\t\r")).
+                                    substr(0, X.root().text().length()));
+            }
+            else {
+                ASSERTV(LINE, X.text().empty());
+            }
+
+            Json json;
+            if (0 == Util::read(&json, TEXT)) {
+                ASSERTV(LINE, IS_VALID);
+            }
+        }
+
+        if (verbose) cout << "\tJSON Test Suite." << endl;
+
+        for (bsl::size_t ti = 0; ti < JTSU::numData(); ++ti) {
+            const int              LINE = JTSU::data(ti)->d_line;
+            const bsl::string_view TEXT(JTSU::data(ti)->d_JSON_p,
+                                        JTSU::data(ti)->d_length);
+
+            Json json;
+            if (0 == Util::read(&json, TEXT)) {
+                ASSERTV(LINE, TEXT, 0 == mX.load(TEXT));
+            }
+        }
+
+        if (verbose) cout << "\tMemory is reused." << endl;
+        {
+            const bsls::Types::Int64 NUM_DEFAULT_BLOCKS = da.numBlocksTotal();
+
+            bsl::string text(&oa);
+            makeDocument(&text, 100 * 1000);
+
+            ASSERT(0 == mX.load(text));
+            ASSERT(0 <  oa.numBytesInUse());
+
+            const bsls::Types::Int64 NUM_BLOCKS = oa.numBlocksTotal();
+
+            mX.reset();
+            ASSERT(!X.isLoaded());
+            ASSERT(X.text().empty());
+
+            ASSERT(0 == mX.load(text));
+            ASSERTV(NUM_BLOCKS, oa.numBlocksTotal(),
+                    NUM_BLOCKS == oa.numBlocksTotal());
+
+            ASSERTV(NUM_DEFAULT_BLOCKS, da.numBlocksTotal(),
+                    NUM_DEFAULT_BLOCKS == da.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\tDeep nesting." << endl;
+        {
+            const bsl::size_t DEPTH = 100 * 1000;
+
+            bsl::string text(DEPTH, '[');
+            text.append(DEPTH, ']');
+
+            ASSERT(0 == mX.load(text));
+
+            Value       value = X.root();
+            bsl::size_t depth = 1;
+            while (0 == value.first(&value)) {
+                ++depth;
+            }
+            ASSERTV(depth, DEPTH == depth);
+
+            text[text.length() / 2] = '}';
+
+            ASSERT(0 != mX.load(text));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Load a small document, navigate to and decode a few values.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        ASSERT(!X.isLoaded());
+        ASSERT(0 == mX.load("{\"a\": [10, \"x\"], \"b\": {\"c\": false}}"));
+        ASSERT(X.isLoaded());
+
+        Value root = X.root();
+        ASSERT(root.isObject());
+
+        Value a, b, c, element;
+        ASSERT(0 == root.find(&a, "a"));
+        ASSERT(0 == root.find(&b, "b"));
+        ASSERT(0 != root.find(&c, "c"));
+        ASSERT(0 == b.find(&c, "c"));
+
+        int  i;
+        bool flag = true;
+        ASSERT(0 == a.elementAt(&element, 0));
+        ASSERT(0 == element.asInt(&i));
+        ASSERT(10 == i);
+        ASSERT(0 == c.asBoolean(&flag));
+        ASSERT(false == flag);
+
+        bsl::string name;
+        ASSERT(0 == a.key(&name));
+        ASSERT("a" == name);
+        ASSERT(0 == a.next(&b));
+        ASSERT(0 == b.key(&name));
+        ASSERT("b" == name);
+        ASSERT(0 != b.next(&b));
+
+        ASSERT(0 != mX.load("{\"a\": }"));
+        ASSERT(!X.isLoaded());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        // 1. Extracting a few values from a large document is much faster
+        //    with an `OnDemandDocument` than by reading a `Json` object.
+        //
+        // Plan:
+        // 1. Extract the `price` of the last element of a large generated
+        //    array both ways, and report the time taken by each.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        bslma::DefaultAllocatorGuard guard(bslma::Default::globalAllocator());
+
+        bsl::string text;
+        makeDocument(&text, 16 * 1024 * 1024);
+
+        const int NUM_ITERATIONS = 5;
+
+        double expected = 0;
+
+        bsls::Stopwatch sw;
+        sw.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            Json json;
+            ASSERT(0 == Util::read(&json, text));
+            expected = json[json.size() - 1]["price"].theNumber().asDouble();
+        }
+        sw.stop();
+
+        cout << "JsonUtil::read:   " << sw.elapsedTime() / NUM_ITERATIONS
+             << " s per document" << endl;
+
+        Obj    mX;  const Obj& X = mX;
+        double price = 0;
+
+        sw.reset();
+        sw.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            ASSERT(0 == mX.load(text));
+
+            bsl::size_t size;
+            Value       element;
+            Value       member;
+            ASSERT(0 == X.root().size(&size));
+            ASSERT(0 == X.root().elementAt(&element, size - 1));
+            ASSERT(0 == element.find(&member, "price"));
+            ASSERT(0 == member.asDouble(&price));
+        }
+        sw.stop();
+
+        ASSERTV(expected, price, expected == price);
+
+        cout << "OnDemandDocument: " << sw.elapsedTime() / NUM_ITERATIONS
+             << " s per document" << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,514 @@
+// bdljsn_structuralindexutil.cpp                                     -*-C++-*-
+#include <bdljsn_structuralindexutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdljsn_structuralindexutil_cpp, "$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+#include <bdlde_utf8util.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstring.h>
+
+#if defined(BSLS_PLATFORM_CPU_AVX2)
+#include <immintrin.h>
+#elif defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
+///Implementation Notes
+///--------------------
+// The text is indexed one 64-character block at a time (the final, partial
+// block is copied into a buffer padded with spaces).  `classifyBlock`
+// computes, for each block, one bit per character for each of the character
+// classes that matter (quotes, backslashes, structural characters, white
+// space, control characters, and non-ASCII bytes).  Everything else is
+// computed from those masks:
+//
+// * A character is escaped if it follows a backslash that is not itself
+//   escaped.  Backslashes are rare enough in practice that the escaped
+//   characters are found by visiting each backslash of the block in turn.
+//
+// * A character is inside a string if an odd number of unescaped quotes
+//   precede or are at its position, which is the "prefix-exclusive-or" of the
+//   unescaped quote mask.  Note that the opening quote of a string is inside
+//   the string, and its closing quote is not.
+//
+// * A character starts a literal or number if it is outside of strings,
+//   belongs to none of the other classes, and does not follow another such
+//   character.  Note that an escaped quote outside of strings (which is never
+//   valid JSON) is such a character.
+//
+// Three bits of state are carried from one block to the next: whether the
+// first character of the next block is escaped, whether it is inside a
+// string, and whether the last character of the block starts or continues a
+// literal or number.
+//
+// The index is resized ahead of the scan, one chunk of text at a time, by
+// the maximum number of structural positions in the chunk (one per
+// character), so that positions can be stored without checking the capacity
+// of the index; it is resized to the number of positions found at the end.
+
+namespace BloombergLP {
+namespace bdljsn {
+namespace {
+namespace u {
+
+typedef bsl::uint64_t               Mask;
+typedef StructuralIndexUtil::Offset Offset;
+
+enum {
+    k_BLOCK_SIZE = 64,         // characters per block (one per mask bit)
+    k_CHUNK_SIZE = 64 * 1024   // characters per resizing of the index
+};
+
+enum {
+    // status values returned by `buildIndex`
+
+    k_TOO_LONG             = -1,
+    k_UNTERMINATED_STRING  = -2,
+    k_UNESCAPED_CONTROL    = -3,
+    k_INVALID_UTF8         = -4
+};
+
+                             // =================
+                             // struct BlockMasks
+                             // =================
+
+/// This `struct` holds one bit per character of a 64-character block for
+/// each class of characters significant to the index, the bit at index `i`
+/// corresponding to the character at offset `i` in the block.
+struct BlockMasks {
+
+    // PUBLIC DATA
+    Mask d_quote;       // `"`
+    Mask d_backslash;   // `\`
+    Mask d_structural;  // `{`, `}`, `[`, `]`, `:`, and `,`
+    Mask d_whitespace;  // ` `, `\t`, `\n`, and `\r`
+    Mask d_control;     // `U+0000` to `U+001F`
+    Mask d_nonAscii;    // bytes having their high bit set
+};
+
+#if defined(BSLS_PLATFORM_CPU_AVX2)
+
+/// Return the mask of the most significant bits of the bytes of the
+/// specified `matches`, shifted left by the specified `shift` bits.
+inline
+Mask toMask(__m256i matches, int shift)
+{
+    const unsigned int bits = static_cast<unsigned int>(
+                                               _mm256_movemask_epi8(matches));
+    return static_cast<Mask>(bits) << shift;
+}
+
+/// Load into the specified `result` the masks of the 64 characters at the
+/// specified `block`.
+void classifyBlock(BlockMasks *result, const char *block)
+{
+    const __m256i quote      = _mm256_set1_epi8('"');
+    const __m256i backslash  = _mm256_set1_epi8('\\');
+    const __m256i lowerCase  = _mm256_set1_epi8(0x20);
+    const __m256i openBrace  = _mm256_set1_epi8('{');
+    const __m256i closeBrace = _mm256_set1_epi8('}');
+    const __m256i colon      = _mm256_set1_epi8(':');
+    const __m256i comma      = _mm256_set1_epi8(',');
+    const __m256i space      = _mm256_set1_epi8(' ');
+    const __m256i tab        = _mm256_set1_epi8('\t');
+    const __m256i newline    = _mm256_set1_epi8('\n');
+    const __m256i carriage   = _mm256_set1_epi8('\r');
+    const __m256i maxControl = _mm256_set1_epi8(0x1F);
+
+    BlockMasks masks = { 0, 0, 0, 0, 0, 0 };
+
+    for (int shift = 0; shift < k_BLOCK_SIZE; shift += 32) {
+        const __m256i v = _mm256_loadu_si256(
+                            reinterpret_cast<const __m256i *>(block + shift));
+
+        // `[` and `]` differ from `{` and `}` only in bit 5.
+
+        const __m256i folded = _mm256_or_si256(v, lowerCase);
+
+        const __m256i braces = _mm256_or_si256(
+                                        _mm256_cmpeq_epi8(folded, openBrace),
+                                        _mm256_cmpeq_epi8(folded, closeBrace));
+        const __m256i separators = _mm256_or_si256(
+                                                  _mm256_cmpeq_epi8(v, colon),
+                                                  _mm256_cmpeq_epi8(v, comma));
+        const __m256i blanks = _mm256_or_si256(_mm256_cmpeq_epi8(v, space),
+                                               _mm256_cmpeq_epi8(v, tab));
+        const __m256i breaks = _mm256_or_si256(_mm256_cmpeq_epi8(v, newline),
+                                               _mm256_cmpeq_epi8(v, carriage));
+        const __m256i controls = _mm256_cmpeq_epi8(
+                                             _mm256_max_epu8(v, maxControl),
+                                             maxControl);
+
+        masks.d_quote      |= toMask(_mm256_cmpeq_epi8(v, quote), shift);
+        masks.d_backslash  |= toMask(_mm256_cmpeq_epi8(v, backslash), shift);
+        masks.d_structural |= toMask(_mm256_or_si256(braces, separators),
+                                     shift);
+        masks.d_whitespace |= toMask(_mm256_or_si256(blanks, breaks), shift);
+        masks.d_control    |= toMask(controls, shift);
+        masks.d_nonAscii   |= toMask(v, shift);
+    }
+
+    *result = masks;
+}
+
+#elif defined(BSLS_PLATFORM_CPU_SSE2)
+
+/// Return the mask of the most significant bits of the bytes of the
+/// specified `matches`, shifted left by the specified `shift` bits.
+inline
+Mask toMask(__m128i matches, int shift)
+{
+    const unsigned int bits = static_cast<unsigned int>(
+                                                  _mm_movemask_epi8(matches));
+    return static_cast<Mask>(bits) << shift;
+}
+
+/// Load into the specified `result` the masks of the 64 characters at the
+/// specified `block`.
+void classifyBlock(BlockMasks *result, const char *block)
+{
+    const __m128i quote      = _mm_set1_epi8('"');
+    const __m128i backslash  = _mm_set1_epi8('\\');
+    const __m128i lowerCase  = _mm_set1_epi8(0x20);
+    const __m128i openBrace  = _mm_set1_epi8('{');
+    const __m128i closeBrace = _mm_set1_epi8('}');
+    const __m128i colon      = _mm_set1_epi8(':');
+    const __m128i comma      = _mm_set1_epi8(',');
+    const __m128i space      = _mm_set1_epi8(' ');
+    const __m128i tab        = _mm_set1_epi8('\t');
+    const __m128i newline    = _mm_set1_epi8('\n');
+    const __m128i carriage   = _mm_set1_epi8('\r');
+    const __m128i maxControl = _mm_set1_epi8(0x1F);
+
+    BlockMasks masks = { 0, 0, 0, 0, 0, 0 };
+
+    for (int shift = 0; shift < k_BLOCK_SIZE; shift += 16) {
+        const __m128i v = _mm_loadu_si128(
+                            reinterpret_cast<const __m128i *>(block + shift));
+
+        // `[` and `]` differ from `{` and `}` only in bit 5.
+
+        const __m128i folded = _mm_or_si128(v, lowerCase);
+
+        const __m128i braces = _mm_or_si128(
+                                        _mm_cmpeq_epi8(folded, openBrace),
+                                        _mm_cmpeq_epi8(folded, closeBrace));
+        const __m128i separators = _mm_or_si128(_mm_cmpeq_epi8(v, colon),
+                                                _mm_cmpeq_epi8(v, comma));
+        const __m128i blanks = _mm_or_si128(_mm_cmpeq_epi8(v, space),
+                                            _mm_cmpeq_epi8(v, tab));
+        const __m128i breaks = _mm_or_si128(_mm_cmpeq_epi8(v, newline),
+                                            _mm_cmpeq_epi8(v, carriage));
+        const __m128i controls = _mm_cmpeq_epi8(
+                                             _mm_max_epu8(v, maxControl),
+                                             maxControl);
+
+        masks.d_quote      |= toMask(_mm_cmpeq_epi8(v, quote), shift);
+        masks.d_backslash  |= toMask(_mm_cmpeq_epi8(v, backslash), shift);
+        masks.d_structural |= toMask(_mm_or_si128(braces, separators),
+                                     shift);
+        masks.d_whitespace |= toMask(_mm_or_si128(blanks, breaks), shift);
+        masks.d_control    |= toMask(controls, shift);
+        masks.d_nonAscii   |= toMask(v, shift);
+    }
+
+    *result = masks;
+}
+
+#else
+
+/// Load into the specified `result` the masks of the 64 characters at the
+/// specified `block`.
+void classifyBlock(BlockMasks *result, const char *block)
+{
+    BlockMasks masks = { 0, 0, 0, 0, 0, 0 };
+
+    for (int i = 0; i < k_BLOCK_SIZE; ++i) {
+        const unsigned char c   = static_cast<unsigned char>(block[i]);
+        const Mask          bit = static_cast<Mask>(1) << i;
+
+        switch (c) {
+          case '"': {
+            masks.d_quote |= bit;
+          } break;
+          case '\\': {
+            masks.d_backslash |= bit;
+          } break;
+          case '{':
+          case '}':
+          case '[':
+          case ']':
+          case ':':
+          case ',': {
+            masks.d_structural |= bit;
+          } break;
+          case ' ': {
+            masks.d_whitespace |= bit;
+          } break;
+          case '\t':
+          case '\n':
+          case '\r': {
+            masks.d_whitespace |= bit;
+            masks.d_control    |= bit;
+          } break;
+          default: {
+            if (c < 0x20) {
+                masks.d_control |= bit;
+            }
+            else if (c >= 0x80) {
+                masks.d_nonAscii |= bit;
+            }
+          } break;
+        }
+    }
+
+    *result = masks;
+}
+
+#endif
+
+/// Return the "prefix-exclusive-or" of the specified `mask`, i.e., the mask
+/// whose bit `i` is the exclusive-or of the bits `0` to `i` of `mask`.
+inline
+Mask prefixXor(Mask mask)
+{
+    mask ^= mask << 1;
+    mask ^= mask << 2;
+    mask ^= mask << 4;
+    mask ^= mask << 8;
+    mask ^= mask << 16;
+    mask ^= mask << 32;
+    return mask;
+}
+
+                               // =============
+                               // class Scanner
+                               // =============
+
+/// This class computes the structural positions of a text one block at a
+/// time, carrying the state needed from one block to the next.
+class Scanner {
+
+    // DATA
+    Mask d_escapedCarry;   // 1 if the next block starts with an escaped
+                           // character, and 0 otherwise
+
+    Mask d_inStringCarry;  // all bits set if the next block starts inside a
+                           // string, and 0 otherwise
+
+    Mask d_otherCarry;     // 1 if the previous block ended with a character
+                           // of a literal or number, and 0 otherwise
+
+    Mask d_nonAscii;       // union of the non-ASCII masks of all blocks
+
+  public:
+    // CREATORS
+
+    /// Create a `Scanner` positioned at the start of a text.
+    Scanner()
+    : d_escapedCarry(0)
+    , d_inStringCarry(0)
+    , d_otherCarry(0)
+    , d_nonAscii(0)
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Append to the array at the specified `*output` the offsets of the
+    /// structural positions of the 64 characters at the specified `block`,
+    /// the first of which is at the specified `blockOffset` in the text, and
+    /// advance `*output` past them.  Return 0 on success, and a non-zero
+    /// value if a string in `block` contains an unescaped control character.
+    int scanBlock(Offset **output, const char *block, Offset blockOffset);
+
+    // ACCESSORS
+
+    /// Return `true` if any scanned character is a non-ASCII byte, and
+    /// `false` otherwise.
+    bool hasNonAscii() const;
+
+    /// Return `true` if the end of the last scanned block is inside a
+    /// string, and `false` otherwise.
+    bool isInString() const;
+};
+
+                               // -------------
+                               // class Scanner
+                               // -------------
+
+// MANIPULATORS
+inline
+int Scanner::scanBlock(Offset **output, const char *block, Offset blockOffset)
+{
+    BlockMasks masks;
+    classifyBlock(&masks, block);
+
+    // Find the escaped characters, visiting each unescaped backslash.
+
+    Mask escaped   = d_escapedCarry;
+    Mask backslash = masks.d_backslash;
+
+    d_escapedCarry = 0;
+    while (backslash) {
+        const int i = bdlb::BitUtil::numTrailingUnsetBits(backslash);
+        backslash &= backslash - 1;
+
+        const Mask bit = static_cast<Mask>(1) << i;
+        if (escaped & bit) {
+            continue;                                               // CONTINUE
+        }
+        if (k_BLOCK_SIZE - 1 == i) {
+            d_escapedCarry = 1;
+        }
+        else {
+            escaped |= bit << 1;
+        }
+    }
+
+    const Mask quote    = masks.d_quote & ~escaped;
+    const Mask inString = prefixXor(quote) ^ d_inStringCarry;
+
+    d_inStringCarry = static_cast<Mask>(0) - (inString >> (k_BLOCK_SIZE - 1));
+
+    if (masks.d_control & inString) {
+        return k_UNESCAPED_CONTROL;                                   // RETURN
+    }
+
+    d_nonAscii |= masks.d_nonAscii;
+
+    const Mask other = ~(quote | masks.d_structural | masks.d_whitespace |
+                                                                   inString);
+    const Mask start = other & ~((other << 1) | d_otherCarry);
+
+    d_otherCarry = other >> (k_BLOCK_SIZE - 1);
+
+    Mask positions = (masks.d_structural & ~inString) | quote | start;
+
+    Offset *out = *output;
+    while (positions) {
+        *out++ = blockOffset + static_cast<Offset>(
+                               bdlb::BitUtil::numTrailingUnsetBits(positions));
+        positions &= positions - 1;
+    }
+    *output = out;
+
+    return 0;
+}
+
+// ACCESSORS
+inline
+bool Scanner::hasNonAscii() const
+{
+    return 0 != d_nonAscii;
+}
+
+inline
+bool Scanner::isInString() const
+{
+    return 0 != d_inStringCarry;
+}
+
+}  // close namespace u
+}  // close unnamed namespace
+
+                         // --------------------------
+                         // struct StructuralIndexUtil
+                         // --------------------------
+
+// CLASS METHODS
+int StructuralIndexUtil::buildIndex(bsl::vector<Offset>     *index,
+                                    const bsl::string_view&  input)
+{
+    BSLS_ASSERT(index);
+
+    const bsl::size_t length = input.length();
+
+    index->clear();
+
+    if (static_cast<bsl::size_t>(k_MAX_LENGTH) < length) {
+        return u::k_TOO_LONG;                                         // RETURN
+    }
+
+    const char  *data         = input.data();
+    bsl::size_t  numPositions = 0;
+    u::Scanner   scanner;
+
+    for (bsl::size_t chunk = 0; chunk < length; chunk += u::k_CHUNK_SIZE) {
+        const bsl::size_t chunkLength =
+                    bsl::min<bsl::size_t>(u::k_CHUNK_SIZE, length - chunk);
+
+        index->resize(numPositions + chunkLength);
+
+        Offset *out = index->data() + numPositions;
+
+        const bsl::size_t numFullBlocks = chunkLength / u::k_BLOCK_SIZE;
+        const char       *block         = data + chunk;
+
+        for (bsl::size_t i = 0; i < numFullBlocks; ++i) {
+            const Offset blockOffset = static_cast<Offset>(
+                                          chunk + i * u::k_BLOCK_SIZE);
+
+            if (0 != scanner.scanBlock(&out,
+                                       block + i * u::k_BLOCK_SIZE,
+                                       blockOffset)) {
+                return u::k_UNESCAPED_CONTROL;                        // RETURN
+            }
+        }
+
+        const bsl::size_t tailLength = chunkLength % u::k_BLOCK_SIZE;
+        if (tailLength) {
+            char tail[u::k_BLOCK_SIZE];
+            bsl::memset(tail, ' ', sizeof tail);
+            bsl::memcpy(tail,
+                        block + numFullBlocks * u::k_BLOCK_SIZE,
+                        tailLength);
+
+            const Offset blockOffset = static_cast<Offset>(
+                                   chunk + numFullBlocks * u::k_BLOCK_SIZE);
+
+            if (0 != scanner.scanBlock(&out, tail, blockOffset)) {
+                return u::k_UNESCAPED_CONTROL;                        // RETURN
+            }
+        }
+
+        numPositions = static_cast<bsl::size_t>(out - index->data());
+    }
+
+    index->resize(numPositions);
+
+    if (scanner.isInString()) {
+        return u::k_UNTERMINATED_STRING;                              // RETURN
+    }
+
+    if (scanner.hasNonAscii() && !bdlde::Utf8Util::isValid(data, length)) {
+        return u::k_INVALID_UTF8;                                     // RETURN
+    }
+
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
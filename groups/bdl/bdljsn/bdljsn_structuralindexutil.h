@@ -0,0 +1,169 @@
+// bdljsn_structuralindexutil.h                                       -*-C++-*-
+#ifndef INCLUDED_BDLJSN_STRUCTURALINDEXUTIL
+#define INCLUDED_BDLJSN_STRUCTURALINDEXUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a vectorized index of the structure of a JSON text.
+//
+//@CLASSES:
+//  bdljsn::StructuralIndexUtil: namespace for indexing the tokens of JSON text
+//
+//@SEE_ALSO: bdljsn_jsonutil, bdljsn_tokenizer
+//
+//@DESCRIPTION: This component provides a `struct`,
+// `bdljsn::StructuralIndexUtil`, that is a namespace for a function,
+// `buildIndex`, that scans a JSON text held in contiguous memory and loads the
+// offsets of its *structural* *positions* into a vector.  The structural
+// positions of a JSON text are, in order of occurrence:
+//
+// * the `{`, `}`, `[`, `]`, `:`, and `,` characters outside of strings,
+// * the opening and closing `"` characters of every string, and
+// * the first character of every other run of non-white-space characters
+//   outside of strings (i.e., the start of every literal or number).
+//
+// The index is the first stage of a two-stage parser: given the index, a
+// second stage can build a document (e.g., a `bdljsn::Json` object) by
+// visiting one structural position after another, without examining the
+// characters in between, most of which are the contents of strings or white
+// space.  `bdljsn::JsonUtil::read` uses this component when reading from a
+// `bsl::string_view`.
+//
+// `buildIndex` also checks the following properties of the text, each of
+// which is required by RFC 8259 (and by `bdljsn::Tokenizer` in its strict
+// conformance mode), and fails if any does not hold:
+//
+// * every string is terminated,
+// * no string contains an unescaped control character (i.e., a character in
+//   the range `U+0000` to `U+001F`), and
+// * the text is a valid sequence of UTF-8 code points.
+//
+// No other part of the JSON grammar is checked: for example, the index of
+// `]]{` is `[0, 1, 2]`, and it is the responsibility of the second stage to
+// verify the order of the structural positions and the syntax of literals and
+// numbers.
+//
+///Implementation
+///--------------
+// The text is processed in blocks of 64 characters.  For each block,
+// `buildIndex` computes 64-bit masks of the positions of the quote,
+// backslash, structural, white-space, and control characters using SSE2 or
+// AVX2 instructions where available (as indicated by `BSLS_PLATFORM_CPU_SSE2`
+// and `BSLS_PLATFORM_CPU_AVX2`), and one character at a time otherwise.  The
+// positions inside strings are derived from those masks with a handful of
+// bitwise operations per block (a "prefix-exclusive-or" of the mask of
+// unescaped quotes identifies the characters between quotes), carrying state
+// from one block to the next, so that characters are not examined one at a
+// time.  Only backslashes, which are rare in typical documents, are visited
+// individually, to find the escaped characters.  Finally, the set bits of the
+// mask of structural positions are appended to the index.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting the Members of an Object
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to know how many members a flat JSON object has, without
+// building a `bdljsn::Json` object.
+//
+// First, we build the index of a JSON text:
+// ```
+// const bsl::string_view text =
+//                           "{\"a\": 1, \"b\\\"\": [true], \"c\": \"}\"}";
+//
+// bsl::vector<bdljsn::StructuralIndexUtil::Offset> index;
+//
+// int rc = bdljsn::StructuralIndexUtil::buildIndex(&index, text);
+// assert(0 == rc);
+// ```
+// Then, we observe that the characters inside strings, including the escaped
+// quote in the name `b\"` and the brace in the value of `c`, are not
+// indexed:
+// ```
+// const char *EXPECTED = "{\"\":1,\"\":[t],\"\":\"\"}";
+//
+// assert(bsl::strlen(EXPECTED) == index.size());
+// for (bsl::size_t i = 0; i < index.size(); ++i) {
+//     assert(EXPECTED[i] == text[index[i]]);
+// }
+// ```
+// Finally, we count the members by counting the `:` characters at the top
+// level of the object:
+// ```
+// int depth      = 0;
+// int numMembers = 0;
+// for (bsl::size_t i = 0; i < index.size(); ++i) {
+//     switch (text[index[i]]) {
+//       case '{':
+//       case '[': ++depth;                           break;
+//       case '}':
+//       case ']': --depth;                           break;
+//       case ':': numMembers += (1 == depth) ? 1 : 0; break;
+//     }
+// }
+// assert(3 == numMembers);
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+namespace BloombergLP {
+namespace bdljsn {
+
+                         // ==========================
+                         // struct StructuralIndexUtil
+                         // ==========================
+
+/// This `struct` provides a namespace for a function that indexes the
+/// structural positions of a JSON text.
+struct StructuralIndexUtil {
+
+    // TYPES
+
+    /// `Offset` is an alias for the type of the offset of a structural
+    /// position from the start of the text.
+    typedef bsl::uint32_t Offset;
+
+    enum {
+        k_MAX_LENGTH = 0xFFFFFFFFu  // maximum length of an indexed text
+    };
+
+    // CLASS METHODS
+
+    /// Load into the specified `index` the ascending offsets of the
+    /// structural positions of the JSON text in the specified `input` (see
+    /// {Description}), replacing any previous contents of `index`.  Return 0
+    /// on success, and a non-zero value if `input` contains an unterminated
+    /// string or a string containing an unescaped control character, if
+    /// `input` is not valid UTF-8, or if `k_MAX_LENGTH < input.length()`.
+    /// The contents of `index` are unspecified if a non-zero value is
+    /// returned.
+    static int buildIndex(bsl::vector<Offset>     *index,
+                          const bsl::string_view&  input);
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
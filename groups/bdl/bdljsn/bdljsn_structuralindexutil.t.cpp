@@ -0,0 +1,630 @@
+// bdljsn_structuralindexutil.t.cpp                                   -*-C++-*-
+#include <bdljsn_structuralindexutil.h>
+
+#include <bdlde_utf8util.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_string_view.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+
+// ============================================================================
+//                                 TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// The component under test provides a single function, `buildIndex`, whose
+// result is fully determined by its input.  We test it against a simple
+// character-by-character reference implementation, `buildReferenceIndex`,
+// first on a table of hand-picked texts exercising each concern, and then on
+// a large number of pseudo-random texts built from an alphabet of the
+// characters significant to the index, which exercise the carrying of state
+// from one 64-character block (and one chunk of the index) to the next.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int buildIndex(bsl::vector<Offset> *, const bsl::string_view&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] CONCERN: RANDOM TEXTS MATCH THE REFERENCE IMPLEMENTATION
+// [ 4] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdljsn::StructuralIndexUtil Obj;
+typedef Obj::Offset                 Offset;
+
+static int verbose = 0;
+static int veryVerbose = 0;
+static int veryVeryVerbose = 0;
+static int veryVeryVeryVerbose = 0;
+
+// ============================================================================
+//                          HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// Load into the specified `index` the structural positions of the specified
+/// `input`, examining one character at a time.  Return 0 on success, and a
+/// non-zero value under the same conditions as `Obj::buildIndex`.
+int buildReferenceIndex(bsl::vector<Offset>     *index,
+                        const bsl::string_view&  input)
+{
+    index->clear();
+
+    bool inString = false;  // the current character is inside a string
+    bool escaped  = false;  // the current character follows an escape
+    bool inOther  = false;  // the previous character is in a literal/number
+
+    for (bsl::size_t i = 0; i < input.length(); ++i) {
+        const unsigned char c          = static_cast<unsigned char>(input[i]);
+        const bool          wasEscaped = escaped;
+
+        escaped = !wasEscaped && '\\' == c;
+
+        if (inString) {
+            if ('"' == c && !wasEscaped) {
+                index->push_back(static_cast<Offset>(i));
+                inString = false;
+            }
+            else if (c < 0x20) {
+                return -1;                                            // RETURN
+            }
+            continue;                                               // CONTINUE
+        }
+
+        switch (c) {
+          case '"': {
+            if (wasEscaped) {
+                if (!inOther) {
+                    index->push_back(static_cast<Offset>(i));
+                }
+                inOther = true;
+            }
+            else {
+                index->push_back(static_cast<Offset>(i));
+                inString = true;
+                inOther  = false;
+            }
+          } break;
+          case '{':
+          case '}':
+          case '[':
+          case ']':
+          case ':':
+          case ',': {
+            index->push_back(static_cast<Offset>(i));
+            inOther = false;
+          } break;
+          case ' ':
+          case '\t':
+          case '\n':
+          case '\r': {
+            inOther = false;
+          } break;
+          default: {
+            if (!inOther) {
+                index->push_back(static_cast<Offset>(i));
+            }
+            inOther = true;
+          } break;
+        }
+    }
+
+    if (inString) {
+        return -2;                                                    // RETURN
+    }
+
+    if (!bdlde::Utf8Util::isValid(input.data(), input.length())) {
+        return -3;                                                    // RETURN
+    }
+
+    return 0;
+}
+
+/// Return a pseudo-random number, updating the specified `seed`.
+unsigned int nextRandom(unsigned int *seed)
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return (*seed >> 8) & 0xFFFFFF;
+}
+
+/// Load into the specified `result` a pseudo-random text of the specified
+/// `length` built from characters significant to the index, using the
+/// specified `seed`.
+void makeRandomText(bsl::string  *result,
+                    bsl::size_t   length,
+                    unsigned int *seed)
+{
+    static const char ALPHABET[] = "\"\"\"\\\\{}[]:, \t\n\rab12\x01\xC3\xA9";
+    static const bsl::size_t ALPHABET_LENGTH = sizeof ALPHABET - 1;
+
+    result->resize(length);
+    for (bsl::size_t i = 0; i < length; ++i) {
+        (*result)[i] = ALPHABET[nextRandom(seed) % ALPHABET_LENGTH];
+    }
+}
+
+/// Load into the specified `result` a valid JSON text of at least the
+/// specified `length` consisting of an array of objects of typical shape.
+void makeDocument(bsl::string *result, bsl::size_t length)
+{
+    result->assign("[");
+    for (int i = 0; result->length() < length; ++i) {
+        if (i) {
+            result->append(",\n");
+        }
+        result->append("  {\"id\": 12345, \"name\": \"Some Security Name\", "
+                       "\"price\": 101.25, \"active\": true, "
+                       "\"tags\": [\"alpha\", \"beta\", \"gam\\\"ma\"], "
+                       "\"description\": \"A longer description of the "
+                       "security, typical of reference data.\"}");
+    }
+    result->append("]");
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    const int test = argc > 1 ? bsl::atoi(argv[1]) : 0;
+
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator         da("default", veryVeryVeryVerbose);
+    bslma::DefaultAllocatorGuard dag(&da);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Example 1: Counting the Members of an Object
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we want to know how many members a flat JSON object has, without
+// building a `bdljsn::Json` object.
+//
+// First, we build the index of a JSON text:
+// ```
+    const bsl::string_view text =
+                             "{\"a\": 1, \"b\\\"\": [true], \"c\": \"}\"}";
+
+    bsl::vector<bdljsn::StructuralIndexUtil::Offset> index;
+
+    int rc = bdljsn::StructuralIndexUtil::buildIndex(&index, text);
+    ASSERT(0 == rc);
+// ```
+// Then, we observe that the characters inside strings, including the escaped
+// quote in the name `b\"` and the brace in the value of `c`, are not
+// indexed:
+// ```
+    const char *EXPECTED = "{\"\":1,\"\":[t],\"\":\"\"}";
+
+    ASSERT(bsl::strlen(EXPECTED) == index.size());
+    for (bsl::size_t i = 0; i < index.size(); ++i) {
+        ASSERT(EXPECTED[i] == text[index[i]]);
+    }
+// ```
+// Finally, we count the members by counting the `:` characters at the top
+// level of the object:
+// ```
+    int depth      = 0;
+    int numMembers = 0;
+    for (bsl::size_t i = 0; i < index.size(); ++i) {
+        switch (text[index[i]]) {
+          case '{':
+          case '[': ++depth;                           break;
+          case '}':
+          case ']': --depth;                           break;
+          case ':': numMembers += (1 == depth) ? 1 : 0; break;
+        }
+    }
+    ASSERT(3 == numMembers);
+// ```
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONCERN: RANDOM TEXTS MATCH THE REFERENCE IMPLEMENTATION
+        //
+        // Concerns:
+        // 1. The state carried from one 64-character block to the next
+        //    (escapes, strings, and literals spanning the boundary) is
+        //    correct.
+        //
+        // 2. The state carried from one chunk of the index to the next is
+        //    correct.
+        //
+        // Plan:
+        // 1. Build many pseudo-random texts of lengths up to a few blocks from
+        //    an alphabet of significant characters, and verify that
+        //    `buildIndex` and `buildReferenceIndex` agree on the status and,
+        //    on success, on the index.  (C-1)
+        //
+        // 2. Repeat P-1 for valid documents larger than several chunks.
+        //    (C-2)
+        //
+        // Testing:
+        //   CONCERN: RANDOM TEXTS MATCH THE REFERENCE IMPLEMENTATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+               << "CONCERN: RANDOM TEXTS MATCH THE REFERENCE IMPLEMENTATION"
+               << endl
+               << "========================================================"
+               << endl;
+
+        bsl::string         text;
+        bsl::vector<Offset> index;
+        bsl::vector<Offset> expected;
+        unsigned int        seed = 12345;
+
+        if (verbose) cout << "\tPseudo-random texts." << endl;
+
+        for (int ti = 0; ti < 100000; ++ti) {
+            const bsl::size_t LENGTH = nextRandom(&seed) % 300;
+
+            makeRandomText(&text, LENGTH, &seed);
+
+            const int RC          = Obj::buildIndex(&index, text);
+            const int EXPECTED_RC = buildReferenceIndex(&expected, text);
+
+            ASSERTV(ti, text, RC, EXPECTED_RC,
+                    (0 == RC) == (0 == EXPECTED_RC));
+
+            if (0 == RC && 0 == EXPECTED_RC) {
+                ASSERTV(ti, text, expected == index);
+            }
+
+            // Texts without strings are unlikely at random; check those,
+            // which exercise literals spanning blocks, too.
+
+            for (bsl::size_t i = 0; i < text.length(); ++i) {
+                if ('"' == text[i]) {
+                    text[i] = 'x';
+                }
+            }
+
+            ASSERTV(ti, text, (0 == Obj::buildIndex(&index, text))
+                           == (0 == buildReferenceIndex(&expected, text)));
+            ASSERTV(ti, text, expected == index);
+        }
+
+        if (verbose) cout << "\tDocuments spanning several chunks." << endl;
+
+        for (bsl::size_t length = 1; length < 1000 * 1000; length *= 7) {
+            makeDocument(&text, length);
+
+            ASSERTV(length, 0 == Obj::buildIndex(&index, text));
+            ASSERTV(length, 0 == buildReferenceIndex(&expected, text));
+            ASSERTV(length, expected == index);
+
+            // Unterminated string at the end.
+
+            text.append("\"");
+
+            ASSERTV(length, 0 != Obj::buildIndex(&index, text));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING `buildIndex`
+        //
+        // Concerns:
+        // 1. Structural characters, the quotes of strings, and the first
+        //    character of literals and numbers are indexed, and nothing else.
+        //
+        // 2. Characters inside strings, including escaped quotes and
+        //    structural characters, are not indexed, and an escaped
+        //    backslash does not escape the following quote.
+        //
+        // 3. An unterminated string, an unescaped control character in a
+        //    string, and invalid UTF-8 are reported, but control characters
+        //    outside of strings (which are white space, or part of a literal)
+        //    are not.
+        //
+        // 4. Previous contents of the index are discarded.
+        //
+        // 5. No memory is allocated from the default allocator.
+        //
+        // Plan:
+        // 1. Using the table-driven technique, specify a set of texts with
+        //    the expected status and, on success, the expected characters at
+        //    the indexed positions, written as a string in which `.` stands
+        //    for the first character of a literal or number.  Verify that
+        //    `buildIndex` agrees with the table and with
+        //    `buildReferenceIndex`.  (C-1..3)
+        //
+        // 2. Call `buildIndex` with an index having previous contents.  (C-4)
+        //
+        // 3. Supply an object allocator to the index, and verify that the
+        //    default allocator is not used.  (C-5)
+        //
+        // Testing:
+        //   int buildIndex(bsl::vector<Offset> *, const bsl::string_view&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING `buildIndex`" << endl
+                          << "====================" << endl;
+
+        static const struct {
+            int         d_line;      // source line number
+            const char *d_input_p;   // text to index
+            bool        d_isValid;   // expected success
+            const char *d_expected;  // indexed characters ('.' for literals)
+        } DATA[] = {
+            //LINE  INPUT                         VALID  EXPECTED
+            //----  ----------------------------  -----  ----------------
+            { L_,   "",                           true,  ""               },
+            { L_,   "   \t\n\r ",                 true,  ""               },
+            { L_,   "{}",                         true,  "{}"             },
+            { L_,   "[ ]",                        true,  "[]"             },
+            { L_,   "1",                          true,  "."              },
+            { L_,   " true ",                     true,  "."              },
+            { L_,   "[1,22, 333 ,4444]",          true,  "[.,.,.,.]"      },
+            { L_,   "nul l",                      true,  ".."             },
+            { L_,   "\"\"",                       true,  "\"\""           },
+            { L_,   "\"a:b,c{}[]\"",              true,  "\"\""           },
+            { L_,   "{\"a\":\"b\"}",              true,  "{\"\":\"\"}"    },
+            { L_,   "\"\\\"\"",                   true,  "\"\""           },
+            { L_,   "\"\\\\\"",                   true,  "\"\""           },
+            { L_,   "\"\\\\\\\"\"",               true,  "\"\""           },
+            { L_,   "\"\\\\\" ,",                 true,  "\"\","          },
+            { L_,   "\"a\"\"b\"",                 true,  "\"\"\"\""       },
+            { L_,   "1\"a\"2",                    true,  ".\"\"."         },
+            { L_,   "a\\\"b",                     true,  "."              },
+            { L_,   "\x01 \x7f",                  true,  ".."             },
+            { L_,   "\"\xC3\xA9\"",               true,  "\"\""           },
+            { L_,   "\"",                         false, ""               },
+            { L_,   "\"\\\"",                     false, ""               },
+            { L_,   "\"a\" \"",                   false, ""               },
+            { L_,   "\"\t\"",                     false, ""               },
+            { L_,   "\"\n\"",                     false, ""               },
+            { L_,   "\"\x1f\"",                   false, ""               },
+            { L_,   "\"\xC3\"",                   false, ""               },
+            { L_,   "\xFF",                       false, ""               },
+            { L_,   "\"\xED\xA0\x80\"",           false, ""               },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        bsl::vector<Offset> index(&oa);
+        bsl::vector<Offset> expected(&oa);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const char *const INPUT    = DATA[ti].d_input_p;
+            const bool        IS_VALID = DATA[ti].d_isValid;
+            const char *const EXPECTED = DATA[ti].d_expected;
+
+            if (veryVerbose) { T_ P_(LINE) P_(INPUT) P_(IS_VALID) P(EXPECTED) }
+
+            const bsl::string_view TEXT(INPUT);
+
+            // Leave previous contents in the index.
+
+            index.assign(3, 7);
+
+            const int RC = Obj::buildIndex(&index, TEXT);
+
+            ASSERTV(LINE, RC, IS_VALID == (0 == RC));
+            ASSERTV(LINE, IS_VALID == (0 == buildReferenceIndex(&expected,
+                                                                TEXT)));
+
+            if (IS_VALID && 0 == RC) {
+                ASSERTV(LINE, index.size(), bsl::strlen(EXPECTED),
+                        bsl::strlen(EXPECTED) == index.size());
+                ASSERTV(LINE, expected == index);
+
+                for (bsl::size_t i = 0; i < index.size(); ++i) {
+                    const char C = '.' == EXPECTED[i]
+                                 ? TEXT[index[i]]
+                                 : EXPECTED[i];
+
+                    ASSERTV(LINE, i, TEXT[index[i]], C == TEXT[index[i]]);
+                    if ('.' == EXPECTED[i]) {
+                        ASSERTV(LINE, i, 0 == bsl::strchr("{}[]:,\" \t\n\r",
+                                                          TEXT[index[i]]));
+                    }
+                }
+            }
+        }
+
+        ASSERTV(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Index a small document and verify the result.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        const bsl::string_view TEXT = "{ \"key\": [null, \"v\"] }";
+
+        bsl::vector<Offset> index;
+
+        ASSERT(0 == Obj::buildIndex(&index, TEXT));
+
+        const Offset EXPECTED[] = { 0, 2, 6, 7, 9, 10, 14, 16, 18, 19, 21 };
+        const bsl::size_t NUM_EXPECTED = sizeof EXPECTED / sizeof *EXPECTED;
+
+        ASSERTV(index.size(), NUM_EXPECTED == index.size());
+        for (bsl::size_t i = 0; i < NUM_EXPECTED && i < index.size(); ++i) {
+            ASSERTV(i, index[i], EXPECTED[i] == index[i]);
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        // 1. `buildIndex` processes text at a rate comparable to the memory
+        //    bandwidth.
+        //
+        // Plan:
+        // 1. Index a large document repeatedly, and report the throughput of
+        //    `buildIndex` and of `buildReferenceIndex`.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        bsl::string text;
+        makeDocument(&text, 64 * 1024 * 1024);
+
+        bsl::vector<Offset> index;
+
+        const int NUM_ITERATIONS = 5;
+
+        bsls::Stopwatch sw;
+        sw.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            ASSERT(0 == Obj::buildIndex(&index, text));
+        }
+        sw.stop();
+
+        const double MEGABYTES = static_cast<double>(text.length()) *
+                                            NUM_ITERATIONS / (1024.0 * 1024.0);
+
+        cout << "buildIndex:          " << MEGABYTES / sw.elapsedTime()
+             << " MB/s (" << index.size() << " positions)" << endl;
+
+        sw.reset();
+        sw.start();
+        for (int i = 0; i < NUM_ITERATIONS; ++i) {
+            ASSERT(0 == buildReferenceIndex(&index, text));
+        }
+        sw.stop();
+
+        cout << "buildReferenceIndex: " << MEGABYTES / sw.elapsedTime()
+             << " MB/s" << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
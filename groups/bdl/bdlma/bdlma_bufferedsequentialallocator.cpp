@@ -4,6 +4,9 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlma_bufferedsequentialallocator_cpp,"$Id$ $CSID$")
 
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+
 namespace BloombergLP {
 namespace bdlma {
 
@@ -11,6 +14,51 @@ namespace bdlma {
                     // class BufferedSequentialAllocator
                     // ---------------------------------
 
+// PRIVATE MANIPULATORS
+void *BufferedSequentialAllocator::allocateReusable(bsls::Types::size_type size)
+{
+    BSLS_ASSERT(d_blockReuseFlag);
+
+    if (0 == size) {
+        return 0;                                                     // RETURN
+    }
+
+    const int sizeClass = SizeClassFreeList::sizeClass(size);
+    if (0 > sizeClass) {
+        return d_pool.allocate(size);                                 // RETURN
+    }
+
+    void *result = d_freeList.allocate(sizeClass);
+    if (result) {
+        return result;                                                // RETURN
+    }
+
+    return d_pool.allocate(SizeClassFreeList::blockSize(sizeClass));
+}
+
+// PROTECTED MANIPULATORS
+void BufferedSequentialAllocator::do_deallocate(void        *address,
+                                                std::size_t  bytes,
+                                                std::size_t  alignment)
+{
+    // Zero-byte and over-aligned blocks are not dispensed directly by
+    // 'allocate', and are never reused.
+
+    if (d_blockReuseFlag
+     && 0 != bytes
+     && alignment <= bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT) {
+        // Account for the rounding of 'bytes' performed by
+        // 'bslma::Allocator::do_allocate' for alignments exceeding the
+        // natural alignment of 'bytes'.
+
+        const int sizeClass = SizeClassFreeList::sizeClass(
+                                  (bytes + alignment - 1) & ~(alignment - 1));
+        if (0 <= sizeClass) {
+            d_freeList.deallocate(address, sizeClass);
+        }
+    }
+}
+
 // CREATORS
 BufferedSequentialAllocator::~BufferedSequentialAllocator()
 {
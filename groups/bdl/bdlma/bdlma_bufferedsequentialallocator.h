@@ -22,8 +22,10 @@ BSLS_IDENT("$Id: $")
 // ( bdlma::BufferedSequentialAllocator )
 //  `----------------------------------'
 //                  |        ctor/dtor
+//                  |        expand
 //                  |        rewind
-//                  |
+//                  |        setBlockReuse
+//                  |        isBlockReuseEnabled
 //                  V
 //      ,-----------------------.
 //     ( bdlma::ManagedAllocator )
@@ -49,8 +51,8 @@ BSLS_IDENT("$Id: $")
 // `rewind` method releases all memory allocated through the allocator and
 // returns to the underlying allocator *only* memory that was allocated outside
 // of the typical internal buffer growth of the allocator (i.e., large blocks).
-// Note that individually allocated memory blocks cannot be separately
-// deallocated.
+// Note that, unless block reuse is enabled (see {Optional Block Reuse}),
+// individually allocated memory blocks cannot be separately deallocated.
 //
 // `bdlma::BufferedSequentialAllocator` is typically used when users have a
 // reasonable estimation of the amount of memory needed.  This amount of memory
@@ -92,6 +94,23 @@ BSLS_IDENT("$Id: $")
 // wasted depends on whether natural alignment, maximum alignment, or 1-byte
 // alignment is used (see `bsls_alignment` for more details).
 //
+///Optional Block Reuse
+///---------------------
+// As with `bdlma::SequentialAllocator`, calling `setBlockReuse(true)` (before
+// any memory is allocated, or following `release` or `rewind`) enables a mode
+// in which small allocation requests are rounded up to a power-of-two size
+// class, and blocks that are deallocated with their size (i.e., via the
+// `deallocate(address, bytes, alignment)` method inherited from
+// `bsl::memory_resource`, as `bsl::allocator` does) are retained on
+// per-size-class free lists (see `bdlma_sizeclassfreelist`) and reused to
+// satisfy subsequent allocations, whether the blocks came from the external
+// buffer or from a dynamically-allocated buffer.  This bounds the memory
+// consumed by long-lived allocators that supply containers whose capacity
+// repeatedly grows.  The `expand` method grows the most recently allocated
+// block in place when the buffer from which it was allocated has sufficient
+// remaining space.  Note that, while block reuse is enabled, a block whose
+// size was changed by `expand` must not be deallocated with its size.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -187,6 +206,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlma_bufferedsequentialpool.h>
 #include <bdlma_managedallocator.h>
+#include <bdlma_sizeclassfreelist.h>
 
 #include <bslma_allocator.h>
 
@@ -196,6 +216,8 @@ BSLS_IDENT("$Id: $")
 #include <bsls_performancehint.h>
 #include <bsls_types.h>
 
+#include <bsl_cstddef.h>
+
 namespace BloombergLP {
 namespace bdlma {
 
@@ -212,18 +234,50 @@ namespace bdlma {
 /// allocator is supplied, the currently installed default allocator is
 /// used.  This class is *exception* *neutral*: If memory cannot be
 /// allocated, the behavior is defined by the (optional) allocator supplied
-/// at construction.  Note that in no case will the buffered sequential
-/// allocator attempt to deallocate the external buffer.
+/// at construction.  Optionally, blocks deallocated with their size can be
+/// retained and reused (see {Optional Block Reuse}).  Note that in no case
+/// will the buffered sequential allocator attempt to deallocate the
+/// external buffer.
 class BufferedSequentialAllocator : public ManagedAllocator {
 
     // DATA
-    BufferedSequentialPool d_pool;  // manager for allocated memory blocks
+    BufferedSequentialPool d_pool;            // manager for allocated memory
+                                              // blocks
+
+    SizeClassFreeList      d_freeList;        // blocks available for reuse
+
+    bool                   d_blockReuseFlag;  // `true` if deallocated blocks
+                                              // are retained for reuse
 
   private:
     // NOT IMPLEMENTED
     BufferedSequentialAllocator(const BufferedSequentialAllocator&);
     BufferedSequentialAllocator& operator=(const BufferedSequentialAllocator&);
 
+    // PRIVATE MANIPULATORS
+
+    /// Return the address of a contiguous block of memory of at least the
+    /// specified `size` (in bytes), rounding `size` up to the block size of
+    /// its size class (if any) and reusing a retained block of that size
+    /// class if one is available.  If `size` is 0, no memory is allocated
+    /// and 0 is returned.  The behavior is undefined unless block reuse is
+    /// enabled.
+    void *allocateReusable(bsls::Types::size_type size);
+
+  protected:
+    // PROTECTED MANIPULATORS
+
+    /// Return the memory block at the specified `address`, having the
+    /// specified `bytes` and `alignment`, to this allocator.  If block
+    /// reuse is enabled, retain the block for reuse by subsequent
+    /// allocations; otherwise, this method has no effect.  The behavior is
+    /// undefined unless `address` was allocated from this allocator using
+    /// the same `bytes` and `alignment`, and has not already been
+    /// deallocated.
+    void do_deallocate(void        *address,
+                       std::size_t  bytes,
+                       std::size_t  alignment) BSLS_KEYWORD_OVERRIDE;
+
   public:
     // CREATORS
 
@@ -312,7 +366,9 @@ class BufferedSequentialAllocator : public ManagedAllocator {
     /// Return the address of a contiguous block of memory of the specified
     /// `size` (in bytes) according to the alignment strategy specified at
     /// construction.  If `size` is 0, no memory is allocated and 0 is
-    /// returned.  If the allocation request exceeds the remaining free
+    /// returned.  If block reuse is enabled and a previously deallocated
+    /// block of sufficient size is available, return that block.
+    /// Otherwise, if the allocation request exceeds the remaining free
     /// memory space in the external buffer supplied at construction, use
     /// memory obtained from the allocator supplied at construction.
     void *allocate(size_type size) BSLS_KEYWORD_OVERRIDE;
@@ -324,6 +380,22 @@ class BufferedSequentialAllocator : public ManagedAllocator {
     /// using `address` after this call is undefined.
     void deallocate(void *address) BSLS_KEYWORD_OVERRIDE;
 
+    /// Increase the amount of memory allocated at the specified `address`
+    /// from the specified `originalSize` (in bytes) to the specified
+    /// `newSize` (in bytes) in place.  Return `newSize` after expanding, or
+    /// `originalSize` if the memory block at `address` cannot be expanded
+    /// to `newSize`.  This method can only `expand` the memory block most
+    /// recently allocated from the external buffer or from the current
+    /// internal buffer, and only if that buffer has sufficient remaining
+    /// space, and otherwise has no effect.  The behavior is undefined
+    /// unless the memory block at `address` was originally allocated by
+    /// this allocator, the size of the memory block at `address` is
+    /// `originalSize`, `originalSize <= newSize`, and `release` was not
+    /// called after allocating the memory block at `address`.
+    bsls::Types::size_type expand(void                   *address,
+                                  bsls::Types::size_type  originalSize,
+                                  bsls::Types::size_type  newSize);
+
     /// Release all memory allocated through this allocator and return to
     /// the underlying allocator *all* memory except the external buffer
     /// supplied at construction.  The allocator is reset to its
@@ -345,10 +417,23 @@ class BufferedSequentialAllocator : public ManagedAllocator {
     /// call to `rewind` is undefined.
     virtual void rewind();
 
+    /// Enable the retention and reuse of deallocated blocks if the
+    /// specified `enabled` is `true`, and disable it otherwise (the
+    /// default).  When disabling block reuse, any blocks retained for
+    /// reuse are discarded.  The behavior is undefined unless this method
+    /// is called when no memory allocated from this allocator is in use
+    /// (e.g., following construction, `release`, or `rewind`).  See
+    /// {Optional Block Reuse}.
+    void setBlockReuse(bool enabled);
+
     // ACCESSORS
 
     /// Return the allocator passed at construction.
     bslma::Allocator *allocator() const;
+
+    /// Return `true` if deallocated blocks are retained for reuse by this
+    /// allocator, and `false` otherwise.
+    bool isBlockReuseEnabled() const;
 };
 
 // ============================================================================
@@ -366,6 +451,7 @@ BufferedSequentialAllocator::BufferedSequentialAllocator(
                                         bsls::Types::size_type  size,
                                         bslma::Allocator       *basicAllocator)
 : d_pool(buffer, size, basicAllocator)
+, d_blockReuseFlag(false)
 {
 }
 
@@ -376,6 +462,7 @@ BufferedSequentialAllocator::BufferedSequentialAllocator(
                                    bsls::BlockGrowth::Strategy  growthStrategy,
                                    bslma::Allocator            *basicAllocator)
 : d_pool(buffer, size, growthStrategy, basicAllocator)
+, d_blockReuseFlag(false)
 {
 }
 
@@ -386,6 +473,7 @@ BufferedSequentialAllocator::BufferedSequentialAllocator(
                                   bsls::Alignment::Strategy  alignmentStrategy,
                                   bslma::Allocator          *basicAllocator)
 : d_pool(buffer, size, alignmentStrategy, basicAllocator)
+, d_blockReuseFlag(false)
 {
 }
 
@@ -397,6 +485,7 @@ BufferedSequentialAllocator::BufferedSequentialAllocator(
                                 bsls::Alignment::Strategy    alignmentStrategy,
                                 bslma::Allocator            *basicAllocator)
 : d_pool(buffer, size, growthStrategy, alignmentStrategy, basicAllocator)
+, d_blockReuseFlag(false)
 {
 }
 
@@ -407,6 +496,7 @@ BufferedSequentialAllocator::BufferedSequentialAllocator(
                                         bsls::Types::size_type  maxBufferSize,
                                         bslma::Allocator       *basicAllocator)
 : d_pool(buffer, size, maxBufferSize, basicAllocator)
+, d_blockReuseFlag(false)
 {
 }
 
@@ -418,6 +508,7 @@ BufferedSequentialAllocator::BufferedSequentialAllocator(
                                    bsls::BlockGrowth::Strategy  growthStrategy,
                                    bslma::Allocator            *basicAllocator)
 : d_pool(buffer, size, maxBufferSize, growthStrategy, basicAllocator)
+, d_blockReuseFlag(false)
 {
 }
 
@@ -429,6 +520,7 @@ BufferedSequentialAllocator::BufferedSequentialAllocator(
                                   bsls::Alignment::Strategy  alignmentStrategy,
                                   bslma::Allocator          *basicAllocator)
 : d_pool(buffer, size, maxBufferSize, alignmentStrategy, basicAllocator)
+, d_blockReuseFlag(false)
 {
 }
 
@@ -446,6 +538,7 @@ BufferedSequentialAllocator::BufferedSequentialAllocator(
          growthStrategy,
          alignmentStrategy,
          basicAllocator)
+, d_blockReuseFlag(false)
 {
 }
 
@@ -458,6 +551,11 @@ void *BufferedSequentialAllocator::allocate(size_type size)
         return 0;                                                     // RETURN
     }
 
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_blockReuseFlag)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return allocateReusable(size);                                // RETURN
+    }
+
     return d_pool.allocate(size);
 }
 
@@ -466,18 +564,38 @@ void BufferedSequentialAllocator::deallocate(void *)
 {
 }
 
+inline
+bsls::Types::size_type BufferedSequentialAllocator::expand(
+                                          void                   *address,
+                                          bsls::Types::size_type  originalSize,
+                                          bsls::Types::size_type  newSize)
+{
+    return d_pool.expand(address, originalSize, newSize);
+}
+
 inline
 void BufferedSequentialAllocator::release()
 {
+    d_freeList.reset();
     d_pool.release();
 }
 
 inline
 void BufferedSequentialAllocator::rewind()
 {
+    d_freeList.reset();
     d_pool.rewind();
 }
 
+inline
+void BufferedSequentialAllocator::setBlockReuse(bool enabled)
+{
+    if (!enabled) {
+        d_freeList.reset();
+    }
+    d_blockReuseFlag = enabled;
+}
+
 // ACCESSORS
 inline
 bslma::Allocator *BufferedSequentialAllocator::allocator() const
@@ -485,6 +603,12 @@ bslma::Allocator *BufferedSequentialAllocator::allocator() const
     return d_pool.allocator();
 }
 
+inline
+bool BufferedSequentialAllocator::isBlockReuseEnabled() const
+{
+    return d_blockReuseFlag;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -69,14 +69,18 @@ using namespace bsl;
 //
 // MANIPULATORS
 // [ 2] void *allocate(size_type size);
+// [ 7] size_type expand(void *addr, size_type orig, size_type newSize);
 // [ 3] void deallocate(void *address);
+// [ 7] void do_deallocate(void *address, size_t bytes, size_t align);
 // [ 4] void release();
+// [ 7] void setBlockReuse(bool enabled);
 //
 // ACCESSOR
 // [ 6] bslma::Allocator *allocator() const;
+// [ 7] bool isBlockReuseEnabled() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 7] USAGE TEST
+// [ 8] USAGE TEST
 
 //=============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -251,7 +255,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 7: {
+      case 8: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -334,6 +338,124 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // BLOCK REUSE AND `expand`
+        //
+        // Concerns:
+        // 1. By default, block reuse is disabled, and deallocated blocks are
+        //    never reused.
+        //
+        // 2. When block reuse is enabled, a block deallocated with its size
+        //    (via `bsl::memory_resource::deallocate`) is returned by a
+        //    subsequent allocation of up to the same size, whether the block
+        //    came from the external buffer or from dynamically allocated
+        //    memory.
+        //
+        // 3. Blocks deallocated via the single-argument `deallocate` are not
+        //    reused.
+        //
+        // 4. `release` and `rewind` discard all retained blocks.
+        //
+        // 5. `expand` grows the most recent allocation in place if the
+        //    current buffer has room, and otherwise has no effect.
+        //
+        // Plan:
+        // 1. Using an allocator supplied with an external buffer and a test
+        //    allocator, allocate and deallocate blocks through the
+        //    `bslma::Allocator` and `bsl::memory_resource` interfaces with
+        //    block reuse disabled and enabled, and verify the addresses
+        //    returned by subsequent allocations.  (C-1..4)
+        //
+        // 2. Invoke `expand` on the most recent and on an earlier allocation,
+        //    and verify the result and the address of a subsequent
+        //    allocation.  (C-5)
+        //
+        // Testing:
+        //   void do_deallocate(void *address, size_t bytes, size_t align);
+        //   size_type expand(void *addr, size_type orig, size_type newSize);
+        //   void setBlockReuse(bool enabled);
+        //   bool isBlockReuseEnabled() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BLOCK REUSE AND `expand`" << endl
+                                  << "========================" << endl;
+
+        char *buffer = bufferStorage.buffer();
+
+        if (verbose) cout << "\nTesting block reuse." << endl;
+        {
+            Obj mX(buffer, k_BUFFER_SIZE, &objectAllocator);
+            const Obj& X = mX;
+
+            bsl::memory_resource& mr = mX;
+
+            ASSERT(false == X.isBlockReuseEnabled());
+
+            void *p = mX.allocate(32);
+            mr.deallocate(p, 32, 16);
+            ASSERT(p != mX.allocate(32));
+
+            mX.release();
+            mX.setBlockReuse(true);
+            ASSERT(true  == X.isBlockReuseEnabled());
+
+            // Blocks from the external buffer are reused.
+
+            p = mX.allocate(32);
+            ASSERT(buffer == p);
+            mr.deallocate(p, 32, 16);
+            ASSERT(p == mX.allocate(20));
+
+            // Blocks from dynamically allocated memory are reused.
+
+            p = mX.allocate(2 * k_BUFFER_SIZE);
+            ASSERT(0 < objectAllocator.numBlocksInUse());
+            mr.deallocate(p, 2 * k_BUFFER_SIZE, 16);
+            ASSERT(p == mX.allocate(2 * k_BUFFER_SIZE - 1));
+
+            // Blocks deallocated without their size are not reused.
+
+            p = mX.allocate(32);
+            mX.deallocate(p);
+            ASSERT(p != mX.allocate(32));
+
+            // `release` and `rewind` discard retained blocks.
+
+            p = mX.allocate(64);
+            mr.deallocate(p, 64, 8);
+            mX.release();
+            ASSERT(true == X.isBlockReuseEnabled());
+            ASSERT(0 == objectAllocator.numBlocksInUse());
+            ASSERT(buffer == mX.allocate(8));
+
+            p = mX.allocate(64);
+            mr.deallocate(p, 64, 8);
+            mX.rewind();
+            ASSERT(buffer == mX.allocate(64));
+        }
+        ASSERT(0 == objectAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting `expand`." << endl;
+        {
+            Obj mX(buffer,
+                   k_BUFFER_SIZE,
+                   bsls::Alignment::BSLS_BYTEALIGNED,
+                   &objectAllocator);
+
+            char *p = static_cast<char *>(mX.allocate(8));
+            char *q = static_cast<char *>(mX.allocate(8));
+
+            ASSERT( 8 == mX.expand(p, 8, 16));
+            ASSERT(16 == mX.expand(q, 8, 16));
+            ASSERT(q + 16 == mX.allocate(1));
+
+            char *r = static_cast<char *>(mX.allocate(8));
+            ASSERT(8 == mX.expand(r, 8, 2 * k_BUFFER_SIZE));
+            ASSERT(r + 8 == mX.allocate(1));
+            ASSERT(0 == objectAllocator.numBlocksInUse());
+        }
+      } break;
       case 6: {
         // --------------------------------------------------------------------
         // TESTING ALLOCATOR ACCESSOR
@@ -497,6 +497,24 @@ class BufferedSequentialPool {
     template <class TYPE>
     void deleteObjectRaw(const TYPE *object);
 
+    /// Increase the amount of memory allocated at the specified `address`
+    /// from the specified `originalSize` (in bytes) to the specified
+    /// `newSize` (in bytes) in place.  Return `newSize` after expanding, or
+    /// `originalSize` if the memory block at `address` cannot be expanded
+    /// to `newSize`.  This method can only `expand` a memory block that
+    /// ends at the first unallocated byte of the external buffer supplied
+    /// at construction or of the current internal buffer (i.e., the block
+    /// returned by the most recent allocation from that buffer), and only
+    /// if that buffer has sufficient remaining space, and otherwise has no
+    /// effect.  The behavior is undefined unless the memory block at
+    /// `address` was originally allocated by this memory pool, the size of
+    /// the memory block at `address` is `originalSize`,
+    /// `originalSize <= newSize`, and `release` was not called after
+    /// allocating the memory block at `address`.
+    bsls::Types::size_type expand(void                   *address,
+                                  bsls::Types::size_type  originalSize,
+                                  bsls::Types::size_type  newSize);
+
     /// Release all memory allocated through this pool and return to the
     /// underlying allocator *all* memory except the external buffer
     /// supplied at construction.  The pool is reset to its
@@ -668,6 +686,24 @@ void BufferedSequentialPool::deleteObjectRaw(const TYPE *object)
     }
 }
 
+inline
+bsls::Types::size_type BufferedSequentialPool::expand(
+                                          void                   *address,
+                                          bsls::Types::size_type  originalSize,
+                                          bsls::Types::size_type  newSize)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(originalSize <= newSize);
+
+    const bsls::Types::size_type result =
+                       d_bufferManager.expand(address, originalSize, newSize);
+    if (result == newSize || false == d_sequentialPoolIsCreated) {
+        return result;                                                // RETURN
+    }
+
+    return d_pool_p->expand(address, originalSize, newSize);
+}
+
 inline
 void BufferedSequentialPool::release()
 {
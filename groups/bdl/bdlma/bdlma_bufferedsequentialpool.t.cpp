@@ -72,6 +72,7 @@ using namespace bsl;
 //
 // MANIPULATORS
 // [ 4] void *allocate(size_type size);
+// [11] size_type expand(void *address, size_type orig, size_type new);
 // [ 6] void deleteObjectRaw(const TYPE *object);
 // [ 6] void deleteObject(const TYPE *object);
 // [ 5] void release();
@@ -83,7 +84,7 @@ using namespace bsl;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] HELPER FUNCTION: `int blockSize(numBytes)`
-// [11] USAGE EXAMPLE
+// [12] USAGE EXAMPLE
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -502,7 +503,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 11: {
+      case 12: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -525,6 +526,92 @@ int main(int argc, char *argv[])
                           << "=============" << endl;
 
       } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // TESTING `expand`
+        //
+        // Concerns:
+        // 1. `expand` grows the most recently allocated block from the
+        //    external buffer in place, up to the end of the external buffer,
+        //    and returns `newSize`.
+        //
+        // 2. `expand` grows the most recently allocated block from the
+        //    internal sequential pool in place, up to the end of its current
+        //    buffer, and returns `newSize`.
+        //
+        // 3. `expand` leaves any other block, or a block that cannot grow
+        //    within its buffer, unchanged and returns `originalSize`.
+        //
+        // 4. `expand` never allocates memory.
+        //
+        // 5. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Using a byte-aligned pool supplied with an external buffer and a
+        //    test allocator, allocate a block from the external buffer and
+        //    verify that it can be expanded only within the external buffer.
+        //    (C-1, 3..4)
+        //
+        // 2. Allocate a block too large for the remaining external buffer,
+        //    and verify that it can be expanded only up to the end of the
+        //    initial buffer of the internal sequential pool.  (C-2..4)
+        //
+        // 3. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   size_type expand(void *address, size_type orig, size_type new);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING `expand`" << endl
+                                  << "================" << endl;
+
+        enum { k_SIZE = 64 };
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        char *buffer = u::bufferStorage.buffer();
+
+        {
+            Obj mX(buffer, k_SIZE, bsls::Alignment::BSLS_BYTEALIGNED, &ta);
+
+            if (verbose) cout << "\nExpanding within the external buffer."
+                              << endl;
+
+            char *p = static_cast<char *>(mX.allocate(8));
+            ASSERT(buffer == p);
+
+            ASSERT(16     == mX.expand(p, 8, 16));
+            ASSERT(16     == mX.expand(p, 16, 2 * k_SIZE));
+            ASSERT(0      == ta.numBlocksInUse());
+
+            if (verbose) cout << "\nExpanding within the internal pool."
+                              << endl;
+
+            char *q = static_cast<char *>(mX.allocate(k_SIZE - 4));
+            ASSERT(0      <  ta.numBlocksInUse());
+
+            const bsls::Types::Int64 NUM_BYTES = ta.numBytesInUse();
+
+            // The last block from the external buffer can still be
+            // expanded.
+
+            ASSERT(24     == mX.expand(p, 16, 24));
+            ASSERT(k_SIZE == mX.expand(q, k_SIZE - 4, k_SIZE));
+            ASSERT(k_SIZE == mX.expand(q, k_SIZE, k_SIZE + 1));
+
+            ASSERT(NUM_BYTES == ta.numBytesInUse());
+
+            if (verbose) cout << "\nNegative Testing." << endl;
+            {
+                bsls::AssertTestHandlerGuard hG;
+
+                ASSERT_FAIL(mX.expand(0, 8, 16));
+                ASSERT_FAIL(mX.expand(q, 16, 8));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
       case 10: {
         // --------------------------------------------------------------------
         // ALLOCATOR ACCESSOR TEST
@@ -33,6 +33,26 @@ bsls::Types::size_type BufferManager::expand(void                   *address,
     return size;
 }
 
+bsls::Types::size_type BufferManager::expand(
+                                          void                   *address,
+                                          bsls::Types::size_type  originalSize,
+                                          bsls::Types::size_type  newSize)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(originalSize <= newSize);
+    BSLS_ASSERT(0 <= d_cursor);
+    BSLS_ASSERT(static_cast<bsls::Types::size_type>(d_cursor) <= d_bufferSize);
+
+    if (d_buffer_p
+     && static_cast<char *>(address) + originalSize == d_buffer_p + d_cursor
+     && newSize - originalSize <= d_bufferSize - d_cursor) {
+        d_cursor += newSize - originalSize;
+        return newSize;                                               // RETURN
+    }
+
+    return originalSize;
+}
+
 bsls::Types::size_type BufferManager::truncate(
                                           void                   *address,
                                           bsls::Types::size_type  originalSize,
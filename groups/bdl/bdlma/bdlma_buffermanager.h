@@ -358,6 +358,23 @@ class BufferManager {
     /// the memory at `address`.
     bsls::Types::size_type expand(void *address, bsls::Types::size_type size);
 
+    /// Increase the amount of memory allocated at the specified `address`
+    /// from the specified `originalSize` (in bytes) to the specified
+    /// `newSize` (in bytes).  Return `newSize` after expanding, or
+    /// `originalSize` if the memory at `address` cannot be expanded to
+    /// `newSize`.  This method can only `expand` the memory block returned
+    /// by the most recent `allocate` or `allocateRaw` request from this
+    /// buffer manager, and only if the buffer has at least
+    /// `newSize - originalSize` bytes remaining, and otherwise has no
+    /// effect.  The behavior is undefined unless the memory at `address`
+    /// was originally allocated by this buffer manager, the size of the
+    /// memory at `address` is `originalSize`, `originalSize <= newSize`,
+    /// and `release` was not called after allocating the memory at
+    /// `address`.
+    bsls::Types::size_type expand(void                   *address,
+                                  bsls::Types::size_type  originalSize,
+                                  bsls::Types::size_type  newSize);
+
     /// Replace the buffer currently managed by this object with the
     /// specified `newBuffer` of the specified `newBufferSize` (in bytes);
     /// return the address of the previously held buffer, or 0 if this
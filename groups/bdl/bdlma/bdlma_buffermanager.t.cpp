@@ -59,6 +59,7 @@ using namespace bsl;
 // [ 8] void deleteObjectRaw(const TYPE *object);
 // [ 8] void deleteObject(const TYPE *object);
 // [ 9] int expand(void *address, int size);
+// [12] size_type expand(void *addr, size_type orig, size_type newSize);
 // [ 4] char *replaceBuffer(char *newBuffer, int newBufferSize);
 // [ 5] void release();
 // [ 6] void reset();
@@ -72,7 +73,7 @@ using namespace bsl;
 // [ 7] bool hasSufficientCapacity(int size) const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [12] USAGE EXAMPLE
+// [13] USAGE EXAMPLE
 
 //=============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -382,7 +383,7 @@ int main(int argc, char *argv[])
     bsls::ReviewFailureHandlerGuard reviewGuard(&bsls::Review::failByAbort);
 
     switch (test) { case 0:
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -413,6 +414,84 @@ int main(int argc, char *argv[])
         ASSERT(false == result);
 
       } break;
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING 3-ARGUMENT `expand`
+        //
+        // Concerns:
+        // 1. That `expand` grows the most recent allocation by exactly
+        //    `newSize - originalSize` bytes when the buffer has room, and
+        //    returns `newSize`.
+        //
+        // 2. That `expand` returns `originalSize` and has no effect if the
+        //    block is not the most recent allocation, or if the buffer does
+        //    not have `newSize - originalSize` bytes remaining.
+        //
+        // 3. That `expand` with `originalSize == newSize` succeeds trivially.
+        //
+        // 4. QoI: Asserted precondition violations are detected when
+        //    enabled.
+        //
+        // Plan:
+        // 1. Allocate two blocks and attempt to expand each, verifying the
+        //    return value, and the address of a subsequent allocation to
+        //    confirm the position of the internal cursor.  (C-1..3)
+        //
+        // 2. Verify that, in appropriate build modes, defensive checks are
+        //    triggered.  (C-4)
+        //
+        // Testing:
+        //   size_type expand(void *addr, size_type orig, size_type newSize);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING 3-ARGUMENT `expand`" << endl
+                                  << "===========================" << endl;
+
+        char *buffer = bufferStorage.buffer();
+
+        {
+            Obj mX(buffer, k_BUFFER_SIZE, bsls::Alignment::BSLS_BYTEALIGNED);
+
+            void *addr1 = mX.allocate(8);
+            void *addr2 = mX.allocate(8);
+            ASSERT(buffer     == addr1);
+            ASSERT(buffer + 8 == addr2);
+
+            // Not the most recent allocation.
+
+            ASSERT(8 == mX.expand(addr1, 8, 16));
+
+            // Most recent allocation.
+
+            ASSERT(32 == mX.expand(addr2, 8, 32));
+            ASSERT(buffer + 40 == mX.allocate(1));
+
+            // Block at the cursor, but insufficient room.
+
+            void *addr3 = mX.allocate(8);
+            ASSERT(buffer + 41 == addr3);
+
+            ASSERT(8 == mX.expand(addr3, 8, k_BUFFER_SIZE));
+            ASSERT(8 == mX.expand(addr3, 8, 8));
+
+            const int REST = k_BUFFER_SIZE - 41;
+            ASSERT(REST == static_cast<int>(mX.expand(addr3, 8, REST)));
+            ASSERT(0 == mX.allocate(1));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX(buffer, k_BUFFER_SIZE);
+
+            void *addr = mX.allocate(4);
+
+            ASSERT_PASS(mX.expand(addr, 4, 4));
+            ASSERT_FAIL(mX.expand(   0, 4, 8));
+            ASSERT_FAIL(mX.expand(addr, 8, 4));
+        }
+      } break;
       case 11: {
         // -------------------------------------------------------------------
         // TESTING `calculateAlignmentOffsetFromSize`
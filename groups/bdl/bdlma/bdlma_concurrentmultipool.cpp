@@ -375,6 +375,32 @@ void ConcurrentMultipool::reserveCapacity(bsls::Types::size_type size,
     }
 }
 
+bsls::Types::size_type ConcurrentMultipool::trim()
+{
+    bsls::Types::size_type numBytes = 0;
+    for (int i = 0; i < d_numPools; ++i) {
+        numBytes += d_pools_p[i].trim();
+    }
+    return numBytes;
+}
+
+// ACCESSORS
+bsls::Types::Int64 ConcurrentMultipool::numBlocksFree(int poolIndex) const
+{
+    BSLS_ASSERT(0 <= poolIndex);
+    BSLS_ASSERT(poolIndex < d_numPools);
+
+    return d_pools_p[poolIndex].numBlocksFree();
+}
+
+bsls::Types::Int64 ConcurrentMultipool::numBlocksTotal(int poolIndex) const
+{
+    BSLS_ASSERT(0 <= poolIndex);
+    BSLS_ASSERT(poolIndex < d_numPools);
+
+    return d_pools_p[poolIndex].numBlocksTotal();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -50,7 +50,28 @@ BSLS_IDENT("$Id: $")
 ///Thread Safety
 ///-------------
 // `bdlma::ConcurrentMultipool` is *fully thread-safe*, meaning any operation
-// on the same object can be safely invoked from any thread.
+// on the same object can be safely invoked from any thread, with the
+// exception of `trim` and `numBlocksFree` (see {Returning Unused Memory}).
+//
+///Returning Unused Memory
+///-----------------------
+// Memory deallocated to a `bdlma::ConcurrentMultipool` is retained by the
+// internal pool that dispensed it.  A long-running client whose demand
+// fluctuates can call `trim`, which invokes `bdlma::ConcurrentPool::trim` on
+// every internal pool, returning to the underlying allocator each chunk none
+// of whose blocks is currently allocated, and advising the operating system
+// (where supported) that the whole pages spanned by the remaining free blocks
+// are unneeded.  The occupancy of each size class can be inspected via
+// `numBlocksTotal` and `numBlocksFree`, which take the index of an internal
+// pool; the pool at index `i` dispenses blocks of `2^(i+3)` bytes.
+//
+// Since the internal pools allocate without locking, `trim` and
+// `numBlocksFree` may be called concurrently with `deallocate`, but must not
+// be called while another thread may be allocating from (or releasing) the
+// multipool.  A client wishing to trim memory in the background should
+// therefore schedule calls to `trim` (e.g., with `bdlmt::EventScheduler`) at
+// points where the threads that allocate from the multipool are known to be
+// idle.
 //
 ///Configuration at Construction
 ///-----------------------------
@@ -710,8 +731,32 @@ class ConcurrentMultipool {
     /// `size <= maxPooledBlockSize()` and `0 <= numBlocks`.
     void reserveCapacity(bsls::Types::size_type size, int numBlocks);
 
+    /// Return to the underlying allocator every chunk of every pool managed
+    /// by this multipool none of whose blocks is currently allocated, and
+    /// advise the operating system that the whole pages spanned by the
+    /// remaining free blocks are unneeded.  Return the number of bytes
+    /// returned to the underlying allocator.  Memory currently allocated
+    /// from this multipool is not affected.  The behavior is undefined if
+    /// this method is called while another thread invokes any manipulator
+    /// of this multipool other than `deallocate`.  See
+    /// `bdlma::ConcurrentPool::trim`.
+    bsls::Types::size_type trim();
+
     // ACCESSORS
 
+    /// Return the number of blocks that are available for allocation from
+    /// the pool at the specified `poolIndex` without replenishing it.  The
+    /// behavior is undefined unless `0 <= poolIndex < numPools()`, or if
+    /// this method is called while another thread invokes any manipulator
+    /// of this multipool other than `deallocate`.  Note that the pool at
+    /// `poolIndex` dispenses blocks of `2^(poolIndex + 3)` bytes.
+    bsls::Types::Int64 numBlocksFree(int poolIndex) const;
+
+    /// Return the total number of blocks in all of the chunks currently
+    /// held by the pool at the specified `poolIndex`, whether allocated or
+    /// free.  The behavior is undefined unless `0 <= poolIndex < numPools()`.
+    bsls::Types::Int64 numBlocksTotal(int poolIndex) const;
+
     /// Return the number of pools managed by this multipool object.
     int numPools() const;
 
@@ -426,6 +426,14 @@ class ConcurrentMultipoolAllocator : public bdlma::ManagedAllocator {
     /// `size <= maxPooledBlockSize()` and `0 <= numObjects`.
     void reserveCapacity(bsls::Types::size_type size, int numObjects);
 
+    /// Return to the underlying allocator all memory held by this allocator
+    /// that is not currently allocated, and return the number of bytes so
+    /// returned.  Memory currently allocated from this allocator is not
+    /// affected.  The behavior is undefined if this method is called while
+    /// another thread invokes any manipulator of this allocator other than
+    /// `deallocate`.  See `bdlma::ConcurrentMultipool::trim`.
+    bsls::Types::size_type trim();
+
                                 // Virtual Functions
 
     /// Return the address of a contiguous block of maximally aligned memory
@@ -448,6 +456,19 @@ class ConcurrentMultipoolAllocator : public bdlma::ManagedAllocator {
 
     // ACCESSORS
 
+    /// Return the number of blocks that are available for allocation from
+    /// the pool at the specified `poolIndex` without replenishing it.  The
+    /// behavior is undefined unless `0 <= poolIndex < numPools()`, or if
+    /// this method is called while another thread invokes any manipulator
+    /// of this allocator other than `deallocate`.  Note that the pool at
+    /// `poolIndex` dispenses blocks of `2^(poolIndex + 3)` bytes.
+    bsls::Types::Int64 numBlocksFree(int poolIndex) const;
+
+    /// Return the total number of blocks in all of the chunks currently
+    /// held by the pool at the specified `poolIndex`, whether allocated or
+    /// free.  The behavior is undefined unless `0 <= poolIndex < numPools()`.
+    bsls::Types::Int64 numBlocksTotal(int poolIndex) const;
+
     /// Return the number of pools managed by this multipool allocator.
     int numPools() const;
 
@@ -563,7 +584,27 @@ void ConcurrentMultipoolAllocator::reserveCapacity(
     d_multipool.reserveCapacity(size, numObjects);
 }
 
+inline
+bsls::Types::size_type ConcurrentMultipoolAllocator::trim()
+{
+    return d_multipool.trim();
+}
+
 // ACCESSORS
+inline
+bsls::Types::Int64
+ConcurrentMultipoolAllocator::numBlocksFree(int poolIndex) const
+{
+    return d_multipool.numBlocksFree(poolIndex);
+}
+
+inline
+bsls::Types::Int64
+ConcurrentMultipoolAllocator::numBlocksTotal(int poolIndex) const
+{
+    return d_multipool.numBlocksTotal(poolIndex);
+}
+
 inline
 int ConcurrentMultipoolAllocator::numPools() const
 {
@@ -4,8 +4,12 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlma_concurrentpool_cpp,"$Id$ $CSID$")
 
+#include <bdlma_freelistutil.h>
+
 #include <bslmt_lockguard.h>
 
+#include <bslma_default.h>
+
 #include <bsls_alignmentutil.h>
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
@@ -88,23 +92,22 @@ bsls::Types::size_type computeInternalBlockSize(
 }
 
 /// Append to the specified `nextList`, `numBlocks` free memory blocks each
-/// having the specified `blockSize`, using memory provided by the specified
-/// `blockList`.  The behavior is undefined unless `1 <= blockSize` and
-/// `1 <= numBlocks`.
+/// having the specified `blockSize`, using the memory starting at the
+/// specified `start`.  The behavior is undefined unless `start` is maximally
+/// aligned and refers to at least `numBlocks * blockSize` bytes of unused
+/// memory, `1 <= blockSize`, and `1 <= numBlocks`.
 static
-void replenishImp(bsls::AtomicPointer<LLink>       *nextList,
-                  bdlma::InfrequentDeleteBlockList *blockList,
-                  bsls::Types::size_type            blockSize,
-                  int                               numBlocks)
+void replenishImp(bsls::AtomicPointer<LLink> *nextList,
+                  char                       *start,
+                  bsls::Types::size_type      blockSize,
+                  int                         numBlocks)
 {
     using namespace BloombergLP;
 
-    BSLS_ASSERT(blockList);
+    BSLS_ASSERT(start);
     BSLS_ASSERT(1 <= blockSize);
     BSLS_ASSERT(1 <= numBlocks);
 
-    char  *start = static_cast<char *>(
-                                  blockList->allocate(numBlocks * blockSize));
     char  *end   = start + (numBlocks - 1) * blockSize;
     for (char *p = start; p < end; p += blockSize) {
         LLink *nextLink = toLink(p);
@@ -127,10 +130,27 @@ namespace bdlma {
                            // --------------------
 
 // PRIVATE MANIPULATORS
+char *ConcurrentPool::allocateChunk(int numBlocks)
+{
+    BSLS_ASSERT(1 <= numBlocks);
+
+    const bsls::Types::size_type size = k_CHUNK_HEADER_SIZE
+                                      + numBlocks * d_internalBlockSize;
+
+    Chunk *chunk = static_cast<Chunk *>(d_allocator_p->allocate(size));
+
+    chunk->d_next_p    = d_chunkList_p;
+    chunk->d_numBlocks = numBlocks;
+    d_chunkList_p      = chunk;
+    d_numBlocksTotal.addRelaxed(numBlocks);
+
+    return reinterpret_cast<char *>(chunk) + k_CHUNK_HEADER_SIZE;
+}
+
 void ConcurrentPool::replenish()
 {
     replenishImp(reinterpret_cast<bsls::AtomicPointer<LLink> *>(&d_freeList),
-                 &d_blockList,
+                 allocateChunk(d_chunkSize),
                  d_internalBlockSize,
                  d_chunkSize);
 
@@ -154,7 +174,9 @@ ConcurrentPool::ConcurrentPool(bsls::Types::size_type  blockSize,
 , d_maxBlocksPerChunk(k_MAX_CHUNK_SIZE)
 , d_growthStrategy(bsls::BlockGrowth::BSLS_GEOMETRIC)
 , d_freeList(0)
-, d_blockList(basicAllocator)
+, d_chunkList_p(0)
+, d_numBlocksTotal(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     BSLS_ASSERT(1 <= blockSize);
 
@@ -170,7 +192,9 @@ ConcurrentPool::ConcurrentPool(bsls::Types::size_type       blockSize,
 , d_maxBlocksPerChunk(k_MAX_CHUNK_SIZE)
 , d_growthStrategy(growthStrategy)
 , d_freeList(0)
-, d_blockList(basicAllocator)
+, d_chunkList_p(0)
+, d_numBlocksTotal(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     BSLS_ASSERT(1 <= blockSize);
 
@@ -187,7 +211,9 @@ ConcurrentPool::ConcurrentPool(bsls::Types::size_type       blockSize,
 , d_maxBlocksPerChunk(maxBlocksPerChunk)
 , d_growthStrategy(growthStrategy)
 , d_freeList(0)
-, d_blockList(basicAllocator)
+, d_chunkList_p(0)
+, d_numBlocksTotal(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
     BSLS_ASSERT(1 <= blockSize);
     BSLS_ASSERT(1 <= maxBlocksPerChunk);
@@ -199,6 +225,8 @@ ConcurrentPool::~ConcurrentPool()
 {
     BSLS_ASSERT(static_cast<int>(sizeof(LLink)) <= d_internalBlockSize);
     BSLS_ASSERT(0 != d_chunkSize);
+
+    release();
 }
 
 // MANIPULATORS
@@ -333,6 +361,19 @@ void ConcurrentPool::deallocate(void *address)
     }
 }
 
+void ConcurrentPool::release()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_freeList = static_cast<Link *>(0);
+    while (d_chunkList_p) {
+        Chunk *chunk  = d_chunkList_p;
+        d_chunkList_p = chunk->d_next_p;
+        d_allocator_p->deallocate(chunk);
+    }
+    d_numBlocksTotal = 0;
+}
+
 void ConcurrentPool::reserveCapacity(int numBlocks)
 {
     BSLS_ASSERT(0 <= numBlocks);
@@ -360,12 +401,114 @@ void ConcurrentPool::reserveCapacity(int numBlocks)
     if (numBlocks > 0) {
         replenishImp(
                    reinterpret_cast<bsls::AtomicPointer<LLink> *>(&d_freeList),
-                   &d_blockList,
+                   allocateChunk(numBlocks),
                    d_internalBlockSize,
                    numBlocks);
     }
 }
 
+bsls::Types::size_type ConcurrentPool::trim()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    // Take the whole free list; blocks deallocated concurrently are pushed
+    // onto the (now empty) free list, and are not considered.  With both the
+    // free blocks and the chunks in address order, a single merge-like pass
+    // counts the free blocks of each chunk.
+
+    Link  *p     = FreeListUtil::sortByAddress(d_freeList.swap(0));
+    Chunk *chunk = FreeListUtil::sortByAddress(d_chunkList_p);
+
+    d_chunkList_p = chunk;
+
+    const bsls::Types::size_type page         = FreeListUtil::pageSize();
+    const bool                   adviseBlocks = 0 < page
+                                             && page < d_internalBlockSize;
+
+    bsls::Types::size_type  numBytes  = 0;
+    Link                   *list      = 0;
+    Link                   *freeTail  = 0;
+    Chunk                  *prevChunk = 0;
+
+    while (chunk) {
+        Chunk      *nextChunk = chunk->d_next_p;
+        const char *end       = reinterpret_cast<char *>(chunk)
+                              + k_CHUNK_HEADER_SIZE
+                              + chunk->d_numBlocks * d_internalBlockSize;
+
+        Link *first     = p;
+        Link *last      = 0;
+        int   numBlocks = 0;
+        while (p && static_cast<char *>(static_cast<void *>(p)) < end) {
+            ++numBlocks;
+            last = p;
+            p    = p->d_next_p;
+        }
+
+        if (numBlocks == chunk->d_numBlocks) {
+            if (prevChunk) {
+                prevChunk->d_next_p = nextChunk;
+            }
+            else {
+                d_chunkList_p = nextChunk;
+            }
+            d_numBlocksTotal.addRelaxed(-numBlocks);
+            numBytes += k_CHUNK_HEADER_SIZE + numBlocks * d_internalBlockSize;
+            d_allocator_p->deallocate(chunk);
+        }
+        else {
+            if (numBlocks) {
+                if (freeTail) {
+                    freeTail->d_next_p = first;
+                }
+                else {
+                    list = first;
+                }
+                freeTail = last;
+
+                if (adviseBlocks) {
+                    // The link (including the reference count) of each free
+                    // block must be preserved.
+
+                    for (Link *q = first; q != p; q = q->d_next_p) {
+                        char *block = static_cast<char *>(
+                                                   static_cast<void *>(q));
+                        FreeListUtil::adviseUnneeded(
+                                                  block + sizeof(Link),
+                                                  block + d_internalBlockSize);
+                    }
+                }
+            }
+            prevChunk = chunk;
+        }
+        chunk = nextChunk;
+    }
+
+    BSLS_ASSERT(0 == p);
+
+    if (freeTail) {
+        Link *old;
+        do {
+            old                = d_freeList;
+            freeTail->d_next_p = old;
+        } while (old != d_freeList.testAndSwap(old, list));
+    }
+
+    return numBytes;
+}
+
+// ACCESSORS
+bsls::Types::Int64 ConcurrentPool::numBlocksFree() const
+{
+    bsls::Types::Int64 numBlocks = 0;
+
+    for (const Link *p = d_freeList.loadAcquire(); p; p = p->d_next_p) {
+        ++numBlocks;
+    }
+
+    return numBlocks;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
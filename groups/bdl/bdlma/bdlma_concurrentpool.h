@@ -38,6 +38,25 @@ BSLS_IDENT("$Id: $")
 // strategy and maximum blocks per chunk, either of which can be optionally
 // specified at construction (see the "Configuration at Construction" section).
 //
+///Returning Unused Memory
+///-----------------------
+// A `bdlma::ConcurrentPool` never returns a chunk to the underlying allocator
+// on its own accord.  A long-running client whose demand for blocks
+// fluctuates can call `trim`, which returns to the underlying allocator every
+// chunk none of whose blocks is currently allocated, and, on platforms that
+// support `madvise`, advises the operating system that the whole pages
+// spanned by the remaining free blocks are not needed.  The `numBlocksTotal`
+// and `numBlocksFree` accessors report the occupancy of the pool.
+//
+// Note that `allocate` is lock-free: a thread that is allocating may still
+// hold the address of a free block after that block has been removed from the
+// free list, and would access a chunk that `trim` had returned to the
+// underlying allocator.  Therefore, `trim` and `numBlocksFree` must not be
+// called while another thread may be calling `allocate` (or any other
+// manipulator except `deallocate`) on the same pool.  A typical client calls
+// them when the threads using the pool are known to be idle, e.g., between
+// the phases of a batch computation.
+//
 ///Configuration at Construction
 ///-----------------------------
 // When creating a `bdlma::ConcurrentPool`, clients must specify the specific
@@ -253,8 +272,6 @@ BSLS_IDENT("$Id: $")
 
 #include <bslmt_mutex.h>
 
-#include <bdlma_infrequentdeleteblocklist.h>
-
 #include <bslma_allocator.h>
 #include <bslma_deleterhelper.h>
 
@@ -301,6 +318,26 @@ class ConcurrentPool {
         Link  *volatile d_next_p;   // pointer to next link
     };
 
+    /// This `struct` overlays the beginning of each chunk of memory obtained
+    /// from the underlying allocator, and is used to implement the internal
+    /// linked list of chunks owned by this pool.  The blocks of a chunk
+    /// start `k_CHUNK_HEADER_SIZE` bytes past its beginning.
+    struct Chunk {
+
+        Chunk *d_next_p;     // pointer to next chunk
+
+        int    d_numBlocks;  // number of blocks in this chunk
+    };
+
+    enum {
+        // size (in bytes) of the header of each chunk, which preserves the
+        // maximal alignment of the blocks that follow it
+
+        k_CHUNK_HEADER_SIZE =
+                  (sizeof(Chunk) + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1)
+                & ~(bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1)
+    };
+
     // DATA
     bsls::Types::size_type d_blockSize;  // size of each allocated memory block
                                          // returned to client
@@ -323,13 +360,24 @@ class ConcurrentPool {
     bsls::AtomicPointer<Link> d_freeList;
                                          // linked list of free memory blocks
 
-    bdlma::InfrequentDeleteBlockList d_blockList;
-                                         // memory manager for allocated memory
+    Chunk            *d_chunkList_p;     // linked list of chunks owned by
+                                         // this pool
+
+    bsls::AtomicInt64 d_numBlocksTotal;  // number of blocks in all chunks
+
+    bslma::Allocator *d_allocator_p;     // memory allocator (held, not
+                                         // owned)
 
-    bslmt::Mutex      d_mutex;           // protects access to the block list
+    bslmt::Mutex      d_mutex;           // protects access to the chunk list
 
     // PRIVATE MANIPULATORS
 
+    /// Return the address of the first block of a newly allocated chunk
+    /// holding the specified `numBlocks` blocks, and add the chunk to the
+    /// list of chunks owned by this pool.  The behavior is undefined unless
+    /// `1 <= numBlocks` and the calling thread has a lock on `d_mutex`.
+    char *allocateChunk(int numBlocks);
+
     /// Dynamically allocate a new chunk using the pool's underlying growth
     /// strategy, and use the chunk to replenish the free memory list of
     /// this pool.  The behavior is undefined unless the calling thread has
@@ -412,6 +460,18 @@ class ConcurrentPool {
     /// behavior is undefined unless `0 <= numBlocks`.
     void reserveCapacity(int numBlocks);
 
+    /// Return to the underlying allocator every chunk of memory held by this
+    /// pool none of whose blocks is currently allocated, and return the
+    /// number of bytes so released.  Additionally, on platforms that support
+    /// it, advise the operating system that the whole pages spanned by the
+    /// free blocks that remain in this pool are not needed.  Blocks that are
+    /// currently allocated are not affected.  This method may be called
+    /// concurrently with `deallocate`, but the behavior is undefined if any
+    /// other manipulator of this pool is called concurrently with it.  Note
+    /// that this method takes time proportional to `N * log(N)`, where `N`
+    /// is the number of free blocks.  See {Returning Unused Memory}.
+    bsls::Types::size_type trim();
+
     // ACCESSORS
 
     /// Return the size (in bytes) of the memory blocks allocated from this
@@ -419,6 +479,18 @@ class ConcurrentPool {
     /// same size.
     bsls::Types::size_type blockSize() const;
 
+    /// Return the number of blocks that are available for allocation from
+    /// this pool without replenishing.  This method may be called
+    /// concurrently with `deallocate`, but the behavior is undefined if any
+    /// manipulator of this pool other than `deallocate` is called
+    /// concurrently with it.  Note that this method takes time proportional
+    /// to the number of free blocks.
+    bsls::Types::Int64 numBlocksFree() const;
+
+    /// Return the number of blocks, allocated or free, in all of the chunks
+    /// currently held by this pool.
+    bsls::Types::Int64 numBlocksTotal() const;
+
                                   // Aspects
 
     /// Return the allocator used by this object to allocate memory.  Note
@@ -524,20 +596,17 @@ void ConcurrentPool::deleteObjectRaw(const TYPE *object)
     bslma::DeleterHelper::deleteObjectRaw(object, this);
 }
 
+// ACCESSORS
 inline
-void ConcurrentPool::release()
+bsls::Types::size_type ConcurrentPool::blockSize() const
 {
-    d_mutex.lock();
-    d_freeList = (Link*)0;
-    d_blockList.release();
-    d_mutex.unlock();
+    return d_blockSize;
 }
 
-// ACCESSORS
 inline
-bsls::Types::size_type ConcurrentPool::blockSize() const
+bsls::Types::Int64 ConcurrentPool::numBlocksTotal() const
 {
-    return d_blockSize;
+    return d_numBlocksTotal.loadRelaxed();
 }
 
 // Aspects
@@ -545,7 +614,7 @@ bsls::Types::size_type ConcurrentPool::blockSize() const
 inline
 bslma::Allocator *ConcurrentPool::allocator() const
 {
-    return d_blockList.allocator();
+    return d_allocator_p;
 }
 
 }  // close package namespace
@@ -21,6 +21,7 @@
 #include <bsls_types.h>
 
 #include <bsl_cmath.h>       // `log`
+#include <bsl_cstddef.h>     // `offsetof`
 #include <bsl_cstdlib.h>     // `atoi`
 #include <bsl_cstring.h>     // `memcpy`
 #include <bsl_new.h>         // `bad_alloc`
@@ -77,10 +78,13 @@ using namespace bsl;  // automatically added by script
 // [10] void deleteObjectRaw(const TYPE *object);
 // [ 7] void release();
 // [ 8] void reserveCapacity(int numObjects);
+// [17] bsls::Types::size_type trim();
 // [ 9] template<typename TYPE> void deleteObject(TYPE *object)
 // [13] bslma::Allocator *allocator() const;
+// [17] bsls::Types::Int64 numBlocksFree() const;
+// [17] bsls::Types::Int64 numBlocksTotal() const;
 //-----------------------------------------------------------------------------
-// [17] USAGE EXAMPLE
+// [18] USAGE EXAMPLE
 // [16] ORIGINAL USAGE EXAMPLE
 // [15] PERFORMANCE TEST
 // [14] CONCURRENCY TEST
@@ -147,6 +151,14 @@ struct InfrequentDeleteBlock {
     bsls::AlignmentUtil::MaxAlignedType  d_memory;  // force alignment
 };
 
+// This type is copied from `bdlma_concurrentpool.h` for testing purposes.
+
+struct PoolChunk {
+    PoolChunk                           *d_next_p;
+    int                                  d_numBlocks;
+    bsls::AlignmentUtil::MaxAlignedType  d_memory;  // force alignment
+};
+
 // This type is copied from `bdlma_concurrentpool.cpp` to determine the
 // internal limits of `bdlma::ConcurrentPool`.
 enum {
@@ -213,6 +225,16 @@ static int blockSize(int numBytes)
     return numBytes;
 }
 
+/// Return the number of bytes allocated by `bdlma::ConcurrentPool` for a
+/// chunk whose blocks occupy the specified `numBytes`.  The behavior is
+/// undefined unless `0 < numBytes`.
+static int chunkSize(int numBytes)
+{
+    ASSERT(0 < numBytes);
+
+    return numBytes + static_cast<int>(offsetof(PoolChunk, d_memory));
+}
+
 /// Round up the specified `x` to the nearest multiples of the specified
 /// `y`.  The behavior is undefined unless `0 <= x` and `0 < y`;
 inline static int roundUp(int x, int y)
@@ -620,6 +642,32 @@ void *workerThread(void *arg) {
     return arg;
 }
 
+//=============================================================================
+//                      HELPER FUNCTION FOR TRIM TEST
+//-----------------------------------------------------------------------------
+
+/// This `struct` describes a range of blocks to be deallocated by
+/// `deallocateBlocks`.
+struct DeallocateArgs {
+    Obj   *d_pool_p;     // pool from which the blocks were allocated
+    void **d_blocks_p;   // address of the first block to deallocate
+    int    d_numBlocks;  // number of blocks to deallocate
+};
+
+extern "C"
+void *deallocateBlocks(void *arg)
+{
+    DeallocateArgs *args = static_cast<DeallocateArgs *>(arg);
+
+    for (int i = 0; i < args->d_numBlocks; ++i) {
+        args->d_pool_p->deallocate(args->d_blocks_p[i]);
+        if (0 == i % 64) {
+            bslmt::ThreadUtil::yield();
+        }
+    }
+    return arg;
+}
+
 //=============================================================================
 //                              BENCHMARKS
 //-----------------------------------------------------------------------------
@@ -704,7 +752,7 @@ int main(int argc, char *argv[]) {
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 17: {
+      case 18: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Make sure main usage example compiles and works.
@@ -738,6 +786,189 @@ int main(int argc, char *argv[]) {
         array.removeAll();
         ASSERT(0 == array.length());
       } break;
+      case 17: {
+        // --------------------------------------------------------------------
+        // TRIM AND OCCUPANCY TEST
+        //
+        // Concerns:
+        // 1. `numBlocksTotal` reports the number of blocks in all chunks, and
+        //    `numBlocksFree` the number of those on the free list.
+        //
+        // 2. `trim` returns to the allocator exactly those chunks none of
+        //    whose blocks is allocated, returns the number of bytes so
+        //    released, and does not affect allocated blocks.
+        //
+        // 3. The blocks that remain free after `trim` can all be allocated
+        //    again before the pool replenishes.
+        //
+        // 4. `trim` may be called while other threads deallocate blocks, and
+        //    no block is lost.
+        //
+        // Plan:
+        // 1. Using a constant growth strategy and a range of block sizes
+        //    (including sizes larger than a memory page), allocate several
+        //    chunks worth of blocks, writing a pattern to each, and verify
+        //    the accessors.  (C-1)
+        //
+        // 2. Deallocate all of the blocks of some chunks and some blocks of
+        //    another, call `trim`, and verify the bytes released, the state
+        //    of the test allocator and the accessors, and the patterns of the
+        //    allocated blocks.  (C-2)
+        //
+        // 3. Allocate the remaining free blocks and verify that the test
+        //    allocator is not used.  (C-3)
+        //
+        // 4. Allocate many blocks, and deallocate them from several threads
+        //    while calling `trim` repeatedly.  Once the threads are joined,
+        //    verify that `numBlocksFree` equals `numBlocksTotal`, and that a
+        //    final `trim` releases all memory.  (C-4)
+        //
+        // Testing:
+        //   bsls::Types::size_type trim();
+        //   bsls::Types::Int64 numBlocksFree() const;
+        //   bsls::Types::Int64 numBlocksTotal() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TRIM AND OCCUPANCY TEST" << endl
+                                  << "=======================" << endl;
+
+        const int BLOCK_SIZES[] = { 1, 8, 24, 100, 5000, 20000 };
+        const int NUM_BLOCK_SIZES = sizeof BLOCK_SIZES / sizeof *BLOCK_SIZES;
+
+        for (int i = 0; i < NUM_BLOCK_SIZES; ++i) {
+            const int BLOCK_SIZE = BLOCK_SIZES[i];
+            const int NUM_CHUNKS = 4;
+            const int CHUNK_SIZE = 5;
+            const int NUM_BLOCKS = NUM_CHUNKS * CHUNK_SIZE;
+
+            if (veryVerbose) { T_ P(BLOCK_SIZE) }
+
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj mX(BLOCK_SIZE,
+                   bsls::BlockGrowth::BSLS_CONSTANT,
+                   CHUNK_SIZE,
+                   &ta);
+            const Obj& X = mX;
+
+            ASSERTV(BLOCK_SIZE, 0 == X.numBlocksTotal());
+            ASSERTV(BLOCK_SIZE, 0 == X.numBlocksFree());
+            ASSERTV(BLOCK_SIZE, 0 == mX.trim());
+
+            char *blocks[NUM_BLOCKS];
+            for (int j = 0; j < NUM_BLOCKS; ++j) {
+                blocks[j] = static_cast<char *>(mX.allocate());
+                bsl::memset(blocks[j], j, BLOCK_SIZE);
+            }
+            ASSERTV(BLOCK_SIZE, NUM_BLOCKS == X.numBlocksTotal());
+            ASSERTV(BLOCK_SIZE, 0          == X.numBlocksFree());
+            ASSERTV(BLOCK_SIZE, 0          == mX.trim());
+            ASSERTV(BLOCK_SIZE, NUM_CHUNKS == ta.numBlocksInUse());
+
+            // Free all of the blocks of the second and fourth chunks, in
+            // interleaved order, and all but one block of the first chunk.
+
+            for (int j = 0; j < CHUNK_SIZE; ++j) {
+                mX.deallocate(blocks[CHUNK_SIZE + j]);
+                mX.deallocate(blocks[3 * CHUNK_SIZE + j]);
+                blocks[CHUNK_SIZE + j] = blocks[3 * CHUNK_SIZE + j] = 0;
+            }
+            for (int j = 1; j < CHUNK_SIZE; ++j) {
+                mX.deallocate(blocks[j]);
+                blocks[j] = 0;
+            }
+            ASSERTV(BLOCK_SIZE, 3 * CHUNK_SIZE - 1 == X.numBlocksFree());
+
+            const bsls::Types::Int64 NUM_BYTES = ta.numBytesInUse();
+
+            const bsls::Types::size_type RELEASED = mX.trim();
+
+            ASSERTV(BLOCK_SIZE, NUM_CHUNKS - 2 == ta.numBlocksInUse());
+            ASSERTV(BLOCK_SIZE, RELEASED,
+                    NUM_BYTES - ta.numBytesInUse() ==
+                               static_cast<bsls::Types::Int64>(RELEASED));
+            ASSERTV(BLOCK_SIZE, 2 * CHUNK_SIZE == X.numBlocksTotal());
+            ASSERTV(BLOCK_SIZE, CHUNK_SIZE - 1 == X.numBlocksFree());
+
+            for (int j = 0; j < NUM_BLOCKS; ++j) {
+                if (blocks[j]) {
+                    for (int k = 0; k < BLOCK_SIZE; ++k) {
+                        ASSERTV(BLOCK_SIZE, j, k,
+                                static_cast<char>(j) == blocks[j][k]);
+                    }
+                }
+            }
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+            for (int j = 0; j < CHUNK_SIZE - 1; ++j) {
+                char *p = static_cast<char *>(mX.allocate());
+                bsl::memset(p, 0xff, BLOCK_SIZE);
+            }
+            ASSERTV(BLOCK_SIZE, NUM_ALLOCATIONS == ta.numAllocations());
+            ASSERTV(BLOCK_SIZE, 0 == X.numBlocksFree());
+
+            mX.allocate();
+            ASSERTV(BLOCK_SIZE, NUM_ALLOCATIONS + 1 == ta.numAllocations());
+            ASSERTV(BLOCK_SIZE, 3 * CHUNK_SIZE == X.numBlocksTotal());
+
+            ASSERTV(BLOCK_SIZE, 0 == blocks[0][0]);
+
+            mX.release();
+            ASSERTV(BLOCK_SIZE, 0 == X.numBlocksTotal());
+            ASSERTV(BLOCK_SIZE, 0 == X.numBlocksFree());
+            ASSERTV(BLOCK_SIZE, 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting `trim` with concurrent `deallocate`."
+                          << endl;
+        {
+            enum { k_NUM_DEALLOCATORS = 4, k_BLOCKS_PER_THREAD = 2000 };
+
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj mX(24, bsls::BlockGrowth::BSLS_CONSTANT, 16, &ta);
+            const Obj& X = mX;
+
+            bsl::vector<void *> blocks(&ta);
+            for (int j = 0; j < k_NUM_DEALLOCATORS * k_BLOCKS_PER_THREAD;
+                                                                        ++j) {
+                blocks.push_back(mX.allocate());
+            }
+            const bsls::Types::Int64 NUM_BLOCKS = X.numBlocksTotal();
+
+            DeallocateArgs            args[k_NUM_DEALLOCATORS];
+            bslmt::ThreadUtil::Handle handles[k_NUM_DEALLOCATORS];
+            for (int t = 0; t < k_NUM_DEALLOCATORS; ++t) {
+                args[t].d_pool_p    = &mX;
+                args[t].d_blocks_p  = &blocks[t * k_BLOCKS_PER_THREAD];
+                args[t].d_numBlocks = k_BLOCKS_PER_THREAD;
+
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[t],
+                                                      deallocateBlocks,
+                                                      &args[t]));
+            }
+
+            bsls::Types::size_type released = 0;
+            for (int j = 0; j < 200; ++j) {
+                released += mX.trim();
+                bslmt::ThreadUtil::yield();
+            }
+
+            for (int t = 0; t < k_NUM_DEALLOCATORS; ++t) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[t]));
+            }
+
+            if (veryVerbose) { T_ P_(NUM_BLOCKS) P(released) }
+
+            ASSERTV(X.numBlocksTotal(), X.numBlocksFree(),
+                    X.numBlocksTotal() == X.numBlocksFree());
+
+            mX.trim();
+            ASSERT(0 == X.numBlocksTotal());
+            ASSERT(0 == X.numBlocksFree());
+            ASSERT(1 == ta.numBlocksInUse());  // the vector
+        }
+      } break;
       case 16: {
         // --------------------------------------------------------------------
         // ORIGINAL USAGE EXAMPLE
@@ -1593,7 +1824,7 @@ int main(int argc, char *argv[]) {
                     ++numAllocations;
                     ASSERT(numAllocations == TA.numAllocations());
                     const bsls::Types::Uint64 EXP_SIZE =
-                                 blockSize(POOL_OBJECT_SIZE * blocksPerChunk);
+                                 chunkSize(POOL_OBJECT_SIZE * blocksPerChunk);
                     LOOP3_ASSERT(blocksPerChunk,
                                  EXP_SIZE,
                                  TA.lastAllocatedNumBytes(),
@@ -1661,7 +1892,7 @@ int main(int argc, char *argv[]) {
                     }
 
                     const bsls::Types::Uint64 EXP =
-                                     blockSize(POOL_OBJECT_SIZE * NUM_OBJECTS);
+                                     chunkSize(POOL_OBJECT_SIZE * NUM_OBJECTS);
                     if (veryVerbose) { T_; P_(numAllocations); T_; P(EXP); }
 
                     LOOP2_ASSERT(di, ri,
@@ -0,0 +1,82 @@
+// bdlma_freelistutil.cpp                                             -*-C++-*-
+#include <bdlma_freelistutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_freelistutil_cpp,"$Id$ $CSID$")
+
+#include <bsls_atomic.h>
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+#include <sys/mman.h>  // 'madvise'
+#include <unistd.h>    // 'sysconf'
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+                            // -------------------
+                            // struct FreeListUtil
+                            // -------------------
+
+// CLASS METHODS
+void FreeListUtil::adviseUnneeded(void *begin, void *end)
+{
+    typedef bsls::Types::UintPtr UintPtr;
+
+    const UintPtr size = pageSize();
+    if (0 == size) {
+        return;                                                       // RETURN
+    }
+
+    const UintPtr first = (reinterpret_cast<UintPtr>(begin) + size - 1)
+                        & ~(size - 1);
+    const UintPtr last  = reinterpret_cast<UintPtr>(end) & ~(size - 1);
+
+    if (first < last) {
+#ifdef BSLS_PLATFORM_OS_UNIX
+        // The advice is only a hint, so a failure is benign and is ignored.
+
+        (void)madvise(reinterpret_cast<char *>(first),
+                      last - first,
+                      MADV_DONTNEED);
+#endif
+    }
+}
+
+int FreeListUtil::pageSize()
+{
+#ifdef BSLS_PLATFORM_OS_UNIX
+    static bsls::AtomicInt size(0);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size.loadRelaxed())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        size = static_cast<int>(sysconf(_SC_PAGESIZE));
+    }
+
+    return size.loadRelaxed();
+#else
+    return 0;
+#endif
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,233 @@
+// bdlma_freelistutil.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLMA_FREELISTUTIL
+#define INCLUDED_BDLMA_FREELISTUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide utilities for trimming the free lists of memory pools.
+//
+//@CLASSES:
+//  bdlma::FreeListUtil: namespace for free-list and page-advice utilities
+//
+//@SEE_ALSO: bdlma_pool, bdlma_concurrentpool
+//
+//@DESCRIPTION: This component provides a `struct`, `bdlma::FreeListUtil`,
+// that serves as a namespace for low-level utility functions used by memory
+// pools to return unused memory: `sortByAddress` sorts an intrusive,
+// singly-linked list (such as the free list of a pool, or its list of chunks)
+// into ascending address order without allocating memory, so that the free
+// blocks of each chunk can be counted in a single pass, and `adviseUnneeded`
+// advises the operating system that the contents of the whole pages within a
+// range of memory are no longer needed, so that the physical memory backing
+// them can be reclaimed while the range remains valid.
+//
+// `sortByAddress` operates on any node type having a (possibly `volatile`)
+// data member `d_next_p` of type "pointer to node"; the list is terminated by
+// a null `d_next_p`.
+//
+// `adviseUnneeded` uses `madvise(MADV_DONTNEED)` on UNIX platforms, and has no
+// effect on other platforms (on which `pageSize` returns 0).  Once advised,
+// the contents of the affected pages are unspecified until next written, but
+// the pages may be read and written at any time.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting the Free Blocks of a Chunk
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose a pool threads its free blocks onto a singly-linked list whose
+// order reflects the order of deallocation, and that we need to know how many
+// of the blocks of a given chunk are free.  First, we define the link type
+// and carve a chunk into four blocks:
+// ```
+// struct Link {
+//     Link *d_next_p;
+// };
+//
+// enum { k_BLOCK_SIZE = 32, k_NUM_BLOCKS = 4 };
+//
+// bsls::AlignedBuffer<k_BLOCK_SIZE * k_NUM_BLOCKS> chunk;
+//
+// char *base = chunk.buffer();
+// Link *blocks[k_NUM_BLOCKS];
+// for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+//     blocks[i] = reinterpret_cast<Link *>(base + i * k_BLOCK_SIZE);
+// }
+// ```
+// Then, we build a free list holding blocks 2, 0, and 3, in that order:
+// ```
+// blocks[2]->d_next_p = blocks[0];
+// blocks[0]->d_next_p = blocks[3];
+// blocks[3]->d_next_p = 0;
+//
+// Link *freeList = blocks[2];
+// ```
+// Next, we sort the free list into address order:
+// ```
+// freeList = bdlma::FreeListUtil::sortByAddress(freeList);
+//
+// assert(blocks[0] == freeList);
+// assert(blocks[2] == freeList->d_next_p);
+// assert(blocks[3] == freeList->d_next_p->d_next_p);
+// ```
+// Now, the free blocks of the chunk form a contiguous run of the sorted list,
+// and can be counted by walking the list only as far as the end of the chunk:
+// ```
+// const char *end = chunk.buffer() + k_BLOCK_SIZE * k_NUM_BLOCKS;
+//
+// int numFree = 0;
+// for (Link *p = freeList; p && reinterpret_cast<char *>(p) < end;
+//                                                          p = p->d_next_p) {
+//     ++numFree;
+// }
+// assert(3 == numFree);
+// ```
+// Finally, we advise the operating system that the unused parts of the free
+// blocks are not needed.  Since no block spans a whole page, this has no
+// effect (here, the links are preserved):
+// ```
+// for (Link *p = freeList; p; p = p->d_next_p) {
+//     char *block = reinterpret_cast<char *>(p);
+//     bdlma::FreeListUtil::adviseUnneeded(block + sizeof(Link),
+//                                         block + k_BLOCK_SIZE);
+// }
+// assert(blocks[2] == freeList->d_next_p);
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bsls_types.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+                            // ===================
+                            // struct FreeListUtil
+                            // ===================
+
+/// This `struct` provides a namespace for utility functions used by memory
+/// pools to sort their intrusive lists and to return the physical memory
+/// backing their free blocks to the operating system.
+struct FreeListUtil {
+
+    // CLASS METHODS
+
+    /// Advise the operating system that the contents of the whole pages of
+    /// memory lying within the range `[begin, end)` are no longer needed,
+    /// so that the physical memory backing them may be reclaimed.  The
+    /// memory remains valid, but its contents are unspecified until next
+    /// written.  This function has no effect if the range does not span a
+    /// whole page, or if `0 == pageSize()`.  The behavior is undefined
+    /// unless `[begin, end)` is a valid range of writable memory.
+    static void adviseUnneeded(void *begin, void *end);
+
+    /// Return the size (in bytes) of a system memory page, or 0 if memory
+    /// cannot be advised as unneeded on this platform.
+    static int pageSize();
+
+    /// Sort the singly-linked list, threaded through the `d_next_p` data
+    /// members of its nodes, whose first node is at the specified `head`
+    /// into ascending order of node address, and return the address of the
+    /// first node of the sorted list.  If `head` is 0, return 0.  This
+    /// operation does not allocate memory, and takes time proportional to
+    /// `N * log(N)`, where `N` is the number of nodes in the list.  The
+    /// behavior is undefined unless the list is null-terminated.
+    template <class NODE>
+    static NODE *sortByAddress(NODE *head);
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                            // -------------------
+                            // struct FreeListUtil
+                            // -------------------
+
+// CLASS METHODS
+template <class NODE>
+NODE *FreeListUtil::sortByAddress(NODE *head)
+{
+    if (!head) {
+        return head;                                                  // RETURN
+    }
+
+    // Bottom-up merge sort: merge adjacent sorted runs of 'width' nodes,
+    // doubling 'width' until a single run remains.
+
+    for (bsls::Types::size_type width = 1; ; width *= 2) {
+        NODE *p         = head;
+        NODE *last      = 0;
+        int   numMerges = 0;
+
+        head = 0;
+        while (p) {
+            ++numMerges;
+
+            NODE                   *q     = p;
+            bsls::Types::size_type  pSize = 0;
+            while (pSize < width && q) {
+                ++pSize;
+                q = q->d_next_p;
+            }
+            bsls::Types::size_type qSize = width;
+
+            while (pSize || (qSize && q)) {
+                NODE *node;
+                if (0 == pSize) {
+                    node = q;
+                    q    = q->d_next_p;
+                    --qSize;
+                }
+                else if (0 == qSize || !q || static_cast<void *>(p)
+                                                   < static_cast<void *>(q)) {
+                    node = p;
+                    p    = p->d_next_p;
+                    --pSize;
+                }
+                else {
+                    node = q;
+                    q    = q->d_next_p;
+                    --qSize;
+                }
+
+                if (last) {
+                    last->d_next_p = node;
+                }
+                else {
+                    head = node;
+                }
+                last = node;
+            }
+            p = q;
+        }
+        last->d_next_p = 0;
+
+        if (numMerges <= 1) {
+            return head;                                              // RETURN
+        }
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
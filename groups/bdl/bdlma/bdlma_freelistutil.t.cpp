@@ -0,0 +1,521 @@
+// bdlma_freelistutil.t.cpp                                           -*-C++-*-
+#include <bdlma_freelistutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a utility providing stateless functions.
+// `sortByAddress` is verified by building lists of every permutation of a
+// small set of nodes (and of larger, pseudo-randomly ordered sets), sorting
+// them, and verifying that the result is a null-terminated, address-ordered
+// list of the same nodes.  `adviseUnneeded` cannot portably be observed to
+// release memory; we verify that memory outside the advised pages is
+// unaffected, and that the advised memory remains readable and writable.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] void adviseUnneeded(void *begin, void *end);
+// [ 3] int pageSize();
+// [ 2] NODE *sortByAddress(NODE *head);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+
+//=============================================================================
+//                    STANDARD BDE ASSERT TEST MACRO
+//-----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+//=============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+//-----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bdlma::FreeListUtil Util;
+
+/// This `struct` is a list node whose link is not its first member.
+struct Node {
+    int   d_value;
+    Node *d_next_p;
+};
+
+/// This `struct` is a list node having a `volatile` link, as used by
+/// `bdlma::ConcurrentPool`.
+struct VolatileNode {
+    VolatileNode *volatile d_next_p;
+};
+
+//=============================================================================
+//                      FILE-STATIC FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+/// Link the specified `numNodes` nodes in the specified `nodes` array into a
+/// list in the order given by the specified `order`, and return the head of
+/// the list.
+template <class NODE>
+NODE *makeList(NODE *nodes, const int *order, int numNodes)
+{
+    NODE *head = 0;
+    for (int i = numNodes - 1; 0 <= i; --i) {
+        nodes[order[i]].d_next_p = head;
+        head = &nodes[order[i]];
+    }
+    return head;
+}
+
+/// Return `true` if the list whose first node is at the specified `head` is
+/// exactly the specified `numNodes` elements of the specified `nodes` array
+/// in ascending address order, and `false` otherwise.
+template <class NODE>
+bool isSortedArray(NODE *head, NODE *nodes, int numNodes)
+{
+    for (int i = 0; i < numNodes; ++i) {
+        if (head != &nodes[i]) {
+            return false;                                             // RETURN
+        }
+        head = head->d_next_p;
+    }
+    return 0 == head;
+}
+
+//=============================================================================
+//                               USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE_1 {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting the Free Blocks of a Chunk
+/// - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose a pool threads its free blocks onto a singly-linked list whose
+// order reflects the order of deallocation, and that we need to know how many
+// of the blocks of a given chunk are free.  First, we define the link type
+// and carve a chunk into four blocks:
+// ```
+    struct Link {
+        Link *d_next_p;
+    };
+// ```
+
+void usageExample()
+{
+// ```
+    enum { k_BLOCK_SIZE = 32, k_NUM_BLOCKS = 4 };
+
+    bsls::AlignedBuffer<k_BLOCK_SIZE * k_NUM_BLOCKS> chunk;
+
+    char *base = chunk.buffer();
+    Link *blocks[k_NUM_BLOCKS];
+    for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+        blocks[i] = reinterpret_cast<Link *>(base + i * k_BLOCK_SIZE);
+    }
+// ```
+// Then, we build a free list holding blocks 2, 0, and 3, in that order:
+// ```
+    blocks[2]->d_next_p = blocks[0];
+    blocks[0]->d_next_p = blocks[3];
+    blocks[3]->d_next_p = 0;
+
+    Link *freeList = blocks[2];
+// ```
+// Next, we sort the free list into address order:
+// ```
+    freeList = bdlma::FreeListUtil::sortByAddress(freeList);
+
+    ASSERT(blocks[0] == freeList);
+    ASSERT(blocks[2] == freeList->d_next_p);
+    ASSERT(blocks[3] == freeList->d_next_p->d_next_p);
+// ```
+// Now, the free blocks of the chunk form a contiguous run of the sorted list,
+// and can be counted by walking the list only as far as the end of the chunk:
+// ```
+    const char *end = chunk.buffer() + k_BLOCK_SIZE * k_NUM_BLOCKS;
+
+    int numFree = 0;
+    for (Link *p = freeList; p && reinterpret_cast<char *>(p) < end;
+                                                             p = p->d_next_p) {
+        ++numFree;
+    }
+    ASSERT(3 == numFree);
+// ```
+// Finally, we advise the operating system that the unused parts of the free
+// blocks are not needed.  Since no block spans a whole page, this has no
+// effect (here, the links are preserved):
+// ```
+    for (Link *p = freeList; p; p = p->d_next_p) {
+        char *block = reinterpret_cast<char *>(p);
+        bdlma::FreeListUtil::adviseUnneeded(block + sizeof(Link),
+                                            block + k_BLOCK_SIZE);
+    }
+    ASSERT(blocks[2] == freeList->d_next_p);
+// ```
+}
+
+}  // close namespace USAGE_EXAMPLE_1
+
+//=============================================================================
+//                                MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        USAGE_EXAMPLE_1::usageExample();
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // `adviseUnneeded` AND `pageSize`
+        //
+        // Concerns:
+        // 1. `pageSize` returns a power of two, or 0.
+        //
+        // 2. Memory outside the whole pages within the advised range is not
+        //    modified, including the partial pages at either end.
+        //
+        // 3. The advised memory remains readable and writable.
+        //
+        // 4. A range that spans no whole page, including an empty range, is
+        //    not modified.
+        //
+        // Plan:
+        // 1. Verify `pageSize`.  (C-1)
+        //
+        // 2. In a buffer of several pages filled with a known pattern, advise
+        //    ranges starting and ending at various offsets from page
+        //    boundaries.  Verify that the bytes outside the page-aligned
+        //    interior of each range retain the pattern, and that every byte
+        //    of the buffer can be written and read back.  (C-2..4)
+        //
+        // Testing:
+        //   void adviseUnneeded(void *begin, void *end);
+        //   int pageSize();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "`adviseUnneeded` AND `pageSize`" << endl
+                          << "===============================" << endl;
+
+        const int PAGE_SIZE = Util::pageSize();
+        if (veryVerbose) { T_ P(PAGE_SIZE) }
+
+        ASSERTV(PAGE_SIZE, 0 <= PAGE_SIZE);
+        ASSERTV(PAGE_SIZE, 0 == (PAGE_SIZE & (PAGE_SIZE - 1)));
+#ifdef BSLS_PLATFORM_OS_UNIX
+        ASSERTV(PAGE_SIZE, 0 < PAGE_SIZE);
+#endif
+
+        const int PAGE        = 0 < PAGE_SIZE ? PAGE_SIZE : 4096;
+        const int NUM_PAGES   = 6;
+        const int BUFFER_SIZE = (NUM_PAGES + 1) * PAGE;
+
+        char *raw    = static_cast<char *>(bsl::malloc(BUFFER_SIZE));
+        char *buffer = reinterpret_cast<char *>(
+                   (reinterpret_cast<bsls::Types::UintPtr>(raw) + PAGE - 1)
+                                     & ~static_cast<bsls::Types::UintPtr>(
+                                                                   PAGE - 1));
+
+        static const struct {
+            int d_line;        // source line number
+            int d_begin;       // offset of beginning of range
+            int d_end;         // offset of end of range
+            int d_firstPage;   // expected first advised page
+            int d_lastPage;    // expected end of advised pages
+        } DATA[] = {
+            //LINE  BEGIN  END (in units of PAGE / 4)  FIRST  LAST
+            //----  -----  ---                         -----  ----
+            { L_,       0,   0,                            0,    0 },
+            { L_,       1,   3,                            0,    0 },
+            { L_,       1,   4,                            0,    0 },
+            { L_,       1,   7,                            0,    0 },
+            { L_,       4,   8,                            1,    2 },
+            { L_,       3,   9,                            1,    2 },
+            { L_,       1,  23,                            1,    5 },
+            { L_,       4,  24,                            1,    6 },
+            { L_,       6,  10,                            0,    0 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE  = DATA[ti].d_line;
+            const int BEGIN = DATA[ti].d_begin * PAGE / 4;
+            const int END   = DATA[ti].d_end   * PAGE / 4;
+            const int FIRST = DATA[ti].d_firstPage * PAGE;
+            const int LAST  = DATA[ti].d_lastPage  * PAGE;
+
+            if (veryVerbose) { T_ P_(LINE) P_(BEGIN) P(END) }
+
+            for (int i = 0; i < NUM_PAGES * PAGE; ++i) {
+                buffer[i] = static_cast<char>(i % 251);
+            }
+
+            Util::adviseUnneeded(buffer + BEGIN, buffer + END);
+
+            for (int i = 0; i < NUM_PAGES * PAGE; ++i) {
+                if (FIRST <= i && i < LAST) {
+                    continue;
+                }
+                if (buffer[i] != static_cast<char>(i % 251)) {
+                    ASSERTV(LINE, i, buffer[i] == static_cast<char>(i % 251));
+                    break;
+                }
+            }
+
+            for (int i = 0; i < NUM_PAGES * PAGE; ++i) {
+                buffer[i] = static_cast<char>(i % 13);
+            }
+            for (int i = 0; i < NUM_PAGES * PAGE; ++i) {
+                if (buffer[i] != static_cast<char>(i % 13)) {
+                    ASSERTV(LINE, i, buffer[i] == static_cast<char>(i % 13));
+                    break;
+                }
+            }
+        }
+
+        bsl::free(raw);
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // `sortByAddress`
+        //
+        // Concerns:
+        // 1. An empty list is returned unchanged.
+        //
+        // 2. The sorted list holds exactly the nodes of the original list, in
+        //    ascending address order, and is null-terminated.
+        //
+        // 3. Lists of every length and initial order are sorted, including
+        //    lengths that are not powers of two.
+        //
+        // 4. The link need not be the first member of the node, and may be
+        //    `volatile`.
+        //
+        // Plan:
+        // 1. Sort an empty list.  (C-1)
+        //
+        // 2. For every permutation of up to 6 nodes, build the list in that
+        //    order, sort it, and verify the result.  (C-2..3)
+        //
+        // 3. For lengths up to 300, build lists in pseudo-random, ascending,
+        //    and descending order, sort them, and verify the result, using
+        //    both `Node` and `VolatileNode`.  (C-2..4)
+        //
+        // Testing:
+        //   NODE *sortByAddress(NODE *head);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "`sortByAddress`" << endl
+                          << "===============" << endl;
+
+        if (verbose) cout << "\nTesting an empty list." << endl;
+        {
+            Node *empty = 0;
+            ASSERT(0 == Util::sortByAddress(empty));
+        }
+
+        if (verbose) cout << "\nTesting all permutations." << endl;
+        {
+            enum { k_MAX_LENGTH = 6 };
+
+            Node nodes[k_MAX_LENGTH];
+
+            for (int length = 1; length <= k_MAX_LENGTH; ++length) {
+                int order[k_MAX_LENGTH];
+                for (int i = 0; i < length; ++i) {
+                    order[i] = i;
+                }
+
+                int numPermutations = 0;
+                do {
+                    ++numPermutations;
+
+                    Node *head   = makeList(nodes, order, length);
+                    Node *sorted = Util::sortByAddress(head);
+
+                    ASSERTV(length, numPermutations,
+                            isSortedArray(sorted, nodes, length));
+                } while (bsl::next_permutation(order, order + length));
+
+                if (veryVerbose) { T_ P_(length) P(numPermutations) }
+            }
+        }
+
+        if (verbose) cout << "\nTesting long lists." << endl;
+        {
+            enum { k_MAX_LENGTH = 300 };
+
+            Node         nodes[k_MAX_LENGTH];
+            VolatileNode vnodes[k_MAX_LENGTH];
+            int          order[k_MAX_LENGTH];
+
+            unsigned int seed = 12345;
+
+            for (int length = 1; length <= k_MAX_LENGTH; ++length) {
+                for (int mode = 0; mode < 3; ++mode) {
+                    for (int i = 0; i < length; ++i) {
+                        order[i] = 2 == mode ? length - 1 - i : i;
+                    }
+                    if (0 == mode) {
+                        for (int i = length - 1; 0 < i; --i) {
+                            seed = seed * 1103515245u + 12345u;
+                            const int j = static_cast<int>((seed >> 8)
+                                        % static_cast<unsigned int>(i + 1));
+                            bsl::swap(order[i], order[j]);
+                        }
+                    }
+
+                    Node *sorted = Util::sortByAddress(
+                                            makeList(nodes, order, length));
+                    ASSERTV(length, mode,
+                            isSortedArray(sorted, nodes, length));
+
+                    VolatileNode *vsorted = Util::sortByAddress(
+                                           makeList(vnodes, order, length));
+                    ASSERTV(length, mode,
+                            isSortedArray(vsorted, vnodes, length));
+                }
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Sort a short list, and advise a range of memory.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Node nodes[3];
+        const int ORDER[] = { 2, 0, 1 };
+
+        Node *head = makeList(nodes, ORDER, 3);
+        ASSERT(&nodes[2] == head);
+
+        head = Util::sortByAddress(head);
+        ASSERT(isSortedArray(head, nodes, 3));
+
+        char buffer[64];
+        bsl::memset(buffer, 'x', sizeof buffer);
+        Util::adviseUnneeded(buffer, buffer + sizeof buffer);
+        ASSERT('x' == buffer[0]);
+        ASSERT('x' == buffer[sizeof buffer - 1]);
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -375,6 +375,15 @@ void Multipool::reserveCapacity(bsls::Types::size_type size, int numBlocks)
     }
 }
 
+bsls::Types::size_type Multipool::trim()
+{
+    bsls::Types::size_type numBytes = 0;
+    for (int i = 0; i < d_numPools; ++i) {
+        numBytes += d_pools_p[i].trim();
+    }
+    return numBytes;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -23,6 +23,8 @@ BSLS_IDENT("$Id: $")
 // managed list of memory blocks, if no internal pool managing memory blocks of
 // sufficient size exists.  Both the `release` method and the destructor of a
 // `bdlma::Multipool` release all memory currently allocated via the object.
+// The `trim` method returns to the underlying allocator only that memory that
+// is not currently allocated (see {Returning Unused Memory}).
 //
 // A `bdlma::Multipool` can be depicted visually:
 // ```
@@ -46,6 +48,24 @@ BSLS_IDENT("$Id: $")
 // `bdlma::Pool` maintained by the multipool, from which memory blocks of
 // uniform size are dispensed to users.
 //
+///Returning Unused Memory
+///-----------------------
+// Memory deallocated to a `bdlma::Multipool` is retained by the internal pool
+// that dispensed it, so the footprint of a multipool reflects the peak demand
+// for each block size.  A long-running client whose demand fluctuates can call
+// `trim`, which invokes `bdlma::Pool::trim` on every internal pool: each chunk
+// none of whose blocks is currently allocated is returned to the underlying
+// allocator, and the whole pages spanned by the remaining free blocks are
+// advised to the operating system as unneeded (where supported).  `trim`
+// returns the number of bytes returned to the underlying allocator.
+//
+// The occupancy of each size class can be inspected via `numBlocksTotal` and
+// `numBlocksFree`, which take the index of an internal pool; the pool at index
+// `i` dispenses blocks of `2^(i+3)` bytes.  A client wishing to trim memory in
+// the background (e.g., once a minute) can schedule a call to `trim` with a
+// timer facility such as `bdlmt::EventScheduler`, provided the calls are
+// serialized with all other uses of the multipool.
+//
 ///Configuration at Construction
 ///-----------------------------
 // When creating a `bdlma::Multipool`, clients can optionally configure:
@@ -476,6 +496,7 @@ BSLS_IDENT("$Id: $")
 #include <bslma_deleterhelper.h>
 
 #include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
 #include <bsls_blockgrowth.h>
 #include <bsls_types.h>
 
@@ -716,8 +737,28 @@ class Multipool {
     /// `size <= maxPooledBlockSize()` and `0 <= numBlocks`.
     void reserveCapacity(bsls::Types::size_type size, int numBlocks);
 
+    /// Return to the underlying allocator every chunk of every pool managed
+    /// by this multipool none of whose blocks is currently allocated, and
+    /// advise the operating system that the whole pages spanned by the
+    /// remaining free blocks are unneeded.  Return the number of bytes
+    /// returned to the underlying allocator.  Memory currently allocated
+    /// from this multipool is not affected.  See `bdlma::Pool::trim`.
+    bsls::Types::size_type trim();
+
     // ACCESSORS
 
+    /// Return the number of blocks that are available for allocation from
+    /// the pool at the specified `poolIndex` without replenishing it.  The
+    /// behavior is undefined unless `0 <= poolIndex < numPools()`.  Note
+    /// that the pool at `poolIndex` dispenses blocks of `2^(poolIndex + 3)`
+    /// bytes.
+    bsls::Types::Int64 numBlocksFree(int poolIndex) const;
+
+    /// Return the total number of blocks in all of the chunks currently
+    /// held by the pool at the specified `poolIndex`, whether allocated or
+    /// free.  The behavior is undefined unless `0 <= poolIndex < numPools()`.
+    bsls::Types::Int64 numBlocksTotal(int poolIndex) const;
+
     /// Return the number of pools managed by this multipool object.
     int numPools() const;
 
@@ -762,6 +803,24 @@ void Multipool::deleteObjectRaw(const TYPE *object)
 }
 
 // ACCESSORS
+inline
+bsls::Types::Int64 Multipool::numBlocksFree(int poolIndex) const
+{
+    BSLS_ASSERT(0 <= poolIndex);
+    BSLS_ASSERT(poolIndex < d_numPools);
+
+    return d_pools_p[poolIndex].numBlocksFree();
+}
+
+inline
+bsls::Types::Int64 Multipool::numBlocksTotal(int poolIndex) const
+{
+    BSLS_ASSERT(0 <= poolIndex);
+    BSLS_ASSERT(poolIndex < d_numPools);
+
+    return d_pools_p[poolIndex].numBlocksTotal();
+}
+
 inline
 int Multipool::numPools() const
 {
@@ -64,12 +64,15 @@ using namespace bsl;
 // [ 8] template <class TYPE> void deleteObjectRaw(const TYPE *object);
 // [ 5] void release();
 // [ 6] void reserveCapacity(bsls::Types::size_type size, int numBlocks);
+// [11] bsls::Types::size_type trim();
 // [ 9] int numPools() const;
 // [ 9] bsls::Types::size_type maxPooledBlockSize() const;
+// [11] bsls::Types::Int64 numBlocksFree(int poolIndex) const;
+// [11] bsls::Types::Int64 numBlocksTotal(int poolIndex) const;
 // [10] bslma::Allocator *allocator() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [11] USAGE EXAMPLE
+// [12] USAGE EXAMPLE
 // [ *] CONCERN: Precondition violations are detected when enabled.
 
 //=============================================================================
@@ -660,7 +663,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 11: {
+      case 12: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -709,6 +712,147 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // TESTING `trim`, `numBlocksFree`, AND `numBlocksTotal`
+        //
+        // Concerns:
+        // 1. `numBlocksTotal(i)` and `numBlocksFree(i)` report the occupancy
+        //    of the pool at index `i`, which dispenses blocks of `2^(i+3)`
+        //    bytes.
+        //
+        // 2. `trim` returns to the allocator exactly those chunks of each pool
+        //    none of whose blocks is allocated, and returns the number of
+        //    bytes so released.
+        //
+        // 3. `trim` does not affect allocated blocks, including blocks too
+        //    large to be pooled.
+        //
+        // 4. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Using a constant growth strategy, allocate two chunks worth of
+        //    blocks from each of four pools, and a large block, writing a
+        //    distinct pattern to each, and verify the accessors.  (C-1)
+        //
+        // 2. Deallocate every block of pools 0 and 2, and the first chunk
+        //    worth of blocks of pool 1.  Call `trim`, and verify the value
+        //    returned against the test allocator, the accessors, and the
+        //    patterns of the blocks still allocated.  (C-1..3)
+        //
+        // 3. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid pool indices.  (C-4)
+        //
+        // Testing:
+        //   bsls::Types::size_type trim();
+        //   bsls::Types::Int64 numBlocksFree(int poolIndex) const;
+        //   bsls::Types::Int64 numBlocksTotal(int poolIndex) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                  << "TESTING `trim`, `numBlocksFree`, AND `numBlocksTotal`"
+                  << endl
+                  << "====================================================="
+                  << endl;
+
+        enum { k_NUM_POOLS = 4, k_CHUNK_SIZE = 4, k_LARGE_SIZE = 1000 };
+
+        const int NUM_BLOCKS = 2 * k_CHUNK_SIZE;
+
+        bslma::TestAllocator ta("supplied", veryVeryVerbose);
+
+        Obj mX(k_NUM_POOLS,
+               bsls::BlockGrowth::BSLS_CONSTANT,
+               k_CHUNK_SIZE,
+               &ta);
+        const Obj& X = mX;
+
+        for (int i = 0; i < k_NUM_POOLS; ++i) {
+            ASSERTV(i, 0 == X.numBlocksTotal(i));
+            ASSERTV(i, 0 == X.numBlocksFree(i));
+        }
+        ASSERT(0 == mX.trim());
+
+        char *blocks[k_NUM_POOLS][NUM_BLOCKS];
+        for (int i = 0; i < k_NUM_POOLS; ++i) {
+            const int SIZE = 8 << i;
+            for (int j = 0; j < NUM_BLOCKS; ++j) {
+                blocks[i][j] = static_cast<char *>(mX.allocate(SIZE));
+                bsl::memset(blocks[i][j], i * NUM_BLOCKS + j, SIZE);
+            }
+            ASSERTV(i, NUM_BLOCKS == X.numBlocksTotal(i));
+            ASSERTV(i, 0          == X.numBlocksFree(i));
+        }
+        char *large = static_cast<char *>(mX.allocate(k_LARGE_SIZE));
+        bsl::memset(large, 'L', k_LARGE_SIZE);
+
+        ASSERT(0 == mX.trim());
+
+        for (int j = 0; j < NUM_BLOCKS; ++j) {
+            mX.deallocate(blocks[0][j]);
+            mX.deallocate(blocks[2][j]);
+            blocks[0][j] = blocks[2][j] = 0;
+        }
+        for (int j = 0; j < k_CHUNK_SIZE; ++j) {
+            mX.deallocate(blocks[1][j]);
+            blocks[1][j] = 0;
+        }
+
+        ASSERT(NUM_BLOCKS   == X.numBlocksFree(0));
+        ASSERT(k_CHUNK_SIZE == X.numBlocksFree(1));
+        ASSERT(NUM_BLOCKS   == X.numBlocksFree(2));
+        ASSERT(0            == X.numBlocksFree(3));
+
+        const bsls::Types::Int64 NUM_BYTES  = ta.numBytesInUse();
+        const bsls::Types::Int64 NUM_CHUNKS = ta.numBlocksInUse();
+
+        const bsls::Types::size_type RELEASED = mX.trim();
+
+        ASSERTV(RELEASED, NUM_BYTES - ta.numBytesInUse() ==
+                                 static_cast<bsls::Types::Int64>(RELEASED));
+        ASSERTV(ta.numBlocksInUse(), NUM_CHUNKS - 5 == ta.numBlocksInUse());
+
+        ASSERT(0            == X.numBlocksTotal(0));
+        ASSERT(k_CHUNK_SIZE == X.numBlocksTotal(1));
+        ASSERT(0            == X.numBlocksTotal(2));
+        ASSERT(NUM_BLOCKS   == X.numBlocksTotal(3));
+        for (int i = 0; i < k_NUM_POOLS; ++i) {
+            ASSERTV(i, 0 == X.numBlocksFree(i));
+        }
+
+        for (int i = 0; i < k_NUM_POOLS; ++i) {
+            const int SIZE = 8 << i;
+            for (int j = 0; j < NUM_BLOCKS; ++j) {
+                if (blocks[i][j]) {
+                    for (int k = 0; k < SIZE; ++k) {
+                        ASSERTV(i, j, k, static_cast<char>(i * NUM_BLOCKS + j)
+                                                         == blocks[i][j][k]);
+                    }
+                }
+            }
+        }
+        for (int k = 0; k < k_LARGE_SIZE; ++k) {
+            ASSERTV(k, 'L' == large[k]);
+        }
+
+        mX.release();
+        ASSERT(0 == mX.trim());
+
+        if (verbose) cout << "\\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_SAFE_PASS(X.numBlocksFree(0));
+            ASSERT_SAFE_PASS(X.numBlocksFree(k_NUM_POOLS - 1));
+            ASSERT_SAFE_FAIL(X.numBlocksFree(-1));
+            ASSERT_SAFE_FAIL(X.numBlocksFree(k_NUM_POOLS));
+
+            ASSERT_SAFE_PASS(X.numBlocksTotal(0));
+            ASSERT_SAFE_PASS(X.numBlocksTotal(k_NUM_POOLS - 1));
+            ASSERT_SAFE_FAIL(X.numBlocksTotal(-1));
+            ASSERT_SAFE_FAIL(X.numBlocksTotal(k_NUM_POOLS));
+        }
+      } break;
       case 10: {
         // --------------------------------------------------------------------
         // ALLOCATOR ACCESSOR TEST
@@ -66,11 +66,14 @@ using namespace bsl;
 // [ 2] void *allocate(size);
 // [ 4] void deallocate(address);
 // [ 5] void release();
+// [ 8] bsls::Types::size_type trim();
 // [ 7] int numPools() const;
 // [ 7] bsls::Types::size_type maxPooledBlockSize() const;
+// [ 8] bsls::Types::Int64 numBlocksFree(int poolIndex) const;
+// [ 8] bsls::Types::Int64 numBlocksTotal(int poolIndex) const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 8] USAGE EXAMPLE
+// [ 9] USAGE EXAMPLE
 // [ *] CONCERN: Precondition violations are detected when enabled.
 
 //=============================================================================
@@ -746,7 +749,7 @@ int main(int argc, char *argv[])
     bslma::Allocator     *Z = &testAllocator;
 
     switch (test) { case 0:
-      case 8: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -790,6 +793,66 @@ int main(int argc, char *argv[])
 // ```
 
       } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // TESTING `trim`, `numBlocksFree`, AND `numBlocksTotal`
+        //
+        // Concerns:
+        // 1. `trim`, `numBlocksFree`, and `numBlocksTotal` forward to the
+        //    corresponding methods of the underlying multipool.
+        //
+        // Plan:
+        // 1. Using a constant growth strategy of one block per chunk, allocate
+        //    two blocks from the first pool, deallocate one of them, and
+        //    verify the accessors.  Call `trim` and verify the value returned
+        //    against the test allocator, and the accessors.  (C-1)
+        //
+        // Testing:
+        //   bsls::Types::size_type trim();
+        //   bsls::Types::Int64 numBlocksFree(int poolIndex) const;
+        //   bsls::Types::Int64 numBlocksTotal(int poolIndex) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                  << "TESTING `trim`, `numBlocksFree`, AND `numBlocksTotal`"
+                  << endl
+                  << "====================================================="
+                  << endl;
+
+        bslma::TestAllocator ta("supplied", veryVeryVerbose);
+
+        Obj mX(3, bsls::BlockGrowth::BSLS_CONSTANT, 1, &ta);
+        const Obj& X = mX;
+
+        void *p = mX.allocate(8);
+        void *q = mX.allocate(8);
+
+        ASSERT(2 == X.numBlocksTotal(0));
+        ASSERT(0 == X.numBlocksFree(0));
+        ASSERT(0 == X.numBlocksTotal(1));
+        ASSERT(0 == mX.trim());
+
+        mX.deallocate(p);
+
+        ASSERT(2 == X.numBlocksTotal(0));
+        ASSERT(1 == X.numBlocksFree(0));
+
+        const bsls::Types::Int64 NUM_BYTES  = ta.numBytesInUse();
+        const bsls::Types::Int64 NUM_BLOCKS = ta.numBlocksInUse();
+
+        const bsls::Types::size_type RELEASED = mX.trim();
+
+        ASSERT(0 < RELEASED);
+        ASSERT(NUM_BYTES - ta.numBytesInUse() ==
+                                  static_cast<bsls::Types::Int64>(RELEASED));
+        ASSERT(NUM_BLOCKS - 1 == ta.numBlocksInUse());
+
+        ASSERT(1 == X.numBlocksTotal(0));
+        ASSERT(0 == X.numBlocksFree(0));
+
+        mX.deallocate(q);
+        ASSERT(1 == X.numBlocksFree(0));
+      } break;
       case 7: {
         // --------------------------------------------------------------------
         // TESTING `numPools` and `maxPooledBlockSize`
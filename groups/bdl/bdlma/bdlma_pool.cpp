@@ -4,6 +4,10 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlma_pool_cpp,"$Id$ $CSID$")
 
+#include <bdlma_freelistutil.h>
+
+#include <bslma_default.h>
+
 #include <bsls_performancehint.h>
 
 #include <bsl_algorithm.h>
@@ -53,10 +57,26 @@ bsls::Types::size_type roundUp(bsls::Types::size_type x,
                                 // ----------
 
 // PRIVATE MANIPULATORS
+char *Pool::allocateChunk(int numBlocks)
+{
+    BSLS_ASSERT(1 <= numBlocks);
+
+    const bsls::Types::size_type size = k_CHUNK_HEADER_SIZE
+                                      + numBlocks * d_internalBlockSize;
+
+    Chunk *chunk = static_cast<Chunk *>(d_allocator_p->allocate(size));
+
+    chunk->d_next_p    = d_chunkList_p;
+    chunk->d_numBlocks = numBlocks;
+    d_chunkList_p      = chunk;
+    d_numBlocksTotal  += numBlocks;
+
+    return reinterpret_cast<char *>(chunk) + k_CHUNK_HEADER_SIZE;
+}
+
 void Pool::replenish()
 {
-    d_begin_p = static_cast<char *>(d_blockList.allocate(d_chunkSize
-                                                       * d_internalBlockSize));
+    d_begin_p = allocateChunk(d_chunkSize);
     d_end_p = d_begin_p + d_chunkSize * d_internalBlockSize;
 
     if (   bsls::BlockGrowth::BSLS_GEOMETRIC == d_growthStrategy
@@ -80,7 +100,9 @@ Pool::Pool(bsls::Types::size_type blockSize, bslma::Allocator *basicAllocator)
 , d_maxBlocksPerChunk(k_MAX_CHUNK_SIZE)
 , d_growthStrategy(bsls::BlockGrowth::BSLS_GEOMETRIC)
 , d_freeList_p(0)
-, d_blockList(basicAllocator)
+, d_chunkList_p(0)
+, d_numBlocksTotal(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_begin_p(0)
 , d_end_p(0)
 {
@@ -100,7 +122,9 @@ Pool::Pool(bsls::Types::size_type       blockSize,
 , d_maxBlocksPerChunk(k_MAX_CHUNK_SIZE)
 , d_growthStrategy(growthStrategy)
 , d_freeList_p(0)
-, d_blockList(basicAllocator)
+, d_chunkList_p(0)
+, d_numBlocksTotal(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_begin_p(0)
 , d_end_p(0)
 {
@@ -121,7 +145,9 @@ Pool::Pool(bsls::Types::size_type       blockSize,
 , d_maxBlocksPerChunk(maxBlocksPerChunk)
 , d_growthStrategy(growthStrategy)
 , d_freeList_p(0)
-, d_blockList(basicAllocator)
+, d_chunkList_p(0)
+, d_numBlocksTotal(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
 , d_begin_p(0)
 , d_end_p(0)
 {
@@ -136,9 +162,24 @@ Pool::~Pool()
 {
     BSLS_ASSERT(sizeof(Link) <= d_internalBlockSize);
     BSLS_ASSERT(0 < d_chunkSize);
+
+    release();
 }
 
 // MANIPULATORS
+void Pool::release()
+{
+    while (d_chunkList_p) {
+        Chunk *chunk  = d_chunkList_p;
+        d_chunkList_p = chunk->d_next_p;
+        d_allocator_p->deallocate(chunk);
+    }
+    d_numBlocksTotal = 0;
+    d_freeList_p     = 0;
+    d_begin_p        = 0;
+    d_end_p          = 0;
+}
+
 void Pool::reserveCapacity(int numBlocks)
 {
     BSLS_ASSERT(0 <= numBlocks);
@@ -150,8 +191,7 @@ void Pool::reserveCapacity(int numBlocks)
     }
 
     if (numBlocks > 0 && d_end_p == d_begin_p) {
-        d_begin_p = static_cast<char *>(d_blockList.allocate(numBlocks
-                                                       * d_internalBlockSize));
+        d_begin_p = allocateChunk(numBlocks);
         d_end_p = d_begin_p + numBlocks * d_internalBlockSize;
         return;                                                       // RETURN
     }
@@ -162,7 +202,7 @@ void Pool::reserveCapacity(int numBlocks)
 
         // Allocate memory and add its blocks to the free list.
 
-        void *blocks = d_blockList.allocate(numBlocks * d_internalBlockSize);
+        void *blocks = allocateChunk(numBlocks);
         char *p = static_cast<char *>(blocks);
         for (int i = 1; i < numBlocks; ++i) {
             Link *plink = static_cast<Link *>(static_cast<void *>(p));
@@ -177,6 +217,114 @@ void Pool::reserveCapacity(int numBlocks)
     }
 }
 
+bsls::Types::size_type Pool::trim()
+{
+    // Thread the unused blocks at the end of the current chunk onto the free
+    // list, so that every free block is on the free list.
+
+    while (d_begin_p != d_end_p) {
+        Link *p = static_cast<Link *>(static_cast<void *>(d_begin_p));
+        p->d_next_p  = d_freeList_p;
+        d_freeList_p = p;
+        d_begin_p   += d_internalBlockSize;
+    }
+
+    // With both the free blocks and the chunks in address order, a single
+    // merge-like pass counts the free blocks of each chunk.  The free blocks
+    // of chunks that are retained are relinked, in order, to form the new
+    // free list.
+
+    d_freeList_p  = FreeListUtil::sortByAddress(d_freeList_p);
+    d_chunkList_p = FreeListUtil::sortByAddress(d_chunkList_p);
+
+    const bsls::Types::size_type page         = FreeListUtil::pageSize();
+    const bool                   adviseBlocks = 0 < page
+                                             && page < d_internalBlockSize;
+
+    bsls::Types::size_type  numBytes  = 0;
+    Link                   *p         = d_freeList_p;
+    Link                   *freeTail  = 0;
+    Chunk                  *prevChunk = 0;
+    Chunk                  *chunk     = d_chunkList_p;
+
+    d_freeList_p = 0;
+    while (chunk) {
+        Chunk      *nextChunk = chunk->d_next_p;
+        const char *end       = reinterpret_cast<char *>(chunk)
+                              + k_CHUNK_HEADER_SIZE
+                              + chunk->d_numBlocks * d_internalBlockSize;
+
+        Link *first     = p;
+        Link *last      = 0;
+        int   numBlocks = 0;
+        while (p && static_cast<char *>(static_cast<void *>(p)) < end) {
+            ++numBlocks;
+            last = p;
+            p    = p->d_next_p;
+        }
+
+        if (numBlocks == chunk->d_numBlocks) {
+            if (prevChunk) {
+                prevChunk->d_next_p = nextChunk;
+            }
+            else {
+                d_chunkList_p = nextChunk;
+            }
+            d_numBlocksTotal -= numBlocks;
+            numBytes         += k_CHUNK_HEADER_SIZE
+                              + numBlocks * d_internalBlockSize;
+            d_allocator_p->deallocate(chunk);
+        }
+        else {
+            if (numBlocks) {
+                if (freeTail) {
+                    freeTail->d_next_p = first;
+                }
+                else {
+                    d_freeList_p = first;
+                }
+                freeTail = last;
+
+                if (adviseBlocks) {
+                    for (Link *q = first; q != p; q = q->d_next_p) {
+                        char *block = static_cast<char *>(
+                                                   static_cast<void *>(q));
+                        FreeListUtil::adviseUnneeded(
+                                                  block + sizeof(Link),
+                                                  block + d_internalBlockSize);
+                    }
+                }
+            }
+            prevChunk = chunk;
+        }
+        chunk = nextChunk;
+    }
+    if (freeTail) {
+        freeTail->d_next_p = 0;
+    }
+
+    BSLS_ASSERT(0 == p);
+
+    d_begin_p = 0;
+    d_end_p   = 0;
+
+    return numBytes;
+}
+
+// ACCESSORS
+bsls::Types::Int64 Pool::numBlocksFree() const
+{
+    bsls::Types::Int64 numBlocks =
+          static_cast<bsls::Types::Int64>((d_end_p - d_begin_p)
+                                        / d_internalBlockSize);
+
+    for (const Link *p = d_freeList_p; p; p = p->d_next_p) {
+        ++numBlocks;
+    }
+
+    return numBlocks;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -36,6 +36,25 @@ BSLS_IDENT("$Id: $")
 // strategy and maximum blocks per chunk, either of which can be optionally
 // specified at construction (see the "Configuration at Construction" section).
 //
+///Returning Unused Memory
+///-----------------------
+// A `bdlma::Pool` never returns a chunk to the underlying allocator on its own
+// accord: deallocated blocks are kept on the free list until the pool is
+// `release`d or destroyed.  A long-running client whose demand for blocks
+// fluctuates can instead call `trim`, which returns to the underlying
+// allocator every chunk none of whose blocks is currently allocated, leaving
+// all allocated blocks (and the pool's growth state) untouched.  In addition,
+// for each free block that remains in the pool and that spans one or more
+// whole pages of memory, `trim` advises the operating system (on platforms
+// that support `madvise`) that the contents of those pages are no longer
+// needed, so that they need not remain resident.
+//
+// The `numBlocksTotal` and `numBlocksFree` accessors report the occupancy of a
+// pool, i.e., the number of blocks in all of its chunks and the number of
+// those blocks that are available for allocation, respectively.  Note that
+// both `trim` and `numBlocksFree` take time proportional to the number of free
+// blocks, and that `trim` leaves the free list in ascending address order.
+//
 ///Configuration at Construction
 ///-----------------------------
 // When creating a `bdlma::Pool`, clients must specify the specific block size
@@ -265,8 +284,6 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlscm_version.h>
 
-#include <bdlma_infrequentdeleteblocklist.h>
-
 #include <bslma_allocator.h>
 #include <bslma_deleterhelper.h>
 
@@ -303,6 +320,26 @@ class Pool {
         Link *d_next_p;  // pointer to next link
     };
 
+    /// This `struct` overlays the beginning of each chunk of memory obtained
+    /// from the underlying allocator, and is used to implement the internal
+    /// linked list of chunks owned by this pool.  The blocks of a chunk
+    /// start `k_CHUNK_HEADER_SIZE` bytes past its beginning.
+    struct Chunk {
+
+        Chunk *d_next_p;     // pointer to next chunk
+
+        int    d_numBlocks;  // number of blocks in this chunk
+    };
+
+    enum {
+        // size (in bytes) of the header of each chunk, which preserves the
+        // maximal alignment of the blocks that follow it
+
+        k_CHUNK_HEADER_SIZE =
+                  (sizeof(Chunk) + bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1)
+                & ~(bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT - 1)
+    };
+
     // DATA
     bsls::Types::size_type  d_blockSize;          // size (in bytes) of each
                                                   // allocated memory block
@@ -326,9 +363,14 @@ class Pool {
     Link                   *d_freeList_p;         // linked list of free memory
                                                   // blocks
 
-    InfrequentDeleteBlockList
-                            d_blockList;          // memory manager for
-                                                  // allocated memory
+    Chunk                  *d_chunkList_p;        // linked list of chunks
+                                                  // owned by this pool
+
+    bsls::Types::Int64      d_numBlocksTotal;     // number of blocks in all
+                                                  // chunks
+
+    bslma::Allocator       *d_allocator_p;        // memory allocator (held,
+                                                  // not owned)
 
     char                   *d_begin_p;            // start of a contiguous
                                                   // group of memory blocks
@@ -339,6 +381,12 @@ class Pool {
   private:
     // PRIVATE MANIPULATORS
 
+    /// Return the address of the first block of a newly allocated chunk
+    /// holding the specified `numBlocks` blocks, and add the chunk to the
+    /// list of chunks owned by this pool.  The behavior is undefined unless
+    /// `1 <= numBlocks`.
+    char *allocateChunk(int numBlocks);
+
     /// Dynamically allocate a new chunk using this pool's underlying growth
     /// strategy.
     void replenish();
@@ -421,6 +469,18 @@ class Pool {
     /// undefined unless `0 <= numBlocks`.
     void reserveCapacity(int numBlocks);
 
+    /// Return to the underlying allocator every chunk of memory held by this
+    /// pool none of whose blocks is currently allocated, and return the
+    /// number of bytes so released.  Additionally, on platforms that support
+    /// it, advise the operating system that the whole pages spanned by the
+    /// free blocks that remain in this pool are not needed.  Blocks that are
+    /// currently allocated are not affected, and the chunk size used by the
+    /// next replenishment is unchanged.  Note that this method takes time
+    /// proportional to `N * log(N)`, where `N` is the number of free blocks,
+    /// and leaves the free list in ascending address order.  See
+    /// {Returning Unused Memory}.
+    bsls::Types::size_type trim();
+
     // ACCESSORS
 
     /// Return the size (in bytes) of the memory blocks allocated from this
@@ -428,6 +488,15 @@ class Pool {
     /// size.
     bsls::Types::size_type blockSize() const;
 
+    /// Return the number of blocks that are available for allocation from
+    /// this pool without replenishing.  Note that this method takes time
+    /// proportional to the number of free blocks.
+    bsls::Types::Int64 numBlocksFree() const;
+
+    /// Return the number of blocks, allocated or free, in all of the chunks
+    /// currently held by this pool.
+    bsls::Types::Int64 numBlocksTotal() const;
+
                                   // Aspects
 
     /// Return the allocator used by this object to allocate memory.  Note that
@@ -556,20 +625,17 @@ void Pool::deleteObjectRaw(const TYPE *object)
     bslma::DeleterHelper::deleteObjectRaw(object, this);
 }
 
+// ACCESSORS
 inline
-void Pool::release()
+bsls::Types::size_type Pool::blockSize() const
 {
-    d_blockList.release();
-    d_freeList_p = 0;
-    d_begin_p = 0;
-    d_end_p = 0;
+    return d_blockSize;
 }
 
-// ACCESSORS
 inline
-bsls::Types::size_type Pool::blockSize() const
+bsls::Types::Int64 Pool::numBlocksTotal() const
 {
-    return d_blockSize;
+    return d_numBlocksTotal;
 }
 
 // Aspects
@@ -577,7 +643,7 @@ bsls::Types::size_type Pool::blockSize() const
 inline
 bslma::Allocator *Pool::allocator() const
 {
-    return d_blockList.allocator();
+    return d_allocator_p;
 }
 
 }  // close package namespace
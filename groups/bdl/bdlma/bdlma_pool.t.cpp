@@ -1,6 +1,8 @@
 // bdlma_pool.t.cpp                                                   -*-C++-*-
 #include <bdlma_pool.h>
 
+#include <bdlma_infrequentdeleteblocklist.h>
+
 #include <bslim_testutil.h>
 
 #include <bslma_default.h>
@@ -73,12 +75,15 @@ using namespace bsl;
 // [10] template <class TYPE> void deleteObjectRaw(const TYPE *object);
 // [ 6] void release();
 // [11] void reserveCapacity(numBlocks);
+// [13] bsls::Types::size_type trim();
 // [ 2] bsls::Types::size_type blockSize() const;
+// [13] bsls::Types::Int64 numBlocksFree() const;
+// [13] bsls::Types::Int64 numBlocksTotal() const;
 // [ 7] void *operator new(bsl::size_t size, bdlma::Pool& pool);
 // [ 8] void operator delete(void *address, bdlma::Pool& pool);
 // [12] bslma::Allocator *allocator() const;
 //-----------------------------------------------------------------------------
-// [13] USAGE EXAMPLE
+// [14] USAGE EXAMPLE
 // [ 2] `allocate` returns memory of the correct block size.
 // [ 1] int blockSize(numBytes);
 // [ 1] int poolBlockSize(size);
@@ -519,7 +524,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 13: {
+      case 14: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -575,6 +580,193 @@ int main(int argc, char *argv[])
         }
 
       } break;
+      case 13: {
+        // --------------------------------------------------------------------
+        // TRIM AND OCCUPANCY TEST
+        //
+        // Concerns:
+        // 1. `numBlocksTotal` reports the number of blocks in all chunks, and
+        //    `numBlocksFree` the number of those that can be allocated
+        //    without replenishing, including the unused blocks at the end of
+        //    the most recent chunk.
+        //
+        // 2. `trim` returns to the allocator exactly those chunks none of
+        //    whose blocks is allocated, and returns the number of bytes so
+        //    released.
+        //
+        // 3. `trim` does not affect allocated blocks, and the blocks that
+        //    remain free after `trim` can all be allocated again before the
+        //    pool replenishes.
+        //
+        // 4. `trim` does not affect the size of the next chunk.
+        //
+        // 5. `trim` on a pool having no free blocks has no effect, and
+        //    `trim` on a pool having no allocated blocks releases all memory.
+        //
+        // 6. The contents of allocated blocks are preserved by `trim` even
+        //    when the block size exceeds the size of a memory page.
+        //
+        // Plan:
+        // 1. Using a constant growth strategy, allocate several chunks worth
+        //    of blocks, and verify the values returned by the accessors.
+        //    (C-1)
+        //
+        // 2. Deallocate all of the blocks of some chunks (in an order
+        //    different from that of allocation) and some of the blocks of
+        //    other chunks, call `trim`, and verify the number of bytes
+        //    released, and the state of the test allocator and the accessors.
+        //    (C-2)
+        //
+        // 3. Verify that the number of free blocks can be allocated without
+        //    any allocation from the test allocator.  (C-3..4)
+        //
+        // 4. Repeat with a block size of several pages, writing a pattern to
+        //    each allocated block and verifying it after `trim`.  (C-6)
+        //
+        // 5. Verify the boundary cases.  (C-5)
+        //
+        // Testing:
+        //   bsls::Types::size_type trim();
+        //   bsls::Types::Int64 numBlocksFree() const;
+        //   bsls::Types::Int64 numBlocksTotal() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TRIM AND OCCUPANCY TEST" << endl
+                                  << "=======================" << endl;
+
+        const int BLOCK_SIZES[] = { 1, 8, 24, 100, 5000, 20000 };
+        const int NUM_BLOCK_SIZES = sizeof BLOCK_SIZES / sizeof *BLOCK_SIZES;
+
+        for (int i = 0; i < NUM_BLOCK_SIZES; ++i) {
+            const int BLOCK_SIZE = BLOCK_SIZES[i];
+            const int NUM_CHUNKS = 4;
+            const int CHUNK_SIZE = 5;
+            const int NUM_BLOCKS = NUM_CHUNKS * CHUNK_SIZE;
+
+            if (veryVerbose) { T_ P(BLOCK_SIZE) }
+
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj mX(BLOCK_SIZE,
+                   bsls::BlockGrowth::BSLS_CONSTANT,
+                   CHUNK_SIZE,
+                   &ta);
+            const Obj& X = mX;
+
+            ASSERTV(BLOCK_SIZE, 0 == X.numBlocksTotal());
+            ASSERTV(BLOCK_SIZE, 0 == X.numBlocksFree());
+            ASSERTV(BLOCK_SIZE, 0 == mX.trim());
+
+            char *blocks[NUM_BLOCKS];
+            for (int j = 0; j < NUM_BLOCKS - 2; ++j) {
+                blocks[j] = static_cast<char *>(mX.allocate());
+                bsl::memset(blocks[j], j, BLOCK_SIZE);
+            }
+            ASSERTV(BLOCK_SIZE, NUM_BLOCKS     == X.numBlocksTotal());
+            ASSERTV(BLOCK_SIZE, 2              == X.numBlocksFree());
+            ASSERTV(BLOCK_SIZE, NUM_CHUNKS     == ta.numBlocksInUse());
+
+            for (int j = NUM_BLOCKS - 2; j < NUM_BLOCKS; ++j) {
+                blocks[j] = static_cast<char *>(mX.allocate());
+                bsl::memset(blocks[j], j, BLOCK_SIZE);
+            }
+            ASSERTV(BLOCK_SIZE, 0 == X.numBlocksFree());
+            ASSERTV(BLOCK_SIZE, 0 == mX.trim());
+            ASSERTV(BLOCK_SIZE, NUM_CHUNKS == ta.numBlocksInUse());
+
+            // Free all of the blocks of the first and third chunks, in
+            // interleaved order, and all but one block of the second chunk.
+
+            for (int j = CHUNK_SIZE - 1; 0 <= j; --j) {
+                mX.deallocate(blocks[j]);
+                mX.deallocate(blocks[2 * CHUNK_SIZE + j]);
+                blocks[j] = blocks[2 * CHUNK_SIZE + j] = 0;
+            }
+            for (int j = CHUNK_SIZE + 1; j < 2 * CHUNK_SIZE; ++j) {
+                mX.deallocate(blocks[j]);
+                blocks[j] = 0;
+            }
+            ASSERTV(BLOCK_SIZE, 3 * CHUNK_SIZE - 1 == X.numBlocksFree());
+
+            const bsls::Types::Int64 NUM_BYTES = ta.numBytesInUse();
+
+            const bsls::Types::size_type RELEASED = mX.trim();
+
+            ASSERTV(BLOCK_SIZE, NUM_CHUNKS - 2 == ta.numBlocksInUse());
+            ASSERTV(BLOCK_SIZE, RELEASED,
+                    NUM_BYTES - ta.numBytesInUse() ==
+                               static_cast<bsls::Types::Int64>(RELEASED));
+            ASSERTV(BLOCK_SIZE, 2 * CHUNK_SIZE == X.numBlocksTotal());
+            ASSERTV(BLOCK_SIZE, CHUNK_SIZE - 1 == X.numBlocksFree());
+
+            for (int j = 0; j < NUM_BLOCKS; ++j) {
+                if (blocks[j]) {
+                    for (int k = 0; k < BLOCK_SIZE; ++k) {
+                        ASSERTV(BLOCK_SIZE, j, k,
+                                static_cast<char>(j) == blocks[j][k]);
+                    }
+                }
+            }
+
+            // The remaining free blocks are all reused before the pool
+            // replenishes, and the next chunk has the same size.
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+            for (int j = 0; j < CHUNK_SIZE - 1; ++j) {
+                char *p = static_cast<char *>(mX.allocate());
+                bsl::memset(p, 0xff, BLOCK_SIZE);
+                ASSERTV(BLOCK_SIZE, j, blocks[CHUNK_SIZE] != p);
+            }
+            ASSERTV(BLOCK_SIZE, NUM_ALLOCATIONS == ta.numAllocations());
+            ASSERTV(BLOCK_SIZE, 0 == X.numBlocksFree());
+
+            mX.allocate();
+            ASSERTV(BLOCK_SIZE, NUM_ALLOCATIONS + 1 == ta.numAllocations());
+            ASSERTV(BLOCK_SIZE, 3 * CHUNK_SIZE == X.numBlocksTotal());
+            ASSERTV(BLOCK_SIZE, CHUNK_SIZE - 1 == X.numBlocksFree());
+
+            for (int j = 0; j < NUM_BLOCKS; ++j) {
+                if (blocks[j]) {
+                    ASSERTV(BLOCK_SIZE, j,
+                            static_cast<char>(j) == blocks[j][0]);
+                }
+            }
+
+            mX.release();
+            ASSERTV(BLOCK_SIZE, 0 == X.numBlocksTotal());
+            ASSERTV(BLOCK_SIZE, 0 == X.numBlocksFree());
+            ASSERTV(BLOCK_SIZE, 0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting `trim` with no allocated blocks."
+                          << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVerbose);
+
+            Obj mX(16, &ta);  const Obj& X = mX;
+
+            mX.reserveCapacity(7);
+            void *p = mX.allocate();
+            void *q = mX.allocate();
+            mX.deallocate(p);
+            mX.deallocate(q);
+            mX.reserveCapacity(20);
+
+            ASSERT(0 < ta.numBlocksInUse());
+            ASSERT(X.numBlocksTotal() == X.numBlocksFree());
+
+            const bsls::Types::Int64 NUM_BYTES = ta.numBytesInUse();
+
+            ASSERT(NUM_BYTES == static_cast<bsls::Types::Int64>(mX.trim()));
+            ASSERT(0 == ta.numBlocksInUse());
+            ASSERT(0 == X.numBlocksTotal());
+            ASSERT(0 == X.numBlocksFree());
+
+            p = mX.allocate();
+            ASSERT(p);
+            ASSERT(1 == ta.numBlocksInUse());
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // ALLOCATOR ACCESSOR TEST
@@ -22,9 +22,12 @@ BSLS_IDENT("$Id: $")
 //  `--------------------------'
 //               |         ctor/dtor
 //               |         allocateAndExpand
+//               |         expand
 //               |         reserveCapacity
 //               |         rewind
+//               |         setBlockReuse
 //               |         truncate
+//               |         isBlockReuseEnabled
 //               V
 //   ,-----------------------.
 //  ( bdlma::ManagedAllocator )
@@ -45,8 +48,9 @@ BSLS_IDENT("$Id: $")
 // allocator, as does the destructor.  The `rewind` method releases all memory
 // allocated through the allocator and returns to the underlying allocator
 // *only* memory that was allocated outside of the typical internal buffer
-// growth of the allocator (i.e., large blocks).  Note that individually
-// allocated memory blocks cannot be separately deallocated.
+// growth of the allocator (i.e., large blocks).  Note that, unless block
+// reuse is enabled (see {Optional Block Reuse}), individually allocated memory
+// blocks cannot be separately deallocated.
 //
 // The main difference between a `bdlma::SequentialAllocator` and a
 // `bdlma::SequentialPool` is that, very often, a `bdlma::SequentialAllocator`
@@ -92,6 +96,35 @@ BSLS_IDENT("$Id: $")
 // `alignmentStrategy` is not specified, natural alignment is used.  See
 // `bsls_alignment` for more details.
 //
+///Optional Block Reuse
+///---------------------
+// By default, `deallocate` has no effect, and memory is reclaimed only by
+// `release`, `rewind`, or the destructor.  When such an allocator is long
+// lived and supplies memory to containers that repeatedly grow (e.g., a
+// `bsl::vector` or `bsl::string` that reallocates its storage), the memory
+// consumed grows without bound.  Calling `setBlockReuse(true)` (before any
+// memory is allocated, or following `release` or `rewind`) enables a mode in
+// which each allocation request of up to
+// `bdlma::SizeClassFreeList::k_MAX_BLOCK_SIZE` bytes is rounded up to a
+// power-of-two size class, and blocks that are deallocated *with* *their*
+// *size* (i.e., via the `deallocate(address, bytes, alignment)` method
+// inherited from `bsl::memory_resource`, which is how `bsl::allocator` and
+// `bsl::polymorphic_allocator` return memory) are retained on per-size-class
+// free lists (see `bdlma_sizeclassfreelist`) and reused to satisfy subsequent
+// allocations in the same size class.  Allocations that cannot be satisfied
+// from the free lists continue to use the sequential fast path.  Blocks
+// returned via the single-argument `deallocate` method (whose size is not
+// known), and blocks larger than the largest size class, are not reused.  All
+// retained blocks are discarded by `release` and `rewind`.  Note that, while
+// block reuse is enabled, a block whose size was changed by
+// `allocateAndExpand`, `expand`, or `truncate` must not be deallocated with
+// its size.
+//
+// Independently of block reuse, the `expand` method grows the most recently
+// allocated block in place if the current internal buffer has sufficient
+// remaining space, which allows a client that owns the most recent allocation
+// (e.g., a growing buffer) to avoid a copy.
+//
 ///Usage
 ///-----
 // Allocators are often supplied, at construction, to objects requiring
@@ -202,6 +235,7 @@ BSLS_IDENT("$Id: $")
 
 #include <bdlma_managedallocator.h>
 #include <bdlma_sequentialpool.h>
+#include <bdlma_sizeclassfreelist.h>
 
 #include <bslma_allocator.h>
 
@@ -213,6 +247,8 @@ BSLS_IDENT("$Id: $")
 #include <bsls_review.h>
 #include <bsls_types.h>
 
+#include <bsl_cstddef.h>
+
 namespace BloombergLP {
 namespace bdlma {
 
@@ -228,19 +264,50 @@ namespace bdlma {
 /// installed default allocator is used.  If an allocation exceeds the
 /// remaining free memory space in the current buffer, the allocator
 /// replenishes its internal buffer with new memory to satisfy the request.
-/// This class is *exception* *neutral*: If memory cannot be allocated, the
-/// behavior is defined by the (optional) allocator specified at
-/// construction.
+/// Optionally, blocks deallocated with their size can be retained and
+/// reused (see {Optional Block Reuse}).  This class is *exception*
+/// *neutral*: If memory cannot be allocated, the behavior is defined by the
+/// (optional) allocator specified at construction.
 class SequentialAllocator : public ManagedAllocator {
 
     // DATA
-    SequentialPool d_sequentialPool;  // manager for allocated memory blocks
+    SequentialPool    d_sequentialPool;  // manager for allocated memory
+                                         // blocks
+
+    SizeClassFreeList d_freeList;        // blocks available for reuse
+
+    bool              d_blockReuseFlag;  // `true` if deallocated blocks are
+                                         // retained for reuse
 
   private:
     // NOT IMPLEMENTED
     SequentialAllocator(const SequentialAllocator&);
     SequentialAllocator& operator=(const SequentialAllocator&);
 
+    // PRIVATE MANIPULATORS
+
+    /// Return the address of a contiguous block of memory of at least the
+    /// specified `size` (in bytes), rounding `size` up to the block size of
+    /// its size class (if any) and reusing a retained block of that size
+    /// class if one is available.  If `size` is 0, no memory is allocated
+    /// and 0 is returned.  The behavior is undefined unless block reuse is
+    /// enabled.
+    void *allocateReusable(bsls::Types::size_type size);
+
+  protected:
+    // PROTECTED MANIPULATORS
+
+    /// Return the memory block at the specified `address`, having the
+    /// specified `bytes` and `alignment`, to this allocator.  If block
+    /// reuse is enabled, retain the block for reuse by subsequent
+    /// allocations; otherwise, this method has no effect.  The behavior is
+    /// undefined unless `address` was allocated from this allocator using
+    /// the same `bytes` and `alignment`, and has not already been
+    /// deallocated.
+    void do_deallocate(void        *address,
+                       std::size_t  bytes,
+                       std::size_t  alignment) BSLS_KEYWORD_OVERRIDE;
+
   public:
     // CREATORS
 
@@ -340,7 +407,9 @@ class SequentialAllocator : public ManagedAllocator {
     /// Return the address of a contiguous block of memory of the specified
     /// `size` (in bytes) according to the alignment strategy specified at
     /// construction.  If `size` is 0, no memory is allocated and 0 is
-    /// returned.  If the allocation request exceeds the remaining free
+    /// returned.  If block reuse is enabled and a previously deallocated
+    /// block of sufficient size is available, return that block.
+    /// Otherwise, if the allocation request exceeds the remaining free
     /// memory space in the current internal buffer, use the allocator
     /// supplied at construction to allocate a new internal buffer, then
     /// allocate memory from the new buffer.
@@ -361,13 +430,30 @@ class SequentialAllocator : public ManagedAllocator {
     /// this allocator and has not already been deallocated.
     void deallocate(void *address) BSLS_KEYWORD_OVERRIDE;
 
+    /// Increase the amount of memory allocated at the specified `address`
+    /// from the specified `originalSize` (in bytes) to the specified
+    /// `newSize` (in bytes) in place.  Return `newSize` after expanding, or
+    /// `originalSize` if the memory block at `address` cannot be expanded
+    /// to `newSize`.  This method can only `expand` the memory block
+    /// returned by the most recent `allocate` request from this allocator,
+    /// and only if the current internal buffer has sufficient remaining
+    /// space, and otherwise has no effect.  The behavior is undefined
+    /// unless the memory block at `address` was originally allocated by
+    /// this allocator, the size of the memory block at `address` is
+    /// `originalSize`, `originalSize <= newSize`, and `release` was not
+    /// called after allocating the memory block at `address`.
+    bsls::Types::size_type expand(void                   *address,
+                                  bsls::Types::size_type  originalSize,
+                                  bsls::Types::size_type  newSize);
+
     /// Release all memory allocated through this allocator and return to
     /// the underlying allocator *all* memory.  The allocator is reset to
     /// its default-constructed state, retaining the alignment and growth
-    /// strategies, and the initial and maximum buffer sizes in effect
-    /// following construction.  The effect of subsequently - to this
-    /// invokation of `release` - using a pointer obtained from this object
-    /// prior to this call to `release` is undefined.
+    /// strategies, the initial and maximum buffer sizes, and the block
+    /// reuse mode in effect prior to this call.  The effect of
+    /// subsequently - to this invokation of `release` - using a pointer
+    /// obtained from this object prior to this call to `release` is
+    /// undefined.
     void release() BSLS_KEYWORD_OVERRIDE;
 
     /// Release all memory allocated through this allocator and return to
@@ -379,6 +465,15 @@ class SequentialAllocator : public ManagedAllocator {
     /// call to `rewind` is undefined.
     virtual void rewind();
 
+    /// Enable the retention and reuse of deallocated blocks if the
+    /// specified `enabled` is `true`, and disable it otherwise (the
+    /// default).  When disabling block reuse, any blocks retained for
+    /// reuse are discarded.  The behavior is undefined unless this method
+    /// is called when no memory allocated from this allocator is in use
+    /// (e.g., following construction, `release`, or `rewind`).  See
+    /// {Optional Block Reuse}.
+    void setBlockReuse(bool enabled);
+
     /// Reserve sufficient memory to satisfy allocation requests for at
     /// least the specified `numBytes` without replenishment (i.e., without
     /// dynamic allocation).  If `numBytes` is 0, no memory is reserved.
@@ -402,6 +497,12 @@ class SequentialAllocator : public ManagedAllocator {
     bsls::Types::size_type truncate(void                   *address,
                                     bsls::Types::size_type  originalSize,
                                     bsls::Types::size_type  newSize);
+
+    // ACCESSORS
+
+    /// Return `true` if deallocated blocks are retained for reuse by this
+    /// allocator, and `false` otherwise.
+    bool isBlockReuseEnabled() const;
 };
 
 // ============================================================================
@@ -417,6 +518,7 @@ inline
 SequentialAllocator::
 SequentialAllocator(bslma::Allocator *basicAllocator)
 : d_sequentialPool(basicAllocator)
+, d_blockReuseFlag(false)
 {
 }
 
@@ -425,6 +527,7 @@ SequentialAllocator::
 SequentialAllocator(bsls::BlockGrowth::Strategy  growthStrategy,
                     bslma::Allocator            *basicAllocator)
 : d_sequentialPool(growthStrategy, basicAllocator)
+, d_blockReuseFlag(false)
 {
 }
 
@@ -433,6 +536,7 @@ SequentialAllocator::
 SequentialAllocator(bsls::Alignment::Strategy  alignmentStrategy,
                     bslma::Allocator          *basicAllocator)
 : d_sequentialPool(alignmentStrategy, basicAllocator)
+, d_blockReuseFlag(false)
 {
 }
 
@@ -442,6 +546,7 @@ SequentialAllocator(bsls::BlockGrowth::Strategy  growthStrategy,
                     bsls::Alignment::Strategy    alignmentStrategy,
                     bslma::Allocator            *basicAllocator)
 : d_sequentialPool(growthStrategy, alignmentStrategy, basicAllocator)
+, d_blockReuseFlag(false)
 {
 }
 
@@ -449,6 +554,7 @@ inline
 SequentialAllocator::
 SequentialAllocator(int initialSize)
 : d_sequentialPool(initialSize)
+, d_blockReuseFlag(false)
 {
     BSLS_ASSERT(0 < initialSize);
 }
@@ -458,6 +564,7 @@ SequentialAllocator::
 SequentialAllocator(bsls::Types::size_type  initialSize,
                     bslma::Allocator       *basicAllocator)
 : d_sequentialPool(initialSize, basicAllocator)
+, d_blockReuseFlag(false)
 {
     BSLS_ASSERT(0 < initialSize);
 }
@@ -468,6 +575,7 @@ SequentialAllocator(bsls::Types::size_type       initialSize,
                     bsls::BlockGrowth::Strategy  growthStrategy,
                     bslma::Allocator            *basicAllocator)
 : d_sequentialPool(initialSize, growthStrategy, basicAllocator)
+, d_blockReuseFlag(false)
 {
     BSLS_ASSERT(0 < initialSize);
 }
@@ -478,6 +586,7 @@ SequentialAllocator(bsls::Types::size_type     initialSize,
                     bsls::Alignment::Strategy  alignmentStrategy,
                     bslma::Allocator          *basicAllocator)
 : d_sequentialPool(initialSize, alignmentStrategy, basicAllocator)
+, d_blockReuseFlag(false)
 {
     BSLS_ASSERT(0 < initialSize);
 }
@@ -492,6 +601,7 @@ SequentialAllocator(bsls::Types::size_type       initialSize,
                    growthStrategy,
                    alignmentStrategy,
                    basicAllocator)
+, d_blockReuseFlag(false)
 {
     BSLS_ASSERT(0 < initialSize);
 }
@@ -502,6 +612,7 @@ SequentialAllocator(bsls::Types::size_type  initialSize,
                     bsls::Types::size_type  maxBufferSize,
                     bslma::Allocator       *basicAllocator)
 : d_sequentialPool(initialSize, maxBufferSize, basicAllocator)
+, d_blockReuseFlag(false)
 {
     BSLS_ASSERT(0 < initialSize);
     BSLS_ASSERT(initialSize <= maxBufferSize);
@@ -514,6 +625,7 @@ SequentialAllocator(bsls::Types::size_type       initialSize,
                     bsls::BlockGrowth::Strategy  growthStrategy,
                     bslma::Allocator            *basicAllocator)
 : d_sequentialPool(initialSize, maxBufferSize, growthStrategy, basicAllocator)
+, d_blockReuseFlag(false)
 {
     BSLS_ASSERT(0 < initialSize);
     BSLS_ASSERT(initialSize <= maxBufferSize);
@@ -529,6 +641,7 @@ SequentialAllocator(bsls::Types::size_type     initialSize,
                    maxBufferSize,
                    alignmentStrategy,
                    basicAllocator)
+, d_blockReuseFlag(false)
 {
     BSLS_ASSERT(0 < initialSize);
     BSLS_ASSERT(initialSize <= maxBufferSize);
@@ -546,6 +659,7 @@ SequentialAllocator(bsls::Types::size_type       initialSize,
                    growthStrategy,
                    alignmentStrategy,
                    basicAllocator)
+, d_blockReuseFlag(false)
 {
     BSLS_ASSERT(0 < initialSize);
     BSLS_ASSERT(initialSize <= maxBufferSize);
@@ -555,6 +669,11 @@ SequentialAllocator(bsls::Types::size_type       initialSize,
 inline
 void *SequentialAllocator::allocate(bsls::Types::size_type size)
 {
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_blockReuseFlag)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return allocateReusable(size);                                // RETURN
+    }
+
     return d_sequentialPool.allocate(size);
 }
 
@@ -569,9 +688,19 @@ void SequentialAllocator::deallocate(void *)
 {
 }
 
+inline
+bsls::Types::size_type SequentialAllocator::expand(
+                                          void                   *address,
+                                          bsls::Types::size_type  originalSize,
+                                          bsls::Types::size_type  newSize)
+{
+    return d_sequentialPool.expand(address, originalSize, newSize);
+}
+
 inline
 void SequentialAllocator::release()
 {
+    d_freeList.reset();
     d_sequentialPool.release();
 }
 
@@ -584,9 +713,19 @@ void SequentialAllocator::reserveCapacity(bsls::Types::size_type numBytes)
 inline
 void SequentialAllocator::rewind()
 {
+    d_freeList.reset();
     d_sequentialPool.rewind();
 }
 
+inline
+void SequentialAllocator::setBlockReuse(bool enabled)
+{
+    if (!enabled) {
+        d_freeList.reset();
+    }
+    d_blockReuseFlag = enabled;
+}
+
 inline
 bsls::Types::size_type SequentialAllocator::truncate(
                                           void                   *address,
@@ -596,6 +735,13 @@ bsls::Types::size_type SequentialAllocator::truncate(
     return d_sequentialPool.truncate(address, originalSize, newSize);
 }
 
+// ACCESSORS
+inline
+bool SequentialAllocator::isBlockReuseEnabled() const
+{
+    return d_blockReuseFlag;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -13,6 +13,7 @@
 
 #include <bsl_cstdlib.h>
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
 
 #undef GS  // Solaris 2.10 x86 /usr/include/sys/regset.h
 
@@ -73,14 +74,20 @@ using namespace bsl;
 // // MANIPULATORS
 // [ 2] void *allocate(size_type size);
 // [ 5] void *allocateAndExpand(size_type *size);
+// [ 8] size_type expand(void *addr, size_type orig, size_type newSize);
 // [ 3] void deallocate(void *address);
+// [ 8] void do_deallocate(void *address, size_t bytes, size_t align);
 // [ 4] void release();
 // [ 5] void rewind();
 // [ 7] void reserveCapacity(int numBytes);
+// [ 8] void setBlockReuse(bool enabled);
 // [ 6] int truncate(void *address, int originalSize, int newSize);
+//
+// // ACCESSORS
+// [ 8] bool isBlockReuseEnabled() const;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [ 8] USAGE TEST
+// [ 9] USAGE TEST
 
 //=============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -289,7 +296,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 8: {
+      case 9: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -320,6 +327,182 @@ int main(int argc, char *argv[])
 // ```
 
       } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // BLOCK REUSE AND `expand`
+        //
+        // Concerns:
+        // 1. By default, block reuse is disabled, and deallocated blocks are
+        //    never reused.
+        //
+        // 2. When block reuse is enabled, a block deallocated with its size
+        //    (via `bsl::memory_resource::deallocate`) is returned by a
+        //    subsequent allocation of up to the same size.
+        //
+        // 3. Blocks deallocated via the single-argument `deallocate` are not
+        //    reused.
+        //
+        // 4. `release`, `rewind`, and disabling block reuse discard all
+        //    retained blocks.
+        //
+        // 5. With block reuse enabled, the memory consumed by repeatedly
+        //    growing (and destroying) a `bsl::vector` is bounded.
+        //
+        // 6. `expand` grows the most recent allocation in place if the
+        //    current buffer has room, and otherwise has no effect.
+        //
+        // Plan:
+        // 1. Allocate and deallocate blocks through the `bslma::Allocator`
+        //    and `bsl::memory_resource` interfaces with block reuse disabled
+        //    and enabled, and verify the addresses returned by subsequent
+        //    allocations.  (C-1..4)
+        //
+        // 2. Repeatedly grow a `bsl::vector<int>` using the allocator, and
+        //    verify that the number of bytes in use from the object
+        //    allocator stops increasing once reuse is enabled.  (C-5)
+        //
+        // 3. Invoke `expand` on the most recent and on an earlier
+        //    allocation, and verify the result and the address of a
+        //    subsequent allocation.  (C-6)
+        //
+        // Testing:
+        //   void do_deallocate(void *address, size_t bytes, size_t align);
+        //   size_type expand(void *addr, size_type orig, size_type newSize);
+        //   void setBlockReuse(bool enabled);
+        //   bool isBlockReuseEnabled() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "BLOCK REUSE AND `expand`" << endl
+                                  << "========================" << endl;
+
+        if (verbose) cout << "\nTesting block reuse." << endl;
+        {
+            Obj mX(k_DEFAULT_SIZE, &objectAllocator);
+            const Obj& X = mX;
+
+            bsl::memory_resource& mr = mX;
+
+            ASSERT(false == X.isBlockReuseEnabled());
+
+            void *p = mX.allocate(32);
+            mr.deallocate(p, 32, 16);
+            ASSERT(p != mX.allocate(32));
+
+            mX.release();
+            mX.setBlockReuse(true);
+            ASSERT(true  == X.isBlockReuseEnabled());
+
+            p = mX.allocate(32);
+            mr.deallocate(p, 32, 16);
+            ASSERT(p == mX.allocate(32));
+
+            // Requests in the same size class share blocks.
+
+            mr.deallocate(p, 32, 16);
+            ASSERT(p == mX.allocate(20));
+
+            mr.deallocate(p, 20, 4);
+            ASSERT(p == mX.allocate(17));
+
+            // Requests are rounded up to their size class.
+
+            char *q = static_cast<char *>(mX.allocate(9));
+            char *r = static_cast<char *>(mX.allocate(1));
+            ASSERT(q + 16 == r);
+
+            // Blocks deallocated without their size are not reused.
+
+            p = mX.allocate(32);
+            mX.deallocate(p);
+            ASSERT(p != mX.allocate(32));
+
+            // Blocks larger than the largest size class are not reused.
+
+            const bsls::Types::size_type BIG =
+                                bdlma::SizeClassFreeList::k_MAX_BLOCK_SIZE + 1;
+
+            p = mX.allocate(BIG);
+            mr.deallocate(p, BIG, 1);
+            ASSERT(p != mX.allocate(BIG));
+
+            // `release` and `rewind` discard retained blocks.
+
+            p = mX.allocate(64);
+            mr.deallocate(p, 64, 8);
+            mX.release();
+            ASSERT(true == X.isBlockReuseEnabled());
+            ASSERT(0 == objectAllocator.numBlocksInUse());
+
+            q = static_cast<char *>(mX.allocate(8));
+            p = mX.allocate(64);
+            mr.deallocate(p, 64, 8);
+            mX.rewind();
+            ASSERT(q == mX.allocate(64));
+
+            // Block reuse can be disabled again.
+
+            mX.rewind();
+            p = mX.allocate(8);
+            mr.deallocate(p, 8, 8);
+            mX.rewind();
+            mX.setBlockReuse(false);
+            ASSERT(false == X.isBlockReuseEnabled());
+            q = static_cast<char *>(mX.allocate(8));
+            ASSERT(p == q);
+            ASSERT(q + 8 == mX.allocate(8));
+        }
+        ASSERT(0 == objectAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting bounded growth." << endl;
+        {
+            for (int reuse = 0; reuse < 2; ++reuse) {
+                Obj mX(&objectAllocator);
+                mX.setBlockReuse(0 != reuse);
+
+                bsls::Types::Int64 bytesInUse = 0;
+                for (int i = 0; i < 20; ++i) {
+                    bsl::vector<int> v(&mX);
+                    for (int j = 0; j < 200; ++j) {
+                        v.push_back(j);
+                    }
+                    if (0 == i) {
+                        bytesInUse = objectAllocator.numBytesInUse();
+                    }
+                }
+                if (veryVerbose) {
+                    T_ P_(reuse) P_(bytesInUse)
+                    P(objectAllocator.numBytesInUse())
+                }
+                if (reuse) {
+                    ASSERTV(bytesInUse, objectAllocator.numBytesInUse(),
+                            bytesInUse == objectAllocator.numBytesInUse());
+                }
+                else {
+                    ASSERTV(bytesInUse, objectAllocator.numBytesInUse(),
+                            bytesInUse < objectAllocator.numBytesInUse());
+                }
+            }
+        }
+        ASSERT(0 == objectAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\nTesting `expand`." << endl;
+        {
+            Obj mX(k_DEFAULT_SIZE, bsls::Alignment::BSLS_BYTEALIGNED,
+                   &objectAllocator);
+
+            char *p = static_cast<char *>(mX.allocate(8));
+            char *q = static_cast<char *>(mX.allocate(8));
+
+            ASSERT( 8 == mX.expand(p, 8, 16));
+            ASSERT(16 == mX.expand(q, 8, 16));
+            ASSERT(q + 16 == mX.allocate(1));
+
+            char *r = static_cast<char *>(mX.allocate(8));
+            ASSERT(8 == mX.expand(r, 8, 2 * k_DEFAULT_SIZE));
+            ASSERT(r + 8 == mX.allocate(1));
+        }
+        ASSERT(0 == objectAllocator.numBlocksInUse());
+      } break;
       case 7: {
         // --------------------------------------------------------------------
         // `reserveCapacity` TEST
@@ -571,6 +571,23 @@ class SequentialPool {
     template <class TYPE>
     void deleteObject(const TYPE *object);
 
+    /// Increase the amount of memory allocated at the specified `address`
+    /// from the specified `originalSize` (in bytes) to the specified
+    /// `newSize` (in bytes) in place.  Return `newSize` after expanding, or
+    /// `originalSize` if the memory block at `address` cannot be expanded
+    /// to `newSize`.  This method can only `expand` the memory block
+    /// returned by the most recent `allocate` request from this memory
+    /// pool, and only if the current internal buffer has sufficient
+    /// remaining space, and otherwise has no effect.  The behavior is
+    /// undefined unless the memory block at `address` was originally
+    /// allocated by this memory pool, the size of the memory block at
+    /// `address` is `originalSize`, `originalSize <= newSize`, and
+    /// `release` was not called after allocating the memory block at
+    /// `address`.
+    bsls::Types::size_type expand(void                   *address,
+                                  bsls::Types::size_type  originalSize,
+                                  bsls::Types::size_type  newSize);
+
     /// Release all memory allocated through this pool and return to the
     /// underlying allocator *all* memory.  The pool is reset to its
     /// default-constructed state, retaining the alignment and growth
@@ -747,6 +764,18 @@ void SequentialPool::deleteObject(const TYPE *object)
     deleteObjectRaw(object);
 }
 
+inline
+bsls::Types::size_type SequentialPool::expand(
+                                          void                   *address,
+                                          bsls::Types::size_type  originalSize,
+                                          bsls::Types::size_type  newSize)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(originalSize <= newSize);
+
+    return d_bufferManager.expand(address, originalSize, newSize);
+}
+
 inline
 bsls::Types::size_type SequentialPool::truncate(
                                           void                   *address,
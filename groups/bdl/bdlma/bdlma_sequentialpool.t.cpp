@@ -88,6 +88,7 @@ using namespace bsl;
 // // MANIPULATORS
 // [ 4] void *allocate(size_type size);
 // [ 7] void *allocateAndExpand(size_type *size);
+// [14] size_type expand(void *address, size_type orig, size_type new);
 // [ 6] void deleteObjectRaw(const TYPE *object);
 // [ 6] void deleteObject(const TYPE *object);
 // [ 5] void release();
@@ -99,7 +100,7 @@ using namespace bsl;
 // [ 1] BREATHING TEST
 // [ 2] HELPER FUNCTION: `int blockSize(numBytes)`
 // [10] FREE FUNCTION: `operator new(size_t, bdlma::SequentialPool)`
-// [14] USAGE EXAMPLE
+// [15] USAGE EXAMPLE
 // [13] DRQS 135423849: LARGE ALLOCATION FAILURE ON 32-BIT BUILDS
 
 //=============================================================================
@@ -534,7 +535,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:
-      case 14: {
+      case 15: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -557,6 +558,73 @@ int main(int argc, char *argv[])
                           << "=============" << endl;
 
       } break;
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING `expand`
+        //
+        // Concerns:
+        // 1. `expand` grows the most recently allocated block in place, up to
+        //    the end of the current internal buffer, and returns `newSize`.
+        //
+        // 2. `expand` leaves any other block, or a block that cannot grow
+        //    within the current internal buffer, unchanged and returns
+        //    `originalSize`.
+        //
+        // 3. `expand` never allocates memory.
+        //
+        // 4. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Using a byte-aligned pool supplied with a test allocator, allocate
+        //    two blocks, and verify that only the second can be expanded and
+        //    that the next allocation follows the expanded block.  (C-1..2)
+        //
+        // 2. Attempt to expand the last block beyond the internal buffer and
+        //    verify that the block is unchanged and that no memory was
+        //    allocated.  (C-2..3)
+        //
+        // 3. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   size_type expand(void *address, size_type orig, size_type new);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "TESTING `expand`" << endl
+                                  << "================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        {
+            Obj mX(k_DEFAULT_SIZE, bsls::Alignment::BSLS_BYTEALIGNED, &ta);
+
+            char *p = static_cast<char *>(mX.allocate(8));
+            char *q = static_cast<char *>(mX.allocate(8));
+
+            const bsls::Types::Int64 NUM_BYTES = ta.numBytesInUse();
+
+            ASSERT( 8 == mX.expand(p, 8, 16));
+            ASSERT(16 == mX.expand(q, 8, 16));
+            ASSERT(16 == mX.expand(q, 16, 16));
+            ASSERT(q + 16 == mX.allocate(1));
+
+            char *r = static_cast<char *>(mX.allocate(8));
+
+            ASSERT(8 == mX.expand(r, 8, 2 * k_DEFAULT_SIZE));
+            ASSERT(r + 8 == mX.allocate(1));
+
+            ASSERT(NUM_BYTES == ta.numBytesInUse());
+
+            if (verbose) cout << "\nNegative Testing." << endl;
+            {
+                bsls::AssertTestHandlerGuard hG;
+
+                ASSERT_FAIL(mX.expand(0, 8, 16));
+                ASSERT_FAIL(mX.expand(r, 16, 8));
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // DRQS 135423849: LARGE ALLOCATION FAILURE ON 32-BIT BUILDS
@@ -0,0 +1,55 @@
+// bdlma_sizeclassfreelist.cpp                                        -*-C++-*-
+#include <bdlma_sizeclassfreelist.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_sizeclassfreelist_cpp,"$Id$ $CSID$")
+
+namespace BloombergLP {
+namespace bdlma {
+
+                         // -----------------------
+                         // class SizeClassFreeList
+                         // -----------------------
+
+// ACCESSORS
+bool SizeClassFreeList::isEmpty() const
+{
+    for (int i = 0; i < k_NUM_SIZE_CLASSES; ++i) {
+        if (d_heads[i]) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+int SizeClassFreeList::numBlocks(int sizeClass) const
+{
+    BSLS_ASSERT(0 <= sizeClass);
+    BSLS_ASSERT(sizeClass < k_NUM_SIZE_CLASSES);
+
+    int count = 0;
+    for (const void *block = d_heads[sizeClass]; block;
+                                                     block = loadNext(block)) {
+        ++count;
+    }
+    return count;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,313 @@
+// bdlma_sizeclassfreelist.h                                          -*-C++-*-
+#ifndef INCLUDED_BDLMA_SIZECLASSFREELIST
+#define INCLUDED_BDLMA_SIZECLASSFREELIST
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide free lists of returned memory blocks segregated by size.
+//
+//@CLASSES:
+//  bdlma::SizeClassFreeList: size-segregated free lists of reusable blocks
+//
+//@SEE_ALSO: bdlma_sequentialallocator, bdlma_bufferedsequentialallocator
+//
+//@DESCRIPTION: This component provides a low-level mechanism,
+// `bdlma::SizeClassFreeList`, that retains memory blocks returned to it on a
+// small, fixed set of singly-linked (LIFO) free lists, one per power-of-two
+// *size* *class*, so that the blocks can be handed out again to satisfy later
+// requests of a similar size.  The free lists do not own any memory: a block
+// is threaded onto a free list in place (its first bytes are overwritten with
+// a link pointer), and the memory continues to be owned by whatever allocator
+// originally supplied it.  Consequently, `reset` merely forgets all retained
+// blocks, and must be called whenever the owning allocator reclaims its
+// memory wholesale (e.g., on `release` or `rewind`).
+//
+// A `bdlma::SizeClassFreeList` is intended to be embedded in allocators that
+// dispense memory sequentially and otherwise never reuse a deallocated block
+// (such as `bdlma::SequentialAllocator`), to bound their growth when memory is
+// repeatedly allocated and returned (e.g., when a container grows its
+// capacity).
+//
+///Size Classes
+///------------
+// Size class `i` (for `0 <= i < k_NUM_SIZE_CLASSES`) comprises blocks of
+// exactly `blockSize(i) == k_MIN_BLOCK_SIZE << i` bytes, and `sizeClass(n)`
+// returns the smallest size class whose block size is at least `n` (or -1 if
+// `k_MAX_BLOCK_SIZE < n`).  An allocator using this component rounds each
+// request of `n <= k_MAX_BLOCK_SIZE` bytes up to `blockSize(sizeClass(n))`
+// bytes, first attempting to satisfy the request from the free list of
+// `sizeClass(n)`, and returns a block deallocated with size `n` to that same
+// free list.  Note that this requires the size of a block to be supplied on
+// deallocation, and that the rounding be applied to *every* block that is
+// subsequently returned to the free lists.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reusing Blocks Returned to a Buffer-Based Allocator
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a simple bump-pointer allocation scheme over a fixed buffer
+// that we would like to extend so that returned blocks (whose sizes are
+// known) are recycled.  First, we create the buffer and the free lists:
+// ```
+// bsls::AlignedBuffer<1024> buffer;
+// bsls::Types::size_type    cursor = 0;
+// bdlma::SizeClassFreeList  freeList;
+// ```
+// Then, we allocate a 24-byte block, first consulting the free list of the
+// corresponding size class, and otherwise allocating a block of the rounded
+// size from the buffer:
+// ```
+// int sizeClass = bdlma::SizeClassFreeList::sizeClass(24);
+// assert(2  == sizeClass);
+// assert(32 == bdlma::SizeClassFreeList::blockSize(sizeClass));
+//
+// void *p = freeList.allocate(sizeClass);
+// assert(0 == p);
+//
+// p       = buffer.buffer() + cursor;
+// cursor += bdlma::SizeClassFreeList::blockSize(sizeClass);
+// ```
+// Next, we return the block to the free lists:
+// ```
+// freeList.deallocate(p, sizeClass);
+// assert(1 == freeList.numBlocks(sizeClass));
+// ```
+// Now, a later request for a block of between 17 and 32 bytes is satisfied by
+// the block that was returned:
+// ```
+// sizeClass = bdlma::SizeClassFreeList::sizeClass(20);
+// assert(2 == sizeClass);
+//
+// void *q = freeList.allocate(sizeClass);
+// assert(p == q);
+// assert(0 == freeList.numBlocks(sizeClass));
+// ```
+// Finally, if the buffer is reclaimed wholesale, we must `reset` the free
+// lists so that no block in the buffer is handed out again:
+// ```
+// freeList.deallocate(q, sizeClass);
+// cursor = 0;
+// freeList.reset();
+// assert(true == freeList.isEmpty());
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+#include <bsl_cstring.h>
+
+namespace BloombergLP {
+namespace bdlma {
+
+                         // =======================
+                         // class SizeClassFreeList
+                         // =======================
+
+/// This class implements a set of LIFO free lists, segregated by
+/// power-of-two size class, that retain memory blocks (owned elsewhere) for
+/// later reuse.  See the {Size Classes} section of the component-level
+/// documentation.
+class SizeClassFreeList {
+
+  public:
+    // PUBLIC TYPES
+    enum {
+        k_MIN_BLOCK_SIZE_LOG2 =  3,  // base-2 log of the smallest block size
+
+        k_NUM_SIZE_CLASSES    = 10,  // number of size classes
+
+        k_MIN_BLOCK_SIZE      = 1 << k_MIN_BLOCK_SIZE_LOG2,
+                                     // block size of size class 0
+
+        k_MAX_BLOCK_SIZE      = k_MIN_BLOCK_SIZE << (k_NUM_SIZE_CLASSES - 1)
+                                     // block size of the largest size class
+    };
+
+  private:
+    // DATA
+    void *d_heads[k_NUM_SIZE_CLASSES];  // head of each free list (or 0)
+
+  private:
+    // PRIVATE CLASS METHODS
+
+    /// Return the address of the next block on the free list that is
+    /// threaded through the specified `block`.
+    static void *loadNext(const void *block);
+
+    /// Store the specified `next` address as the link of the free list
+    /// threaded through the specified `block`.  Note that `block` need not
+    /// be aligned for a pointer.
+    static void storeNext(void *block, void *next);
+
+    // NOT IMPLEMENTED
+    SizeClassFreeList(const SizeClassFreeList&);
+    SizeClassFreeList& operator=(const SizeClassFreeList&);
+
+  public:
+    // CLASS METHODS
+
+    /// Return the block size (in bytes) of the specified `sizeClass`.  The
+    /// behavior is undefined unless `0 <= sizeClass < k_NUM_SIZE_CLASSES`.
+    static bsls::Types::size_type blockSize(int sizeClass);
+
+    /// Return the index of the smallest size class whose block size is at
+    /// least the specified `size`, or -1 if `k_MAX_BLOCK_SIZE < size`.  The
+    /// behavior is undefined unless `0 < size`.
+    static int sizeClass(bsls::Types::size_type size);
+
+    // CREATORS
+
+    /// Create an object having empty free lists.
+    SizeClassFreeList();
+
+    // MANIPULATORS
+
+    /// Remove the most recently retained block from the free list of the
+    /// specified `sizeClass` and return its address, or return 0 if that
+    /// free list is empty.  The behavior is undefined unless
+    /// `0 <= sizeClass < k_NUM_SIZE_CLASSES`.
+    void *allocate(int sizeClass);
+
+    /// Retain the block at the specified `address` on the free list of the
+    /// specified `sizeClass` for reuse by a subsequent call to `allocate`.
+    /// The behavior is undefined unless
+    /// `0 <= sizeClass < k_NUM_SIZE_CLASSES`, `address` refers to at least
+    /// `blockSize(sizeClass)` bytes of memory that remain valid until the
+    /// block is returned by `allocate` or `reset` is called, and the block
+    /// is not already retained by this object.
+    void deallocate(void *address, int sizeClass);
+
+    /// Forget all blocks retained by this object.  Note that no memory is
+    /// deallocated.
+    void reset();
+
+    // ACCESSORS
+
+    /// Return `true` if no blocks are retained by this object, and `false`
+    /// otherwise.
+    bool isEmpty() const;
+
+    /// Return the number of blocks retained on the free list of the
+    /// specified `sizeClass`.  The behavior is undefined unless
+    /// `0 <= sizeClass < k_NUM_SIZE_CLASSES`.  Note that this method runs
+    /// in time linear in the length of the free list.
+    int numBlocks(int sizeClass) const;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                         // -----------------------
+                         // class SizeClassFreeList
+                         // -----------------------
+
+// PRIVATE CLASS METHODS
+inline
+void *SizeClassFreeList::loadNext(const void *block)
+{
+    void *next;
+    bsl::memcpy(&next, block, sizeof next);
+    return next;
+}
+
+inline
+void SizeClassFreeList::storeNext(void *block, void *next)
+{
+    bsl::memcpy(block, &next, sizeof next);
+}
+
+// CLASS METHODS
+inline
+bsls::Types::size_type SizeClassFreeList::blockSize(int sizeClass)
+{
+    BSLS_ASSERT(0 <= sizeClass);
+    BSLS_ASSERT(sizeClass < k_NUM_SIZE_CLASSES);
+
+    return static_cast<bsls::Types::size_type>(k_MIN_BLOCK_SIZE) << sizeClass;
+}
+
+inline
+int SizeClassFreeList::sizeClass(bsls::Types::size_type size)
+{
+    BSLS_ASSERT(0 < size);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(k_MAX_BLOCK_SIZE < size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return -1;                                                    // RETURN
+    }
+    if (size <= k_MIN_BLOCK_SIZE) {
+        return 0;                                                     // RETURN
+    }
+    return bdlb::BitUtil::log2(static_cast<bsls::Types::Uint64>(size))
+                                                       - k_MIN_BLOCK_SIZE_LOG2;
+}
+
+// CREATORS
+inline
+SizeClassFreeList::SizeClassFreeList()
+{
+    reset();
+}
+
+// MANIPULATORS
+inline
+void *SizeClassFreeList::allocate(int sizeClass)
+{
+    BSLS_ASSERT(0 <= sizeClass);
+    BSLS_ASSERT(sizeClass < k_NUM_SIZE_CLASSES);
+
+    void *result = d_heads[sizeClass];
+    if (result) {
+        d_heads[sizeClass] = loadNext(result);
+    }
+    return result;
+}
+
+inline
+void SizeClassFreeList::deallocate(void *address, int sizeClass)
+{
+    BSLS_ASSERT(address);
+    BSLS_ASSERT(0 <= sizeClass);
+    BSLS_ASSERT(sizeClass < k_NUM_SIZE_CLASSES);
+
+    storeNext(address, d_heads[sizeClass]);
+    d_heads[sizeClass] = address;
+}
+
+inline
+void SizeClassFreeList::reset()
+{
+    for (int i = 0; i < k_NUM_SIZE_CLASSES; ++i) {
+        d_heads[i] = 0;
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,489 @@
+// bdlma_sizeclassfreelist.t.cpp                                      -*-C++-*-
+#include <bdlma_sizeclassfreelist.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_asserttest.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// A `bdlma::SizeClassFreeList` is a mechanism that threads returned blocks of
+// memory onto one LIFO free list per size class.  The class methods are pure
+// functions, and are tested exhaustively over the range of sizes they map to
+// size classes.  The manipulators are tested by threading blocks carved out of
+// a local buffer onto the free lists, and verifying (via the accessors) that
+// the blocks are handed out again in LIFO order from the free list of the
+// size class on which they were retained, and that `reset` forgets them.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] size_type blockSize(int sizeClass);
+// [ 2] int sizeClass(size_type size);
+//
+// CREATORS
+// [ 3] SizeClassFreeList();
+//
+// MANIPULATORS
+// [ 3] void *allocate(int sizeClass);
+// [ 3] void deallocate(void *address, int sizeClass);
+// [ 3] void reset();
+//
+// ACCESSORS
+// [ 3] bool isEmpty() const;
+// [ 3] int numBlocks(int sizeClass) const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::SizeClassFreeList Obj;
+typedef bsls::Types::size_type   size_type;
+
+enum {
+    k_NUM_CLASSES = Obj::k_NUM_SIZE_CLASSES,
+    k_MAX_SIZE    = Obj::k_MAX_BLOCK_SIZE
+};
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Reusing Blocks Returned to a Buffer-Based Allocator
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a simple bump-pointer allocation scheme over a fixed buffer
+// that we would like to extend so that returned blocks (whose sizes are
+// known) are recycled.  First, we create the buffer and the free lists:
+// ```
+    bsls::AlignedBuffer<1024> buffer;
+    bsls::Types::size_type    cursor = 0;
+    bdlma::SizeClassFreeList  freeList;
+// ```
+// Then, we allocate a 24-byte block, first consulting the free list of the
+// corresponding size class, and otherwise allocating a block of the rounded
+// size from the buffer:
+// ```
+    int sizeClass = bdlma::SizeClassFreeList::sizeClass(24);
+    ASSERT(2  == sizeClass);
+    ASSERT(32 == bdlma::SizeClassFreeList::blockSize(sizeClass));
+
+    void *p = freeList.allocate(sizeClass);
+    ASSERT(0 == p);
+
+    p       = buffer.buffer() + cursor;
+    cursor += bdlma::SizeClassFreeList::blockSize(sizeClass);
+// ```
+// Next, we return the block to the free lists:
+// ```
+    freeList.deallocate(p, sizeClass);
+    ASSERT(1 == freeList.numBlocks(sizeClass));
+// ```
+// Now, a later request for a block of between 17 and 32 bytes is satisfied by
+// the block that was returned:
+// ```
+    sizeClass = bdlma::SizeClassFreeList::sizeClass(20);
+    ASSERT(2 == sizeClass);
+
+    void *q = freeList.allocate(sizeClass);
+    ASSERT(p == q);
+    ASSERT(0 == freeList.numBlocks(sizeClass));
+// ```
+// Finally, if the buffer is reclaimed wholesale, we must `reset` the free
+// lists so that no block in the buffer is handed out again:
+// ```
+    freeList.deallocate(q, sizeClass);
+    cursor = 0;
+    freeList.reset();
+    ASSERT(true == freeList.isEmpty());
+// ```
+
+        (void)cursor;
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        // 1. A default-constructed object retains no blocks.
+        //
+        // 2. `allocate` returns 0 if the free list of the specified size class
+        //    is empty.
+        //
+        // 3. Blocks passed to `deallocate` are returned by `allocate` in LIFO
+        //    order, and only for the size class on which they were retained.
+        //
+        // 4. Blocks need not be aligned for a pointer.
+        //
+        // 5. `reset` forgets all retained blocks.
+        //
+        // 6. `isEmpty` and `numBlocks` reflect the retained blocks.
+        //
+        // 7. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Create an object and verify that it is empty and that
+        //    `allocate` returns 0 for every size class.  (C-1..2)
+        //
+        // 2. For each size class, thread blocks carved (at an odd offset) out
+        //    of a local buffer onto the free list of that size class, and
+        //    verify with the accessors that only that free list grows.  Then
+        //    `allocate` the blocks back and verify the LIFO order.  (C-3..4,
+        //    6)
+        //
+        // 3. Retain blocks on several size classes, call `reset`, and verify
+        //    that the object is empty.  (C-5..6)
+        //
+        // 4. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-7)
+        //
+        // Testing:
+        //   SizeClassFreeList();
+        //   void *allocate(int sizeClass);
+        //   void deallocate(void *address, int sizeClass);
+        //   void reset();
+        //   bool isEmpty() const;
+        //   int numBlocks(int sizeClass) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MANIPULATORS AND ACCESSORS" << endl
+                          << "==========================" << endl;
+
+        enum { k_NUM_BLOCKS = 4 };
+
+        static bsls::AlignedBuffer<k_NUM_BLOCKS * k_MAX_SIZE + 1> buffer;
+        char *const base = buffer.buffer() + 1;  // deliberately misaligned
+
+        if (verbose) cout << "\nTesting a default-constructed object." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(true == X.isEmpty());
+
+            for (int i = 0; i < k_NUM_CLASSES; ++i) {
+                ASSERTV(i, 0 == X.numBlocks(i));
+                ASSERTV(i, 0 == mX.allocate(i));
+            }
+        }
+
+        if (verbose) cout << "\nTesting `allocate` and `deallocate`." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            for (int i = 0; i < k_NUM_CLASSES; ++i) {
+                const size_type SIZE = Obj::blockSize(i);
+
+                for (int j = 0; j < k_NUM_BLOCKS; ++j) {
+                    mX.deallocate(base + j * SIZE, i);
+
+                    ASSERTV(i, j, false == X.isEmpty());
+
+                    for (int k = 0; k < k_NUM_CLASSES; ++k) {
+                        ASSERTV(i, j, k, X.numBlocks(k),
+                                (k == i ? j + 1 : 0) == X.numBlocks(k));
+                    }
+                }
+
+                for (int j = k_NUM_BLOCKS - 1; 0 <= j; --j) {
+                    void *p = mX.allocate(i);
+                    ASSERTV(i, j, base + j * SIZE == p);
+                    ASSERTV(i, j, j == X.numBlocks(i));
+                }
+
+                ASSERTV(i, 0 == mX.allocate(i));
+                ASSERTV(i, true == X.isEmpty());
+            }
+        }
+
+        if (verbose) cout << "\nTesting `reset`." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            mX.reset();
+            ASSERT(true == X.isEmpty());
+
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                mX.deallocate(base + i * k_MAX_SIZE, i);
+            }
+            ASSERT(false == X.isEmpty());
+
+            mX.reset();
+            ASSERT(true == X.isEmpty());
+
+            for (int i = 0; i < k_NUM_CLASSES; ++i) {
+                ASSERTV(i, 0 == X.numBlocks(i));
+                ASSERTV(i, 0 == mX.allocate(i));
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT_PASS(mX.deallocate(base, 0));
+            ASSERT_PASS(mX.deallocate(base + k_MAX_SIZE, k_NUM_CLASSES - 1));
+            ASSERT_FAIL(mX.deallocate(0, 0));
+            ASSERT_FAIL(mX.deallocate(base, -1));
+            ASSERT_FAIL(mX.deallocate(base, k_NUM_CLASSES));
+
+            ASSERT_PASS(mX.allocate(0));
+            ASSERT_PASS(mX.allocate(k_NUM_CLASSES - 1));
+            ASSERT_FAIL(mX.allocate(-1));
+            ASSERT_FAIL(mX.allocate(k_NUM_CLASSES));
+
+            ASSERT_PASS(X.numBlocks(0));
+            ASSERT_PASS(X.numBlocks(k_NUM_CLASSES - 1));
+            ASSERT_FAIL(X.numBlocks(-1));
+            ASSERT_FAIL(X.numBlocks(k_NUM_CLASSES));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CLASS METHODS
+        //
+        // Concerns:
+        // 1. `blockSize` returns `k_MIN_BLOCK_SIZE << sizeClass`, and the
+        //    block size of the largest size class is `k_MAX_BLOCK_SIZE`.
+        //
+        // 2. `sizeClass` returns the smallest size class whose block size is
+        //    at least the specified size, for every size up to
+        //    `k_MAX_BLOCK_SIZE`, and -1 for any larger size.
+        //
+        // 3. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Verify `blockSize` for every size class.  (C-1)
+        //
+        // 2. For every size in `[1 .. k_MAX_BLOCK_SIZE]`, verify that the
+        //    block size of the returned size class is at least the size, and
+        //    that the block size of the preceding size class (if any) is
+        //    less than the size.  Verify that sizes beyond
+        //    `k_MAX_BLOCK_SIZE` (including the largest representable size)
+        //    yield -1.  (C-2)
+        //
+        // 3. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-3)
+        //
+        // Testing:
+        //   size_type blockSize(int sizeClass);
+        //   int sizeClass(size_type size);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CLASS METHODS" << endl
+                          << "=============" << endl;
+
+        if (verbose) cout << "\nTesting `blockSize`." << endl;
+        {
+            for (int i = 0; i < k_NUM_CLASSES; ++i) {
+                const size_type EXP = size_type(Obj::k_MIN_BLOCK_SIZE) << i;
+
+                ASSERTV(i, EXP == Obj::blockSize(i));
+            }
+            ASSERT(k_MAX_SIZE == Obj::blockSize(k_NUM_CLASSES - 1));
+        }
+
+        if (verbose) cout << "\nTesting `sizeClass`." << endl;
+        {
+            for (size_type size = 1; size <= k_MAX_SIZE; ++size) {
+                const int SC = Obj::sizeClass(size);
+
+                if (veryVerbose) { T_ P_(size) P(SC) }
+
+                ASSERTV(size, SC, 0 <= SC && SC < k_NUM_CLASSES);
+                ASSERTV(size, SC, size <= Obj::blockSize(SC));
+                ASSERTV(size, SC, 0 == SC || Obj::blockSize(SC - 1) < size);
+            }
+
+            ASSERT(-1 == Obj::sizeClass(k_MAX_SIZE + 1));
+            ASSERT(-1 == Obj::sizeClass(2 * k_MAX_SIZE));
+            ASSERT(-1 == Obj::sizeClass(~size_type(0)));
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_PASS(Obj::blockSize(0));
+            ASSERT_PASS(Obj::blockSize(k_NUM_CLASSES - 1));
+            ASSERT_FAIL(Obj::blockSize(-1));
+            ASSERT_FAIL(Obj::blockSize(k_NUM_CLASSES));
+
+            ASSERT_PASS(Obj::sizeClass(1));
+            ASSERT_FAIL(Obj::sizeClass(0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Map a few sizes to size classes, retain and reuse a few blocks,
+        //    and reset the free lists.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        ASSERT(0 == Obj::sizeClass(1));
+        ASSERT(0 == Obj::sizeClass(8));
+        ASSERT(1 == Obj::sizeClass(9));
+        ASSERT(2 == Obj::sizeClass(32));
+        ASSERT(3 == Obj::sizeClass(33));
+
+        bsls::AlignedBuffer<256> buffer;
+        char *const              base = buffer.buffer();
+
+        Obj mX;  const Obj& X = mX;
+
+        ASSERT(X.isEmpty());
+
+        mX.deallocate(base,      1);
+        mX.deallocate(base + 16, 1);
+        mX.deallocate(base + 64, 3);
+
+        ASSERT(!X.isEmpty());
+        ASSERT(2 == X.numBlocks(1));
+        ASSERT(1 == X.numBlocks(3));
+
+        ASSERT(base + 16 == mX.allocate(1));
+        ASSERT(base      == mX.allocate(1));
+        ASSERT(0         == mX.allocate(1));
+        ASSERT(0         == mX.allocate(2));
+
+        mX.reset();
+
+        ASSERT(X.isEmpty());
+        ASSERT(0 == mX.allocate(3));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,190 @@
+// bdlmt_parallelalgorithmutil.cpp                                    -*-C++-*-
+#include <bdlmt_parallelalgorithmutil.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_parallelalgorithmutil_cpp,"$Id$ $CSID$")
+
+#include <bslma_default.h>
+
+#include <bslmt_latch.h>
+
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+
+#include <bsl_memory.h>
+
+///Implementation Notes
+///--------------------
+// `ParallelAlgorithmUtil_Runner::run` shares the state of a call between the
+// calling thread and the helper jobs through a `bsl::shared_ptr`: a helper
+// job may be dequeued long after every chunk has been processed (and after
+// `run` has returned), in which case it finds no chunk left to claim, and
+// simply releases its reference to the state.  The chunk function and its
+// context are accessed only while a chunk remains unprocessed, and hence
+// while the calling thread is still blocked in `run`.
+//
+// The default policy is stored in plain variables with constant
+// initialization, so that it can be used during the initialization of other
+// statically-initialized objects.
+
+namespace BloombergLP {
+namespace bdlmt {
+namespace {
+
+typedef int (*EnqueueFunction)(void                                *threadPool,
+                               const ParallelAlgorithmPolicy::Job&  job);
+
+void            *s_defaultThreadPool_p     = 0;
+EnqueueFunction  s_defaultEnqueueFunction  = 0;
+int              s_defaultMaxConcurrency   = 1;
+bsl::size_t      s_defaultSequentialThreshold =
+                       ParallelAlgorithmPolicy::k_DEFAULT_SEQUENTIAL_THRESHOLD;
+
+                            // ================
+                            // struct CallState
+                            // ================
+
+/// This `struct` holds the state of one call to
+/// `ParallelAlgorithmUtil_Runner::run`, shared by the calling thread and the
+/// helper jobs.
+struct CallState {
+
+    // DATA
+    bsls::AtomicInt                              d_nextChunk;  // next to claim
+    bslmt::Latch                                 d_latch;      // unprocessed
+    int                                          d_numChunks;  // chunk count
+    ParallelAlgorithmUtil_Runner::ChunkFunction  d_function;   // per chunk
+    void                                        *d_context_p;  // of function
+
+    // CREATORS
+
+    /// Create a state for processing the specified `numChunks` chunks by
+    /// invoking the specified `function` with the specified `context`.
+    CallState(int                                          numChunks,
+              ParallelAlgorithmUtil_Runner::ChunkFunction  function,
+              void                                        *context)
+    : d_nextChunk(0)
+    , d_latch(numChunks)
+    , d_numChunks(numChunks)
+    , d_function(function)
+    , d_context_p(context)
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Claim and process chunks until none is left.
+    void processChunks()
+    {
+        int chunkIndex;
+        while ((chunkIndex = d_nextChunk.addRelaxed(1) - 1) < d_numChunks) {
+            d_function(d_context_p, chunkIndex);
+            d_latch.arrive();
+        }
+    }
+};
+
+                            // ================
+                            // struct HelperJob
+                            // ================
+
+/// This `struct` is the job enqueued on the thread pool to help process the
+/// chunks of a call.
+struct HelperJob {
+
+    // DATA
+    bsl::shared_ptr<CallState> d_state;  // state of the call
+
+    // ACCESSORS
+
+    /// Process the chunks of the call that remain unclaimed.
+    void operator()() const
+    {
+        d_state->processChunks();
+    }
+};
+
+}  // close unnamed namespace
+
+                      // -----------------------------
+                      // class ParallelAlgorithmPolicy
+                      // -----------------------------
+
+// CLASS METHODS
+ParallelAlgorithmPolicy ParallelAlgorithmPolicy::defaultPolicy()
+{
+    return ParallelAlgorithmPolicy(s_defaultThreadPool_p,
+                                   s_defaultEnqueueFunction,
+                                   s_defaultMaxConcurrency,
+                                   s_defaultSequentialThreshold);
+}
+
+void ParallelAlgorithmPolicy::setDefaultPolicy(
+                                         const ParallelAlgorithmPolicy& policy)
+{
+    s_defaultThreadPool_p        = policy.d_threadPool_p;
+    s_defaultEnqueueFunction     = policy.d_enqueueFunction_p;
+    s_defaultMaxConcurrency      = policy.d_maxConcurrency;
+    s_defaultSequentialThreshold = policy.d_sequentialThreshold;
+}
+
+                     // -----------------------------------
+                     // struct ParallelAlgorithmUtil_Runner
+                     // -----------------------------------
+
+// CLASS METHODS
+void ParallelAlgorithmUtil_Runner::run(
+                                const ParallelAlgorithmPolicy&  policy,
+                                int                             numChunks,
+                                ChunkFunction                   function,
+                                void                           *context)
+{
+    BSLS_ASSERT(policy.threadPool());
+    BSLS_ASSERT(0 < numChunks);
+    BSLS_ASSERT(function);
+
+    if (1 == numChunks) {
+        function(context, 0);
+        return;                                                       // RETURN
+    }
+
+    bsl::shared_ptr<CallState> state = bsl::allocate_shared<CallState>(
+                                          bslma::Default::defaultAllocator(),
+                                          numChunks,
+                                          function,
+                                          context);
+
+    // The calling thread processes at least one chunk, so at most
+    // `numChunks - 1` helpers are useful.  If the pool refuses a job (e.g.,
+    // because it is stopped, or its queue is full), the calling thread
+    // processes the remaining chunks itself.
+
+    HelperJob job = { state };
+    for (int i = 1; i < numChunks; ++i) {
+        if (0 != policy.enqueueJob(job)) {
+            break;
+        }
+    }
+
+    state->processChunks();
+    state->d_latch.wait();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1506 @@
+// bdlmt_parallelalgorithmutil.h                                      -*-C++-*-
+#ifndef INCLUDED_BDLMT_PARALLELALGORITHMUTIL
+#define INCLUDED_BDLMT_PARALLELALGORITHMUTIL
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide parallel versions of standard algorithms on a thread pool.
+//
+//@CLASSES:
+//  bdlmt::ParallelAlgorithmPolicy: thread pool, concurrency, and threshold
+//  bdlmt::ParallelAlgorithmUtil: namespace for parallel algorithms
+//
+//@SEE_ALSO: bdlmt_threadpool, bdlmt_fixedthreadpool
+//
+//@DESCRIPTION: This component provides a utility `struct`,
+// `bdlmt::ParallelAlgorithmUtil`, offering parallel versions of a handful of
+// standard algorithms (`sort`, `stable_sort`, `for_each`, `transform`,
+// `reduce`, `inclusive_scan`, and `copy_if`) that distribute their work over
+// the threads of a BDE thread pool, and a value-semantic attribute class,
+// `bdlmt::ParallelAlgorithmPolicy`, describing how a call is to be executed.
+//
+// Every algorithm divides its input range into as many contiguous chunks as
+// the policy's `maxConcurrency` allows, enqueues one job per chunk beyond the
+// first on the policy's thread pool, and has the calling thread process
+// chunks as well until all of them are claimed; it then blocks until every
+// chunk has been processed.  Since the calling thread always takes part, an
+// algorithm may safely be called from a job running on the same thread pool
+// that it uses, and always completes even if the pool is saturated or has
+// been stopped.  Inputs shorter than the policy's `sequentialThreshold`, and
+// all calls made with a policy having no thread pool or a `maxConcurrency` of
+// 1, are executed on the calling thread by the corresponding sequential
+// standard algorithm, so that small inputs do not pay for the
+// synchronization.
+//
+// The algorithms require random-access iterators, and, unlike the standard
+// sequential algorithms, invoke the supplied functors concurrently from
+// several threads: functors must therefore be safe to call concurrently, and
+// must not throw.  `reduce` and `inclusiveScan` additionally require their
+// binary operation to be associative, since the partial results of the chunks
+// are combined in a different grouping than a left fold would use (the order
+// of the operands is preserved, so commutativity is *not* required).  Memory
+// needed for temporary results (e.g., the merge buffer of `sort`) is supplied
+// by the currently installed default allocator.
+//
+///Execution Policies
+///------------------
+// A `bdlmt::ParallelAlgorithmPolicy` holds the address of a thread pool (any
+// type providing an `int enqueueJob(const bsl::function<void()>&)` method
+// that returns 0 on success, such as `bdlmt::ThreadPool` and
+// `bdlmt::FixedThreadPool`), the maximum number of threads, including the
+// calling thread, that may work on one call, and the input size below which a
+// call is executed sequentially.  A default-constructed policy executes every
+// call sequentially.
+//
+// When the standard library provides the C++17 execution policies (see
+// `BSLS_LIBRARYFEATURES_HAS_CPP17_PARALLEL_ALGORITHMS`), a
+// `ParallelAlgorithmPolicy` is implicitly constructible from
+// `bsl::execution::seq`, which selects sequential execution, and from
+// `bsl::execution::par` and `bsl::execution::par_unseq`, which both select
+// the process-wide default policy installed by `setDefaultPolicy`.  This
+// allows code written against the standard parallel algorithms, e.g.,
+// `std::sort(std::execution::par, b, e)`, to be ported by a change of the
+// name of the called function only.  Note that `par_unseq` confers no
+// additional permission on this implementation: the elements of a chunk are
+// always processed in order.
+//
+///Thread Safety
+///-------------
+// The algorithms are *thread-safe* (i.e., may be called concurrently, with
+// the same or different policies, on disjoint ranges).  `setDefaultPolicy` is
+// *not* thread-safe: it is intended to be called once, during the
+// initialization of a task, before any other thread uses the default policy.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sorting and Summing a Large Array
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a large array of measurements that we want to sort, and
+// whose sum we want to compute, using the threads of an existing thread pool.
+//
+// First, we create and start a thread pool:
+// ```
+// bslmt::ThreadAttributes attributes;
+// bdlmt::ThreadPool       threadPool(attributes, 4, 4, 1000);
+// threadPool.start();
+// ```
+// Then, we create a policy that lets up to four threads (the calling thread
+// and three threads of the pool) work on each call:
+// ```
+// bdlmt::ParallelAlgorithmPolicy policy(&threadPool, 4);
+// ```
+// Next, we generate the measurements:
+// ```
+// bsl::vector<int> measurements;
+// for (int i = 0; i < 100000; ++i) {
+//     measurements.push_back((i * 7919) % 100003);
+// }
+// ```
+// Now, we sort them, and compute their sum:
+// ```
+// bdlmt::ParallelAlgorithmUtil::sort(policy,
+//                                    measurements.begin(),
+//                                    measurements.end());
+//
+// long long sum = bdlmt::ParallelAlgorithmUtil::reduce(policy,
+//                                                      measurements.begin(),
+//                                                      measurements.end(),
+//                                                      0LL);
+// ```
+// Finally, we verify the results:
+// ```
+// for (bsl::size_t i = 1; i < measurements.size(); ++i) {
+//     assert(measurements[i - 1] <= measurements[i]);
+// }
+// assert(bsl::accumulate(measurements.begin(),
+//                        measurements.end(),
+//                        0LL) == sum);
+//
+// threadPool.stop();
+// ```
+
+#include <bdlscm_version.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_libraryfeatures.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_functional.h>
+#include <bsl_iterator.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP17_PARALLEL_ALGORITHMS
+#include <bsl_execution.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                      // =============================
+                      // class ParallelAlgorithmPolicy
+                      // =============================
+
+/// This simply constrained (value-semantic) attribute class describes how a
+/// call to one of the algorithms of `ParallelAlgorithmUtil` is executed: the
+/// thread pool supplying the helper threads, the maximum number of threads
+/// (including the calling thread) working on the call, and the input size
+/// below which the call is executed sequentially.  The thread pool is held by
+/// address and is not owned.
+class ParallelAlgorithmPolicy {
+
+  public:
+    // TYPES
+
+    /// The type of the jobs enqueued on the thread pool.
+    typedef bsl::function<void()> Job;
+
+    enum {
+        /// The default input size below which calls execute sequentially.
+        k_DEFAULT_SEQUENTIAL_THRESHOLD = 32 * 1024
+    };
+
+  private:
+    // PRIVATE TYPES
+    typedef int (*EnqueueFunction)(void *threadPool, const Job& job);
+
+    // DATA
+    void            *d_threadPool_p;         // thread pool (held, not owned)
+
+    EnqueueFunction  d_enqueueFunction_p;    // enqueues on `d_threadPool_p`
+
+    int              d_maxConcurrency;       // threads working on one call
+
+    bsl::size_t      d_sequentialThreshold;  // minimum parallel input size
+
+    // FRIENDS
+    friend bool operator==(const ParallelAlgorithmPolicy&,
+                           const ParallelAlgorithmPolicy&);
+
+    // PRIVATE CLASS METHODS
+
+    /// Enqueue the specified `job` on the specified `threadPool`, which is
+    /// the address of a `THREAD_POOL` object.  Return 0 on success, and a
+    /// non-zero value otherwise.
+    template <class THREAD_POOL>
+    static int enqueueImp(void *threadPool, const Job& job);
+
+    // PRIVATE CREATORS
+
+    /// Create a policy having the specified attributes.
+    ParallelAlgorithmPolicy(void            *threadPool,
+                            EnqueueFunction  enqueueFunction,
+                            int              maxConcurrency,
+                            bsl::size_t      sequentialThreshold);
+
+  public:
+    // CLASS METHODS
+
+    /// Return the process-wide default policy, which is the policy most
+    /// recently installed by `setDefaultPolicy`, or a sequential policy if
+    /// `setDefaultPolicy` has never been called.
+    static ParallelAlgorithmPolicy defaultPolicy();
+
+    /// Install the specified `policy` as the process-wide default policy.
+    /// The thread pool of `policy`, if any, must outlive every use of the
+    /// default policy.  Note that this method is *not* thread-safe, and
+    /// should be called only during the initialization of a task.
+    static void setDefaultPolicy(const ParallelAlgorithmPolicy& policy);
+
+    // CREATORS
+
+    /// Create a policy that executes every call sequentially on the calling
+    /// thread.
+    ParallelAlgorithmPolicy();
+
+    /// Create a policy that distributes calls over at most the specified
+    /// `maxConcurrency` threads, the calling thread and up to
+    /// `maxConcurrency - 1` threads of the specified `threadPool`, and that
+    /// executes calls on inputs shorter than the optionally specified
+    /// `sequentialThreshold` sequentially.  If `sequentialThreshold` is not
+    /// specified, `k_DEFAULT_SEQUENTIAL_THRESHOLD` is used.  The behavior is
+    /// undefined unless `0 < maxConcurrency`.  Note that `threadPool` must
+    /// outlive every call made with this policy.
+    template <class THREAD_POOL>
+    ParallelAlgorithmPolicy(
+                        THREAD_POOL *threadPool,
+                        int          maxConcurrency,
+                        bsl::size_t  sequentialThreshold =
+                                               k_DEFAULT_SEQUENTIAL_THRESHOLD);
+
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP17_PARALLEL_ALGORITHMS
+    /// Create a policy that executes every call sequentially.
+    ParallelAlgorithmPolicy(const bsl::execution::sequenced_policy&);
+                                                                    // IMPLICIT
+
+    /// Create a policy having the value of the process-wide default policy.
+    ParallelAlgorithmPolicy(const bsl::execution::parallel_policy&);
+                                                                    // IMPLICIT
+    ParallelAlgorithmPolicy(
+                         const bsl::execution::parallel_unsequenced_policy&);
+                                                                    // IMPLICIT
+#endif
+
+    // MANIPULATORS
+
+    /// Set the input size below which calls are executed sequentially to the
+    /// specified `value`, and return a reference providing modifiable access
+    /// to this object.
+    ParallelAlgorithmPolicy& setSequentialThreshold(bsl::size_t value);
+
+    // ACCESSORS
+
+    /// Enqueue the specified `job` on the thread pool of this policy.
+    /// Return 0 on success, and a non-zero value otherwise.  The behavior is
+    /// undefined if this policy has no thread pool.
+    int enqueueJob(const Job& job) const;
+
+    /// Return `true` if every call made with this policy is executed
+    /// sequentially, i.e., if this policy has no thread pool or a maximum
+    /// concurrency of 1, and `false` otherwise.
+    bool isSequential() const;
+
+    /// Return the maximum number of threads, including the calling thread,
+    /// that work on one call made with this policy.
+    int maxConcurrency() const;
+
+    /// Return the input size below which calls are executed sequentially.
+    bsl::size_t sequentialThreshold() const;
+
+    /// Return the address of the thread pool of this policy, or 0 if this
+    /// policy has no thread pool.
+    void *threadPool() const;
+};
+
+// FREE OPERATORS
+
+/// Return `true` if the specified `lhs` and `rhs` policies have the same
+/// value, and `false` otherwise.  Two policies have the same value if they
+/// refer to the same thread pool (or to none), and have the same maximum
+/// concurrency and sequential threshold.
+bool operator==(const ParallelAlgorithmPolicy& lhs,
+                const ParallelAlgorithmPolicy& rhs);
+
+/// Return `true` if the specified `lhs` and `rhs` policies do not have the
+/// same value, and `false` otherwise.
+bool operator!=(const ParallelAlgorithmPolicy& lhs,
+                const ParallelAlgorithmPolicy& rhs);
+
+                     // ===================================
+                     // struct ParallelAlgorithmUtil_Runner
+                     // ===================================
+
+/// This component-private `struct` provides a namespace for the function
+/// distributing the chunks of a call over the calling thread and the thread
+/// pool of a policy.
+struct ParallelAlgorithmUtil_Runner {
+
+    // TYPES
+
+    /// The type of the function invoked to process a chunk: the first
+    /// argument is the context supplied to `run`, and the second the index
+    /// of the chunk.
+    typedef void (*ChunkFunction)(void *context, int chunkIndex);
+
+    // CLASS METHODS
+
+    /// Invoke the specified `function` with the specified `context` and
+    /// each chunk index in `[0 .. numChunks)`, from the calling thread and
+    /// from up to `numChunks - 1` jobs enqueued on the thread pool of the
+    /// specified `policy`, and return once every invocation has completed.
+    /// The behavior is undefined unless `policy` has a thread pool,
+    /// `0 < numChunks`, and `function` does not throw.
+    static void run(const ParallelAlgorithmPolicy&  policy,
+                    int                             numChunks,
+                    ChunkFunction                   function,
+                    void                           *context);
+
+    /// Invoke `task(i)` with the specified `task` and each chunk index `i`
+    /// in `[0 .. numChunks)`, concurrently as described for the previous
+    /// overload, using the specified `policy`.
+    template <class TASK>
+    static void run(const ParallelAlgorithmPolicy& policy,
+                    int                            numChunks,
+                    TASK&                          task);
+
+    /// Return the offset of the first element of the chunk having the
+    /// specified `chunkIndex` when a range of the specified `size` is split
+    /// into the specified `numChunks` chunks whose sizes differ by at most
+    /// one.  The behavior is undefined unless `0 <= chunkIndex <= numChunks`.
+    static bsl::size_t chunkOffset(bsl::size_t size,
+                                   int         numChunks,
+                                   int         chunkIndex);
+
+    /// Return the number of chunks into which a call on a range of the
+    /// specified `size` is split using the specified `policy`, or 0 if the
+    /// call is to be executed sequentially.
+    static int numChunks(const ParallelAlgorithmPolicy& policy,
+                         bsl::size_t                    size);
+
+    /// Invoke `(*static_cast<TASK *>(task))(chunkIndex)` for the specified
+    /// `task` and `chunkIndex`.
+    template <class TASK>
+    static void invokeTask(void *task, int chunkIndex);
+};
+
+                    // =================================
+                    // struct ParallelAlgorithmUtil_Imp
+                    // =================================
+
+/// This component-private `struct` provides a namespace for the chunk tasks
+/// implementing the algorithms of `ParallelAlgorithmUtil`.  Each task is
+/// invoked with the index of a chunk, and processes the elements of that
+/// chunk only.
+struct ParallelAlgorithmUtil_Imp {
+
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP11_BASELINE_LIBRARY
+    /// The type of an iterator moving, rather than copying, the elements
+    /// referred to by an `ITERATOR`.
+    template <class ITERATOR>
+    struct MoveIterator {
+        typedef bsl::move_iterator<ITERATOR> Type;
+    };
+#else
+    template <class ITERATOR>
+    struct MoveIterator {
+        typedef ITERATOR Type;
+    };
+#endif
+
+    /// This class template applies a functor to each element of a range.
+    template <class ITERATOR, class FUNCTION>
+    struct ForEachTask {
+        ITERATOR     d_first;      // start of the range
+        bsl::size_t  d_size;       // size of the range
+        int          d_numChunks;  // number of chunks
+        FUNCTION    *d_function_p; // functor (held, not owned)
+
+        void operator()(int chunkIndex) const;
+    };
+
+    /// This class template stores the result of a unary operation applied to
+    /// each element of a range.
+    template <class INPUT_ITERATOR, class OUTPUT_ITERATOR, class OPERATION>
+    struct TransformTask {
+        INPUT_ITERATOR   d_first;        // start of the input range
+        OUTPUT_ITERATOR  d_result;       // start of the output range
+        bsl::size_t      d_size;         // size of the range
+        int              d_numChunks;    // number of chunks
+        OPERATION       *d_operation_p;  // operation (held, not owned)
+
+        void operator()(int chunkIndex) const;
+    };
+
+    /// This class template stores the result of a binary operation applied
+    /// to each pair of corresponding elements of two ranges.
+    template <class INPUT_ITERATOR1,
+              class INPUT_ITERATOR2,
+              class OUTPUT_ITERATOR,
+              class OPERATION>
+    struct BinaryTransformTask {
+        INPUT_ITERATOR1  d_first1;       // start of the first input range
+        INPUT_ITERATOR2  d_first2;       // start of the second input range
+        OUTPUT_ITERATOR  d_result;       // start of the output range
+        bsl::size_t      d_size;         // size of the ranges
+        int              d_numChunks;    // number of chunks
+        OPERATION       *d_operation_p;  // operation (held, not owned)
+
+        void operator()(int chunkIndex) const;
+    };
+
+    /// This class template folds each chunk of a range, and stores the
+    /// result into `d_partials_p[chunkIndex]`.
+    template <class ITERATOR, class TYPE, class OPERATION>
+    struct FoldTask {
+        ITERATOR    d_first;        // start of the range
+        bsl::size_t d_size;         // size of the range
+        int         d_numChunks;    // number of chunks
+        OPERATION  *d_operation_p;  // operation (held, not owned)
+        TYPE       *d_partials_p;   // one result per chunk (held, not owned)
+
+        void operator()(int chunkIndex) const;
+    };
+
+    /// This class template stores the inclusive scan of each chunk of a
+    /// range, starting from `d_offsets_p[chunkIndex - 1]` for every chunk
+    /// but the first.
+    template <class INPUT_ITERATOR,
+              class OUTPUT_ITERATOR,
+              class TYPE,
+              class OPERATION>
+    struct ScanTask {
+        INPUT_ITERATOR   d_first;        // start of the input range
+        OUTPUT_ITERATOR  d_result;       // start of the output range
+        bsl::size_t      d_size;         // size of the range
+        int              d_numChunks;    // number of chunks
+        OPERATION       *d_operation_p;  // operation (held, not owned)
+        const TYPE      *d_offsets_p;    // fold of the preceding chunks
+
+        void operator()(int chunkIndex) const;
+    };
+
+    /// This class template records, for each element of a chunk of a range,
+    /// whether it satisfies a predicate, and stores the number of elements
+    /// of the chunk that do into `d_counts_p[chunkIndex]`.
+    template <class ITERATOR, class PREDICATE>
+    struct CountIfTask {
+        ITERATOR     d_first;         // start of the range
+        bsl::size_t  d_size;          // size of the range
+        int          d_numChunks;     // number of chunks
+        PREDICATE   *d_predicate_p;   // predicate (held, not owned)
+        char        *d_flags_p;       // one flag per element
+        bsl::size_t *d_counts_p;      // one count per chunk
+
+        void operator()(int chunkIndex) const;
+    };
+
+    /// This class template copies the flagged elements of each chunk of a
+    /// range to the output range, starting at `d_offsets_p[chunkIndex]`.
+    template <class INPUT_ITERATOR, class OUTPUT_ITERATOR>
+    struct CopyFlaggedTask {
+        INPUT_ITERATOR     d_first;      // start of the input range
+        OUTPUT_ITERATOR    d_result;     // start of the output range
+        bsl::size_t        d_size;       // size of the range
+        int                d_numChunks;  // number of chunks
+        const char        *d_flags_p;    // one flag per element
+        const bsl::size_t *d_offsets_p;  // output offset of each chunk
+
+        void operator()(int chunkIndex) const;
+    };
+
+    /// This class template sorts each chunk of a range, stably if
+    /// `d_stable` is `true`.
+    template <class ITERATOR, class COMPARATOR>
+    struct SortTask {
+        ITERATOR     d_first;          // start of the range
+        bsl::size_t  d_size;           // size of the range
+        int          d_numChunks;      // number of chunks
+        COMPARATOR  *d_comparator_p;   // comparator (held, not owned)
+        bool         d_stable;         // `true` for a stable sort
+
+        void operator()(int chunkIndex) const;
+    };
+
+    /// This class template merges pairs of adjacent sorted runs of the
+    /// source range into the destination range: task `i` merges runs `2 * i`
+    /// and `2 * i + 1`, the boundaries of run `j` being
+    /// `d_bounds_p[j]` and `d_bounds_p[j + 1]`, and moves the last run if it
+    /// has no partner.
+    template <class SOURCE_ITERATOR,
+              class DESTINATION_ITERATOR,
+              class COMPARATOR>
+    struct MergeTask {
+        SOURCE_ITERATOR       d_source;        // start of the source
+        DESTINATION_ITERATOR  d_destination;   // start of the destination
+        const bsl::size_t    *d_bounds_p;      // run boundaries
+        int                   d_numRuns;       // number of runs
+        COMPARATOR           *d_comparator_p;  // comparator (held, not owned)
+
+        void operator()(int taskIndex) const;
+    };
+
+    /// This class template moves each chunk of a range to the corresponding
+    /// position of another range.
+    template <class SOURCE_ITERATOR, class DESTINATION_ITERATOR>
+    struct MoveTask {
+        SOURCE_ITERATOR      d_source;       // start of the source
+        DESTINATION_ITERATOR d_destination;  // start of the destination
+        bsl::size_t          d_size;         // size of the ranges
+        int                  d_numChunks;    // number of chunks
+
+        void operator()(int chunkIndex) const;
+    };
+
+    // CLASS METHODS
+
+    /// Sort the specified range `[first, last)` according to the specified
+    /// `comparator`, stably if the specified `stable` flag is `true`, using
+    /// the specified `policy`.
+    template <class RANDOM_ITERATOR, class COMPARATOR>
+    static void sort(const ParallelAlgorithmPolicy& policy,
+                     RANDOM_ITERATOR                first,
+                     RANDOM_ITERATOR                last,
+                     COMPARATOR                     comparator,
+                     bool                           stable);
+};
+
+                        // ============================
+                        // struct ParallelAlgorithmUtil
+                        // ============================
+
+/// This `struct` provides a namespace for parallel versions of standard
+/// algorithms, executed as described by a `ParallelAlgorithmPolicy`.  Each
+/// function has the semantics of the standard algorithm of the same name,
+/// except for the requirements described in the component documentation.
+struct ParallelAlgorithmUtil {
+
+    // CLASS METHODS
+
+    /// Copy the elements of the specified range `[first, last)` for which
+    /// the specified `predicate` returns `true` to the range starting at the
+    /// specified `result`, preserving their relative order, using the
+    /// specified `policy`.  Return an iterator to the end of the output
+    /// range.  The behavior is undefined unless the input and output ranges
+    /// do not overlap.
+    template <class RANDOM_ITERATOR1, class RANDOM_ITERATOR2, class PREDICATE>
+    static RANDOM_ITERATOR2 copyIf(const ParallelAlgorithmPolicy& policy,
+                                   RANDOM_ITERATOR1               first,
+                                   RANDOM_ITERATOR1               last,
+                                   RANDOM_ITERATOR2               result,
+                                   PREDICATE                      predicate);
+
+    /// Invoke the specified `function` on each element of the specified
+    /// range `[first, last)`, using the specified `policy`.  Note that,
+    /// unlike `bsl::for_each`, this function does not return `function`,
+    /// since it is invoked from several threads.
+    template <class RANDOM_ITERATOR, class FUNCTION>
+    static void forEach(const ParallelAlgorithmPolicy& policy,
+                        RANDOM_ITERATOR                first,
+                        RANDOM_ITERATOR                last,
+                        FUNCTION                       function);
+
+    /// Store the inclusive prefix sums of the elements of the specified
+    /// range `[first, last)`, as combined by the specified `operation` (or
+    /// `bsl::plus` if `operation` is not specified), into the range starting
+    /// at the specified `result`, using the specified `policy`.  Return an
+    /// iterator to the end of the output range.  The output range may be
+    /// identical to the input range, but the behavior is undefined if they
+    /// otherwise overlap, or unless `operation` is associative.
+    template <class RANDOM_ITERATOR1, class RANDOM_ITERATOR2>
+    static RANDOM_ITERATOR2 inclusiveScan(
+                                        const ParallelAlgorithmPolicy& policy,
+                                        RANDOM_ITERATOR1               first,
+                                        RANDOM_ITERATOR1               last,
+                                        RANDOM_ITERATOR2               result);
+    template <class RANDOM_ITERATOR1, class RANDOM_ITERATOR2, class OPERATION>
+    static RANDOM_ITERATOR2 inclusiveScan(
+                                     const ParallelAlgorithmPolicy& policy,
+                                     RANDOM_ITERATOR1               first,
+                                     RANDOM_ITERATOR1               last,
+                                     RANDOM_ITERATOR2               result,
+                                     OPERATION                      operation);
+
+    /// Return the fold of the specified `initialValue` and the elements of
+    /// the specified range `[first, last)`, as combined by the specified
+    /// `operation` (or `bsl::plus` if `operation` is not specified), using
+    /// the specified `policy`.  The behavior is undefined unless `operation`
+    /// is associative.
+    template <class RANDOM_ITERATOR, class TYPE>
+    static TYPE reduce(const ParallelAlgorithmPolicy& policy,
+                       RANDOM_ITERATOR                first,
+                       RANDOM_ITERATOR                last,
+                       TYPE                           initialValue);
+    template <class RANDOM_ITERATOR, class TYPE, class OPERATION>
+    static TYPE reduce(const ParallelAlgorithmPolicy& policy,
+                       RANDOM_ITERATOR                first,
+                       RANDOM_ITERATOR                last,
+                       TYPE                           initialValue,
+                       OPERATION                      operation);
+
+    /// Sort the elements of the specified range `[first, last)` in
+    /// ascending order according to the specified `comparator` (or
+    /// `operator<` if `comparator` is not specified), using the specified
+    /// `policy`.  The elements must be move-constructible and
+    /// move-assignable.
+    template <class RANDOM_ITERATOR>
+    static void sort(const ParallelAlgorithmPolicy& policy,
+                     RANDOM_ITERATOR                first,
+                     RANDOM_ITERATOR                last);
+    template <class RANDOM_ITERATOR, class COMPARATOR>
+    static void sort(const ParallelAlgorithmPolicy& policy,
+                     RANDOM_ITERATOR                first,
+                     RANDOM_ITERATOR                last,
+                     COMPARATOR                     comparator);
+
+    /// Sort the elements of the specified range `[first, last)` in
+    /// ascending order according to the specified `comparator` (or
+    /// `operator<` if `comparator` is not specified), preserving the
+    /// relative order of equivalent elements, using the specified `policy`.
+    /// The elements must be move-constructible and move-assignable.
+    template <class RANDOM_ITERATOR>
+    static void stableSort(const ParallelAlgorithmPolicy& policy,
+                           RANDOM_ITERATOR                first,
+                           RANDOM_ITERATOR                last);
+    template <class RANDOM_ITERATOR, class COMPARATOR>
+    static void stableSort(const ParallelAlgorithmPolicy& policy,
+                           RANDOM_ITERATOR                first,
+                           RANDOM_ITERATOR                last,
+                           COMPARATOR                     comparator);
+
+    /// Store the result of the specified unary `operation` applied to each
+    /// element of the specified range `[first, last)` into the range
+    /// starting at the specified `result`, using the specified `policy`.
+    /// Return an iterator to the end of the output range.  The output range
+    /// may be identical to the input range, but the behavior is undefined if
+    /// they otherwise overlap.
+    template <class RANDOM_ITERATOR1, class RANDOM_ITERATOR2, class OPERATION>
+    static RANDOM_ITERATOR2 transform(
+                                     const ParallelAlgorithmPolicy& policy,
+                                     RANDOM_ITERATOR1               first,
+                                     RANDOM_ITERATOR1               last,
+                                     RANDOM_ITERATOR2               result,
+                                     OPERATION                      operation);
+
+    /// Store the result of the specified binary `operation` applied to each
+    /// element of the specified range `[first1, last1)` and the
+    /// corresponding element of the range starting at the specified
+    /// `first2` into the range starting at the specified `result`, using the
+    /// specified `policy`.  Return an iterator to the end of the output
+    /// range.  The output range may be identical to either input range, but
+    /// the behavior is undefined if they otherwise overlap.
+    template <class RANDOM_ITERATOR1,
+              class RANDOM_ITERATOR2,
+              class RANDOM_ITERATOR3,
+              class OPERATION>
+    static RANDOM_ITERATOR3 transform(
+                                     const ParallelAlgorithmPolicy& policy,
+                                     RANDOM_ITERATOR1               first1,
+                                     RANDOM_ITERATOR1               last1,
+                                     RANDOM_ITERATOR2               first2,
+                                     RANDOM_ITERATOR3               result,
+                                     OPERATION                      operation);
+};
+
+// ============================================================================
+//                          INLINE DEFINITIONS
+// ============================================================================
+
+                      // -----------------------------
+                      // class ParallelAlgorithmPolicy
+                      // -----------------------------
+
+// PRIVATE CLASS METHODS
+template <class THREAD_POOL>
+int ParallelAlgorithmPolicy::enqueueImp(void *threadPool, const Job& job)
+{
+    return static_cast<THREAD_POOL *>(threadPool)->enqueueJob(job);
+}
+
+// PRIVATE CREATORS
+inline
+ParallelAlgorithmPolicy::ParallelAlgorithmPolicy(
+                                   void            *threadPool,
+                                   EnqueueFunction  enqueueFunction,
+                                   int              maxConcurrency,
+                                   bsl::size_t      sequentialThreshold)
+: d_threadPool_p(threadPool)
+, d_enqueueFunction_p(enqueueFunction)
+, d_maxConcurrency(maxConcurrency)
+, d_sequentialThreshold(sequentialThreshold)
+{
+}
+
+// CREATORS
+inline
+ParallelAlgorithmPolicy::ParallelAlgorithmPolicy()
+: d_threadPool_p(0)
+, d_enqueueFunction_p(0)
+, d_maxConcurrency(1)
+, d_sequentialThreshold(k_DEFAULT_SEQUENTIAL_THRESHOLD)
+{
+}
+
+template <class THREAD_POOL>
+ParallelAlgorithmPolicy::ParallelAlgorithmPolicy(
+                                       THREAD_POOL *threadPool,
+                                       int          maxConcurrency,
+                                       bsl::size_t  sequentialThreshold)
+: d_threadPool_p(threadPool)
+, d_enqueueFunction_p(threadPool ? &enqueueImp<THREAD_POOL> : 0)
+, d_maxConcurrency(maxConcurrency)
+, d_sequentialThreshold(sequentialThreshold)
+{
+    BSLS_ASSERT(0 < maxConcurrency);
+}
+
+#ifdef BSLS_LIBRARYFEATURES_HAS_CPP17_PARALLEL_ALGORITHMS
+inline
+ParallelAlgorithmPolicy::ParallelAlgorithmPolicy(
+                                       const bsl::execution::sequenced_policy&)
+: d_threadPool_p(0)
+, d_enqueueFunction_p(0)
+, d_maxConcurrency(1)
+, d_sequentialThreshold(k_DEFAULT_SEQUENTIAL_THRESHOLD)
+{
+}
+
+inline
+ParallelAlgorithmPolicy::ParallelAlgorithmPolicy(
+                                        const bsl::execution::parallel_policy&)
+{
+    *this = defaultPolicy();
+}
+
+inline
+ParallelAlgorithmPolicy::ParallelAlgorithmPolicy(
+                            const bsl::execution::parallel_unsequenced_policy&)
+{
+    *this = defaultPolicy();
+}
+#endif
+
+// MANIPULATORS
+inline
+ParallelAlgorithmPolicy&
+ParallelAlgorithmPolicy::setSequentialThreshold(bsl::size_t value)
+{
+    d_sequentialThreshold = value;
+    return *this;
+}
+
+// ACCESSORS
+inline
+int ParallelAlgorithmPolicy::enqueueJob(const Job& job) const
+{
+    BSLS_ASSERT(d_enqueueFunction_p);
+
+    return d_enqueueFunction_p(d_threadPool_p, job);
+}
+
+inline
+bool ParallelAlgorithmPolicy::isSequential() const
+{
+    return 0 == d_threadPool_p || 1 >= d_maxConcurrency;
+}
+
+inline
+int ParallelAlgorithmPolicy::maxConcurrency() const
+{
+    return d_maxConcurrency;
+}
+
+inline
+bsl::size_t ParallelAlgorithmPolicy::sequentialThreshold() const
+{
+    return d_sequentialThreshold;
+}
+
+inline
+void *ParallelAlgorithmPolicy::threadPool() const
+{
+    return d_threadPool_p;
+}
+
+                     // -----------------------------------
+                     // struct ParallelAlgorithmUtil_Runner
+                     // -----------------------------------
+
+// CLASS METHODS
+template <class TASK>
+inline
+void ParallelAlgorithmUtil_Runner::run(
+                                      const ParallelAlgorithmPolicy& policy,
+                                      int                            numChunks,
+                                      TASK&                          task)
+{
+    run(policy, numChunks, &invokeTask<TASK>, &task);
+}
+
+inline
+bsl::size_t ParallelAlgorithmUtil_Runner::chunkOffset(bsl::size_t size,
+                                                      int         numChunks,
+                                                      int         chunkIndex)
+{
+    BSLS_ASSERT(0 <= chunkIndex);
+    BSLS_ASSERT(chunkIndex <= numChunks);
+
+    const bsl::size_t index     = chunkIndex;
+    const bsl::size_t remainder = size % numChunks;
+
+    return size / numChunks * index + (index < remainder ? index : remainder);
+}
+
+inline
+int ParallelAlgorithmUtil_Runner::numChunks(
+                                      const ParallelAlgorithmPolicy& policy,
+                                      bsl::size_t                    size)
+{
+    if (policy.isSequential()
+     || size < policy.sequentialThreshold()
+     || size < 2) {
+        return 0;                                                     // RETURN
+    }
+
+    const bsl::size_t maxConcurrency = policy.maxConcurrency();
+
+    return static_cast<int>(maxConcurrency < size ? maxConcurrency : size);
+}
+
+template <class TASK>
+void ParallelAlgorithmUtil_Runner::invokeTask(void *task, int chunkIndex)
+{
+    (*static_cast<TASK *>(task))(chunkIndex);
+}
+
+                    // ---------------------------------
+                    // struct ParallelAlgorithmUtil_Imp
+                    // ---------------------------------
+
+template <class ITERATOR, class FUNCTION>
+void ParallelAlgorithmUtil_Imp::ForEachTask<ITERATOR, FUNCTION>::operator()(
+                                                          int chunkIndex) const
+{
+    typedef ParallelAlgorithmUtil_Runner Runner;
+
+    ITERATOR       it  = d_first + Runner::chunkOffset(d_size,
+                                                       d_numChunks,
+                                                       chunkIndex);
+    const ITERATOR end = d_first + Runner::chunkOffset(d_size,
+                                                       d_numChunks,
+                                                       chunkIndex + 1);
+    for (; it != end; ++it) {
+        (*d_function_p)(*it);
+    }
+}
+
+template <class INPUT_ITERATOR, class OUTPUT_ITERATOR, class OPERATION>
+void ParallelAlgorithmUtil_Imp::
+TransformTask<INPUT_ITERATOR, OUTPUT_ITERATOR, OPERATION>::operator()(
+                                                          int chunkIndex) const
+{
+    typedef ParallelAlgorithmUtil_Runner Runner;
+
+    const bsl::size_t begin = Runner::chunkOffset(d_size,
+                                                  d_numChunks,
+                                                  chunkIndex);
+    const bsl::size_t end   = Runner::chunkOffset(d_size,
+                                                  d_numChunks,
+                                                  chunkIndex + 1);
+
+    bsl::transform(d_first + begin,
+                   d_first + end,
+                   d_result + begin,
+                   *d_operation_p);
+}
+
+template <class INPUT_ITERATOR1,
+          class INPUT_ITERATOR2,
+          class OUTPUT_ITERATOR,
+          class OPERATION>
+void ParallelAlgorithmUtil_Imp::BinaryTransformTask<INPUT_ITERATOR1,
+                                                    INPUT_ITERATOR2,
+                                                    OUTPUT_ITERATOR,
+                                                    OPERATION>::operator()(
+                                                          int chunkIndex) const
+{
+    typedef ParallelAlgorithmUtil_Runner Runner;
+
+    const bsl::size_t begin = Runner::chunkOffset(d_size,
+                                                  d_numChunks,
+                                                  chunkIndex);
+    const bsl::size_t end   = Runner::chunkOffset(d_size,
+                                                  d_numChunks,
+                                                  chunkIndex + 1);
+
+    bsl::transform(d_first1 + begin,
+                   d_first1 + end,
+                   d_first2 + begin,
+                   d_result + begin,
+                   *d_operation_p);
+}
+
+template <class ITERATOR, class TYPE, class OPERATION>
+void
+ParallelAlgorithmUtil_Imp::FoldTask<ITERATOR, TYPE, OPERATION>::operator()(
+                                                          int chunkIndex) const
+{
+    typedef ParallelAlgorithmUtil_Runner Runner;
+
+    ITERATOR       it  = d_first + Runner::chunkOffset(d_size,
+                                                       d_numChunks,
+                                                       chunkIndex);
+    const ITERATOR end = d_first + Runner::chunkOffset(d_size,
+                                                       d_numChunks,
+                                                       chunkIndex + 1);
+
+    // Chunks are never empty, so the fold can start from the first element,
+    // which avoids requiring an identity element.
+
+    TYPE result(*it);
+    for (++it; it != end; ++it) {
+        result = (*d_operation_p)(result, *it);
+    }
+    d_partials_p[chunkIndex] = result;
+}
+
+template <class INPUT_ITERATOR,
+          class OUTPUT_ITERATOR,
+          class TYPE,
+          class OPERATION>
+void ParallelAlgorithmUtil_Imp::ScanTask<INPUT_ITERATOR,
+                                         OUTPUT_ITERATOR,
+                                         TYPE,
+                                         OPERATION>::operator()(
+                                                          int chunkIndex) const
+{
+    typedef ParallelAlgorithmUtil_Runner Runner;
+
+    const bsl::size_t begin = Runner::chunkOffset(d_size,
+                                                  d_numChunks,
+                                                  chunkIndex);
+    const bsl::size_t end   = Runner::chunkOffset(d_size,
+                                                  d_numChunks,
+                                                  chunkIndex + 1);
+
+    INPUT_ITERATOR  it  = d_first + begin;
+    OUTPUT_ITERATOR out = d_result + begin;
+
+    TYPE running(0 == chunkIndex
+                 ? TYPE(*it)
+                 : TYPE((*d_operation_p)(d_offsets_p[chunkIndex - 1], *it)));
+    *out = running;
+    for (++it, ++out; it != d_first + end; ++it, ++out) {
+        running = (*d_operation_p)(running, *it);
+        *out    = running;
+    }
+}
+
+template <class ITERATOR, class PREDICATE>
+void ParallelAlgorithmUtil_Imp::CountIfTask<ITERATOR, PREDICATE>::operator()(
+                                                          int chunkIndex) const
+{
+    typedef ParallelAlgorithmUtil_Runner Runner;
+
+    const bsl::size_t begin = Runner::chunkOffset(d_size,
+                                                  d_numChunks,
+                                                  chunkIndex);
+    const bsl::size_t end   = Runner::chunkOffset(d_size,
+                                                  d_numChunks,
+                                                  chunkIndex + 1);
+
+    bsl::size_t count = 0;
+    ITERATOR    it    = d_first + begin;
+    for (bsl::size_t i = begin; i != end; ++i, ++it) {
+        const bool flag = (*d_predicate_p)(*it);
+
+        d_flags_p[i]  = flag;
+        count        += flag;
+    }
+    d_counts_p[chunkIndex] = count;
+}
+
+template <class INPUT_ITERATOR, class OUTPUT_ITERATOR>
+void ParallelAlgorithmUtil_Imp::CopyFlaggedTask<INPUT_ITERATOR,
+                                                OUTPUT_ITERATOR>::operator()(
+                                                          int chunkIndex) const
+{
+    typedef ParallelAlgorithmUtil_Runner Runner;
+
+    const bsl::size_t begin = Runner::chunkOffset(d_size,
+                                                  d_numChunks,
+                                                  chunkIndex);
+    const bsl::size_t end   = Runner::chunkOffset(d_size,
+                                                  d_numChunks,
+                                                  chunkIndex + 1);
+
+    INPUT_ITERATOR  it  = d_first + begin;
+    OUTPUT_ITERATOR out = d_result + d_offsets_p[chunkIndex];
+    for (bsl::size_t i = begin; i != end; ++i, ++it) {
+        if (d_flags_p[i]) {
+            *out = *it;
+            ++out;
+        }
+    }
+}
+
+template <class ITERATOR, class COMPARATOR>
+void ParallelAlgorithmUtil_Imp::SortTask<ITERATOR, COMPARATOR>::operator()(
+                                                          int chunkIndex) const
+{
+    typedef ParallelAlgorithmUtil_Runner Runner;
+
+    const ITERATOR begin = d_first + Runner::chunkOffset(d_size,
+                                                         d_numChunks,
+                                                         chunkIndex);
+    const ITERATOR end   = d_first + Runner::chunkOffset(d_size,
+                                                         d_numChunks,
+                                                         chunkIndex + 1);
+
+    if (d_stable) {
+        bsl::stable_sort(begin, end, *d_comparator_p);
+    }
+    else {
+        bsl::sort(begin, end, *d_comparator_p);
+    }
+}
+
+template <class SOURCE_ITERATOR,
+          class DESTINATION_ITERATOR,
+          class COMPARATOR>
+void ParallelAlgorithmUtil_Imp::MergeTask<SOURCE_ITERATOR,
+                                          DESTINATION_ITERATOR,
+                                          COMPARATOR>::operator()(
+                                                           int taskIndex) const
+{
+    typedef typename MoveIterator<SOURCE_ITERATOR>::Type Move;
+
+    const int         run    = 2 * taskIndex;
+    const bsl::size_t begin  = d_bounds_p[run];
+    const bsl::size_t middle = d_bounds_p[run + 1];
+
+    if (run + 1 == d_numRuns) {
+        bsl::copy(Move(d_source + begin),
+                  Move(d_source + middle),
+                  d_destination + begin);
+        return;                                                       // RETURN
+    }
+
+    const bsl::size_t end = d_bounds_p[run + 2];
+
+    bsl::merge(Move(d_source + begin),
+               Move(d_source + middle),
+               Move(d_source + middle),
+               Move(d_source + end),
+               d_destination + begin,
+               *d_comparator_p);
+}
+
+template <class SOURCE_ITERATOR, class DESTINATION_ITERATOR>
+void ParallelAlgorithmUtil_Imp::MoveTask<SOURCE_ITERATOR,
+                                         DESTINATION_ITERATOR>::operator()(
+                                                          int chunkIndex) const
+{
+    typedef ParallelAlgorithmUtil_Runner                 Runner;
+    typedef typename MoveIterator<SOURCE_ITERATOR>::Type Move;
+
+    const bsl::size_t begin = Runner::chunkOffset(d_size,
+                                                  d_numChunks,
+                                                  chunkIndex);
+    const bsl::size_t end   = Runner::chunkOffset(d_size,
+                                                  d_numChunks,
+                                                  chunkIndex + 1);
+
+    bsl::copy(Move(d_source + begin),
+              Move(d_source + end),
+              d_destination + begin);
+}
+
+// CLASS METHODS
+template <class RANDOM_ITERATOR, class COMPARATOR>
+void ParallelAlgorithmUtil_Imp::sort(const ParallelAlgorithmPolicy& policy,
+                                     RANDOM_ITERATOR                first,
+                                     RANDOM_ITERATOR                last,
+                                     COMPARATOR                     comparator,
+                                     bool                           stable)
+{
+    typedef ParallelAlgorithmUtil_Runner                          Runner;
+    typedef typename bsl::iterator_traits<RANDOM_ITERATOR>::value_type
+                                                                  Value;
+    typedef bsl::vector<Value>                                    Buffer;
+    typedef typename Buffer::iterator                             BufferIter;
+    typedef typename MoveIterator<RANDOM_ITERATOR>::Type          Move;
+
+    const bsl::size_t size      = last - first;
+    const int         numChunks = Runner::numChunks(policy, size);
+
+    if (0 == numChunks) {
+        if (stable) {
+            bsl::stable_sort(first, last, comparator);
+        }
+        else {
+            bsl::sort(first, last, comparator);
+        }
+        return;                                                       // RETURN
+    }
+
+    // The elements are moved to a buffer, where each chunk is sorted; pairs
+    // of adjacent sorted runs are then merged, alternately from the buffer
+    // into the range and back, until a single run remains.  Since
+    // `bsl::merge` takes equivalent elements from its first range first, the
+    // merge preserves the stability of the chunk sorts.
+
+    const Move moveFirst(first);
+    const Move moveLast(last);
+    Buffer     buffer(moveFirst, moveLast);
+
+    SortTask<BufferIter, COMPARATOR> sortTask = {
+                          buffer.begin(), size, numChunks, &comparator, stable
+                                                };
+    Runner::run(policy, numChunks, sortTask);
+
+    bsl::vector<bsl::size_t> bounds(numChunks + 1);
+    for (int i = 0; i <= numChunks; ++i) {
+        bounds[i] = Runner::chunkOffset(size, numChunks, i);
+    }
+
+    int  numRuns  = numChunks;
+    bool inBuffer = true;
+    while (1 < numRuns) {
+        const int numMerges = (numRuns + 1) / 2;
+        if (inBuffer) {
+            MergeTask<BufferIter, RANDOM_ITERATOR, COMPARATOR> task = {
+                             buffer.begin(), first, &bounds[0], numRuns,
+                             &comparator
+                                                                      };
+            Runner::run(policy, numMerges, task);
+        }
+        else {
+            MergeTask<RANDOM_ITERATOR, BufferIter, COMPARATOR> task = {
+                             first, buffer.begin(), &bounds[0], numRuns,
+                             &comparator
+                                                                      };
+            Runner::run(policy, numMerges, task);
+        }
+        for (int i = 0; i < numMerges; ++i) {
+            bounds[i] = bounds[2 * i];
+        }
+        bounds[numMerges] = size;
+        numRuns           = numMerges;
+        inBuffer          = !inBuffer;
+    }
+
+    if (inBuffer) {
+        MoveTask<BufferIter, RANDOM_ITERATOR> task = {
+                                           buffer.begin(), first, size,
+                                           numChunks
+                                                     };
+        Runner::run(policy, numChunks, task);
+    }
+}
+
+                        // ----------------------------
+                        // struct ParallelAlgorithmUtil
+                        // ----------------------------
+
+// CLASS METHODS
+template <class RANDOM_ITERATOR1, class RANDOM_ITERATOR2, class PREDICATE>
+RANDOM_ITERATOR2 ParallelAlgorithmUtil::copyIf(
+                                      const ParallelAlgorithmPolicy& policy,
+                                      RANDOM_ITERATOR1               first,
+                                      RANDOM_ITERATOR1               last,
+                                      RANDOM_ITERATOR2               result,
+                                      PREDICATE                      predicate)
+{
+    typedef ParallelAlgorithmUtil_Runner Runner;
+    typedef ParallelAlgorithmUtil_Imp    Imp;
+
+    const bsl::size_t size      = last - first;
+    const int         numChunks = Runner::numChunks(policy, size);
+
+    if (0 == numChunks) {
+        for (; first != last; ++first) {
+            if (predicate(*first)) {
+                *result = *first;
+                ++result;
+            }
+        }
+        return result;                                                // RETURN
+    }
+
+    bsl::vector<char>        flags(size);
+    bsl::vector<bsl::size_t> counts(numChunks + 1);
+
+    Imp::CountIfTask<RANDOM_ITERATOR1, PREDICATE> countTask = {
+                             first, size, numChunks, &predicate, &flags[0],
+                             &counts[0]
+                                                              };
+    Runner::run(policy, numChunks, countTask);
+
+    // Turn the counts into output offsets, in place.
+
+    bsl::size_t offset = 0;
+    for (int i = 0; i <= numChunks; ++i) {
+        const bsl::size_t count = counts[i];
+
+        counts[i]  = offset;
+        offset    += count;
+    }
+
+    Imp::CopyFlaggedTask<RANDOM_ITERATOR1, RANDOM_ITERATOR2> copyTask = {
+                             first, result, size, numChunks, &flags[0],
+                             &counts[0]
+                                                                       };
+    Runner::run(policy, numChunks, copyTask);
+
+    return result + offset;
+}
+
+template <class RANDOM_ITERATOR, class FUNCTION>
+void ParallelAlgorithmUtil::forEach(const ParallelAlgorithmPolicy& policy,
+                                    RANDOM_ITERATOR                first,
+                                    RANDOM_ITERATOR                last,
+                                    FUNCTION                       function)
+{
+    typedef ParallelAlgorithmUtil_Runner Runner;
+    typedef ParallelAlgorithmUtil_Imp    Imp;
+
+    const bsl::size_t size      = last - first;
+    const int         numChunks = Runner::numChunks(policy, size);
+
+    if (0 == numChunks) {
+        for (; first != last; ++first) {
+            function(*first);
+        }
+        return;                                                       // RETURN
+    }
+
+    Imp::ForEachTask<RANDOM_ITERATOR, FUNCTION> task = {
+                                             first, size, numChunks, &function
+                                                       };
+    Runner::run(policy, numChunks, task);
+}
+
+template <class RANDOM_ITERATOR1, class RANDOM_ITERATOR2>
+inline
+RANDOM_ITERATOR2 ParallelAlgorithmUtil::inclusiveScan(
+                                        const ParallelAlgorithmPolicy& policy,
+                                        RANDOM_ITERATOR1               first,
+                                        RANDOM_ITERATOR1               last,
+                                        RANDOM_ITERATOR2               result)
+{
+    typedef typename bsl::iterator_traits<RANDOM_ITERATOR1>::value_type Value;
+
+    return inclusiveScan(policy, first, last, result, bsl::plus<Value>());
+}
+
+template <class RANDOM_ITERATOR1, class RANDOM_ITERATOR2, class OPERATION>
+RANDOM_ITERATOR2 ParallelAlgorithmUtil::inclusiveScan(
+                                      const ParallelAlgorithmPolicy& policy,
+                                      RANDOM_ITERATOR1               first,
+                                      RANDOM_ITERATOR1               last,
+                                      RANDOM_ITERATOR2               result,
+                                      OPERATION                      operation)
+{
+    typedef ParallelAlgorithmUtil_Runner Runner;
+    typedef ParallelAlgorithmUtil_Imp    Imp;
+    typedef typename bsl::iterator_traits<RANDOM_ITERATOR1>::value_type Value;
+
+    const bsl::size_t size      = last - first;
+    const int         numChunks = Runner::numChunks(policy, size);
+
+    if (0 == numChunks) {
+        if (first == last) {
+            return result;                                            // RETURN
+        }
+        Value running(*first);
+        *result = running;
+        for (++first, ++result; first != last; ++first, ++result) {
+            running = operation(running, *first);
+            *result = running;
+        }
+        return result;                                                // RETURN
+    }
+
+    // First, fold each chunk; then, turn the folds into the fold of all the
+    // preceding chunks, in place; finally, scan each chunk starting from the
+    // fold of the preceding chunks.
+
+    bsl::vector<Value> partials(numChunks, *first);
+
+    Imp::FoldTask<RANDOM_ITERATOR1, Value, OPERATION> foldTask = {
+                           first, size, numChunks, &operation, &partials[0]
+                                                                 };
+    Runner::run(policy, numChunks, foldTask);
+
+    for (int i = 1; i < numChunks; ++i) {
+        partials[i] = operation(partials[i - 1], partials[i]);
+    }
+
+    Imp::ScanTask<RANDOM_ITERATOR1, RANDOM_ITERATOR2, Value, OPERATION>
+                                                                   scanTask = {
+                   first, result, size, numChunks, &operation, &partials[0]
+                                                                             };
+    Runner::run(policy, numChunks, scanTask);
+
+    return result + size;
+}
+
+template <class RANDOM_ITERATOR, class TYPE>
+inline
+TYPE ParallelAlgorithmUtil::reduce(const ParallelAlgorithmPolicy& policy,
+                                   RANDOM_ITERATOR                first,
+                                   RANDOM_ITERATOR                last,
+                                   TYPE                           initialValue)
+{
+    return reduce(policy, first, last, initialValue, bsl::plus<TYPE>());
+}
+
+template <class RANDOM_ITERATOR, class TYPE, class OPERATION>
+TYPE ParallelAlgorithmUtil::reduce(const ParallelAlgorithmPolicy& policy,
+                                   RANDOM_ITERATOR                first,
+                                   RANDOM_ITERATOR                last,
+                                   TYPE                           initialValue,
+                                   OPERATION                      operation)
+{
+    typedef ParallelAlgorithmUtil_Runner Runner;
+    typedef ParallelAlgorithmUtil_Imp    Imp;
+
+    const bsl::size_t size      = last - first;
+    const int         numChunks = Runner::numChunks(policy, size);
+
+    if (0 == numChunks) {
+        for (; first != last; ++first) {
+            initialValue = operation(initialValue, *first);
+        }
+        return initialValue;                                          // RETURN
+    }
+
+    bsl::vector<TYPE> partials(numChunks, initialValue);
+
+    Imp::FoldTask<RANDOM_ITERATOR, TYPE, OPERATION> task = {
+                           first, size, numChunks, &operation, &partials[0]
+                                                           };
+    Runner::run(policy, numChunks, task);
+
+    for (int i = 0; i < numChunks; ++i) {
+        initialValue = operation(initialValue, partials[i]);
+    }
+    return initialValue;
+}
+
+template <class RANDOM_ITERATOR>
+inline
+void ParallelAlgorithmUtil::sort(const ParallelAlgorithmPolicy& policy,
+                                 RANDOM_ITERATOR                first,
+                                 RANDOM_ITERATOR                last)
+{
+    typedef typename bsl::iterator_traits<RANDOM_ITERATOR>::value_type Value;
+
+    ParallelAlgorithmUtil_Imp::sort(policy,
+                                    first,
+                                    last,
+                                    bsl::less<Value>(),
+                                    false);
+}
+
+template <class RANDOM_ITERATOR, class COMPARATOR>
+inline
+void ParallelAlgorithmUtil::sort(const ParallelAlgorithmPolicy& policy,
+                                 RANDOM_ITERATOR                first,
+                                 RANDOM_ITERATOR                last,
+                                 COMPARATOR                     comparator)
+{
+    ParallelAlgorithmUtil_Imp::sort(policy, first, last, comparator, false);
+}
+
+template <class RANDOM_ITERATOR>
+inline
+void ParallelAlgorithmUtil::stableSort(const ParallelAlgorithmPolicy& policy,
+                                       RANDOM_ITERATOR                first,
+                                       RANDOM_ITERATOR                last)
+{
+    typedef typename bsl::iterator_traits<RANDOM_ITERATOR>::value_type Value;
+
+    ParallelAlgorithmUtil_Imp::sort(policy,
+                                    first,
+                                    last,
+                                    bsl::less<Value>(),
+                                    true);
+}
+
+template <class RANDOM_ITERATOR, class COMPARATOR>
+inline
+void ParallelAlgorithmUtil::stableSort(
+                                     const ParallelAlgorithmPolicy& policy,
+                                     RANDOM_ITERATOR                first,
+                                     RANDOM_ITERATOR                last,
+                                     COMPARATOR                     comparator)
+{
+    ParallelAlgorithmUtil_Imp::sort(policy, first, last, comparator, true);
+}
+
+template <class RANDOM_ITERATOR1, class RANDOM_ITERATOR2, class OPERATION>
+RANDOM_ITERATOR2 ParallelAlgorithmUtil::transform(
+                                      const ParallelAlgorithmPolicy& policy,
+                                      RANDOM_ITERATOR1               first,
+                                      RANDOM_ITERATOR1               last,
+                                      RANDOM_ITERATOR2               result,
+                                      OPERATION                      operation)
+{
+    typedef ParallelAlgorithmUtil_Runner Runner;
+    typedef ParallelAlgorithmUtil_Imp    Imp;
+
+    const bsl::size_t size      = last - first;
+    const int         numChunks = Runner::numChunks(policy, size);
+
+    if (0 == numChunks) {
+        return bsl::transform(first, last, result, operation);        // RETURN
+    }
+
+    Imp::TransformTask<RANDOM_ITERATOR1, RANDOM_ITERATOR2, OPERATION> task = {
+                                     first, result, size, numChunks, &operation
+                                                                             };
+    Runner::run(policy, numChunks, task);
+
+    return result + size;
+}
+
+template <class RANDOM_ITERATOR1,
+          class RANDOM_ITERATOR2,
+          class RANDOM_ITERATOR3,
+          class OPERATION>
+RANDOM_ITERATOR3 ParallelAlgorithmUtil::transform(
+                                      const ParallelAlgorithmPolicy& policy,
+                                      RANDOM_ITERATOR1               first1,
+                                      RANDOM_ITERATOR1               last1,
+                                      RANDOM_ITERATOR2               first2,
+                                      RANDOM_ITERATOR3               result,
+                                      OPERATION                      operation)
+{
+    typedef ParallelAlgorithmUtil_Runner Runner;
+    typedef ParallelAlgorithmUtil_Imp    Imp;
+
+    const bsl::size_t size      = last1 - first1;
+    const int         numChunks = Runner::numChunks(policy, size);
+
+    if (0 == numChunks) {
+        return bsl::transform(first1,
+                              last1,
+                              first2,
+                              result,
+                              operation);                             // RETURN
+    }
+
+    Imp::BinaryTransformTask<RANDOM_ITERATOR1,
+                             RANDOM_ITERATOR2,
+                             RANDOM_ITERATOR3,
+                             OPERATION> task = {
+                            first1, first2, result, size, numChunks, &operation
+                                               };
+    Runner::run(policy, numChunks, task);
+
+    return result + size;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool bdlmt::operator==(const ParallelAlgorithmPolicy& lhs,
+                       const ParallelAlgorithmPolicy& rhs)
+{
+    return lhs.d_threadPool_p        == rhs.d_threadPool_p
+        && lhs.d_maxConcurrency      == rhs.d_maxConcurrency
+        && lhs.d_sequentialThreshold == rhs.d_sequentialThreshold;
+}
+
+inline
+bool bdlmt::operator!=(const ParallelAlgorithmPolicy& lhs,
+                       const ParallelAlgorithmPolicy& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1035 @@
+// bdlmt_parallelalgorithmutil.t.cpp                                  -*-C++-*-
+
+#include <bdlmt_parallelalgorithmutil.h>
+
+#include <bdlmt_fixedthreadpool.h>
+#include <bdlmt_threadpool.h>
+
+#include <bdlm_metricsregistry.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadattributes.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_numeric.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                             TEST PLAN
+// ----------------------------------------------------------------------------
+//                             Overview
+//                             --------
+// The component under test provides a policy attribute class, and parallel
+// versions of standard algorithms built on one primitive,
+// `ParallelAlgorithmUtil_Runner::run`, that distributes chunks over the
+// calling thread and a thread pool.  We first test the policy and the
+// primitive (including when the pool refuses jobs, and when the primitive is
+// called from a job of the pool it uses), and then check each algorithm
+// against the corresponding sequential standard algorithm on pseudo-random
+// input, for a range of sizes and concurrencies, and with a sequential
+// threshold low enough for every size to be processed in parallel.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 1] ParallelAlgorithmPolicy defaultPolicy();
+// [ 1] void setDefaultPolicy(const ParallelAlgorithmPolicy&);
+//
+// CREATORS
+// [ 1] ParallelAlgorithmPolicy();
+// [ 1] ParallelAlgorithmPolicy(THREAD_POOL *, int, size_t);
+//
+// MANIPULATORS
+// [ 1] ParallelAlgorithmPolicy& setSequentialThreshold(size_t);
+//
+// ACCESSORS
+// [ 1] int enqueueJob(const Job&) const;
+// [ 1] bool isSequential() const;
+// [ 1] int maxConcurrency() const;
+// [ 1] size_t sequentialThreshold() const;
+// [ 1] void *threadPool() const;
+//
+// FREE OPERATORS
+// [ 1] bool operator==(const ParallelAlgorithmPolicy&, const P...&);
+// [ 1] bool operator!=(const ParallelAlgorithmPolicy&, const P...&);
+//
+// ParallelAlgorithmUtil
+// [ 3] void forEach(const P&, RANDOM_ITERATOR, RANDOM_ITERATOR, FUNC);
+// [ 3] ITER2 transform(const P&, ITER1, ITER1, ITER2, OPERATION);
+// [ 3] ITER3 transform(const P&, ITER1, ITER1, ITER2, ITER3, OPERATION);
+// [ 4] TYPE reduce(const P&, RANDOM_ITERATOR, RANDOM_ITERATOR, TYPE);
+// [ 4] TYPE reduce(const P&, RANDOM_ITERATOR, RANDOM_ITERATOR, TYPE, OP);
+// [ 4] ITER2 inclusiveScan(const P&, ITER1, ITER1, ITER2);
+// [ 4] ITER2 inclusiveScan(const P&, ITER1, ITER1, ITER2, OPERATION);
+// [ 5] ITER2 copyIf(const P&, ITER1, ITER1, ITER2, PREDICATE);
+// [ 6] void sort(const P&, RANDOM_ITERATOR, RANDOM_ITERATOR);
+// [ 6] void sort(const P&, RANDOM_ITERATOR, RANDOM_ITERATOR, COMPARATOR);
+// [ 6] void stableSort(const P&, RANDOM_ITERATOR, RANDOM_ITERATOR);
+// [ 6] void stableSort(const P&, RANDOM_ITERATOR, RANDOM_ITERATOR, COMP);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] ParallelAlgorithmUtil_Runner
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE: PARALLEL VS. SEQUENTIAL ALGORITHMS
+// ----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                     NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::ParallelAlgorithmPolicy      Policy;
+typedef bdlmt::ParallelAlgorithmUtil        Util;
+typedef bdlmt::ParallelAlgorithmUtil_Runner Runner;
+
+static int verbose;
+static int veryVerbose;
+static int veryVeryVerbose;
+static int veryVeryVeryVerbose;
+
+/// Sizes exercised by the algorithm tests: around the maximum concurrency,
+/// and a few larger values.
+static const int SIZES[] = { 0, 1, 2, 3, 5, 7, 8, 9, 16, 17, 100, 1000,
+                             4099 };
+enum { NUM_SIZES = sizeof SIZES / sizeof *SIZES };
+
+/// Maximum concurrencies exercised by the algorithm tests.
+static const int CONCURRENCIES[] = { 1, 2, 3, 4, 7, 8 };
+enum { NUM_CONCURRENCIES = sizeof CONCURRENCIES / sizeof *CONCURRENCIES };
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// Return a vector of the specified `size` pseudo-random integers in
+/// `[0 .. range)`, generated from the specified `seed`.
+bsl::vector<int> randomInts(int size, int range, unsigned seed)
+{
+    bsl::vector<int> result(size);
+    for (int i = 0; i < size; ++i) {
+        seed      = seed * 1103515245u + 12345u;
+        result[i] = static_cast<int>((seed >> 8) % range);
+    }
+    return result;
+}
+
+/// This `struct` records, with atomic counters, which chunks a call to
+/// `ParallelAlgorithmUtil_Runner::run` processed, and from which threads.
+struct ChunkRecorder {
+    bsls::AtomicInt                d_counts[64];
+    bsls::AtomicInt                d_numOtherThreads;
+    bslmt::ThreadUtil::Handle      d_caller;
+
+    void operator()(int chunkIndex)
+    {
+        ++d_counts[chunkIndex];
+        if (!bslmt::ThreadUtil::areEqual(d_caller,
+                                         bslmt::ThreadUtil::self())) {
+            ++d_numOtherThreads;
+        }
+
+        // Give the helpers a chance to start.
+
+        bslmt::ThreadUtil::microSleep(1000);
+    }
+};
+
+/// Return `true` if the specified `values` are in non-decreasing order, and
+/// `false` otherwise.
+bool isSorted(const bsl::vector<int>& values)
+{
+    return values.end() == bsl::adjacent_find(values.begin(),
+                                              values.end(),
+                                              bsl::greater<int>());
+}
+
+/// Increment the referenced integer.
+struct Increment {
+    void operator()(int& value) const
+    {
+        ++value;
+    }
+};
+
+/// Increment the referenced atomic counter.
+struct CountJob {
+    bsls::AtomicInt *d_count_p;
+
+    void operator()() const
+    {
+        ++*d_count_p;
+    }
+};
+
+/// Return twice the specified `value`.
+int twice(int value)
+{
+    return 2 * value;
+}
+
+/// Return the concatenation of the specified `lhs` and `rhs`: an associative
+/// but non-commutative operation.
+bsl::string concatenate(const bsl::string& lhs, const bsl::string& rhs)
+{
+    return lhs + rhs;
+}
+
+/// Return `true` if the specified `value` is odd.
+bool isOdd(int value)
+{
+    return value & 1;
+}
+
+/// Return `true` if the specified `value` is even.
+bool isEven(int value)
+{
+    return !isOdd(value);
+}
+
+/// Return `true` if the `first` member of the specified `lhs` is less than
+/// that of the specified `rhs`.
+bool lessFirst(const bsl::pair<int, int>& lhs, const bsl::pair<int, int>& rhs)
+{
+    return lhs.first < rhs.first;
+}
+
+/// This `struct` holds the state of a job that sorts a vector, using a
+/// policy referring to the thread pool running the job.
+struct NestedSortJob {
+    Policy            d_policy;
+    bsl::vector<int> *d_values_p;
+    bsls::AtomicInt  *d_done_p;
+
+    void operator()() const
+    {
+        Util::sort(d_policy, d_values_p->begin(), d_values_p->end());
+        ++*d_done_p;
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test            = argc > 1 ? bsl::atoi(argv[1]) : 0;
+    verbose             = argc > 2;
+    veryVerbose         = argc > 3;
+    veryVeryVerbose     = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // Access the metrics registry default instance, which the thread pools
+    // use, before installing the global allocator.
+
+    bdlm::MetricsRegistry::defaultInstance();
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslmt::ThreadAttributes attributes;
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "USAGE EXAMPLE\n"
+                             "=============\n";
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sorting and Summing a Large Array
+/// - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have a large array of measurements that we want to sort, and
+// whose sum we want to compute, using the threads of an existing thread pool.
+//
+// First, we create and start a thread pool:
+// ```
+    bslmt::ThreadAttributes attributes;
+    bdlmt::ThreadPool       threadPool(attributes, 4, 4, 1000);
+    threadPool.start();
+// ```
+// Then, we create a policy that lets up to four threads (the calling thread
+// and three threads of the pool) work on each call:
+// ```
+    bdlmt::ParallelAlgorithmPolicy policy(&threadPool, 4);
+// ```
+// Next, we generate the measurements:
+// ```
+    bsl::vector<int> measurements;
+    for (int i = 0; i < 100000; ++i) {
+        measurements.push_back((i * 7919) % 100003);
+    }
+// ```
+// Now, we sort them, and compute their sum:
+// ```
+    bdlmt::ParallelAlgorithmUtil::sort(policy,
+                                       measurements.begin(),
+                                       measurements.end());
+
+    long long sum = bdlmt::ParallelAlgorithmUtil::reduce(policy,
+                                                         measurements.begin(),
+                                                         measurements.end(),
+                                                         0LL);
+// ```
+// Finally, we verify the results:
+// ```
+    for (bsl::size_t i = 1; i < measurements.size(); ++i) {
+        ASSERT(measurements[i - 1] <= measurements[i]);
+    }
+    ASSERT(bsl::accumulate(measurements.begin(),
+                           measurements.end(),
+                           0LL) == sum);
+
+    threadPool.stop();
+// ```
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // `sort` AND `stableSort`
+        //
+        // Concerns:
+        // 1. The range is sorted, and is a permutation of the input.
+        //
+        // 2. `stableSort` preserves the relative order of equivalent
+        //    elements, whatever the number of chunks and merge rounds.
+        //
+        // 3. The supplied comparator is used.
+        //
+        // 4. A call made from a job of the thread pool it uses completes,
+        //    even when every thread of the pool makes such a call.
+        //
+        // Plan:
+        // 1. For each size and maximum concurrency, sort a pseudo-random
+        //    vector having many duplicates, with and without a comparator,
+        //    and compare with `bsl::sort`.  (C-1,3)
+        //
+        // 2. Stably sort pairs whose second member is their original index,
+        //    comparing only the first member, and compare with
+        //    `bsl::stable_sort`.  (C-2)
+        //
+        // 3. Enqueue, on a pool of two threads, four jobs each sorting a
+        //    vector using the same pool, and wait for their completion.
+        //    (C-4)
+        //
+        // Testing:
+        //   void sort(const P&, RANDOM_ITERATOR, RANDOM_ITERATOR);
+        //   void sort(const P&, RANDOM_ITERATOR, RANDOM_ITERATOR, COMPARATOR);
+        //   void stableSort(const P&, RANDOM_ITERATOR, RANDOM_ITERATOR);
+        //   void stableSort(const P&, RANDOM_ITERATOR, RANDOM_ITERATOR, COMP);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "`sort` AND `stableSort`\n"
+                             "=======================\n";
+
+        bdlmt::ThreadPool pool(attributes, 7, 7, 1000);
+        ASSERT(0 == pool.start());
+
+        for (int ci = 0; ci < NUM_CONCURRENCIES; ++ci) {
+            const Policy POLICY(&pool, CONCURRENCIES[ci], 0);
+
+            for (int si = 0; si < NUM_SIZES; ++si) {
+                const int SIZE = SIZES[si];
+
+                if (veryVerbose) { T_ P_(CONCURRENCIES[ci]) P(SIZE) }
+
+                const bsl::vector<int> INPUT = randomInts(SIZE, 50, si);
+
+                bsl::vector<int> expected(INPUT);
+                bsl::sort(expected.begin(), expected.end());
+
+                bsl::vector<int> mX(INPUT);
+                Util::sort(POLICY, mX.begin(), mX.end());
+                ASSERTV(CONCURRENCIES[ci], SIZE, expected == mX);
+
+                mX = INPUT;
+                Util::sort(POLICY, mX.begin(), mX.end(), bsl::greater<int>());
+                bsl::reverse(expected.begin(), expected.end());
+                ASSERTV(CONCURRENCIES[ci], SIZE, expected == mX);
+
+                mX = INPUT;
+                Util::stableSort(POLICY, mX.begin(), mX.end());
+                bsl::reverse(expected.begin(), expected.end());
+                ASSERTV(CONCURRENCIES[ci], SIZE, expected == mX);
+
+                bsl::vector<bsl::pair<int, int> > pairs(SIZE);
+                for (int i = 0; i < SIZE; ++i) {
+                    pairs[i].first  = INPUT[i];
+                    pairs[i].second = i;
+                }
+                bsl::vector<bsl::pair<int, int> > expectedPairs(pairs);
+                bsl::stable_sort(expectedPairs.begin(),
+                                 expectedPairs.end(),
+                                 &lessFirst);
+
+                Util::stableSort(POLICY, pairs.begin(), pairs.end(),
+                                 &lessFirst);
+                ASSERTV(CONCURRENCIES[ci], SIZE, expectedPairs == pairs);
+            }
+        }
+
+        if (verbose) cout << "\tCalls from jobs of the pool.\n";
+        {
+            bdlmt::ThreadPool smallPool(attributes, 2, 2, 1000);
+            ASSERT(0 == smallPool.start());
+
+            enum { k_NUM_JOBS = 4 };
+
+            bsl::vector<int> values[k_NUM_JOBS];
+            bsls::AtomicInt  done(0);
+            for (int i = 0; i < k_NUM_JOBS; ++i) {
+                values[i] = randomInts(5000, 1000, i);
+
+                NestedSortJob job = { Policy(&smallPool, 4, 0),
+                                      &values[i],
+                                      &done };
+                ASSERT(0 == smallPool.enqueueJob(job));
+            }
+            smallPool.drain();
+
+            ASSERTV(done, k_NUM_JOBS == done);
+            for (int i = 0; i < k_NUM_JOBS; ++i) {
+                ASSERTV(i, isSorted(values[i]));
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // `copyIf`
+        //
+        // Concerns:
+        // 1. The elements satisfying the predicate are copied in order, and
+        //    the returned iterator refers to the end of the output.
+        //
+        // 2. No element past the returned iterator is written.
+        //
+        // Plan:
+        // 1. For each size and maximum concurrency, copy the odd elements of
+        //    a pseudo-random vector to an output pre-filled with a sentinel,
+        //    and compare with `bsl::remove_copy_if` removing the even
+        //    elements.  (C-1,2)
+        //
+        // Testing:
+        //   ITER2 copyIf(const P&, ITER1, ITER1, ITER2, PREDICATE);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "`copyIf`\n"
+                             "========\n";
+
+        bdlmt::FixedThreadPool pool(attributes, 7, 1000);
+        ASSERT(0 == pool.start());
+
+        for (int ci = 0; ci < NUM_CONCURRENCIES; ++ci) {
+            const Policy POLICY(&pool, CONCURRENCIES[ci], 0);
+
+            for (int si = 0; si < NUM_SIZES; ++si) {
+                const int SIZE = SIZES[si];
+
+                if (veryVerbose) { T_ P_(CONCURRENCIES[ci]) P(SIZE) }
+
+                const bsl::vector<int> INPUT = randomInts(SIZE, 1000, si);
+
+                bsl::vector<int> expected(SIZE, -1);
+                bsl::vector<int>::iterator expectedEnd = bsl::remove_copy_if(
+                                                              INPUT.begin(),
+                                                              INPUT.end(),
+                                                              expected.begin(),
+                                                              &isEven);
+
+                bsl::vector<int> mX(SIZE, -1);
+                bsl::vector<int>::iterator end = Util::copyIf(POLICY,
+                                                              INPUT.begin(),
+                                                              INPUT.end(),
+                                                              mX.begin(),
+                                                              &isOdd);
+
+                ASSERTV(CONCURRENCIES[ci], SIZE,
+                        expectedEnd - expected.begin() == end - mX.begin());
+                ASSERTV(CONCURRENCIES[ci], SIZE, expected == mX);
+            }
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // `reduce` AND `inclusiveScan`
+        //
+        // Concerns:
+        // 1. `reduce` returns the fold of the initial value and the elements.
+        //
+        // 2. `inclusiveScan` stores the prefix folds of the elements, and
+        //    returns the end of the output.
+        //
+        // 3. The order of the operands is preserved, so that an associative
+        //    but non-commutative operation gives the sequential result.
+        //
+        // 4. `inclusiveScan` may be applied in place.
+        //
+        // Plan:
+        // 1. For each size and maximum concurrency, compare the results of
+        //    both algorithms with those of `bsl::accumulate` and
+        //    `bsl::partial_sum` for addition, and for the concatenation of
+        //    strings.  (C-1..3)
+        //
+        // 2. Apply `inclusiveScan` in place, and compare.  (C-4)
+        //
+        // Testing:
+        //   TYPE reduce(const P&, RANDOM_ITERATOR, RANDOM_ITERATOR, TYPE);
+        //   TYPE reduce(const P&, RANDOM_ITERATOR, RANDOM_ITERATOR, TYPE, OP);
+        //   ITER2 inclusiveScan(const P&, ITER1, ITER1, ITER2);
+        //   ITER2 inclusiveScan(const P&, ITER1, ITER1, ITER2, OPERATION);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "`reduce` AND `inclusiveScan`\n"
+                             "============================\n";
+
+        bdlmt::ThreadPool pool(attributes, 7, 7, 1000);
+        ASSERT(0 == pool.start());
+
+        for (int ci = 0; ci < NUM_CONCURRENCIES; ++ci) {
+            const Policy POLICY(&pool, CONCURRENCIES[ci], 0);
+
+            for (int si = 0; si < NUM_SIZES; ++si) {
+                const int SIZE = SIZES[si];
+
+                if (veryVerbose) { T_ P_(CONCURRENCIES[ci]) P(SIZE) }
+
+                const bsl::vector<int> INPUT = randomInts(SIZE, 1000, si);
+
+                ASSERTV(CONCURRENCIES[ci], SIZE,
+                        bsl::accumulate(INPUT.begin(), INPUT.end(), 7LL) ==
+                        Util::reduce(POLICY, INPUT.begin(), INPUT.end(), 7LL));
+
+                bsl::vector<int> expected(SIZE);
+                bsl::partial_sum(INPUT.begin(), INPUT.end(), expected.begin());
+
+                bsl::vector<int> mX(SIZE);
+                ASSERTV(CONCURRENCIES[ci], SIZE,
+                        mX.end() == Util::inclusiveScan(POLICY,
+                                                        INPUT.begin(),
+                                                        INPUT.end(),
+                                                        mX.begin()));
+                ASSERTV(CONCURRENCIES[ci], SIZE, expected == mX);
+
+                mX = INPUT;
+                Util::inclusiveScan(POLICY, mX.begin(), mX.end(), mX.begin());
+                ASSERTV(CONCURRENCIES[ci], SIZE, expected == mX);
+
+                bsl::vector<bsl::string> strings(SIZE);
+                for (int i = 0; i < SIZE; ++i) {
+                    strings[i] = bsl::string(1, char('a' + INPUT[i] % 26));
+                }
+
+                ASSERTV(CONCURRENCIES[ci], SIZE,
+                        bsl::accumulate(strings.begin(),
+                                        strings.end(),
+                                        bsl::string("<"),
+                                        &concatenate) ==
+                        Util::reduce(POLICY,
+                                     strings.begin(),
+                                     strings.end(),
+                                     bsl::string("<"),
+                                     &concatenate));
+
+                bsl::vector<bsl::string> expectedStrings(SIZE);
+                bsl::partial_sum(strings.begin(),
+                                 strings.end(),
+                                 expectedStrings.begin(),
+                                 &concatenate);
+
+                bsl::vector<bsl::string> mS(SIZE);
+                Util::inclusiveScan(POLICY,
+                                    strings.begin(),
+                                    strings.end(),
+                                    mS.begin(),
+                                    &concatenate);
+                ASSERTV(CONCURRENCIES[ci], SIZE, expectedStrings == mS);
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // `forEach` AND `transform`
+        //
+        // Concerns:
+        // 1. `forEach` invokes the function exactly once on each element.
+        //
+        // 2. `transform` stores the result of the operation for each element
+        //    (or pair of elements), and returns the end of the output.
+        //
+        // 3. `transform` may be applied in place.
+        //
+        // Plan:
+        // 1. For each size and maximum concurrency, apply the algorithms to
+        //    pseudo-random vectors, and compare with the results of the
+        //    sequential standard algorithms.  (C-1..3)
+        //
+        // Testing:
+        //   void forEach(const P&, RANDOM_ITERATOR, RANDOM_ITERATOR, FUNC);
+        //   ITER2 transform(const P&, ITER1, ITER1, ITER2, OPERATION);
+        //   ITER3 transform(const P&, ITER1, ITER1, ITER2, ITER3, OPERATION);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "`forEach` AND `transform`\n"
+                             "=========================\n";
+
+        bdlmt::ThreadPool pool(attributes, 7, 7, 1000);
+        ASSERT(0 == pool.start());
+
+        for (int ci = 0; ci < NUM_CONCURRENCIES; ++ci) {
+            const Policy POLICY(&pool, CONCURRENCIES[ci], 0);
+
+            for (int si = 0; si < NUM_SIZES; ++si) {
+                const int SIZE = SIZES[si];
+
+                if (veryVerbose) { T_ P_(CONCURRENCIES[ci]) P(SIZE) }
+
+                const bsl::vector<int> INPUT  = randomInts(SIZE, 1000, si);
+                const bsl::vector<int> INPUT2 = randomInts(SIZE, 1000, ~si);
+
+                bsl::vector<int> expected(INPUT);
+                bsl::for_each(expected.begin(), expected.end(), Increment());
+
+                bsl::vector<int> mX(INPUT);
+                Util::forEach(POLICY, mX.begin(), mX.end(), Increment());
+                ASSERTV(CONCURRENCIES[ci], SIZE, expected == mX);
+
+                bsl::transform(INPUT.begin(),
+                               INPUT.end(),
+                               expected.begin(),
+                               &twice);
+                ASSERTV(CONCURRENCIES[ci], SIZE,
+                        mX.end() == Util::transform(POLICY,
+                                                    INPUT.begin(),
+                                                    INPUT.end(),
+                                                    mX.begin(),
+                                                    &twice));
+                ASSERTV(CONCURRENCIES[ci], SIZE, expected == mX);
+
+                mX = INPUT;
+                Util::transform(POLICY, mX.begin(), mX.end(), mX.begin(),
+                                &twice);
+                ASSERTV(CONCURRENCIES[ci], SIZE, expected == mX);
+
+                bsl::transform(INPUT.begin(),
+                               INPUT.end(),
+                               INPUT2.begin(),
+                               expected.begin(),
+                               bsl::minus<int>());
+                ASSERTV(CONCURRENCIES[ci], SIZE,
+                        mX.end() == Util::transform(POLICY,
+                                                    INPUT.begin(),
+                                                    INPUT.end(),
+                                                    INPUT2.begin(),
+                                                    mX.begin(),
+                                                    bsl::minus<int>()));
+                ASSERTV(CONCURRENCIES[ci], SIZE, expected == mX);
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // `ParallelAlgorithmUtil_Runner`
+        //
+        // Concerns:
+        // 1. `chunkOffset` splits a range into chunks whose sizes differ by
+        //    at most one, and that cover the range.
+        //
+        // 2. `numChunks` returns 0 for sequential policies and inputs below
+        //    the threshold, and otherwise the maximum concurrency, capped by
+        //    the size.
+        //
+        // 3. `run` processes each chunk exactly once, using the threads of
+        //    the pool, and returns once all chunks are processed.
+        //
+        // 4. `run` completes when the pool refuses jobs.
+        //
+        // 5. Defensive checks are in place.
+        //
+        // Plan:
+        // 1. Check `chunkOffset` for a range of sizes and chunk counts.
+        //    (C-1)
+        //
+        // 2. Check `numChunks` for a set of policies and sizes.  (C-2)
+        //
+        // 3. Run a recorder task on started and stopped pools, and check the
+        //    counts it recorded.  (C-3,4)
+        //
+        // 4. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   ParallelAlgorithmUtil_Runner
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "`ParallelAlgorithmUtil_Runner`\n"
+                             "==============================\n";
+
+        if (verbose) cout << "\t`chunkOffset`.\n";
+
+        for (bsl::size_t size = 0; size < 100; ++size) {
+            for (int numChunks = 1; numChunks < 20; ++numChunks) {
+                ASSERTV(size, numChunks,
+                        0 == Runner::chunkOffset(size, numChunks, 0));
+                ASSERTV(size, numChunks,
+                        size == Runner::chunkOffset(size,
+                                                    numChunks,
+                                                    numChunks));
+                for (int i = 0; i < numChunks; ++i) {
+                    const bsl::size_t chunkSize =
+                                    Runner::chunkOffset(size, numChunks, i + 1)
+                                  - Runner::chunkOffset(size, numChunks, i);
+                    ASSERTV(size, numChunks, i,
+                            chunkSize == size / numChunks ||
+                            chunkSize == size / numChunks + 1);
+                }
+            }
+        }
+
+        if (verbose) cout << "\t`numChunks`.\n";
+
+        bdlmt::ThreadPool pool(attributes, 3, 3, 1000);
+        {
+            const Policy SEQ;
+            const Policy ONE(&pool, 1, 0);
+            const Policy FOUR(&pool, 4, 10);
+
+            ASSERT(0 == Runner::numChunks(SEQ,  1000000));
+            ASSERT(0 == Runner::numChunks(ONE,  1000000));
+            ASSERT(0 == Runner::numChunks(FOUR, 9));
+            ASSERT(4 == Runner::numChunks(FOUR, 10));
+            ASSERT(4 == Runner::numChunks(FOUR, 1000000));
+            ASSERT(3 == Runner::numChunks(Policy(&pool, 4, 0), 3));
+            ASSERT(0 == Runner::numChunks(Policy(&pool, 4, 0), 1));
+            ASSERT(0 == Runner::numChunks(Policy(&pool, 4, 0), 0));
+        }
+
+        if (verbose) cout << "\t`run`.\n";
+
+        for (int started = 0; started < 2; ++started) {
+            if (started) {
+                ASSERT(0 == pool.start());
+            }
+            for (int numChunks = 1; numChunks <= 64; numChunks *= 2) {
+                ChunkRecorder recorder;
+                recorder.d_caller = bslmt::ThreadUtil::self();
+
+                Runner::run(Policy(&pool, 4), numChunks, recorder);
+
+                for (int i = 0; i < 64; ++i) {
+                    ASSERTV(started, numChunks, i,
+                            (i < numChunks) == recorder.d_counts[i]);
+                }
+                if (!started) {
+                    ASSERTV(numChunks, 0 == recorder.d_numOtherThreads);
+                }
+                else if (4 <= numChunks) {
+                    ASSERTV(numChunks, 0 < recorder.d_numOtherThreads);
+                }
+            }
+        }
+        pool.stop();
+
+        if (verbose) cout << "\tNegative testing.\n";
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ChunkRecorder recorder;
+
+            ASSERT_PASS(Runner::run(Policy(&pool, 4), 1, recorder));
+            ASSERT_FAIL(Runner::run(Policy(&pool, 4), 0, recorder));
+            ASSERT_FAIL(Runner::run(Policy(),         1, recorder));
+
+            ASSERT_PASS(Policy(&pool, 1));
+            ASSERT_FAIL(Policy(&pool, 0));
+            ASSERT_FAIL(Policy().enqueueJob(Policy::Job()));
+
+            ASSERT_PASS(Runner::chunkOffset(10, 3, 3));
+            ASSERT_FAIL(Runner::chunkOffset(10, 3, 4));
+            ASSERT_FAIL(Runner::chunkOffset(10, 3, -1));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Create policies, check their attributes, compare them, and
+        //    install one as the default policy.
+        //
+        // 2. Sort a vector sequentially and in parallel.
+        //
+        // Testing:
+        //   BREATHING TEST
+        //   ParallelAlgorithmPolicy defaultPolicy();
+        //   void setDefaultPolicy(const ParallelAlgorithmPolicy&);
+        //   ParallelAlgorithmPolicy();
+        //   ParallelAlgorithmPolicy(THREAD_POOL *, int, size_t);
+        //   ParallelAlgorithmPolicy& setSequentialThreshold(size_t);
+        //   int enqueueJob(const Job&) const;
+        //   bool isSequential() const;
+        //   int maxConcurrency() const;
+        //   size_t sequentialThreshold() const;
+        //   void *threadPool() const;
+        //   bool operator==(const ParallelAlgorithmPolicy&, const P...&);
+        //   bool operator!=(const ParallelAlgorithmPolicy&, const P...&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "BREATHING TEST\n"
+                             "==============\n";
+
+        bdlmt::ThreadPool pool(attributes, 3, 3, 1000);
+        ASSERT(0 == pool.start());
+
+        const Policy X;
+        ASSERT(true == X.isSequential());
+        ASSERT(0    == X.threadPool());
+        ASSERT(1    == X.maxConcurrency());
+        ASSERT(Policy::k_DEFAULT_SEQUENTIAL_THRESHOLD ==
+                                                     X.sequentialThreshold());
+
+        Policy mY(&pool, 4);  const Policy& Y = mY;
+        ASSERT(false == Y.isSequential());
+        ASSERT(&pool == Y.threadPool());
+        ASSERT(4     == Y.maxConcurrency());
+        ASSERT(Policy::k_DEFAULT_SEQUENTIAL_THRESHOLD ==
+                                                     Y.sequentialThreshold());
+        ASSERT(X != Y);
+
+        ASSERT(&mY == &mY.setSequentialThreshold(100));
+        ASSERT(100 == Y.sequentialThreshold());
+
+        ASSERT(true == Policy(&pool, 1).isSequential());
+        ASSERT(Policy(&pool, 4, 100) == Y);
+        ASSERT(Policy(&pool, 4, 101) != Y);
+        ASSERT(Policy(&pool, 3, 100) != Y);
+
+        bsls::AtomicInt count(0);
+        CountJob        job = { &count };
+        ASSERT(0 == Y.enqueueJob(job));
+        pool.drain();
+        ASSERT(1 == count);
+
+        ASSERT(X == Policy::defaultPolicy());
+        Policy::setDefaultPolicy(Y);
+        ASSERT(Y == Policy::defaultPolicy());
+        Policy::setDefaultPolicy(X);
+        ASSERT(X == Policy::defaultPolicy());
+
+        bsl::vector<int> values = randomInts(1000, 100, 1);
+        Util::sort(X, values.begin(), values.end());
+        ASSERT(isSorted(values));
+
+        values = randomInts(1000, 100, 2);
+        Util::sort(Y, values.begin(), values.end());
+        ASSERT(isSorted(values));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: PARALLEL VS. SEQUENTIAL ALGORITHMS
+        //
+        // Concerns:
+        // 1. The parallel algorithms are faster than their sequential
+        //    counterparts on large inputs.
+        //
+        // Plan:
+        // 1. Time `sort`, `stableSort`, `transform`, and `reduce` on ten
+        //    million pseudo-random integers, sequentially and with the number
+        //    of threads specified as the second argument (default 4).
+        //
+        // Testing:
+        //   PERFORMANCE: PARALLEL VS. SEQUENTIAL ALGORITHMS
+        // --------------------------------------------------------------------
+
+        cout << "PERFORMANCE: PARALLEL VS. SEQUENTIAL ALGORITHMS\n"
+                "===============================================\n";
+
+        const int NUM_THREADS = argc > 2 ? bsl::atoi(argv[2]) : 4;
+        const int SIZE        = 10 * 1000 * 1000;
+
+        bdlmt::ThreadPool pool(attributes,
+                               NUM_THREADS - 1,
+                               NUM_THREADS - 1,
+                               1000);
+        ASSERT(0 == pool.start());
+
+        const Policy SEQUENTIAL;
+        const Policy PARALLEL(&pool, NUM_THREADS);
+
+        const bsl::vector<int> INPUT = randomInts(SIZE, 1 << 30, 12345);
+
+        bsls::Stopwatch  sw;
+        bsl::vector<int> values;
+        long long        sum = 0;
+
+        for (int parallel = 0; parallel < 2; ++parallel) {
+            const Policy& POLICY = parallel ? PARALLEL : SEQUENTIAL;
+
+            cout << (parallel ? "parallel " : "sequential ")
+                 << "(" << (parallel ? NUM_THREADS : 1) << " threads)\n";
+
+            values = INPUT;
+            sw.reset();  sw.start();
+            Util::sort(POLICY, values.begin(), values.end());
+            sw.stop();
+            cout << "\tsort:       " << sw.elapsedTime() << "s\n";
+
+            values = INPUT;
+            sw.reset();  sw.start();
+            Util::stableSort(POLICY, values.begin(), values.end());
+            sw.stop();
+            cout << "\tstableSort: " << sw.elapsedTime() << "s\n";
+
+            sw.reset();  sw.start();
+            Util::transform(POLICY,
+                            INPUT.begin(),
+                            INPUT.end(),
+                            values.begin(),
+                            &twice);
+            sw.stop();
+            cout << "\ttransform:  " << sw.elapsedTime() << "s\n";
+
+            sw.reset();  sw.start();
+            sum += Util::reduce(POLICY, INPUT.begin(), INPUT.end(), 0LL);
+            sw.stop();
+            cout << "\treduce:     " << sw.elapsedTime() << "s\n";
+        }
+        if (veryVerbose) { P(sum) }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,37 @@
+// bsl_flat_map.h                                                     -*-C++-*-
+#ifndef INCLUDED_BSL_FLAT_MAP
+#define INCLUDED_BSL_FLAT_MAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide functionality of the corresponding C++ Standard header.
+//
+//@SEE_ALSO:
+//
+//@DESCRIPTION: Provide types, in the `bsl` namespace, equivalent to those
+// defined in the corresponding C++ standard header.  Include
+// `bslstl_flatmap.h`, which provides Bloomberg's implementation on all
+// platforms, and `bslstl_sortedtags.h`, which provides the tags used to
+// insert ranges that are known to be sorted.
+
+#include <bslstl_flatmap.h>
+#include <bslstl_sortedtags.h>
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,813 @@
+// bslh_xxh3hashalgorithm.cpp                                         -*-C++-*-
+#include <bslh_xxh3hashalgorithm.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+#include <bsls_byteorder.h>
+#include <bsls_platform.h>
+
+#if defined(BSLS_PLATFORM_CPU_AVX2)
+#include <immintrin.h>
+#elif defined(BSLS_PLATFORM_CPU_SSE2)
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER) && defined(_M_X64)
+# include <intrin.h>
+# pragma intrinsic(_umul128)
+#endif
+
+// The algorithm implemented here is the 64-bit variant of XXH3, as specified
+// by the reference implementation in `xxhash.h`, version 0.8, available from
+// https://github.com/Cyan4973/xxHash, whose license follows.
+//
+// xxHash - Extremely Fast Hash algorithm
+// Copyright (C) 2012-2023 Yann Collet
+//
+// BSD 2-Clause License (https://www.opensource.org/licenses/bsd-license.php)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//    * Redistributions in binary form must reproduce the above
+//      copyright notice, this list of conditions and the following disclaimer
+//      in the documentation and/or other materials provided with the
+//      distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+///IMPLEMENTATION NOTES
+///--------------------
+// The code below is an independent, BDE-style rendition of the reference
+// algorithm, restricted to the 64-bit hash with a 64-bit seed and the default
+// key material ("secret").  Inputs of at most 240 bytes are hashed, at
+// `computeHash` time, from the internal buffer by the three short-input
+// routines.  Longer inputs are consumed in 64-byte stripes as they arrive,
+// exactly as by the streaming interface of the reference implementation
+// (`XXH3_64bits_update`), whose results equal those of the one-shot function
+// for the same input.
+//
+// The stripe kernels (`accumulate` and `scramble`) are provided in three
+// variants, selected at compile time: AVX2, processing a stripe in two 256-bit
+// registers; SSE2, processing it in four 128-bit registers; and portable
+// scalar code.  The vector variants keep the accumulators in registers across
+// all of the stripes of a call.  All of the variants compute the same
+// function.
+
+namespace BloombergLP {
+namespace bslh {
+namespace {
+
+typedef bsls::Types::Uint64 Uint64;
+typedef unsigned int        Uint32;
+
+// CONSTANTS
+const Uint32 k_PRIME32_1 = 0x9E3779B1U;
+const Uint32 k_PRIME32_2 = 0x85EBCA77U;
+const Uint32 k_PRIME32_3 = 0xC2B2AE3DU;
+
+const Uint64 k_PRIME64_1 = 0x9E3779B185EBCA87ULL;
+const Uint64 k_PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+const Uint64 k_PRIME64_3 = 0x165667B19E3779F9ULL;
+const Uint64 k_PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+const Uint64 k_PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+const Uint64 k_PRIME_MX1 = 0x165667919E3779F9ULL;
+const Uint64 k_PRIME_MX2 = 0x9FB21C651E98DF25ULL;
+
+const size_t k_STRIPE_LENGTH       = 64;
+const size_t k_SECRET_LENGTH       = 192;
+const size_t k_SECRET_CONSUME_RATE = 8;   // secret bytes per stripe
+const size_t k_SECRET_LIMIT        = k_SECRET_LENGTH - k_STRIPE_LENGTH;
+const size_t k_STRIPES_PER_BLOCK   = k_SECRET_LIMIT / k_SECRET_CONSUME_RATE;
+const size_t k_LAST_STRIPE_OFFSET  = 7;   // secret offset of the last stripe
+const size_t k_MERGE_OFFSET        = 11;  // secret offset of the final merge
+const size_t k_MIDSIZE_START       = 3;   // secret offsets of the 129-240
+const size_t k_MIDSIZE_LAST        = 17;  // byte routine
+const size_t k_SECRET_SIZE_MIN     = 136;
+
+/// The default key material of XXH3.
+const unsigned char k_DEFAULT_SECRET[k_SECRET_LENGTH] = {
+    0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe,
+    0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+    0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb,
+    0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+    0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78,
+    0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+    0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e,
+    0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+    0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb,
+    0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+    0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e,
+    0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+    0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f,
+    0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+    0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31,
+    0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+    0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3,
+    0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+    0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49,
+    0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+    0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc,
+    0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+    0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28,
+    0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e
+};
+
+                            // ================
+                            // Scalar Utilities
+                            // ================
+
+/// Return the 32-bit little-endian value at the specified `p`.
+inline
+Uint32 readLE32(const unsigned char *p)
+{
+    Uint32 result;
+    memcpy(&result, p, sizeof result);
+    return BSLS_BYTEORDER_LE_U32_TO_HOST(result);
+}
+
+/// Return the 64-bit little-endian value at the specified `p`.
+inline
+Uint64 readLE64(const unsigned char *p)
+{
+    Uint64 result;
+    memcpy(&result, p, sizeof result);
+    return BSLS_BYTEORDER_LE_U64_TO_HOST(result);
+}
+
+/// Store the specified `value` at the specified `p` in little-endian order.
+inline
+void writeLE64(unsigned char *p, Uint64 value)
+{
+    value = BSLS_BYTEORDER_HOST_U64_TO_LE(value);
+    memcpy(p, &value, sizeof value);
+}
+
+/// Return the specified `value` with its bytes in reverse order.
+inline
+Uint64 swap64(Uint64 value)
+{
+    value = ((value << 8)  & 0xFF00FF00FF00FF00ULL)
+          | ((value >> 8)  & 0x00FF00FF00FF00FFULL);
+    value = ((value << 16) & 0xFFFF0000FFFF0000ULL)
+          | ((value >> 16) & 0x0000FFFF0000FFFFULL);
+    return (value << 32) | (value >> 32);
+}
+
+/// Return the specified `value` with its bytes in reverse order.
+inline
+Uint32 swap32(Uint32 value)
+{
+    return ((value << 24) & 0xff000000U)
+         | ((value <<  8) & 0x00ff0000U)
+         | ((value >>  8) & 0x0000ff00U)
+         | ((value >> 24) & 0x000000ffU);
+}
+
+/// Return the specified `value` rotated left by the specified `shift` bits.
+/// The behavior is undefined unless `0 < shift < 64`.
+inline
+Uint64 rotl64(Uint64 value, int shift)
+{
+    return (value << shift) | (value >> (64 - shift));
+}
+
+/// Return the exclusive-or of the low and high 64-bit halves of the 128-bit
+/// product of the specified `lhs` and `rhs`.
+inline
+Uint64 multiplyFold64(Uint64 lhs, Uint64 rhs)
+{
+#if defined(__SIZEOF_INT128__)
+    const __uint128_t product = static_cast<__uint128_t>(lhs) * rhs;
+
+    return static_cast<Uint64>(product) ^ static_cast<Uint64>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    Uint64       high;
+    const Uint64 low = _umul128(lhs, rhs, &high);
+
+    return low ^ high;
+#else
+    const Uint64 loLo  = (lhs & 0xFFFFFFFF) * (rhs & 0xFFFFFFFF);
+    const Uint64 hiLo  = (lhs >> 32)        * (rhs & 0xFFFFFFFF);
+    const Uint64 loHi  = (lhs & 0xFFFFFFFF) * (rhs >> 32);
+    const Uint64 hiHi  = (lhs >> 32)        * (rhs >> 32);
+    const Uint64 cross = (loLo >> 32) + (hiLo & 0xFFFFFFFF) + loHi;
+    const Uint64 upper = (hiLo >> 32) + (cross >> 32) + hiHi;
+    const Uint64 lower = (cross << 32) | (loLo & 0xFFFFFFFF);
+
+    return lower ^ upper;
+#endif
+}
+
+/// Return the XXH64 avalanche of the specified `hash`.
+inline
+Uint64 avalanche64(Uint64 hash)
+{
+    hash ^= hash >> 33;
+    hash *= k_PRIME64_2;
+    hash ^= hash >> 29;
+    hash *= k_PRIME64_3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+/// Return the XXH3 avalanche of the specified `hash`.
+inline
+Uint64 avalanche(Uint64 hash)
+{
+    hash ^= hash >> 37;
+    hash *= k_PRIME_MX1;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+/// Return the "rrmxmx" mix of the specified `hash` and `length`.
+inline
+Uint64 rrmxmx(Uint64 hash, Uint64 length)
+{
+    hash ^= rotl64(hash, 49) ^ rotl64(hash, 24);
+    hash *= k_PRIME_MX2;
+    hash ^= (hash >> 35) + length;
+    hash *= k_PRIME_MX2;
+    return hash ^ (hash >> 28);
+}
+
+/// Return the mix of the 16 bytes at the specified `input` with the 16
+/// bytes of key material at the specified `secret` and the specified
+/// `seed`.
+inline
+Uint64 mix16(const unsigned char *input,
+             const unsigned char *secret,
+             Uint64               seed)
+{
+    return multiplyFold64(readLE64(input)     ^ (readLE64(secret)     + seed),
+                          readLE64(input + 8) ^ (readLE64(secret + 8) - seed));
+}
+
+                            // ===================
+                            // Short-Input Hashing
+                            // ===================
+
+/// Return the hash of the specified `input` having the specified `length`
+/// and the specified `seed`, using the key material at the specified
+/// `secret`.  The behavior is undefined unless `length <= 16`.
+Uint64 hashUpTo16(const unsigned char *input,
+                  size_t               length,
+                  const unsigned char *secret,
+                  Uint64               seed)
+{
+    if (length > 8) {
+        const Uint64 bitflip1 = (readLE64(secret + 24) ^ readLE64(secret + 32))
+                              + seed;
+        const Uint64 bitflip2 = (readLE64(secret + 40) ^ readLE64(secret + 48))
+                              - seed;
+        const Uint64 low      = readLE64(input) ^ bitflip1;
+        const Uint64 high     = readLE64(input + length - 8) ^ bitflip2;
+        const Uint64 acc      = length + swap64(low) + high
+                              + multiplyFold64(low, high);
+
+        return avalanche(acc);                                        // RETURN
+    }
+
+    if (length >= 4) {
+        seed ^= static_cast<Uint64>(swap32(static_cast<Uint32>(seed))) << 32;
+
+        const Uint32 input1  = readLE32(input);
+        const Uint32 input2  = readLE32(input + length - 4);
+        const Uint64 bitflip = (readLE64(secret + 8) ^ readLE64(secret + 16))
+                             - seed;
+        const Uint64 input64 = input2 + (static_cast<Uint64>(input1) << 32);
+
+        return rrmxmx(input64 ^ bitflip, length);                     // RETURN
+    }
+
+    if (length) {
+        const Uint32 c1       = input[0];
+        const Uint32 c2       = input[length >> 1];
+        const Uint32 c3       = input[length - 1];
+        const Uint32 combined = (c1 << 16)
+                              | (c2 << 24)
+                              | c3
+                              | (static_cast<Uint32>(length) << 8);
+        const Uint64 bitflip  = (readLE32(secret) ^ readLE32(secret + 4))
+                              + seed;
+
+        return avalanche64(combined ^ bitflip);                       // RETURN
+    }
+
+    return avalanche64(seed ^ (readLE64(secret + 56) ^ readLE64(secret + 64)));
+}
+
+/// Return the hash of the specified `input` having the specified `length`
+/// and the specified `seed`, using the key material at the specified
+/// `secret`.  The behavior is undefined unless `16 < length <= 128`.
+Uint64 hashUpTo128(const unsigned char *input,
+                   size_t               length,
+                   const unsigned char *secret,
+                   Uint64               seed)
+{
+    Uint64 acc = length * k_PRIME64_1;
+
+    if (length > 32) {
+        if (length > 64) {
+            if (length > 96) {
+                acc += mix16(input + 48,          secret + 96,  seed);
+                acc += mix16(input + length - 64, secret + 112, seed);
+            }
+            acc += mix16(input + 32,          secret + 64, seed);
+            acc += mix16(input + length - 48, secret + 80, seed);
+        }
+        acc += mix16(input + 16,          secret + 32, seed);
+        acc += mix16(input + length - 32, secret + 48, seed);
+    }
+    acc += mix16(input,               secret,      seed);
+    acc += mix16(input + length - 16, secret + 16, seed);
+
+    return avalanche(acc);
+}
+
+/// Return the hash of the specified `input` having the specified `length`
+/// and the specified `seed`, using the key material at the specified
+/// `secret`.  The behavior is undefined unless `128 < length <= 240`.
+Uint64 hashUpTo240(const unsigned char *input,
+                   size_t               length,
+                   const unsigned char *secret,
+                   Uint64               seed)
+{
+    const size_t numRounds = length / 16;
+
+    Uint64 acc = length * k_PRIME64_1;
+    for (size_t i = 0; i < 8; ++i) {
+        acc += mix16(input + 16 * i, secret + 16 * i, seed);
+    }
+    acc = avalanche(acc);
+
+    Uint64 accEnd = mix16(input + length - 16,
+                          secret + k_SECRET_SIZE_MIN - k_MIDSIZE_LAST,
+                          seed);
+    for (size_t i = 8; i < numRounds; ++i) {
+        accEnd += mix16(input + 16 * i,
+                        secret + 16 * (i - 8) + k_MIDSIZE_START,
+                        seed);
+    }
+
+    return avalanche(acc + accEnd);
+}
+
+                            // ==============
+                            // Stripe Kernels
+                            // ==============
+
+#if defined(BSLS_PLATFORM_CPU_AVX2)
+
+/// Accumulate into the specified `acc` the specified `numStripes`
+/// consecutive stripes starting at the specified `input`, using key material
+/// starting at the specified `secret` and advancing by
+/// `k_SECRET_CONSUME_RATE` bytes per stripe.
+void accumulate(Uint64              *acc,
+                const unsigned char *input,
+                const unsigned char *secret,
+                size_t               numStripes)
+{
+    __m256i acc0 = _mm256_loadu_si256(reinterpret_cast<__m256i *>(acc));
+    __m256i acc1 = _mm256_loadu_si256(reinterpret_cast<__m256i *>(acc + 4));
+
+    for (size_t n = 0; n < numStripes; ++n) {
+        const __m256i *in  = reinterpret_cast<const __m256i *>(input);
+        const __m256i *key = reinterpret_cast<const __m256i *>(secret);
+
+        const __m256i data0 = _mm256_loadu_si256(in);
+        const __m256i data1 = _mm256_loadu_si256(in + 1);
+        const __m256i dk0   = _mm256_xor_si256(data0,
+                                               _mm256_loadu_si256(key));
+        const __m256i dk1   = _mm256_xor_si256(data1,
+                                               _mm256_loadu_si256(key + 1));
+
+        // acc[i] += swap(data) + low32(dk) * high32(dk)
+
+        const __m256i product0 = _mm256_mul_epu32(dk0,
+                                                  _mm256_srli_epi64(dk0, 32));
+        const __m256i product1 = _mm256_mul_epu32(dk1,
+                                                  _mm256_srli_epi64(dk1, 32));
+
+        acc0 = _mm256_add_epi64(
+                  acc0,
+                  _mm256_add_epi64(_mm256_shuffle_epi32(data0, 0x4E),
+                                   product0));
+        acc1 = _mm256_add_epi64(
+                  acc1,
+                  _mm256_add_epi64(_mm256_shuffle_epi32(data1, 0x4E),
+                                   product1));
+
+        input  += k_STRIPE_LENGTH;
+        secret += k_SECRET_CONSUME_RATE;
+    }
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(acc),     acc0);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(acc + 4), acc1);
+}
+
+/// Scramble the specified `acc` using the key material at the specified
+/// `secret`.
+void scramble(Uint64 *acc, const unsigned char *secret)
+{
+    const __m256i prime = _mm256_set1_epi32(static_cast<int>(k_PRIME32_1));
+
+    for (int i = 0; i < 2; ++i) {
+        __m256i *a = reinterpret_cast<__m256i *>(acc) + i;
+
+        const __m256i value = _mm256_loadu_si256(a);
+        const __m256i key   = _mm256_loadu_si256(
+                                reinterpret_cast<const __m256i *>(secret) + i);
+        const __m256i dk    = _mm256_xor_si256(
+                                _mm256_xor_si256(value,
+                                                 _mm256_srli_epi64(value, 47)),
+                                key);
+
+        // dk *= k_PRIME32_1 (modulo 2^64)
+
+        const __m256i productLow  = _mm256_mul_epu32(dk, prime);
+        const __m256i productHigh = _mm256_mul_epu32(
+                                                     _mm256_srli_epi64(dk, 32),
+                                                     prime);
+
+        _mm256_storeu_si256(a,
+                            _mm256_add_epi64(
+                                      productLow,
+                                      _mm256_slli_epi64(productHigh, 32)));
+    }
+}
+
+#elif defined(BSLS_PLATFORM_CPU_SSE2)
+
+/// Return the specified `acc` updated with the 16 bytes of input at the
+/// specified `input`, using the 16 bytes of key material at the specified
+/// `secret`.
+inline
+__m128i accumulateLanes(__m128i acc, const void *input, const void *secret)
+{
+    const __m128i data    = _mm_loadu_si128(static_cast<const __m128i *>(
+                                                                      input));
+    const __m128i dk      = _mm_xor_si128(
+                                   data,
+                                   _mm_loadu_si128(
+                                      static_cast<const __m128i *>(secret)));
+
+    // acc += swap(data) + low32(dk) * high32(dk)
+
+    const __m128i product = _mm_mul_epu32(dk, _mm_shuffle_epi32(dk, 0x31));
+
+    return _mm_add_epi64(acc,
+                         _mm_add_epi64(_mm_shuffle_epi32(data, 0x4E),
+                                       product));
+}
+
+/// Accumulate into the specified `acc` the specified `numStripes`
+/// consecutive stripes starting at the specified `input`, using key material
+/// starting at the specified `secret` and advancing by
+/// `k_SECRET_CONSUME_RATE` bytes per stripe.
+void accumulate(Uint64              *acc,
+                const unsigned char *input,
+                const unsigned char *secret,
+                size_t               numStripes)
+{
+    // The four registers are named individually, rather than held in an
+    // array, so that they stay in registers at all optimization levels.
+
+    __m128i *accs = reinterpret_cast<__m128i *>(acc);
+
+    __m128i acc0 = _mm_loadu_si128(accs);
+    __m128i acc1 = _mm_loadu_si128(accs + 1);
+    __m128i acc2 = _mm_loadu_si128(accs + 2);
+    __m128i acc3 = _mm_loadu_si128(accs + 3);
+
+    for (size_t n = 0; n < numStripes; ++n) {
+        acc0 = accumulateLanes(acc0, input,      secret);
+        acc1 = accumulateLanes(acc1, input + 16, secret + 16);
+        acc2 = accumulateLanes(acc2, input + 32, secret + 32);
+        acc3 = accumulateLanes(acc3, input + 48, secret + 48);
+
+        input  += k_STRIPE_LENGTH;
+        secret += k_SECRET_CONSUME_RATE;
+    }
+
+    _mm_storeu_si128(accs,     acc0);
+    _mm_storeu_si128(accs + 1, acc1);
+    _mm_storeu_si128(accs + 2, acc2);
+    _mm_storeu_si128(accs + 3, acc3);
+}
+
+/// Scramble the specified `acc` using the key material at the specified
+/// `secret`.
+void scramble(Uint64 *acc, const unsigned char *secret)
+{
+    const __m128i prime = _mm_set1_epi32(static_cast<int>(k_PRIME32_1));
+
+    for (int i = 0; i < 4; ++i) {
+        __m128i *a = reinterpret_cast<__m128i *>(acc) + i;
+
+        const __m128i value = _mm_loadu_si128(a);
+        const __m128i key   = _mm_loadu_si128(
+                                reinterpret_cast<const __m128i *>(secret) + i);
+        const __m128i dk    = _mm_xor_si128(
+                                      _mm_xor_si128(value,
+                                                    _mm_srli_epi64(value, 47)),
+                                      key);
+
+        // dk *= k_PRIME32_1 (modulo 2^64)
+
+        const __m128i productLow  = _mm_mul_epu32(dk, prime);
+        const __m128i productHigh = _mm_mul_epu32(_mm_shuffle_epi32(dk, 0x31),
+                                                  prime);
+
+        _mm_storeu_si128(a,
+                         _mm_add_epi64(productLow,
+                                       _mm_slli_epi64(productHigh, 32)));
+    }
+}
+
+#else
+
+/// Accumulate into the specified `acc` the specified `numStripes`
+/// consecutive stripes starting at the specified `input`, using key material
+/// starting at the specified `secret` and advancing by
+/// `k_SECRET_CONSUME_RATE` bytes per stripe.
+void accumulate(Uint64              *acc,
+                const unsigned char *input,
+                const unsigned char *secret,
+                size_t               numStripes)
+{
+    for (size_t n = 0; n < numStripes; ++n) {
+        for (size_t i = 0; i < 8; ++i) {
+            const Uint64 data = readLE64(input + 8 * i);
+            const Uint64 dk   = data ^ readLE64(secret + 8 * i);
+
+            acc[i ^ 1] += data;
+            acc[i]     += (dk & 0xFFFFFFFF) * (dk >> 32);
+        }
+
+        input  += k_STRIPE_LENGTH;
+        secret += k_SECRET_CONSUME_RATE;
+    }
+}
+
+/// Scramble the specified `acc` using the key material at the specified
+/// `secret`.
+void scramble(Uint64 *acc, const unsigned char *secret)
+{
+    for (size_t i = 0; i < 8; ++i) {
+        Uint64 value = acc[i];
+
+        value ^= value >> 47;
+        value ^= readLE64(secret + 8 * i);
+        value *= k_PRIME32_1;
+
+        acc[i] = value;
+    }
+}
+
+#endif
+
+/// Consume into the specified `acc` the specified `numStripes` stripes
+/// starting at the specified `input`, using the key material at the
+/// specified `secret`, scrambling `acc` whenever a block of
+/// `k_STRIPES_PER_BLOCK` stripes is completed, where the specified
+/// `numStripesInBlock` holds the number of stripes of the current block
+/// consumed before this call, and is updated.  Return the address one past
+/// the last byte consumed.
+const unsigned char *consumeStripes(Uint64              *acc,
+                                    size_t              *numStripesInBlock,
+                                    const unsigned char *input,
+                                    size_t               numStripes,
+                                    const unsigned char *secret)
+{
+    const unsigned char *initialSecret = secret
+                                  + *numStripesInBlock * k_SECRET_CONSUME_RATE;
+
+    if (numStripes >= k_STRIPES_PER_BLOCK - *numStripesInBlock) {
+        size_t numStripesThisBlock = k_STRIPES_PER_BLOCK - *numStripesInBlock;
+
+        do {
+            accumulate(acc, input, initialSecret, numStripesThisBlock);
+            scramble(acc, secret + k_SECRET_LIMIT);
+
+            input      += numStripesThisBlock * k_STRIPE_LENGTH;
+            numStripes -= numStripesThisBlock;
+
+            numStripesThisBlock = k_STRIPES_PER_BLOCK;
+            initialSecret       = secret;
+        } while (numStripes >= k_STRIPES_PER_BLOCK);
+
+        *numStripesInBlock = 0;
+    }
+
+    if (numStripes) {
+        accumulate(acc, input, initialSecret, numStripes);
+
+        input              += numStripes * k_STRIPE_LENGTH;
+        *numStripesInBlock += numStripes;
+    }
+
+    return input;
+}
+
+}  // close unnamed namespace
+
+                          // -----------------------
+                          // class Xxh3HashAlgorithm
+                          // -----------------------
+
+// PRIVATE MANIPULATORS
+void Xxh3HashAlgorithm::consumeLongInput(const unsigned char *data,
+                                         size_t               numBytes)
+{
+    BSLS_ASSERT(k_BUFFER_LENGTH - d_bufferLength < numBytes);
+
+    if (d_totalLength <= k_BUFFER_LENGTH) {
+        // No stripe has been consumed yet.
+
+        prepareLongInput();
+    }
+    d_totalLength += numBytes;
+
+    const unsigned char *secret = d_seed ? d_secret : k_DEFAULT_SECRET;
+    const unsigned char *end    = data + numBytes;
+
+    if (d_bufferLength) {
+        // Complete the buffer, and consume it.
+
+        const size_t loadSize = k_BUFFER_LENGTH - d_bufferLength;
+
+        memcpy(d_buffer + d_bufferLength, data, loadSize);
+        data += loadSize;
+
+        consumeStripes(d_accumulators,
+                       &d_numStripesInBlock,
+                       d_buffer,
+                       k_BUFFER_LENGTH / k_STRIPE_LENGTH,
+                       secret);
+        d_bufferLength = 0;
+    }
+
+    if (end - data > static_cast<ptrdiff_t>(k_BUFFER_LENGTH)) {
+        // Consume all but the last (possibly partial) stripe directly from
+        // the input, retaining the last stripe consumed at the end of the
+        // buffer, where `computeHash` may need it.
+
+        const size_t numStripes = (end - 1 - data) / k_STRIPE_LENGTH;
+
+        data = consumeStripes(d_accumulators,
+                              &d_numStripesInBlock,
+                              data,
+                              numStripes,
+                              secret);
+
+        memcpy(d_buffer + k_BUFFER_LENGTH - k_STRIPE_LENGTH,
+               data - k_STRIPE_LENGTH,
+               k_STRIPE_LENGTH);
+    }
+
+    // Buffer the remaining (always non-empty) input.
+
+    d_bufferLength = end - data;
+    memcpy(d_buffer, data, d_bufferLength);
+}
+
+void Xxh3HashAlgorithm::prepareLongInput()
+{
+    d_accumulators[0] = k_PRIME32_3;
+    d_accumulators[1] = k_PRIME64_1;
+    d_accumulators[2] = k_PRIME64_2;
+    d_accumulators[3] = k_PRIME64_3;
+    d_accumulators[4] = k_PRIME64_4;
+    d_accumulators[5] = k_PRIME32_2;
+    d_accumulators[6] = k_PRIME64_5;
+    d_accumulators[7] = k_PRIME32_1;
+
+    d_numStripesInBlock = 0;
+
+    if (d_seed) {
+        for (size_t i = 0; i < k_SECRET_LENGTH; i += 16) {
+            writeLE64(d_secret + i,
+                      readLE64(k_DEFAULT_SECRET + i) + d_seed);
+            writeLE64(d_secret + i + 8,
+                      readLE64(k_DEFAULT_SECRET + i + 8) - d_seed);
+        }
+    }
+}
+
+// MANIPULATORS
+Xxh3HashAlgorithm::result_type Xxh3HashAlgorithm::computeHash()
+{
+    const size_t length = static_cast<size_t>(d_totalLength);
+
+    if (d_totalLength <= k_MIDSIZE_MAX) {
+        if (length <= 16) {
+            return hashUpTo16(d_buffer,
+                              length,
+                              k_DEFAULT_SECRET,
+                              d_seed);                                // RETURN
+        }
+        if (length <= 128) {
+            return hashUpTo128(d_buffer,
+                               length,
+                               k_DEFAULT_SECRET,
+                               d_seed);                               // RETURN
+        }
+        return hashUpTo240(d_buffer,
+                           length,
+                           k_DEFAULT_SECRET,
+                           d_seed);                                   // RETURN
+    }
+
+    if (d_totalLength <= k_BUFFER_LENGTH) {
+        // No stripe has been consumed yet.
+
+        prepareLongInput();
+    }
+
+    const unsigned char *secret = d_seed ? d_secret : k_DEFAULT_SECRET;
+
+    // Digest on a copy of the accumulators, so that the state of this object
+    // is unaffected.
+
+    Uint64 acc[k_NUM_ACCUMULATORS];
+    memcpy(acc, d_accumulators, sizeof acc);
+
+    unsigned char        lastStripe[k_STRIPE_LENGTH];
+    const unsigned char *lastStripePtr;
+
+    if (d_bufferLength >= k_STRIPE_LENGTH) {
+        size_t numStripesInBlock = d_numStripesInBlock;
+
+        consumeStripes(acc,
+                       &numStripesInBlock,
+                       d_buffer,
+                       (d_bufferLength - 1) / k_STRIPE_LENGTH,
+                       secret);
+
+        lastStripePtr = d_buffer + d_bufferLength - k_STRIPE_LENGTH;
+    }
+    else {
+        // The last stripe begins in the previously consumed stripe retained
+        // at the end of the buffer.
+
+        const size_t catchUpSize = k_STRIPE_LENGTH - d_bufferLength;
+
+        memcpy(lastStripe,
+               d_buffer + k_BUFFER_LENGTH - catchUpSize,
+               catchUpSize);
+        memcpy(lastStripe + catchUpSize, d_buffer, d_bufferLength);
+
+        lastStripePtr = lastStripe;
+    }
+
+    accumulate(acc,
+               lastStripePtr,
+               secret + k_SECRET_LIMIT - k_LAST_STRIPE_OFFSET,
+               1);
+
+    Uint64 result = d_totalLength * k_PRIME64_1;
+    for (size_t i = 0; i < k_NUM_ACCUMULATORS; i += 2) {
+        const unsigned char *key = secret + k_MERGE_OFFSET + 8 * i;
+
+        result += multiplyFold64(acc[i]     ^ readLE64(key),
+                                 acc[i + 1] ^ readLE64(key + 8));
+    }
+
+    return avalanche(result);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
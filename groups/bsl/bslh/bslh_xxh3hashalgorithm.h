@@ -0,0 +1,364 @@
+// bslh_xxh3hashalgorithm.h                                           -*-C++-*-
+#ifndef INCLUDED_BSLH_XXH3HASHALGORITHM
+#define INCLUDED_BSLH_XXH3HASHALGORITHM
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a vectorized implementation of the 64-bit XXH3 algorithm.
+//
+//@CLASSES:
+//  bslh::Xxh3HashAlgorithm: functor implementing the 64-bit XXH3 algorithm
+//
+//@SEE_ALSO: bslh_hash, bslh_seededhash, bslh_wyhashincrementalalgorithm
+//
+//@DESCRIPTION: `bslh::Xxh3HashAlgorithm` implements the 64-bit variant of the
+// XXH3 algorithm by Yann Collet (see https://github.com/Cyan4973/xxHash),
+// producing, for any sequence of bytes and seed, the same value as the
+// reference function `XXH3_64bits_withSeed` of xxHash version 0.8.
+//
+// XXH3 processes inputs longer than 240 bytes in 64-byte "stripes", each of
+// which is combined into eight independent 64-bit accumulators using only
+// 32x32->64-bit multiplies, additions, and exclusive-ors.  Unlike the 64x64
+// ->128-bit multiplies that dominate `bslh::WyHashIncrementalAlgorithm` and
+// `bslh::SpookyHashAlgorithm`, these operations map directly onto SIMD
+// instructions, so the stripes are processed with AVX2 instructions when the
+// component is compiled for a target supporting AVX2 (e.g., with `-mavx2` or
+// `-march=haswell`), with SSE2 instructions on other x86 targets, and with
+// portable scalar code elsewhere.  All three implementations produce the same
+// results.  Inputs of at most 240 bytes are hashed with dedicated scalar code.
+//
+// This class satisfies the requirements for regular `bslh` hashing algorithms
+// and seeded `bslh` hashing algorithms, as defined in `bslh_hash` and
+// `bslh_seededhash` respectively.
+//
+///Security
+///--------
+// XXH3 is *not* a cryptographically secure hash, and, unlike
+// `bslh::SipHashAlgorithm`, it is not designed to be a cryptographically
+// strong PRF (pseudo-random function) either.  It should not be relied upon
+// to protect a hash table against malicious input chosen to cause collisions,
+// even when seeded; use `bslh::SipHashAlgorithm` for that purpose.
+//
+///Hash Distribution
+///-----------------
+// Output hashes will be well distributed and will avalanche, which means
+// changing one bit of the input will change approximately 50% of the output
+// bits.  XXH3 passes the SMHasher test suite.
+//
+///Subdivision-Invariance
+///----------------------
+// Note that this algorithm is *subdivision-invariant* (see
+// {`bslh_hash`|Subdivision-Invariance}).  Input is buffered internally (up to
+// 256 bytes) so that hashing a segment in pieces yields the same result as
+// hashing it in a single pass.
+//
+///Hash Consistency
+///----------------
+// The hash produced for a given sequence of bytes and a given seed is the same
+// on all platforms, regardless of byte order and of the instruction set used,
+// and matches the value produced by the reference implementation.  However,
+// if the data hashed is not just a sequence of bytes but has internal
+// structure, such as being integral or floating-point, it is likely ordered in
+// different ways depending on the platform, and thus will not hash to the
+// same value.
+//
+///Speed
+///-----
+// The throughput of this algorithm on inputs of a few kilobytes or more grows
+// with the width of the SIMD registers available: when compiled for AVX2 it
+// is typically substantially faster than the other `bslh` algorithms, while
+// with SSE2 alone it is comparable to `bslh::WyHashIncrementalAlgorithm`.  On
+// inputs of up to 240 bytes it is somewhat slower than
+// `bslh::WyHashIncrementalAlgorithm`, and on inputs just longer than 240 bytes
+// (especially when seeded) it pays a fixed cost to set up the stripe
+// computation.  The test driver of this component contains a benchmark (test
+// case -1) comparing the throughput of all `bslh` algorithms across a range of
+// input sizes, which should be run on the target platform before choosing an
+// algorithm for performance reasons.  Note that an object of this class is
+// larger than those of the other `bslh` algorithms (it contains a 256-byte
+// input buffer and, if seeded, space for a 192-byte key derived from the
+// seed), but that construction does not initialize those buffers.
+//
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Detecting Duplicate Payloads
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain a cache of message payloads, each a few kilobytes long,
+// and want to detect cheaply whether an incoming payload has been seen
+// before.  Hashing such payloads is dominated by the processing of long
+// inputs, at which `bslh::Xxh3HashAlgorithm` excels.
+//
+// First, we define a function that computes the fingerprint of a payload,
+// which may arrive in several fragments:
+// ```
+// bsls::Types::Uint64 fingerprint(const char * const *fragments,
+//                                 const size_t       *lengths,
+//                                 int                 numFragments)
+// {
+//     bslh::Xxh3HashAlgorithm hasher;
+//
+//     for (int i = 0; i < numFragments; ++i) {
+//         hasher(fragments[i], lengths[i]);
+//     }
+//     return hasher.computeHash();
+// }
+// ```
+// Then, we create a payload, and a copy of it split into two fragments:
+// ```
+// char payload[2048];
+// for (int i = 0; i < 2048; ++i) {
+//     payload[i] = static_cast<char>('a' + i % 26);
+// }
+//
+// const char   *whole[]        = { payload };
+// const size_t  wholeLength[]  = { sizeof payload };
+// const char   *pieces[]       = { payload, payload + 1000 };
+// const size_t  pieceLengths[] = { 1000, sizeof payload - 1000 };
+// ```
+// Next, we observe that, because the algorithm is subdivision-invariant, the
+// fingerprint of the payload does not depend on how it was fragmented:
+// ```
+// assert(fingerprint(whole,  wholeLength,  1) ==
+//        fingerprint(pieces, pieceLengths, 2));
+// ```
+// Finally, we observe that changing a single byte of the payload changes its
+// fingerprint:
+// ```
+// const bsls::Types::Uint64 before = fingerprint(whole, wholeLength, 1);
+//
+// payload[1500] = '!';
+//
+// assert(before != fingerprint(whole, wholeLength, 1));
+// ```
+
+#include <bslscm_version.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_integralconstant.h>
+
+#include <bsls_assert.h>
+#include <bsls_keyword.h>
+#include <bsls_performancehint.h>
+#include <bsls_types.h>
+
+#include <stddef.h>  // for 'size_t'
+#include <string.h>  // for 'memcpy'
+
+namespace BloombergLP {
+namespace bslh {
+
+                          // =======================
+                          // class Xxh3HashAlgorithm
+                          // =======================
+
+/// This class wraps an implementation of the 64-bit "XXH3" hash algorithm in
+/// an interface that is usable in the modular hashing system in `bslh`.
+class Xxh3HashAlgorithm {
+
+  private:
+    // PRIVATE TYPES
+    typedef bsls::Types::Uint64 Uint64;
+
+    enum {
+        k_NUM_ACCUMULATORS = 8,    // 64-bit accumulators per stripe
+
+        k_STRIPE_LENGTH    = 64,   // bytes consumed by one accumulation
+
+        k_SECRET_LENGTH    = 192,  // bytes of key material
+
+        k_BUFFER_LENGTH    = 256,  // bytes of input buffered internally
+
+        k_MIDSIZE_MAX      = 240   // longest input hashed without stripes
+    };
+
+  public:
+    // TYPES
+
+    /// Typedef indicating the value type returned by this algorithm.
+    typedef Uint64 result_type;
+
+    enum { k_SEED_LENGTH = sizeof(Uint64) };
+
+  private:
+    // DATA
+    Uint64        d_accumulators[k_NUM_ACCUMULATORS];
+                                        // state of the long-input computation,
+                                        // initialized when the buffer first
+                                        // overflows
+
+    unsigned char d_buffer[k_BUFFER_LENGTH];
+                                        // input not yet consumed, and (for
+                                        // long input) the last stripe consumed
+
+    unsigned char d_secret[k_SECRET_LENGTH];
+                                        // key material derived from a
+                                        // non-zero seed, initialized when
+                                        // first needed
+
+    Uint64        d_seed;               // seed
+
+    Uint64        d_totalLength;        // total length of input so far
+
+    size_t        d_bufferLength;       // length of the input in `d_buffer`
+
+    size_t        d_numStripesInBlock;  // number of stripes consumed since
+                                        // the accumulators were last
+                                        // scrambled
+
+    // NOT IMPLEMENTED
+    Xxh3HashAlgorithm(const Xxh3HashAlgorithm&) BSLS_KEYWORD_DELETED;
+    Xxh3HashAlgorithm& operator=(const Xxh3HashAlgorithm&)
+                                                          BSLS_KEYWORD_DELETED;
+
+    // PRIVATE MANIPULATORS
+
+    /// Incorporate the specified `data` having the specified `numBytes`
+    /// into the internal state of this object in the case where the data
+    /// does not fit into the unused part of the buffer.  The behavior is
+    /// undefined unless
+    /// `k_BUFFER_LENGTH - d_bufferLength < numBytes`.
+    void consumeLongInput(const unsigned char *data, size_t numBytes);
+
+    /// Initialize the accumulators, and, if the seed is non-zero, the key
+    /// material derived from it, in preparation for the consumption of the
+    /// first stripe of a long input.
+    void prepareLongInput();
+
+  public:
+    // CREATORS
+
+    /// Create a `bslh::Xxh3HashAlgorithm` having a seed of 0.  Note that
+    /// the results of an unseeded algorithm match those of the reference
+    /// function `XXH3_64bits`.
+    Xxh3HashAlgorithm();
+
+    /// Create a `bslh::Xxh3HashAlgorithm` seeded with the specified `seed`.
+    explicit Xxh3HashAlgorithm(Uint64 seed);
+
+    /// Create a `bslh::Xxh3HashAlgorithm` seeded with the `k_SEED_LENGTH`
+    /// bytes of data starting at the specified `seed`, interpreted as a
+    /// 64-bit integer in the byte order of the host.  The behavior is
+    /// undefined unless `seed` points to at least `k_SEED_LENGTH` bytes of
+    /// initialized memory.
+    explicit Xxh3HashAlgorithm(const char *seed);
+
+    //! ~Xxh3HashAlgorithm() = default;
+        // Destroy this object.
+
+    // MANIPULATORS
+
+    /// Incorporate the specified `data`, of at least the specified
+    /// `numBytes`, into the internal state of the hashing algorithm.  Every
+    /// bit of data incorporated into the internal state of the algorithm
+    /// will contribute to the final hash produced by `computeHash()`.  The
+    /// same hash value will be produced regardless of whether a sequence of
+    /// bytes is passed in all at once or through multiple calls to this
+    /// member function.  Input where `numBytes` is 0 will have no effect on
+    /// the internal state of the algorithm.  The behaviour is undefined
+    /// unless `data` points to a valid memory location with at least
+    /// `numBytes` bytes of initialized memory or `numBytes` is zero.
+    void operator()(const void *data, size_t numBytes);
+
+    /// Return the finalized version of the hash that has been accumulated.
+    /// Note that, unlike some other `bslh` algorithms, this method does not
+    /// change the internal state of this object, so more data may be
+    /// incorporated afterwards, and a subsequent call returns the hash of
+    /// all of the data incorporated.  Also note that a value will be
+    /// returned, even if data has not been passed into `operator()`.
+    result_type computeHash();
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class Xxh3HashAlgorithm
+                          // -----------------------
+
+// CREATORS
+inline
+Xxh3HashAlgorithm::Xxh3HashAlgorithm()
+: d_seed(0)
+, d_totalLength(0)
+, d_bufferLength(0)
+, d_numStripesInBlock(0)
+{
+}
+
+inline
+Xxh3HashAlgorithm::Xxh3HashAlgorithm(Uint64 seed)
+: d_seed(seed)
+, d_totalLength(0)
+, d_bufferLength(0)
+, d_numStripesInBlock(0)
+{
+}
+
+inline
+Xxh3HashAlgorithm::Xxh3HashAlgorithm(const char *seed)
+: d_totalLength(0)
+, d_bufferLength(0)
+, d_numStripesInBlock(0)
+{
+    BSLS_ASSERT(seed);
+
+    memcpy(&d_seed, seed, sizeof d_seed);
+}
+
+// MANIPULATORS
+inline
+void Xxh3HashAlgorithm::operator()(const void *data, size_t numBytes)
+{
+    BSLS_ASSERT(0 != data || 0 == numBytes);
+
+    const unsigned char *input = static_cast<const unsigned char *>(data);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                               numBytes <= k_BUFFER_LENGTH - d_bufferLength)) {
+        if (numBytes) {
+            memcpy(d_buffer + d_bufferLength, input, numBytes);
+            d_bufferLength += numBytes;
+            d_totalLength  += numBytes;
+        }
+        return;                                                       // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    consumeLongInput(input, numBytes);
+}
+
+}  // close package namespace
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+namespace bslmf {
+template <>
+struct IsBitwiseMoveable<bslh::Xxh3HashAlgorithm> : bsl::true_type {};
+}  // close namespace bslmf
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
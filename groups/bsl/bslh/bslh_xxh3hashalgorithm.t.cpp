@@ -0,0 +1,899 @@
+// bslh_xxh3hashalgorithm.t.cpp                                       -*-C++-*-
+#include <bslh_xxh3hashalgorithm.h>
+
+#include <bslh_defaulthashalgorithm.h>
+#include <bslh_siphashalgorithm.h>
+#include <bslh_spookyhashalgorithm.h>
+#include <bslh_wyhashincrementalalgorithm.h>
+
+#include <bslmf_isbitwisemoveable.h>
+#include <bslmf_issame.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <stddef.h>  // for `size_t`
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a `bslh` hashing algorithm.  The basic test plan
+// is to compare the output of the function call operator with the expected
+// output generated by a known-good implementation of the hashing algorithm
+// (the reference implementation of XXH3, version 0.8).  Input lengths are
+// chosen to exercise every code path of the algorithm, and in particular the
+// boundaries between them (16, 128, 240, and 256 bytes, and multiples of the
+// 64-byte stripe and the 1024-byte block).  Since the expected values are
+// independent of the instruction set, building this test driver for each of
+// the supported targets (scalar, SSE2, and AVX2) tests each implementation of
+// the stripe kernels.  The component will also be tested for conformance to
+// the requirements on `bslh` hashing algorithms, outlined in the `bslh`
+// package level documentation.
+//-----------------------------------------------------------------------------
+// TYPEDEF
+// [ 4] typedef bsls::Types::Uint64 result_type;
+//
+// CONSTANTS
+// [ 5] enum { k_SEED_LENGTH = 8 };
+//
+// CREATORS
+// [ 2] Xxh3HashAlgorithm();
+// [ 2] explicit Xxh3HashAlgorithm(Uint64 seed);
+// [ 2] explicit Xxh3HashAlgorithm(const char *seed);
+// [ 2] ~Xxh3HashAlgorithm();
+//
+// MANIPULATORS
+// [ 3] void operator()(const void *data, size_t numBytes);
+// [ 3] result_type computeHash();
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] Trait IsBitwiseMoveable
+// [ 7] SUBDIVISION INVARIANCE
+// [ 8] USAGE EXAMPLE
+// [-1] THROUGHPUT BENCHMARK
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+        fflush(stdout);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  PRINTF FORMAT MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ZU BSLS_BSLTESTUTIL_FORMAT_ZU
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bslh::Xxh3HashAlgorithm Obj;
+typedef bsls::Types::Uint64     Uint64;
+
+const Uint64 k_SEED = 0x0123456789ABCDEFULL;  // seed of the `DATA` values
+
+/// Expected hash values of the first `d_length` bytes of the pattern
+/// produced by `fillPattern`, computed with the reference implementation of
+/// XXH3 (`XXH3_64bits_withSeed`) with seeds 0 and `k_SEED`.
+static const struct {
+    int    d_line;
+    int    d_length;
+    Uint64 d_hash;        // seed 0
+    Uint64 d_seededHash;  // seed `k_SEED`
+} DATA[] = {
+    //LINE LENGTH  HASH                   SEEDED HASH
+    //---- ------  ---------------------  ---------------------
+    { L_,     0, 0x2d06800538d394c2ULL, 0xcc1ca35a1b089c5cULL },
+    { L_,     1, 0x4c5cca45d0f4811fULL, 0x6dcb95d31de5966bULL },
+    { L_,     2, 0x29c60963cbfa4e6eULL, 0x567d5b9b9c8a52a7ULL },
+    { L_,     3, 0x6e3e2670e61106acULL, 0x911f06f10ddb4cd2ULL },
+    { L_,     4, 0x5c4c63133443d03fULL, 0xac127d990d6a1500ULL },
+    { L_,     5, 0x49f5eb3111280b63ULL, 0xf9672e909a41d02bULL },
+    { L_,     7, 0x46a5c724d51fe43fULL, 0x1f0bc6ac217aeac0ULL },
+    { L_,     8, 0xf9fd4dd0b04d78f5ULL, 0x9c622ca7116e701fULL },
+    { L_,     9, 0x7c20df9712c26edfULL, 0x6ccff5be3cc44ec4ULL },
+    { L_,    15, 0xb345a7b2698ba575ULL, 0xecfd996cab36987dULL },
+    { L_,    16, 0x86abf6baccea0858ULL, 0x81ebfa79d47aa6f2ULL },
+    { L_,    17, 0xb58bf5dc5022d071ULL, 0xfd2e9d73f8cca2d4ULL },
+    { L_,    31, 0x48442fcd5518b086ULL, 0x1a82e99247522c93ULL },
+    { L_,    32, 0xe3712ed84c04a66eULL, 0xddd67146dd8432e2ULL },
+    { L_,    33, 0xa4dee99b093e1f73ULL, 0xca1d53e8bea692caULL },
+    { L_,    63, 0x30ca01f63dcc223bULL, 0x3cfb1c582e60563aULL },
+    { L_,    64, 0x1291d2d4042330ddULL, 0xda20789f5c6994e7ULL },
+    { L_,    65, 0x97c6bf83217e5ec9ULL, 0x66e93cd61fb20c80ULL },
+    { L_,    96, 0x81296929fc063365ULL, 0x1fbfb41f68b916ddULL },
+    { L_,    97, 0xf145a45b658ab9ddULL, 0xa9dffe06acd5dcc5ULL },
+    { L_,   127, 0xed4cf62104020db5ULL, 0x8558dbaa6dafa576ULL },
+    { L_,   128, 0x10d17f72c0ccba41ULL, 0x357be72a285cd85eULL },
+    { L_,   129, 0x1648bdc3db49d1a2ULL, 0x1376e00df4c705f0ULL },
+    { L_,   200, 0xc0fbc0f4e181c826ULL, 0x92faada7659f6beeULL },
+    { L_,   239, 0xf0d154819adb16cdULL, 0x4f605ba42f2ce541ULL },
+    { L_,   240, 0xb6cfaf343fab81e6ULL, 0xd43296f42088f6c4ULL },
+    { L_,   241, 0x956cae592c67279eULL, 0x4cbae25b11e4b16bULL },
+    { L_,   255, 0x64a6073025eb7929ULL, 0xb79378b5568db7b8ULL },
+    { L_,   256, 0xb15e550733c5dfacULL, 0x1bcb49749382650bULL },
+    { L_,   257, 0x87b3bf2d941cf085ULL, 0xe964bd92135276cdULL },
+    { L_,   319, 0x122b14af7b6cf893ULL, 0x5e53040b6bb42fd8ULL },
+    { L_,   320, 0x28bc5aa275799ff9ULL, 0x9751ae2bb277ca59ULL },
+    { L_,   321, 0x48f9605f8fb787dcULL, 0x351a8ef9b43c23d9ULL },
+    { L_,   511, 0x5a17da924907228aULL, 0x3e03ab92283177cfULL },
+    { L_,   512, 0xa0e9790eb93990d7ULL, 0x4727a2d5cc065618ULL },
+    { L_,   513, 0x984828b9efd042cbULL, 0x463e0b0a8782ebb0ULL },
+    { L_,  1023, 0xa94ffcd2254368e4ULL, 0x2cd2d6ac700b2f0cULL },
+    { L_,  1024, 0x70bd377d9574f4bbULL, 0x9239f56d73396e44ULL },
+    { L_,  1025, 0x66c4487c41e127a7ULL, 0x651c371e7c277610ULL },
+    { L_,  1088, 0xf43dc77e28a9acbcULL, 0x93cbe2629a97794aULL },
+    { L_,  2048, 0x8b46caa67dab3a30ULL, 0x7f30b0f042f5211cULL },
+    { L_,  4096, 0x9ddd66c14af0daffULL, 0xf1d98cb07b72d15cULL },
+    { L_,  4097, 0x34eecaecd32195a4ULL, 0xadd8aeb5c3220b7eULL },
+};
+const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+enum { k_MAX_LENGTH = 4097 };  // longest length in `DATA`
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// Load into the specified `buffer` the specified `length` bytes of the
+/// deterministic pattern used to generate the expected values in `DATA`.
+void fillPattern(unsigned char *buffer, int length)
+{
+    for (int i = 0; i < length; ++i) {
+        buffer[i] = static_cast<unsigned char>(i * 131 + 7);
+    }
+}
+
+/// Return a pseudo-random value derived from the specified `state`, and
+/// update `state`.
+unsigned int nextRandom(Uint64 *state)
+{
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return static_cast<unsigned int>(*state >> 33);
+}
+
+                            // ====================
+                            // class UnseededHasher
+                            // ====================
+
+/// This class template adapts the specified `ALGORITHM`, which has only a
+/// default constructor, to the interface of a seeded algorithm, so that the
+/// benchmark can construct all algorithms uniformly.
+template <class ALGORITHM>
+class UnseededHasher : public ALGORITHM {
+
+  public:
+    // CREATORS
+
+    /// Create an object, ignoring the specified seed.
+    explicit UnseededHasher(const char *)
+    {
+    }
+};
+
+/// Return the number of nanoseconds taken, on average, to hash the specified
+/// `length` bytes at the specified `data` using a `HASHER` constructed with
+/// the specified `seed`, over the specified `iterations` independent
+/// hashes, and add the resulting hash values to the specified `sink`.
+template <class HASHER>
+double timeHashing(Uint64        *sink,
+                   const char    *seed,
+                   const void    *data,
+                   size_t         length,
+                   int            iterations)
+{
+    bsls::Stopwatch timer;
+    timer.start();
+
+    for (int i = 0; i < iterations; ++i) {
+        HASHER hasher(seed);
+        hasher(data, length);
+        *sink += hasher.computeHash();
+    }
+
+    timer.stop();
+
+    return timer.elapsedTime() * 1.0e9 / iterations;
+}
+
+//=============================================================================
+//                             USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended usage of this component.
+//
+///Example 1: Detecting Duplicate Payloads
+///- - - - - - - - - - - - - - - - - - - -
+// Suppose we maintain a cache of message payloads, each a few kilobytes long,
+// and want to detect cheaply whether an incoming payload has been seen
+// before.  Hashing such payloads is dominated by the processing of long
+// inputs, at which `bslh::Xxh3HashAlgorithm` excels.
+//
+// First, we define a function that computes the fingerprint of a payload,
+// which may arrive in several fragments:
+// ```
+    bsls::Types::Uint64 fingerprint(const char * const *fragments,
+                                    const size_t       *lengths,
+                                    int                 numFragments)
+    {
+        bslh::Xxh3HashAlgorithm hasher;
+
+        for (int i = 0; i < numFragments; ++i) {
+            hasher(fragments[i], lengths[i]);
+        }
+        return hasher.computeHash();
+    }
+// ```
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVeryVerbose;      // suppress warning
+    (void)veryVeryVeryVerbose;  // suppress warning
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    static unsigned char pattern[k_MAX_LENGTH];
+    fillPattern(pattern, k_MAX_LENGTH);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// Then, we create a payload, and a copy of it split into two fragments:
+// ```
+        char payload[2048];
+        for (int i = 0; i < 2048; ++i) {
+            payload[i] = static_cast<char>('a' + i % 26);
+        }
+
+        const char   *whole[]        = { payload };
+        const size_t  wholeLength[]  = { sizeof payload };
+        const char   *pieces[]       = { payload, payload + 1000 };
+        const size_t  pieceLengths[] = { 1000, sizeof payload - 1000 };
+// ```
+// Next, we observe that, because the algorithm is subdivision-invariant, the
+// fingerprint of the payload does not depend on how it was fragmented:
+// ```
+        ASSERT(fingerprint(whole,  wholeLength,  1) ==
+               fingerprint(pieces, pieceLengths, 2));
+// ```
+// Finally, we observe that changing a single byte of the payload changes its
+// fingerprint:
+// ```
+        const bsls::Types::Uint64 before = fingerprint(whole, wholeLength, 1);
+
+        payload[1500] = '!';
+
+        ASSERT(before != fingerprint(whole, wholeLength, 1));
+// ```
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // SUBDIVISION INVARIANCE
+        //   Input longer than the internal buffer is consumed in stripes as it
+        //   arrives, and the final (partial) stripe is recovered from the
+        //   buffer by `computeHash`; the result must not depend on how the
+        //   input was divided between calls to `operator()`.
+        //
+        // Concerns:
+        // 1. The hash of a sequence of bytes does not depend on how it is
+        //    divided into segments, including segments that straddle, fill,
+        //    or exactly empty the internal buffer, and segments longer than
+        //    the buffer.
+        //
+        // 2. `computeHash` does not change the state of the object, so that
+        //    data can be incorporated after it is called.
+        //
+        // Plan:
+        // 1. For each length in `DATA`, and for both seeds, hash the pattern
+        //    in many pseudo-randomly sized segments, with segment sizes drawn
+        //    from ranges around the stripe and buffer sizes, and verify the
+        //    result against the expected value.  (C-1)
+        //
+        // 2. For each length in `DATA`, hash the pattern in two segments,
+        //    calling `computeHash` after the first, and verify that the
+        //    intermediate and final results match the expected values for the
+        //    corresponding prefix lengths.  (C-2)
+        //
+        // Testing:
+        //   SUBDIVISION INVARIANCE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSUBDIVISION INVARIANCE"
+                            "\n======================\n");
+
+        if (verbose) printf("Hash in pseudo-randomly sized segments.\n");
+        {
+            static const int MAX_SEGMENTS[] = { 1, 4, 16, 64, 300, 1100 };
+            const int        NUM_MAX_SEGMENTS = sizeof  MAX_SEGMENTS
+                                              / sizeof *MAX_SEGMENTS;
+
+            Uint64 state = 0;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE   = DATA[ti].d_line;
+                const int LENGTH = DATA[ti].d_length;
+
+                for (int mi = 0; mi < NUM_MAX_SEGMENTS; ++mi) {
+                    const int MAX_SEGMENT = MAX_SEGMENTS[mi];
+
+                    for (int trial = 0; trial < 8; ++trial) {
+                        Obj mX;
+                        Obj mY(k_SEED);
+
+                        int offset = 0;
+                        while (offset < LENGTH) {
+                            int segment = static_cast<int>(
+                                    nextRandom(&state) % (MAX_SEGMENT + 1));
+                            if (segment > LENGTH - offset) {
+                                segment = LENGTH - offset;
+                            }
+                            mX(pattern + offset, segment);
+                            mY(pattern + offset, segment);
+                            offset += segment;
+                        }
+
+                        ASSERTV(LINE, MAX_SEGMENT, trial,
+                                DATA[ti].d_hash == mX.computeHash());
+                        ASSERTV(LINE, MAX_SEGMENT, trial,
+                                DATA[ti].d_seededHash == mY.computeHash());
+                    }
+                }
+            }
+        }
+
+        if (verbose) printf("Call `computeHash` between segments.\n");
+        {
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE   = DATA[ti].d_line;
+                const int LENGTH = DATA[ti].d_length;
+
+                for (int tj = 0; tj <= ti; ++tj) {
+                    const int PREFIX = DATA[tj].d_length;
+
+                    Obj mX(k_SEED);
+
+                    mX(pattern, PREFIX);
+                    ASSERTV(LINE, PREFIX,
+                            DATA[tj].d_seededHash == mX.computeHash());
+
+                    mX(pattern + PREFIX, LENGTH - PREFIX);
+                    ASSERTV(LINE, PREFIX,
+                            DATA[ti].d_seededHash == mX.computeHash());
+                    ASSERTV(LINE, PREFIX,
+                            DATA[ti].d_seededHash == mX.computeHash());
+                }
+            }
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING BDE TYPE TRAITS
+        //   The class is bitwise movable and should have a trait that
+        //   indicates that.
+        //
+        // Concerns:
+        // 1. The class is marked as `IsBitwiseMoveable`.
+        //
+        // Plan:
+        // 1. ASSERT the presence of the trait using the
+        //    `bslmf::IsBitwiseMoveable` metafunction.  (C-1)
+        //
+        // Testing:
+        //   Trait IsBitwiseMoveable
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING BDE TYPE TRAITS"
+                            "\n=======================\n");
+
+        ASSERT(bslmf::IsBitwiseMoveable<Obj>::value);
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING `k_SEED_LENGTH`
+        //   The class is a seeded algorithm and should expose a
+        //   `k_SEED_LENGTH` enum.
+        //
+        // Concerns:
+        // 1. `k_SEED_LENGTH` is publicly accessible.
+        //
+        // 2. `k_SEED_LENGTH` is set to 8.
+        //
+        // Plan:
+        // 1. Access `k_SEED_LENGTH` and ASSERT it is equal to the expected
+        //    value.  (C-1,2)
+        //
+        // Testing:
+        //   enum { k_SEED_LENGTH = 8 };
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING `k_SEED_LENGTH`"
+                            "\n=======================\n");
+
+        ASSERT(8 == Obj::k_SEED_LENGTH);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING `result_type` TYPEDEF
+        //   Verify that the class offers the result_type typedef that needs to
+        //   be exposed by all `bslh` hashing algorithms
+        //
+        // Concerns:
+        // 1. The typedef `result_type` is publicly accessible and an alias for
+        //    `bsls::Types::Uint64`.
+        //
+        // 2. `computeHash()` returns `result_type`
+        //
+        // Plan:
+        // 1. ASSERT the typedef is accessible and is the correct type using
+        //    `bslmf::IsSame`.  (C-1)
+        //
+        // 2. Declare the expected signature of `computeHash()` and then assign
+        //    to it.  If it compiles, the test passes.  (C-2)
+        //
+        // Testing:
+        //   typedef bsls::Types::Uint64 result_type;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING `result_type` TYPEDEF"
+                            "\n=============================\n");
+
+        ASSERT((bslmf::IsSame<bsls::Types::Uint64, Obj::result_type>::value));
+
+        Obj::result_type (Obj::*expectedSignature) ();
+
+        (void)(expectedSignature = &Obj::computeHash);
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING `operator()` AND `computeHash()`
+        //   Verify that the function call operator and `computeHash` together
+        //   compute the XXH3 hash of the incorporated bytes.
+        //
+        // Concerns:
+        // 1. The hash of a sequence of bytes, passed in a single call to
+        //    `operator()`, matches the value produced by the reference
+        //    implementation, for every code path of the algorithm, both with
+        //    and without a seed.
+        //
+        // 2. The hash does not depend on the alignment of the input.
+        //
+        // 3. Byte sequences passed to `operator()` with a length of 0 do not
+        //    contribute to the hash.
+        //
+        // 4. Passing the bytes one at a time produces the same hash.
+        //
+        // 5. `operator()` does a BSLS_ASSERT for null pointers and non-zero
+        //    length, and not for null pointers and zero length.
+        //
+        // Plan:
+        // 1. For each length in the table `DATA`, hash that many bytes of a
+        //    deterministic pattern, and compare the result to the value
+        //    computed by the reference implementation.  (C-1)
+        //
+        // 2. Repeat P-1 with the pattern copied to each offset within an
+        //    8-byte word.  (C-2)
+        //
+        // 3. Repeat P-1, interleaving calls to `operator()` with a length of
+        //    0.  (C-3)
+        //
+        // 4. Repeat P-1, passing one byte per call.  (C-4)
+        //
+        // 5. Call `operator()` with a null pointer.  (C-5)
+        //
+        // Testing:
+        //   void operator()(const void *data, size_t numBytes);
+        //   result_type computeHash();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING `operator()` AND `computeHash()`"
+                            "\n========================================\n");
+
+        if (verbose) printf("Compare to the reference implementation.\n");
+        {
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int    LINE   = DATA[ti].d_line;
+                const int    LENGTH = DATA[ti].d_length;
+                const Uint64 EXP    = DATA[ti].d_hash;
+                const Uint64 EXP_S  = DATA[ti].d_seededHash;
+
+                Obj mX;
+                mX(pattern, LENGTH);
+                const Uint64 hash = mX.computeHash();
+
+                Obj mY(k_SEED);
+                mY(pattern, LENGTH);
+                const Uint64 seededHash = mY.computeHash();
+
+                if (veryVerbose) {
+                    T_ P_(LINE) P_(LENGTH) P_(hash) P(seededHash)
+                }
+
+                ASSERTV(LINE, LENGTH, EXP,   hash,       EXP   == hash);
+                ASSERTV(LINE, LENGTH, EXP_S, seededHash, EXP_S == seededHash);
+            }
+        }
+
+        if (verbose) printf("Hash misaligned input.\n");
+        {
+            static unsigned char buffer[k_MAX_LENGTH + 8];
+
+            for (int offset = 1; offset < 8; ++offset) {
+                fillPattern(buffer + offset, k_MAX_LENGTH);
+
+                for (int ti = 0; ti < NUM_DATA; ++ti) {
+                    const int LINE   = DATA[ti].d_line;
+                    const int LENGTH = DATA[ti].d_length;
+
+                    Obj mX(k_SEED);
+                    mX(buffer + offset, LENGTH);
+
+                    ASSERTV(LINE, offset,
+                            DATA[ti].d_seededHash == mX.computeHash());
+                }
+            }
+        }
+
+        if (verbose) printf("Interleave zero-length input.\n");
+        {
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE   = DATA[ti].d_line;
+                const int LENGTH = DATA[ti].d_length;
+                const int HALF   = LENGTH / 2;
+
+                Obj mX;
+                mX(pattern, 0);
+                mX(pattern, HALF);
+                mX(0, 0);
+                mX(pattern + HALF, LENGTH - HALF);
+                mX(pattern + LENGTH, 0);
+
+                ASSERTV(LINE, DATA[ti].d_hash == mX.computeHash());
+            }
+        }
+
+        if (verbose) printf("Hash one byte at a time.\n");
+        {
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE   = DATA[ti].d_line;
+                const int LENGTH = DATA[ti].d_length;
+
+                Obj mX(k_SEED);
+                for (int i = 0; i < LENGTH; ++i) {
+                    mX(pattern + i, 1);
+                }
+
+                ASSERTV(LINE, DATA[ti].d_seededHash == mX.computeHash());
+            }
+        }
+
+        if (verbose) printf("Call `operator()` with null pointers.\n");
+        {
+            const char data[5] = {'a', 'b', 'c', 'd', 'e'};
+
+            bsls::AssertTestHandlerGuard guard;
+
+            ASSERT_FAIL(Obj().operator()(   0, 5));
+            ASSERT_PASS(Obj().operator()(   0, 0));
+            ASSERT_PASS(Obj().operator()(data, 5));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CREATORS
+        //   Ensure that the constructors are publicly callable and produce
+        //   objects having the expected seed.
+        //
+        // Concerns:
+        // 1. Objects can be created using the default constructor, and have a
+        //    seed of 0.
+        //
+        // 2. Objects can be created from a 64-bit seed.
+        //
+        // 3. Objects can be created from `k_SEED_LENGTH` bytes of seed, which
+        //    are interpreted in the byte order of the host, and the seed need
+        //    not be aligned.
+        //
+        // 4. Objects can be destroyed.
+        //
+        // 5. The `const char *` constructor does a BSLS_ASSERT for null
+        //    pointers.
+        //
+        // Plan:
+        // 1. Create objects using each constructor, hash the same input with
+        //    each, and compare the results to each other and to the expected
+        //    values, and allow the objects to leave scope.  (C-1..4)
+        //
+        // 2. Call the `const char *` constructor with a null pointer.  (C-5)
+        //
+        // Testing:
+        //   Xxh3HashAlgorithm();
+        //   explicit Xxh3HashAlgorithm(Uint64 seed);
+        //   explicit Xxh3HashAlgorithm(const char *seed);
+        //   ~Xxh3HashAlgorithm();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTESTING CREATORS"
+                            "\n================\n");
+
+        if (verbose) printf("Compare the constructors.\n");
+        {
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE   = DATA[ti].d_line;
+                const int LENGTH = DATA[ti].d_length;
+
+                char seedBuffer[Obj::k_SEED_LENGTH + 1];
+                memcpy(seedBuffer + 1, &k_SEED, sizeof k_SEED);
+
+                Obj mW;
+                Obj mX(static_cast<Uint64>(0));
+                Obj mY(k_SEED);
+                Obj mZ(seedBuffer + 1);
+
+                mW(pattern, LENGTH);
+                mX(pattern, LENGTH);
+                mY(pattern, LENGTH);
+                mZ(pattern, LENGTH);
+
+                ASSERTV(LINE, DATA[ti].d_hash       == mW.computeHash());
+                ASSERTV(LINE, DATA[ti].d_hash       == mX.computeHash());
+                ASSERTV(LINE, DATA[ti].d_seededHash == mY.computeHash());
+                ASSERTV(LINE, DATA[ti].d_seededHash == mZ.computeHash());
+            }
+        }
+
+        if (verbose) printf("Call the `const char *` constructor with a null"
+                            " pointer.\n");
+        {
+            const char seed[Obj::k_SEED_LENGTH] = { 0 };
+
+            bsls::AssertTestHandlerGuard guard;
+
+            ASSERT_FAIL(Obj dummy(static_cast<const char *>(0)));
+            ASSERT_PASS(Obj dummy(seed));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Verify different hashes are produced for different c-strings,
+        //    and the same hashes for the same c-strings.  (C-1)
+        //
+        // 2. Verify that the seed affects the hash.  (C-1)
+        //
+        // 3. Verify the hash of a short string against the value produced by
+        //    the reference implementation.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        const char *str1 = "Hello World";
+        const char *str2 = "Goodbye World";
+
+        {
+            Obj mX;  Obj mY;  Obj mZ;
+
+            mX(str1, strlen(str1));
+            mY(str2, strlen(str2));
+            mZ(str1, strlen(str1));
+
+            const Uint64 hashX = mX.computeHash();
+
+            ASSERT(hashX != mY.computeHash());
+            ASSERT(hashX == mZ.computeHash());
+            ASSERTV(hashX, 0xE34615AADE2E6333ULL == hashX);
+
+            Obj mS(k_SEED);
+            mS(str1, strlen(str1));
+            ASSERT(hashX != mS.computeHash());
+        }
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // THROUGHPUT BENCHMARK
+        //
+        // Concerns:
+        // 1. Compare the speed of `bslh::Xxh3HashAlgorithm` to that of the
+        //    other `bslh` algorithms, across a range of input lengths.
+        //
+        // Plan:
+        // 1. For each algorithm and each input length, repeatedly construct
+        //    the algorithm, hash the input in a single call, and compute the
+        //    hash, and report the mean time per hash and the throughput.
+        //    The optional second argument, if positive, scales the number of
+        //    iterations.
+        //
+        // Testing:
+        //   THROUGHPUT BENCHMARK
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTHROUGHPUT BENCHMARK"
+                            "\n====================\n");
+
+        const int scale = argc > 2 && atoi(argv[2]) > 0 ? atoi(argv[2]) : 1;
+
+        static const size_t LENGTHS[] = { 8, 16, 32, 64, 128, 256, 1024,
+                                          4096, 65536 };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        static char data[65536];
+        for (size_t i = 0; i < sizeof data; ++i) {
+            data[i] = static_cast<char>(i * 131 + 7);
+        }
+
+        const char seed[16] = { 1, 2, 3, 4, 5, 6, 7, 8,
+                                9, 10, 11, 12, 13, 14, 15, 16 };
+
+        Uint64 sink = 0;
+
+        printf("%8s %10s %10s %10s %10s %10s   (ns/hash)\n",
+               "length", "Default", "SipHash", "Spooky", "WyHash", "XXH3");
+
+        for (int li = 0; li < NUM_LENGTHS; ++li) {
+            const size_t LENGTH     = LENGTHS[li];
+            const int    ITERATIONS = static_cast<int>(
+                              scale * (1000 * 1000 + (64 << 20) / LENGTH) / 8);
+
+            typedef UnseededHasher<bslh::DefaultHashAlgorithm> Default;
+
+            const double defaultNs = timeHashing<Default>(
+                                        &sink, seed, data, LENGTH, ITERATIONS);
+            const double sipNs     = timeHashing<bslh::SipHashAlgorithm>(
+                                        &sink, seed, data, LENGTH, ITERATIONS);
+            const double spookyNs  = timeHashing<bslh::SpookyHashAlgorithm>(
+                                        &sink, seed, data, LENGTH, ITERATIONS);
+            const double wyNs      = timeHashing<
+                                             bslh::WyHashIncrementalAlgorithm>(
+                                        &sink, seed, data, LENGTH, ITERATIONS);
+            const double xxh3Ns    = timeHashing<bslh::Xxh3HashAlgorithm>(
+                                        &sink, seed, data, LENGTH, ITERATIONS);
+
+            printf("%8d %10.1f %10.1f %10.1f %10.1f %10.1f\n",
+                   static_cast<int>(LENGTH),
+                   defaultNs,
+                   sipNs,
+                   spookyNs,
+                   wyNs,
+                   xxh3Ns);
+            printf("%8s %10.2f %10.2f %10.2f %10.2f %10.2f   (GB/s)\n",
+                   "",
+                   LENGTH / defaultNs,
+                   LENGTH / sipNs,
+                   LENGTH / spookyNs,
+                   LENGTH / wyNs,
+                   LENGTH / xxh3Ns);
+        }
+
+        if (veryVerbose) {
+            P(sink);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
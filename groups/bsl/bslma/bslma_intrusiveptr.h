@@ -0,0 +1,661 @@
+// bslma_intrusiveptr.h                                               -*-C++-*-
+#ifndef INCLUDED_BSLMA_INTRUSIVEPTR
+#define INCLUDED_BSLMA_INTRUSIVEPTR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id$ $CSID$")
+
+//@PURPOSE: Provide shared ownership of objects that embed their own count.
+//
+//@CLASSES:
+//  bslma::IntrusivePtr: single-pointer handle to a self-counting object
+//  bslma::EnableIntrusivePtr: base making a type its own `SharedPtrRep`
+//
+//@SEE_ALSO: bslma_sharedptrrep, bslstl_sharedptr
+//
+//@DESCRIPTION: This component provides a class template,
+// `bslma::IntrusivePtr`, that holds a shared reference to an object whose
+// type publicly derives from `bslma::SharedPtrRep`, and a CRTP base class
+// template, `bslma::EnableIntrusivePtr`, that makes a derived type its own
+// shared pointer representation.  An object of such a type carries its own
+// (atomic) reference counts, so sharing it requires no allocation beyond the
+// object itself, and an `IntrusivePtr` to it is the size of a single raw
+// pointer.  This is particularly useful for objects that are recycled from a
+// pool, where the per-object representation that `bsl::shared_ptr` would
+// otherwise allocate (or require to be embedded in a separate wrapper) would
+// dominate the cost of acquiring the object.
+//
+// Because the reference counts are those of `bslma::SharedPtrRep`, the
+// mechanisms are fully interoperable with `bsl::shared_ptr` and
+// `bsl::weak_ptr`:
+//
+// * A `bsl::shared_ptr` can be constructed from any such object using the
+//   `shared_ptr(element_type *ptr, bslma::SharedPtrRep *rep)` constructor,
+//   passing the object as both arguments.  The shared pointer *adopts* one
+//   reference (it does not increment the count), so the reference should be
+//   obtained from `IntrusivePtr::release`, or `acquireRef` must be called
+//   first.
+//
+// * An `IntrusivePtr` can be constructed from an object shared by a
+//   `bsl::shared_ptr` by calling `acquireRef` on the object and then passing
+//   it to the (adopting) `IntrusivePtr` constructor; the derived class
+//   method `EnableIntrusivePtr::intrusivePtrFromThis` does both.
+//
+// All of the `bsl::shared_ptr` and `bsl::weak_ptr` objects and all of the
+// `IntrusivePtr` objects referring to the same object share a single count,
+// and the object is disposed of when the last of them is released.
+//
+///Disposing of the Object
+///-----------------------
+// When the last shared reference is released, `disposeObject` is invoked,
+// followed by `disposeRep` once no weak references remain.  A type deriving
+// from `bslma::EnableIntrusivePtr` must implement both of these (pure
+// virtual) functions.  For an object that is destroyed outright, it is
+// typical for `disposeObject` to do nothing and for `disposeRep` to destroy
+// the object and return its footprint to the allocator that supplied it.  For
+// an object recycled from a pool, `disposeRep` returns the object to the
+// pool, and the pool calls `resetCountsRaw(1, 0)` on the object before
+// handing it out again.
+//
+///Thread Safety
+///-------------
+// Distinct `IntrusivePtr` objects referring to the same object may be copied,
+// assigned, and destroyed concurrently, exactly as for distinct
+// `bsl::shared_ptr` objects.  A single `IntrusivePtr` object is not safe to
+// modify concurrently.  No guarantees are made with respect to the referenced
+// object other than those of its type.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing Pooled Objects Without Allocating
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we process a high rate of messages, each of which is read into
+// a record obtained from a pool and then handed to a number of consumers that
+// share it, and that we want the record to return to the pool once the last
+// consumer is done with it.
+//
+// First, we define the record type, which derives from
+// `bslma::EnableIntrusivePtr` and returns itself to its pool in `disposeRep`:
+// ```
+// class MyRecordPool;
+//
+// class MyRecord : public bslma::EnableIntrusivePtr<MyRecord> {
+//     // DATA
+//     MyRecordPool *d_pool_p;    // pool to which this record is returned
+//     MyRecord     *d_next_p;    // next record on the pool's free list
+//     int           d_payload;   // message payload
+//
+//     // FRIENDS
+//     friend class MyRecordPool;
+//
+//   private:
+//     // PRIVATE MANIPULATORS
+//     void disposeObject() BSLS_KEYWORD_OVERRIDE;
+//     void disposeRep() BSLS_KEYWORD_OVERRIDE;
+//
+//     // PRIVATE CREATORS
+//     explicit MyRecord(MyRecordPool *pool)
+//     : d_pool_p(pool)
+//     , d_next_p(0)
+//     , d_payload(0)
+//     {
+//     }
+//
+//     ~MyRecord() BSLS_KEYWORD_OVERRIDE
+//     {
+//     }
+//
+//   public:
+//     // MANIPULATORS
+//     void setPayload(int value) { d_payload = value; }
+//
+//     // ACCESSORS
+//     int payload() const { return d_payload; }
+// };
+// ```
+// Then, we define a (single-threaded, for brevity) pool that recycles
+// records, resetting the reference counts of a record before handing it out
+// again:
+// ```
+// class MyRecordPool {
+//     // DATA
+//     MyRecord         *d_freeList_p;   // records available for reuse
+//     int               d_numCreated;   // number of records created
+//     bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+//
+//   public:
+//     // CREATORS
+//     explicit MyRecordPool(bslma::Allocator *basicAllocator = 0)
+//     : d_freeList_p(0)
+//     , d_numCreated(0)
+//     , d_allocator_p(bslma::Default::allocator(basicAllocator))
+//     {
+//     }
+//
+//     ~MyRecordPool()
+//     {
+//         while (d_freeList_p) {
+//             MyRecord *record = d_freeList_p;
+//             d_freeList_p     = record->d_next_p;
+//
+//             record->~MyRecord();
+//             d_allocator_p->deallocate(record);
+//             --d_numCreated;
+//         }
+//         assert(0 == d_numCreated);
+//     }
+//
+//     // MANIPULATORS
+//     bslma::IntrusivePtr<MyRecord> getRecord()
+//     {
+//         MyRecord *record = d_freeList_p;
+//         if (record) {
+//             d_freeList_p = record->d_next_p;
+//             record->resetCountsRaw(1, 0);
+//         }
+//         else {
+//             record = new (*d_allocator_p) MyRecord(this);
+//             ++d_numCreated;
+//         }
+//         return bslma::IntrusivePtr<MyRecord>(record);
+//     }
+//
+//     void returnRecord(MyRecord *record)
+//     {
+//         record->d_next_p = d_freeList_p;
+//         d_freeList_p     = record;
+//     }
+//
+//     // ACCESSORS
+//     int numCreated() const { return d_numCreated; }
+// };
+//
+// void MyRecord::disposeObject()
+// {
+//     d_payload = 0;
+// }
+//
+// void MyRecord::disposeRep()
+// {
+//     d_pool_p->returnRecord(this);
+// }
+// ```
+// Now, we obtain a record, fill it in, and share it among several holders;
+// each copy merely increments the count embedded in the record, and no
+// memory is allocated:
+// ```
+// bslma::TestAllocator ta;
+// MyRecordPool         pool(&ta);
+// {
+//     bslma::IntrusivePtr<MyRecord> record = pool.getRecord();
+//     record->setPayload(42);
+//
+//     bsls::Types::Int64 numAllocations = ta.numAllocations();
+//
+//     bslma::IntrusivePtr<MyRecord> consumer1(record);
+//     bslma::IntrusivePtr<MyRecord> consumer2(record);
+//     assert(3  == record.numReferences());
+//     assert(42 == consumer2->payload());
+//
+//     bslma::IntrusivePtr<MyRecord> consumer3 =
+//                                          record->intrusivePtrFromThis();
+//     assert(4 == record.numReferences());
+//     assert(numAllocations == ta.numAllocations());
+// }
+// ```
+// Finally, we observe that once all of the holders have gone away, the record
+// has been returned to the pool, and is handed out again by the next request:
+// ```
+// bslma::IntrusivePtr<MyRecord> record = pool.getRecord();
+// assert(1 == pool.numCreated());
+// assert(1 == record.numReferences());
+// assert(0 == record->payload());
+// ```
+// Note that, had any of the consumers required a `bsl::shared_ptr`, one of the
+// references could have been handed over without allocation as
+// `MyRecord *raw = consumer3.release(); bsl::shared_ptr<MyRecord> sp(raw,
+// raw);`, and the record would still have been returned to the pool when the
+// last intrusive or shared pointer went away.
+
+#include <bslscm_version.h>
+
+#include <bslma_sharedptrrep.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_keyword.h>
+#include <bsls_platform.h>
+#include <bsls_unspecifiedbool.h>
+
+#include <typeinfo>
+
+namespace BloombergLP {
+namespace bslma {
+
+                            // ==================
+                            // class IntrusivePtr
+                            // ==================
+
+/// This class template holds a shared reference to an object of the
+/// (template parameter) `TYPE`, which must publicly and unambiguously derive
+/// from `bslma::SharedPtrRep`, using the reference counts embedded in that
+/// object.  The object is disposed of (via `SharedPtrRep::releaseRef`) when
+/// the last reference to it is released.
+template <class TYPE>
+class IntrusivePtr {
+
+    // PRIVATE TYPES
+    typedef bslmf::MovableRefUtil MoveUtil;
+
+    // DATA
+    TYPE *d_ptr_p;  // referenced object (held, shared), or 0 if empty
+
+  public:
+    // TYPES
+
+    /// `BoolType` is an alias for an unspecified type that is implicitly
+    /// convertible to `bool`, but will not promote to `int`.
+    typedef typename bsls::UnspecifiedBool<IntrusivePtr>::BoolType BoolType;
+
+    /// `element_type` is an alias for the (template parameter) `TYPE`.
+    typedef TYPE element_type;
+
+    // CREATORS
+
+    /// Create an empty intrusive pointer.
+    IntrusivePtr() BSLS_KEYWORD_NOEXCEPT;
+
+    /// Create an intrusive pointer that *adopts* one shared reference to the
+    /// specified `object`, i.e., without incrementing its reference count.
+    /// If `object` is 0, create an empty intrusive pointer.  The behavior is
+    /// undefined unless `object` is 0, or the caller owns one shared
+    /// reference to `object` (e.g., `object` was just created, or
+    /// `object->acquireRef()` was called on behalf of this pointer).
+    explicit IntrusivePtr(TYPE *object);
+
+    /// Create an intrusive pointer referring to the same object as the
+    /// specified `original`, and acquire an additional shared reference to
+    /// that object if `original` is not empty.
+    IntrusivePtr(const IntrusivePtr& original) BSLS_KEYWORD_NOEXCEPT;
+
+    /// Create an intrusive pointer that takes over the reference held by the
+    /// specified `original`, leaving `original` empty.
+    IntrusivePtr(bslmf::MovableRef<IntrusivePtr> original)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+
+    /// Release the reference held by this object, if any.
+    ~IntrusivePtr();
+
+    // MANIPULATORS
+
+    /// Make this object refer to the same object as the specified `rhs`,
+    /// acquiring a reference to the new object (if any) and releasing the
+    /// reference to the previous one (if any), and return a reference
+    /// providing modifiable access to this object.
+    IntrusivePtr& operator=(const IntrusivePtr& rhs) BSLS_KEYWORD_NOEXCEPT;
+
+    /// Release the reference to the object referred to by this pointer (if
+    /// any) and take over the reference held by the specified `rhs`, leaving
+    /// `rhs` empty.  Return a reference providing modifiable access to this
+    /// object.
+    IntrusivePtr& operator=(bslmf::MovableRef<IntrusivePtr> rhs)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+
+    /// Release the reference held by this object, if any, and make this
+    /// object empty.
+    void reset() BSLS_KEYWORD_NOEXCEPT;
+
+    /// Release the reference held by this object, if any, and *adopt* one
+    /// shared reference to the specified `object` (see the adopting
+    /// constructor).
+    void reset(TYPE *object);
+
+    /// Return the address of the referenced object (or 0 if this object is
+    /// empty) and make this object empty *without* releasing the reference,
+    /// which is transferred to the caller.
+    TYPE *release() BSLS_KEYWORD_NOEXCEPT;
+
+    /// Efficiently exchange the states of this object and the specified
+    /// `other` object.
+    void swap(IntrusivePtr& other) BSLS_KEYWORD_NOEXCEPT;
+
+    // ACCESSORS
+
+    /// Return a value of an "unspecified bool" type that evaluates to
+    /// `false` if this object is empty, and `true` otherwise.
+    operator BoolType() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return a reference to the referenced object.  The behavior is
+    /// undefined if this object is empty.
+    TYPE& operator*() const;
+
+    /// Return the address of the referenced object.  The behavior is
+    /// undefined if this object is empty.
+    TYPE *operator->() const;
+
+    /// Return the address of the referenced object, or 0 if this object is
+    /// empty.
+    TYPE *get() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return a "snapshot" of the number of shared references (held by
+    /// intrusive and shared pointers alike) to the referenced object, or 0
+    /// if this object is empty.
+    int numReferences() const BSLS_KEYWORD_NOEXCEPT;
+};
+
+// FREE OPERATORS
+
+/// Return `true` if the specified `lhs` and `rhs` intrusive pointers refer to
+/// the same object (or are both empty), and `false` otherwise.
+template <class LHS_TYPE, class RHS_TYPE>
+bool operator==(const IntrusivePtr<LHS_TYPE>& lhs,
+                const IntrusivePtr<RHS_TYPE>& rhs) BSLS_KEYWORD_NOEXCEPT;
+
+/// Return `true` if the specified `lhs` and `rhs` intrusive pointers do not
+/// refer to the same object, and `false` otherwise.
+template <class LHS_TYPE, class RHS_TYPE>
+bool operator!=(const IntrusivePtr<LHS_TYPE>& lhs,
+                const IntrusivePtr<RHS_TYPE>& rhs) BSLS_KEYWORD_NOEXCEPT;
+
+// FREE FUNCTIONS
+
+/// Efficiently exchange the states of the specified `a` and `b` objects.
+template <class TYPE>
+void swap(IntrusivePtr<TYPE>& a, IntrusivePtr<TYPE>& b) BSLS_KEYWORD_NOEXCEPT;
+
+                         // ========================
+                         // class EnableIntrusivePtr
+                         // ========================
+
+/// This CRTP base class template makes the derived (template parameter)
+/// `TYPE` its own `SharedPtrRep`, so that objects of `TYPE` can be shared
+/// by `IntrusivePtr` and `bsl::shared_ptr` objects without allocating a
+/// separate representation.  `TYPE` must publicly derive from
+/// `EnableIntrusivePtr<TYPE>`, and must implement the `disposeObject` and
+/// `disposeRep` virtual functions inherited from `SharedPtrRep` (see
+/// {Disposing of the Object}).  A newly constructed object has one shared
+/// reference, which is owned by its creator.
+template <class TYPE>
+class EnableIntrusivePtr : public SharedPtrRep {
+
+  private:
+    // NOT IMPLEMENTED
+    EnableIntrusivePtr(const EnableIntrusivePtr&);             // = delete
+    EnableIntrusivePtr& operator=(const EnableIntrusivePtr&);  // = delete
+
+  protected:
+    // PROTECTED CREATORS
+
+    /// Create a base object having one shared reference and no weak
+    /// references.
+    EnableIntrusivePtr();
+
+    /// Destroy this object.
+    ~EnableIntrusivePtr() BSLS_KEYWORD_OVERRIDE;
+
+  public:
+    // MANIPULATORS
+
+    /// Return 0.  Note that an object of `TYPE` disposes of itself, and so
+    /// has no deleter.
+    void *getDeleter(const std::type_info& type) BSLS_KEYWORD_OVERRIDE;
+
+    /// Acquire an additional shared reference to this object and return an
+    /// intrusive pointer that holds it.  The behavior is undefined unless
+    /// `0 < numReferences()`.
+    IntrusivePtr<TYPE> intrusivePtrFromThis();
+
+    // ACCESSORS
+
+    /// Return the address of the most-derived `TYPE` object.
+    void *originalPtr() const BSLS_KEYWORD_OVERRIDE;
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                            // ------------------
+                            // class IntrusivePtr
+                            // ------------------
+
+// CREATORS
+template <class TYPE>
+inline
+IntrusivePtr<TYPE>::IntrusivePtr() BSLS_KEYWORD_NOEXCEPT
+: d_ptr_p(0)
+{
+}
+
+template <class TYPE>
+inline
+IntrusivePtr<TYPE>::IntrusivePtr(TYPE *object)
+: d_ptr_p(object)
+{
+    BSLS_ASSERT_SAFE(!object || 0 < object->numReferences());
+}
+
+template <class TYPE>
+inline
+IntrusivePtr<TYPE>::IntrusivePtr(const IntrusivePtr& original)
+                                                          BSLS_KEYWORD_NOEXCEPT
+: d_ptr_p(original.d_ptr_p)
+{
+    if (d_ptr_p) {
+        d_ptr_p->acquireRef();
+    }
+}
+
+template <class TYPE>
+inline
+IntrusivePtr<TYPE>::IntrusivePtr(bslmf::MovableRef<IntrusivePtr> original)
+                                                          BSLS_KEYWORD_NOEXCEPT
+: d_ptr_p(MoveUtil::access(original).d_ptr_p)
+{
+    MoveUtil::access(original).d_ptr_p = 0;
+}
+
+template <class TYPE>
+inline
+IntrusivePtr<TYPE>::~IntrusivePtr()
+{
+    if (d_ptr_p) {
+        d_ptr_p->releaseRef();
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+IntrusivePtr<TYPE>&
+IntrusivePtr<TYPE>::operator=(const IntrusivePtr& rhs) BSLS_KEYWORD_NOEXCEPT
+{
+    // Acquire the new reference before releasing the old one, so that
+    // self-assignment (or assignment from a pointer whose only reference is
+    // held by this object) is safe.
+
+    IntrusivePtr(rhs).swap(*this);
+    return *this;
+}
+
+template <class TYPE>
+inline
+IntrusivePtr<TYPE>&
+IntrusivePtr<TYPE>::operator=(bslmf::MovableRef<IntrusivePtr> rhs)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    IntrusivePtr(MoveUtil::move(rhs)).swap(*this);
+    return *this;
+}
+
+template <class TYPE>
+inline
+void IntrusivePtr<TYPE>::reset() BSLS_KEYWORD_NOEXCEPT
+{
+    IntrusivePtr().swap(*this);
+}
+
+template <class TYPE>
+inline
+void IntrusivePtr<TYPE>::reset(TYPE *object)
+{
+    IntrusivePtr(object).swap(*this);
+}
+
+template <class TYPE>
+inline
+TYPE *IntrusivePtr<TYPE>::release() BSLS_KEYWORD_NOEXCEPT
+{
+    TYPE *result = d_ptr_p;
+    d_ptr_p      = 0;
+    return result;
+}
+
+template <class TYPE>
+inline
+void IntrusivePtr<TYPE>::swap(IntrusivePtr& other) BSLS_KEYWORD_NOEXCEPT
+{
+    TYPE *tmp     = d_ptr_p;
+    d_ptr_p       = other.d_ptr_p;
+    other.d_ptr_p = tmp;
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+#if defined(BSLS_PLATFORM_CMP_IBM)      // last confirmed with xlC 12.1
+IntrusivePtr<TYPE>::operator typename IntrusivePtr::BoolType() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+#else
+IntrusivePtr<TYPE>::operator BoolType() const BSLS_KEYWORD_NOEXCEPT
+#endif
+{
+    return d_ptr_p ? bsls::UnspecifiedBool<IntrusivePtr>::trueValue()
+                   : bsls::UnspecifiedBool<IntrusivePtr>::falseValue();
+}
+
+template <class TYPE>
+inline
+TYPE& IntrusivePtr<TYPE>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_ptr_p);
+
+    return *d_ptr_p;
+}
+
+template <class TYPE>
+inline
+TYPE *IntrusivePtr<TYPE>::operator->() const
+{
+    BSLS_ASSERT_SAFE(d_ptr_p);
+
+    return d_ptr_p;
+}
+
+template <class TYPE>
+inline
+TYPE *IntrusivePtr<TYPE>::get() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_ptr_p;
+}
+
+template <class TYPE>
+inline
+int IntrusivePtr<TYPE>::numReferences() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_ptr_p ? d_ptr_p->numReferences() : 0;
+}
+
+// FREE OPERATORS
+template <class LHS_TYPE, class RHS_TYPE>
+inline
+bool operator==(const IntrusivePtr<LHS_TYPE>& lhs,
+                const IntrusivePtr<RHS_TYPE>& rhs) BSLS_KEYWORD_NOEXCEPT
+{
+    return lhs.get() == rhs.get();
+}
+
+template <class LHS_TYPE, class RHS_TYPE>
+inline
+bool operator!=(const IntrusivePtr<LHS_TYPE>& lhs,
+                const IntrusivePtr<RHS_TYPE>& rhs) BSLS_KEYWORD_NOEXCEPT
+{
+    return lhs.get() != rhs.get();
+}
+
+// FREE FUNCTIONS
+template <class TYPE>
+inline
+void swap(IntrusivePtr<TYPE>& a, IntrusivePtr<TYPE>& b) BSLS_KEYWORD_NOEXCEPT
+{
+    a.swap(b);
+}
+
+                         // ------------------------
+                         // class EnableIntrusivePtr
+                         // ------------------------
+
+// PROTECTED CREATORS
+template <class TYPE>
+inline
+EnableIntrusivePtr<TYPE>::EnableIntrusivePtr()
+: SharedPtrRep()
+{
+}
+
+template <class TYPE>
+inline
+EnableIntrusivePtr<TYPE>::~EnableIntrusivePtr()
+{
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void *EnableIntrusivePtr<TYPE>::getDeleter(const std::type_info&)
+{
+    return 0;
+}
+
+template <class TYPE>
+inline
+IntrusivePtr<TYPE> EnableIntrusivePtr<TYPE>::intrusivePtrFromThis()
+{
+    BSLS_ASSERT(0 < numReferences());
+
+    acquireRef();
+    return IntrusivePtr<TYPE>(static_cast<TYPE *>(this));
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+void *EnableIntrusivePtr<TYPE>::originalPtr() const
+{
+    return const_cast<void *>(static_cast<const void *>(
+                                            static_cast<const TYPE *>(this)));
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
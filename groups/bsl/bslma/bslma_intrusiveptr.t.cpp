@@ -0,0 +1,1112 @@
+// bslma_intrusiveptr.t.cpp                                           -*-C++-*-
+#include <bslma_intrusiveptr.h>
+
+#include <bslma_allocator.h>
+#include <bslma_default.h>
+#include <bslma_sharedptrrep.h>
+#include <bslma_testallocator.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_keyword.h>
+#include <bsls_types.h>
+
+#include <new>          // placement `new`
+#include <typeinfo>     // `typeid`
+
+#include <stdio.h>      // `printf`
+#include <stdlib.h>     // `atoi`
+
+// These warning suppressions will be eliminated in due course.
+// BDE_VERIFY pragma: -FD01  // Test-machinery lacks a contract
+// BDE_VERIFY pragma: -TP18  // Test-case banners are ALL-CAPS
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test provides a smart pointer, `bslma::IntrusivePtr`,
+// that manipulates the reference counts embedded in a `bslma::SharedPtrRep`
+// (sub-)object, and a base class, `bslma::EnableIntrusivePtr`, that turns a
+// derived class into its own `SharedPtrRep`.  We test both using a helper
+// class that records how often its `disposeObject` and `disposeRep` methods
+// are invoked, and that deallocates itself in `disposeRep`, so that the test
+// allocator detects any leaked or doubly-released object.
+//-----------------------------------------------------------------------------
+// bslma::IntrusivePtr
+//--------------------
+// CREATORS
+// [ 3] IntrusivePtr();
+// [ 3] explicit IntrusivePtr(TYPE *object);
+// [ 3] IntrusivePtr(const IntrusivePtr& original);
+// [ 3] IntrusivePtr(bslmf::MovableRef<IntrusivePtr> original);
+// [ 3] ~IntrusivePtr();
+//
+// MANIPULATORS
+// [ 4] IntrusivePtr& operator=(const IntrusivePtr& rhs);
+// [ 4] IntrusivePtr& operator=(bslmf::MovableRef<IntrusivePtr> rhs);
+// [ 4] void reset();
+// [ 4] void reset(TYPE *object);
+// [ 4] TYPE *release();
+// [ 4] void swap(IntrusivePtr& other);
+//
+// ACCESSORS
+// [ 5] operator BoolType() const;
+// [ 5] TYPE& operator*() const;
+// [ 5] TYPE *operator->() const;
+// [ 5] TYPE *get() const;
+// [ 5] int numReferences() const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const IntrusivePtr<L>&, const IntrusivePtr<R>&);
+// [ 5] bool operator!=(const IntrusivePtr<L>&, const IntrusivePtr<R>&);
+//
+// FREE FUNCTIONS
+// [ 4] void swap(IntrusivePtr<TYPE>& a, IntrusivePtr<TYPE>& b);
+//
+// bslma::EnableIntrusivePtr
+//--------------------------
+// [ 2] EnableIntrusivePtr();
+// [ 2] ~EnableIntrusivePtr();
+// [ 2] void *getDeleter(const std::type_info& type);
+// [ 2] IntrusivePtr<TYPE> intrusivePtrFromThis();
+// [ 2] void *originalPtr() const;
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] USAGE EXAMPLE
+// [ 6] CONCERN: weak references delay `disposeRep`
+// [ 6] CONCERN: reusing an object after `resetCountsRaw`
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+        fflush(stdout);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+#define ASSERT_SAFE_PASS_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS_RAW(EXPR)
+#define ASSERT_SAFE_FAIL_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL_RAW(EXPR)
+#define ASSERT_PASS_RAW(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS_RAW(EXPR)
+#define ASSERT_FAIL_RAW(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL_RAW(EXPR)
+#define ASSERT_OPT_PASS_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS_RAW(EXPR)
+#define ASSERT_OPT_FAIL_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL_RAW(EXPR)
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+class TestObject;
+
+typedef bslma::IntrusivePtr<TestObject> Obj;
+
+//=============================================================================
+//             GLOBAL HELPER CLASSES AND FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+                              // ================
+                              // class TestObject
+                              // ================
+
+/// This class provides a self-counting object that records the number of
+/// times its `disposeObject` and `disposeRep` methods are invoked, and that
+/// (optionally) destroys and deallocates itself in `disposeRep`.
+class TestObject : public bslma::EnableIntrusivePtr<TestObject> {
+
+    // DATA
+    int              *d_numObjectDisposed_p;  // `disposeObject` call count
+    int              *d_numRepDisposed_p;     // `disposeRep` call count
+    int               d_value;                // arbitrary value
+    bslma::Allocator *d_allocator_p;          // if non-zero, deallocate this
+                                              // object in `disposeRep`
+
+  public:
+    // CLASS METHODS
+
+    /// Return the address of a new `TestObject` allocated from the specified
+    /// `allocator`, having the specified `value`, and that increments the
+    /// specified `numObjectDisposed` and `numRepDisposed` counters and then
+    /// deallocates itself when disposed of.
+    static TestObject *create(int              *numObjectDisposed,
+                              int              *numRepDisposed,
+                              int               value,
+                              bslma::Allocator *allocator)
+    {
+        return new (*allocator) TestObject(numObjectDisposed,
+                                           numRepDisposed,
+                                           value,
+                                           allocator);
+    }
+
+    // CREATORS
+
+    /// Create an object having the specified `value` that increments the
+    /// specified `numObjectDisposed` and `numRepDisposed` counters when
+    /// disposed of.  Optionally specify an `allocator` from which this
+    /// object was allocated and to which it is returned in `disposeRep`.
+    TestObject(int              *numObjectDisposed,
+               int              *numRepDisposed,
+               int               value,
+               bslma::Allocator *allocator = 0)
+    : d_numObjectDisposed_p(numObjectDisposed)
+    , d_numRepDisposed_p(numRepDisposed)
+    , d_value(value)
+    , d_allocator_p(allocator)
+    {
+    }
+
+    /// Destroy this object.
+    ~TestObject() BSLS_KEYWORD_OVERRIDE
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Increment the `disposeObject` counter.
+    void disposeObject() BSLS_KEYWORD_OVERRIDE
+    {
+        ++*d_numObjectDisposed_p;
+    }
+
+    /// Increment the `disposeRep` counter, and destroy and deallocate this
+    /// object if it was created by `create`.
+    void disposeRep() BSLS_KEYWORD_OVERRIDE
+    {
+        ++*d_numRepDisposed_p;
+
+        if (d_allocator_p) {
+            bslma::Allocator *allocator = d_allocator_p;
+            this->~TestObject();
+            allocator->deallocate(this);
+        }
+    }
+
+    /// Set the value of this object to the specified `value`.
+    void setValue(int value)
+    {
+        d_value = value;
+    }
+
+    // ACCESSORS
+
+    /// Return the value of this object.
+    int value() const
+    {
+        return d_value;
+    }
+};
+
+                           // ====================
+                           // class MultipleObject
+                           // ====================
+
+/// This `struct` provides a polymorphic, non-empty base class that precedes
+/// the `SharedPtrRep` sub-object of `MultipleObject`.
+struct LeadingBase {
+
+    // DATA
+    double d_padding;  // ensures the following base is at a non-zero offset
+
+    // CREATORS
+    LeadingBase() : d_padding(0.0) {}
+    virtual ~LeadingBase() {}
+};
+
+/// This class derives from `EnableIntrusivePtr` at a non-zero offset, so that
+/// `originalPtr` is observably distinct from the `SharedPtrRep` address.
+class MultipleObject : public LeadingBase
+                     , public bslma::EnableIntrusivePtr<MultipleObject> {
+
+  public:
+    // CREATORS
+    MultipleObject() {}
+    ~MultipleObject() BSLS_KEYWORD_OVERRIDE {}
+
+    // MANIPULATORS
+    void disposeObject() BSLS_KEYWORD_OVERRIDE {}
+    void disposeRep() BSLS_KEYWORD_OVERRIDE {}
+};
+
+//=============================================================================
+//                               USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE_1 {
+
+///Example 1: Sharing Pooled Objects Without Allocating
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we process a high rate of messages, each of which is read into
+// a record obtained from a pool and then handed to a number of consumers that
+// share it, and that we want the record to return to the pool once the last
+// consumer is done with it.
+//
+// First, we define the record type, which derives from
+// `bslma::EnableIntrusivePtr` and returns itself to its pool in `disposeRep`:
+// ```
+    class MyRecordPool;
+
+    class MyRecord : public bslma::EnableIntrusivePtr<MyRecord> {
+        // DATA
+        MyRecordPool *d_pool_p;    // pool to which this record is returned
+        MyRecord     *d_next_p;    // next record on the pool's free list
+        int           d_payload;   // message payload
+
+        // FRIENDS
+        friend class MyRecordPool;
+
+      private:
+        // PRIVATE MANIPULATORS
+        void disposeObject() BSLS_KEYWORD_OVERRIDE;
+        void disposeRep() BSLS_KEYWORD_OVERRIDE;
+
+        // PRIVATE CREATORS
+        explicit MyRecord(MyRecordPool *pool)
+        : d_pool_p(pool)
+        , d_next_p(0)
+        , d_payload(0)
+        {
+        }
+
+        ~MyRecord() BSLS_KEYWORD_OVERRIDE
+        {
+        }
+
+      public:
+        // MANIPULATORS
+        void setPayload(int value) { d_payload = value; }
+
+        // ACCESSORS
+        int payload() const { return d_payload; }
+    };
+// ```
+// Then, we define a (single-threaded, for brevity) pool that recycles
+// records, resetting the reference counts of a record before handing it out
+// again:
+// ```
+    class MyRecordPool {
+        // DATA
+        MyRecord         *d_freeList_p;   // records available for reuse
+        int               d_numCreated;   // number of records created
+        bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+      public:
+        // CREATORS
+        explicit MyRecordPool(bslma::Allocator *basicAllocator = 0)
+        : d_freeList_p(0)
+        , d_numCreated(0)
+        , d_allocator_p(bslma::Default::allocator(basicAllocator))
+        {
+        }
+
+        ~MyRecordPool()
+        {
+            while (d_freeList_p) {
+                MyRecord *record = d_freeList_p;
+                d_freeList_p     = record->d_next_p;
+
+                record->~MyRecord();
+                d_allocator_p->deallocate(record);
+                --d_numCreated;
+            }
+            ASSERT(0 == d_numCreated);
+        }
+
+        // MANIPULATORS
+        bslma::IntrusivePtr<MyRecord> getRecord()
+        {
+            MyRecord *record = d_freeList_p;
+            if (record) {
+                d_freeList_p = record->d_next_p;
+                record->resetCountsRaw(1, 0);
+            }
+            else {
+                record = new (*d_allocator_p) MyRecord(this);
+                ++d_numCreated;
+            }
+            return bslma::IntrusivePtr<MyRecord>(record);
+        }
+
+        void returnRecord(MyRecord *record)
+        {
+            record->d_next_p = d_freeList_p;
+            d_freeList_p     = record;
+        }
+
+        // ACCESSORS
+        int numCreated() const { return d_numCreated; }
+    };
+
+    void MyRecord::disposeObject()
+    {
+        d_payload = 0;
+    }
+
+    void MyRecord::disposeRep()
+    {
+        d_pool_p->returnRecord(this);
+    }
+// ```
+
+}  // close namespace USAGE_EXAMPLE_1
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;           // suppress unused variable warning
+    (void)veryVeryVerbose;       // suppress unused variable warning
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    bslma::TestAllocator ta("test", veryVeryVeryVerbose);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        using namespace USAGE_EXAMPLE_1;
+
+// Now, we obtain a record, fill it in, and share it among several holders;
+// each copy merely increments the count embedded in the record, and no
+// memory is allocated:
+// ```
+    bslma::TestAllocator ta;
+    MyRecordPool         pool(&ta);
+    {
+        bslma::IntrusivePtr<MyRecord> record = pool.getRecord();
+        record->setPayload(42);
+
+        bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+        bslma::IntrusivePtr<MyRecord> consumer1(record);
+        bslma::IntrusivePtr<MyRecord> consumer2(record);
+        ASSERT(3  == record.numReferences());
+        ASSERT(42 == consumer2->payload());
+
+        bslma::IntrusivePtr<MyRecord> consumer3 =
+                                             record->intrusivePtrFromThis();
+        ASSERT(4 == record.numReferences());
+        ASSERT(numAllocations == ta.numAllocations());
+    }
+// ```
+// Finally, we observe that once all of the holders have gone away, the record
+// has been returned to the pool, and is handed out again by the next request:
+// ```
+    bslma::IntrusivePtr<MyRecord> record = pool.getRecord();
+    ASSERT(1 == pool.numCreated());
+    ASSERT(1 == record.numReferences());
+    ASSERT(0 == record->payload());
+// ```
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // WEAK REFERENCES AND REUSE
+        //
+        // Concerns:
+        // 1. Releasing the last shared reference held by an `IntrusivePtr`
+        //    invokes `disposeObject`, but defers `disposeRep` while weak
+        //    references (e.g., those held by `bsl::weak_ptr`) remain.
+        //
+        // 2. An object whose counts are reset with `resetCountsRaw(1, 0)`
+        //    after being disposed of can be adopted and shared again.
+        //
+        // 3. An object shared by other means (e.g., `bsl::shared_ptr`, which
+        //    manipulates the same counts) can be shared by `IntrusivePtr`
+        //    via `intrusivePtrFromThis`, and vice versa via `release`.
+        //
+        // Plan:
+        // 1. Acquire a weak reference to an object held by an `IntrusivePtr`,
+        //    reset the pointer, and verify that only `disposeObject` was
+        //    invoked; then release the weak reference and verify that
+        //    `disposeRep` was invoked.  (C-1)
+        //
+        // 2. Reset the counts of the disposed object, adopt it again, and
+        //    verify that it is disposed of a second time when the new pointer
+        //    is destroyed.  (C-2)
+        //
+        // 3. Emulate an external owner by manipulating `acquireRef` and
+        //    `releaseRef` directly alongside `IntrusivePtr` objects, and
+        //    verify that the object is disposed of exactly once, when the
+        //    last of the owners releases its reference.  (C-3)
+        //
+        // Testing:
+        //   CONCERN: weak references delay `disposeRep`
+        //   CONCERN: reusing an object after `resetCountsRaw`
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nWEAK REFERENCES AND REUSE"
+                            "\n=========================\n");
+
+        if (verbose) printf("\tWeak references.\n");
+        {
+            int        numObj = 0, numRep = 0;
+            TestObject object(&numObj, &numRep, 1);
+
+            Obj mX(&object);
+            object.acquireWeakRef();
+            ASSERT(1 == object.numWeakReferences());
+
+            mX.reset();
+            ASSERTV(numObj, 1 == numObj);
+            ASSERTV(numRep, 0 == numRep);
+            ASSERT(0 == object.numReferences());
+            ASSERT(false == object.tryAcquireRef());
+
+            object.releaseWeakRef();
+            ASSERTV(numObj, 1 == numObj);
+            ASSERTV(numRep, 1 == numRep);
+
+            if (verbose) printf("\tReuse after `resetCountsRaw`.\n");
+
+            object.resetCountsRaw(1, 0);
+            object.setValue(2);
+
+            Obj mY(&object);  const Obj& Y = mY;
+            Obj mZ(Y);
+            ASSERT(2 == Y.numReferences());
+            ASSERT(2 == mZ->value());
+
+            mY.reset();
+            mZ.reset();
+            ASSERTV(numObj, 2 == numObj);
+            ASSERTV(numRep, 2 == numRep);
+        }
+
+        if (verbose) printf("\tSharing with an external owner.\n");
+        {
+            int         numObj = 0, numRep = 0;
+            TestObject *object = TestObject::create(&numObj,
+                                                    &numRep,
+                                                    3,
+                                                    &ta);
+
+            // The creator's reference is held by the "external owner".
+
+            Obj mX = object->intrusivePtrFromThis();
+            ASSERT(2 == mX.numReferences());
+
+            {
+                Obj mY(mX);
+                ASSERT(3 == object->numReferences());
+            }
+            ASSERT(2 == object->numReferences());
+
+            // Hand the reference of `mX` to the external owner.
+
+            TestObject *raw = mX.release();
+            ASSERT(object == raw);
+            ASSERT(2 == object->numReferences());
+
+            object->releaseRef();
+            ASSERT(0 == numObj);
+
+            // Take the last reference back.
+
+            Obj mZ(raw);
+            ASSERT(1 == mZ.numReferences());
+            ASSERT(0 == numObj);
+            ASSERT(1 == ta.numBlocksInUse());
+
+            mZ.reset();
+            ASSERTV(numObj, 1 == numObj);
+            ASSERTV(numRep, 1 == numRep);
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // ACCESSORS AND FREE OPERATORS
+        //
+        // Concerns:
+        // 1. An empty pointer converts to `false`, and a non-empty one to
+        //    `true`.
+        //
+        // 2. `get`, `operator->`, and `operator*` provide access to the
+        //    referenced object, and `get` returns 0 for an empty pointer.
+        //
+        // 3. `numReferences` returns the count embedded in the object, or 0
+        //    for an empty pointer.
+        //
+        // 4. `operator==` and `operator!=` compare the addresses of the
+        //    referenced objects.
+        //
+        // 5. The accessors are `const`-qualified.
+        //
+        // 6. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Exercise each accessor and operator on empty pointers, pointers
+        //    to distinct objects, and pointers to the same object, via
+        //    `const` references.  (C-1..5)
+        //
+        // 2. Verify that, in appropriate build modes, defensive checks are
+        //    triggered when an empty pointer is dereferenced.  (C-6)
+        //
+        // Testing:
+        //   operator BoolType() const;
+        //   TYPE& operator*() const;
+        //   TYPE *operator->() const;
+        //   TYPE *get() const;
+        //   int numReferences() const;
+        //   bool operator==(const IntrusivePtr<L>&, const IntrusivePtr<R>&);
+        //   bool operator!=(const IntrusivePtr<L>&, const IntrusivePtr<R>&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nACCESSORS AND FREE OPERATORS"
+                            "\n============================\n");
+
+        int numObj = 0, numRep = 0;
+        {
+            const Obj E1;
+            const Obj E2;
+
+            ASSERT(!E1);
+            ASSERT(0 == E1.get());
+            ASSERT(0 == E1.numReferences());
+            ASSERT(  E1 == E2);
+            ASSERT(!(E1 != E2));
+
+            Obj mX(TestObject::create(&numObj, &numRep, 1, &ta));
+            const Obj& X = mX;
+
+            Obj mY(TestObject::create(&numObj, &numRep, 2, &ta));
+            const Obj& Y = mY;
+
+            const Obj Z(X);
+
+            ASSERT(X);
+            ASSERT(!!X);
+            ASSERT(0 != X.get());
+            ASSERT(1 == X->value());
+            ASSERT(2 == (*Y).value());
+            ASSERT(&*X == X.get());
+            ASSERT(X.operator->() == X.get());
+
+            ASSERT(2 == X.numReferences());
+            ASSERT(1 == Y.numReferences());
+
+            ASSERT(  X == Z);
+            ASSERT(!(X != Z));
+            ASSERT(  X != Y);
+            ASSERT(!(X == Y));
+            ASSERT(  X != E1);
+            ASSERT(!(X == E1));
+
+            X->setValue(3);
+            ASSERT(3 == Z->value());
+
+            if (verbose) printf("\tNegative testing.\n");
+            {
+                bsls::AssertTestHandlerGuard hG;
+
+                ASSERT_SAFE_FAIL(*E1);
+                ASSERT_SAFE_FAIL(E1.operator->());
+                ASSERT_SAFE_PASS(*X);
+                ASSERT_SAFE_PASS(X.operator->());
+            }
+        }
+        ASSERTV(numObj, 2 == numObj);
+        ASSERTV(numRep, 2 == numRep);
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // MANIPULATORS
+        //
+        // Concerns:
+        // 1. Copy assignment acquires a reference to the new object before
+        //    releasing the reference to the old one, so that the old object
+        //    is disposed of only if it is no longer referenced, and
+        //    self-assignment has no effect.
+        //
+        // 2. Move assignment transfers the reference without changing the
+        //    count of the new object, and leaves the source empty.
+        //
+        // 3. `reset()` releases the reference and leaves the pointer empty;
+        //    `reset(object)` additionally adopts a reference to `object`.
+        //
+        // 4. `release` returns the referenced object and leaves the pointer
+        //    empty without changing the count.
+        //
+        // 5. Both the member and free `swap` exchange the referenced objects
+        //    without changing any count.
+        //
+        // 6. The assignment operators return a reference to `*this`.
+        //
+        // Plan:
+        // 1. Using two objects created from a test allocator, exercise each
+        //    manipulator and verify the referenced objects, the reference
+        //    counts, and the number of times each object is disposed of.
+        //    (C-1..6)
+        //
+        // Testing:
+        //   IntrusivePtr& operator=(const IntrusivePtr& rhs);
+        //   IntrusivePtr& operator=(bslmf::MovableRef<IntrusivePtr> rhs);
+        //   void reset();
+        //   void reset(TYPE *object);
+        //   TYPE *release();
+        //   void swap(IntrusivePtr& other);
+        //   void swap(IntrusivePtr<TYPE>& a, IntrusivePtr<TYPE>& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nMANIPULATORS"
+                            "\n============\n");
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        if (verbose) printf("\tCopy assignment.\n");
+        {
+            int numObj = 0, numRep = 0;
+
+            TestObject *a = TestObject::create(&numObj, &numRep, 1, &ta);
+            TestObject *b = TestObject::create(&numObj, &numRep, 2, &ta);
+
+            Obj mX(a);  const Obj& X = mX;
+            Obj mY(b);  const Obj& Y = mY;
+
+            Obj *mR = &(mX = Y);
+            ASSERT(mR == &mX);
+            ASSERT(b == X.get());
+            ASSERT(2 == b->numReferences());
+            ASSERTV(numObj, 1 == numObj);     // `a` disposed of
+
+            mR = &(mX = X);
+            ASSERT(mR == &mX);
+            ASSERT(b == X.get());
+            ASSERT(2 == b->numReferences());
+
+            Obj mE;
+            mX = mE;
+            ASSERT(!X);
+            ASSERT(1 == b->numReferences());
+
+            mY = mE;
+            ASSERTV(numObj, 2 == numObj);
+            ASSERTV(numRep, 2 == numRep);
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tMove assignment.\n");
+        {
+            int numObj = 0, numRep = 0;
+
+            TestObject *a = TestObject::create(&numObj, &numRep, 1, &ta);
+            TestObject *b = TestObject::create(&numObj, &numRep, 2, &ta);
+
+            Obj mX(a);  const Obj& X = mX;
+            Obj mY(b);  const Obj& Y = mY;
+
+            Obj *mR = &(mX = MoveUtil::move(mY));
+            ASSERT(mR == &mX);
+            ASSERT(b == X.get());
+            ASSERT(!Y);
+            ASSERT(1 == b->numReferences());
+            ASSERTV(numObj, 1 == numObj);
+
+            mX = MoveUtil::move(mX);
+            ASSERT(b == X.get());
+            ASSERT(1 == b->numReferences());
+        }
+
+        if (verbose) printf("\t`reset` and `release`.\n");
+        {
+            int numObj = 0, numRep = 0;
+
+            TestObject *a = TestObject::create(&numObj, &numRep, 1, &ta);
+            TestObject *b = TestObject::create(&numObj, &numRep, 2, &ta);
+
+            Obj mX(a);  const Obj& X = mX;
+
+            mX.reset(b);
+            ASSERT(b == X.get());
+            ASSERT(1 == b->numReferences());
+            ASSERTV(numObj, 1 == numObj);
+
+            TestObject *p = mX.release();
+            ASSERT(b == p);
+            ASSERT(!X);
+            ASSERT(1 == b->numReferences());
+            ASSERTV(numObj, 1 == numObj);
+
+            mX.reset(p);
+            ASSERT(b == X.get());
+
+            mX.reset();
+            ASSERT(!X);
+            ASSERTV(numObj, 2 == numObj);
+            ASSERTV(numRep, 2 == numRep);
+
+            mX.reset();
+            ASSERT(!X);
+
+            ASSERT(0 == mX.release());
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) printf("\t`swap`.\n");
+        {
+            int numObj = 0, numRep = 0;
+
+            TestObject *a = TestObject::create(&numObj, &numRep, 1, &ta);
+            TestObject *b = TestObject::create(&numObj, &numRep, 2, &ta);
+
+            Obj mX(a);  const Obj& X = mX;
+            Obj mY(b);  const Obj& Y = mY;
+
+            mX.swap(mY);
+            ASSERT(b == X.get());
+            ASSERT(a == Y.get());
+            ASSERT(1 == a->numReferences());
+            ASSERT(1 == b->numReferences());
+
+            swap(mX, mY);
+            ASSERT(a == X.get());
+            ASSERT(b == Y.get());
+
+            Obj mE;
+            bslma::swap(mE, mX);
+            ASSERT(a == mE.get());
+            ASSERT(!X);
+            ASSERT(0 == numObj);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CREATORS
+        //
+        // Concerns:
+        // 1. A default-constructed pointer is empty.
+        //
+        // 2. The adopting constructor does not change the reference count,
+        //    and accepts a null pointer.
+        //
+        // 3. The copy constructor acquires one reference if the original is
+        //    not empty.
+        //
+        // 4. The move constructor transfers the reference, leaving the
+        //    original empty, without changing the count.
+        //
+        // 5. The destructor releases exactly one reference, and the object is
+        //    disposed of exactly once, when the last reference is released.
+        //
+        // 6. No memory is allocated by any of the creators.
+        //
+        // 7. An `IntrusivePtr` is the size of a raw pointer.
+        //
+        // Plan:
+        // 1. Create pointers using each constructor, verify the reference
+        //    counts and dispose counters as the pointers go out of scope, and
+        //    verify that the default and global allocators are not used.
+        //    (C-1..7)
+        //
+        // Testing:
+        //   IntrusivePtr();
+        //   explicit IntrusivePtr(TYPE *object);
+        //   IntrusivePtr(const IntrusivePtr& original);
+        //   IntrusivePtr(bslmf::MovableRef<IntrusivePtr> original);
+        //   ~IntrusivePtr();
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS"
+                            "\n========\n");
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        ASSERT(sizeof(Obj) == sizeof(TestObject *));
+
+        int numObj = 0, numRep = 0;
+        {
+            const Obj E;
+            ASSERT(0 == E.get());
+
+            const Obj N(0);
+            ASSERT(0 == N.get());
+
+            const Obj EC(E);
+            ASSERT(0 == EC.get());
+
+            TestObject *object = TestObject::create(&numObj, &numRep, 1, &ta);
+            ASSERT(1 == ta.numBlocksInUse());
+
+            bsls::Types::Int64 numAllocations = ta.numAllocations();
+            {
+                const Obj X(object);
+                ASSERT(object == X.get());
+                ASSERT(1 == object->numReferences());
+                {
+                    const Obj Y(X);
+                    ASSERT(object == Y.get());
+                    ASSERT(2 == object->numReferences());
+
+                    Obj       mZ(Y);
+                    const Obj W(MoveUtil::move(mZ));
+                    ASSERT(0 == mZ.get());
+                    ASSERT(object == W.get());
+                    ASSERT(3 == object->numReferences());
+                }
+                ASSERT(1 == object->numReferences());
+                ASSERT(0 == numObj);
+                ASSERT(0 == numRep);
+            }
+            ASSERTV(numObj, 1 == numObj);
+            ASSERTV(numRep, 1 == numRep);
+            ASSERT(numAllocations == ta.numAllocations());
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // `EnableIntrusivePtr`
+        //
+        // Concerns:
+        // 1. A newly constructed object has one shared reference and no weak
+        //    references.
+        //
+        // 2. `getDeleter` returns 0.
+        //
+        // 3. `originalPtr` returns the address of the most-derived object,
+        //    even when the `SharedPtrRep` base is at a non-zero offset.
+        //
+        // 4. `intrusivePtrFromThis` acquires an additional reference and
+        //    returns a pointer to the most-derived object.
+        //
+        // 5. When the last reference is released, `disposeObject` and then
+        //    `disposeRep` are invoked, once each.
+        //
+        // 6. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Create `TestObject` and `MultipleObject` objects and verify the
+        //    initial counts, `getDeleter`, and `originalPtr`.  (C-1..3)
+        //
+        // 2. Invoke `intrusivePtrFromThis` and verify the returned pointer and
+        //    counts, then release all references and verify the dispose
+        //    counters.  (C-4..5)
+        //
+        // 3. Verify that, in appropriate build modes, defensive checks are
+        //    triggered when `intrusivePtrFromThis` is invoked on an object
+        //    having no shared references.  (C-6)
+        //
+        // Testing:
+        //   EnableIntrusivePtr();
+        //   ~EnableIntrusivePtr();
+        //   void *getDeleter(const std::type_info& type);
+        //   IntrusivePtr<TYPE> intrusivePtrFromThis();
+        //   void *originalPtr() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n`EnableIntrusivePtr`"
+                            "\n====================\n");
+
+        {
+            int        numObj = 0, numRep = 0;
+            TestObject object(&numObj, &numRep, 1);
+            const TestObject& OBJECT = object;
+
+            ASSERT(1 == OBJECT.numReferences());
+            ASSERT(0 == OBJECT.numWeakReferences());
+            ASSERT(true == OBJECT.hasUniqueOwner());
+            ASSERT(0 == object.getDeleter(typeid(void (*)(TestObject *))));
+            ASSERT(&object == OBJECT.originalPtr());
+
+            {
+                Obj mX = object.intrusivePtrFromThis();
+                ASSERT(&object == mX.get());
+                ASSERT(2 == OBJECT.numReferences());
+            }
+            ASSERT(1 == OBJECT.numReferences());
+            ASSERT(0 == numObj);
+
+            object.releaseRef();
+            ASSERTV(numObj, 1 == numObj);
+            ASSERTV(numRep, 1 == numRep);
+            ASSERT(0 == OBJECT.numReferences());
+
+            if (verbose) printf("\tNegative testing.\n");
+            {
+                bsls::AssertTestHandlerGuard hG;
+
+                ASSERT_FAIL(object.intrusivePtrFromThis());
+
+                object.resetCountsRaw(1, 0);
+                Obj mX;
+                ASSERT_PASS(mX = object.intrusivePtrFromThis());
+                mX.release();
+            }
+        }
+        {
+            MultipleObject                    object;
+            const bslma::SharedPtrRep&        REP = object;
+            bslma::IntrusivePtr<MultipleObject> mX =
+                                                object.intrusivePtrFromThis();
+
+            ASSERT(static_cast<const void *>(&REP) !=
+                                          static_cast<const void *>(&object));
+            ASSERT(&object == REP.originalPtr());
+            ASSERT(&object == mX.get());
+            ASSERT(2 == REP.numReferences());
+
+            mX.reset();
+            ASSERT(1 == REP.numReferences());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Share a self-counting object among several pointers and verify
+        //    that it is disposed of when the last pointer is destroyed.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        int numObj = 0, numRep = 0;
+        {
+            Obj mX(TestObject::create(&numObj, &numRep, 7, &ta));
+            const Obj& X = mX;
+            ASSERT(X);
+            ASSERT(7 == X->value());
+            ASSERT(1 == X.numReferences());
+
+            Obj mY(X);  const Obj& Y = mY;
+            ASSERT(X == Y);
+            ASSERT(2 == X.numReferences());
+
+            mX.reset();
+            ASSERT(!X);
+            ASSERT(1 == Y.numReferences());
+            ASSERT(0 == numObj);
+        }
+        ASSERT(1 == numObj);
+        ASSERT(1 == numRep);
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
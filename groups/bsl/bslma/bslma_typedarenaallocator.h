@@ -0,0 +1,391 @@
+// bslma_typedarenaallocator.h                                        -*-C++-*-
+#ifndef INCLUDED_BSLMA_TYPEDARENAALLOCATOR
+#define INCLUDED_BSLMA_TYPEDARENAALLOCATOR
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an STL allocator that statically dispatches to an arena.
+//
+//@CLASSES:
+//  bslma::TypedArenaAllocator: `bsl::allocator` bound to a concrete arena type
+//
+//@SEE_ALSO: bslma_bslallocator, bslma_aamodel, bdlma_sequentialallocator
+//
+//@DESCRIPTION: This component provides an STL-compatible allocator class
+// template, `bslma::TypedArenaAllocator<ARENA, TYPE>`, that behaves like
+// `bsl::allocator<TYPE>` (from which it derives), except that allocation
+// requests are forwarded to the arena -- an object of the concrete mechanism
+// class `ARENA`, derived from `bslma::Allocator` -- through a *qualified*,
+// and hence non-virtual, call to `ARENA::allocate`.  When `ARENA::allocate`
+// is defined inline (as it is for the sequential allocators in `bdlma`, e.g.,
+// `bdlma::SequentialAllocator` and `bdlma::LocalSequentialAllocator`), the
+// bump-pointer fast path of the arena is inlined into the container code that
+// allocates, eliminating the two virtual calls (`memory_resource::do_allocate`
+// followed by `bslma::Allocator::allocate`) that `bsl::allocator` makes for
+// every allocation.
+//
+// Since a `bslma::TypedArenaAllocator<ARENA, TYPE>` *is* a
+// `bsl::allocator<TYPE>`, it can be used wherever a `bsl::allocator` can be
+// used, and it propagates itself to the elements of a container exactly as
+// `bsl::allocator` does.  Note, however, that a container *type* using this
+// allocator (e.g., `bsl::vector<int, bslma::TypedArenaAllocator<A, int> >`)
+// differs from the corresponding container type using `bsl::allocator`, and
+// supports the **stl-AA** model (see `bslma_aamodel`) rather than the
+// **bsl-AA** model.  Consequently, this allocator is intended for local,
+// performance-critical code in which the arena type is known at compile time,
+// not for vocabulary types passed across interfaces.
+//
+///Static Dispatch
+///---------------
+// The allocation of a `bslma::TypedArenaAllocator<ARENA, TYPE>` always invokes
+// `ARENA::allocate`, regardless of the dynamic type of the arena.  It is
+// therefore a precondition that the arena supplied on construction is either
+// of type `ARENA`, or of a type derived from `ARENA` that does not override
+// `allocate`.  Deallocation is, by contrast, dispatched virtually (through the
+// sized `memory_resource::deallocate`), exactly as by `bsl::allocator`:
+// deallocation from an arena is typically a no-op (or rare), and dispatching
+// it virtually preserves any size-dependent behavior of the arena (such as the
+// optional block reuse of `bdlma::SequentialAllocator`).
+//
+///Differences From `bsl::allocator`
+///---------------------------------
+// * There is no default constructor, as there is no default arena.
+// * `select_on_container_copy_construction` returns a copy of this allocator
+//   (rather than an allocator using the default allocator), so that a copy of
+//   a container uses the same arena as the original.
+// * `rebind<OTHER>::other` is `bslma::TypedArenaAllocator<ARENA, OTHER>`.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Allocating From an Arena Without Virtual Dispatch
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have an arena, `my_BumpArena`, that dispenses memory from a
+// fixed buffer and whose `allocate` method is defined inline (in practice we
+// would use one of the sequential allocators from `bdlma`):
+// ```
+// class my_BumpArena : public bslma::Allocator {
+//     // DATA
+//     char *d_cursor_p;        // next free byte
+//     char *d_end_p;           // end of the buffer
+//     int   d_numAllocations;  // number of calls to `allocate`
+//
+//   public:
+//     // CREATORS
+//     my_BumpArena(char *buffer, size_type size)
+//     : d_cursor_p(buffer)
+//     , d_end_p(buffer + size)
+//     , d_numAllocations(0)
+//     {
+//     }
+//
+//     // MANIPULATORS
+//     void *allocate(size_type size) BSLS_KEYWORD_OVERRIDE
+//     {
+//         ++d_numAllocations;
+//         size_type offset = bsls::AlignmentUtil::calculateAlignmentOffset(
+//                                d_cursor_p,
+//                                bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+//         if (static_cast<size_type>(d_end_p - d_cursor_p) < offset + size) {
+//             bsls::BslExceptionUtil::throwBadAlloc();
+//         }
+//         void *result = d_cursor_p + offset;
+//         d_cursor_p  += offset + size;
+//         return result;
+//     }
+//
+//     void deallocate(void *) BSLS_KEYWORD_OVERRIDE
+//     {
+//     }
+//
+//     // ACCESSORS
+//     int numAllocations() const { return d_numAllocations; }
+// };
+// ```
+// Then, we create an arena over a local buffer, and an allocator for `int`
+// objects bound to the arena's concrete type:
+// ```
+// bsls::AlignedBuffer<1024> buffer;
+// my_BumpArena              arena(buffer.buffer(), sizeof buffer);
+//
+// typedef bslma::TypedArenaAllocator<my_BumpArena, int> IntAllocator;
+// typedef bsl::allocator_traits<IntAllocator>           IntTraits;
+//
+// IntAllocator intAllocator(&arena);
+// assert(&arena == intAllocator.arena());
+// assert(&arena == intAllocator.mechanism());
+// ```
+// Next, we allocate memory in the way a container would, through
+// `bsl::allocator_traits`.  The call to `my_BumpArena::allocate` is
+// non-virtual, and the compiler is free to inline it:
+// ```
+// int *values = IntTraits::allocate(intAllocator, 4);
+// for (int i = 0; i < 4; ++i) {
+//     IntTraits::construct(intAllocator, values + i, i * i);
+// }
+// assert(9 == values[3]);
+// assert(1 == arena.numAllocations());
+// ```
+// Then, we observe that the allocator rebinds to other element types (as a
+// node-based container would require), still using the same arena:
+// ```
+// typedef IntAllocator::rebind<double>::other DoubleAllocator;
+//
+// DoubleAllocator doubleAllocator(intAllocator);
+// double *d = bsl::allocator_traits<DoubleAllocator>::allocate(
+//                                                            doubleAllocator,
+//                                                            1);
+// assert(2 == arena.numAllocations());
+// assert(doubleAllocator == intAllocator);
+// ```
+// Finally, we note that the allocator converts to `bsl::allocator<int>`, so
+// that it can be passed to interfaces expecting one (using the ordinary,
+// virtually-dispatched allocation path):
+// ```
+// bsl::allocator<int> generic = intAllocator;
+// assert(&arena == generic.mechanism());
+//
+// bsl::allocator_traits<DoubleAllocator>::deallocate(doubleAllocator, d, 1);
+// IntTraits::deallocate(intAllocator, values, 4);
+// ```
+
+#include <bslscm_version.h>
+
+#include <bslma_allocator.h>
+#include <bslma_bslallocator.h>
+#include <bslma_isstdallocator.h>
+
+#include <bslmf_assert.h>
+#include <bslmf_isbitwisecopyable.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_annotation.h>
+#include <bsls_assert.h>
+#include <bsls_bslexceptionutil.h>
+#include <bsls_keyword.h>
+#include <bsls_performancehint.h>
+
+#include <cstddef>
+
+namespace BloombergLP {
+namespace bslma {
+
+                         // =========================
+                         // class TypedArenaAllocator
+                         // =========================
+
+/// This class template provides an STL-compatible allocator for objects of
+/// the (template parameter) `TYPE`, derived from `bsl::allocator<TYPE>`,
+/// that obtains memory from an arena of the (template parameter) concrete
+/// mechanism type `ARENA` by a non-virtual call to `ARENA::allocate`.
+/// `ARENA` must publicly derive from `bslma::Allocator`.  See the
+/// {Static Dispatch} section of the component-level documentation.
+template <class ARENA, class TYPE = bsl::allocator<>::value_type>
+class TypedArenaAllocator : public bsl::allocator<TYPE> {
+
+    BSLMF_ASSERT((bsl::is_convertible<ARENA *, Allocator *>::value));
+
+    // PRIVATE TYPES
+    typedef bsl::allocator<TYPE> Base;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(TypedArenaAllocator,
+                                   bslmf::IsBitwiseCopyable);
+
+    // PUBLIC TYPES
+    typedef ARENA                           arena_type;
+    typedef typename Base::value_type       value_type;
+    typedef typename Base::size_type        size_type;
+    typedef typename Base::difference_type  difference_type;
+    typedef typename Base::pointer          pointer;
+    typedef typename Base::const_pointer    const_pointer;
+
+    /// This nested `struct` template, parameterized by `ANY_TYPE`, provides
+    /// a namespace for an `other` type alias, which is this template
+    /// instantiated with `ANY_TYPE` instead of `TYPE`.
+    template <class ANY_TYPE>
+    struct rebind {
+
+        typedef TypedArenaAllocator<ARENA, ANY_TYPE> other;
+    };
+
+    // CREATORS
+
+    /// Create an allocator that obtains memory from the specified `arena`.
+    /// The behavior is undefined unless `arena` is non-null, and the
+    /// dynamic type of `*arena` is `ARENA`, or is derived from `ARENA` and
+    /// does not override `allocate`.
+    TypedArenaAllocator(ARENA *arena);                              // IMPLICIT
+
+    /// Create an allocator that obtains memory from the same arena as the
+    /// specified `original`.  The newly constructed allocator compares equal
+    /// to `original`.
+    template <class ANY_TYPE>
+    TypedArenaAllocator(const TypedArenaAllocator<ARENA, ANY_TYPE>& original)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+
+    //! TypedArenaAllocator(const TypedArenaAllocator& original) = default;
+    //! ~TypedArenaAllocator() = default;
+
+    // MANIPULATORS
+
+    /// Return a block of memory having sufficient size and alignment to hold
+    /// the specified `n` objects of `value_type`, allocated from the arena
+    /// by a non-virtual call to `ARENA::allocate`.  Optionally specify a
+    /// `hint`, which is ignored.  Throw `bsl::bad_alloc` if
+    /// `max_size() < n`, or if the arena cannot satisfy the request.
+    BSLS_ANNOTATION_NODISCARD
+    pointer allocate(size_type n, const void *hint = 0);
+
+    /// Return the block of memory at the specified `p` address, which holds
+    /// the specified `n` objects of `value_type`, to the arena.  The
+    /// behavior is undefined unless `p` was returned by a call to `allocate`
+    /// with the same `n` on an allocator comparing equal to this one, and
+    /// has not yet been deallocated.
+    void deallocate(TYPE *p, std::size_t n = 1);
+
+    // ACCESSORS
+
+    /// Return the address of the arena from which this allocator obtains
+    /// memory.
+    ARENA *arena() const;
+
+    /// Return a copy of this allocator.
+    TypedArenaAllocator select_on_container_copy_construction() const;
+};
+
+// FREE OPERATORS
+
+/// Return `true` if the specified `lhs` and `rhs` allocators obtain memory
+/// from the same arena, and `false` otherwise.
+template <class ARENA, class TYPE1, class TYPE2>
+bool operator==(const TypedArenaAllocator<ARENA, TYPE1>& lhs,
+                const TypedArenaAllocator<ARENA, TYPE2>& rhs)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+
+/// Return `true` if the specified `lhs` and `rhs` allocators do not obtain
+/// memory from the same arena, and `false` otherwise.
+template <class ARENA, class TYPE1, class TYPE2>
+bool operator!=(const TypedArenaAllocator<ARENA, TYPE1>& lhs,
+                const TypedArenaAllocator<ARENA, TYPE2>& rhs)
+                                                         BSLS_KEYWORD_NOEXCEPT;
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+/// A `TypedArenaAllocator` is an allocator type, although its base class,
+/// `bsl::allocator`, inherits its `allocate` method.
+template <class ARENA, class TYPE>
+struct IsStdAllocator<TypedArenaAllocator<ARENA, TYPE> > : bsl::true_type {
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                         // -------------------------
+                         // class TypedArenaAllocator
+                         // -------------------------
+
+// CREATORS
+template <class ARENA, class TYPE>
+inline
+TypedArenaAllocator<ARENA, TYPE>::TypedArenaAllocator(ARENA *arena)
+: Base(arena)
+{
+    BSLS_ASSERT(arena);
+}
+
+template <class ARENA, class TYPE>
+template <class ANY_TYPE>
+inline
+TypedArenaAllocator<ARENA, TYPE>::TypedArenaAllocator(
+                     const TypedArenaAllocator<ARENA, ANY_TYPE>& original)
+                                                          BSLS_KEYWORD_NOEXCEPT
+: Base(original)
+{
+}
+
+// MANIPULATORS
+template <class ARENA, class TYPE>
+inline
+typename TypedArenaAllocator<ARENA, TYPE>::pointer
+TypedArenaAllocator<ARENA, TYPE>::allocate(size_type n, const void *)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(n > this->max_size())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        bsls::BslExceptionUtil::throwBadAlloc();
+    }
+
+    // The qualified call suppresses virtual dispatch.
+
+    return static_cast<pointer>(arena()->ARENA::allocate(n * sizeof(TYPE)));
+}
+
+template <class ARENA, class TYPE>
+inline
+void TypedArenaAllocator<ARENA, TYPE>::deallocate(TYPE *p, std::size_t n)
+{
+    Base::deallocate(p, n);
+}
+
+// ACCESSORS
+template <class ARENA, class TYPE>
+inline
+ARENA *TypedArenaAllocator<ARENA, TYPE>::arena() const
+{
+    return static_cast<ARENA *>(this->mechanism());
+}
+
+template <class ARENA, class TYPE>
+inline
+TypedArenaAllocator<ARENA, TYPE>
+TypedArenaAllocator<ARENA, TYPE>::select_on_container_copy_construction() const
+{
+    return *this;
+}
+
+// FREE OPERATORS
+template <class ARENA, class TYPE1, class TYPE2>
+inline
+bool operator==(const TypedArenaAllocator<ARENA, TYPE1>& lhs,
+                const TypedArenaAllocator<ARENA, TYPE2>& rhs)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return lhs.arena() == rhs.arena();
+}
+
+template <class ARENA, class TYPE1, class TYPE2>
+inline
+bool operator!=(const TypedArenaAllocator<ARENA, TYPE1>& lhs,
+                const TypedArenaAllocator<ARENA, TYPE2>& rhs)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return lhs.arena() != rhs.arena();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,891 @@
+// bslma_typedarenaallocator.t.cpp                                    -*-C++-*-
+#include <bslma_typedarenaallocator.h>
+
+#include <bslma_allocator.h>
+#include <bslma_allocatortraits.h>
+#include <bslma_bslallocator.h>
+#include <bslma_default.h>
+#include <bslma_isstdallocator.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_issame.h>
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bsls_alignedbuffer.h>
+#include <bsls_alignmentutil.h>
+#include <bsls_asserttest.h>
+#include <bsls_bslexceptionutil.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_keyword.h>
+#include <bsls_stopwatch.h>
+
+#include <new>          // `bad_alloc`
+
+#include <stdio.h>      // `printf`
+#include <stdlib.h>     // `atoi`
+
+// These warning suppressions will be eliminated in due course.
+// BDE_VERIFY pragma: -FD01  // Test-machinery lacks a contract
+// BDE_VERIFY pragma: -TP18  // Test-case banners are ALL-CAPS
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is an STL allocator, derived from `bsl::allocator`,
+// that forwards allocation requests to an arena of a known concrete type by a
+// non-virtual call.  The tests use a simple bump-pointer arena that counts its
+// allocations and deallocations, and a derived arena that overrides
+// `allocate`, to observe that allocation is dispatched statically.  We also
+// verify that the allocator interoperates with `bsl::allocator_traits` and
+// `bsl::allocator`, and that it propagates itself to allocator-aware
+// elements.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] TypedArenaAllocator(ARENA *arena);
+// [ 2] TypedArenaAllocator(const TypedArenaAllocator<ARENA, ANY>& o);
+//
+// MANIPULATORS
+// [ 3] pointer allocate(size_type n, const void *hint = 0);
+// [ 3] void deallocate(TYPE *p, std::size_t n = 1);
+//
+// ACCESSORS
+// [ 2] ARENA *arena() const;
+// [ 4] TypedArenaAllocator select_on_container_copy_construction() const;
+//
+// FREE OPERATORS
+// [ 2] bool operator==(const TypedArenaAllocator<A, T1>&, ...<A, T2>&);
+// [ 2] bool operator!=(const TypedArenaAllocator<A, T1>&, ...<A, T2>&);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [ 2] CONCERN: `rebind` and `IsStdAllocator`
+// [ 3] CONCERN: allocation is not dispatched virtually
+// [ 4] CONCERN: `construct` propagates the arena to AA elements
+// [-1] PERFORMANCE: `TypedArenaAllocator` vs. `bsl::allocator`
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+        fflush(stdout);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+#define ASSERT_SAFE_PASS_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS_RAW(EXPR)
+#define ASSERT_SAFE_FAIL_RAW(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL_RAW(EXPR)
+#define ASSERT_PASS_RAW(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS_RAW(EXPR)
+#define ASSERT_FAIL_RAW(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL_RAW(EXPR)
+#define ASSERT_OPT_PASS_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS_RAW(EXPR)
+#define ASSERT_OPT_FAIL_RAW(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL_RAW(EXPR)
+
+//=============================================================================
+//             GLOBAL HELPER CLASSES AND FUNCTIONS FOR TESTING
+//-----------------------------------------------------------------------------
+
+                              // ===============
+                              // class TestArena
+                              // ===============
+
+/// This class provides a bump-pointer arena over a caller-supplied buffer,
+/// whose `allocate` method is defined inline, and which counts the calls to
+/// `allocate` and `deallocate` (by non-virtual and virtual dispatch alike).
+class TestArena : public bslma::Allocator {
+
+    // DATA
+    char *d_begin_p;           // start of the buffer
+    char *d_cursor_p;          // next free byte
+    char *d_end_p;             // end of the buffer
+    int   d_numAllocations;    // number of calls to `allocate`
+    int   d_numDeallocations;  // number of calls to `deallocate`
+
+  public:
+    // CREATORS
+
+    /// Create an arena that dispenses memory from the specified `buffer` of
+    /// the specified `size`.
+    TestArena(char *buffer, size_type size)
+    : d_begin_p(buffer)
+    , d_cursor_p(buffer)
+    , d_end_p(buffer + size)
+    , d_numAllocations(0)
+    , d_numDeallocations(0)
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Return a maximally-aligned block of the specified `size` from the
+    /// buffer, or 0 if `size` is 0.  Throw `bsl::bad_alloc` if the buffer
+    /// is exhausted.
+    void *allocate(size_type size) BSLS_KEYWORD_OVERRIDE
+    {
+        ++d_numAllocations;
+        if (0 == size) {
+            return 0;                                                 // RETURN
+        }
+        const int offset = bsls::AlignmentUtil::calculateAlignmentOffset(
+                                      d_cursor_p,
+                                      bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+        if (static_cast<size_type>(d_end_p - d_cursor_p) < offset + size) {
+            bsls::BslExceptionUtil::throwBadAlloc();
+        }
+        void *result  = d_cursor_p + offset;
+        d_cursor_p   += offset + size;
+        return result;
+    }
+
+    /// Count this call; the memory is not reclaimed until `rewind`.
+    void deallocate(void *) BSLS_KEYWORD_OVERRIDE
+    {
+        ++d_numDeallocations;
+    }
+
+    /// Make the whole buffer available again.
+    void rewind()
+    {
+        d_cursor_p = d_begin_p;
+    }
+
+    // ACCESSORS
+
+    /// Return the number of calls to `allocate`.
+    int numAllocations() const
+    {
+        return d_numAllocations;
+    }
+
+    /// Return the number of calls to `deallocate`.
+    int numDeallocations() const
+    {
+        return d_numDeallocations;
+    }
+
+    /// Return the number of bytes dispensed since construction or the last
+    /// call to `rewind`, including alignment padding.
+    size_type numBytesInUse() const
+    {
+        return d_cursor_p - d_begin_p;
+    }
+};
+
+                           // =====================
+                           // class OverridingArena
+                           // =====================
+
+/// This class derives from `TestArena` and overrides `allocate`, so that
+/// virtual and non-virtual calls to `allocate` are distinguishable.
+class OverridingArena : public TestArena {
+
+    // DATA
+    int d_numOverriddenCalls;  // number of calls to this class's `allocate`
+
+  public:
+    // CREATORS
+
+    /// Create an arena that dispenses memory from the specified `buffer` of
+    /// the specified `size`.
+    OverridingArena(char *buffer, size_type size)
+    : TestArena(buffer, size)
+    , d_numOverriddenCalls(0)
+    {
+    }
+
+    // MANIPULATORS
+
+    /// Count this call and forward to `TestArena::allocate` with the
+    /// specified `size`.
+    void *allocate(size_type size) BSLS_KEYWORD_OVERRIDE
+    {
+        ++d_numOverriddenCalls;
+        return TestArena::allocate(size);
+    }
+
+    // ACCESSORS
+
+    /// Return the number of calls to this class's `allocate`.
+    int numOverriddenCalls() const
+    {
+        return d_numOverriddenCalls;
+    }
+};
+
+                           // ==================
+                           // class LegacyAAType
+                           // ==================
+
+/// This class records the allocator supplied on construction.
+class LegacyAAType {
+
+    // DATA
+    int               d_value;        // arbitrary value
+    bslma::Allocator *d_allocator_p;  // supplied allocator
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(LegacyAAType, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+
+    /// Create an object having the specified `value`.  Optionally specify a
+    /// `basicAllocator`, which is recorded.
+    explicit LegacyAAType(int value, bslma::Allocator *basicAllocator = 0)
+    : d_value(value)
+    , d_allocator_p(basicAllocator)
+    {
+    }
+
+    // ACCESSORS
+
+    /// Return the allocator supplied on construction (or 0).
+    bslma::Allocator *allocator() const
+    {
+        return d_allocator_p;
+    }
+
+    /// Return the value of this object.
+    int value() const
+    {
+        return d_value;
+    }
+};
+
+//=============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+//-----------------------------------------------------------------------------
+
+typedef bslma::TypedArenaAllocator<TestArena, int>    Obj;
+typedef bslma::TypedArenaAllocator<TestArena, double> DObj;
+
+typedef bsl::allocator_traits<Obj> Traits;
+
+enum { k_BUFFER_SIZE = 4096 };
+
+//=============================================================================
+//                               USAGE EXAMPLE
+//-----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE_1 {
+
+///Example 1: Allocating From an Arena Without Virtual Dispatch
+/// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose we have an arena, `my_BumpArena`, that dispenses memory from a
+// fixed buffer and whose `allocate` method is defined inline (in practice we
+// would use one of the sequential allocators from `bdlma`):
+// ```
+    class my_BumpArena : public bslma::Allocator {
+        // DATA
+        char *d_cursor_p;        // next free byte
+        char *d_end_p;           // end of the buffer
+        int   d_numAllocations;  // number of calls to `allocate`
+
+      public:
+        // CREATORS
+        my_BumpArena(char *buffer, size_type size)
+        : d_cursor_p(buffer)
+        , d_end_p(buffer + size)
+        , d_numAllocations(0)
+        {
+        }
+
+        // MANIPULATORS
+        void *allocate(size_type size) BSLS_KEYWORD_OVERRIDE
+        {
+            ++d_numAllocations;
+            size_type offset = bsls::AlignmentUtil::calculateAlignmentOffset(
+                                   d_cursor_p,
+                                   bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+            if (static_cast<size_type>(d_end_p - d_cursor_p) <
+                                                             offset + size) {
+                bsls::BslExceptionUtil::throwBadAlloc();
+            }
+            void *result = d_cursor_p + offset;
+            d_cursor_p  += offset + size;
+            return result;
+        }
+
+        void deallocate(void *) BSLS_KEYWORD_OVERRIDE
+        {
+        }
+
+        // ACCESSORS
+        int numAllocations() const { return d_numAllocations; }
+    };
+// ```
+
+}  // close namespace USAGE_EXAMPLE_1
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;           // suppress unused variable warning
+    (void)veryVeryVerbose;       // suppress unused variable warning
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+        using namespace USAGE_EXAMPLE_1;
+
+// Then, we create an arena over a local buffer, and an allocator for `int`
+// objects bound to the arena's concrete type:
+// ```
+    bsls::AlignedBuffer<1024> buffer;
+    my_BumpArena              arena(buffer.buffer(), sizeof buffer);
+
+    typedef bslma::TypedArenaAllocator<my_BumpArena, int> IntAllocator;
+    typedef bsl::allocator_traits<IntAllocator>           IntTraits;
+
+    IntAllocator intAllocator(&arena);
+    ASSERT(&arena == intAllocator.arena());
+    ASSERT(&arena == intAllocator.mechanism());
+// ```
+// Next, we allocate memory in the way a container would, through
+// `bsl::allocator_traits`.  The call to `my_BumpArena::allocate` is
+// non-virtual, and the compiler is free to inline it:
+// ```
+    int *values = IntTraits::allocate(intAllocator, 4);
+    for (int i = 0; i < 4; ++i) {
+        IntTraits::construct(intAllocator, values + i, i * i);
+    }
+    ASSERT(9 == values[3]);
+    ASSERT(1 == arena.numAllocations());
+// ```
+// Then, we observe that the allocator rebinds to other element types (as a
+// node-based container would require), still using the same arena:
+// ```
+    typedef IntAllocator::rebind<double>::other DoubleAllocator;
+
+    DoubleAllocator doubleAllocator(intAllocator);
+    double *d = bsl::allocator_traits<DoubleAllocator>::allocate(
+                                                               doubleAllocator,
+                                                               1);
+    ASSERT(2 == arena.numAllocations());
+    ASSERT(doubleAllocator == intAllocator);
+// ```
+// Finally, we note that the allocator converts to `bsl::allocator<int>`, so
+// that it can be passed to interfaces expecting one (using the ordinary,
+// virtually-dispatched allocation path):
+// ```
+    bsl::allocator<int> generic = intAllocator;
+    ASSERT(&arena == generic.mechanism());
+
+    bsl::allocator_traits<DoubleAllocator>::deallocate(doubleAllocator, d, 1);
+    IntTraits::deallocate(intAllocator, values, 4);
+// ```
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // `construct` AND `select_on_container_copy_construction`
+        //
+        // Concerns:
+        // 1. Constructing an allocator-aware element through
+        //    `bsl::allocator_traits` supplies the arena to the element.
+        //
+        // 2. Constructing a non-AA element forwards the arguments unchanged.
+        //
+        // 3. `select_on_container_copy_construction`, called directly or
+        //    through `bsl::allocator_traits`, returns an allocator using the
+        //    same arena (and not the default allocator).
+        //
+        // 4. The default allocator is not used.
+        //
+        // Plan:
+        // 1. Construct `LegacyAAType` and `int` elements via
+        //    `bsl::allocator_traits` and verify their values and recorded
+        //    allocators.  (C-1..2)
+        //
+        // 2. Invoke `select_on_container_copy_construction` and compare the
+        //    result to the original.  (C-3)
+        //
+        // 3. Verify that the default allocator is unused.  (C-4)
+        //
+        // Testing:
+        //   TypedArenaAllocator select_on_container_copy_construction() const;
+        //   CONCERN: `construct` propagates the arena to AA elements
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                   "\n`construct` AND `select_on_container_copy_construction`"
+                   "\n======================================================="
+                   "\n");
+
+        bsls::AlignedBuffer<k_BUFFER_SIZE> buffer;
+        TestArena                          arena(buffer.buffer(),
+                                                 k_BUFFER_SIZE);
+
+        typedef bslma::TypedArenaAllocator<TestArena, LegacyAAType> LObj;
+        typedef bsl::allocator_traits<LObj>                         LTraits;
+
+        LObj mX(&arena);  const LObj& X = mX;
+
+        if (verbose) printf("\tAA element.\n");
+        {
+            LegacyAAType *p = LTraits::allocate(mX, 1);
+            LTraits::construct(mX, p, 5);
+            ASSERT(5 == p->value());
+            ASSERT(&arena == p->allocator());
+            LTraits::destroy(mX, p);
+            LTraits::deallocate(mX, p, 1);
+        }
+
+        if (verbose) printf("\tNon-AA element.\n");
+        {
+            Obj  mY(X);
+            int *p = Traits::allocate(mY, 1);
+            Traits::construct(mY, p, 17);
+            ASSERT(17 == *p);
+            Traits::deallocate(mY, p, 1);
+        }
+
+        if (verbose) printf("\t`select_on_container_copy_construction`.\n");
+        {
+            const LObj C1 = X.select_on_container_copy_construction();
+            const LObj C2 = LTraits::select_on_container_copy_construction(X);
+
+            ASSERT(&arena == C1.arena());
+            ASSERT(&arena == C2.arena());
+            ASSERT(X == C1);
+            ASSERT(X == C2);
+        }
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // `allocate` AND `deallocate`
+        //
+        // Concerns:
+        // 1. `allocate(n)` obtains exactly one block of `n * sizeof(TYPE)`
+        //    bytes from the arena, suitably aligned for `TYPE`.
+        //
+        // 2. `allocate` invokes `ARENA::allocate` by a non-virtual call, even
+        //    if the arena's dynamic type overrides `allocate`.
+        //
+        // 3. `deallocate` returns the block to the arena (by the ordinary,
+        //    virtually-dispatched path).
+        //
+        // 4. `allocate` and `deallocate` behave the same when called through
+        //    `bsl::allocator_traits`, and when the allocator is converted to
+        //    `bsl::allocator`, allocation is dispatched virtually.
+        //
+        // 5. `allocate` throws `bsl::bad_alloc` if `max_size() < n`.
+        //
+        // Plan:
+        // 1. Allocate blocks of various sizes and types from a `TestArena`,
+        //    verifying the arena's counters, bytes in use, and alignment.
+        //    (C-1, 3..4)
+        //
+        // 2. Allocate from an `OverridingArena` through a
+        //    `TypedArenaAllocator<TestArena, int>`, and verify that the
+        //    overriding `allocate` is not invoked; then allocate through a
+        //    `bsl::allocator<int>` converted from the same allocator and
+        //    verify that it is.  (C-2, 4)
+        //
+        // 3. In exception-enabled builds, request `max_size() + 1` objects and
+        //    verify that `bsl::bad_alloc` is thrown without calling the
+        //    arena.  (C-5)
+        //
+        // Testing:
+        //   pointer allocate(size_type n, const void *hint = 0);
+        //   void deallocate(TYPE *p, std::size_t n = 1);
+        //   CONCERN: allocation is not dispatched virtually
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n`allocate` AND `deallocate`"
+                            "\n===========================\n");
+
+        if (verbose) printf("\tSizes and alignment.\n");
+        {
+            bsls::AlignedBuffer<k_BUFFER_SIZE> buffer;
+            TestArena                          arena(buffer.buffer(),
+                                                     k_BUFFER_SIZE);
+
+            Obj  mX(&arena);
+            DObj mD(mX);
+
+            for (int n = 1; n <= 8; ++n) {
+                const bslma::Allocator::size_type BEFORE =
+                                                         arena.numBytesInUse();
+
+                int *p = mX.allocate(n);
+                ASSERTV(n, 0 != p);
+                ASSERTV(n, 0 == reinterpret_cast<bsls::Types::UintPtr>(p)
+                                                               % sizeof(int));
+                ASSERTV(n, n == arena.numAllocations());
+                ASSERTV(n, BEFORE + n * sizeof(int) <= arena.numBytesInUse());
+
+                for (int i = 0; i < n; ++i) {
+                    p[i] = i;
+                }
+                mX.deallocate(p, n);
+                ASSERTV(n, n == arena.numDeallocations());
+            }
+
+            double *d = Traits::rebind_traits<double>::allocate(mD, 3);
+            ASSERT(0 == reinterpret_cast<bsls::Types::UintPtr>(d)
+                                                     % sizeof(double));
+            ASSERT(9 == arena.numAllocations());
+            Traits::rebind_traits<double>::deallocate(mD, d, 3);
+            ASSERT(9 == arena.numDeallocations());
+        }
+
+        if (verbose) printf("\tStatic dispatch.\n");
+        {
+            bsls::AlignedBuffer<k_BUFFER_SIZE> buffer;
+            OverridingArena                    arena(buffer.buffer(),
+                                                     k_BUFFER_SIZE);
+
+            Obj mX(&arena);
+
+            int *p = mX.allocate(2);
+            int *q = Traits::allocate(mX, 2);
+            ASSERT(2 == arena.numAllocations());
+            ASSERT(0 == arena.numOverriddenCalls());
+
+            bsl::allocator<int> mB(mX);
+            int *r = mB.allocate(2);
+            ASSERT(3 == arena.numAllocations());
+            ASSERT(1 == arena.numOverriddenCalls());
+
+            mB.deallocate(r, 2);
+            Traits::deallocate(mX, q, 2);
+            mX.deallocate(p, 2);
+            ASSERT(3 == arena.numDeallocations());
+        }
+
+#ifdef BDE_BUILD_TARGET_EXC
+        if (verbose) printf("\tExcessive requests.\n");
+        {
+            bsls::AlignedBuffer<k_BUFFER_SIZE> buffer;
+            TestArena                          arena(buffer.buffer(),
+                                                     k_BUFFER_SIZE);
+
+            Obj  mX(&arena);
+            bool caught = false;
+            try {
+                int *p = mX.allocate(mX.max_size() + 1);
+                (void)p;
+            }
+            catch (const std::bad_alloc&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(0 == arena.numAllocations());
+        }
+#endif
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, `arena`, AND EQUALITY
+        //
+        // Concerns:
+        // 1. An allocator constructed from an arena refers to that arena,
+        //    both through `arena` and the inherited `mechanism`.
+        //
+        // 2. An allocator can be implicitly converted from an arena address.
+        //
+        // 3. Copying an allocator, or converting it to another element type,
+        //    yields an allocator that refers to the same arena and compares
+        //    equal to the original.
+        //
+        // 4. Allocators referring to distinct arenas compare unequal.
+        //
+        // 5. `rebind<U>::other` is `TypedArenaAllocator<ARENA, U>`, and the
+        //    allocator is recognized as an allocator by `IsStdAllocator`.
+        //
+        // 6. The allocator is the size of `bsl::allocator`.
+        //
+        // 7. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Create allocators from two arenas, copy and convert them, and
+        //    verify `arena`, `mechanism`, `==`, and `!=`.  (C-1..4)
+        //
+        // 2. Verify the type relationships at compile time and run time.
+        //    (C-5..6)
+        //
+        // 3. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for a null arena.  (C-7)
+        //
+        // Testing:
+        //   TypedArenaAllocator(ARENA *arena);
+        //   TypedArenaAllocator(const TypedArenaAllocator<ARENA, ANY>& o);
+        //   ARENA *arena() const;
+        //   bool operator==(const TypedArenaAllocator<A, T1>&, ...<A, T2>&);
+        //   bool operator!=(const TypedArenaAllocator<A, T1>&, ...<A, T2>&);
+        //   CONCERN: `rebind` and `IsStdAllocator`
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCREATORS, `arena`, AND EQUALITY"
+                            "\n===============================\n");
+
+        bsls::AlignedBuffer<k_BUFFER_SIZE> buffer1;
+        bsls::AlignedBuffer<k_BUFFER_SIZE> buffer2;
+        TestArena                          arena1(buffer1.buffer(),
+                                                  k_BUFFER_SIZE);
+        TestArena                          arena2(buffer2.buffer(),
+                                                  k_BUFFER_SIZE);
+
+        const Obj X(&arena1);
+        const Obj Y = &arena2;
+
+        ASSERT(&arena1 == X.arena());
+        ASSERT(&arena1 == X.mechanism());
+        ASSERT(&arena2 == Y.arena());
+
+        const Obj  XC(X);
+        const DObj XD(X);
+        const Obj  XDX(XD);
+
+        ASSERT(&arena1 == XC.arena());
+        ASSERT(&arena1 == XD.arena());
+        ASSERT(&arena1 == XDX.arena());
+
+        ASSERT(  X == XC);
+        ASSERT(  X == XD);
+        ASSERT(  XD == XDX);
+        ASSERT(!(X != XD));
+        ASSERT(  X != Y);
+        ASSERT(!(X == Y));
+        ASSERT(  XD != Y);
+
+        ASSERT((bsl::is_same<Obj::rebind<double>::other, DObj>::value));
+        ASSERT((bsl::is_same<Obj::arena_type, TestArena>::value));
+        ASSERT((bsl::is_same<Obj::value_type, int>::value));
+        ASSERT((bslma::IsStdAllocator<Obj>::value));
+        ASSERT((bslma::IsStdAllocator<DObj>::value));
+        ASSERT(sizeof(Obj) == sizeof(bsl::allocator<int>));
+
+        if (verbose) printf("\tNegative testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ASSERT_FAIL((void)Obj(static_cast<TestArena *>(0)));
+            ASSERT_PASS((void)Obj(&arena1));
+        }
+
+        ASSERT(0 == arena1.numAllocations());
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Allocate, construct, destroy, and deallocate a few objects using
+        //    an allocator bound to a `TestArena`.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        bsls::AlignedBuffer<k_BUFFER_SIZE> buffer;
+        TestArena                          arena(buffer.buffer(),
+                                                 k_BUFFER_SIZE);
+
+        Obj mX(&arena);
+
+        int *p = Traits::allocate(mX, 10);
+        for (int i = 0; i < 10; ++i) {
+            Traits::construct(mX, p + i, i);
+        }
+        ASSERT(9 == p[9]);
+        ASSERT(1 == arena.numAllocations());
+
+        for (int i = 0; i < 10; ++i) {
+            Traits::destroy(mX, p + i);
+        }
+        Traits::deallocate(mX, p, 10);
+        ASSERT(1 == arena.numDeallocations());
+
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: `TypedArenaAllocator` vs. `bsl::allocator`
+        //
+        // Concerns:
+        // 1. Allocating from an arena through a `TypedArenaAllocator` is
+        //    faster than through a `bsl::allocator` referring to the same
+        //    arena.
+        //
+        // Plan:
+        // 1. Time a loop that repeatedly allocates a batch of small blocks
+        //    from a `TestArena` (rewinding the arena between batches) first
+        //    through `bsl::allocator<int>` and then through
+        //    `TypedArenaAllocator<TestArena, int>`, and report the average
+        //    time per allocation.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: `TypedArenaAllocator` vs. `bsl::allocator`
+        // --------------------------------------------------------------------
+
+        if (verbose) printf(
+                   "\nPERFORMANCE: `TypedArenaAllocator` vs. `bsl::allocator`"
+                   "\n======================================================="
+                   "\n");
+
+        enum { k_BATCH = 64, k_NUM_ITERATIONS = 200000 };
+
+        const int numIterations = argc > 2 ? atoi(argv[2]) : k_NUM_ITERATIONS;
+
+        bsls::AlignedBuffer<k_BUFFER_SIZE> buffer;
+        TestArena                          arena(buffer.buffer(),
+                                                 k_BUFFER_SIZE);
+
+        int            *blocks[k_BATCH];
+        bsls::Stopwatch timer;
+        double          times[2];
+
+        for (int pass = 0; pass < 2; ++pass) {
+            bsl::allocator<int> generic(&arena);
+            Obj                 typed(&arena);
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < numIterations; ++i) {
+                arena.rewind();
+                for (int j = 0; j < k_BATCH; ++j) {
+                    blocks[j] = 0 == pass ? generic.allocate(1 + j % 4)
+                                          : typed.allocate(1 + j % 4);
+                }
+                ASSERT(blocks[k_BATCH - 1]);
+            }
+            timer.stop();
+            times[pass] = timer.elapsedTime();
+        }
+
+        const double numOps = static_cast<double>(numIterations) * k_BATCH;
+        printf("bsl::allocator:      %8.2f ns/allocation\n",
+               times[0] / numOps * 1.0e9);
+        printf("TypedArenaAllocator: %8.2f ns/allocation\n",
+               times[1] / numOps * 1.0e9);
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -17,7 +17,9 @@ BSLS_IDENT("$Id$ $CSID$")
 // elements within the first block.  The 'd_finish' iterator points to the last
 // used slot in 'd_blocks_p' and one past the last used element within the last
 // block.  'd_blocksLength' holds the length of 'd_blocks_p', including unused
-// slots.
+// slots.  'd_spareBlock_p' holds the most recently emptied block, if any: it
+// is owned by the deque, but referenced by no slot of 'd_blocks_p', and is
+// reused by the next allocation of a block.
 //..
 //   a-n : current elements in the deque
 //   _   : uninitialized/destructed elements
@@ -84,6 +86,8 @@ BSLS_IDENT("$Id$ $CSID$")
 //   - Once one or more blocks are allocated and 'd_start' and 'd_finish'
 //     set to point into those blocks, the deque is no longer raw and must
 //     adhere to the normal deque invariants, above.
+//   - A raw deque may own a spare block, in 'd_spareBlock_p', which is
+//     released by its destructor.
 //   - Raw deques can be destructed and can be used with certain internal
 //     operations, but must never be visible to the user.
 //..
@@ -118,6 +122,7 @@ struct Deque_Imp {
     std::size_t  d_blocksLength;  // length of 'd_blocks_p' array
     IteratorImp  d_start;         // iterator to first element
     IteratorImp  d_finish;        // iterator to one past last element
+    void        *d_spareBlock_p;  // emptied block kept for reuse, or 0
 };
 
 // CLASS METHODS
@@ -133,8 +138,10 @@ void Deque_Util::move(void *dst, void *src)
     dstDeque.d_blocksLength = srcDeque.d_blocksLength;
     dstDeque.d_start        = srcDeque.d_start;
     dstDeque.d_finish       = srcDeque.d_finish;
+    dstDeque.d_spareBlock_p = srcDeque.d_spareBlock_p;
 
     srcDeque.d_blocks_p     = 0;  // put 'src' into a raw state
+    srcDeque.d_spareBlock_p = 0;
 }
 
 void Deque_Util::swap(void *a, void *b)
@@ -150,16 +157,19 @@ void Deque_Util::swap(void *a, void *b)
     temp.d_blocksLength   = bDeque.d_blocksLength;
     temp.d_start          = bDeque.d_start;
     temp.d_finish         = bDeque.d_finish;
+    temp.d_spareBlock_p   = bDeque.d_spareBlock_p;
 
     bDeque.d_blocks_p     = aDeque.d_blocks_p;
     bDeque.d_blocksLength = aDeque.d_blocksLength;
     bDeque.d_start        = aDeque.d_start;
     bDeque.d_finish       = aDeque.d_finish;
+    bDeque.d_spareBlock_p = aDeque.d_spareBlock_p;
 
     aDeque.d_blocks_p     = temp.d_blocks_p;
     aDeque.d_blocksLength = temp.d_blocksLength;
     aDeque.d_start        = temp.d_start;
     aDeque.d_finish       = temp.d_finish;
+    aDeque.d_spareBlock_p = temp.d_spareBlock_p;
 }
 
 }  // close namespace bsl
@@ -9,6 +9,7 @@ BSLS_IDENT("$Id: $")
 //
 //@CLASSES:
 //  bsl::deque: STL-compliant deque template
+//  bslstl::DequeBlockSize: customization point for the deque block size
 //
 //@CANONICAL_HEADER: bsl_deque.h
 //
@@ -127,6 +128,38 @@ BSLS_IDENT("$Id: $")
 // of the (template parameter) `VALUE_TYPE` if it defines the
 // `bslma::UsesBslmaAllocator` trait.
 //
+///Blocks and Block Recycling
+/// - - - - - - - - - - - - -
+// A deque stores its elements in fixed-size blocks, allocated as elements are
+// added at either end, and released as the blocks they occupy are emptied.
+// By default a block occupies about 200 bytes (and holds at least 16
+// elements).  The block size used for a given `VALUE_TYPE` can be configured
+// by specializing the `bslstl::DequeBlockSize` class template, whose `value`
+// member is the targeted number of bytes per block, before any deque of that
+// type is instantiated.  For example, the following specialization makes
+// deques of `MyMessage` objects use 4096-byte blocks:
+// ```
+// namespace BloombergLP {
+// namespace bslstl {
+//
+// template <>
+// struct DequeBlockSize<MyMessage> {
+//     enum { value = 4096 };
+// };
+//
+// }  // close package namespace
+// }  // close enterprise namespace
+// ```
+// Larger blocks mean fewer allocations and better locality for large queues,
+// at the price of more unused memory for small ones.
+//
+// In addition, a deque keeps the most recently emptied block, instead of
+// returning it to the allocator, and uses it for the next block it needs.
+// Hence a deque used as a FIFO queue (pushing at one end and popping at the
+// other) whose length stays bounded makes no allocator calls once it has
+// reached its steady state.  The cached block is released by
+// `shrink_to_fit` and by the destructor.
+//
 ///Operations
 ///----------
 // This section describes the run-time complexity of operations on instances
@@ -447,6 +480,31 @@ BSLS_IDENT("$Id: $")
 #include <stdexcept>
 #endif
 
+namespace BloombergLP {
+namespace bslstl {
+
+                           // =====================
+                           // struct DequeBlockSize
+                           // =====================
+
+/// This class template provides, as its `value` member, the targeted number
+/// of bytes per block of a `bsl::deque` of the (template parameter)
+/// `VALUE_TYPE`.  Clients can specialize this template to change the block
+/// size used for a particular type; a specialization must be visible before
+/// any deque of that type is instantiated.  Note that a block always holds
+/// at least 16 elements, whatever the configured size.
+template <class VALUE_TYPE>
+struct DequeBlockSize {
+
+    // TYPES
+    enum {
+        value = 200  // default number of bytes per block
+    };
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
 #if BSLS_COMPILERFEATURES_SIMULATE_CPP11_FEATURES
 // clang-format off
 // Include version that can be compiled with C++03
@@ -476,14 +534,17 @@ class Deque_Guard;
                        // ================================
 
 /// This `struct` provides a namespace for the calculation of block length
-/// (the number of elements per block within a `deque`).  This ensures that
-/// each block in the deque can hold at least 16 elements.
+/// (the number of elements per block within a `deque`) from the block size
+/// configured by `bslstl::DequeBlockSize`.  This ensures that each block in
+/// the deque can hold at least 16 elements.
 template <class VALUE_TYPE>
 struct Deque_BlockLengthCalcUtil {
 
     // TYPES
     enum {
-        DEFAULT_BLOCK_SIZE = 200,  // number of bytes per block
+        DEFAULT_BLOCK_SIZE = BloombergLP::bslstl::DequeBlockSize<
+                                                           VALUE_TYPE>::value,
+                                   // number of bytes per block
 
         BLOCK_LENGTH       = (16 * sizeof(VALUE_TYPE) >= DEFAULT_BLOCK_SIZE)
                              ? 16
@@ -573,6 +634,8 @@ class Deque_Base {
     std::size_t  d_blocksLength;  // length of 'd_blocks_p' array
     IteratorImp  d_start;         // iterator to first element
     IteratorImp  d_finish;        // iterator to one past last element
+    Block       *d_spareBlock_p;  // emptied block kept for reuse, or 0
+                                  // (owned)
 
   public:
     // MANIPULATORS
@@ -809,8 +872,9 @@ class deque : public  Deque_Base<VALUE_TYPE>
 
     // PRIVATE MANIPULATORS
 
-    /// Return one block allocated from this object's allocator.  Note that
-    /// the block is not initialized.
+    /// Return one block, taken from the spare-block cache of this object if
+    /// it is not empty, and allocated from this object's allocator
+    /// otherwise.  Note that the block is not initialized.
     Block *allocateBlock();
 
     /// Allocate an array having the specified `n` elements of type
@@ -818,9 +882,10 @@ class deque : public  Deque_Base<VALUE_TYPE>
     /// elements are not initialized.
     BlockPtr *allocateBlockPtrs(std::size_t n);
 
-    /// Deallocate from this object's allocator the block at the specified
-    /// `p` address.  Note that this function does not call any destructors
-    /// on `p` or `*p`.
+    /// Keep the block at the specified `p` address in the spare-block cache
+    /// of this object if the cache is empty, and deallocate it from this
+    /// object's allocator otherwise.  Note that this function does not call
+    /// any destructors on `p` or `*p`.
     void deallocateBlock(Block *p);
 
     /// Deallocate from this object's allocator an array at the specified
@@ -829,6 +894,10 @@ class deque : public  Deque_Base<VALUE_TYPE>
     /// then that block is not deallocated (and might be leaked).
     void deallocateBlockPtrs(BlockPtr *p, std::size_t n);
 
+    /// Deallocate from this object's allocator the block held in the
+    /// spare-block cache of this object, if any, and empty the cache.
+    void releaseSpareBlock();
+
     /// Append the elements in the range specified by `[first .. last)` to
     /// this deque, and return the number of elements appended.  The third
     /// argument is used for overload resolution.  The behavior is undefined
@@ -1186,8 +1255,9 @@ class deque : public  Deque_Base<VALUE_TYPE>
     void resize(size_type newSize, const VALUE_TYPE& value);
 
     /// Minimize the memory used by this deque to the extent possible
-    /// without moving any contained elements.  If an exception is thrown,
-    /// the value of this object is unchanged.  Note that this method has no
+    /// without moving any contained elements, releasing, in particular, the
+    /// spare block kept for reuse, if any.  If an exception is thrown, the
+    /// value of this object is unchanged.  Note that this method has no
     /// effect on the memory used by individual elements of the (template
     /// parameter) `VALUE_TYPE`.
     void shrink_to_fit();
@@ -2120,7 +2190,8 @@ deque<VALUE_TYPE, ALLOCATOR>::deque(RawInit, const ALLOCATOR& allocator)
 : Deque_Base<VALUE_TYPE>()
 , ContainerBase(allocator)
 {
-    this->d_blocks_p = 0;
+    this->d_blocks_p     = 0;
+    this->d_spareBlock_p = 0;
 }
 
 // PRIVATE MANIPULATORS
@@ -2129,6 +2200,11 @@ inline
 typename deque<VALUE_TYPE, ALLOCATOR>::Block *
 deque<VALUE_TYPE, ALLOCATOR>::allocateBlock()
 {
+    Block *block = this->d_spareBlock_p;
+    if (block) {
+        this->d_spareBlock_p = 0;
+        return block;                                                 // RETURN
+    }
     return AllocatorUtil::allocateObject<Block>(this->allocatorRef());
 }
 
@@ -2144,6 +2220,14 @@ template <class VALUE_TYPE, class ALLOCATOR>
 inline
 void deque<VALUE_TYPE, ALLOCATOR>::deallocateBlock(Block *p)
 {
+    // Keeping one emptied block is enough for a deque used as a FIFO queue,
+    // whose blocks are emptied at the front as fast as they are needed at
+    // the back, to reach a steady state free of allocator calls.
+
+    if (0 == this->d_spareBlock_p) {
+        this->d_spareBlock_p = p;
+        return;                                                       // RETURN
+    }
     AllocatorUtil::deallocateObject(this->allocatorRef(), p);
 }
 
@@ -2155,6 +2239,17 @@ deque<VALUE_TYPE, ALLOCATOR>::deallocateBlockPtrs(BlockPtr *p, std::size_t n)
     AllocatorUtil::deallocateObject(this->allocatorRef(), p, n);
 }
 
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+void deque<VALUE_TYPE, ALLOCATOR>::releaseSpareBlock()
+{
+    if (this->d_spareBlock_p) {
+        AllocatorUtil::deallocateObject(this->allocatorRef(),
+                                        this->d_spareBlock_p);
+        this->d_spareBlock_p = 0;
+    }
+}
+
 template <class VALUE_TYPE, class ALLOCATOR>
 template <class INPUT_ITERATOR>
 typename deque<VALUE_TYPE, ALLOCATOR>::size_type
@@ -2944,8 +3039,9 @@ template <class VALUE_TYPE, class ALLOCATOR>
 deque<VALUE_TYPE, ALLOCATOR>::~deque()
 {
     if (0 == this->d_blocks_p) {
-        // Nothing to do when destroying raw deques.
+        // Raw deques own no blocks, except, possibly, a spare one.
 
+        releaseSpareBlock();
         return;                                                       // RETURN
     }
 
@@ -2957,7 +3053,8 @@ deque<VALUE_TYPE, ALLOCATOR>::~deque()
         this->deallocateBlock(*this->d_start.blockPtr());
     }
 
-    // Deallocate the array of block pointers.
+    // Deallocate the spare block and the array of block pointers.
+    releaseSpareBlock();
     this->deallocateBlockPtrs(this->d_blocks_p, this->d_blocksLength);
 }
 
@@ -3276,6 +3373,8 @@ void deque<VALUE_TYPE, ALLOCATOR>::shrink_to_fit()
     // complex algorithm is not justified.  At most 'BLOCK_LENGTH' bytes are
     // wasted.
 
+    releaseSpareBlock();
+
     const size_type newBlocksLength =
                       this->d_finish.blockPtr() - this->d_start.blockPtr() + 1;
 
@@ -238,6 +238,8 @@
 // [31] CONCERN: Methods qualified `noexcept` in standard are so implemented.
 // [32] CLASS TEMPLATE DEDUCTION GUIDES
 // [34] CONCERN: `deque` IS A C++20 RANGE
+// [36] CONCERN: emptied blocks are reused.
+// [36] bslstl::DequeBlockSize
 
 // ============================================================================
 //                     STANDARD BSL ASSERT TEST FUNCTION
@@ -1738,6 +1740,30 @@ struct PageLength<BCTT> {
                    : 0 };
 };
 
+                          // ======================
+                          // struct BigBlockElement
+                          // ======================
+
+/// This `struct` is an element type for which `bslstl::DequeBlockSize` is
+/// specialized (below) to configure a larger block size than the default.
+struct BigBlockElement {
+
+    // DATA
+    int d_value;
+};
+
+namespace BloombergLP {
+namespace bslstl {
+
+template <>
+struct DequeBlockSize<BigBlockElement> {
+
+    enum { value = 4096 };
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
 // ============================================================================
 //                            TEST APPARATUS
 // ----------------------------------------------------------------------------
@@ -10616,6 +10642,16 @@ void TestDriver<TYPE,ALLOC>::testCase13()
               LOOP_ASSERT(ti, 0   == X.size());
               LOOP_ASSERT(ti, CAP <= X.capacity());
 
+              // Appending more than `BS` elements to the new deque allocated
+              // a second block, which `clear` kept as a spare.  `clear` left
+              // `PAGE_LENGTH / 2` places before the finish position of its
+              // block, and the first block needed by `resize(NE)`, if any,
+              // takes the spare.
+
+              const bool HAS_SPARE = CAP > (size_t) BS
+                                  && NE  < (size_t) (PAGE_LENGTH -
+                                                     PAGE_LENGTH / 2);
+
               Int64 numBlocksBefore = oa.numBlocksInUse();
 
               oa.setAllocationLimit(AL);
@@ -10641,14 +10677,17 @@ void TestDriver<TYPE,ALLOC>::testCase13()
               numBlocksBefore = oa.numBlocksInUse();
 
               // This will add 1 block, but it will not reallocate `d_blocks`.
+              // The block is the spare block, if any, and is allocated
+              // otherwise.
 
               mX.resize(NE + PAGE_LENGTH);  // test here
 
               numBlocksAfter = oa.numBlocksInUse();
 
-              ASSERTV(NE, PAGE_LENGTH, numBlocksAfter, numBlocksAfter,
-                      numBlocksBefore, numBlocksAfter ==
-                         1 + PAGE_LENGTH * numAllocsPerItem + numBlocksBefore);
+              ASSERTV(NE, PAGE_LENGTH, HAS_SPARE, numBlocksAfter,
+                      numBlocksBefore,
+                      numBlocksAfter == (HAS_SPARE ? 0 : 1) +
+                             PAGE_LENGTH * numAllocsPerItem + numBlocksBefore);
 
               // Iterators not invalidated.
 
@@ -10713,6 +10752,16 @@ void TestDriver<TYPE,ALLOC>::testCase13()
               LOOP_ASSERT(ti, 0   == X.size());
               LOOP_ASSERT(ti, CAP <= X.capacity());
 
+              // Appending more than `BS` elements to the new deque allocated
+              // a second block, which `clear` kept as a spare.  `clear` left
+              // `PAGE_LENGTH / 2` places before the finish position of its
+              // block, and the first block needed by `resize(NE)`, if any,
+              // takes the spare.
+
+              const bool HAS_SPARE = CAP > (size_t) BS
+                                  && NE  < (size_t) (PAGE_LENGTH -
+                                                     PAGE_LENGTH / 2);
+
               Int64 numBlocksBefore = oa.numBlocksInUse();
 
               oa.setAllocationLimit(AL);
@@ -10738,14 +10787,17 @@ void TestDriver<TYPE,ALLOC>::testCase13()
               numBlocksBefore = oa.numBlocksInUse();
 
               // This will add 1 block, but it will not reallocate `d_blocks`.
+              // The block is the spare block, if any, and is allocated
+              // otherwise.
 
               mX.resize(NE + PAGE_LENGTH, TV);  // test here
 
               numBlocksAfter = oa.numBlocksInUse();
 
-              ASSERTV(NE, PAGE_LENGTH, numBlocksAfter,
-                      numBlocksBefore, numBlocksAfter ==
-                         1 + PAGE_LENGTH * numAllocsPerItem + numBlocksBefore);
+              ASSERTV(NE, PAGE_LENGTH, HAS_SPARE, numBlocksAfter,
+                      numBlocksBefore,
+                      numBlocksAfter == (HAS_SPARE ? 0 : 1) +
+                             PAGE_LENGTH * numAllocsPerItem + numBlocksBefore);
 
               // Iterators not invalidated.
 
@@ -14386,6 +14438,15 @@ void TestDriver<TYPE, ALLOC>::testCase2()
 
     const size_t MAX_LENGTH = 18;
 
+    // A default-constructed deque has one block, holding its start position
+    // after `FS` places, and followed by `BS` places.  Prepending more than
+    // `FS`, or appending more than `BS`, elements allocates a further block.
+
+    const size_t BLOCK_LENGTH =
+                            bsl::Deque_BlockLengthCalcUtil<TYPE>::BLOCK_LENGTH;
+    const size_t FS           = (BLOCK_LENGTH - 1) / 2;
+    const size_t BS           = BLOCK_LENGTH - 1 - FS;
+
     if (veryVerbose) printf("\n\tTest loop using `push_back`.\n");
     {
         for (size_t ti = 0; ti < MAX_LENGTH; ++ti) {
@@ -14484,6 +14545,13 @@ void TestDriver<TYPE, ALLOC>::testCase2()
                 {
                     const Int64 BB = oa.numBlocksTotal();
 
+                    // The block pointer array and one block remain, plus the
+                    // spare block kept for reuse if `clear` empties a second
+                    // block, which the `push_back` calls above allocated if
+                    // `LENGTH` exceeds `BS`.
+
+                    const Int64 EXP_A = LENGTH > BS ? 3 : 2;
+
                     mX.clear();
 
                     ASSERTV(LENGTH, CONFIG, 0          == X.size());
@@ -14493,7 +14561,7 @@ void TestDriver<TYPE, ALLOC>::testCase2()
                     const Int64 A  = oa.numBlocksInUse();
 
                     ASSERTV(LENGTH, CONFIG, BB == AA);
-                    ASSERTV(LENGTH, CONFIG, 2  == A);
+                    ASSERTV(LENGTH, CONFIG, EXP_A, A, EXP_A == A);
 
                     for (size_t tj = 0; tj < LENGTH; ++tj) {
                         const int id = TstFacility::getIdentifier(VALUES[tj]);
@@ -14625,6 +14693,13 @@ void TestDriver<TYPE, ALLOC>::testCase2()
                 {
                     const Int64 BB = oa.numBlocksTotal();
 
+                    // The block pointer array and one block remain, plus the
+                    // spare block kept for reuse if `clear` empties a second
+                    // block, which the `push_front` calls above allocated if
+                    // `LENGTH` exceeds `FS`.
+
+                    const Int64 EXP_A = LENGTH > FS ? 3 : 2;
+
                     mX.clear();
 
                     ASSERTV(LENGTH, CONFIG, 0          == X.size());
@@ -14634,7 +14709,7 @@ void TestDriver<TYPE, ALLOC>::testCase2()
                     const Int64 A  = oa.numBlocksInUse();
 
                     ASSERTV(LENGTH, CONFIG, BB == AA);
-                    ASSERTV(LENGTH, CONFIG, 2  == A);
+                    ASSERTV(LENGTH, CONFIG, EXP_A, A, EXP_A == A);
 
                     for (size_t tj = 0; tj < LENGTH; ++tj) {
                         const int id = TstFacility::getIdentifier(VALUES[tj]);
@@ -16025,6 +16100,195 @@ int main(int argc, char *argv[])
     printf("TEST " __FILE__ " CASE %d\n", test);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 36: {
+        // --------------------------------------------------------------------
+        // SPARE-BLOCK CACHE AND `DequeBlockSize`
+        //
+        // Concerns:
+        // 1. A block emptied by removing elements from one end of the deque
+        //    is reused when elements are later added at either end, so that
+        //    a deque used as a FIFO queue of bounded length eventually stops
+        //    allocating memory.
+        //
+        // 2. `shrink_to_fit` releases the spare block.
+        //
+        // 3. The spare block is transferred by move construction and by
+        //    `swap`, and is released when the deque is destroyed.
+        //
+        // 4. Specializing `bslstl::DequeBlockSize` for an element type
+        //    changes the number of elements per block of a deque of that
+        //    type, and the default block size is otherwise unchanged.
+        //
+        // Plan:
+        // 1. Using a test allocator, repeatedly `push_back` and `pop_front`
+        //    (and `push_front` and `pop_back`) a deque of bounded length, and
+        //    verify that, after a warm-up period spanning a few blocks, no
+        //    more memory is allocated.  (C-1)
+        //
+        // 2. Empty at least one block of a deque by popping its elements,
+        //    call `shrink_to_fit`, and verify that one block less is in use.
+        //    (C-2)
+        //
+        // 3. Create deques holding a spare block, move construct and swap
+        //    them, and verify that every block is released when the deques
+        //    are destroyed.  (C-3)
+        //
+        // 4. Verify `Deque_BlockLengthCalcUtil<T>::BLOCK_LENGTH` for an
+        //    element type for which `DequeBlockSize` is specialized, and for
+        //    types for which it is not.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: emptied blocks are reused.
+        //   bslstl::DequeBlockSize
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSPARE-BLOCK CACHE AND `DequeBlockSize`"
+                            "\n======================================\n");
+
+        typedef bsl::deque<int> Obj;
+
+        const int BLOCK_LENGTH =
+                             bsl::Deque_BlockLengthCalcUtil<int>::BLOCK_LENGTH;
+
+        if (verbose) printf("\nTesting a deque used as a FIFO queue.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; i < 5; ++i) {
+                mX.push_back(i);
+            }
+            for (int i = 0; i < 4 * BLOCK_LENGTH; ++i) {
+                mX.push_back(i);
+                mX.pop_front();
+            }
+
+            const bsls::Types::Int64 NUM_ALLOCS = oa.numAllocations();
+
+            for (int i = 0; i < 100 * BLOCK_LENGTH; ++i) {
+                mX.push_back(i);
+                mX.pop_front();
+            }
+            ASSERTV(NUM_ALLOCS, oa.numAllocations(),
+                    NUM_ALLOCS == oa.numAllocations());
+
+            for (int i = 0; i < 4 * BLOCK_LENGTH; ++i) {
+                mX.push_front(i);
+                mX.pop_back();
+            }
+
+            const bsls::Types::Int64 NUM_ALLOCS2 = oa.numAllocations();
+
+            for (int i = 0; i < 100 * BLOCK_LENGTH; ++i) {
+                mX.push_front(i);
+                mX.pop_back();
+            }
+            ASSERTV(NUM_ALLOCS2, oa.numAllocations(),
+                    NUM_ALLOCS2 == oa.numAllocations());
+
+            ASSERTV(X.size(), 5 == X.size());
+        }
+
+        if (verbose) printf("\nTesting `shrink_to_fit`.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int i = 0; i < 4 * BLOCK_LENGTH; ++i) {
+                mX.push_back(i);
+            }
+            for (int i = 0; i < 2 * BLOCK_LENGTH; ++i) {
+                mX.pop_front();
+            }
+
+            // The block pointer array may be reallocated, but is not counted
+            // twice, so only the spare block is released.
+
+            const bsls::Types::Int64 NUM_IN_USE = oa.numBlocksInUse();
+
+            mX.shrink_to_fit();
+
+            ASSERTV(NUM_IN_USE, oa.numBlocksInUse(),
+                    NUM_IN_USE - 1 == oa.numBlocksInUse());
+
+            mX.shrink_to_fit();
+
+            ASSERTV(NUM_IN_USE, oa.numBlocksInUse(),
+                    NUM_IN_USE - 1 == oa.numBlocksInUse());
+
+            ASSERTV(X.size(), 2 * BLOCK_LENGTH == (int)X.size());
+            ASSERTV(X.front(), 2 * BLOCK_LENGTH == X.front());
+        }
+
+        if (verbose) printf("\nTesting move construction and `swap`.\n");
+        {
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+            {
+                Obj mX(&oa);
+                Obj mY(&oa);  const Obj& Y = mY;
+
+                for (int i = 0; i < 3 * BLOCK_LENGTH; ++i) {
+                    mX.push_back(i);
+                    mY.push_front(i);
+                }
+                for (int i = 0; i < 2 * BLOCK_LENGTH; ++i) {
+                    mX.pop_front();
+                    mY.pop_back();
+                }
+
+                Obj mZ(bslmf::MovableRefUtil::move(mX));  const Obj& Z = mZ;
+
+                mY.swap(mZ);
+
+                ASSERTV(Y.size(), BLOCK_LENGTH == (int)Y.size());
+                ASSERTV(Z.size(), BLOCK_LENGTH == (int)Z.size());
+
+                for (int i = 0; i < 4 * BLOCK_LENGTH; ++i) {
+                    mX.push_back(i);
+                    mY.push_back(i);
+                    mZ.push_front(i);
+                }
+            }
+            ASSERTV(oa.numBlocksInUse(), 0 == oa.numBlocksInUse());
+        }
+
+        if (verbose) printf("\nTesting `DequeBlockSize`.\n");
+        {
+            ASSERTV(BLOCK_LENGTH, 200 / (int)sizeof(int) == BLOCK_LENGTH);
+
+            ASSERTV(static_cast<int>(PageLength<char>::k_VALUE) ==
+                    static_cast<int>(
+                          bsl::Deque_BlockLengthCalcUtil<char>::BLOCK_LENGTH));
+
+            ASSERTV(bsl::Deque_BlockLengthCalcUtil<
+                                              BigBlockElement>::BLOCK_LENGTH,
+                    4096 / (int)sizeof(BigBlockElement) ==
+                    bsl::Deque_BlockLengthCalcUtil<
+                                              BigBlockElement>::BLOCK_LENGTH);
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            bsl::deque<BigBlockElement> mX(&oa);
+
+            const BigBlockElement ELEMENT = { 7 };
+
+            mX.push_back(ELEMENT);
+
+            const bsls::Types::Int64 NUM_ALLOCS = oa.numAllocations();
+
+            for (int i = 1; i < 512; ++i) {
+                mX.push_back(ELEMENT);
+            }
+
+            // A deque with the default block size would have allocated more
+            // than 30 blocks.
+
+            ASSERTV(NUM_ALLOCS, oa.numAllocations(),
+                    oa.numAllocations() - NUM_ALLOCS <= 2);
+        }
+      } break;
       case 35: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLES
@@ -42,14 +42,17 @@ class Deque_Guard;
                        // ================================
 
 /// This `struct` provides a namespace for the calculation of block length
-/// (the number of elements per block within a `deque`).  This ensures that
-/// each block in the deque can hold at least 16 elements.
+/// (the number of elements per block within a `deque`) from the block size
+/// configured by `bslstl::DequeBlockSize`.  This ensures that each block in
+/// the deque can hold at least 16 elements.
 template <class VALUE_TYPE>
 struct Deque_BlockLengthCalcUtil {
 
     // TYPES
     enum {
-        DEFAULT_BLOCK_SIZE = 200,  // number of bytes per block
+        DEFAULT_BLOCK_SIZE = BloombergLP::bslstl::DequeBlockSize<
+                                                           VALUE_TYPE>::value,
+                                   // number of bytes per block
 
         BLOCK_LENGTH       = (16 * sizeof(VALUE_TYPE) >= DEFAULT_BLOCK_SIZE)
                              ? 16
@@ -139,6 +142,8 @@ class Deque_Base {
     std::size_t  d_blocksLength;  // length of 'd_blocks_p' array
     IteratorImp  d_start;         // iterator to first element
     IteratorImp  d_finish;        // iterator to one past last element
+    Block       *d_spareBlock_p;  // emptied block kept for reuse, or 0
+                                  // (owned)
 
   public:
     // MANIPULATORS
@@ -375,8 +380,9 @@ class deque : public  Deque_Base<VALUE_TYPE>
 
     // PRIVATE MANIPULATORS
 
-    /// Return one block allocated from this object's allocator.  Note that
-    /// the block is not initialized.
+    /// Return one block, taken from the spare-block cache of this object if
+    /// it is not empty, and allocated from this object's allocator
+    /// otherwise.  Note that the block is not initialized.
     Block *allocateBlock();
 
     /// Allocate an array having the specified `n` elements of type
@@ -384,9 +390,10 @@ class deque : public  Deque_Base<VALUE_TYPE>
     /// elements are not initialized.
     BlockPtr *allocateBlockPtrs(std::size_t n);
 
-    /// Deallocate from this object's allocator the block at the specified
-    /// `p` address.  Note that this function does not call any destructors
-    /// on `p` or `*p`.
+    /// Keep the block at the specified `p` address in the spare-block cache
+    /// of this object if the cache is empty, and deallocate it from this
+    /// object's allocator otherwise.  Note that this function does not call
+    /// any destructors on `p` or `*p`.
     void deallocateBlock(Block *p);
 
     /// Deallocate from this object's allocator an array at the specified
@@ -395,6 +402,10 @@ class deque : public  Deque_Base<VALUE_TYPE>
     /// then that block is not deallocated (and might be leaked).
     void deallocateBlockPtrs(BlockPtr *p, std::size_t n);
 
+    /// Deallocate from this object's allocator the block held in the
+    /// spare-block cache of this object, if any, and empty the cache.
+    void releaseSpareBlock();
+
     /// Append the elements in the range specified by `[first .. last)` to
     /// this deque, and return the number of elements appended.  The third
     /// argument is used for overload resolution.  The behavior is undefined
@@ -752,8 +763,9 @@ class deque : public  Deque_Base<VALUE_TYPE>
     void resize(size_type newSize, const VALUE_TYPE& value);
 
     /// Minimize the memory used by this deque to the extent possible
-    /// without moving any contained elements.  If an exception is thrown,
-    /// the value of this object is unchanged.  Note that this method has no
+    /// without moving any contained elements, releasing, in particular, the
+    /// spare block kept for reuse, if any.  If an exception is thrown, the
+    /// value of this object is unchanged.  Note that this method has no
     /// effect on the memory used by individual elements of the (template
     /// parameter) `VALUE_TYPE`.
     void shrink_to_fit();
@@ -2143,7 +2155,8 @@ deque<VALUE_TYPE, ALLOCATOR>::deque(RawInit, const ALLOCATOR& allocator)
 : Deque_Base<VALUE_TYPE>()
 , ContainerBase(allocator)
 {
-    this->d_blocks_p = 0;
+    this->d_blocks_p     = 0;
+    this->d_spareBlock_p = 0;
 }
 
 // PRIVATE MANIPULATORS
@@ -2152,6 +2165,11 @@ inline
 typename deque<VALUE_TYPE, ALLOCATOR>::Block *
 deque<VALUE_TYPE, ALLOCATOR>::allocateBlock()
 {
+    Block *block = this->d_spareBlock_p;
+    if (block) {
+        this->d_spareBlock_p = 0;
+        return block;                                                 // RETURN
+    }
     return AllocatorUtil::allocateObject<Block>(this->allocatorRef());
 }
 
@@ -2167,6 +2185,14 @@ template <class VALUE_TYPE, class ALLOCATOR>
 inline
 void deque<VALUE_TYPE, ALLOCATOR>::deallocateBlock(Block *p)
 {
+    // Keeping one emptied block is enough for a deque used as a FIFO queue,
+    // whose blocks are emptied at the front as fast as they are needed at
+    // the back, to reach a steady state free of allocator calls.
+
+    if (0 == this->d_spareBlock_p) {
+        this->d_spareBlock_p = p;
+        return;                                                       // RETURN
+    }
     AllocatorUtil::deallocateObject(this->allocatorRef(), p);
 }
 
@@ -2178,6 +2204,17 @@ deque<VALUE_TYPE, ALLOCATOR>::deallocateBlockPtrs(BlockPtr *p, std::size_t n)
     AllocatorUtil::deallocateObject(this->allocatorRef(), p, n);
 }
 
+template <class VALUE_TYPE, class ALLOCATOR>
+inline
+void deque<VALUE_TYPE, ALLOCATOR>::releaseSpareBlock()
+{
+    if (this->d_spareBlock_p) {
+        AllocatorUtil::deallocateObject(this->allocatorRef(),
+                                        this->d_spareBlock_p);
+        this->d_spareBlock_p = 0;
+    }
+}
+
 template <class VALUE_TYPE, class ALLOCATOR>
 template <class INPUT_ITERATOR>
 typename deque<VALUE_TYPE, ALLOCATOR>::size_type
@@ -2967,8 +3004,9 @@ template <class VALUE_TYPE, class ALLOCATOR>
 deque<VALUE_TYPE, ALLOCATOR>::~deque()
 {
     if (0 == this->d_blocks_p) {
-        // Nothing to do when destroying raw deques.
+        // Raw deques own no blocks, except, possibly, a spare one.
 
+        releaseSpareBlock();
         return;                                                       // RETURN
     }
 
@@ -2980,7 +3018,8 @@ deque<VALUE_TYPE, ALLOCATOR>::~deque()
         this->deallocateBlock(*this->d_start.blockPtr());
     }
 
-    // Deallocate the array of block pointers.
+    // Deallocate the spare block and the array of block pointers.
+    releaseSpareBlock();
     this->deallocateBlockPtrs(this->d_blocks_p, this->d_blocksLength);
 }
 
@@ -3299,6 +3338,8 @@ void deque<VALUE_TYPE, ALLOCATOR>::shrink_to_fit()
     // complex algorithm is not justified.  At most 'BLOCK_LENGTH' bytes are
     // wasted.
 
+    releaseSpareBlock();
+
     const size_type newBlocksLength =
                       this->d_finish.blockPtr() - this->d_start.blockPtr() + 1;
 
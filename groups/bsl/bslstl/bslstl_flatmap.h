@@ -0,0 +1,4340 @@
+// bslstl_flatmap.h                                                   -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATMAP
+#define INCLUDED_BSLSTL_FLATMAP
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide ordered maps held in contiguous sorted vectors.
+//
+//@CLASSES:
+//  bsl::flat_map: ordered map with unique keys stored in sorted vectors
+//  bsl::flat_multimap: ordered map with equivalent keys in sorted vectors
+//
+//@CANONICAL_HEADER: bsl_flat_map.h
+//
+//@SEE_ALSO: bslstl_flatset, bslstl_sortedtags, bslstl_map
+//
+//@DESCRIPTION: This component defines two class templates, `bsl::flat_map`
+// and `bsl::flat_multimap`, implementing the C++23 standard container
+// adaptors that hold an ordered sequence of key-value pairs (having unique
+// and possibly equivalent keys, respectively) in two parallel, contiguous
+// `bsl::vector` objects: one holding the sorted keys (of the template
+// parameter type `KEY`) and one holding the associated values (of the
+// template parameter type `VALUE`).
+//
+// A flat map offers the interface of an ordered associative container, but
+// trades the node-based representation of `bsl::map` for sorted arrays:
+// lookup is a binary search over a contiguous array holding only keys,
+// iteration walks two vectors in step, and the container allocates two
+// blocks rather than one node per element.  In exchange, inserting or
+// erasing a single element is linear in the size of the map, and every
+// modification of the map invalidates all iterators and references to its
+// elements.  Flat maps are therefore best suited for maps that are built once
+// (or in bulk) and then searched many times.
+//
+// Because keys and values are stored separately, a flat map holds no
+// `value_type` objects.  Its iterators are *proxy* iterators: dereferencing
+// one yields a `bsl::pair<const KEY&, VALUE&>` (or, for a `const_iterator`, a
+// `bsl::pair<const KEY&, const VALUE&>`) referring to the key and value at
+// the iterator's position, and `operator->` returns an object through which
+// `it->first` and `it->second` can be used as with `bsl::map`.  As in the
+// C++ standard, the iterators report the `std::input_iterator_tag` category
+// (a proxy reference does not satisfy the requirements of the stronger
+// categories), but they support all random-access operations.
+//
+// An instantiation of a flat map is an allocator-aware, value-semantic type
+// whose salient attributes are its size (number of key-value pairs) and the
+// ordered sequence of key-value pairs the map contains.
+//
+///Bulk Insertion
+///--------------
+// Inserting a range of `N` elements into a map of `M` elements does not
+// insert the elements one at a time (which would cost `O[N * (M + N)]`).
+// Instead the range is appended to the underlying vectors, the positions of
+// the appended elements are sorted by key, and the two sorted runs are merged
+// in a single pass, for a total of `O[N * log(N) + M]` operations.  If the
+// caller passes `bsl::sorted_unique` (or, for `flat_multimap`,
+// `bsl::sorted_equivalent`) to indicate that the range is already sorted, the
+// sort is skipped and the operation is linear.  When every appended key is
+// greater than the largest key already in the map, the merge is skipped as
+// well, so building a map from sorted input is proportional to the length of
+// that input.  When a `flat_map` receives several elements with equivalent
+// keys, the element already in the map, or else the first such element in
+// the range, is kept.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as the `ALLOCATOR` template parameter is rebound to
+// `KEY` and `VALUE` to supply memory to the key and value vectors.  If
+// `ALLOCATOR` is `bsl::allocator` (the default), a flat map accepts an
+// optional `bslma::Allocator *` at construction, which is used to supply
+// memory for the map throughout its lifetime, and which is passed to the
+// constructors of contained keys and values having the
+// `bslma::UsesBslmaAllocator` trait; otherwise the currently installed
+// default allocator is used.
+//
+///Interface Differences with the C++ Standard
+///-------------------------------------------
+// `std::flat_map` is parameterized by the types of its two underlying
+// containers.  `bsl::flat_map` and `bsl::flat_multimap` instead always use
+// `bsl::vector` (with the rebound allocator), and take the allocator type as
+// their last template parameter, consistent with the other `bsl` containers.
+// `emplace`, `try_emplace`, `insert_or_assign`, `extract`, and the
+// heterogeneous (transparent-comparator) lookup overloads are not provided;
+// `keys` and `values` give read access to the two vectors, and `replace`
+// replaces them.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Read-Mostly Symbol Table
+///- - - - - - - - - - - - - - - - - - -
+// Suppose we load a table of instrument identifiers and their prices once
+// per day, and then look prices up many times.
+//
+// First, we gather the identifiers and prices, which arrive in no particular
+// order, into two parallel vectors:
+// ```
+// bslma::TestAllocator ta;
+//
+// bsl::vector<int>    ids(&ta);
+// bsl::vector<double> prices(&ta);
+//
+// ids.push_back(300);  prices.push_back(12.5);
+// ids.push_back(100);  prices.push_back(99.0);
+// ids.push_back(200);  prices.push_back(47.25);
+// ```
+// Then, we create a `flat_map`, which sorts both vectors by key in one pass:
+// ```
+// bsl::flat_map<int, double> table(ids, prices, std::less<int>(), &ta);
+//
+// assert(3   == table.size());
+// assert(100 == table.begin()->first);
+// assert(99.0 == table.begin()->second);
+// ```
+// Next, we look up a price.  The search touches only the key vector:
+// ```
+// bsl::flat_map<int, double>::const_iterator it = table.find(200);
+// assert(table.end() != it);
+// assert(47.25 == it->second);
+// ```
+// Finally, we add a batch of identifiers that we know to be sorted and
+// greater than those already present, which appends them without sorting or
+// merging:
+// ```
+// bsl::pair<int, double> batch[] = { bsl::pair<int, double>(400, 1.0),
+//                                    bsl::pair<int, double>(500, 2.0) };
+// table.insert(bsl::sorted_unique, batch, batch + 2);
+// assert(5 == table.size());
+// assert(2.0 == table[500]);
+// ```
+
+#include <bslscm_version.h>
+
+#include <bslstl_iterator.h>
+#include <bslstl_pair.h>
+#include <bslstl_sortedtags.h>
+#include <bslstl_stdexceptutil.h>
+#include <bslstl_vector.h>
+
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslma_allocatortraits.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_enableif.h>
+#include <bslmf_isconvertible.h>
+#include <bslmf_movableref.h>
+#include <bslmf_removeconst.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+# include <initializer_list>
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                          // ========================
+                          // class FlatMap_ArrowProxy
+                          // ========================
+
+/// This component-private class template holds a proxy reference (of the
+/// template parameter type `REFERENCE`) and returns its address from
+/// `operator->`, so that the `operator->` of a flat-map iterator can provide
+/// `it->first` and `it->second`.
+template <class REFERENCE>
+class FlatMap_ArrowProxy {
+
+    // DATA
+    REFERENCE d_reference;  // proxy reference to a key-value pair
+
+  public:
+    // CREATORS
+
+    /// Create an arrow proxy holding the specified `reference`.
+    explicit FlatMap_ArrowProxy(const REFERENCE& reference);
+
+    // ACCESSORS
+
+    /// Return the address of the proxy reference held by this object.
+    const REFERENCE *operator->() const;
+};
+
+                           // ======================
+                           // class FlatMap_Iterator
+                           // ======================
+
+/// This component-private class template provides the random-access proxy
+/// iterator of the flat maps.  An iterator refers to a key (of the template
+/// parameter type `KEY`) and to a value (of the template parameter type
+/// `VALUE`, which is `const`-qualified for a `const_iterator`) held at the
+/// same position in two parallel arrays.
+template <class KEY, class VALUE>
+class FlatMap_Iterator {
+
+    // PRIVATE TYPES
+    typedef typename bsl::remove_const<VALUE>::type NonConstValue;
+
+    // DATA
+    const KEY *d_key_p;    // address of the current key
+    VALUE     *d_value_p;  // address of the current value
+
+  public:
+    // PUBLIC TYPES
+    typedef bsl::pair<KEY, NonConstValue>            value_type;
+    typedef bsl::pair<const KEY&, VALUE&>            reference;
+    typedef FlatMap_ArrowProxy<reference>            pointer;
+    typedef std::ptrdiff_t                           difference_type;
+    typedef std::input_iterator_tag                  iterator_category;
+    typedef std::random_access_iterator_tag          iterator_concept;
+
+    // CREATORS
+
+    /// Create a singular iterator.
+    FlatMap_Iterator();
+
+    /// Create an iterator referring to the specified `key` and `value`.
+    FlatMap_Iterator(const KEY *key, VALUE *value);
+
+    /// Create an iterator referring to the same element as the specified
+    /// `original` iterator.  This constructor participates in overload
+    /// resolution only if `OTHER_VALUE *` converts to `VALUE *`, allowing an
+    /// `iterator` to be converted to a `const_iterator`.
+    template <class OTHER_VALUE>
+    FlatMap_Iterator(
+       const FlatMap_Iterator<KEY, OTHER_VALUE>& original,
+       typename bsl::enable_if<bsl::is_convertible<OTHER_VALUE *,
+                                                   VALUE *>::value,
+                               int>::type = 0);                     // IMPLICIT
+
+    // MANIPULATORS
+
+    /// Advance this iterator by one element and return a reference to it.
+    FlatMap_Iterator& operator++();
+
+    /// Move this iterator back by one element and return a reference to it.
+    FlatMap_Iterator& operator--();
+
+    /// Advance this iterator by one element and return its previous value.
+    FlatMap_Iterator operator++(int);
+
+    /// Move this iterator back by one element and return its previous value.
+    FlatMap_Iterator operator--(int);
+
+    /// Advance this iterator by the specified `offset` elements and return a
+    /// reference to it.
+    FlatMap_Iterator& operator+=(difference_type offset);
+
+    /// Move this iterator back by the specified `offset` elements and return
+    /// a reference to it.
+    FlatMap_Iterator& operator-=(difference_type offset);
+
+    // ACCESSORS
+
+    /// Return a proxy reference to the element referred to by this iterator.
+    reference operator*() const;
+
+    /// Return an object whose `operator->` provides access to the element
+    /// referred to by this iterator.
+    pointer operator->() const;
+
+    /// Return a proxy reference to the element the specified `offset`
+    /// elements after the one referred to by this iterator.
+    reference operator[](difference_type offset) const;
+
+    /// Return the address of the key referred to by this iterator.
+    const KEY *keyAddress() const;
+
+    /// Return the address of the value referred to by this iterator.
+    VALUE *valueAddress() const;
+};
+
+// FREE OPERATORS
+
+/// Return an iterator referring to the element the specified `offset`
+/// elements after the one referred to by the specified `iterator`.
+template <class KEY, class VALUE>
+FlatMap_Iterator<KEY, VALUE> operator+(
+                       const FlatMap_Iterator<KEY, VALUE>&            iterator,
+                       typename FlatMap_Iterator<KEY, VALUE>::difference_type
+                                                                       offset);
+template <class KEY, class VALUE>
+FlatMap_Iterator<KEY, VALUE> operator+(
+                       typename FlatMap_Iterator<KEY, VALUE>::difference_type
+                                                                       offset,
+                       const FlatMap_Iterator<KEY, VALUE>&           iterator);
+
+/// Return an iterator referring to the element the specified `offset`
+/// elements before the one referred to by the specified `iterator`.
+template <class KEY, class VALUE>
+FlatMap_Iterator<KEY, VALUE> operator-(
+                       const FlatMap_Iterator<KEY, VALUE>&            iterator,
+                       typename FlatMap_Iterator<KEY, VALUE>::difference_type
+                                                                       offset);
+
+/// Return the number of elements from the specified `rhs` iterator to the
+/// specified `lhs` iterator.  The behavior is undefined unless both
+/// iterators refer into the same flat map.
+template <class KEY, class VALUE1, class VALUE2>
+std::ptrdiff_t operator-(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                         const FlatMap_Iterator<KEY, VALUE2>& rhs);
+
+/// Return `true` if the specified `lhs` and `rhs` iterators refer to the
+/// same element, and `false` otherwise.
+template <class KEY, class VALUE1, class VALUE2>
+bool operator==(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                const FlatMap_Iterator<KEY, VALUE2>& rhs);
+
+/// Return `true` if the specified `lhs` and `rhs` iterators do not refer to
+/// the same element, and `false` otherwise.
+template <class KEY, class VALUE1, class VALUE2>
+bool operator!=(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                const FlatMap_Iterator<KEY, VALUE2>& rhs);
+
+/// Return `true` if the specified `lhs` iterator refers to an element before
+/// the one referred to by the specified `rhs` iterator, and `false`
+/// otherwise.  The behavior is undefined unless both iterators refer into the
+/// same flat map.
+template <class KEY, class VALUE1, class VALUE2>
+bool operator<(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+               const FlatMap_Iterator<KEY, VALUE2>& rhs);
+
+/// Return `true` if the specified `lhs` iterator refers to an element after
+/// the one referred to by the specified `rhs` iterator, and `false`
+/// otherwise.
+template <class KEY, class VALUE1, class VALUE2>
+bool operator>(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+               const FlatMap_Iterator<KEY, VALUE2>& rhs);
+
+/// Return `true` if the specified `lhs` iterator does not refer to an
+/// element after the one referred to by the specified `rhs` iterator, and
+/// `false` otherwise.
+template <class KEY, class VALUE1, class VALUE2>
+bool operator<=(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                const FlatMap_Iterator<KEY, VALUE2>& rhs);
+
+/// Return `true` if the specified `lhs` iterator does not refer to an
+/// element before the one referred to by the specified `rhs` iterator, and
+/// `false` otherwise.
+template <class KEY, class VALUE1, class VALUE2>
+bool operator>=(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                const FlatMap_Iterator<KEY, VALUE2>& rhs);
+
+                         // ==========================
+                         // class FlatMap_ValueCompare
+                         // ==========================
+
+/// This component-private class template provides the `value_compare` type
+/// of the flat maps: a functor ordering key-value pairs by applying a
+/// comparator (of the template parameter type `COMPARATOR`) to their keys.
+template <class COMPARATOR>
+class FlatMap_ValueCompare {
+
+    // DATA
+    COMPARATOR d_compare;  // key comparator
+
+  public:
+    // PUBLIC TYPES
+    typedef bool result_type;
+
+    // CREATORS
+
+    /// Create a value comparator using a copy of the specified
+    /// `comparator` to compare keys.
+    explicit FlatMap_ValueCompare(const COMPARATOR& comparator);
+
+    // ACCESSORS
+
+    /// Return `true` if the key of the specified `lhs` pair is ordered
+    /// before the key of the specified `rhs` pair, and `false` otherwise.
+    template <class LHS_PAIR, class RHS_PAIR>
+    bool operator()(const LHS_PAIR& lhs, const RHS_PAIR& rhs) const;
+};
+
+                         // ==========================
+                         // class FlatMap_RangeProctor
+                         // ==========================
+
+/// This component-private class template provides a proctor that, unless
+/// its `release` method is called, erases on destruction the elements at and
+/// after a specified position of a key vector and a value vector (of the
+/// template parameter types `KEY_CONTAINER` and `MAPPED_CONTAINER`).  It is
+/// used to roll a flat map back to its elements before a bulk insertion if
+/// that insertion throws.
+template <class KEY_CONTAINER, class MAPPED_CONTAINER>
+class FlatMap_RangeProctor {
+
+    // DATA
+    KEY_CONTAINER    *d_keys_p;    // managed keys (held, not owned)
+    MAPPED_CONTAINER *d_values_p;  // managed values (held, not owned)
+    std::size_t       d_position;  // first element erased on rollback
+
+  private:
+    // NOT IMPLEMENTED
+    FlatMap_RangeProctor(const FlatMap_RangeProctor&);
+    FlatMap_RangeProctor& operator=(const FlatMap_RangeProctor&);
+
+  public:
+    // CREATORS
+
+    /// Create a proctor managing the elements of the specified `keys` and
+    /// `values` at and after the specified `position`.
+    FlatMap_RangeProctor(KEY_CONTAINER    *keys,
+                         MAPPED_CONTAINER *values,
+                         std::size_t       position);
+
+    /// Erase the managed elements unless `release` has been called.
+    ~FlatMap_RangeProctor();
+
+    // MANIPULATORS
+
+    /// Release from management the elements of the managed containers.
+    void release();
+
+    /// Manage the elements of the managed containers at and after the
+    /// specified `position` instead of those previously managed.
+    void reset(std::size_t position);
+};
+
+                        // ============================
+                        // class FlatMap_ElementProctor
+                        // ============================
+
+/// This component-private class template provides a proctor that, unless
+/// its `release` method is called, erases on destruction the element at a
+/// specified position of a vector (of the template parameter type
+/// `CONTAINER`).  It is used to remove a newly inserted value if inserting
+/// the corresponding key throws.
+template <class CONTAINER>
+class FlatMap_ElementProctor {
+
+    // DATA
+    CONTAINER   *d_container_p;  // managed container (held, not owned)
+    std::size_t  d_position;     // position of the managed element
+
+  private:
+    // NOT IMPLEMENTED
+    FlatMap_ElementProctor(const FlatMap_ElementProctor&);
+    FlatMap_ElementProctor& operator=(const FlatMap_ElementProctor&);
+
+  public:
+    // CREATORS
+
+    /// Create a proctor managing the element of the specified `container`
+    /// at the specified `position`.
+    FlatMap_ElementProctor(CONTAINER *container, std::size_t position);
+
+    /// Erase the managed element unless `release` has been called.
+    ~FlatMap_ElementProctor();
+
+    // MANIPULATORS
+
+    /// Release from management the element of the managed container.
+    void release();
+};
+
+                        // ============================
+                        // class FlatMap_IndexComparator
+                        // ============================
+
+/// This component-private class template orders positions in a vector of
+/// keys (of the template parameter type `KEY_CONTAINER`) by the keys at
+/// those positions, using a comparator of the template parameter type
+/// `COMPARATOR`, and orders positions holding equivalent keys by position,
+/// so that an unstable sort of the positions yields a stable order.
+template <class KEY_CONTAINER, class COMPARATOR>
+class FlatMap_IndexComparator {
+
+    // DATA
+    const KEY_CONTAINER *d_keys_p;        // ordered keys (held, not owned)
+    const COMPARATOR    *d_comparator_p;  // key comparator (held, not owned)
+
+  public:
+    // CREATORS
+
+    /// Create a comparator of positions in the specified `keys` using the
+    /// specified `comparator`.
+    FlatMap_IndexComparator(const KEY_CONTAINER& keys,
+                            const COMPARATOR&    comparator);
+
+    // ACCESSORS
+
+    /// Return `true` if the key at the specified `lhs` position is ordered
+    /// before the key at the specified `rhs` position, or the keys are
+    /// equivalent and `lhs < rhs`, and `false` otherwise.
+    bool operator()(std::size_t lhs, std::size_t rhs) const;
+};
+
+                             // ==================
+                             // class FlatMap_Util
+                             // ==================
+
+/// This component-private utility `struct` provides the algorithms shared by
+/// `bsl::flat_map` and `bsl::flat_multimap`, operating on a pair of parallel
+/// key and value vectors.
+struct FlatMap_Util {
+
+    // CLASS METHODS
+
+    /// Append to the specified `keys` and `values` the keys and values of
+    /// the pairs in the range starting at the specified `first` iterator and
+    /// ending immediately before the specified `last` iterator.
+    template <class KEY_CONTAINER,
+              class MAPPED_CONTAINER,
+              class INPUT_ITERATOR>
+    static void append(KEY_CONTAINER    *keys,
+                       MAPPED_CONTAINER *values,
+                       INPUT_ITERATOR    first,
+                       INPUT_ITERATOR    last);
+
+    /// Return the position of the first key in the specified sorted `keys`
+    /// that is not ordered before the specified `key` by the specified
+    /// `comparator`.
+    template <class KEY_CONTAINER, class KEY, class COMPARATOR>
+    static std::size_t lowerBound(const KEY_CONTAINER& keys,
+                                  const KEY&           key,
+                                  const COMPARATOR&    comparator);
+
+    /// Return the position of the first key in the specified sorted `keys`
+    /// that the specified `key` is ordered before by the specified
+    /// `comparator`.
+    template <class KEY_CONTAINER, class KEY, class COMPARATOR>
+    static std::size_t upperBound(const KEY_CONTAINER& keys,
+                                  const KEY&           key,
+                                  const COMPARATOR&    comparator);
+
+    /// Bring the elements of the specified `keys` and `values` at and after
+    /// the specified `position` into the sequence of the elements before
+    /// it, sorted by key with the specified `comparator`.  The relative
+    /// order of elements with equivalent keys is preserved, with the
+    /// elements before `position` first.  If the specified `isSorted` is
+    /// `true`, the elements at and after `position` are already sorted.  If
+    /// the specified `isUnique` is `true`, drop every element whose key is
+    /// equivalent to that of an element preceding it.  If the specified
+    /// `proctor` is not 0, it is reset to manage all the elements before any
+    /// element before `position` is moved.  The behavior is undefined unless
+    /// `keys->size() == values->size()`, and the keys before `position` are
+    /// sorted (and, if `isUnique`, unique).
+    template <class KEY_CONTAINER, class MAPPED_CONTAINER, class COMPARATOR>
+    static void mergeTail(
+                 KEY_CONTAINER                                     *keys,
+                 MAPPED_CONTAINER                                  *values,
+                 std::size_t                                        position,
+                 const COMPARATOR&                                  comparator,
+                 bool                                               isSorted,
+                 bool                                               isUnique,
+                 FlatMap_RangeProctor<KEY_CONTAINER, MAPPED_CONTAINER>
+                                                                   *proctor);
+
+    /// Return a negative value, 0, or a positive value if the sequence of
+    /// pairs formed by the specified `lhsKeys` and `lhsValues` is
+    /// lexicographically less than, equal to, or greater than that formed by
+    /// the specified `rhsKeys` and `rhsValues`, comparing keys and values
+    /// with `operator<`.
+    template <class KEY_CONTAINER, class MAPPED_CONTAINER>
+    static int lexicographical(const KEY_CONTAINER&    lhsKeys,
+                               const MAPPED_CONTAINER& lhsValues,
+                               const KEY_CONTAINER&    rhsKeys,
+                               const MAPPED_CONTAINER& rhsValues);
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                               // ==============
+                               // class flat_map
+                               // ==============
+
+/// This class template implements a value-semantic container type holding an
+/// ordered sequence of key-value pairs having unique keys (of the template
+/// parameter type `KEY`) and associated values (of the template parameter
+/// type `VALUE`), stored in two parallel sorted `bsl::vector` objects.  Keys
+/// are ordered by a comparator of the template parameter type `COMPARATOR`,
+/// and memory is supplied by allocators rebound from the template parameter
+/// type `ALLOCATOR`.
+template <class KEY,
+          class VALUE,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = allocator<pair<KEY, VALUE> > >
+class flat_map {
+
+    // PRIVATE TYPES
+
+    /// This typedef is a convenient alias for the utility associated with
+    /// movable references.
+    typedef BloombergLP::bslmf::MovableRefUtil                   MoveUtil;
+
+    typedef bsl::allocator_traits<ALLOCATOR>                     AllocTraits;
+    typedef typename AllocTraits::template rebind_traits<KEY>::allocator_type
+                                                                 KeyAllocator;
+    typedef typename AllocTraits::template rebind_traits<VALUE>::
+                                                allocator_type ValueAllocator;
+
+    typedef BloombergLP::bslstl::FlatMap_Util                    Util;
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                                  key_type;
+    typedef VALUE                                                mapped_type;
+    typedef pair<KEY, VALUE>                                     value_type;
+    typedef COMPARATOR                                           key_compare;
+    typedef ALLOCATOR                                         allocator_type;
+    typedef pair<const KEY&, VALUE&>                             reference;
+    typedef pair<const KEY&, const VALUE&>                  const_reference;
+    typedef vector<KEY, KeyAllocator>                   key_container_type;
+    typedef vector<VALUE, ValueAllocator>            mapped_container_type;
+    typedef std::size_t                                          size_type;
+    typedef std::ptrdiff_t                                 difference_type;
+
+    typedef BloombergLP::bslstl::FlatMap_Iterator<KEY, VALUE>    iterator;
+    typedef BloombergLP::bslstl::FlatMap_Iterator<KEY, const VALUE>
+                                                            const_iterator;
+    typedef bsl::reverse_iterator<iterator>              reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>  const_reverse_iterator;
+
+    typedef BloombergLP::bslstl::FlatMap_ValueCompare<COMPARATOR>
+                                                             value_compare;
+
+  private:
+    // PRIVATE TYPES
+    typedef BloombergLP::bslstl::FlatMap_RangeProctor<key_container_type,
+                                                      mapped_container_type>
+                                                                  Proctor;
+
+    // DATA
+    key_container_type    d_keys;     // sorted, duplicate-free keys
+    mapped_container_type d_values;   // values, parallel to `d_keys`
+    COMPARATOR            d_compare;  // ordering of `d_keys`
+
+    // FRIENDS
+    template <class KEY2,
+              class VALUE2,
+              class COMPARATOR2,
+              class ALLOCATOR2,
+              class PREDICATE>
+    friend typename flat_map<KEY2, VALUE2, COMPARATOR2, ALLOCATOR2>::size_type
+    erase_if(flat_map<KEY2, VALUE2, COMPARATOR2, ALLOCATOR2>& m,
+             PREDICATE                                        predicate);
+
+    // PRIVATE MANIPULATORS
+
+    /// Return an iterator to the element at the specified `index`.
+    iterator iteratorAt(size_type index);
+
+    // PRIVATE ACCESSORS
+
+    /// Return an iterator to the element at the specified `index`.
+    const_iterator iteratorAt(size_type index) const;
+
+    /// Return `true` if an element having the specified `key` can be
+    /// inserted at the specified `index` without breaking the ordering of
+    /// this map, and `false` otherwise.
+    bool isInsertionPoint(size_type index, const KEY& key) const;
+
+  public:
+    // CREATORS
+
+    /// Create an empty map.  Optionally specify a `comparator` used to
+    /// order keys in the map.  If `comparator` is not supplied, a
+    /// default-constructed object of the (template parameter) type
+    /// `COMPARATOR` is used.  Optionally specify a `basicAllocator` used to
+    /// supply memory.  If `basicAllocator` is not supplied, a
+    /// default-constructed object of the (template parameter) type
+    /// `ALLOCATOR` is used.  If `ALLOCATOR` is `bsl::allocator` (the
+    /// default), then `basicAllocator`, if supplied, shall be convertible to
+    /// `bslma::Allocator *`.  If `ALLOCATOR` is `bsl::allocator` and
+    /// `basicAllocator` is not supplied, the currently installed default
+    /// allocator is used.
+    flat_map();
+    explicit flat_map(const COMPARATOR& comparator,
+                      const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    explicit flat_map(const ALLOCATOR& basicAllocator);
+
+    /// Create a map holding the pairs formed by the corresponding elements
+    /// of the specified `keys` and `values` vectors, sorted by key, and
+    /// keeping only the first of the pairs having equivalent keys.
+    /// Optionally specify a `comparator` used to order keys in the map.
+    /// Optionally specify a `basicAllocator` used to supply memory;
+    /// otherwise the default allocator is used.  This operation has
+    /// `O[N * log(N)]` complexity, where `N` is `keys.size()`.  The behavior
+    /// is undefined unless `keys.size() == values.size()`.
+    flat_map(const key_container_type&    keys,
+             const mapped_container_type& values,
+             const COMPARATOR&            comparator = COMPARATOR(),
+             const ALLOCATOR&             basicAllocator = ALLOCATOR());
+
+    /// Create a map holding the pairs formed by the corresponding elements
+    /// of the specified `keys` and `values` vectors, sorted by key, and
+    /// keeping only the first of the pairs having equivalent keys, by moving
+    /// the vectors into the map, which adopts their allocators.  Optionally
+    /// specify a `comparator` used to order keys in the map.  `keys` and
+    /// `values` are left in a valid but unspecified state.  The behavior is
+    /// undefined unless `keys.size() == values.size()`.
+    flat_map(BloombergLP::bslmf::MovableRef<key_container_type>    keys,
+             BloombergLP::bslmf::MovableRef<mapped_container_type> values,
+             const COMPARATOR& comparator = COMPARATOR());
+
+    /// Create a map holding the pairs formed by the corresponding elements
+    /// of the specified `keys` and `values` vectors, whose keys are sorted
+    /// and unique as indicated by the specified `sorted_unique_t` tag.
+    /// Optionally specify a `comparator` used to order keys in the map.
+    /// Optionally specify a `basicAllocator` used to supply memory;
+    /// otherwise the default allocator is used.  The behavior is undefined
+    /// unless `keys.size() == values.size()`, and `keys` is sorted with
+    /// respect to `comparator` and holds no two equivalent keys.
+    flat_map(sorted_unique_t,
+             const key_container_type&    keys,
+             const mapped_container_type& values,
+             const COMPARATOR&            comparator = COMPARATOR(),
+             const ALLOCATOR&             basicAllocator = ALLOCATOR());
+
+    /// Create a map holding the pairs formed by the corresponding elements
+    /// of the specified `keys` and `values` vectors, whose keys are sorted
+    /// and unique as indicated by the specified `sorted_unique_t` tag, by
+    /// moving the vectors into the map, which adopts their allocators.
+    /// Optionally specify a `comparator` used to order keys in the map.
+    /// `keys` and `values` are left in a valid but unspecified state.  The
+    /// behavior is undefined unless `keys.size() == values.size()`, and
+    /// `keys` is sorted with respect to `comparator` and holds no two
+    /// equivalent keys.
+    flat_map(sorted_unique_t,
+             BloombergLP::bslmf::MovableRef<key_container_type>    keys,
+             BloombergLP::bslmf::MovableRef<mapped_container_type> values,
+             const COMPARATOR& comparator = COMPARATOR());
+
+    /// Create a map, and insert each pair in the range starting at the
+    /// specified `first` iterator and ending immediately before the
+    /// specified `last` iterator, keeping only the first of the pairs having
+    /// equivalent keys.  Optionally specify a `comparator` used to order
+    /// keys in the map.  Optionally specify a `basicAllocator` used to
+    /// supply memory; otherwise the default allocator is used.  This
+    /// operation has `O[N * log(N)]` complexity, where `N` is the length of
+    /// the range.  The (template parameter) type `INPUT_ITERATOR` shall
+    /// meet the requirements of an input iterator providing access to
+    /// objects having `first` and `second` members convertible to `KEY` and
+    /// `VALUE`, respectively.  The behavior is undefined unless `first` and
+    /// `last` refer to a sequence of valid values where `first` is at a
+    /// position at or before `last`.
+    template <class INPUT_ITERATOR>
+    flat_map(INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const COMPARATOR& comparator = COMPARATOR(),
+             const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_map(INPUT_ITERATOR   first,
+             INPUT_ITERATOR   last,
+             const ALLOCATOR& basicAllocator);
+
+    /// Create a map holding the pairs in the range starting at the specified
+    /// `first` iterator and ending immediately before the specified `last`
+    /// iterator, whose keys are sorted and unique as indicated by the
+    /// specified `sorted_unique_t` tag.  Optionally specify a `comparator`
+    /// used to order keys in the map.  Optionally specify a `basicAllocator`
+    /// used to supply memory; otherwise the default allocator is used.  This
+    /// operation has `O[N]` complexity, where `N` is the length of the
+    /// range.  The behavior is undefined unless the keys in the range are
+    /// sorted with respect to `comparator` and unique.
+    template <class INPUT_ITERATOR>
+    flat_map(sorted_unique_t,
+             INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const COMPARATOR& comparator = COMPARATOR(),
+             const ALLOCATOR&  basicAllocator = ALLOCATOR());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    /// Create a map, and insert each pair in the specified `values`
+    /// initializer list, keeping only the first of the pairs having
+    /// equivalent keys.  Optionally specify a `comparator` used to order
+    /// keys in the map.  Optionally specify a `basicAllocator` used to
+    /// supply memory; otherwise the default allocator is used.
+    flat_map(std::initializer_list<value_type> values,
+             const COMPARATOR&                 comparator = COMPARATOR(),
+             const ALLOCATOR&                  basicAllocator = ALLOCATOR());
+    flat_map(std::initializer_list<value_type> values,
+             const ALLOCATOR&                  basicAllocator);
+
+    /// Create a map holding the pairs in the specified `values` initializer
+    /// list, whose keys are sorted and unique as indicated by the specified
+    /// `sorted_unique_t` tag.  Optionally specify a `comparator` used to
+    /// order keys in the map.  Optionally specify a `basicAllocator` used to
+    /// supply memory; otherwise the default allocator is used.  The behavior
+    /// is undefined unless the keys in `values` are sorted with respect to
+    /// `comparator` and unique.
+    flat_map(sorted_unique_t,
+             std::initializer_list<value_type> values,
+             const COMPARATOR&                 comparator = COMPARATOR(),
+             const ALLOCATOR&                  basicAllocator = ALLOCATOR());
+#endif
+
+    /// Create a map having the same value as the specified `original`
+    /// object.  Use a copy of `original.key_comp()` to order the keys in
+    /// this map.  Optionally specify a `basicAllocator` used to supply
+    /// memory; otherwise the default allocator is used.
+    flat_map(const flat_map& original);
+    flat_map(const flat_map& original, const ALLOCATOR& basicAllocator);
+
+    /// Create a map having the same value as the specified `original`
+    /// object by moving (in constant time) the contents of `original` to the
+    /// new map.  Use a copy of `original.key_comp()` to order the keys in
+    /// this map.  The allocator associated with `original` is propagated for
+    /// use in the newly-created map.  `original` is left in a valid but
+    /// unspecified state.
+    flat_map(BloombergLP::bslmf::MovableRef<flat_map> original);  // IMPLICIT
+
+    /// Create a map having the same value as the specified `original` object
+    /// that uses the specified `basicAllocator` to supply memory.  The
+    /// elements of `original` are moved (in constant time) if
+    /// `basicAllocator == original.get_allocator()`, and are move-inserted
+    /// (in linear time) otherwise.  `original` is left in a valid but
+    /// unspecified state.
+    flat_map(BloombergLP::bslmf::MovableRef<flat_map> original,
+             const ALLOCATOR&                         basicAllocator);
+
+    // MANIPULATORS
+
+    /// Assign to this object the value and comparator of the specified `rhs`
+    /// object, and return a reference providing modifiable access to this
+    /// object.
+    flat_map& operator=(const flat_map& rhs);
+
+    /// Assign to this object the value and comparator of the specified `rhs`
+    /// object, and return a reference providing modifiable access to this
+    /// object.  The elements of `rhs` are moved (in constant time) if the
+    /// allocators of the two maps are equal, and are move-inserted (in
+    /// linear time) otherwise.  `rhs` is left in a valid but unspecified
+    /// state.
+    flat_map& operator=(BloombergLP::bslmf::MovableRef<flat_map> rhs);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    /// Assign to this object the value resulting from first clearing this
+    /// map and then inserting each pair in the specified `values`
+    /// initializer list, keeping only the first of the pairs having
+    /// equivalent keys, and return a reference providing modifiable access
+    /// to this object.
+    flat_map& operator=(std::initializer_list<value_type> values);
+#endif
+
+    /// Return a reference providing modifiable access to the value
+    /// associated with the specified `key` in this map; if this map does
+    /// not contain a key equivalent to `key`, first insert the pair of a
+    /// copy of `key` and a value-initialized `VALUE`.  This operation has
+    /// `O[log(N)]` complexity if `key` is present, and `O[N]` otherwise,
+    /// where `N` is the size of this map.
+    VALUE& operator[](const key_type& key);
+
+    /// Return a reference providing modifiable access to the value
+    /// associated with the specified `key` in this map; if this map does
+    /// not contain a key equivalent to `key`, first insert the pair of `key`
+    /// (which is left in a valid but unspecified state) and a
+    /// value-initialized `VALUE`.
+    VALUE& operator[](BloombergLP::bslmf::MovableRef<key_type> key);
+
+    /// Return a reference providing modifiable access to the value
+    /// associated with the specified `key` in this map.  Throw a
+    /// `std::out_of_range` exception if this map does not contain a key
+    /// equivalent to `key`.
+    VALUE& at(const key_type& key);
+
+    /// Return an iterator providing modifiable access to the first element
+    /// in the ordered sequence of elements held by this map, or the `end`
+    /// iterator if this map is empty.
+    iterator begin() BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return an iterator providing modifiable access to the past-the-end
+    /// position in the ordered sequence of elements held by this map.
+    iterator end() BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return a reverse iterator providing modifiable access to the last
+    /// element in the ordered sequence of elements held by this map, or
+    /// `rend` if this map is empty.
+    reverse_iterator rbegin() BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return a reverse iterator providing modifiable access to the
+    /// prior-to-the-beginning position in the ordered sequence of elements
+    /// held by this map.
+    reverse_iterator rend() BSLS_KEYWORD_NOEXCEPT;
+
+    /// Insert the specified `value` into this map if a key equivalent to
+    /// `value.first` does not already exist in this map; otherwise, this
+    /// method has no effect.  Return a pair whose `first` member is an
+    /// iterator referring to the (possibly newly inserted) element in this
+    /// map whose key is equivalent to `value.first`, and whose `second`
+    /// member is `true` if a new element was inserted, and `false` if the
+    /// key was already present.  This operation has `O[N]` complexity, where
+    /// `N` is the size of this map.
+    pair<iterator, bool> insert(const value_type& value);
+
+    /// Insert the specified `value` into this map if a key equivalent to
+    /// `value.first` does not already exist in this map; otherwise, this
+    /// method has no effect.  `value` is left in a valid but unspecified
+    /// state if it is inserted.  Return a pair whose `first` member is an
+    /// iterator referring to the (possibly newly inserted) element in this
+    /// map whose key is equivalent to `value.first`, and whose `second`
+    /// member is `true` if a new element was inserted, and `false` if the
+    /// key was already present.
+    pair<iterator, bool> insert(
+                             BloombergLP::bslmf::MovableRef<value_type> value);
+
+    /// Insert the specified `value` into this map (in amortized constant
+    /// time if the specified `hint` is the position at which `value`
+    /// belongs) if a key equivalent to `value.first` does not already exist
+    /// in this map; otherwise, this method has no effect.  Return an
+    /// iterator referring to the (possibly newly inserted) element in this
+    /// map whose key is equivalent to `value.first`.  The behavior is
+    /// undefined unless `hint` is an iterator in the range
+    /// `[begin() .. end()]` (both endpoints included).
+    iterator insert(const_iterator hint, const value_type& value);
+    iterator insert(const_iterator                             hint,
+                    BloombergLP::bslmf::MovableRef<value_type> value);
+
+    /// Insert into this map the pairs in the range starting at the specified
+    /// `first` iterator and ending immediately before the specified `last`
+    /// iterator, ignoring each pair whose key is equivalent to a key already
+    /// in this map or earlier in the range.  The pairs are appended and then
+    /// merged with the elements of this map in one pass, for
+    /// `O[N * log(N) + M]` complexity, where `N` is the length of the range
+    /// and `M` the size of this map.  If an exception is thrown, this map is
+    /// left with its original value unless a move constructor of `KEY` or
+    /// `VALUE` throws, in which case the map is left empty.  The behavior is
+    /// undefined unless `first` and `last` refer to a sequence of valid
+    /// values where `first` is at a position at or before `last`.
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+
+    /// Insert into this map the pairs in the range starting at the specified
+    /// `first` iterator and ending immediately before the specified `last`
+    /// iterator, whose keys are sorted and unique as indicated by the
+    /// specified `sorted_unique_t` tag, ignoring each pair whose key is
+    /// equivalent to a key already in this map.  This operation has
+    /// `O[N + M]` complexity, where `N` is the length of the range and `M`
+    /// the size of this map, and `O[N]` complexity if every key in the range
+    /// is greater than every key in this map.  The behavior is undefined
+    /// unless the keys in the range are sorted with respect to `key_comp()`
+    /// and unique.
+    template <class INPUT_ITERATOR>
+    void insert(sorted_unique_t, INPUT_ITERATOR first, INPUT_ITERATOR last);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    /// Insert into this map the pairs in the specified `values` initializer
+    /// list, ignoring each pair whose key is equivalent to a key already in
+    /// this map or earlier in the list.
+    void insert(std::initializer_list<value_type> values);
+
+    /// Insert into this map the pairs in the specified `values` initializer
+    /// list, whose keys are sorted and unique as indicated by the specified
+    /// `sorted_unique_t` tag, ignoring each pair whose key is equivalent to
+    /// a key already in this map.  The behavior is undefined unless the keys
+    /// in `values` are sorted with respect to `key_comp()` and unique.
+    void insert(sorted_unique_t, std::initializer_list<value_type> values);
+#endif
+
+    /// Remove from this map the element at the specified `position`, and
+    /// return an iterator referring to the element immediately following the
+    /// removed element, or to the past-the-end position if the removed
+    /// element was the last in the sequence.  The behavior is undefined
+    /// unless `position` refers to an element in this map.
+    iterator erase(iterator position);
+    iterator erase(const_iterator position);
+
+    /// Remove from this map the element whose key is equivalent to the
+    /// specified `key`, if such an element exists, and return the number of
+    /// elements removed (0 or 1).
+    size_type erase(const key_type& key);
+
+    /// Remove from this map the elements starting at the specified `first`
+    /// position up to, but not including, the specified `last` position, and
+    /// return an iterator to the element at `last`.  The behavior is
+    /// undefined unless `first` and `last` either refer to elements in this
+    /// map or are the `end` iterator, and the `first` position is at or
+    /// before the `last` position in the ordered sequence provided by this
+    /// container.
+    iterator erase(const_iterator first, const_iterator last);
+
+    /// Replace the elements of this map by moving the specified `keys` and
+    /// `values` vectors into this map.  The behavior is undefined unless
+    /// `keys.size() == values.size()`, and `keys` is sorted with respect to
+    /// `key_comp()` and holds no two equivalent keys.
+    void replace(BloombergLP::bslmf::MovableRef<key_container_type>    keys,
+                 BloombergLP::bslmf::MovableRef<mapped_container_type> values);
+
+    /// Exchange the value and comparator of this object with those of the
+    /// specified `other` object.  This method provides the no-throw
+    /// exception-safety guarantee.  The behavior is undefined unless this
+    /// object was created with the same allocator as `other`.
+    void swap(flat_map& other) BSLS_KEYWORD_NOEXCEPT;
+
+    /// Remove all elements from this map, retaining the capacity of the
+    /// underlying vectors.
+    void clear() BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return an iterator providing modifiable access to the element in this
+    /// map whose key is equivalent to the specified `key`, if such an
+    /// element exists, and `end()` otherwise.  This operation has
+    /// `O[log(N)]` complexity, where `N` is the size of this map.
+    iterator find(const key_type& key);
+
+    /// Return an iterator providing modifiable access to the first element
+    /// in this map whose key is not less than the specified `key`, or
+    /// `end()` if there is no such element.
+    iterator lower_bound(const key_type& key);
+
+    /// Return an iterator providing modifiable access to the first element
+    /// in this map whose key is greater than the specified `key`, or `end()`
+    /// if there is no such element.
+    iterator upper_bound(const key_type& key);
+
+    /// Return a pair of iterators providing modifiable access to the
+    /// (possibly empty) range of elements in this map whose keys are
+    /// equivalent to the specified `key`.
+    pair<iterator, iterator> equal_range(const key_type& key);
+
+    // ACCESSORS
+
+    /// Return a reference providing non-modifiable access to the value
+    /// associated with the specified `key` in this map.  Throw a
+    /// `std::out_of_range` exception if this map does not contain a key
+    /// equivalent to `key`.
+    const VALUE& at(const key_type& key) const;
+
+    /// Return an iterator providing non-modifiable access to the first
+    /// element in the ordered sequence of elements held by this map, or the
+    /// `end` iterator if this map is empty.
+    const_iterator begin() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cbegin() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return an iterator providing non-modifiable access to the
+    /// past-the-end position in the ordered sequence of elements held by
+    /// this map.
+    const_iterator end() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cend() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return a reverse iterator providing non-modifiable access to the last
+    /// element in the ordered sequence of elements held by this map, or
+    /// `rend` if this map is empty.
+    const_reverse_iterator rbegin() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crbegin() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return a reverse iterator providing non-modifiable access to the
+    /// prior-to-the-beginning position in the ordered sequence of elements
+    /// held by this map.
+    const_reverse_iterator rend() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crend() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return `true` if this map contains no elements, and `false`
+    /// otherwise.
+    bool empty() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return the number of elements in this map.
+    size_type size() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return a theoretical upper bound on the largest number of elements
+    /// that this map could possibly hold.
+    size_type max_size() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return (a copy of) the allocator used for memory allocation by this
+    /// map.
+    allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return the key-comparison functor (or function pointer) used by this
+    /// map.
+    key_compare key_comp() const;
+
+    /// Return a functor that orders key-value pairs by applying `key_comp()`
+    /// to their keys.
+    value_compare value_comp() const;
+
+    /// Return an iterator providing non-modifiable access to the element in
+    /// this map whose key is equivalent to the specified `key`, if such an
+    /// element exists, and `end()` otherwise.  This operation has
+    /// `O[log(N)]` complexity, where `N` is the size of this map.
+    const_iterator find(const key_type& key) const;
+
+    /// Return the number of elements in this map whose key is equivalent to
+    /// the specified `key` (0 or 1).
+    size_type count(const key_type& key) const;
+
+    /// Return `true` if this map contains an element whose key is equivalent
+    /// to the specified `key`, and `false` otherwise.
+    bool contains(const key_type& key) const;
+
+    /// Return an iterator providing non-modifiable access to the first
+    /// element in this map whose key is not less than the specified `key`,
+    /// or `end()` if there is no such element.
+    const_iterator lower_bound(const key_type& key) const;
+
+    /// Return an iterator providing non-modifiable access to the first
+    /// element in this map whose key is greater than the specified `key`, or
+    /// `end()` if there is no such element.
+    const_iterator upper_bound(const key_type& key) const;
+
+    /// Return a pair of iterators providing non-modifiable access to the
+    /// (possibly empty) range of elements in this map whose keys are
+    /// equivalent to the specified `key`.
+    pair<const_iterator, const_iterator> equal_range(
+                                                  const key_type& key) const;
+
+    /// Return a reference providing non-modifiable access to the sorted
+    /// vector of keys held by this map.
+    const key_container_type& keys() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return a reference providing non-modifiable access to the vector of
+    /// values held by this map, in the order of their keys.
+    const mapped_container_type& values() const BSLS_KEYWORD_NOEXCEPT;
+};
+
+                            // ===================
+                            // class flat_multimap
+                            // ===================
+
+/// This class template implements a value-semantic container type holding an
+/// ordered sequence of key-value pairs having possibly equivalent keys (of
+/// the template parameter type `KEY`) and associated values (of the template
+/// parameter type `VALUE`), stored in two parallel sorted `bsl::vector`
+/// objects.  Keys
+/// are ordered by a comparator of the template parameter type `COMPARATOR`,
+/// and memory is supplied by allocators rebound from the template parameter
+/// type `ALLOCATOR`.
+template <class KEY,
+          class VALUE,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = allocator<pair<KEY, VALUE> > >
+class flat_multimap {
+
+    // PRIVATE TYPES
+
+    /// This typedef is a convenient alias for the utility associated with
+    /// movable references.
+    typedef BloombergLP::bslmf::MovableRefUtil                   MoveUtil;
+
+    typedef bsl::allocator_traits<ALLOCATOR>                     AllocTraits;
+    typedef typename AllocTraits::template rebind_traits<KEY>::allocator_type
+                                                                 KeyAllocator;
+    typedef typename AllocTraits::template rebind_traits<VALUE>::
+                                                allocator_type ValueAllocator;
+
+    typedef BloombergLP::bslstl::FlatMap_Util                    Util;
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                                  key_type;
+    typedef VALUE                                                mapped_type;
+    typedef pair<KEY, VALUE>                                     value_type;
+    typedef COMPARATOR                                           key_compare;
+    typedef ALLOCATOR                                         allocator_type;
+    typedef pair<const KEY&, VALUE&>                             reference;
+    typedef pair<const KEY&, const VALUE&>                  const_reference;
+    typedef vector<KEY, KeyAllocator>                   key_container_type;
+    typedef vector<VALUE, ValueAllocator>            mapped_container_type;
+    typedef std::size_t                                          size_type;
+    typedef std::ptrdiff_t                                 difference_type;
+
+    typedef BloombergLP::bslstl::FlatMap_Iterator<KEY, VALUE>    iterator;
+    typedef BloombergLP::bslstl::FlatMap_Iterator<KEY, const VALUE>
+                                                            const_iterator;
+    typedef bsl::reverse_iterator<iterator>              reverse_iterator;
+    typedef bsl::reverse_iterator<const_iterator>  const_reverse_iterator;
+
+    typedef BloombergLP::bslstl::FlatMap_ValueCompare<COMPARATOR>
+                                                             value_compare;
+
+  private:
+    // PRIVATE TYPES
+    typedef BloombergLP::bslstl::FlatMap_RangeProctor<key_container_type,
+                                                      mapped_container_type>
+                                                                  Proctor;
+
+    // DATA
+    key_container_type    d_keys;     // sorted keys
+    mapped_container_type d_values;   // values, parallel to `d_keys`
+    COMPARATOR            d_compare;  // ordering of `d_keys`
+
+    // FRIENDS
+    template <class KEY2,
+              class VALUE2,
+              class COMPARATOR2,
+              class ALLOCATOR2,
+              class PREDICATE>
+    friend
+    typename flat_multimap<KEY2, VALUE2, COMPARATOR2, ALLOCATOR2>::size_type
+    erase_if(flat_multimap<KEY2, VALUE2, COMPARATOR2, ALLOCATOR2>& m,
+             PREDICATE                                             predicate);
+
+    // PRIVATE MANIPULATORS
+
+    /// Return an iterator to the element at the specified `index`.
+    iterator iteratorAt(size_type index);
+
+    // PRIVATE ACCESSORS
+
+    /// Return an iterator to the element at the specified `index`.
+    const_iterator iteratorAt(size_type index) const;
+
+    /// Return `true` if an element having the specified `key` can be
+    /// inserted at the specified `index` without breaking the ordering of
+    /// this map, and `false` otherwise.
+    bool isInsertionPoint(size_type index, const KEY& key) const;
+
+  public:
+    // CREATORS
+
+    /// Create an empty map.  Optionally specify a `comparator` used to
+    /// order keys in the map.  If `comparator` is not supplied, a
+    /// default-constructed object of the (template parameter) type
+    /// `COMPARATOR` is used.  Optionally specify a `basicAllocator` used to
+    /// supply memory.  If `basicAllocator` is not supplied, a
+    /// default-constructed object of the (template parameter) type
+    /// `ALLOCATOR` is used.  If `ALLOCATOR` is `bsl::allocator` (the
+    /// default), then `basicAllocator`, if supplied, shall be convertible to
+    /// `bslma::Allocator *`.  If `ALLOCATOR` is `bsl::allocator` and
+    /// `basicAllocator` is not supplied, the currently installed default
+    /// allocator is used.
+    flat_multimap();
+    explicit flat_multimap(const COMPARATOR& comparator,
+                           const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    explicit flat_multimap(const ALLOCATOR& basicAllocator);
+
+    /// Create a map holding the pairs formed by the corresponding elements
+    /// of the specified `keys` and `values` vectors, stably sorted by key.
+    /// Optionally specify a `comparator` used to order keys in the map.
+    /// Optionally specify a `basicAllocator` used to supply memory;
+    /// otherwise the default allocator is used.  This operation has
+    /// `O[N * log(N)]` complexity, where `N` is `keys.size()`.  The behavior
+    /// is undefined unless `keys.size() == values.size()`.
+    flat_multimap(const key_container_type&    keys,
+                  const mapped_container_type& values,
+                  const COMPARATOR&            comparator = COMPARATOR(),
+                  const ALLOCATOR&             basicAllocator = ALLOCATOR());
+
+    /// Create a map holding the pairs formed by the corresponding elements
+    /// of the specified `keys` and `values` vectors, stably sorted by key,
+    /// by moving the vectors into the map, which adopts their allocators.
+    /// Optionally specify a `comparator` used to order keys in the map.
+    /// `keys` and `values` are left in a valid but unspecified state.  The
+    /// behavior is undefined unless `keys.size() == values.size()`.
+    flat_multimap(
+                 BloombergLP::bslmf::MovableRef<key_container_type>    keys,
+                 BloombergLP::bslmf::MovableRef<mapped_container_type> values,
+                 const COMPARATOR& comparator = COMPARATOR());
+
+    /// Create a map holding the pairs formed by the corresponding elements
+    /// of the specified `keys` and `values` vectors, whose keys are sorted
+    /// as indicated by the specified `sorted_equivalent_t` tag.  Optionally
+    /// specify a `comparator` used to order keys in the map.  Optionally
+    /// specify a `basicAllocator` used to supply memory; otherwise the
+    /// default allocator is used.  The behavior is undefined unless
+    /// `keys.size() == values.size()`, and `keys` is sorted with respect to
+    /// `comparator`.
+    flat_multimap(sorted_equivalent_t,
+                  const key_container_type&    keys,
+                  const mapped_container_type& values,
+                  const COMPARATOR&            comparator = COMPARATOR(),
+                  const ALLOCATOR&             basicAllocator = ALLOCATOR());
+
+    /// Create a map holding the pairs formed by the corresponding elements
+    /// of the specified `keys` and `values` vectors, whose keys are sorted
+    /// as indicated by the specified `sorted_equivalent_t` tag, by moving
+    /// the vectors into the map, which adopts their allocators.  Optionally
+    /// specify a `comparator` used to order keys in the map.  `keys` and
+    /// `values` are left in a valid but unspecified state.  The behavior is
+    /// undefined unless `keys.size() == values.size()`, and `keys` is sorted
+    /// with respect to `comparator`.
+    flat_multimap(
+                 sorted_equivalent_t,
+                 BloombergLP::bslmf::MovableRef<key_container_type>    keys,
+                 BloombergLP::bslmf::MovableRef<mapped_container_type> values,
+                 const COMPARATOR& comparator = COMPARATOR());
+
+    /// Create a map, and insert each pair in the range starting at the
+    /// specified `first` iterator and ending immediately before the
+    /// specified `last` iterator.  Optionally specify a `comparator` used to
+    /// order keys in the map.  Optionally specify a `basicAllocator` used to
+    /// supply memory; otherwise the default allocator is used.  This
+    /// operation has `O[N * log(N)]` complexity, where `N` is the length of
+    /// the range.  The (template parameter) type `INPUT_ITERATOR` shall
+    /// meet the requirements of an input iterator providing access to
+    /// objects having `first` and `second` members convertible to `KEY` and
+    /// `VALUE`, respectively.  The behavior is undefined unless `first` and
+    /// `last` refer to a sequence of valid values where `first` is at a
+    /// position at or before `last`.
+    template <class INPUT_ITERATOR>
+    flat_multimap(INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  const COMPARATOR& comparator = COMPARATOR(),
+                  const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_multimap(INPUT_ITERATOR   first,
+                  INPUT_ITERATOR   last,
+                  const ALLOCATOR& basicAllocator);
+
+    /// Create a map holding the pairs in the range starting at the specified
+    /// `first` iterator and ending immediately before the specified `last`
+    /// iterator, whose keys are sorted as indicated by the specified
+    /// `sorted_equivalent_t` tag.  Optionally specify a `comparator` used to
+    /// order keys in the map.  Optionally specify a `basicAllocator` used to
+    /// supply memory; otherwise the default allocator is used.  This
+    /// operation has `O[N]` complexity, where `N` is the length of the
+    /// range.  The behavior is undefined unless the keys in the range are
+    /// sorted with respect to `comparator`.
+    template <class INPUT_ITERATOR>
+    flat_multimap(sorted_equivalent_t,
+                  INPUT_ITERATOR    first,
+                  INPUT_ITERATOR    last,
+                  const COMPARATOR& comparator = COMPARATOR(),
+                  const ALLOCATOR&  basicAllocator = ALLOCATOR());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    /// Create a map, and insert each pair in the specified `values`
+    /// initializer list.  Optionally specify a `comparator` used to order
+    /// keys in the map.  Optionally specify a `basicAllocator` used to
+    /// supply memory; otherwise the default allocator is used.
+    flat_multimap(
+               std::initializer_list<value_type> values,
+               const COMPARATOR&                 comparator = COMPARATOR(),
+               const ALLOCATOR&                  basicAllocator = ALLOCATOR());
+    flat_multimap(std::initializer_list<value_type> values,
+                  const ALLOCATOR&                  basicAllocator);
+
+    /// Create a map holding the pairs in the specified `values` initializer
+    /// list, whose keys are sorted as indicated by the specified
+    /// `sorted_equivalent_t` tag.  Optionally specify a `comparator` used to
+    /// order keys in the map.  Optionally specify a `basicAllocator` used to
+    /// supply memory; otherwise the default allocator is used.  The behavior
+    /// is undefined unless the keys in `values` are sorted with respect to
+    /// `comparator`.
+    flat_multimap(
+               sorted_equivalent_t,
+               std::initializer_list<value_type> values,
+               const COMPARATOR&                 comparator = COMPARATOR(),
+               const ALLOCATOR&                  basicAllocator = ALLOCATOR());
+#endif
+
+    /// Create a map having the same value as the specified `original`
+    /// object.  Use a copy of `original.key_comp()` to order the keys in
+    /// this map.  Optionally specify a `basicAllocator` used to supply
+    /// memory; otherwise the default allocator is used.
+    flat_multimap(const flat_multimap& original);
+    flat_multimap(const flat_multimap& original,
+                  const ALLOCATOR&     basicAllocator);
+
+    /// Create a map having the same value as the specified `original`
+    /// object by moving (in constant time) the contents of `original` to the
+    /// new map.  Use a copy of `original.key_comp()` to order the keys in
+    /// this map.  The allocator associated with `original` is propagated for
+    /// use in the newly-created map.  `original` is left in a valid but
+    /// unspecified state.
+    flat_multimap(                                              // IMPLICIT
+                    BloombergLP::bslmf::MovableRef<flat_multimap> original);
+
+    /// Create a map having the same value as the specified `original` object
+    /// that uses the specified `basicAllocator` to supply memory.  The
+    /// elements of `original` are moved (in constant time) if
+    /// `basicAllocator == original.get_allocator()`, and are move-inserted
+    /// (in linear time) otherwise.  `original` is left in a valid but
+    /// unspecified state.
+    flat_multimap(
+                 BloombergLP::bslmf::MovableRef<flat_multimap> original,
+                 const ALLOCATOR&                              basicAllocator);
+
+    // MANIPULATORS
+
+    /// Assign to this object the value and comparator of the specified `rhs`
+    /// object, and return a reference providing modifiable access to this
+    /// object.
+    flat_multimap& operator=(const flat_multimap& rhs);
+
+    /// Assign to this object the value and comparator of the specified `rhs`
+    /// object, and return a reference providing modifiable access to this
+    /// object.  The elements of `rhs` are moved (in constant time) if the
+    /// allocators of the two maps are equal, and are move-inserted (in
+    /// linear time) otherwise.  `rhs` is left in a valid but unspecified
+    /// state.
+    flat_multimap& operator=(
+                            BloombergLP::bslmf::MovableRef<flat_multimap> rhs);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    /// Assign to this object the value resulting from first clearing this
+    /// map and then inserting each pair in the specified `values`
+    /// initializer list, and return a reference providing modifiable access
+    /// to this object.
+    flat_multimap& operator=(std::initializer_list<value_type> values);
+#endif
+
+    /// Return an iterator providing modifiable access to the first element
+    /// in the ordered sequence of elements held by this map, or the `end`
+    /// iterator if this map is empty.
+    iterator begin() BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return an iterator providing modifiable access to the past-the-end
+    /// position in the ordered sequence of elements held by this map.
+    iterator end() BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return a reverse iterator providing modifiable access to the last
+    /// element in the ordered sequence of elements held by this map, or
+    /// `rend` if this map is empty.
+    reverse_iterator rbegin() BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return a reverse iterator providing modifiable access to the
+    /// prior-to-the-beginning position in the ordered sequence of elements
+    /// held by this map.
+    reverse_iterator rend() BSLS_KEYWORD_NOEXCEPT;
+
+    /// Insert the specified `value` into this map after any elements whose
+    /// keys are equivalent to `value.first`, and return an iterator
+    /// referring to the newly inserted element.  This operation has `O[N]`
+    /// complexity, where `N` is the size of this map.
+    iterator insert(const value_type& value);
+
+    /// Insert the specified `value` into this map after any elements whose
+    /// keys are equivalent to `value.first`, and return an iterator
+    /// referring to the newly inserted element.  `value` is left in a valid
+    /// but unspecified state.
+    iterator insert(BloombergLP::bslmf::MovableRef<value_type> value);
+
+    /// Insert the specified `value` into this map, immediately before the
+    /// specified `hint` (in amortized constant time) if that position keeps
+    /// the keys of this map sorted, and after any elements whose keys are
+    /// equivalent to `value.first` otherwise.  Return an iterator referring
+    /// to the newly inserted element.  The behavior is undefined unless
+    /// `hint` is an iterator in the range `[begin() .. end()]` (both
+    /// endpoints included).
+    iterator insert(const_iterator hint, const value_type& value);
+    iterator insert(const_iterator                             hint,
+                    BloombergLP::bslmf::MovableRef<value_type> value);
+
+    /// Insert into this map the pairs in the range starting at the specified
+    /// `first` iterator and ending immediately before the specified `last`
+    /// iterator, each after the elements of this map and the earlier pairs
+    /// in the range having equivalent keys.  The pairs are appended and then
+    /// merged with the elements of this map in one pass, for
+    /// `O[N * log(N) + M]` complexity, where `N` is the length of the range
+    /// and `M` the size of this map.  If an exception is thrown, this map is
+    /// left with its original value unless a move constructor of `KEY` or
+    /// `VALUE` throws, in which case the map is left empty.  The behavior is
+    /// undefined unless `first` and `last` refer to a sequence of valid
+    /// values where `first` is at a position at or before `last`.
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+
+    /// Insert into this map the pairs in the range starting at the specified
+    /// `first` iterator and ending immediately before the specified `last`
+    /// iterator, whose keys are sorted as indicated by the specified
+    /// `sorted_equivalent_t` tag, each after the elements of this map having
+    /// equivalent keys.  This operation has `O[N + M]` complexity, where `N`
+    /// is the length of the range and `M` the size of this map, and `O[N]`
+    /// complexity if no key in the range is less than a key in this map.
+    /// The behavior is undefined unless the keys in the range are sorted
+    /// with respect to `key_comp()`.
+    template <class INPUT_ITERATOR>
+    void insert(sorted_equivalent_t,
+                INPUT_ITERATOR first,
+                INPUT_ITERATOR last);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    /// Insert into this map the pairs in the specified `values` initializer
+    /// list.
+    void insert(std::initializer_list<value_type> values);
+
+    /// Insert into this map the pairs in the specified `values` initializer
+    /// list, whose keys are sorted as indicated by the specified
+    /// `sorted_equivalent_t` tag.  The behavior is undefined unless the keys
+    /// in `values` are sorted with respect to `key_comp()`.
+    void insert(sorted_equivalent_t,
+                std::initializer_list<value_type> values);
+#endif
+
+    /// Remove from this map the element at the specified `position`, and
+    /// return an iterator referring to the element immediately following the
+    /// removed element, or to the past-the-end position if the removed
+    /// element was the last in the sequence.  The behavior is undefined
+    /// unless `position` refers to an element in this map.
+    iterator erase(iterator position);
+    iterator erase(const_iterator position);
+
+    /// Remove from this map the elements whose keys are equivalent to the
+    /// specified `key`, and return the number of elements removed.
+    size_type erase(const key_type& key);
+
+    /// Remove from this map the elements starting at the specified `first`
+    /// position up to, but not including, the specified `last` position, and
+    /// return an iterator to the element at `last`.  The behavior is
+    /// undefined unless `first` and `last` either refer to elements in this
+    /// map or are the `end` iterator, and the `first` position is at or
+    /// before the `last` position in the ordered sequence provided by this
+    /// container.
+    iterator erase(const_iterator first, const_iterator last);
+
+    /// Replace the elements of this map by moving the specified `keys` and
+    /// `values` vectors into this map.  The behavior is undefined unless
+    /// `keys.size() == values.size()`, and `keys` is sorted with respect to
+    /// `key_comp()`.
+    void replace(BloombergLP::bslmf::MovableRef<key_container_type>    keys,
+                 BloombergLP::bslmf::MovableRef<mapped_container_type> values);
+
+    /// Exchange the value and comparator of this object with those of the
+    /// specified `other` object.  This method provides the no-throw
+    /// exception-safety guarantee.  The behavior is undefined unless this
+    /// object was created with the same allocator as `other`.
+    void swap(flat_multimap& other) BSLS_KEYWORD_NOEXCEPT;
+
+    /// Remove all elements from this map, retaining the capacity of the
+    /// underlying vectors.
+    void clear() BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return an iterator providing modifiable access to the first element
+    /// in this map whose key is equivalent to the specified `key`, if such
+    /// an element exists, and `end()` otherwise.  This operation has
+    /// `O[log(N)]` complexity, where `N` is the size of this map.
+    iterator find(const key_type& key);
+
+    /// Return an iterator providing modifiable access to the first element
+    /// in this map whose key is not less than the specified `key`, or
+    /// `end()` if there is no such element.
+    iterator lower_bound(const key_type& key);
+
+    /// Return an iterator providing modifiable access to the first element
+    /// in this map whose key is greater than the specified `key`, or `end()`
+    /// if there is no such element.
+    iterator upper_bound(const key_type& key);
+
+    /// Return a pair of iterators providing modifiable access to the
+    /// (possibly empty) range of elements in this map whose keys are
+    /// equivalent to the specified `key`.
+    pair<iterator, iterator> equal_range(const key_type& key);
+
+    // ACCESSORS
+
+    /// Return an iterator providing non-modifiable access to the first
+    /// element in the ordered sequence of elements held by this map, or the
+    /// `end` iterator if this map is empty.
+    const_iterator begin() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cbegin() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return an iterator providing non-modifiable access to the
+    /// past-the-end position in the ordered sequence of elements held by
+    /// this map.
+    const_iterator end() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cend() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return a reverse iterator providing non-modifiable access to the last
+    /// element in the ordered sequence of elements held by this map, or
+    /// `rend` if this map is empty.
+    const_reverse_iterator rbegin() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crbegin() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return a reverse iterator providing non-modifiable access to the
+    /// prior-to-the-beginning position in the ordered sequence of elements
+    /// held by this map.
+    const_reverse_iterator rend() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crend() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return `true` if this map contains no elements, and `false`
+    /// otherwise.
+    bool empty() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return the number of elements in this map.
+    size_type size() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return a theoretical upper bound on the largest number of elements
+    /// that this map could possibly hold.
+    size_type max_size() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return (a copy of) the allocator used for memory allocation by this
+    /// map.
+    allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return the key-comparison functor (or function pointer) used by this
+    /// map.
+    key_compare key_comp() const;
+
+    /// Return a functor that orders key-value pairs by applying `key_comp()`
+    /// to their keys.
+    value_compare value_comp() const;
+
+    /// Return an iterator providing non-modifiable access to the first
+    /// element in this map whose key is equivalent to the specified `key`,
+    /// if such an element exists, and `end()` otherwise.  This operation has
+    /// `O[log(N)]` complexity, where `N` is the size of this map.
+    const_iterator find(const key_type& key) const;
+
+    /// Return the number of elements in this map whose key is equivalent to
+    /// the specified `key`.
+    size_type count(const key_type& key) const;
+
+    /// Return `true` if this map contains an element whose key is equivalent
+    /// to the specified `key`, and `false` otherwise.
+    bool contains(const key_type& key) const;
+
+    /// Return an iterator providing non-modifiable access to the first
+    /// element in this map whose key is not less than the specified `key`,
+    /// or `end()` if there is no such element.
+    const_iterator lower_bound(const key_type& key) const;
+
+    /// Return an iterator providing non-modifiable access to the first
+    /// element in this map whose key is greater than the specified `key`, or
+    /// `end()` if there is no such element.
+    const_iterator upper_bound(const key_type& key) const;
+
+    /// Return a pair of iterators providing non-modifiable access to the
+    /// (possibly empty) range of elements in this map whose keys are
+    /// equivalent to the specified `key`.
+    pair<const_iterator, const_iterator> equal_range(
+                                                  const key_type& key) const;
+
+    /// Return a reference providing non-modifiable access to the sorted
+    /// vector of keys held by this map.
+    const key_container_type& keys() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return a reference providing non-modifiable access to the vector of
+    /// values held by this map, in the order of their keys.
+    const mapped_container_type& values() const BSLS_KEYWORD_NOEXCEPT;
+};
+
+
+// FREE OPERATORS
+
+/// Return `true` if the specified `lhs` and `rhs` objects have the same
+/// value, and `false` otherwise.  Two `flat_map` objects have the same value
+/// if they have the same number of key-value pairs, and each pair in the
+/// ordered sequence of pairs of `lhs` has the same value as the
+/// corresponding pair in the ordered sequence of pairs of `rhs`.
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator==(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+
+#ifndef BSLS_COMPILERFEATURES_SUPPORT_THREE_WAY_COMPARISON
+/// Return `true` if the specified `lhs` and `rhs` objects do not have the
+/// same value, and `false` otherwise.
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+#endif
+
+/// Return `true` if the value of the specified `lhs` map is
+/// lexicographically less than that of the specified `rhs` map, and `false`
+/// otherwise.  This method requires that `operator<`, inducing a total
+/// order, be defined for `KEY` and `VALUE`.
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+
+/// Return `true` if the value of the specified `lhs` map is
+/// lexicographically greater than that of the specified `rhs` map, and
+/// `false` otherwise.  Note that this operator returns `rhs < lhs`.
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+
+/// Return `true` if the value of the specified `lhs` map is
+/// lexicographically less than or equal to that of the specified `rhs` map,
+/// and `false` otherwise.  Note that this operator returns `!(rhs < lhs)`.
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+
+/// Return `true` if the value of the specified `lhs` map is
+/// lexicographically greater than or equal to that of the specified `rhs`
+/// map, and `false` otherwise.  Note that this operator returns
+/// `!(lhs < rhs)`.
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+
+/// Return `true` if the specified `lhs` and `rhs` objects have the same
+/// value, and `false` otherwise.  Two `flat_multimap` objects have the same
+/// value if they have the same number of key-value pairs, and each pair in
+/// the ordered sequence of pairs of `lhs` has the same value as the
+/// corresponding pair in the ordered sequence of pairs of `rhs`.
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator==(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+
+#ifndef BSLS_COMPILERFEATURES_SUPPORT_THREE_WAY_COMPARISON
+/// Return `true` if the specified `lhs` and `rhs` objects do not have the
+/// same value, and `false` otherwise.
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+#endif
+
+/// Return `true` if the value of the specified `lhs` map is
+/// lexicographically less than that of the specified `rhs` map, and `false`
+/// otherwise.  This method requires that `operator<`, inducing a total
+/// order, be defined for `KEY` and `VALUE`.
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+
+/// Return `true` if the value of the specified `lhs` map is
+/// lexicographically greater than that of the specified `rhs` map, and
+/// `false` otherwise.  Note that this operator returns `rhs < lhs`.
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+
+/// Return `true` if the value of the specified `lhs` map is
+/// lexicographically less than or equal to that of the specified `rhs` map,
+/// and `false` otherwise.  Note that this operator returns `!(rhs < lhs)`.
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+
+/// Return `true` if the value of the specified `lhs` map is
+/// lexicographically greater than or equal to that of the specified `rhs`
+/// map, and `false` otherwise.  Note that this operator returns
+/// `!(lhs < rhs)`.
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs);
+
+// FREE FUNCTIONS
+
+/// Erase all the elements in the specified map `m` that satisfy the
+/// specified predicate `predicate`, which is invoked with a `const_reference`
+/// to each element.  Return the number of elements erased.  This operation
+/// has `O[N]` complexity, where `N` is the size of `m`.
+template <class KEY,
+          class VALUE,
+          class COMPARATOR,
+          class ALLOCATOR,
+          class PREDICATE>
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+erase_if(flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& m, PREDICATE predicate);
+
+/// Erase all the elements in the specified map `m` that satisfy the
+/// specified predicate `predicate`, which is invoked with a `const_reference`
+/// to each element.  Return the number of elements erased.  This operation
+/// has `O[N]` complexity, where `N` is the size of `m`.
+template <class KEY,
+          class VALUE,
+          class COMPARATOR,
+          class ALLOCATOR,
+          class PREDICATE>
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+erase_if(flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& m,
+         PREDICATE                                         predicate);
+
+/// Exchange the value and comparator of the specified `a` object with those
+/// of the specified `b` object; the allocators of `a` and `b` are not
+/// modified.  This operation has `O[1]` complexity if `a` was created with
+/// the same allocator as `b`; otherwise, it has `O[n + m]` complexity, where
+/// `n` and `m` are the number of elements in `a` and `b`, respectively, and
+/// if an exception is thrown both objects are left unchanged.  Note that
+/// this function's support for swapping objects created with different
+/// allocators is a departure from the C++ Standard.
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void swap(flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+          flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& b)
+                                    BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+
+/// Exchange the value and comparator of the specified `a` object with those
+/// of the specified `b` object; the allocators of `a` and `b` are not
+/// modified.  This operation has `O[1]` complexity if `a` was created with
+/// the same allocator as `b`; otherwise, it has `O[n + m]` complexity, where
+/// `n` and `m` are the number of elements in `a` and `b`, respectively, and
+/// if an exception is thrown both objects are left unchanged.  Note that
+/// this function's support for swapping objects created with different
+/// allocators is a departure from the C++ Standard.
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void swap(flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+          flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& b)
+                                    BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+
+}  // close namespace bsl
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+namespace BloombergLP {
+namespace bslstl {
+
+                          // ------------------------
+                          // class FlatMap_ArrowProxy
+                          // ------------------------
+
+// CREATORS
+template <class REFERENCE>
+inline
+FlatMap_ArrowProxy<REFERENCE>::FlatMap_ArrowProxy(const REFERENCE& reference)
+: d_reference(reference)
+{
+}
+
+// ACCESSORS
+template <class REFERENCE>
+inline
+const REFERENCE *FlatMap_ArrowProxy<REFERENCE>::operator->() const
+{
+    return &d_reference;
+}
+
+                           // ----------------------
+                           // class FlatMap_Iterator
+                           // ----------------------
+
+// CREATORS
+template <class KEY, class VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE>::FlatMap_Iterator()
+: d_key_p(0)
+, d_value_p(0)
+{
+}
+
+template <class KEY, class VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE>::FlatMap_Iterator(const KEY *key, VALUE *value)
+: d_key_p(key)
+, d_value_p(value)
+{
+}
+
+template <class KEY, class VALUE>
+template <class OTHER_VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE>::FlatMap_Iterator(
+        const FlatMap_Iterator<KEY, OTHER_VALUE>& original,
+        typename bsl::enable_if<bsl::is_convertible<OTHER_VALUE *,
+                                                    VALUE *>::value,
+                                int>::type)
+: d_key_p(original.keyAddress())
+, d_value_p(original.valueAddress())
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE>& FlatMap_Iterator<KEY, VALUE>::operator++()
+{
+    ++d_key_p;
+    ++d_value_p;
+    return *this;
+}
+
+template <class KEY, class VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE>& FlatMap_Iterator<KEY, VALUE>::operator--()
+{
+    --d_key_p;
+    --d_value_p;
+    return *this;
+}
+
+template <class KEY, class VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE> FlatMap_Iterator<KEY, VALUE>::operator++(int)
+{
+    FlatMap_Iterator result(*this);
+    ++*this;
+    return result;
+}
+
+template <class KEY, class VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE> FlatMap_Iterator<KEY, VALUE>::operator--(int)
+{
+    FlatMap_Iterator result(*this);
+    --*this;
+    return result;
+}
+
+template <class KEY, class VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE>&
+FlatMap_Iterator<KEY, VALUE>::operator+=(difference_type offset)
+{
+    d_key_p   += offset;
+    d_value_p += offset;
+    return *this;
+}
+
+template <class KEY, class VALUE>
+inline
+FlatMap_Iterator<KEY, VALUE>&
+FlatMap_Iterator<KEY, VALUE>::operator-=(difference_type offset)
+{
+    d_key_p   -= offset;
+    d_value_p -= offset;
+    return *this;
+}
+
+// ACCESSORS
+template <class KEY, class VALUE>
+inline
+typename FlatMap_Iterator<KEY, VALUE>::reference
+FlatMap_Iterator<KEY, VALUE>::operator*() const
+{
+    return reference(*d_key_p, *d_value_p);
+}
+
+template <class KEY, class VALUE>
+inline
+typename FlatMap_Iterator<KEY, VALUE>::pointer
+FlatMap_Iterator<KEY, VALUE>::operator->() const
+{
+    return pointer(**this);
+}
+
+template <class KEY, class VALUE>
+inline
+typename FlatMap_Iterator<KEY, VALUE>::reference
+FlatMap_Iterator<KEY, VALUE>::operator[](difference_type offset) const
+{
+    return reference(d_key_p[offset], d_value_p[offset]);
+}
+
+template <class KEY, class VALUE>
+inline
+const KEY *FlatMap_Iterator<KEY, VALUE>::keyAddress() const
+{
+    return d_key_p;
+}
+
+template <class KEY, class VALUE>
+inline
+VALUE *FlatMap_Iterator<KEY, VALUE>::valueAddress() const
+{
+    return d_value_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class VALUE>
+inline
+bslstl::FlatMap_Iterator<KEY, VALUE> bslstl::operator+(
+                       const FlatMap_Iterator<KEY, VALUE>&            iterator,
+                       typename FlatMap_Iterator<KEY, VALUE>::difference_type
+                                                                       offset)
+{
+    FlatMap_Iterator<KEY, VALUE> result(iterator);
+    return result += offset;
+}
+
+template <class KEY, class VALUE>
+inline
+bslstl::FlatMap_Iterator<KEY, VALUE> bslstl::operator+(
+                       typename FlatMap_Iterator<KEY, VALUE>::difference_type
+                                                                       offset,
+                       const FlatMap_Iterator<KEY, VALUE>&            iterator)
+{
+    FlatMap_Iterator<KEY, VALUE> result(iterator);
+    return result += offset;
+}
+
+template <class KEY, class VALUE>
+inline
+bslstl::FlatMap_Iterator<KEY, VALUE> bslstl::operator-(
+                       const FlatMap_Iterator<KEY, VALUE>&            iterator,
+                       typename FlatMap_Iterator<KEY, VALUE>::difference_type
+                                                                       offset)
+{
+    FlatMap_Iterator<KEY, VALUE> result(iterator);
+    return result -= offset;
+}
+
+template <class KEY, class VALUE1, class VALUE2>
+inline
+std::ptrdiff_t bslstl::operator-(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                                 const FlatMap_Iterator<KEY, VALUE2>& rhs)
+{
+    return lhs.keyAddress() - rhs.keyAddress();
+}
+
+template <class KEY, class VALUE1, class VALUE2>
+inline
+bool bslstl::operator==(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                        const FlatMap_Iterator<KEY, VALUE2>& rhs)
+{
+    return lhs.keyAddress() == rhs.keyAddress();
+}
+
+template <class KEY, class VALUE1, class VALUE2>
+inline
+bool bslstl::operator!=(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                        const FlatMap_Iterator<KEY, VALUE2>& rhs)
+{
+    return lhs.keyAddress() != rhs.keyAddress();
+}
+
+template <class KEY, class VALUE1, class VALUE2>
+inline
+bool bslstl::operator<(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                       const FlatMap_Iterator<KEY, VALUE2>& rhs)
+{
+    return lhs.keyAddress() < rhs.keyAddress();
+}
+
+template <class KEY, class VALUE1, class VALUE2>
+inline
+bool bslstl::operator>(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                       const FlatMap_Iterator<KEY, VALUE2>& rhs)
+{
+    return lhs.keyAddress() > rhs.keyAddress();
+}
+
+template <class KEY, class VALUE1, class VALUE2>
+inline
+bool bslstl::operator<=(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                        const FlatMap_Iterator<KEY, VALUE2>& rhs)
+{
+    return lhs.keyAddress() <= rhs.keyAddress();
+}
+
+template <class KEY, class VALUE1, class VALUE2>
+inline
+bool bslstl::operator>=(const FlatMap_Iterator<KEY, VALUE1>& lhs,
+                        const FlatMap_Iterator<KEY, VALUE2>& rhs)
+{
+    return lhs.keyAddress() >= rhs.keyAddress();
+}
+
+namespace bslstl {
+
+                         // --------------------------
+                         // class FlatMap_ValueCompare
+                         // --------------------------
+
+// CREATORS
+template <class COMPARATOR>
+inline
+FlatMap_ValueCompare<COMPARATOR>::FlatMap_ValueCompare(
+                                                  const COMPARATOR& comparator)
+: d_compare(comparator)
+{
+}
+
+// ACCESSORS
+template <class COMPARATOR>
+template <class LHS_PAIR, class RHS_PAIR>
+inline
+bool FlatMap_ValueCompare<COMPARATOR>::operator()(const LHS_PAIR& lhs,
+                                                  const RHS_PAIR& rhs) const
+{
+    return d_compare(lhs.first, rhs.first);
+}
+
+                         // --------------------------
+                         // class FlatMap_RangeProctor
+                         // --------------------------
+
+// CREATORS
+template <class KEY_CONTAINER, class MAPPED_CONTAINER>
+inline
+FlatMap_RangeProctor<KEY_CONTAINER, MAPPED_CONTAINER>::FlatMap_RangeProctor(
+                                            KEY_CONTAINER    *keys,
+                                            MAPPED_CONTAINER *values,
+                                            std::size_t       position)
+: d_keys_p(keys)
+, d_values_p(values)
+, d_position(position)
+{
+}
+
+template <class KEY_CONTAINER, class MAPPED_CONTAINER>
+inline
+FlatMap_RangeProctor<KEY_CONTAINER, MAPPED_CONTAINER>::~FlatMap_RangeProctor()
+{
+    if (d_keys_p) {
+        d_keys_p->erase(d_keys_p->begin() + d_position, d_keys_p->end());
+        d_values_p->erase(d_values_p->begin() + d_position,
+                          d_values_p->end());
+    }
+}
+
+// MANIPULATORS
+template <class KEY_CONTAINER, class MAPPED_CONTAINER>
+inline
+void FlatMap_RangeProctor<KEY_CONTAINER, MAPPED_CONTAINER>::release()
+{
+    d_keys_p = 0;
+}
+
+template <class KEY_CONTAINER, class MAPPED_CONTAINER>
+inline
+void FlatMap_RangeProctor<KEY_CONTAINER, MAPPED_CONTAINER>::reset(
+                                                          std::size_t position)
+{
+    d_position = position;
+}
+
+                        // ----------------------------
+                        // class FlatMap_ElementProctor
+                        // ----------------------------
+
+// CREATORS
+template <class CONTAINER>
+inline
+FlatMap_ElementProctor<CONTAINER>::FlatMap_ElementProctor(
+                                                  CONTAINER   *container,
+                                                  std::size_t  position)
+: d_container_p(container)
+, d_position(position)
+{
+}
+
+template <class CONTAINER>
+inline
+FlatMap_ElementProctor<CONTAINER>::~FlatMap_ElementProctor()
+{
+    if (d_container_p) {
+        d_container_p->erase(d_container_p->begin() + d_position);
+    }
+}
+
+// MANIPULATORS
+template <class CONTAINER>
+inline
+void FlatMap_ElementProctor<CONTAINER>::release()
+{
+    d_container_p = 0;
+}
+
+                       // -----------------------------
+                       // class FlatMap_IndexComparator
+                       // -----------------------------
+
+// CREATORS
+template <class KEY_CONTAINER, class COMPARATOR>
+inline
+FlatMap_IndexComparator<KEY_CONTAINER, COMPARATOR>::FlatMap_IndexComparator(
+                                               const KEY_CONTAINER& keys,
+                                               const COMPARATOR&    comparator)
+: d_keys_p(&keys)
+, d_comparator_p(&comparator)
+{
+}
+
+// ACCESSORS
+template <class KEY_CONTAINER, class COMPARATOR>
+inline
+bool FlatMap_IndexComparator<KEY_CONTAINER, COMPARATOR>::operator()(
+                                                        std::size_t lhs,
+                                                        std::size_t rhs) const
+{
+    if ((*d_comparator_p)((*d_keys_p)[lhs], (*d_keys_p)[rhs])) {
+        return true;                                                  // RETURN
+    }
+    if ((*d_comparator_p)((*d_keys_p)[rhs], (*d_keys_p)[lhs])) {
+        return false;                                                 // RETURN
+    }
+    return lhs < rhs;
+}
+
+                             // ------------------
+                             // class FlatMap_Util
+                             // ------------------
+
+// CLASS METHODS
+template <class KEY_CONTAINER, class MAPPED_CONTAINER, class INPUT_ITERATOR>
+void FlatMap_Util::append(KEY_CONTAINER    *keys,
+                          MAPPED_CONTAINER *values,
+                          INPUT_ITERATOR    first,
+                          INPUT_ITERATOR    last)
+{
+    for (; first != last; ++first) {
+        keys->push_back((*first).first);
+        values->push_back((*first).second);
+    }
+}
+
+template <class KEY_CONTAINER, class KEY, class COMPARATOR>
+inline
+std::size_t FlatMap_Util::lowerBound(const KEY_CONTAINER& keys,
+                                     const KEY&           key,
+                                     const COMPARATOR&    comparator)
+{
+    return std::lower_bound(keys.begin(), keys.end(), key, comparator)
+         - keys.begin();
+}
+
+template <class KEY_CONTAINER, class KEY, class COMPARATOR>
+inline
+std::size_t FlatMap_Util::upperBound(const KEY_CONTAINER& keys,
+                                     const KEY&           key,
+                                     const COMPARATOR&    comparator)
+{
+    return std::upper_bound(keys.begin(), keys.end(), key, comparator)
+         - keys.begin();
+}
+
+template <class KEY_CONTAINER, class MAPPED_CONTAINER, class COMPARATOR>
+void FlatMap_Util::mergeTail(
+                 KEY_CONTAINER                                     *keys,
+                 MAPPED_CONTAINER                                  *values,
+                 std::size_t                                        position,
+                 const COMPARATOR&                                  comparator,
+                 bool                                               isSorted,
+                 bool                                               isUnique,
+                 FlatMap_RangeProctor<KEY_CONTAINER, MAPPED_CONTAINER>
+                                                                   *proctor)
+{
+    typedef bslmf::MovableRefUtil                              MoveUtil;
+    typedef typename bsl::allocator_traits<
+                            typename KEY_CONTAINER::allocator_type>::
+                  template rebind_traits<std::size_t>::allocator_type
+                                                               IndexAllocator;
+    typedef bsl::vector<std::size_t, IndexAllocator>           Order;
+
+    BSLS_ASSERT_SAFE(keys->size() == values->size());
+
+    const std::size_t length = keys->size();
+    if (position == length) {
+        return;                                                       // RETURN
+    }
+    const std::size_t numNew = length - position;
+
+    // Sort the positions of the new elements rather than the elements
+    // themselves, so that keys and values stay paired and the sort needs no
+    // buffer.
+
+    Order order(IndexAllocator(keys->get_allocator()));
+    bool  isInPlace = isSorted;
+    if (!isSorted) {
+        order.reserve(numNew);
+        for (std::size_t i = position; i < length; ++i) {
+            order.push_back(i);
+        }
+        std::sort(order.begin(),
+                  order.end(),
+                  FlatMap_IndexComparator<KEY_CONTAINER, COMPARATOR>(
+                                                                  *keys,
+                                                                  comparator));
+        isInPlace = true;
+        for (std::size_t i = 0; i < numNew; ++i) {
+            if (order[i] != position + i) {
+                isInPlace = false;
+                break;
+            }
+        }
+    }
+
+    if (isInPlace
+     && (0 == position
+      || !comparator((*keys)[position], (*keys)[position - 1]))
+     && (!isUnique
+      || 0 == position
+      || comparator((*keys)[position - 1], (*keys)[position]))) {
+        // The new elements are sorted and follow the old ones: only the
+        // duplicates among them (if any) need to go.
+
+        if (isUnique) {
+            std::size_t out = position;
+            for (std::size_t i = position + 1; i < length; ++i) {
+                if (comparator((*keys)[out], (*keys)[i])) {
+                    ++out;
+                    if (out != i) {
+                        (*keys)[out]   = MoveUtil::move((*keys)[i]);
+                        (*values)[out] = MoveUtil::move((*values)[i]);
+                    }
+                }
+            }
+            keys->erase(keys->begin() + out + 1, keys->end());
+            values->erase(values->begin() + out + 1, values->end());
+        }
+        return;                                                       // RETURN
+    }
+
+    KEY_CONTAINER    newKeys(keys->get_allocator());
+    MAPPED_CONTAINER newValues(values->get_allocator());
+    newKeys.reserve(length);
+    newValues.reserve(length);
+
+    if (proctor) {
+        proctor->reset(0);
+    }
+
+    std::size_t oldIndex = 0;
+    std::size_t newIndex = 0;
+    while (oldIndex < position || newIndex < numNew) {
+        std::size_t source;
+        if (newIndex < numNew) {
+            source = isInPlace ? position + newIndex : order[newIndex];
+            if (oldIndex < position
+             && !comparator((*keys)[source], (*keys)[oldIndex])) {
+                source = oldIndex++;
+            }
+            else {
+                ++newIndex;
+            }
+        }
+        else {
+            source = oldIndex++;
+        }
+        if (isUnique
+         && !newKeys.empty()
+         && !comparator(newKeys.back(), (*keys)[source])) {
+            continue;
+        }
+        newKeys.push_back(MoveUtil::move((*keys)[source]));
+        newValues.push_back(MoveUtil::move((*values)[source]));
+    }
+    keys->swap(newKeys);
+    values->swap(newValues);
+}
+
+template <class KEY_CONTAINER, class MAPPED_CONTAINER>
+int FlatMap_Util::lexicographical(const KEY_CONTAINER&    lhsKeys,
+                                  const MAPPED_CONTAINER& lhsValues,
+                                  const KEY_CONTAINER&    rhsKeys,
+                                  const MAPPED_CONTAINER& rhsValues)
+{
+    const std::size_t length = lhsKeys.size() < rhsKeys.size()
+                             ? lhsKeys.size()
+                             : rhsKeys.size();
+    for (std::size_t i = 0; i < length; ++i) {
+        if (lhsKeys[i] < rhsKeys[i]) {
+            return -1;                                                // RETURN
+        }
+        if (rhsKeys[i] < lhsKeys[i]) {
+            return 1;                                                 // RETURN
+        }
+        if (lhsValues[i] < rhsValues[i]) {
+            return -1;                                                // RETURN
+        }
+        if (rhsValues[i] < lhsValues[i]) {
+            return 1;                                                 // RETURN
+        }
+    }
+    return lhsKeys.size() < rhsKeys.size()
+           ? -1
+           : rhsKeys.size() < lhsKeys.size() ? 1 : 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                               // --------------
+                               // class flat_map
+                               // --------------
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iteratorAt(size_type index)
+{
+    return iterator(d_keys.data() + index, d_values.data() + index);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iteratorAt(size_type index) const
+{
+    return const_iterator(d_keys.data() + index, d_values.data() + index);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::isInsertionPoint(
+                                                 size_type  index,
+                                                 const KEY& key) const
+{
+    return (index == d_keys.size() || d_compare(key, d_keys[index]))
+        && (0 == index || d_compare(d_keys[index - 1], key));
+}
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map()
+: d_keys()
+, d_values()
+, d_compare()
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                          const COMPARATOR& comparator,
+                                          const ALLOCATOR&  basicAllocator)
+: d_keys(KeyAllocator(basicAllocator))
+, d_values(ValueAllocator(basicAllocator))
+, d_compare(comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                              const ALLOCATOR& basicAllocator)
+: d_keys(KeyAllocator(basicAllocator))
+, d_values(ValueAllocator(basicAllocator))
+, d_compare()
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                const key_container_type&    keys,
+                                const mapped_container_type& values,
+                                const COMPARATOR&            comparator,
+                                const ALLOCATOR&             basicAllocator)
+: d_keys(keys, KeyAllocator(basicAllocator))
+, d_values(values, ValueAllocator(basicAllocator))
+, d_compare(comparator)
+{
+    BSLS_ASSERT(d_keys.size() == d_values.size());
+
+    Util::mergeTail(&d_keys,
+                    &d_values,
+                    0,
+                    d_compare,
+                    false,
+                    true,
+                    static_cast<Proctor *>(0));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+            BloombergLP::bslmf::MovableRef<key_container_type>    keys,
+            BloombergLP::bslmf::MovableRef<mapped_container_type> values,
+            const COMPARATOR&                                     comparator)
+: d_keys(MoveUtil::move(keys))
+, d_values(MoveUtil::move(values))
+, d_compare(comparator)
+{
+    BSLS_ASSERT(d_keys.size() == d_values.size());
+
+    Util::mergeTail(&d_keys,
+                    &d_values,
+                    0,
+                    d_compare,
+                    false,
+                    true,
+                    static_cast<Proctor *>(0));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                sorted_unique_t,
+                                const key_container_type&    keys,
+                                const mapped_container_type& values,
+                                const COMPARATOR&            comparator,
+                                const ALLOCATOR&             basicAllocator)
+: d_keys(keys, KeyAllocator(basicAllocator))
+, d_values(values, ValueAllocator(basicAllocator))
+, d_compare(comparator)
+{
+    BSLS_ASSERT(d_keys.size() == d_values.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+            sorted_unique_t,
+            BloombergLP::bslmf::MovableRef<key_container_type>    keys,
+            BloombergLP::bslmf::MovableRef<mapped_container_type> values,
+            const COMPARATOR&                                     comparator)
+: d_keys(MoveUtil::move(keys))
+, d_values(MoveUtil::move(values))
+, d_compare(comparator)
+{
+    BSLS_ASSERT(d_keys.size() == d_values.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            const COMPARATOR& comparator,
+                                            const ALLOCATOR&  basicAllocator)
+: d_keys(KeyAllocator(basicAllocator))
+, d_values(ValueAllocator(basicAllocator))
+, d_compare(comparator)
+{
+    Util::append(&d_keys, &d_values, first, last);
+    Util::mergeTail(&d_keys,
+                    &d_values,
+                    0,
+                    d_compare,
+                    false,
+                    true,
+                    static_cast<Proctor *>(0));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                              INPUT_ITERATOR   first,
+                                              INPUT_ITERATOR   last,
+                                              const ALLOCATOR& basicAllocator)
+: d_keys(KeyAllocator(basicAllocator))
+, d_values(ValueAllocator(basicAllocator))
+, d_compare()
+{
+    Util::append(&d_keys, &d_values, first, last);
+    Util::mergeTail(&d_keys,
+                    &d_values,
+                    0,
+                    d_compare,
+                    false,
+                    true,
+                    static_cast<Proctor *>(0));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                            sorted_unique_t,
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            const COMPARATOR& comparator,
+                                            const ALLOCATOR&  basicAllocator)
+: d_keys(KeyAllocator(basicAllocator))
+, d_values(ValueAllocator(basicAllocator))
+, d_compare(comparator)
+{
+    Util::append(&d_keys, &d_values, first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                            std::initializer_list<value_type> values,
+                            const COMPARATOR&                 comparator,
+                            const ALLOCATOR&                  basicAllocator)
+: flat_map(values.begin(), values.end(), comparator, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                            std::initializer_list<value_type> values,
+                            const ALLOCATOR&                  basicAllocator)
+: flat_map(values.begin(), values.end(), COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                            sorted_unique_t,
+                            std::initializer_list<value_type> values,
+                            const COMPARATOR&                 comparator,
+                            const ALLOCATOR&                  basicAllocator)
+: flat_map(sorted_unique,
+           values.begin(),
+           values.end(),
+           comparator,
+           basicAllocator)
+{
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                                     const flat_map& original)
+: d_keys(original.d_keys, KeyAllocator(ALLOCATOR()))
+, d_values(original.d_values, ValueAllocator(ALLOCATOR()))
+, d_compare(original.d_compare)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                                            const flat_map&  original,
+                                            const ALLOCATOR& basicAllocator)
+: d_keys(original.d_keys, KeyAllocator(basicAllocator))
+, d_values(original.d_values, ValueAllocator(basicAllocator))
+, d_compare(original.d_compare)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                           BloombergLP::bslmf::MovableRef<flat_map> original)
+: d_keys(MoveUtil::move(MoveUtil::access(original).d_keys))
+, d_values(MoveUtil::move(MoveUtil::access(original).d_values))
+, d_compare(MoveUtil::access(original).d_compare)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_map(
+                     BloombergLP::bslmf::MovableRef<flat_map> original,
+                     const ALLOCATOR&                         basicAllocator)
+: d_keys(MoveUtil::move(MoveUtil::access(original).d_keys),
+         KeyAllocator(basicAllocator))
+, d_values(MoveUtil::move(MoveUtil::access(original).d_values),
+           ValueAllocator(basicAllocator))
+, d_compare(MoveUtil::access(original).d_compare)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(const flat_map& rhs)
+{
+    if (this != &rhs) {
+        key_container_type    keys(rhs.d_keys, d_keys.get_allocator());
+        mapped_container_type values(rhs.d_values, d_values.get_allocator());
+        d_compare = rhs.d_compare;
+        d_keys.swap(keys);
+        d_values.swap(values);
+    }
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(
+                                BloombergLP::bslmf::MovableRef<flat_map> rhs)
+{
+    flat_map& lvalue = rhs;
+    if (this != &lvalue) {
+        if (d_keys.get_allocator() == lvalue.d_keys.get_allocator()) {
+            d_keys.swap(lvalue.d_keys);
+            d_values.swap(lvalue.d_values);
+            lvalue.clear();
+        }
+        else {
+            key_container_type    keys(MoveUtil::move(lvalue.d_keys),
+                                       d_keys.get_allocator());
+            mapped_container_type values(MoveUtil::move(lvalue.d_values),
+                                         d_values.get_allocator());
+            d_keys.swap(keys);
+            d_values.swap(values);
+        }
+        d_compare = lvalue.d_compare;
+    }
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(
+                                      std::initializer_list<value_type> values)
+{
+    clear();
+    insert(values.begin(), values.end());
+    return *this;
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+VALUE&
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator[](const key_type& key)
+{
+    const size_type index = Util::lowerBound(d_keys, key, d_compare);
+    if (index == d_keys.size() || d_compare(key, d_keys[index])) {
+        d_values.emplace(d_values.begin() + index);
+        BloombergLP::bslstl::FlatMap_ElementProctor<mapped_container_type>
+                                                     proctor(&d_values, index);
+        d_keys.insert(d_keys.begin() + index, key);
+        proctor.release();
+    }
+    return d_values[index];
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+VALUE& flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator[](
+                                BloombergLP::bslmf::MovableRef<key_type> key)
+{
+    key_type&       lvalue = key;
+    const size_type index  = Util::lowerBound(d_keys, lvalue, d_compare);
+    if (index == d_keys.size() || d_compare(lvalue, d_keys[index])) {
+        d_values.emplace(d_values.begin() + index);
+        BloombergLP::bslstl::FlatMap_ElementProctor<mapped_container_type>
+                                                     proctor(&d_values, index);
+        d_keys.insert(d_keys.begin() + index, MoveUtil::move(lvalue));
+        proctor.release();
+    }
+    return d_values[index];
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+VALUE& flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::at(const key_type& key)
+{
+    const size_type index = Util::lowerBound(d_keys, key, d_compare);
+    if (index == d_keys.size() || d_compare(key, d_keys[index])) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                              "flat_map<...>::at(key_type): invalid key");
+    }
+    return d_values[index];
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin() BSLS_KEYWORD_NOEXCEPT
+{
+    return iteratorAt(0);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::end() BSLS_KEYWORD_NOEXCEPT
+{
+    return iteratorAt(d_keys.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin() BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend() BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+pair<typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    const size_type index = Util::lowerBound(d_keys, value.first, d_compare);
+    if (index != d_keys.size() && !d_compare(value.first, d_keys[index])) {
+        return pair<iterator, bool>(iteratorAt(index), false);        // RETURN
+    }
+    d_values.insert(d_values.begin() + index, value.second);
+    BloombergLP::bslstl::FlatMap_ElementProctor<mapped_container_type>
+                                                     proctor(&d_values, index);
+    d_keys.insert(d_keys.begin() + index, value.first);
+    proctor.release();
+    return pair<iterator, bool>(iteratorAt(index), true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+pair<typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator, bool>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    value_type&     lvalue = value;
+    const size_type index  = Util::lowerBound(d_keys, lvalue.first, d_compare);
+    if (index != d_keys.size() && !d_compare(lvalue.first, d_keys[index])) {
+        return pair<iterator, bool>(iteratorAt(index), false);        // RETURN
+    }
+    d_values.insert(d_values.begin() + index, MoveUtil::move(lvalue.second));
+    BloombergLP::bslstl::FlatMap_ElementProctor<mapped_container_type>
+                                                     proctor(&d_values, index);
+    d_keys.insert(d_keys.begin() + index, MoveUtil::move(lvalue.first));
+    proctor.release();
+    return pair<iterator, bool>(iteratorAt(index), true);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(const_iterator    hint,
+                                                    const value_type& value)
+{
+    const size_type index = hint - cbegin();
+
+    BSLS_ASSERT_SAFE(index <= d_keys.size());
+
+    if (!isInsertionPoint(index, value.first)) {
+        return insert(value).first;                                   // RETURN
+    }
+    d_values.insert(d_values.begin() + index, value.second);
+    BloombergLP::bslstl::FlatMap_ElementProctor<mapped_container_type>
+                                                     proctor(&d_values, index);
+    d_keys.insert(d_keys.begin() + index, value.first);
+    proctor.release();
+    return iteratorAt(index);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                              const_iterator                             hint,
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    value_type&     lvalue = value;
+    const size_type index  = hint - cbegin();
+
+    BSLS_ASSERT_SAFE(index <= d_keys.size());
+
+    if (!isInsertionPoint(index, lvalue.first)) {
+        return insert(MoveUtil::move(lvalue)).first;                  // RETURN
+    }
+    d_values.insert(d_values.begin() + index, MoveUtil::move(lvalue.second));
+    BloombergLP::bslstl::FlatMap_ElementProctor<mapped_container_type>
+                                                     proctor(&d_values, index);
+    d_keys.insert(d_keys.begin() + index, MoveUtil::move(lvalue.first));
+    proctor.release();
+    return iteratorAt(index);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    const size_type position = d_keys.size();
+
+    Proctor proctor(&d_keys, &d_values, position);
+    Util::append(&d_keys, &d_values, first, last);
+    Util::mergeTail(&d_keys,
+                    &d_values,
+                    position,
+                    d_compare,
+                    false,
+                    true,
+                    &proctor);
+    proctor.release();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(sorted_unique_t,
+                                                         INPUT_ITERATOR first,
+                                                         INPUT_ITERATOR last)
+{
+    const size_type position = d_keys.size();
+
+    Proctor proctor(&d_keys, &d_values, position);
+    Util::append(&d_keys, &d_values, first, last);
+    Util::mergeTail(&d_keys,
+                    &d_values,
+                    position,
+                    d_compare,
+                    true,
+                    true,
+                    &proctor);
+    proctor.release();
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                      std::initializer_list<value_type> values)
+{
+    insert(values.begin(), values.end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                     sorted_unique_t,
+                                     std::initializer_list<value_type> values)
+{
+    insert(sorted_unique, values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(iterator position)
+{
+    return erase(const_iterator(position));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    const size_type index = position - cbegin();
+
+    BSLS_ASSERT_SAFE(index < d_keys.size());
+
+    d_keys.erase(d_keys.begin() + index);
+    d_values.erase(d_values.begin() + index);
+    return iteratorAt(index);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    const size_type index = Util::lowerBound(d_keys, key, d_compare);
+    if (index == d_keys.size() || d_compare(key, d_keys[index])) {
+        return 0;                                                     // RETURN
+    }
+    d_keys.erase(d_keys.begin() + index);
+    d_values.erase(d_values.begin() + index);
+    return 1;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                                   const_iterator last)
+{
+    const size_type firstIndex = first - cbegin();
+    const size_type lastIndex  = last  - cbegin();
+
+    BSLS_ASSERT_SAFE(firstIndex <= lastIndex);
+    BSLS_ASSERT_SAFE(lastIndex  <= d_keys.size());
+
+    d_keys.erase(d_keys.begin() + firstIndex, d_keys.begin() + lastIndex);
+    d_values.erase(d_values.begin() + firstIndex,
+                   d_values.begin() + lastIndex);
+    return iteratorAt(firstIndex);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::replace(
+            BloombergLP::bslmf::MovableRef<key_container_type>    keys,
+            BloombergLP::bslmf::MovableRef<mapped_container_type> values)
+{
+    BSLS_ASSERT(MoveUtil::access(keys).size() ==
+                                            MoveUtil::access(values).size());
+
+    d_keys   = MoveUtil::move(keys);
+    d_values = MoveUtil::move(values);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::swap(flat_map& other)
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    using std::swap;
+
+    BSLS_ASSERT_SAFE(d_keys.get_allocator() == other.d_keys.get_allocator());
+
+    d_keys.swap(other.d_keys);
+    d_values.swap(other.d_values);
+    swap(d_compare, other.d_compare);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::clear() BSLS_KEYWORD_NOEXCEPT
+{
+    d_keys.clear();
+    d_values.clear();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key)
+{
+    const size_type index = Util::lowerBound(d_keys, key, d_compare);
+    return index != d_keys.size() && !d_compare(key, d_keys[index])
+           ? iteratorAt(index)
+           : end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(const key_type& key)
+{
+    return iteratorAt(Util::lowerBound(d_keys, key, d_compare));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(const key_type& key)
+{
+    return iteratorAt(Util::upperBound(d_keys, key, d_compare));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator,
+     typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key)
+{
+    const size_type first = Util::lowerBound(d_keys, key, d_compare);
+    const size_type last  = first != d_keys.size()
+                         && !d_compare(key, d_keys[first])
+                            ? first + 1
+                            : first;
+    return pair<iterator, iterator>(iteratorAt(first), iteratorAt(last));
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+const VALUE&
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::at(const key_type& key) const
+{
+    const size_type index = Util::lowerBound(d_keys, key, d_compare);
+    if (index == d_keys.size() || d_compare(key, d_keys[index])) {
+        BloombergLP::bslstl::StdExceptUtil::throwOutOfRange(
+                              "flat_map<...>::at(key_type): invalid key");
+    }
+    return d_values[index];
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return iteratorAt(0);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::cbegin() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return iteratorAt(0);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::end() const BSLS_KEYWORD_NOEXCEPT
+{
+    return iteratorAt(d_keys.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::cend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return iteratorAt(d_keys.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::crbegin() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::crend() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::empty() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_keys.empty();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_keys.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::max_size() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_keys.max_size() < d_values.max_size() ? d_keys.max_size()
+                                                   : d_values.max_size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::allocator_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::get_allocator() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return allocator_type(d_keys.get_allocator());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_compare
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_compare;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return value_compare(d_compare);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key) const
+{
+    const size_type index = Util::lowerBound(d_keys, key, d_compare);
+    return index != d_keys.size() && !d_compare(key, d_keys[index])
+           ? iteratorAt(index)
+           : end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::count(const key_type& key) const
+{
+    return find(key) != end() ? 1 : 0;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::contains(
+                                                    const key_type& key) const
+{
+    return find(key) != end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(
+                                                    const key_type& key) const
+{
+    return iteratorAt(Util::lowerBound(d_keys, key, d_compare));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(
+                                                    const key_type& key) const
+{
+    return iteratorAt(Util::upperBound(d_keys, key, d_compare));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator,
+     typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator>
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(
+                                                    const key_type& key) const
+{
+    const size_type first = Util::lowerBound(d_keys, key, d_compare);
+    const size_type last  = first != d_keys.size()
+                         && !d_compare(key, d_keys[first])
+                            ? first + 1
+                            : first;
+    return pair<const_iterator, const_iterator>(iteratorAt(first),
+                                                iteratorAt(last));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+const typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_container_type&
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::keys() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_keys;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+const typename flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::
+                                                         mapped_container_type&
+flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::values() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_values;
+}
+
+                            // -------------------
+                            // class flat_multimap
+                            // -------------------
+
+// PRIVATE MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iteratorAt(size_type index)
+{
+    return iterator(d_keys.data() + index, d_values.data() + index);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iteratorAt(
+                                                         size_type index) const
+{
+    return const_iterator(d_keys.data() + index, d_values.data() + index);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::isInsertionPoint(
+                                                 size_type  index,
+                                                 const KEY& key) const
+{
+    return (index == d_keys.size() || !d_compare(d_keys[index], key))
+        && (0 == index || !d_compare(key, d_keys[index - 1]));
+}
+
+// CREATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap()
+: d_keys()
+, d_values()
+, d_compare()
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                          const COMPARATOR& comparator,
+                                          const ALLOCATOR&  basicAllocator)
+: d_keys(KeyAllocator(basicAllocator))
+, d_values(ValueAllocator(basicAllocator))
+, d_compare(comparator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                              const ALLOCATOR& basicAllocator)
+: d_keys(KeyAllocator(basicAllocator))
+, d_values(ValueAllocator(basicAllocator))
+, d_compare()
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                const key_container_type&    keys,
+                                const mapped_container_type& values,
+                                const COMPARATOR&            comparator,
+                                const ALLOCATOR&             basicAllocator)
+: d_keys(keys, KeyAllocator(basicAllocator))
+, d_values(values, ValueAllocator(basicAllocator))
+, d_compare(comparator)
+{
+    BSLS_ASSERT(d_keys.size() == d_values.size());
+
+    Util::mergeTail(&d_keys,
+                    &d_values,
+                    0,
+                    d_compare,
+                    false,
+                    false,
+                    static_cast<Proctor *>(0));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+            BloombergLP::bslmf::MovableRef<key_container_type>    keys,
+            BloombergLP::bslmf::MovableRef<mapped_container_type> values,
+            const COMPARATOR&                                     comparator)
+: d_keys(MoveUtil::move(keys))
+, d_values(MoveUtil::move(values))
+, d_compare(comparator)
+{
+    BSLS_ASSERT(d_keys.size() == d_values.size());
+
+    Util::mergeTail(&d_keys,
+                    &d_values,
+                    0,
+                    d_compare,
+                    false,
+                    false,
+                    static_cast<Proctor *>(0));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                sorted_equivalent_t,
+                                const key_container_type&    keys,
+                                const mapped_container_type& values,
+                                const COMPARATOR&            comparator,
+                                const ALLOCATOR&             basicAllocator)
+: d_keys(keys, KeyAllocator(basicAllocator))
+, d_values(values, ValueAllocator(basicAllocator))
+, d_compare(comparator)
+{
+    BSLS_ASSERT(d_keys.size() == d_values.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+            sorted_equivalent_t,
+            BloombergLP::bslmf::MovableRef<key_container_type>    keys,
+            BloombergLP::bslmf::MovableRef<mapped_container_type> values,
+            const COMPARATOR&                                     comparator)
+: d_keys(MoveUtil::move(keys))
+, d_values(MoveUtil::move(values))
+, d_compare(comparator)
+{
+    BSLS_ASSERT(d_keys.size() == d_values.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            const COMPARATOR& comparator,
+                                            const ALLOCATOR&  basicAllocator)
+: d_keys(KeyAllocator(basicAllocator))
+, d_values(ValueAllocator(basicAllocator))
+, d_compare(comparator)
+{
+    Util::append(&d_keys, &d_values, first, last);
+    Util::mergeTail(&d_keys,
+                    &d_values,
+                    0,
+                    d_compare,
+                    false,
+                    false,
+                    static_cast<Proctor *>(0));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                              INPUT_ITERATOR   first,
+                                              INPUT_ITERATOR   last,
+                                              const ALLOCATOR& basicAllocator)
+: d_keys(KeyAllocator(basicAllocator))
+, d_values(ValueAllocator(basicAllocator))
+, d_compare()
+{
+    Util::append(&d_keys, &d_values, first, last);
+    Util::mergeTail(&d_keys,
+                    &d_values,
+                    0,
+                    d_compare,
+                    false,
+                    false,
+                    static_cast<Proctor *>(0));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                            sorted_equivalent_t,
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            const COMPARATOR& comparator,
+                                            const ALLOCATOR&  basicAllocator)
+: d_keys(KeyAllocator(basicAllocator))
+, d_values(ValueAllocator(basicAllocator))
+, d_compare(comparator)
+{
+    Util::append(&d_keys, &d_values, first, last);
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                            std::initializer_list<value_type> values,
+                            const COMPARATOR&                 comparator,
+                            const ALLOCATOR&                  basicAllocator)
+: flat_multimap(values.begin(), values.end(), comparator, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                            std::initializer_list<value_type> values,
+                            const ALLOCATOR&                  basicAllocator)
+: flat_multimap(values.begin(), values.end(), COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                            sorted_equivalent_t,
+                            std::initializer_list<value_type> values,
+                            const COMPARATOR&                 comparator,
+                            const ALLOCATOR&                  basicAllocator)
+: flat_multimap(sorted_equivalent,
+           values.begin(),
+           values.end(),
+           comparator,
+           basicAllocator)
+{
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                                 const flat_multimap& original)
+: d_keys(original.d_keys, KeyAllocator(ALLOCATOR()))
+, d_values(original.d_values, ValueAllocator(ALLOCATOR()))
+, d_compare(original.d_compare)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                                            const flat_multimap&  original,
+                                            const ALLOCATOR& basicAllocator)
+: d_keys(original.d_keys, KeyAllocator(basicAllocator))
+, d_values(original.d_values, ValueAllocator(basicAllocator))
+, d_compare(original.d_compare)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                        BloombergLP::bslmf::MovableRef<flat_multimap> original)
+: d_keys(MoveUtil::move(MoveUtil::access(original).d_keys))
+, d_values(MoveUtil::move(MoveUtil::access(original).d_values))
+, d_compare(MoveUtil::access(original).d_compare)
+{
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::flat_multimap(
+                     BloombergLP::bslmf::MovableRef<flat_multimap> original,
+                     const ALLOCATOR&                         basicAllocator)
+: d_keys(MoveUtil::move(MoveUtil::access(original).d_keys),
+         KeyAllocator(basicAllocator))
+, d_values(MoveUtil::move(MoveUtil::access(original).d_values),
+           ValueAllocator(basicAllocator))
+, d_compare(MoveUtil::access(original).d_compare)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(
+                                                      const flat_multimap& rhs)
+{
+    if (this != &rhs) {
+        key_container_type    keys(rhs.d_keys, d_keys.get_allocator());
+        mapped_container_type values(rhs.d_values, d_values.get_allocator());
+        d_compare = rhs.d_compare;
+        d_keys.swap(keys);
+        d_values.swap(values);
+    }
+    return *this;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(
+                             BloombergLP::bslmf::MovableRef<flat_multimap> rhs)
+{
+    flat_multimap& lvalue = rhs;
+    if (this != &lvalue) {
+        if (d_keys.get_allocator() == lvalue.d_keys.get_allocator()) {
+            d_keys.swap(lvalue.d_keys);
+            d_values.swap(lvalue.d_values);
+            lvalue.clear();
+        }
+        else {
+            key_container_type    keys(MoveUtil::move(lvalue.d_keys),
+                                       d_keys.get_allocator());
+            mapped_container_type values(MoveUtil::move(lvalue.d_values),
+                                         d_values.get_allocator());
+            d_keys.swap(keys);
+            d_values.swap(values);
+        }
+        d_compare = lvalue.d_compare;
+    }
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>&
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::operator=(
+                                      std::initializer_list<value_type> values)
+{
+    clear();
+    insert(values.begin(), values.end());
+    return *this;
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin() BSLS_KEYWORD_NOEXCEPT
+{
+    return iteratorAt(0);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::end() BSLS_KEYWORD_NOEXCEPT
+{
+    return iteratorAt(d_keys.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend() BSLS_KEYWORD_NOEXCEPT
+{
+    return reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                                       const value_type& value)
+{
+    const size_type index = Util::upperBound(d_keys, value.first, d_compare);
+    d_values.insert(d_values.begin() + index, value.second);
+    BloombergLP::bslstl::FlatMap_ElementProctor<mapped_container_type>
+                                                     proctor(&d_values, index);
+    d_keys.insert(d_keys.begin() + index, value.first);
+    proctor.release();
+    return iteratorAt(index);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    value_type&     lvalue = value;
+    const size_type index  = Util::upperBound(d_keys, lvalue.first, d_compare);
+    d_values.insert(d_values.begin() + index, MoveUtil::move(lvalue.second));
+    BloombergLP::bslstl::FlatMap_ElementProctor<mapped_container_type>
+                                                     proctor(&d_values, index);
+    d_keys.insert(d_keys.begin() + index, MoveUtil::move(lvalue.first));
+    proctor.release();
+    return iteratorAt(index);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                                       const_iterator    hint,
+                                                       const value_type& value)
+{
+    const size_type index = hint - cbegin();
+
+    BSLS_ASSERT_SAFE(index <= d_keys.size());
+
+    if (!isInsertionPoint(index, value.first)) {
+        return insert(value);                                         // RETURN
+    }
+    d_values.insert(d_values.begin() + index, value.second);
+    BloombergLP::bslstl::FlatMap_ElementProctor<mapped_container_type>
+                                                     proctor(&d_values, index);
+    d_keys.insert(d_keys.begin() + index, value.first);
+    proctor.release();
+    return iteratorAt(index);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                              const_iterator                             hint,
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    value_type&     lvalue = value;
+    const size_type index  = hint - cbegin();
+
+    BSLS_ASSERT_SAFE(index <= d_keys.size());
+
+    if (!isInsertionPoint(index, lvalue.first)) {
+        return insert(MoveUtil::move(lvalue));                        // RETURN
+    }
+    d_values.insert(d_values.begin() + index, MoveUtil::move(lvalue.second));
+    BloombergLP::bslstl::FlatMap_ElementProctor<mapped_container_type>
+                                                     proctor(&d_values, index);
+    d_keys.insert(d_keys.begin() + index, MoveUtil::move(lvalue.first));
+    proctor.release();
+    return iteratorAt(index);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                                          INPUT_ITERATOR first,
+                                                          INPUT_ITERATOR last)
+{
+    const size_type position = d_keys.size();
+
+    Proctor proctor(&d_keys, &d_values, position);
+    Util::append(&d_keys, &d_values, first, last);
+    Util::mergeTail(&d_keys,
+                    &d_values,
+                    position,
+                    d_compare,
+                    false,
+                    false,
+                    &proctor);
+    proctor.release();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                                     sorted_equivalent_t,
+                                                     INPUT_ITERATOR      first,
+                                                     INPUT_ITERATOR      last)
+{
+    const size_type position = d_keys.size();
+
+    Proctor proctor(&d_keys, &d_values, position);
+    Util::append(&d_keys, &d_values, first, last);
+    Util::mergeTail(&d_keys,
+                    &d_values,
+                    position,
+                    d_compare,
+                    true,
+                    false,
+                    &proctor);
+    proctor.release();
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                      std::initializer_list<value_type> values)
+{
+    insert(values.begin(), values.end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::insert(
+                                     sorted_equivalent_t,
+                                     std::initializer_list<value_type> values)
+{
+    insert(sorted_equivalent, values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(iterator position)
+{
+    return erase(const_iterator(position));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(
+                                                       const_iterator position)
+{
+    const size_type index = position - cbegin();
+
+    BSLS_ASSERT_SAFE(index < d_keys.size());
+
+    d_keys.erase(d_keys.begin() + index);
+    d_values.erase(d_values.begin() + index);
+    return iteratorAt(index);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    const size_type first = Util::lowerBound(d_keys, key, d_compare);
+    const size_type last  = Util::upperBound(d_keys, key, d_compare);
+    d_keys.erase(d_keys.begin() + first, d_keys.begin() + last);
+    d_values.erase(d_values.begin() + first, d_values.begin() + last);
+    return last - first;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                                   const_iterator last)
+{
+    const size_type firstIndex = first - cbegin();
+    const size_type lastIndex  = last  - cbegin();
+
+    BSLS_ASSERT_SAFE(firstIndex <= lastIndex);
+    BSLS_ASSERT_SAFE(lastIndex  <= d_keys.size());
+
+    d_keys.erase(d_keys.begin() + firstIndex, d_keys.begin() + lastIndex);
+    d_values.erase(d_values.begin() + firstIndex,
+                   d_values.begin() + lastIndex);
+    return iteratorAt(firstIndex);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::replace(
+            BloombergLP::bslmf::MovableRef<key_container_type>    keys,
+            BloombergLP::bslmf::MovableRef<mapped_container_type> values)
+{
+    BSLS_ASSERT(MoveUtil::access(keys).size() ==
+                                            MoveUtil::access(values).size());
+
+    d_keys   = MoveUtil::move(keys);
+    d_values = MoveUtil::move(values);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::swap(
+                                                          flat_multimap& other)
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    using std::swap;
+
+    BSLS_ASSERT_SAFE(d_keys.get_allocator() == other.d_keys.get_allocator());
+
+    d_keys.swap(other.d_keys);
+    d_values.swap(other.d_values);
+    swap(d_compare, other.d_compare);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::clear()
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    d_keys.clear();
+    d_values.clear();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(const key_type& key)
+{
+    const size_type index = Util::lowerBound(d_keys, key, d_compare);
+    return index != d_keys.size() && !d_compare(key, d_keys[index])
+           ? iteratorAt(index)
+           : end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(
+                                                           const key_type& key)
+{
+    return iteratorAt(Util::lowerBound(d_keys, key, d_compare));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(
+                                                           const key_type& key)
+{
+    return iteratorAt(Util::upperBound(d_keys, key, d_compare));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator,
+     typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::iterator>
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(
+                                                           const key_type& key)
+{
+    const size_type first = Util::lowerBound(d_keys, key, d_compare);
+    const size_type last  = Util::upperBound(d_keys, key, d_compare);
+    return pair<iterator, iterator>(iteratorAt(first), iteratorAt(last));
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::begin() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return iteratorAt(0);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::cbegin() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return iteratorAt(0);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::end() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return iteratorAt(d_keys.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::cend() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return iteratorAt(d_keys.size());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::
+                                                         const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::rbegin() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::
+                                                         const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::crbegin() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(end());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::
+                                                         const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::rend() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::
+                                                         const_reverse_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::crend() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return const_reverse_iterator(begin());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::empty() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_keys.empty();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_keys.size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::max_size() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_keys.max_size() < d_values.max_size() ? d_keys.max_size()
+                                                   : d_values.max_size();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::allocator_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::get_allocator() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return allocator_type(d_keys.get_allocator());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_compare
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_compare;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_compare
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return value_compare(d_compare);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::find(
+                                                     const key_type& key) const
+{
+    const size_type index = Util::lowerBound(d_keys, key, d_compare);
+    return index != d_keys.size() && !d_compare(key, d_keys[index])
+           ? iteratorAt(index)
+           : end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::count(
+                                                     const key_type& key) const
+{
+    return Util::upperBound(d_keys, key, d_compare)
+         - Util::lowerBound(d_keys, key, d_compare);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::contains(
+                                                    const key_type& key) const
+{
+    return find(key) != end();
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::lower_bound(
+                                                    const key_type& key) const
+{
+    return iteratorAt(Util::lowerBound(d_keys, key, d_compare));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::upper_bound(
+                                                    const key_type& key) const
+{
+    return iteratorAt(Util::upperBound(d_keys, key, d_compare));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator,
+     typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::const_iterator>
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::equal_range(
+                                                    const key_type& key) const
+{
+    const size_type first = Util::lowerBound(d_keys, key, d_compare);
+    const size_type last  = Util::upperBound(d_keys, key, d_compare);
+    return pair<const_iterator, const_iterator>(iteratorAt(first),
+                                                iteratorAt(last));
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+const typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::
+                                                            key_container_type&
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::keys() const
+                                                          BSLS_KEYWORD_NOEXCEPT
+{
+    return d_keys;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+const typename flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::
+                                                         mapped_container_type&
+flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::values() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_values;
+}
+
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(
+                   const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                   const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return lhs.keys() == rhs.keys() && lhs.values() == rhs.values();
+}
+
+#ifndef BSLS_COMPILERFEATURES_SUPPORT_THREE_WAY_COMPARISON
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+                   const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                   const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(
+                   const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                   const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslstl::FlatMap_Util::lexicographical(
+                                                                lhs.keys(),
+                                                                lhs.values(),
+                                                                rhs.keys(),
+                                                                rhs.values());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(
+                   const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                   const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(
+                   const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                   const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(
+                   const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+                   const bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(
+              const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+              const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return lhs.keys() == rhs.keys() && lhs.values() == rhs.values();
+}
+
+#ifndef BSLS_COMPILERFEATURES_SUPPORT_THREE_WAY_COMPARISON
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(
+              const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+              const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+#endif
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(
+              const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+              const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslstl::FlatMap_Util::lexicographical(
+                                                                lhs.keys(),
+                                                                lhs.values(),
+                                                                rhs.keys(),
+                                                                rhs.values());
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(
+              const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+              const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(
+              const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+              const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(
+              const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& lhs,
+              const bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY,
+          class VALUE,
+          class COMPARATOR,
+          class ALLOCATOR,
+          class PREDICATE>
+typename bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+bsl::erase_if(bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& m,
+              PREDICATE                                         predicate)
+{
+    typedef bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR> Map;
+    typedef typename Map::const_reference                    ConstReference;
+    typedef typename Map::size_type                          SizeType;
+    typedef BloombergLP::bslmf::MovableRefUtil               MoveUtil;
+
+    const SizeType length = m.size();
+    SizeType       out    = 0;
+    for (SizeType i = 0; i < length; ++i) {
+        if (predicate(ConstReference(m.d_keys[i], m.d_values[i]))) {
+            continue;
+        }
+        if (out != i) {
+            m.d_keys[out]   = MoveUtil::move(m.d_keys[i]);
+            m.d_values[out] = MoveUtil::move(m.d_values[i]);
+        }
+        ++out;
+    }
+    m.d_keys.erase(m.d_keys.begin() + out, m.d_keys.end());
+    m.d_values.erase(m.d_values.begin() + out, m.d_values.end());
+    return length - out;
+}
+
+template <class KEY,
+          class VALUE,
+          class COMPARATOR,
+          class ALLOCATOR,
+          class PREDICATE>
+typename bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>::size_type
+bsl::erase_if(bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& m,
+              PREDICATE                                              predicate)
+{
+    typedef bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR> Map;
+
+    typedef typename Map::const_reference      ConstReference;
+    typedef typename Map::size_type            SizeType;
+    typedef BloombergLP::bslmf::MovableRefUtil MoveUtil;
+
+    const SizeType length = m.size();
+    SizeType       out    = 0;
+    for (SizeType i = 0; i < length; ++i) {
+        if (predicate(ConstReference(m.d_keys[i], m.d_values[i]))) {
+            continue;
+        }
+        if (out != i) {
+            m.d_keys[out]   = MoveUtil::move(m.d_keys[i]);
+            m.d_values[out] = MoveUtil::move(m.d_values[i]);
+        }
+        ++out;
+    }
+    m.d_keys.erase(m.d_keys.begin() + out, m.d_keys.end());
+    m.d_values.erase(m.d_values.begin() + out, m.d_values.end());
+    return length - out;
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void bsl::swap(bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+               bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR>& b)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    typedef bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR> Container;
+
+    if (a.get_allocator() == b.get_allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    // Copy each object using the allocator of the other, then swap the
+    // copies, which cannot throw, into place.
+
+    Container aCopy(a, b.get_allocator());
+    Container bCopy(b, a.get_allocator());
+
+    a.swap(bCopy);
+    b.swap(aCopy);
+}
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+void bsl::swap(bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& a,
+               bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR>& b)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    typedef bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR> Container;
+
+    if (a.get_allocator() == b.get_allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    // Copy each object using the allocator of the other, then swap the
+    // copies, which cannot throw, into place.
+
+    Container aCopy(a, b.get_allocator());
+    Container bCopy(b, a.get_allocator());
+
+    a.swap(bCopy);
+    b.swap(aCopy);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for flat ordered containers:
+//: o A flat ordered container defines STL iterators.
+//: o A flat ordered container uses 'bslma' allocators if the (template
+//:   parameter) type 'ALLOCATOR' is convertible from 'bslma::Allocator *'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{
+};
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{
+};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::flat_map<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator *, ALLOCATOR>
+{
+};
+
+template <class KEY, class VALUE, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<
+                        bsl::flat_multimap<KEY, VALUE, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator *, ALLOCATOR>
+{
+};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1940 @@
+// bslstl_flatmap.t.cpp                                               -*-C++-*-
+#include <bslstl_flatmap.h>
+
+#include <bslstl_map.h>
+#include <bslstl_multimap.h>
+#include <bslstl_sortedtags.h>
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslalg_hasstliterators.h>
+
+#include <bslmf_issame.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_stopwatch.h>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test provides two value-semantic container adaptors
+// and the proxy iterator they share.  Since their state is entirely held in
+// two parallel `bsl::vector` objects, we use the `keys` and `values`
+// accessors as the basic accessors, and check the invariant (the keys are
+// sorted, and, for `flat_map`, unique) after every manipulation.  The bulk
+// operations, which are the reason the component exists, are checked against
+// `bsl::map` and `bsl::multimap` oracles on pseudo-random input, for both the
+// append-only fast path and the merge path, and under injected allocation
+// failures.  Since most of the implementation is shared by the two
+// containers, `flat_multimap` is tested mainly where it differs.
+//-----------------------------------------------------------------------------
+// bslstl::FlatMap_Iterator
+// [ 2] reference operator*() const;
+// [ 2] pointer operator->() const;
+// [ 2] reference operator[](difference_type) const;
+// [ 2] arithmetic and relational operators
+//
+// bsl::flat_map
+// [ 2] flat_map();
+// [ 2] flat_map(const COMPARATOR&, const ALLOCATOR&);
+// [ 2] flat_map(const ALLOCATOR&);
+// [ 3] flat_map(const key_container_type&, const mapped_container_type&, ...);
+// [ 3] flat_map(MovableRef<key_container_type>, MovableRef<...>, const C&);
+// [ 3] flat_map(sorted_unique_t, const key_container_type&, ...);
+// [ 3] flat_map(sorted_unique_t, MovableRef<key_container_type>, ...);
+// [ 3] flat_map(INPUT_ITERATOR, INPUT_ITERATOR, const C&, const A&);
+// [ 3] flat_map(INPUT_ITERATOR, INPUT_ITERATOR, const A&);
+// [ 3] flat_map(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR, ...);
+// [ 3] flat_map(initializer_list<value_type>, const C&, const A&);
+// [ 3] flat_map(initializer_list<value_type>, const A&);
+// [ 3] flat_map(sorted_unique_t, initializer_list<value_type>, ...);
+// [ 5] flat_map(const flat_map&);
+// [ 5] flat_map(const flat_map&, const ALLOCATOR&);
+// [ 5] flat_map(MovableRef<flat_map>);
+// [ 5] flat_map(MovableRef<flat_map>, const ALLOCATOR&);
+// [ 5] flat_map& operator=(const flat_map&);
+// [ 5] flat_map& operator=(MovableRef<flat_map>);
+// [ 5] flat_map& operator=(initializer_list<value_type>);
+// [ 2] VALUE& operator[](const key_type&);
+// [ 2] VALUE& operator[](MovableRef<key_type>);
+// [ 2] VALUE& at(const key_type&);
+// [ 2] const VALUE& at(const key_type&) const;
+// [ 2] pair<iterator, bool> insert(const value_type&);
+// [ 2] pair<iterator, bool> insert(MovableRef<value_type>);
+// [ 2] iterator insert(const_iterator, const value_type&);
+// [ 2] iterator insert(const_iterator, MovableRef<value_type>);
+// [ 4] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 4] void insert(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 4] void insert(initializer_list<value_type>);
+// [ 4] void insert(sorted_unique_t, initializer_list<value_type>);
+// [ 6] iterator erase(iterator);
+// [ 6] iterator erase(const_iterator);
+// [ 6] size_type erase(const key_type&);
+// [ 6] iterator erase(const_iterator, const_iterator);
+// [ 3] void replace(MovableRef<key_container_type>, MovableRef<...>);
+// [ 5] void swap(flat_map&);
+// [ 2] void clear();
+// [ 2] iterator begin();
+// [ 2] iterator end();
+// [ 2] reverse_iterator rbegin();
+// [ 2] reverse_iterator rend();
+// [ 7] iterator find(const key_type&);
+// [ 7] iterator lower_bound(const key_type&);
+// [ 7] iterator upper_bound(const key_type&);
+// [ 7] pair<iterator, iterator> equal_range(const key_type&);
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator end() const;
+// [ 2] bool empty() const;
+// [ 2] size_type size() const;
+// [ 2] allocator_type get_allocator() const;
+// [ 7] key_compare key_comp() const;
+// [ 7] value_compare value_comp() const;
+// [ 7] const_iterator find(const key_type&) const;
+// [ 7] size_type count(const key_type&) const;
+// [ 7] bool contains(const key_type&) const;
+// [ 7] const_iterator lower_bound(const key_type&) const;
+// [ 7] const_iterator upper_bound(const key_type&) const;
+// [ 7] pair<const_iterator, const_iterator> equal_range(const key_type&);
+// [ 2] const key_container_type& keys() const;
+// [ 2] const mapped_container_type& values() const;
+// [ 8] bool operator==(const flat_map&, const flat_map&);
+// [ 8] bool operator!=(const flat_map&, const flat_map&);
+// [ 8] bool operator<(const flat_map&, const flat_map&);
+// [ 8] bool operator>(const flat_map&, const flat_map&);
+// [ 8] bool operator<=(const flat_map&, const flat_map&);
+// [ 8] bool operator>=(const flat_map&, const flat_map&);
+// [ 6] size_type erase_if(flat_map&, PREDICATE);
+// [ 5] void swap(flat_map&, flat_map&);
+// [11] void swap(flat_map&, flat_map&);
+//
+// bsl::flat_multimap
+// [ 9] iterator insert(const value_type&);
+// [ 9] iterator insert(const_iterator, const value_type&);
+// [ 9] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 9] void insert(sorted_equivalent_t, INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 9] size_type erase(const key_type&);
+// [ 9] size_type count(const key_type&) const;
+// [ 9] pair<const_iterator, const_iterator> equal_range(const key_type&);
+// [ 9] bool operator==(const flat_multimap&, const flat_multimap&);
+// [ 9] bool operator<(const flat_multimap&, const flat_multimap&);
+// [ 9] size_type erase_if(flat_multimap&, PREDICATE);
+// [11] void swap(flat_multimap&, flat_multimap&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [10] EXCEPTION SAFETY OF BULK INSERTION
+// [12] USAGE EXAMPLE
+// [-1] PERFORMANCE: `flat_map` VS. `map`
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+        fflush(stdout);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  PRINTF FORMAT MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ZU BSLS_BSLTESTUTIL_FORMAT_ZU
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bsl::flat_map<int, int>                     Obj;
+typedef bsl::flat_map<int, int, std::greater<int> > GObj;
+typedef bsl::flat_map<int, bsl::string>             SObj;
+typedef bsl::flat_multimap<int, int>                MObj;
+typedef bsl::pair<int, int>                         Pair;
+typedef bsl::vector<int>                            IntVector;
+typedef bsl::vector<Pair>                           PairVector;
+typedef bsl::map<int, int>                          Oracle;
+typedef bsl::multimap<int, int>                     MOracle;
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// Return a pseudo-random value derived from the specified `state`, and
+/// update `state`.
+unsigned int nextRandom(unsigned int *state)
+{
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 8;
+}
+
+/// Return `true` if the keys of the specified `map` are sorted under its
+/// comparator (and strictly so if the specified `isUnique` is `true`), and
+/// the key and value vectors have the same length, and `false` otherwise.
+template <class MAP>
+bool isValid(const MAP& map, bool isUnique)
+{
+    if (map.keys().size() != map.values().size()) {
+        return false;                                                 // RETURN
+    }
+    for (typename MAP::size_type i = 1; i < map.keys().size(); ++i) {
+        const bool isOrdered = isUnique
+                     ? map.key_comp()(map.keys()[i - 1], map.keys()[i])
+                     : !map.key_comp()(map.keys()[i], map.keys()[i - 1]);
+        if (!isOrdered) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+/// Return `true` if the specified `map` holds the same pairs, in the same
+/// order, as the specified `oracle`, and `false` otherwise.
+template <class MAP, class ORACLE>
+bool matches(const MAP& map, const ORACLE& oracle)
+{
+    if (map.size() != oracle.size()) {
+        return false;                                                 // RETURN
+    }
+    typename MAP::const_iterator    it = map.begin();
+    typename ORACLE::const_iterator ot = oracle.begin();
+    for (; it != map.end(); ++it, ++ot) {
+        if (it->first != ot->first || it->second != ot->second) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+/// Return `true` if the key of the specified `pair` is even, and `false`
+/// otherwise.
+bool hasEvenKey(Obj::const_reference pair)
+{
+    return 0 == pair.first % 2;
+}
+
+/// Return `true` if the value of the specified `pair` is odd, and `false`
+/// otherwise.
+bool hasOddValue(MObj::const_reference pair)
+{
+    return 0 != pair.second % 2;
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:
+      case 12: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: A Read-Mostly Symbol Table
+///- - - - - - - - - - - - - - - - - - -
+// Suppose we load a table of instrument identifiers and their prices once
+// per day, and then look prices up many times.
+//
+// First, we gather the identifiers and prices, which arrive in no particular
+// order, into two parallel vectors:
+// ```
+    bslma::TestAllocator ta;
+
+    bsl::vector<int>    ids(&ta);
+    bsl::vector<double> prices(&ta);
+
+    ids.push_back(300);  prices.push_back(12.5);
+    ids.push_back(100);  prices.push_back(99.0);
+    ids.push_back(200);  prices.push_back(47.25);
+// ```
+// Then, we create a `flat_map`, which sorts both vectors by key in one pass:
+// ```
+    bsl::flat_map<int, double> table(ids, prices, std::less<int>(), &ta);
+
+    ASSERT(3   == table.size());
+    ASSERT(100 == table.begin()->first);
+    ASSERT(99.0 == table.begin()->second);
+// ```
+// Next, we look up a price.  The search touches only the key vector:
+// ```
+    bsl::flat_map<int, double>::const_iterator it = table.find(200);
+    ASSERT(table.end() != it);
+    ASSERT(47.25 == it->second);
+// ```
+// Finally, we add a batch of identifiers that we know to be sorted and
+// greater than those already present, which appends them without sorting or
+// merging:
+// ```
+    bsl::pair<int, double> batch[] = { bsl::pair<int, double>(400, 1.0),
+                                       bsl::pair<int, double>(500, 2.0) };
+    table.insert(bsl::sorted_unique, batch, batch + 2);
+    ASSERT(5 == table.size());
+    ASSERT(2.0 == table[500]);
+// ```
+      } break;
+      case 11: {
+        // --------------------------------------------------------------------
+        // SWAP WITH UNEQUAL ALLOCATORS
+        //
+        // Concerns:
+        // 1. The free `swap` exchanges the values of two maps created with
+        //    different allocators.
+        //
+        // 2. Each map retains its allocator, and its elements use only that
+        //    allocator.
+        //
+        // 3. If an allocation fails, the exception propagates, both maps
+        //    keep their original values, and no memory is leaked.
+        //
+        // 4. The same holds for `flat_multimap`.
+        //
+        // Plan:
+        // 1. Using two distinct test allocators, create maps of `bsl::string`
+        //    values long enough to allocate, swap them under
+        //    `BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*`, and check the values,
+        //    the allocators of the maps and of their elements, and the
+        //    memory in use.  (C-1..4)
+        //
+        // Testing:
+        //   void swap(flat_map&, flat_map&);
+        //   void swap(flat_multimap&, flat_multimap&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSWAP WITH UNEQUAL ALLOCATORS"
+                            "\n============================\n");
+
+        typedef bsl::flat_multimap<int, bsl::string> SMObj;
+
+        bslma::TestAllocator oa1("object1",  veryVeryVeryVerbose);
+        bslma::TestAllocator oa2("object2",  veryVeryVeryVerbose);
+        bslma::TestAllocator za("different", veryVeryVeryVerbose);
+
+        const bsl::string VALUE(40, 'v');  // defeats the small buffer
+
+        if (verbose) printf("\tTesting `flat_map`.\n");
+        {
+            SObj mXX(&za);  const SObj& XX = mXX;
+            SObj mYY(&za);  const SObj& YY = mYY;
+            for (int i = 0; i < 3; ++i) {
+                mXX[i] = VALUE + 'x';
+            }
+            for (int i = 2; i < 9; ++i) {
+                mYY[i] = VALUE + 'y';
+            }
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa1) {
+                SObj mX(XX, &oa1);  const SObj& X = mX;
+                SObj mY(YY, &oa2);  const SObj& Y = mY;
+
+                try {
+                    swap(mX, mY);
+                }
+                catch (...) {
+                    ASSERT(XX == X);
+                    ASSERT(YY == Y);
+                    throw;
+                }
+
+                ASSERT(YY == X);
+                ASSERT(XX == Y);
+
+                ASSERT(&oa1 == X.get_allocator().mechanism());
+                ASSERT(&oa2 == Y.get_allocator().mechanism());
+                for (std::size_t i = 0; i < X.size(); ++i) {
+                    ASSERTV(i, &oa1 == X.values()[i].get_allocator()
+                                                              .mechanism());
+                }
+                for (std::size_t i = 0; i < Y.size(); ++i) {
+                    ASSERTV(i, &oa2 == Y.values()[i].get_allocator()
+                                                              .mechanism());
+                }
+
+                swap(mX, mY);
+                ASSERT(XX == X);
+                ASSERT(YY == Y);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(0 == oa1.numBlocksInUse());
+            ASSERT(0 == oa2.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tTesting `flat_multimap`.\n");
+        {
+            SMObj mXX(&za);  const SMObj& XX = mXX;
+            SMObj mYY(&za);  const SMObj& YY = mYY;
+            for (int i = 0; i < 3; ++i) {
+                mXX.insert(SMObj::value_type(i % 2, VALUE + 'x'));
+            }
+            for (int i = 0; i < 7; ++i) {
+                mYY.insert(SMObj::value_type(i % 3, VALUE + 'y'));
+            }
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa2) {
+                SMObj mX(XX, &oa1);  const SMObj& X = mX;
+                SMObj mY(YY, &oa2);  const SMObj& Y = mY;
+
+                try {
+                    swap(mX, mY);
+                }
+                catch (...) {
+                    ASSERT(XX == X);
+                    ASSERT(YY == Y);
+                    throw;
+                }
+
+                ASSERT(YY == X);
+                ASSERT(XX == Y);
+
+                ASSERT(&oa1 == X.get_allocator().mechanism());
+                ASSERT(&oa2 == Y.get_allocator().mechanism());
+                for (std::size_t i = 0; i < X.size(); ++i) {
+                    ASSERTV(i, &oa1 == X.values()[i].get_allocator()
+                                                              .mechanism());
+                }
+                for (std::size_t i = 0; i < Y.size(); ++i) {
+                    ASSERTV(i, &oa2 == Y.values()[i].get_allocator()
+                                                              .mechanism());
+                }
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(0 == oa1.numBlocksInUse());
+            ASSERT(0 == oa2.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tTesting equal allocators.\n");
+        {
+            SObj mX(&oa1);  const SObj& X = mX;
+            SObj mY(&oa1);  const SObj& Y = mY;
+            mX[1] = VALUE;
+            mY[2] = VALUE;
+
+            const SObj XX(X, &za);
+            const SObj YY(Y, &za);
+
+            bslma::TestAllocatorMonitor oam(&oa1);
+
+            swap(mX, mY);
+            ASSERT(YY == X);
+            ASSERT(XX == Y);
+
+            ASSERT(oam.isTotalSame());
+        }
+        ASSERT(0 == za.numBlocksInUse());
+      } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY OF BULK INSERTION
+        //
+        // Concerns:
+        // 1. If an allocation fails during a bulk insertion, whether on the
+        //    append-only path or on the merge path, the exception propagates,
+        //    and no memory is leaked.
+        //
+        // 2. If the move constructors of the key and value types do not
+        //    throw, the map is left with its original value.
+        //
+        // 3. The same holds for `flat_multimap`.
+        //
+        // Plan:
+        // 1. For each of a set of initial contents and ranges to insert, run
+        //    the insertion under `BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*`, using
+        //    `bsl::string` values long enough to allocate, and check the
+        //    value in the handler and at the end of each iteration.
+        //    (C-1..3)
+        //
+        // Testing:
+        //   EXCEPTION SAFETY OF BULK INSERTION
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nEXCEPTION SAFETY OF BULK INSERTION"
+                            "\n==================================\n");
+
+        typedef bsl::flat_multimap<int, bsl::string> SMObj;
+
+        static const struct {
+            int         d_line;
+            const char *d_initial;  // initial keys, one digit each
+            const char *d_insert;   // keys to insert, one digit each
+        } DATA[] = {
+            //LINE INITIAL    INSERT
+            //---- ---------  ---------
+            { L_,  "",        "3210"     },
+            { L_,  "01",      "5432"     },  // append-only
+            { L_,  "01",      "2345"     },  // append-only, sorted
+            { L_,  "0246",    "7153"     },  // merge
+            { L_,  "0246",    "642080"   },  // merge, mostly duplicates
+            { L_,  "0123456", "987610"   },  // merge at both ends
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE    = DATA[ti].d_line;
+            const char *const INITIAL = DATA[ti].d_initial;
+            const char *const INSERT  = DATA[ti].d_insert;
+
+            if (veryVerbose) { T_ P_(LINE) P_(INITIAL) P(INSERT) }
+
+            const bsl::string VALUE(40, 'v');  // defeats the small buffer
+
+            bsl::vector<bsl::pair<int, bsl::string> > initial, insert;
+            for (const char *p = INITIAL; *p; ++p) {
+                initial.push_back(bsl::pair<int, bsl::string>(*p - '0',
+                                                              VALUE + *p));
+            }
+            for (const char *p = INSERT; *p; ++p) {
+                insert.push_back(bsl::pair<int, bsl::string>(*p - '0',
+                                                             VALUE + 'x'));
+            }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                SObj mX(initial.begin(), initial.end(), &oa);
+                const SObj& X = mX;
+
+                try {
+                    mX.insert(insert.begin(), insert.end());
+                }
+                catch (...) {
+                    ASSERTV(LINE, isValid(X, true));
+                    ASSERTV(LINE, matches(X, initial));
+                    throw;
+                }
+
+                bsl::map<int, bsl::string> oracle(initial.begin(),
+                                                  initial.end());
+                oracle.insert(insert.begin(), insert.end());
+                ASSERTV(LINE, matches(X, oracle));
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                SMObj mX(initial.begin(), initial.end(), &oa);
+                const SMObj& X = mX;
+
+                try {
+                    mX.insert(insert.begin(), insert.end());
+                }
+                catch (...) {
+                    ASSERTV(LINE, isValid(X, false));
+                    ASSERTV(LINE, matches(X, initial));
+                    throw;
+                }
+
+                bsl::multimap<int, bsl::string> oracle(initial.begin(),
+                                                       initial.end());
+                oracle.insert(insert.begin(), insert.end());
+                ASSERTV(LINE, matches(X, oracle));
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+        }
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // `flat_multimap`
+        //
+        // Concerns:
+        // 1. Single-pair insertion always inserts: without a hint, after any
+        //    pairs with equivalent keys, and with a hint, as close as
+        //    possible before the hint.
+        //
+        // 2. Bulk insertion keeps all the pairs, and preserves the relative
+        //    order of pairs with equivalent keys, placing those already
+        //    present first.
+        //
+        // 3. `erase(key)` and `count` act on all the pairs with the key, and
+        //    `equal_range` returns their range.
+        //
+        // 4. Comparison operators and `erase_if` behave as for `flat_map`.
+        //
+        // Plan:
+        // 1. Perform each operation on pseudo-random input, and compare
+        //    against a `bsl::multimap` oracle, which has the same ordering
+        //    guarantees.  (C-1..4)
+        //
+        // Testing:
+        //   iterator insert(const value_type&);
+        //   iterator insert(const_iterator, const value_type&);
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(sorted_equivalent_t, INPUT_ITERATOR, INPUT_ITERATOR);
+        //   size_type erase(const key_type&);
+        //   size_type count(const key_type&) const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        //   bool operator==(const flat_multimap&, const flat_multimap&);
+        //   bool operator<(const flat_multimap&, const flat_multimap&);
+        //   size_type erase_if(flat_multimap&, PREDICATE);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\n`flat_multimap`"
+                            "\n===============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        unsigned int state = 7;
+
+        if (verbose) printf("\tSingle-pair insertion.\n");
+        {
+            MObj    mX(&oa);  const MObj& X = mX;
+            MOracle oracle;
+
+            for (int i = 0; i < 200; ++i) {
+                const Pair PAIR(nextRandom(&state) % 20, i);
+
+                MObj::iterator    it;
+                MOracle::iterator oit;
+                switch (i % 4) {
+                  case 0: {
+                    it  = mX.insert(PAIR);
+                    oit = oracle.insert(PAIR);
+                  } break;
+                  case 1: {
+                    it  = mX.insert(X.begin(), PAIR);
+                    oit = oracle.insert(oracle.begin(), PAIR);
+                  } break;
+                  case 2: {
+                    it  = mX.insert(X.lower_bound(PAIR.first), PAIR);
+                    oit = oracle.insert(oracle.lower_bound(PAIR.first), PAIR);
+                  } break;
+                  default: {
+                    it  = mX.insert(X.end(), PAIR);
+                    oit = oracle.insert(oracle.end(), PAIR);
+                  } break;
+                }
+
+                ASSERTV(i, PAIR.first  == it->first);
+                ASSERTV(i, PAIR.second == it->second);
+                ASSERTV(i, std::distance(oracle.begin(), oit) ==
+                                                             it - mX.begin());
+            }
+            ASSERT(matches(X, oracle));
+
+            for (int k = -1; k <= 20; ++k) {
+                ASSERTV(k, oracle.count(k) == X.count(k));
+                ASSERTV(k, oracle.count(k) ==
+                            static_cast<MObj::size_type>(
+                                std::distance(X.equal_range(k).first,
+                                              X.equal_range(k).second)));
+                ASSERTV(k, oracle.erase(k) == mX.erase(k));
+                ASSERTV(k, matches(X, oracle));
+            }
+            ASSERT(X.empty());
+        }
+
+        if (verbose) printf("\tBulk insertion.\n");
+        {
+            static const int SIZES[] = { 0, 1, 5, 50, 500 };
+            const int        NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+            for (int si = 0; si < NUM_SIZES; ++si) {
+                for (int ni = 0; ni < NUM_SIZES; ++ni) {
+                    const int INITIAL = SIZES[si];
+                    const int NEW     = SIZES[ni];
+
+                    PairVector initial, insert;
+                    for (int i = 0; i < INITIAL; ++i) {
+                        initial.push_back(Pair(nextRandom(&state) % 30, i));
+                    }
+                    for (int i = 0; i < NEW; ++i) {
+                        insert.push_back(Pair(nextRandom(&state) % 40,
+                                              1000 + i));
+                    }
+
+                    MObj    mX(initial.begin(), initial.end(), &oa);
+                    MOracle oracle(initial.begin(), initial.end());
+                    ASSERTV(INITIAL, NEW, matches(mX, oracle));
+
+                    MObj mS(mX, &oa);
+
+                    mX.insert(insert.begin(), insert.end());
+                    oracle.insert(insert.begin(), insert.end());
+                    ASSERTV(INITIAL, NEW, matches(mX, oracle));
+                    ASSERTV(INITIAL, NEW, isValid(mX, false));
+
+                    const MOracle sorted(insert.begin(), insert.end());
+                    mS.insert(bsl::sorted_equivalent,
+                              sorted.begin(),
+                              sorted.end());
+                    ASSERTV(INITIAL, NEW, mX == mS);
+                    ASSERTV(INITIAL, NEW, !(mX < mS) && !(mS < mX));
+                }
+            }
+        }
+
+        if (verbose) printf("\tComparison and `erase_if`.\n");
+        {
+            const Pair A[] = { Pair(1, 1), Pair(1, 2), Pair(2, 3) };
+            const Pair B[] = { Pair(1, 2), Pair(1, 1), Pair(2, 3) };
+
+            MObj mX(A, A + 3, &oa);  const MObj& X = mX;
+            MObj mY(B, B + 3, &oa);  const MObj& Y = mY;
+
+            ASSERT(X != Y);
+            ASSERT(X <  Y);
+            ASSERT(Y >  X);
+            ASSERT(X <= Y);
+
+            ASSERT(2 == bsl::erase_if(mX, hasOddValue));
+            ASSERT(1 == X.size());
+            ASSERT(2 == X.begin()->second);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // COMPARISON OPERATORS
+        //
+        // Concerns:
+        // 1. Two maps compare equal if and only if they hold the same pairs.
+        //
+        // 2. The relational operators order maps lexicographically by pair.
+        //
+        // Plan:
+        // 1. For every pair of a table of maps, compare the result of each
+        //    operator with that for the corresponding `bsl::map` objects.
+        //    (C-1..2)
+        //
+        // Testing:
+        //   bool operator==(const flat_map&, const flat_map&);
+        //   bool operator!=(const flat_map&, const flat_map&);
+        //   bool operator<(const flat_map&, const flat_map&);
+        //   bool operator>(const flat_map&, const flat_map&);
+        //   bool operator<=(const flat_map&, const flat_map&);
+        //   bool operator>=(const flat_map&, const flat_map&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOMPARISON OPERATORS"
+                            "\n====================\n");
+
+        // Each spec is a sequence of key-value digit pairs.
+
+        static const char *const SPECS[] = {
+            "", "10", "11", "1020", "1021", "1120", "102030", "20", "2030"
+        };
+        const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int i = 0; i < NUM_SPECS; ++i) {
+            Obj    mX(&oa);  const Obj& X = mX;
+            Oracle ox;
+            for (const char *p = SPECS[i]; *p; p += 2) {
+                mX[p[0] - '0'] = p[1] - '0';
+                ox[p[0] - '0'] = p[1] - '0';
+            }
+
+            for (int j = 0; j < NUM_SPECS; ++j) {
+                Obj    mY(&oa);  const Obj& Y = mY;
+                Oracle oy;
+                for (const char *p = SPECS[j]; *p; p += 2) {
+                    mY[p[0] - '0'] = p[1] - '0';
+                    oy[p[0] - '0'] = p[1] - '0';
+                }
+
+                if (veryVerbose) { T_ P_(SPECS[i]) P(SPECS[j]) }
+
+                ASSERTV(i, j, (ox == oy) == (X == Y));
+                ASSERTV(i, j, (ox != oy) == (X != Y));
+                ASSERTV(i, j, (ox <  oy) == (X <  Y));
+                ASSERTV(i, j, (ox >  oy) == (X >  Y));
+                ASSERTV(i, j, (ox <= oy) == (X <= Y));
+                ASSERTV(i, j, (ox >= oy) == (X >= Y));
+            }
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // LOOKUP
+        //
+        // Concerns:
+        // 1. `find`, `count`, `contains`, `lower_bound`, `upper_bound`, and
+        //    `equal_range` agree with those of `bsl::map` for keys that are
+        //    present, absent, smaller than all keys, and larger than all keys.
+        //
+        // 2. The modifiable overloads return iterators through which values
+        //    can be modified.
+        //
+        // 3. Lookup uses the comparator supplied at construction, which is
+        //    returned by `key_comp`; `value_comp` compares pairs by key.
+        //
+        // 4. Lookup allocates no memory.
+        //
+        // Plan:
+        // 1. Fill a map and an oracle with the odd numbers below 40, and
+        //    compare the results of lookup for every key in [-1, 41].
+        //    (C-1, 4)
+        //
+        // 2. Modify a value through the result of each modifiable lookup.
+        //    (C-2)
+        //
+        // 3. Repeat with a map ordered by `std::greater<int>`.  (C-3)
+        //
+        // Testing:
+        //   iterator find(const key_type&);
+        //   iterator lower_bound(const key_type&);
+        //   iterator upper_bound(const key_type&);
+        //   pair<iterator, iterator> equal_range(const key_type&);
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        //   const_iterator find(const key_type&) const;
+        //   size_type count(const key_type&) const;
+        //   bool contains(const key_type&) const;
+        //   const_iterator lower_bound(const key_type&) const;
+        //   const_iterator upper_bound(const key_type&) const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP"
+                            "\n======\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj    mX(&oa);                       const Obj&  X = mX;
+        GObj   mG(std::greater<int>(), &oa);  const GObj& G = mG;
+        Oracle oracle;
+
+        for (int i = 1; i < 40; i += 2) {
+            mX[i]     = i * 10;
+            mG[i]     = i * 10;
+            oracle[i] = i * 10;
+        }
+        ASSERT(matches(X, oracle));
+        ASSERT(isValid(G, true));
+        ASSERT(39 == G.begin()->first);
+        ASSERT( G.key_comp()(2, 1));
+        ASSERT( G.value_comp()(Pair(2, 0), Pair(1, 5)));
+        ASSERT(!X.value_comp()(Pair(2, 0), Pair(1, 5)));
+
+        bslma::TestAllocatorMonitor oam(&oa);
+
+        for (int k = -1; k <= 41; ++k) {
+            if (veryVerbose) { T_ P(k) }
+
+            const bool PRESENT = oracle.count(k);
+
+            ASSERTV(k, PRESENT == X.contains(k));
+            ASSERTV(k, (PRESENT ? 1u : 0u) == X.count(k));
+            ASSERTV(k, PRESENT == (X.end() != X.find(k)));
+            ASSERTV(k, !PRESENT || k * 10 == X.find(k)->second);
+
+            const Oracle&                ORACLE = oracle;
+            const Oracle::const_iterator OLB    = ORACLE.lower_bound(k);
+            const Oracle::const_iterator OUB    = ORACLE.upper_bound(k);
+
+            ASSERTV(k, std::distance(ORACLE.begin(), OLB) ==
+                                                X.lower_bound(k) - X.begin());
+            ASSERTV(k, std::distance(ORACLE.begin(), OUB) ==
+                                                X.upper_bound(k) - X.begin());
+
+            const bsl::pair<Obj::const_iterator, Obj::const_iterator> R =
+                                                             X.equal_range(k);
+            ASSERTV(k, X.lower_bound(k) == R.first);
+            ASSERTV(k, X.upper_bound(k) == R.second);
+
+            const bsl::pair<Obj::iterator, Obj::iterator> MR =
+                                                            mX.equal_range(k);
+            ASSERTV(k, R.first == MR.first);
+            ASSERTV(k, mX.lower_bound(k) == MR.first);
+            ASSERTV(k, mX.upper_bound(k) == MR.second);
+
+            if (PRESENT) {
+                mX.find(k)->second += 1;
+                ASSERTV(k, k * 10 + 1 == X.at(k));
+                mX.find(k)->second -= 1;
+            }
+
+            ASSERTV(k, PRESENT == G.contains(k));
+            ASSERTV(k, PRESENT == (G.end() != G.find(k)));
+            ASSERTV(k, G.lower_bound(k) == G.equal_range(k).first);
+            ASSERTV(k, G.end() == G.lower_bound(k) ||
+                                                 G.lower_bound(k)->first <= k);
+        }
+
+        ASSERT(oam.isTotalSame());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // ERASE
+        //
+        // Concerns:
+        // 1. `erase(position)` removes the pair at `position` and returns an
+        //    iterator to the following pair.
+        //
+        // 2. `erase(key)` returns the number of pairs removed, 0 or 1.
+        //
+        // 3. `erase(first, last)` removes the pairs in the range and returns
+        //    an iterator to the pair that followed them.
+        //
+        // 4. `erase_if` removes exactly the pairs satisfying the predicate,
+        //    and returns their number.
+        //
+        // 5. The key and value vectors stay parallel.
+        //
+        // Plan:
+        // 1. Perform each kind of erasure on maps of the numbers below 20,
+        //    and compare against an oracle.  (C-1..5)
+        //
+        // Testing:
+        //   iterator erase(iterator);
+        //   iterator erase(const_iterator);
+        //   size_type erase(const key_type&);
+        //   iterator erase(const_iterator, const_iterator);
+        //   size_type erase_if(flat_map&, PREDICATE);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nERASE"
+                            "\n=====\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        PairVector pairs;
+        for (int i = 0; i < 20; ++i) {
+            pairs.push_back(Pair(i, -i));
+        }
+
+        if (verbose) printf("\tErase by position.\n");
+        {
+            Obj mX(pairs.begin(), pairs.end(), &oa);  const Obj& X = mX;
+
+            Obj::iterator it = mX.erase(mX.find(5));
+            ASSERT(6 == it->first);
+            ASSERT(-6 == it->second);
+            ASSERT(19 == X.size());
+            ASSERT(!X.contains(5));
+
+            it = mX.erase(X.find(19));
+            ASSERT(mX.end() == it);
+
+            it = mX.erase(X.begin());
+            ASSERT(1 == it->first);
+            ASSERT(17 == X.size());
+            ASSERT(isValid(X, true));
+        }
+
+        if (verbose) printf("\tErase by key.\n");
+        {
+            Obj mX(pairs.begin(), pairs.end(), &oa);  const Obj& X = mX;
+
+            ASSERT(1 == mX.erase(7));
+            ASSERT(0 == mX.erase(7));
+            ASSERT(0 == mX.erase(100));
+            ASSERT(19 == X.size());
+            ASSERT(isValid(X, true));
+            ASSERT(-8 == X.at(8));
+        }
+
+        if (verbose) printf("\tErase a range.\n");
+        {
+            for (int b = 0; b <= 20; ++b) {
+                for (int e = b; e <= 20; ++e) {
+                    Obj        mX(pairs.begin(), pairs.end(), &oa);
+                    const Obj& X = mX;
+                    Oracle     oracle(pairs.begin(), pairs.end());
+
+                    Obj::iterator it = mX.erase(X.begin() + b, X.begin() + e);
+                    oracle.erase(oracle.lower_bound(b), oracle.lower_bound(e));
+
+                    ASSERTV(b, e, matches(X, oracle));
+                    ASSERTV(b, e, mX.begin() + b == it);
+                }
+            }
+        }
+
+        if (verbose) printf("\tErase by predicate.\n");
+        {
+            Obj mX(pairs.begin(), pairs.end(), &oa);  const Obj& X = mX;
+
+            ASSERT(10 == bsl::erase_if(mX, hasEvenKey));
+            ASSERT(10 == X.size());
+            ASSERT(isValid(X, true));
+            for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(it->first, !hasEvenKey(*it));
+                ASSERTV(it->first, -it->first == it->second);
+            }
+            ASSERT(0 == bsl::erase_if(mX, hasEvenKey));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, ASSIGNMENT, AND SWAP
+        //
+        // Concerns:
+        // 1. Copy construction copies the pairs, using the supplied allocator
+        //    or, if none, the default allocator.
+        //
+        // 2. Move construction with no allocator, or with an equal one,
+        //    allocates no memory and transfers the pairs.
+        //
+        // 3. Move construction with a different allocator copies the pairs
+        //    into memory from that allocator.
+        //
+        // 4. Copy and move assignment leave the target with the value of the
+        //    source, using the target's allocator.
+        //
+        // 5. `swap` exchanges the pairs without allocating.
+        //
+        // Plan:
+        // 1. Exercise each operation on `bsl::string` values long enough to
+        //    allocate, checking values and allocator use.  (C-1..5)
+        //
+        // Testing:
+        //   flat_map(const flat_map&);
+        //   flat_map(const flat_map&, const ALLOCATOR&);
+        //   flat_map(MovableRef<flat_map>);
+        //   flat_map(MovableRef<flat_map>, const ALLOCATOR&);
+        //   flat_map& operator=(const flat_map&);
+        //   flat_map& operator=(MovableRef<flat_map>);
+        //   flat_map& operator=(initializer_list<value_type>);
+        //   void swap(flat_map&);
+        //   void swap(flat_map&, flat_map&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, MOVE, ASSIGNMENT, AND SWAP"
+                            "\n================================\n");
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        const bsl::string VALUE(40, 'v');
+
+        SObj mW(&oa);  const SObj& W = mW;
+        for (int i = 0; i < 10; ++i) {
+            mW[i] = VALUE;
+        }
+
+        if (verbose) printf("\tCopy construction.\n");
+        {
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+            const SObj X(W);
+            ASSERT(W == X);
+            ASSERT(&defaultAllocator == X.get_allocator().mechanism());
+            ASSERT(&defaultAllocator ==
+                                      X.values().get_allocator().mechanism());
+            ASSERT(dam.isInUseUp());
+
+            const SObj Y(W, &za);
+            ASSERT(W == Y);
+            ASSERT(&za == Y.get_allocator().mechanism());
+            ASSERT(&za == Y.values()[0].get_allocator().mechanism());
+        }
+
+        if (verbose) printf("\tMove construction.\n");
+        {
+            SObj mS(W, &oa);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            SObj mX(MoveUtil::move(mS));  const SObj& X = mX;
+            ASSERT(W == X);
+            ASSERT(&oa == X.get_allocator().mechanism());
+            ASSERT(oam.isTotalSame());
+
+            SObj mY(MoveUtil::move(mX), &oa);  const SObj& Y = mY;
+            ASSERT(W == Y);
+            ASSERT(oam.isTotalSame());
+
+            SObj mZ(MoveUtil::move(mY), &za);  const SObj& Z = mZ;
+            ASSERT(W == Z);
+            ASSERT(&za == Z.get_allocator().mechanism());
+            ASSERT(0 < za.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tAssignment.\n");
+        {
+            SObj mX(&za);  const SObj& X = mX;
+            mX[99] = VALUE;
+
+            mX = W;
+            ASSERT(W == X);
+            ASSERT(&za == X.get_allocator().mechanism());
+
+            SObj mS(W, &oa);
+            mX.clear();
+            mX = MoveUtil::move(mS);
+            ASSERT(W == X);
+            ASSERT(&za == X.get_allocator().mechanism());
+
+            SObj mY(&oa);  const SObj& Y = mY;
+            SObj mT(W, &oa);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+            mY = MoveUtil::move(mT);
+            ASSERT(W == Y);
+            ASSERT(oam.isTotalSame());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            Obj mI(&oa);  const Obj& I = mI;
+            mI = { { 3, 0 }, { 1, 1 }, { 2, 2 }, { 1, 3 } };
+            ASSERT(3 == I.size());
+            ASSERT(1 == I.at(1));
+#endif
+        }
+
+        if (verbose) printf("\tSwap.\n");
+        {
+            SObj mX(W, &oa);  const SObj& X = mX;
+            SObj mY(&oa);     const SObj& Y = mY;
+            mY[99] = VALUE;
+
+            const SObj XX(X, &za);
+            const SObj YY(Y, &za);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            mX.swap(mY);
+            ASSERT(YY == X);
+            ASSERT(XX == Y);
+
+            swap(mX, mY);
+            ASSERT(XX == X);
+            ASSERT(YY == Y);
+
+            ASSERT(oam.isTotalSame());
+        }
+        ASSERT(0 == za.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // BULK INSERTION
+        //
+        // Concerns:
+        // 1. Inserting a range, whether sorted or not, and whether it
+        //    overlaps the keys present or lies entirely after them, leaves
+        //    the union of the pairs, with the pairs present before the
+        //    insertion, and then the earliest pair in the range, winning over
+        //    pairs with equivalent keys.
+        //
+        // 2. Inserting a sorted, unique range with the `sorted_unique` tag
+        //    gives the same result as without it.
+        //
+        // 3. Initializer lists are supported.
+        //
+        // Plan:
+        // 1. For many pseudo-random initial contents and ranges, of various
+        //    sizes and key spreads, and with each value unique, insert into a
+        //    map and a `bsl::map` oracle (which keeps the same pairs) and
+        //    compare.  (C-1)
+        //
+        // 2. Insert a sorted version of each range with `sorted_unique`.
+        //    (C-2)
+        //
+        // 3. Insert from initializer lists.  (C-3)
+        //
+        // Testing:
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(initializer_list<value_type>);
+        //   void insert(sorted_unique_t, initializer_list<value_type>);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBULK INSERTION"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        unsigned int state = 1;
+
+        static const int SIZES[] = { 0, 1, 2, 3, 7, 16, 100, 1000 };
+        const int        NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            for (int ni = 0; ni < NUM_SIZES; ++ni) {
+                for (int spread = 1; spread <= 4096; spread *= 8) {
+                    const int INITIAL = SIZES[si];
+                    const int NEW     = SIZES[ni];
+
+                    if (veryVerbose) { T_ P_(INITIAL) P_(NEW) P(spread) }
+
+                    PairVector initial, insert;
+                    for (int i = 0; i < INITIAL; ++i) {
+                        initial.push_back(Pair(nextRandom(&state) % spread,
+                                               i));
+                    }
+                    for (int i = 0; i < NEW; ++i) {
+                        insert.push_back(Pair(nextRandom(&state) % spread +
+                                                    (spread == 8 ? spread : 0),
+                                              100000 + i));
+                    }
+
+                    Obj        mX(initial.begin(), initial.end(), &oa);
+                    const Obj& X = mX;
+                    Oracle     oracle(initial.begin(), initial.end());
+                    ASSERTV(INITIAL, NEW, spread, matches(X, oracle));
+
+                    Obj mS(X, &oa);  const Obj& S = mS;
+
+                    mX.insert(insert.begin(), insert.end());
+                    oracle.insert(insert.begin(), insert.end());
+                    ASSERTV(INITIAL, NEW, spread, matches(X, oracle));
+                    ASSERTV(INITIAL, NEW, spread, isValid(X, true));
+
+                    const Oracle sorted(insert.begin(), insert.end());
+                    mS.insert(bsl::sorted_unique,
+                              sorted.begin(),
+                              sorted.end());
+                    ASSERTV(INITIAL, NEW, spread, X == S);
+                }
+            }
+        }
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            Obj mX({ { 5, 0 }, { 3, 1 }, { 5, 2 } }, &oa);
+            const Obj& X = mX;
+            ASSERT(2 == X.size());
+            ASSERT(0 == X.at(5));
+
+            mX.insert({ { 4, 3 }, { 3, 4 }, { 9, 5 } });
+            ASSERT(4 == X.size());
+            ASSERT(1 == X.at(3));
+
+            mX.insert(bsl::sorted_unique, { { 10, 6 }, { 11, 7 } });
+            ASSERT(6 == X.size());
+            ASSERT(11 == X.rbegin()->first);
+            ASSERT(isValid(X, true));
+        }
+#endif
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTION FROM SEQUENCES
+        //
+        // Concerns:
+        // 1. Construction from parallel containers or from a range of pairs
+        //    sorts the pairs by key, keeping them paired, and keeps the first
+        //    of the pairs with equivalent keys.
+        //
+        // 2. Construction with `sorted_unique` adopts the pairs as they are.
+        //
+        // 3. Construction from moved containers, and `replace`, take over
+        //    their memory without allocating.
+        //
+        // 4. The allocator is the one supplied, or the default allocator.
+        //
+        // Plan:
+        // 1. Construct maps with each constructor from a shuffled sequence
+        //    with duplicate keys, and from its sorted, unique counterpart,
+        //    and check the pairs and allocator.  (C-1..4)
+        //
+        // Testing:
+        //   flat_map(const key_container_type&, const mapped_container_type&,
+        //   flat_map(MovableRef<key_container_type>, MovableRef<...>, ...);
+        //   flat_map(sorted_unique_t, const key_container_type&, ...);
+        //   flat_map(sorted_unique_t, MovableRef<key_container_type>, ...);
+        //   flat_map(INPUT_ITERATOR, INPUT_ITERATOR, const C&, const A&);
+        //   flat_map(INPUT_ITERATOR, INPUT_ITERATOR, const A&);
+        //   flat_map(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR, ...);
+        //   flat_map(initializer_list<value_type>, const C&, const A&);
+        //   flat_map(initializer_list<value_type>, const A&);
+        //   flat_map(sorted_unique_t, initializer_list<value_type>, ...);
+        //   void replace(MovableRef<key_container_type>, MovableRef<...>);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONSTRUCTION FROM SEQUENCES"
+                            "\n===========================\n");
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        static const int KEYS[] = { 8, 3, 5, 3, 0, 9, 1, 8, 2, 7, 4, 6, 0 };
+        const int        NUM_KEYS = sizeof KEYS / sizeof *KEYS;
+
+        IntVector  keys(&oa), values(&oa);
+        PairVector pairs(&oa);
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            keys.push_back(KEYS[i]);
+            values.push_back(i);
+            pairs.push_back(Pair(KEYS[i], i));
+        }
+        const Oracle EXPECTED(pairs.begin(), pairs.end());
+
+        IntVector sortedKeys(&oa), sortedValues(&oa);
+        for (Oracle::const_iterator it = EXPECTED.begin();
+             it != EXPECTED.end();
+             ++it) {
+            sortedKeys.push_back(it->first);
+            sortedValues.push_back(it->second);
+        }
+
+        {
+            const Obj X(keys, values, std::less<int>(), &oa);
+            ASSERT(matches(X, EXPECTED));
+            ASSERT(&oa == X.get_allocator().mechanism());
+
+            const Obj Y(pairs.begin(), pairs.end(), &oa);
+            ASSERT(matches(Y, EXPECTED));
+
+            const Obj Z(pairs.begin(), pairs.end());
+            ASSERT(matches(Z, EXPECTED));
+            ASSERT(&defaultAllocator == Z.get_allocator().mechanism());
+
+            const GObj G(pairs.begin(), pairs.end());
+            ASSERT(9 == G.begin()->first);
+            ASSERT(isValid(G, true));
+
+            const Obj S(bsl::sorted_unique,
+                        sortedKeys,
+                        sortedValues,
+                        std::less<int>(),
+                        &oa);
+            ASSERT(matches(S, EXPECTED));
+
+            const Obj T(bsl::sorted_unique, EXPECTED.begin(), EXPECTED.end());
+            ASSERT(matches(T, EXPECTED));
+        }
+        {
+            IntVector k(keys, &oa), v(values, &oa);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            const Obj X(MoveUtil::move(k), MoveUtil::move(v));
+            ASSERT(matches(X, EXPECTED));
+            ASSERT(&oa == X.get_allocator().mechanism());
+
+            IntVector sk(sortedKeys, &oa), sv(sortedValues, &oa);
+            const Obj Y(bsl::sorted_unique,
+                        MoveUtil::move(sk),
+                        MoveUtil::move(sv));
+            ASSERT(matches(Y, EXPECTED));
+        }
+        {
+            Obj       mX(&oa);  const Obj& X = mX;
+            IntVector k(sortedKeys, &oa), v(sortedValues, &oa);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            mX.replace(MoveUtil::move(k), MoveUtil::move(v));
+            ASSERT(matches(X, EXPECTED));
+            ASSERT(oam.isInUseSame());
+            ASSERT(sortedKeys   == X.keys());
+            ASSERT(sortedValues == X.values());
+        }
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            const Obj X({ { 2, 0 }, { 1, 1 }, { 2, 2 }, { 0, 3 } },
+                        std::less<int>(),
+                        &oa);
+            ASSERT(3 == X.size());
+            ASSERT(0 == X.at(2));
+
+            const Obj Y({ { 2, 0 }, { 1, 1 }, { 2, 2 }, { 0, 3 } }, &oa);
+            ASSERT(X == Y);
+
+            const Obj Z(bsl::sorted_unique,
+                        { { 0, 3 }, { 1, 1 }, { 2, 0 } },
+                        std::less<int>(),
+                        &oa);
+            ASSERT(X == Z);
+        }
+#endif
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS, BASIC ACCESSORS, AND ITERATORS
+        //
+        // Concerns:
+        // 1. A default-constructed map is empty and uses the supplied
+        //    allocator, or else the default allocator, for both vectors.
+        //
+        // 2. Inserting a pair whose key is absent returns an iterator to it
+        //    and `true`; inserting one whose key is present returns an
+        //    iterator to the existing pair and `false`, and does not modify
+        //    the map.
+        //
+        // 3. Hinted insertion gives the same result for correct and incorrect
+        //    hints.
+        //
+        // 4. `operator[]` inserts a value-initialized value if the key is
+        //    absent, and returns a modifiable reference to the value.
+        //
+        // 5. `at` returns the value, and throws `std::out_of_range` if the
+        //    key is absent.
+        //
+        // 6. The proxy iterators traverse the pairs in order, support the
+        //    random-access operations, give modifiable access to the values,
+        //    convert to `const_iterator`, and work with `reverse_iterator`.
+        //
+        // 7. `clear` removes all pairs.
+        //
+        // Plan:
+        // 1. Insert the pairs of a table in order, with and without hints,
+        //    and check the results against an oracle.  (C-1..3, 7)
+        //
+        // 2. Use `operator[]` and `at` on present and absent keys.  (C-4..5)
+        //
+        // 3. Exercise the iterator operations on a small map.  (C-6)
+        //
+        // Testing:
+        //   flat_map();
+        //   flat_map(const COMPARATOR&, const ALLOCATOR&);
+        //   flat_map(const ALLOCATOR&);
+        //   VALUE& operator[](const key_type&);
+        //   VALUE& operator[](MovableRef<key_type>);
+        //   VALUE& at(const key_type&);
+        //   const VALUE& at(const key_type&) const;
+        //   pair<iterator, bool> insert(const value_type&);
+        //   pair<iterator, bool> insert(MovableRef<value_type>);
+        //   iterator insert(const_iterator, const value_type&);
+        //   iterator insert(const_iterator, MovableRef<value_type>);
+        //   void clear();
+        //   iterator begin();
+        //   iterator end();
+        //   reverse_iterator rbegin();
+        //   reverse_iterator rend();
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   bool empty() const;
+        //   size_type size() const;
+        //   allocator_type get_allocator() const;
+        //   const key_container_type& keys() const;
+        //   const mapped_container_type& values() const;
+        //   reference operator*() const;
+        //   pointer operator->() const;
+        //   reference operator[](difference_type) const;
+        //   arithmetic and relational operators
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPRIMARY MANIPULATORS, BASIC ACCESSORS"
+                            "\n=====================================\n");
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        if (verbose) printf("\tDefault construction.\n");
+        {
+            const Obj X;
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(X.begin() == X.end());
+            ASSERT(&defaultAllocator == X.get_allocator().mechanism());
+
+            const Obj Y(std::less<int>(), &oa);
+            ASSERT(&oa == Y.get_allocator().mechanism());
+            ASSERT(&oa == Y.keys().get_allocator().mechanism());
+            ASSERT(&oa == Y.values().get_allocator().mechanism());
+
+            const Obj Z(&oa);
+            ASSERT(&oa == Z.get_allocator().mechanism());
+            ASSERT(0 == oa.numBlocksTotal());
+        }
+
+        if (verbose) printf("\tSingle-pair insertion.\n");
+        {
+            static const struct {
+                int  d_line;
+                int  d_key;
+                int  d_index;    // expected position after insertion
+                bool d_isNew;    // expected result of insertion
+            } DATA[] = {
+                //LINE KEY INDEX  NEW
+                //---- --- -----  -----
+                { L_,   5,    0,  true  },
+                { L_,   5,    0,  false },
+                { L_,   9,    1,  true  },
+                { L_,   1,    0,  true  },
+                { L_,   7,    2,  true  },
+                { L_,   9,    3,  false },
+                { L_,   0,    0,  true  },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int hinted = 0; hinted < 3; ++hinted) {
+                Obj    mX(&oa);  const Obj& X = mX;
+                Oracle oracle;
+
+                for (int ti = 0; ti < NUM_DATA; ++ti) {
+                    const int  LINE   = DATA[ti].d_line;
+                    const int  KEY    = DATA[ti].d_key;
+                    const int  INDEX  = DATA[ti].d_index;
+                    const bool IS_NEW = DATA[ti].d_isNew;
+                    const Pair PAIR(KEY, ti);
+
+                    const Obj::size_type SIZE = X.size();
+
+                    Obj::iterator it;
+                    if (0 == hinted) {
+                        bsl::pair<Obj::iterator, bool> result =
+                                                              mX.insert(PAIR);
+                        ASSERTV(LINE, IS_NEW == result.second);
+                        it = result.first;
+                    }
+                    else if (1 == hinted) {
+                        it = mX.insert(X.lower_bound(KEY), PAIR);
+                    }
+                    else {
+                        it = mX.insert(X.end(), PAIR);
+                    }
+                    oracle.insert(PAIR);
+
+                    ASSERTV(LINE, KEY == it->first);
+                    ASSERTV(LINE, INDEX == it - mX.begin());
+                    ASSERTV(LINE, SIZE + IS_NEW == X.size());
+                    ASSERTV(LINE, matches(X, oracle));
+                }
+
+                mX.clear();
+                ASSERT(X.empty());
+                ASSERT(X.keys().empty());
+                ASSERT(X.values().empty());
+            }
+        }
+
+        if (verbose) printf("\tInsertion by move.\n");
+        {
+            SObj mX(&oa);  const SObj& X = mX;
+
+            bsl::pair<int, bsl::string> p(1, bsl::string(40, 'a'), &oa);
+            bsl::pair<int, bsl::string> q(2, bsl::string(40, 'b'), &oa);
+            mX[0] = "zero";
+            mX[3] = "three";
+
+            bslma::TestAllocatorMonitor oam(&oa);
+            mX.insert(MoveUtil::move(p));
+            mX.insert(X.end(), MoveUtil::move(q));
+            ASSERT(4 == X.size());
+            ASSERT(bsl::string(40, 'a') == X.at(1));
+            ASSERT(bsl::string(40, 'b') == X.at(2));
+            ASSERT(oam.isInUseSame());
+        }
+
+        if (verbose) printf("\t`operator[]` and `at`.\n");
+        {
+            SObj mX(&oa);  const SObj& X = mX;
+
+            ASSERT(mX[5].empty());
+            ASSERT(1 == X.size());
+
+            mX[5] = "five";
+            mX[2] = "two";
+            ASSERT("five" == X.at(5));
+            ASSERT("two"  == mX.at(2));
+            ASSERT(2 == X.size());
+
+            int key = 7;
+            mX[MoveUtil::move(key)] = "seven";
+            ASSERT("seven" == X.at(7));
+            ASSERT(isValid(X, true));
+
+            mX.at(7) = "SEVEN";
+            ASSERT("SEVEN" == X.at(7));
+
+#if defined(BDE_BUILD_TARGET_EXC)
+            bool caught = false;
+            try {
+                X.at(3);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            caught = false;
+            try {
+                mX.at(3);
+            }
+            catch (const std::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+            ASSERT(3 == X.size());
+#endif
+        }
+
+        if (verbose) printf("\tIterators.\n");
+        {
+            Obj mX(&oa);  const Obj& X = mX;
+            for (int i = 0; i < 5; ++i) {
+                mX[i * 2] = i;
+            }
+
+            ASSERT((bsl::is_same<Obj::iterator::reference,
+                                 bsl::pair<const int&, int&> >::value));
+
+            Obj::iterator       it  = mX.begin();
+            Obj::const_iterator cit = it;
+            ASSERT(cit == X.begin());
+            ASSERT(it  == X.begin());
+
+            ASSERT(0 == (*it).first);
+            ASSERT(0 == it->second);
+            ASSERT(&X.keys()[1]   == &it[1].first);
+            ASSERT(&X.values()[1] == &it[1].second);
+
+            it->second = 10;
+            (*it).second += 1;
+            ASSERT(11 == X.at(0));
+
+            ASSERT(X.end() - X.begin() == 5);
+            ASSERT(mX.begin() + 5 == mX.end());
+            ASSERT(5 + mX.begin() == mX.end());
+            ASSERT(mX.end() - 5 == mX.begin());
+            ASSERT(mX.begin() < mX.end());
+            ASSERT(mX.begin() <= mX.begin());
+            ASSERT(mX.end() > cit);
+            ASSERT(mX.end() >= mX.end());
+
+            ++it;
+            ASSERT(2 == it->first);
+            it++;
+            ASSERT(4 == it->first);
+            it += 2;
+            ASSERT(8 == it->first);
+            --it;
+            it--;
+            ASSERT(4 == it->first);
+            it -= 2;
+            ASSERT(mX.begin() == it);
+
+            Obj::reverse_iterator rit = mX.rbegin();
+            ASSERT(8 == rit->first);
+            rit->second = 40;
+            ASSERT(40 == X.at(8));
+            ASSERT(5 == mX.rend() - mX.rbegin());
+
+            Obj::const_reverse_iterator crit = X.rbegin();
+            ASSERT(8 == (*crit).first);
+            ASSERT(X.crend() - X.crbegin() == 5);
+
+            int expected = 0;
+            for (cit = X.begin(); cit != X.end(); ++cit, expected += 2) {
+                ASSERTV(expected, expected == cit->first);
+            }
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        // 1. The classes are sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Insert, find, and erase a few pairs, and create maps in bulk.
+        //    (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        ASSERT((bslalg::HasStlIterators<Obj>::value));
+        ASSERT((bslma::UsesBslmaAllocator<Obj>::value));
+        ASSERT((bslalg::HasStlIterators<MObj>::value));
+        ASSERT((bslma::UsesBslmaAllocator<MObj>::value));
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        ASSERT(mX.insert(Pair(3, 30)).second);
+        ASSERT(mX.insert(Pair(1, 10)).second);
+        ASSERT(!mX.insert(Pair(3, 31)).second);
+        ASSERT(2 == X.size());
+        ASSERT(1 == X.begin()->first);
+        ASSERT(30 == X.at(3));
+        ASSERT(1 == mX.erase(3));
+        ASSERT(!X.contains(3));
+
+        const Pair PAIRS[] = {
+            Pair(4, 0), Pair(2, 1), Pair(4, 2), Pair(8, 3)
+        };
+        mX.insert(PAIRS, PAIRS + 4);
+        ASSERT(4 == X.size());
+        ASSERT(0 == X.at(4));
+
+        MObj mY(PAIRS, PAIRS + 4, &oa);  const MObj& Y = mY;
+        ASSERT(4 == Y.size());
+        ASSERT(2 == Y.count(4));
+        ASSERT(0 == Y.find(4)->second);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: `flat_map` VS. `map`
+        //
+        // Concerns:
+        // 1. Compare the time taken by `flat_map` and `map` to build a map in
+        //    bulk from unsorted pairs, to insert a batch of pairs into a
+        //    large map, to look up keys, and to iterate over all pairs.
+        //
+        // Plan:
+        // 1. Time each operation for several sizes, with pseudo-random `int`
+        //    keys.  The optional second argument, if positive, scales the
+        //    number of lookups.
+        //
+        // Testing:
+        //   PERFORMANCE: `flat_map` VS. `map`
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: `flat_map` VS. `map`"
+                            "\n=================================\n");
+
+        const int scale = argc > 2 && atoi(argv[2]) > 0 ? atoi(argv[2]) : 1;
+
+        static const int SIZES[] = { 100, 10000, 1000000 };
+        const int        NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        printf("%9s %-8s %12s %12s %12s %12s  (ns/pair)\n",
+               "size", "map", "build", "batch", "find", "iterate");
+
+        unsigned int state = 12345;
+        long         sink  = 0;
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const int SIZE    = SIZES[si];
+            const int BATCH   = SIZE / 10 + 1;
+            const int LOOKUPS = scale * 1000000;
+
+            PairVector pairs, batch;
+            IntVector  probes;
+            for (int i = 0; i < SIZE; ++i) {
+                pairs.push_back(Pair(static_cast<int>(nextRandom(&state)), i));
+            }
+            for (int i = 0; i < BATCH; ++i) {
+                batch.push_back(Pair(static_cast<int>(nextRandom(&state)), i));
+            }
+            for (int i = 0; i < LOOKUPS; ++i) {
+                probes.push_back(0 == i % 2
+                                 ? pairs[nextRandom(&state) % SIZE].first
+                                 : static_cast<int>(nextRandom(&state)));
+            }
+
+            bsls::Stopwatch timer;
+            double          flatTimes[4];
+            double          treeTimes[4];
+
+            {
+                timer.reset();
+                timer.start();
+                Obj mX(pairs.begin(), pairs.end());
+                timer.stop();
+                flatTimes[0] = timer.elapsedTime() * 1.0e9 / SIZE;
+
+                timer.reset();
+                timer.start();
+                mX.insert(batch.begin(), batch.end());
+                timer.stop();
+                flatTimes[1] = timer.elapsedTime() * 1.0e9 / BATCH;
+
+                timer.reset();
+                timer.start();
+                for (int i = 0; i < LOOKUPS; ++i) {
+                    Obj::const_iterator it = mX.find(probes[i]);
+                    sink += it == mX.end() ? 0 : it->second;
+                }
+                timer.stop();
+                flatTimes[2] = timer.elapsedTime() * 1.0e9 / LOOKUPS;
+
+                timer.reset();
+                timer.start();
+                for (Obj::const_iterator it = mX.begin();
+                     it != mX.end();
+                     ++it) {
+                    sink += it->second;
+                }
+                timer.stop();
+                flatTimes[3] = timer.elapsedTime() * 1.0e9 / mX.size();
+            }
+            {
+                timer.reset();
+                timer.start();
+                Oracle mX(pairs.begin(), pairs.end());
+                timer.stop();
+                treeTimes[0] = timer.elapsedTime() * 1.0e9 / SIZE;
+
+                timer.reset();
+                timer.start();
+                mX.insert(batch.begin(), batch.end());
+                timer.stop();
+                treeTimes[1] = timer.elapsedTime() * 1.0e9 / BATCH;
+
+                timer.reset();
+                timer.start();
+                for (int i = 0; i < LOOKUPS; ++i) {
+                    Oracle::const_iterator it = mX.find(probes[i]);
+                    sink += it == mX.end() ? 0 : it->second;
+                }
+                timer.stop();
+                treeTimes[2] = timer.elapsedTime() * 1.0e9 / LOOKUPS;
+
+                timer.reset();
+                timer.start();
+                for (Oracle::const_iterator it = mX.begin();
+                     it != mX.end();
+                     ++it) {
+                    sink += it->second;
+                }
+                timer.stop();
+                treeTimes[3] = timer.elapsedTime() * 1.0e9 / mX.size();
+            }
+
+            printf("%9d %-8s %12.1f %12.1f %12.1f %12.2f\n",
+                   SIZE,
+                   "flat",
+                   flatTimes[0],
+                   flatTimes[1],
+                   flatTimes[2],
+                   flatTimes[3]);
+            printf("%9s %-8s %12.1f %12.1f %12.1f %12.2f\n",
+                   "",
+                   "tree",
+                   treeTimes[0],
+                   treeTimes[1],
+                   treeTimes[2],
+                   treeTimes[3]);
+        }
+
+        if (veryVerbose) {
+            P(sink);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
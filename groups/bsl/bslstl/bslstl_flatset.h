@@ -0,0 +1,1535 @@
+// bslstl_flatset.h                                                   -*-C++-*-
+#ifndef INCLUDED_BSLSTL_FLATSET
+#define INCLUDED_BSLSTL_FLATSET
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an ordered set held in a contiguous sorted vector.
+//
+//@CLASSES:
+//  bsl::flat_set: ordered set of unique keys stored in a sorted `bsl::vector`
+//
+//@CANONICAL_HEADER: bsl_flat_set.h
+//
+//@SEE_ALSO: bslstl_flatmap, bslstl_sortedtags, bslstl_set
+//
+//@DESCRIPTION: This component defines a single class template,
+// `bsl::flat_set`, implementing the C++23 standard container adaptor that
+// holds an ordered sequence of unique keys (of the template parameter type,
+// `KEY`) in a contiguous, sorted `bsl::vector`.
+//
+// A `flat_set` offers the interface of an ordered associative container, but
+// trades the node-based representation of `bsl::set` for a single sorted
+// array: lookup is a binary search over contiguous memory, iteration walks a
+// vector, and the container allocates one block rather than one node per
+// key.  In exchange, inserting or erasing a single key is linear in the size
+// of the set (the keys after the insertion point are shifted), and every
+// modification of the set invalidates all iterators and references to its
+// keys.  A `flat_set` is therefore best suited for sets that are built once
+// (or in bulk) and then searched many times.
+//
+// An instantiation of `flat_set` is an allocator-aware, value-semantic type
+// whose salient attributes are its size (number of keys) and the ordered
+// sequence of keys the set contains.  If `flat_set` is instantiated with a
+// key type that is not itself value-semantic, then it will not retain all of
+// its value-semantic qualities.
+//
+///Bulk Insertion
+///--------------
+// Inserting a range of `N` keys into a set of `M` keys does not insert the
+// keys one at a time (which would cost `O[N * (M + N)]`).  Instead the range
+// is appended to the underlying vector, the appended keys are sorted, and the
+// two sorted runs are merged in a single pass, for a total of
+// `O[N * log(N) + M]` operations.  If the caller passes `bsl::sorted_unique`
+// to indicate that the range is already sorted and free of duplicates, the
+// sort is skipped and the operation is linear.  When every appended key is
+// greater than the largest key already in the set, the merge is skipped as
+// well, so building a set from sorted input is proportional to the length of
+// that input.
+//
+///Memory Allocation
+///-----------------
+// The type supplied as the `ALLOCATOR` template parameter determines how the
+// underlying vector allocates memory.  If `ALLOCATOR` is `bsl::allocator`
+// (the default), a `flat_set` accepts an optional `bslma::Allocator *` at
+// construction, which is used to supply memory for the set throughout its
+// lifetime, and which is passed to the constructors of contained keys having
+// the `bslma::UsesBslmaAllocator` trait; otherwise the currently installed
+// default allocator is used.
+//
+///Interface Differences with the C++ Standard
+///-------------------------------------------
+// `std::flat_set` is parameterized by the type of its underlying container.
+// `bsl::flat_set` instead always uses `bsl::vector<KEY, ALLOCATOR>`, and
+// takes the allocator type as its last template parameter, consistent with
+// the other `bsl` containers.  The `extract` method and the heterogeneous
+// (transparent-comparator) lookup overloads are not provided; instead, `keys`
+// gives read access to the sorted vector, and `replace` replaces it.
+//
+///Usage
+///-----
+// In this section we show intended use of this component.
+//
+///Example 1: Building a Lookup Table in Bulk
+/// - - - - - - - - - - - - - - - - - - - - -
+// Suppose we need a set of the reserved words of a small language, which is
+// built once at startup and then queried for each identifier that is parsed.
+//
+// First, we collect the words in a vector, in whatever order they happen to
+// be listed:
+// ```
+// bslma::TestAllocator ta;
+//
+// bsl::vector<bsl::string> words(&ta);
+// words.push_back("while");
+// words.push_back("if");
+// words.push_back("else");
+// words.push_back("return");
+// words.push_back("if");
+// ```
+// Then, we create a `flat_set` from the vector.  The keys are sorted and the
+// duplicate `"if"` is removed, all in one pass over the vector:
+// ```
+// bsl::flat_set<bsl::string> reserved(words.begin(), words.end(), &ta);
+//
+// assert(4 == reserved.size());
+// assert("else" == *reserved.begin());
+// ```
+// Now, we can look up identifiers with a binary search over contiguous
+// memory:
+// ```
+// assert( reserved.contains("return"));
+// assert(!reserved.contains("x"));
+// ```
+// Finally, we add more keys that we know to be sorted and unique, so that
+// the set can skip sorting them:
+// ```
+// const char *more[] = { "yield", "zip" };
+// reserved.insert(bsl::sorted_unique, more, more + 2);
+// assert(6 == reserved.size());
+// ```
+
+#include <bslscm_version.h>
+
+#include <bslstl_iterator.h>
+#include <bslstl_pair.h>
+#include <bslstl_sortedtags.h>
+#include <bslstl_vector.h>
+
+#include <bslalg_rangecompare.h>
+#include <bslalg_typetraithasstliterators.h>
+
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_isconvertible.h>
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+# include <initializer_list>
+#endif
+
+namespace BloombergLP {
+namespace bslstl {
+
+                         // ==========================
+                         // class FlatSet_RangeProctor
+                         // ==========================
+
+/// This component-private class template provides a proctor that, unless
+/// its `release` method is called, erases on destruction the elements of a
+/// vector (of the template parameter type `CONTAINER`) at and after a
+/// specified position.  It is used to roll a `flat_set` back to its keys
+/// before a bulk insertion if that insertion throws.
+template <class CONTAINER>
+class FlatSet_RangeProctor {
+
+    // DATA
+    CONTAINER   *d_container_p;  // managed container (held, not owned)
+    std::size_t  d_position;     // first element erased on rollback
+
+  private:
+    // NOT IMPLEMENTED
+    FlatSet_RangeProctor(const FlatSet_RangeProctor&);
+    FlatSet_RangeProctor& operator=(const FlatSet_RangeProctor&);
+
+  public:
+    // CREATORS
+
+    /// Create a proctor managing the elements of the specified `container`
+    /// at and after the specified `position`.
+    FlatSet_RangeProctor(CONTAINER *container, std::size_t position);
+
+    /// Erase the managed elements unless `release` has been called.
+    ~FlatSet_RangeProctor();
+
+    // MANIPULATORS
+
+    /// Release from management the elements of the managed container.
+    void release();
+
+    /// Manage the elements of the managed container at and after the
+    /// specified `position` instead of those previously managed.
+    void reset(std::size_t position);
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                               // ==============
+                               // class flat_set
+                               // ==============
+
+/// This class template implements a value-semantic container type holding an
+/// ordered sequence of unique keys (of the template parameter type `KEY`) in
+/// a sorted `bsl::vector`.  The keys are ordered by a comparator of the
+/// template parameter type `COMPARATOR`, and memory is supplied by an
+/// allocator of the template parameter type `ALLOCATOR`.
+template <class KEY,
+          class COMPARATOR = std::less<KEY>,
+          class ALLOCATOR  = allocator<KEY> >
+class flat_set {
+
+    // PRIVATE TYPES
+
+    /// This typedef is a convenient alias for the utility associated with
+    /// movable references.
+    typedef BloombergLP::bslmf::MovableRefUtil               MoveUtil;
+
+  public:
+    // PUBLIC TYPES
+    typedef KEY                                              key_type;
+    typedef KEY                                              value_type;
+    typedef COMPARATOR                                       key_compare;
+    typedef COMPARATOR                                       value_compare;
+    typedef ALLOCATOR                                        allocator_type;
+    typedef value_type&                                      reference;
+    typedef const value_type&                                const_reference;
+    typedef vector<KEY, ALLOCATOR>                           container_type;
+
+    typedef typename container_type::size_type               size_type;
+    typedef typename container_type::difference_type         difference_type;
+    typedef typename container_type::pointer                 pointer;
+    typedef typename container_type::const_pointer           const_pointer;
+    typedef typename container_type::const_iterator          iterator;
+    typedef typename container_type::const_iterator          const_iterator;
+    typedef typename container_type::const_reverse_iterator  reverse_iterator;
+    typedef typename container_type::const_reverse_iterator
+                                                       const_reverse_iterator;
+
+  private:
+    // DATA
+    container_type d_keys;     // sorted, duplicate-free keys
+    COMPARATOR     d_compare;  // ordering of `d_keys`
+
+    // PRIVATE MANIPULATORS
+
+    /// Bring the keys at and after the specified `position` into the sorted
+    /// sequence of the keys before it, dropping any key equivalent to a key
+    /// that precedes it.  If the specified `isSorted` is `true`, the keys at
+    /// and after `position` are already sorted.  If the optionally specified
+    /// `proctor` is not 0, it is reset to manage the whole vector before any
+    /// key before `position` is moved.  The behavior is undefined unless the
+    /// keys before `position` are sorted and unique.
+    void mergeTail(
+        size_type                                                 position,
+        bool                                                      isSorted,
+        BloombergLP::bslstl::FlatSet_RangeProctor<container_type> *proctor =
+                                                                           0);
+
+    // PRIVATE ACCESSORS
+
+    /// Return `true` if the specified `value` can be inserted at the
+    /// specified `position` without breaking the ordering of this set, and
+    /// `false` otherwise.
+    bool isInsertionPoint(const_iterator position, const KEY& value) const;
+
+    // FRIENDS
+    template <class KEY2, class COMPARATOR2, class ALLOCATOR2, class PREDICATE>
+    friend typename flat_set<KEY2, COMPARATOR2, ALLOCATOR2>::size_type
+    erase_if(flat_set<KEY2, COMPARATOR2, ALLOCATOR2>& s, PREDICATE predicate);
+
+  public:
+    // CREATORS
+
+    /// Create an empty set.  Optionally specify a `comparator` used to
+    /// order keys in the set.  If `comparator` is not supplied, a
+    /// default-constructed object of the (template parameter) type
+    /// `COMPARATOR` is used.  Optionally specify a `basicAllocator` used to
+    /// supply memory.  If `basicAllocator` is not supplied, a
+    /// default-constructed object of the (template parameter) type
+    /// `ALLOCATOR` is used.  If `ALLOCATOR` is `bsl::allocator` (the
+    /// default), then `basicAllocator`, if supplied, shall be convertible to
+    /// `bslma::Allocator *`.  If `ALLOCATOR` is `bsl::allocator` and
+    /// `basicAllocator` is not supplied, the currently installed default
+    /// allocator is used.
+    flat_set();
+    explicit flat_set(const COMPARATOR& comparator,
+                      const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    explicit flat_set(const ALLOCATOR& basicAllocator);
+
+    /// Create a set holding the keys of the specified `keys` vector, sorted,
+    /// and with duplicates removed.  Optionally specify a `comparator` used
+    /// to order keys in the set.  Optionally specify a `basicAllocator` used
+    /// to supply memory; otherwise the default allocator is used.  This
+    /// operation has `O[N * log(N)]` complexity, where `N` is `keys.size()`.
+    explicit flat_set(const container_type& keys,
+                      const COMPARATOR&     comparator = COMPARATOR(),
+                      const ALLOCATOR&      basicAllocator = ALLOCATOR());
+
+    /// Create a set holding the keys of the specified `keys` vector, sorted,
+    /// and with duplicates removed, by moving the vector into the set, which
+    /// adopts its allocator.  Optionally specify a `comparator` used to
+    /// order keys in the set.  `keys` is left in a valid but unspecified
+    /// state.
+    explicit flat_set(
+                   BloombergLP::bslmf::MovableRef<container_type> keys,
+                   const COMPARATOR&                              comparator =
+                                                                COMPARATOR());
+
+    /// Create a set holding the keys of the specified `keys` vector, which
+    /// are sorted and unique as indicated by the specified `sorted_unique_t`
+    /// tag.  Optionally specify a `comparator` used to order keys in the
+    /// set.  Optionally specify a `basicAllocator` used to supply memory;
+    /// otherwise the default allocator is used.  The behavior is undefined
+    /// unless `keys` is sorted with respect to `comparator` and holds no two
+    /// equivalent keys.
+    flat_set(sorted_unique_t,
+             const container_type& keys,
+             const COMPARATOR&     comparator = COMPARATOR(),
+             const ALLOCATOR&      basicAllocator = ALLOCATOR());
+
+    /// Create a set holding the keys of the specified `keys` vector, which
+    /// are sorted and unique as indicated by the specified `sorted_unique_t`
+    /// tag, by moving the vector into the set, which adopts its allocator.
+    /// Optionally specify a `comparator` used to order keys in the set.
+    /// `keys` is left in a valid but unspecified state.  The behavior is
+    /// undefined unless `keys` is sorted with respect to `comparator` and
+    /// holds no two equivalent keys.
+    flat_set(sorted_unique_t,
+             BloombergLP::bslmf::MovableRef<container_type> keys,
+             const COMPARATOR&                              comparator =
+                                                                COMPARATOR());
+
+    /// Create a set, and insert one of each group of equivalent keys in the
+    /// range starting at the specified `first` iterator and ending
+    /// immediately before the specified `last` iterator (it is unspecified
+    /// which).  Optionally specify a `comparator` used to order keys in the
+    /// set.  Optionally specify a `basicAllocator` used to supply
+    /// memory; otherwise the default allocator is used.  This operation has
+    /// `O[N * log(N)]` complexity, where `N` is the length of the range.
+    /// The (template parameter) type `INPUT_ITERATOR` shall meet the
+    /// requirements of an input iterator defined in the C++11 standard
+    /// [24.2.3] providing access to values of a type convertible to
+    /// `value_type`.  The behavior is undefined unless `first` and `last`
+    /// refer to a sequence of valid values where `first` is at a position at
+    /// or before `last`.
+    template <class INPUT_ITERATOR>
+    flat_set(INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const COMPARATOR& comparator = COMPARATOR(),
+             const ALLOCATOR&  basicAllocator = ALLOCATOR());
+    template <class INPUT_ITERATOR>
+    flat_set(INPUT_ITERATOR   first,
+             INPUT_ITERATOR   last,
+             const ALLOCATOR& basicAllocator);
+
+    /// Create a set holding the keys in the range starting at the specified
+    /// `first` iterator and ending immediately before the specified `last`
+    /// iterator, which are sorted and unique as indicated by the specified
+    /// `sorted_unique_t` tag.  Optionally specify a `comparator` used to
+    /// order keys in the set.  Optionally specify a `basicAllocator` used to
+    /// supply memory; otherwise the default allocator is used.  This
+    /// operation has `O[N]` complexity, where `N` is the length of the
+    /// range.  The behavior is undefined unless the range is sorted with
+    /// respect to `comparator` and holds no two equivalent keys.
+    template <class INPUT_ITERATOR>
+    flat_set(sorted_unique_t,
+             INPUT_ITERATOR    first,
+             INPUT_ITERATOR    last,
+             const COMPARATOR& comparator = COMPARATOR(),
+             const ALLOCATOR&  basicAllocator = ALLOCATOR());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    /// Create a set, and insert one of each group of equivalent keys in the
+    /// specified `values` initializer list (it is unspecified which).
+    /// Optionally specify a `comparator` used to order keys in the set.
+    /// Optionally specify a `basicAllocator` used to supply memory;
+    /// otherwise the default allocator is used.
+    flat_set(std::initializer_list<KEY> values,
+             const COMPARATOR&          comparator = COMPARATOR(),
+             const ALLOCATOR&           basicAllocator = ALLOCATOR());
+    flat_set(std::initializer_list<KEY> values,
+             const ALLOCATOR&           basicAllocator);
+
+    /// Create a set holding the keys in the specified `values` initializer
+    /// list, which are sorted and unique as indicated by the specified
+    /// `sorted_unique_t` tag.  Optionally specify a `comparator` used to
+    /// order keys in the set.  Optionally specify a `basicAllocator` used to
+    /// supply memory; otherwise the default allocator is used.  The behavior
+    /// is undefined unless `values` is sorted with respect to `comparator`
+    /// and holds no two equivalent keys.
+    flat_set(sorted_unique_t,
+             std::initializer_list<KEY> values,
+             const COMPARATOR&          comparator = COMPARATOR(),
+             const ALLOCATOR&           basicAllocator = ALLOCATOR());
+#endif
+
+    /// Create a set having the same value as the specified `original`
+    /// object.  Use a copy of `original.key_comp()` to order the keys in
+    /// this set.  Optionally specify a `basicAllocator` used to supply
+    /// memory; otherwise the default allocator is used.
+    flat_set(const flat_set& original);
+    flat_set(const flat_set& original, const ALLOCATOR& basicAllocator);
+
+    /// Create a set having the same value as the specified `original`
+    /// object by moving (in constant time) the contents of `original` to the
+    /// new set.  Use a copy of `original.key_comp()` to order the keys in
+    /// this set.  The allocator associated with `original` is propagated for
+    /// use in the newly-created set.  `original` is left in a valid but
+    /// unspecified state.
+    flat_set(BloombergLP::bslmf::MovableRef<flat_set> original);  // IMPLICIT
+
+    /// Create a set having the same value as the specified `original` object
+    /// that uses the specified `basicAllocator` to supply memory.  The keys
+    /// of `original` are moved (in constant time) if
+    /// `basicAllocator == original.get_allocator()`, and are move-inserted
+    /// (in linear time) otherwise.  `original` is left in a valid but
+    /// unspecified state.
+    flat_set(BloombergLP::bslmf::MovableRef<flat_set> original,
+             const ALLOCATOR&                         basicAllocator);
+
+    // MANIPULATORS
+
+    /// Assign to this object the value and comparator of the specified `rhs`
+    /// object, and return a reference providing modifiable access to this
+    /// object.
+    flat_set& operator=(const flat_set& rhs);
+
+    /// Assign to this object the value and comparator of the specified `rhs`
+    /// object, and return a reference providing modifiable access to this
+    /// object.  The keys of `rhs` are moved (in constant time) if the
+    /// allocators of the two sets are equal, and are move-inserted (in
+    /// linear time) otherwise.  `rhs` is left in a valid but unspecified
+    /// state.
+    flat_set& operator=(BloombergLP::bslmf::MovableRef<flat_set> rhs);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    /// Assign to this object the value resulting from first clearing this
+    /// set and then inserting one of each group of equivalent keys in the
+    /// specified `values` initializer list (it is unspecified which), and
+    /// return a reference providing modifiable access to this object.
+    flat_set& operator=(std::initializer_list<KEY> values);
+#endif
+
+    /// Insert the specified `value` into this set if a key equivalent to
+    /// `value` does not already exist in this set; otherwise, this method
+    /// has no effect.  Return a pair whose `first` member is an iterator
+    /// referring to the (possibly newly inserted) key in this set that is
+    /// equivalent to `value`, and whose `second` member is `true` if a new
+    /// key was inserted, and `false` if the key was already present.  This
+    /// operation has `O[N]` complexity, where `N` is the size of this set.
+    /// If `value` is inserted, all iterators to this set are invalidated.
+    pair<iterator, bool> insert(const value_type& value);
+
+    /// Insert the specified `value` into this set if a key equivalent to
+    /// `value` does not already exist in this set; otherwise, this method
+    /// has no effect.  `value` is left in a valid but unspecified state if
+    /// it is inserted.  Return a pair whose `first` member is an iterator
+    /// referring to the (possibly newly inserted) key in this set that is
+    /// equivalent to `value`, and whose `second` member is `true` if a new
+    /// key was inserted, and `false` if the key was already present.
+    pair<iterator, bool> insert(
+                             BloombergLP::bslmf::MovableRef<value_type> value);
+
+    /// Insert the specified `value` into this set (in amortized constant
+    /// time if the specified `hint` is the position at which `value` belongs)
+    /// if a key equivalent to `value` does not already exist in this set;
+    /// otherwise, this method has no effect.  Return an iterator referring
+    /// to the (possibly newly inserted) key in this set that is equivalent to
+    /// `value`.  The behavior is undefined unless `hint` is an iterator in
+    /// the range `[begin() .. end()]` (both endpoints included).
+    iterator insert(const_iterator hint, const value_type& value);
+    iterator insert(const_iterator                             hint,
+                    BloombergLP::bslmf::MovableRef<value_type> value);
+
+    /// Insert into this set the keys in the range starting at the specified
+    /// `first` iterator and ending immediately before the specified `last`
+    /// iterator, ignoring each key equivalent to a key already in this set.
+    /// If the range holds equivalent keys, it is unspecified which of them
+    /// is inserted.  The keys are appended and then merged with the keys of
+    /// this set in one pass, for `O[N * log(N) + M]` complexity, where `N`
+    /// is the length of the range and `M` the size of this set.  If an
+    /// exception is thrown, this set is left with its original value unless
+    /// the move constructor of `KEY` throws, in which case the set is left
+    /// empty.  The behavior is undefined unless `first` and `last` refer to
+    /// a sequence of valid values where `first` is at a position at or
+    /// before `last`.
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+
+    /// Insert into this set the keys in the range starting at the specified
+    /// `first` iterator and ending immediately before the specified `last`
+    /// iterator, which are sorted and unique as indicated by the specified
+    /// `sorted_unique_t` tag, ignoring each key equivalent to a key already
+    /// in this set.  This operation has `O[N + M]` complexity, where `N` is
+    /// the length of the range and `M` the size of this set, and `O[N]`
+    /// complexity if every key in the range is greater than every key in
+    /// this set.  The behavior is undefined unless the range is sorted with
+    /// respect to `key_comp()` and holds no two equivalent keys.
+    template <class INPUT_ITERATOR>
+    void insert(sorted_unique_t, INPUT_ITERATOR first, INPUT_ITERATOR last);
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+    /// Insert into this set the keys in the specified `values` initializer
+    /// list, ignoring each key equivalent to a key already in this set.  If
+    /// the list holds equivalent keys, it is unspecified which of them is
+    /// inserted.
+    void insert(std::initializer_list<KEY> values);
+
+    /// Insert into this set the keys in the specified `values` initializer
+    /// list, which are sorted and unique as indicated by the specified
+    /// `sorted_unique_t` tag, ignoring each key equivalent to a key already
+    /// in this set.  The behavior is undefined unless `values` is sorted
+    /// with respect to `key_comp()` and holds no two equivalent keys.
+    void insert(sorted_unique_t, std::initializer_list<KEY> values);
+#endif
+
+    /// Remove from this set the key at the specified `position`, and return
+    /// an iterator referring to the key immediately following the removed
+    /// key, or to the past-the-end position if the removed key was the last
+    /// in the sequence.  The behavior is undefined unless `position` refers
+    /// to a key in this set.
+    iterator erase(const_iterator position);
+
+    /// Remove from this set the key equivalent to the specified `key`, if
+    /// such a key exists, and return the number of keys removed (0 or 1).
+    size_type erase(const key_type& key);
+
+    /// Remove from this set the keys starting at the specified `first`
+    /// position up to, but not including, the specified `last` position, and
+    /// return `last`.  The behavior is undefined unless `first` and `last`
+    /// either refer to keys in this set or are the `end` iterator, and the
+    /// `first` position is at or before the `last` position in the ordered
+    /// sequence provided by this container.
+    iterator erase(const_iterator first, const_iterator last);
+
+    /// Replace the keys of this set by moving the specified `keys` vector
+    /// into this set.  The behavior is undefined unless `keys` is sorted
+    /// with respect to `key_comp()` and holds no two equivalent keys.
+    void replace(BloombergLP::bslmf::MovableRef<container_type> keys);
+
+    /// Exchange the value and comparator of this object with those of the
+    /// specified `other` object.  This method provides the no-throw
+    /// exception-safety guarantee.  The behavior is undefined unless this
+    /// object was created with the same allocator as `other`.
+    void swap(flat_set& other) BSLS_KEYWORD_NOEXCEPT;
+
+    /// Remove all keys from this set, retaining the capacity of the
+    /// underlying vector.
+    void clear() BSLS_KEYWORD_NOEXCEPT;
+
+    // ACCESSORS
+
+    /// Return an iterator providing non-modifiable access to the first key
+    /// in the ordered sequence of keys held by this set, or the `end`
+    /// iterator if this set is empty.
+    const_iterator begin() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cbegin() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return an iterator providing non-modifiable access to the
+    /// past-the-end position in the ordered sequence of keys held by this
+    /// set.
+    const_iterator end() const BSLS_KEYWORD_NOEXCEPT;
+    const_iterator cend() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return a reverse iterator providing non-modifiable access to the last
+    /// key in the ordered sequence of keys held by this set, or `rend` if
+    /// this set is empty.
+    const_reverse_iterator rbegin() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crbegin() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return a reverse iterator providing non-modifiable access to the
+    /// prior-to-the-beginning position in the ordered sequence of keys held
+    /// by this set.
+    const_reverse_iterator rend() const BSLS_KEYWORD_NOEXCEPT;
+    const_reverse_iterator crend() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return `true` if this set contains no keys, and `false` otherwise.
+    bool empty() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return the number of keys in this set.
+    size_type size() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return a theoretical upper bound on the largest number of keys that
+    /// this set could possibly hold.
+    size_type max_size() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return (a copy of) the allocator used for memory allocation by this
+    /// set.
+    allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Return the key-comparison functor (or function pointer) used by this
+    /// set.
+    key_compare key_comp() const;
+
+    /// Return the value-comparison functor (or function pointer) used by
+    /// this set; for a `flat_set` this is the key comparator.
+    value_compare value_comp() const;
+
+    /// Return an iterator to the key in this set equivalent to the specified
+    /// `key`, if such a key exists, and `end()` otherwise.  This operation
+    /// has `O[log(N)]` complexity, where `N` is the size of this set.
+    const_iterator find(const key_type& key) const;
+
+    /// Return the number of keys in this set equivalent to the specified
+    /// `key` (0 or 1).
+    size_type count(const key_type& key) const;
+
+    /// Return `true` if this set contains a key equivalent to the specified
+    /// `key`, and `false` otherwise.
+    bool contains(const key_type& key) const;
+
+    /// Return an iterator to the first key in this set that is not less
+    /// than the specified `key`, or `end()` if there is no such key.
+    const_iterator lower_bound(const key_type& key) const;
+
+    /// Return an iterator to the first key in this set that is greater than
+    /// the specified `key`, or `end()` if there is no such key.
+    const_iterator upper_bound(const key_type& key) const;
+
+    /// Return a pair of iterators delimiting the (possibly empty) range of
+    /// keys in this set equivalent to the specified `key`.
+    pair<const_iterator, const_iterator> equal_range(
+                                                  const key_type& key) const;
+
+    /// Return a reference providing non-modifiable access to the sorted
+    /// vector of keys held by this set.
+    const container_type& keys() const BSLS_KEYWORD_NOEXCEPT;
+};
+
+// FREE OPERATORS
+
+/// Return `true` if the specified `lhs` and `rhs` objects have the same
+/// value, and `false` otherwise.  Two `flat_set` objects have the same value
+/// if they have the same number of keys, and each key in the ordered
+/// sequence of keys of `lhs` has the same value as the corresponding key in
+/// the ordered sequence of keys of `rhs`.
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator==(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+
+#ifndef BSLS_COMPILERFEATURES_SUPPORT_THREE_WAY_COMPARISON
+/// Return `true` if the specified `lhs` and `rhs` objects do not have the
+/// same value, and `false` otherwise.
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator!=(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+#endif
+
+/// Return `true` if the value of the specified `lhs` set is
+/// lexicographically less than that of the specified `rhs` set, and `false`
+/// otherwise.  This method requires that `operator<`, inducing a total
+/// order, be defined for `KEY`.
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+
+/// Return `true` if the value of the specified `lhs` set is
+/// lexicographically greater than that of the specified `rhs` set, and
+/// `false` otherwise.  Note that this operator returns `rhs < lhs`.
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+               const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+
+/// Return `true` if the value of the specified `lhs` set is
+/// lexicographically less than or equal to that of the specified `rhs` set,
+/// and `false` otherwise.  Note that this operator returns `!(rhs < lhs)`.
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator<=(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+
+/// Return `true` if the value of the specified `lhs` set is
+/// lexicographically greater than or equal to that of the specified `rhs`
+/// set, and `false` otherwise.  Note that this operator returns
+/// `!(lhs < rhs)`.
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+bool operator>=(const flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                const flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs);
+
+// FREE FUNCTIONS
+
+/// Erase all the keys in the specified set `s` that satisfy the specified
+/// predicate `predicate`.  Return the number of keys erased.  This operation
+/// has `O[N]` complexity, where `N` is the size of `s`.
+template <class KEY, class COMPARATOR, class ALLOCATOR, class PREDICATE>
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+erase_if(flat_set<KEY, COMPARATOR, ALLOCATOR>& s, PREDICATE predicate);
+
+/// Exchange the value and comparator of the specified `a` object with those
+/// of the specified `b` object; the allocators of `a` and `b` are not
+/// modified.  This operation has `O[1]` complexity if `a` was created with
+/// the same allocator as `b`; otherwise, it has `O[n + m]` complexity, where
+/// `n` and `m` are the number of elements in `a` and `b`, respectively, and
+/// if an exception is thrown both objects are left unchanged.  Note that
+/// this function's support for swapping objects created with different
+/// allocators is a departure from the C++ Standard.
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void swap(flat_set<KEY, COMPARATOR, ALLOCATOR>& a,
+          flat_set<KEY, COMPARATOR, ALLOCATOR>& b)
+                                    BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false);
+
+}  // close namespace bsl
+
+// ============================================================================
+//                      INLINE FUNCTION DEFINITIONS
+// ============================================================================
+
+namespace BloombergLP {
+namespace bslstl {
+
+                         // --------------------------
+                         // class FlatSet_RangeProctor
+                         // --------------------------
+
+// CREATORS
+template <class CONTAINER>
+inline
+FlatSet_RangeProctor<CONTAINER>::FlatSet_RangeProctor(CONTAINER   *container,
+                                                      std::size_t  position)
+: d_container_p(container)
+, d_position(position)
+{
+}
+
+template <class CONTAINER>
+inline
+FlatSet_RangeProctor<CONTAINER>::~FlatSet_RangeProctor()
+{
+    if (d_container_p) {
+        d_container_p->erase(d_container_p->begin() + d_position,
+                             d_container_p->end());
+    }
+}
+
+// MANIPULATORS
+template <class CONTAINER>
+inline
+void FlatSet_RangeProctor<CONTAINER>::release()
+{
+    d_container_p = 0;
+}
+
+template <class CONTAINER>
+inline
+void FlatSet_RangeProctor<CONTAINER>::reset(std::size_t position)
+{
+    d_position = position;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+namespace bsl {
+
+                               // --------------
+                               // class flat_set
+                               // --------------
+
+// PRIVATE MANIPULATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::mergeTail(
+         size_type                                                 position,
+         bool                                                      isSorted,
+         BloombergLP::bslstl::FlatSet_RangeProctor<container_type> *proctor)
+{
+    typedef typename container_type::iterator Iterator;
+
+    const size_type length = d_keys.size();
+    if (position == length) {
+        return;                                                       // RETURN
+    }
+
+    const Iterator middle = d_keys.begin() + position;
+    if (!isSorted) {
+        std::sort(middle, d_keys.end(), d_compare);
+    }
+
+    if (0 == position || d_compare(*(middle - 1), *middle)) {
+        // Every new key follows the old keys: only the duplicates among the
+        // new keys need to go.
+
+        Iterator out = middle;
+        for (Iterator it = middle + 1; it != d_keys.end(); ++it) {
+            if (d_compare(*out, *it)) {
+                ++out;
+                if (out != it) {
+                    *out = MoveUtil::move(*it);
+                }
+            }
+        }
+        d_keys.erase(out + 1, d_keys.end());
+        return;                                                       // RETURN
+    }
+
+    container_type merged(d_keys.get_allocator());
+    merged.reserve(length);
+
+    if (proctor) {
+        proctor->reset(0);
+    }
+
+    Iterator       oldIt = d_keys.begin();
+    Iterator       newIt = middle;
+    const Iterator end   = d_keys.end();
+    while (oldIt != middle || newIt != end) {
+        Iterator source;
+        if (newIt == end || (oldIt != middle && !d_compare(*newIt, *oldIt))) {
+            source = oldIt++;
+        }
+        else {
+            source = newIt++;
+        }
+        if (merged.empty() || d_compare(merged.back(), *source)) {
+            merged.push_back(MoveUtil::move(*source));
+        }
+    }
+    d_keys.swap(merged);
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_set<KEY, COMPARATOR, ALLOCATOR>::isInsertionPoint(
+                                                 const_iterator position,
+                                                 const KEY&     value) const
+{
+    return (position == d_keys.cend() || d_compare(value, *position))
+        && (position == d_keys.cbegin() || d_compare(*(position - 1), value));
+}
+
+// CREATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set()
+: d_keys()
+, d_compare()
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                          const COMPARATOR& comparator,
+                                          const ALLOCATOR&  basicAllocator)
+: d_keys(basicAllocator)
+, d_compare(comparator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                              const ALLOCATOR& basicAllocator)
+: d_keys(basicAllocator)
+, d_compare()
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                       const container_type& keys,
+                                       const COMPARATOR&     comparator,
+                                       const ALLOCATOR&      basicAllocator)
+: d_keys(keys, basicAllocator)
+, d_compare(comparator)
+{
+    mergeTail(0, false);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                   BloombergLP::bslmf::MovableRef<container_type> keys,
+                   const COMPARATOR&                              comparator)
+: d_keys(MoveUtil::move(keys))
+, d_compare(comparator)
+{
+    mergeTail(0, false);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                       sorted_unique_t,
+                                       const container_type& keys,
+                                       const COMPARATOR&     comparator,
+                                       const ALLOCATOR&      basicAllocator)
+: d_keys(keys, basicAllocator)
+, d_compare(comparator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                   sorted_unique_t,
+                   BloombergLP::bslmf::MovableRef<container_type> keys,
+                   const COMPARATOR&                              comparator)
+: d_keys(MoveUtil::move(keys))
+, d_compare(comparator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            const COMPARATOR& comparator,
+                                            const ALLOCATOR&  basicAllocator)
+: d_keys(first, last, basicAllocator)
+, d_compare(comparator)
+{
+    mergeTail(0, false);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                              INPUT_ITERATOR   first,
+                                              INPUT_ITERATOR   last,
+                                              const ALLOCATOR& basicAllocator)
+: d_keys(first, last, basicAllocator)
+, d_compare()
+{
+    mergeTail(0, false);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                            sorted_unique_t,
+                                            INPUT_ITERATOR    first,
+                                            INPUT_ITERATOR    last,
+                                            const COMPARATOR& comparator,
+                                            const ALLOCATOR&  basicAllocator)
+: d_keys(first, last, basicAllocator)
+, d_compare(comparator)
+{
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                   std::initializer_list<KEY> values,
+                                   const COMPARATOR&          comparator,
+                                   const ALLOCATOR&           basicAllocator)
+: flat_set(values.begin(), values.end(), comparator, basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                   std::initializer_list<KEY> values,
+                                   const ALLOCATOR&           basicAllocator)
+: flat_set(values.begin(), values.end(), COMPARATOR(), basicAllocator)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                   sorted_unique_t,
+                                   std::initializer_list<KEY> values,
+                                   const COMPARATOR&          comparator,
+                                   const ALLOCATOR&           basicAllocator)
+: d_keys(values.begin(), values.end(), basicAllocator)
+, d_compare(comparator)
+{
+}
+#endif
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(const flat_set& original)
+: d_keys(original.d_keys, ALLOCATOR())
+, d_compare(original.d_compare)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                                            const flat_set&  original,
+                                            const ALLOCATOR& basicAllocator)
+: d_keys(original.d_keys, basicAllocator)
+, d_compare(original.d_compare)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                           BloombergLP::bslmf::MovableRef<flat_set> original)
+: d_keys(MoveUtil::move(MoveUtil::access(original).d_keys))
+, d_compare(MoveUtil::access(original).d_compare)
+{
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>::flat_set(
+                     BloombergLP::bslmf::MovableRef<flat_set> original,
+                     const ALLOCATOR&                         basicAllocator)
+: d_keys(MoveUtil::move(MoveUtil::access(original).d_keys), basicAllocator)
+, d_compare(MoveUtil::access(original).d_compare)
+{
+}
+
+// MANIPULATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>&
+flat_set<KEY, COMPARATOR, ALLOCATOR>::operator=(const flat_set& rhs)
+{
+    if (this != &rhs) {
+        container_type keys(rhs.d_keys, d_keys.get_allocator());
+        d_compare = rhs.d_compare;
+        d_keys.swap(keys);
+    }
+    return *this;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>&
+flat_set<KEY, COMPARATOR, ALLOCATOR>::operator=(
+                                BloombergLP::bslmf::MovableRef<flat_set> rhs)
+{
+    flat_set& lvalue = rhs;
+    if (this != &lvalue) {
+        d_keys    = MoveUtil::move(lvalue.d_keys);
+        d_compare = lvalue.d_compare;
+    }
+    return *this;
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+flat_set<KEY, COMPARATOR, ALLOCATOR>&
+flat_set<KEY, COMPARATOR, ALLOCATOR>::operator=(
+                                             std::initializer_list<KEY> values)
+{
+    clear();
+    insert(values.begin(), values.end());
+    return *this;
+}
+#endif
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+pair<typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(const value_type& value)
+{
+    const_iterator position = lower_bound(value);
+    if (position != d_keys.cend() && !d_compare(value, *position)) {
+        return pair<iterator, bool>(position, false);                 // RETURN
+    }
+    return pair<iterator, bool>(d_keys.insert(position, value), true);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+pair<typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator, bool>
+flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    value_type&    lvalue   = value;
+    const_iterator position = lower_bound(lvalue);
+    if (position != d_keys.cend() && !d_compare(lvalue, *position)) {
+        return pair<iterator, bool>(position, false);                 // RETURN
+    }
+    return pair<iterator, bool>(
+                           d_keys.insert(position, MoveUtil::move(lvalue)),
+                           true);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(const_iterator    hint,
+                                             const value_type& value)
+{
+    BSLS_ASSERT_SAFE(d_keys.cbegin() <= hint && hint <= d_keys.cend());
+
+    if (isInsertionPoint(hint, value)) {
+        return d_keys.insert(hint, value);                            // RETURN
+    }
+    return insert(value).first;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(
+                              const_iterator                             hint,
+                              BloombergLP::bslmf::MovableRef<value_type> value)
+{
+    BSLS_ASSERT_SAFE(d_keys.cbegin() <= hint && hint <= d_keys.cend());
+
+    value_type& lvalue = value;
+    if (isInsertionPoint(hint, lvalue)) {
+        return d_keys.insert(hint, MoveUtil::move(lvalue));           // RETURN
+    }
+    return insert(MoveUtil::move(lvalue)).first;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    const size_type position = d_keys.size();
+
+    BloombergLP::bslstl::FlatSet_RangeProctor<container_type> proctor(
+                                                                   &d_keys,
+                                                                   position);
+    d_keys.insert(d_keys.end(), first, last);
+    mergeTail(position, false, &proctor);
+    proctor.release();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+template <class INPUT_ITERATOR>
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(sorted_unique_t,
+                                                  INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    const size_type position = d_keys.size();
+
+    BloombergLP::bslstl::FlatSet_RangeProctor<container_type> proctor(
+                                                                   &d_keys,
+                                                                   position);
+    d_keys.insert(d_keys.end(), first, last);
+    mergeTail(position, true, &proctor);
+    proctor.release();
+}
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(
+                                             std::initializer_list<KEY> values)
+{
+    insert(values.begin(), values.end());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::insert(
+                                            sorted_unique_t,
+                                            std::initializer_list<KEY> values)
+{
+    insert(sorted_unique, values.begin(), values.end());
+}
+#endif
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(d_keys.cbegin() <= position && position < d_keys.cend());
+
+    return d_keys.erase(position);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::erase(const key_type& key)
+{
+    const_iterator position = find(key);
+    if (position == d_keys.cend()) {
+        return 0;                                                     // RETURN
+    }
+    d_keys.erase(position);
+    return 1;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::erase(const_iterator first,
+                                            const_iterator last)
+{
+    return d_keys.erase(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::replace(
+                           BloombergLP::bslmf::MovableRef<container_type> keys)
+{
+    d_keys = MoveUtil::move(keys);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::swap(flat_set& other)
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    using std::swap;
+
+    BSLS_ASSERT_SAFE(d_keys.get_allocator() == other.d_keys.get_allocator());
+
+    d_keys.swap(other.d_keys);
+    swap(d_compare, other.d_compare);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+void flat_set<KEY, COMPARATOR, ALLOCATOR>::clear() BSLS_KEYWORD_NOEXCEPT
+{
+    d_keys.clear();
+}
+
+// ACCESSORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::begin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_keys.cbegin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::cbegin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_keys.cbegin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::end() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_keys.cend();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::cend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_keys.cend();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::rbegin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_keys.crbegin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::crbegin() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_keys.crbegin();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::rend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_keys.crend();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_reverse_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::crend() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_keys.crend();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_set<KEY, COMPARATOR, ALLOCATOR>::empty() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_keys.empty();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::size() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_keys.size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::max_size() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_keys.max_size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::allocator_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::get_allocator() const
+                                                         BSLS_KEYWORD_NOEXCEPT
+{
+    return d_keys.get_allocator();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::key_compare
+flat_set<KEY, COMPARATOR, ALLOCATOR>::key_comp() const
+{
+    return d_compare;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::value_compare
+flat_set<KEY, COMPARATOR, ALLOCATOR>::value_comp() const
+{
+    return d_compare;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::find(const key_type& key) const
+{
+    const_iterator position = lower_bound(key);
+    return position != d_keys.cend() && !d_compare(key, *position)
+           ? position
+           : d_keys.cend();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+flat_set<KEY, COMPARATOR, ALLOCATOR>::count(const key_type& key) const
+{
+    return find(key) != d_keys.cend() ? 1 : 0;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool flat_set<KEY, COMPARATOR, ALLOCATOR>::contains(const key_type& key) const
+{
+    return find(key) != d_keys.cend();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::lower_bound(const key_type& key) const
+{
+    return std::lower_bound(d_keys.cbegin(), d_keys.cend(), key, d_compare);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator
+flat_set<KEY, COMPARATOR, ALLOCATOR>::upper_bound(const key_type& key) const
+{
+    return std::upper_bound(d_keys.cbegin(), d_keys.cend(), key, d_compare);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+pair<typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator,
+     typename flat_set<KEY, COMPARATOR, ALLOCATOR>::const_iterator>
+flat_set<KEY, COMPARATOR, ALLOCATOR>::equal_range(const key_type& key) const
+{
+    const_iterator first = lower_bound(key);
+    const_iterator last  = first != d_keys.cend() && !d_compare(key, *first)
+                           ? first + 1
+                           : first;
+    return pair<const_iterator, const_iterator>(first, last);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+const typename flat_set<KEY, COMPARATOR, ALLOCATOR>::container_type&
+flat_set<KEY, COMPARATOR, ALLOCATOR>::keys() const BSLS_KEYWORD_NOEXCEPT
+{
+    return d_keys;
+}
+
+}  // close namespace bsl
+
+// FREE OPERATORS
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator==(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return BloombergLP::bslalg::RangeCompare::equal(lhs.begin(),
+                                                    lhs.end(),
+                                                    lhs.size(),
+                                                    rhs.begin(),
+                                                    rhs.end(),
+                                                    rhs.size());
+}
+
+#ifndef BSLS_COMPILERFEATURES_SUPPORT_THREE_WAY_COMPARISON
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator!=(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs == rhs);
+}
+#endif
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return 0 > BloombergLP::bslalg::RangeCompare::lexicographical(lhs.begin(),
+                                                                  lhs.end(),
+                                                                  lhs.size(),
+                                                                  rhs.begin(),
+                                                                  rhs.end(),
+                                                                  rhs.size());
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                    const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return rhs < lhs;
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator<=(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+inline
+bool bsl::operator>=(const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& lhs,
+                     const bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class COMPARATOR, class ALLOCATOR, class PREDICATE>
+inline
+typename bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>::size_type
+bsl::erase_if(bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& s,
+              PREDICATE                                  predicate)
+{
+    typedef typename bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>::container_type
+                                                                     Container;
+    Container&                          keys    = s.d_keys;
+    const typename Container::size_type oldSize = keys.size();
+
+    keys.erase(std::remove_if(keys.begin(), keys.end(), predicate),
+               keys.end());
+    return oldSize - keys.size();
+}
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+void bsl::swap(bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& a,
+               bsl::flat_set<KEY, COMPARATOR, ALLOCATOR>& b)
+                                     BSLS_KEYWORD_NOEXCEPT_SPECIFICATION(false)
+{
+    typedef bsl::flat_set<KEY, COMPARATOR, ALLOCATOR> Container;
+
+    if (a.get_allocator() == b.get_allocator()) {
+        a.swap(b);
+        return;                                                       // RETURN
+    }
+
+    // Copy each object using the allocator of the other, then swap the
+    // copies, which cannot throw, into place.
+
+    Container aCopy(a, b.get_allocator());
+    Container bCopy(b, a.get_allocator());
+
+    a.swap(bCopy);
+    b.swap(aCopy);
+}
+
+// ============================================================================
+//                                TYPE TRAITS
+// ============================================================================
+
+// Type traits for flat ordered containers:
+//: o A flat ordered container defines STL iterators.
+//: o A flat ordered container uses 'bslma' allocators if the (template
+//:   parameter) type 'ALLOCATOR' is convertible from 'bslma::Allocator *'.
+
+namespace BloombergLP {
+
+namespace bslalg {
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+struct HasStlIterators<bsl::flat_set<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::true_type
+{
+};
+
+}  // close namespace bslalg
+
+namespace bslma {
+
+template <class KEY, class COMPARATOR, class ALLOCATOR>
+struct UsesBslmaAllocator<bsl::flat_set<KEY, COMPARATOR, ALLOCATOR> >
+    : bsl::is_convertible<Allocator *, ALLOCATOR>
+{
+};
+
+}  // close namespace bslma
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1479 @@
+// bslstl_flatset.t.cpp                                               -*-C++-*-
+#include <bslstl_flatset.h>
+
+#include <bslstl_set.h>
+#include <bslstl_sortedtags.h>
+#include <bslstl_string.h>
+#include <bslstl_vector.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslalg_hasstliterators.h>
+
+#include <bslmf_movableref.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_stopwatch.h>
+
+#include <functional>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a value-semantic container adaptor.  Since its
+// state is entirely held in a `bsl::vector`, we use the `keys` accessor as
+// the basic accessor, and check the invariant (the keys are strictly
+// increasing under the comparator) after every manipulation.  The bulk
+// operations, which are the reason the component exists, are checked against
+// a `bsl::set` oracle on pseudo-random input, for both the append-only fast
+// path and the merge path, and under injected allocation failures.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] flat_set();
+// [ 2] flat_set(const COMPARATOR&, const ALLOCATOR&);
+// [ 2] flat_set(const ALLOCATOR&);
+// [ 3] flat_set(const container_type&, const COMPARATOR&, const ALLOCATOR&);
+// [ 3] flat_set(MovableRef<container_type>, const COMPARATOR&);
+// [ 3] flat_set(sorted_unique_t, const container_type&, const C&, const A&);
+// [ 3] flat_set(sorted_unique_t, MovableRef<container_type>, const C&);
+// [ 3] flat_set(INPUT_ITERATOR, INPUT_ITERATOR, const C&, const A&);
+// [ 3] flat_set(INPUT_ITERATOR, INPUT_ITERATOR, const A&);
+// [ 3] flat_set(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR, ...);
+// [ 3] flat_set(initializer_list<KEY>, const C&, const A&);
+// [ 3] flat_set(initializer_list<KEY>, const A&);
+// [ 3] flat_set(sorted_unique_t, initializer_list<KEY>, const C&, const A&);
+// [ 5] flat_set(const flat_set&);
+// [ 5] flat_set(const flat_set&, const ALLOCATOR&);
+// [ 5] flat_set(MovableRef<flat_set>);
+// [ 5] flat_set(MovableRef<flat_set>, const ALLOCATOR&);
+//
+// MANIPULATORS
+// [ 5] flat_set& operator=(const flat_set&);
+// [ 5] flat_set& operator=(MovableRef<flat_set>);
+// [ 5] flat_set& operator=(initializer_list<KEY>);
+// [ 2] pair<iterator, bool> insert(const value_type&);
+// [ 2] pair<iterator, bool> insert(MovableRef<value_type>);
+// [ 2] iterator insert(const_iterator, const value_type&);
+// [ 2] iterator insert(const_iterator, MovableRef<value_type>);
+// [ 4] void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 4] void insert(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR);
+// [ 4] void insert(initializer_list<KEY>);
+// [ 4] void insert(sorted_unique_t, initializer_list<KEY>);
+// [ 6] iterator erase(const_iterator);
+// [ 6] size_type erase(const key_type&);
+// [ 6] iterator erase(const_iterator, const_iterator);
+// [ 3] void replace(MovableRef<container_type>);
+// [ 5] void swap(flat_set&);
+// [ 2] void clear();
+//
+// ACCESSORS
+// [ 2] const_iterator begin() const;
+// [ 2] const_iterator end() const;
+// [ 2] const_reverse_iterator rbegin() const;
+// [ 2] const_reverse_iterator rend() const;
+// [ 2] bool empty() const;
+// [ 2] size_type size() const;
+// [ 2] allocator_type get_allocator() const;
+// [ 7] key_compare key_comp() const;
+// [ 7] value_compare value_comp() const;
+// [ 7] const_iterator find(const key_type&) const;
+// [ 7] size_type count(const key_type&) const;
+// [ 7] bool contains(const key_type&) const;
+// [ 7] const_iterator lower_bound(const key_type&) const;
+// [ 7] const_iterator upper_bound(const key_type&) const;
+// [ 7] pair<const_iterator, const_iterator> equal_range(const key_type&);
+// [ 2] const container_type& keys() const;
+//
+// FREE OPERATORS
+// [ 8] bool operator==(const flat_set&, const flat_set&);
+// [ 8] bool operator!=(const flat_set&, const flat_set&);
+// [ 8] bool operator<(const flat_set&, const flat_set&);
+// [ 8] bool operator>(const flat_set&, const flat_set&);
+// [ 8] bool operator<=(const flat_set&, const flat_set&);
+// [ 8] bool operator>=(const flat_set&, const flat_set&);
+//
+// FREE FUNCTIONS
+// [ 6] size_type erase_if(flat_set&, PREDICATE);
+// [ 5] void swap(flat_set&, flat_set&);
+// [10] void swap(flat_set&, flat_set&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 9] EXCEPTION SAFETY OF BULK INSERTION
+// [11] USAGE EXAMPLE
+// [-1] PERFORMANCE: `flat_set` VS. `set`
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+        fflush(stdout);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  PRINTF FORMAT MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ZU BSLS_BSLTESTUTIL_FORMAT_ZU
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bsl::flat_set<int>                          Obj;
+typedef bsl::flat_set<int, std::greater<int> >      GObj;
+typedef bsl::flat_set<bsl::string>                  SObj;
+typedef bsl::vector<int>                            IntVector;
+typedef bsl::set<int>                               Oracle;
+
+static bool             verbose;
+static bool         veryVerbose;
+static bool     veryVeryVerbose;
+static bool veryVeryVeryVerbose;
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// Return a pseudo-random value derived from the specified `state`, and
+/// update `state`.
+unsigned int nextRandom(unsigned int *state)
+{
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 8;
+}
+
+/// Return `true` if the keys of the specified `set` are strictly increasing
+/// under its comparator, and `false` otherwise.
+template <class SET>
+bool isValid(const SET& set)
+{
+    typename SET::const_iterator it = set.begin();
+    if (it == set.end()) {
+        return true;                                                  // RETURN
+    }
+    typename SET::const_iterator next = it;
+    for (++next; next != set.end(); ++it, ++next) {
+        if (!set.key_comp()(*it, *next)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+/// Return `true` if the specified `set` holds the same keys as the specified
+/// `oracle`, and `false` otherwise.
+bool matches(const Obj& set, const Oracle& oracle)
+{
+    return set.size() == oracle.size()
+        && std::equal(set.begin(), set.end(), oracle.begin());
+}
+
+/// Return `true` if the specified `value` is even, and `false` otherwise.
+bool isEven(int value)
+{
+    return 0 == value % 2;
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+                verbose = argc > 2;
+            veryVerbose = argc > 3;
+        veryVeryVerbose = argc > 4;
+    veryVeryVeryVerbose = argc > 5;
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    bslma::TestAllocator globalAllocator("global", veryVeryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVeryVerbose);
+    ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
+
+    switch (test) { case 0:
+      case 11: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        // 1. The usage example provided in the component header file compiles,
+        //    links, and runs as shown.
+        //
+        // Plan:
+        // 1. Incorporate usage example from header into test driver, remove
+        //    leading comment characters, and replace `assert` with `ASSERT`.
+        //    (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nUSAGE EXAMPLE"
+                            "\n=============\n");
+
+// First, we collect the words in a vector, in whatever order they happen to
+// be listed:
+// ```
+    bslma::TestAllocator ta;
+
+    bsl::vector<bsl::string> words(&ta);
+    words.push_back("while");
+    words.push_back("if");
+    words.push_back("else");
+    words.push_back("return");
+    words.push_back("if");
+// ```
+// Then, we create a `flat_set` from the vector.  The keys are sorted and the
+// duplicate `"if"` is removed, all in one pass over the vector:
+// ```
+    bsl::flat_set<bsl::string> reserved(words.begin(), words.end(), &ta);
+
+    ASSERT(4 == reserved.size());
+    ASSERT("else" == *reserved.begin());
+// ```
+// Now, we can look up identifiers with a binary search over contiguous
+// memory:
+// ```
+    ASSERT( reserved.contains("return"));
+    ASSERT(!reserved.contains("x"));
+// ```
+// Finally, we add more keys that we know to be sorted and unique, so that
+// the set can skip sorting them:
+// ```
+    const char *more[] = { "yield", "zip" };
+    reserved.insert(bsl::sorted_unique, more, more + 2);
+    ASSERT(6 == reserved.size());
+// ```
+      } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // SWAP WITH UNEQUAL ALLOCATORS
+        //
+        // Concerns:
+        // 1. The free `swap` exchanges the values of two sets created with
+        //    different allocators.
+        //
+        // 2. Each set retains its allocator, and its elements use only that
+        //    allocator.
+        //
+        // 3. If an allocation fails, the exception propagates, both sets
+        //    keep their original values, and no memory is leaked.
+        //
+        // Plan:
+        // 1. Using two distinct test allocators, create sets of `bsl::string`
+        //    values long enough to allocate, swap them under
+        //    `BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*`, and check the values,
+        //    the allocators of the sets and of their elements, and the
+        //    memory in use.  (C-1..3)
+        //
+        // Testing:
+        //   void swap(flat_set&, flat_set&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nSWAP WITH UNEQUAL ALLOCATORS"
+                            "\n============================\n");
+
+        bslma::TestAllocator oa1("object1",  veryVeryVeryVerbose);
+        bslma::TestAllocator oa2("object2",  veryVeryVeryVerbose);
+        bslma::TestAllocator za("different", veryVeryVeryVerbose);
+
+        const bsl::string VALUE(40, 'v');  // defeats the small buffer
+
+        if (verbose) printf("\tTesting unequal allocators.\n");
+        {
+            SObj mXX(&za);  const SObj& XX = mXX;
+            SObj mYY(&za);  const SObj& YY = mYY;
+            for (char c = 'a'; c < 'd'; ++c) {
+                mXX.insert(VALUE + c);
+            }
+            for (char c = 'c'; c < 'j'; ++c) {
+                mYY.insert(VALUE + c);
+            }
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa1) {
+                SObj mX(XX, &oa1);  const SObj& X = mX;
+                SObj mY(YY, &oa2);  const SObj& Y = mY;
+
+                try {
+                    swap(mX, mY);
+                }
+                catch (...) {
+                    ASSERT(XX == X);
+                    ASSERT(YY == Y);
+                    throw;
+                }
+
+                ASSERT(YY == X);
+                ASSERT(XX == Y);
+
+                ASSERT(&oa1 == X.get_allocator().mechanism());
+                ASSERT(&oa2 == Y.get_allocator().mechanism());
+                for (SObj::const_iterator it = X.begin(); it != X.end();
+                                                                        ++it) {
+                    ASSERT(&oa1 == it->get_allocator().mechanism());
+                }
+                for (SObj::const_iterator it = Y.begin(); it != Y.end();
+                                                                        ++it) {
+                    ASSERT(&oa2 == it->get_allocator().mechanism());
+                }
+
+                swap(mX, mY);
+                ASSERT(XX == X);
+                ASSERT(YY == Y);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERT(0 == oa1.numBlocksInUse());
+            ASSERT(0 == oa2.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tTesting equal allocators.\n");
+        {
+            SObj mX(&oa1);  const SObj& X = mX;
+            SObj mY(&oa1);  const SObj& Y = mY;
+            mX.insert(VALUE + 'x');
+            mY.insert(VALUE + 'y');
+
+            const SObj XX(X, &za);
+            const SObj YY(Y, &za);
+
+            bslma::TestAllocatorMonitor oam(&oa1);
+
+            swap(mX, mY);
+            ASSERT(YY == X);
+            ASSERT(XX == Y);
+
+            ASSERT(oam.isTotalSame());
+        }
+        ASSERT(0 == za.numBlocksInUse());
+      } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY OF BULK INSERTION
+        //
+        // Concerns:
+        // 1. If an allocation fails during a bulk insertion, whether on the
+        //    append-only path or on the merge path, the exception propagates,
+        //    the set is left sorted and free of duplicates, and no memory is
+        //    leaked.
+        //
+        // 2. If an allocation fails during a bulk insertion of keys whose move
+        //    constructor does not throw, the set is left with its original
+        //    value.
+        //
+        // Plan:
+        // 1. For each of a set of initial contents and ranges to insert, run
+        //    the insertion under `BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*`, using
+        //    `bsl::string` keys long enough to allocate, and check the
+        //    invariant in the handler and at the end of each iteration.
+        //    (C-1)
+        //
+        // 2. In the handler, also check that the set holds the initial keys.
+        //    (C-2)
+        //
+        // Testing:
+        //   EXCEPTION SAFETY OF BULK INSERTION
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nEXCEPTION SAFETY OF BULK INSERTION"
+                            "\n==================================\n");
+
+        static const struct {
+            int         d_line;
+            const char *d_initial;  // initial keys, one character each
+            const char *d_insert;   // keys to insert, one character each
+        } DATA[] = {
+            //LINE INITIAL    INSERT
+            //---- ---------  ---------
+            { L_,  "",        "dbca"     },
+            { L_,  "ab",      "fedc"     },  // append-only
+            { L_,  "ab",      "cdef"     },  // append-only, sorted
+            { L_,  "aceg",    "hbfd"     },  // merge
+            { L_,  "aceg",    "gecaxa"   },  // merge, all duplicates but x
+            { L_,  "abcdefg", "zyxwba"   },  // merge at both ends
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE    = DATA[ti].d_line;
+            const char *const INITIAL = DATA[ti].d_initial;
+            const char *const INSERT  = DATA[ti].d_insert;
+
+            if (veryVerbose) { T_ P_(LINE) P_(INITIAL) P(INSERT) }
+
+            const bsl::string PREFIX(40, '_');  // defeats the small buffer
+
+            bsl::vector<bsl::string> initial;
+            for (const char *p = INITIAL; *p; ++p) {
+                initial.push_back(PREFIX + *p);
+            }
+            bsl::vector<bsl::string> insert;
+            for (const char *p = INSERT; *p; ++p) {
+                insert.push_back(PREFIX + *p);
+            }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(oa) {
+                SObj mX(initial.begin(), initial.end(), &oa);
+                const SObj& X = mX;
+
+                try {
+                    mX.insert(insert.begin(), insert.end());
+                }
+                catch (...) {
+                    ASSERTV(LINE, isValid(X));
+                    ASSERTV(LINE, initial.size() == X.size());
+                    ASSERTV(LINE, std::equal(initial.begin(),
+                                             initial.end(),
+                                             X.begin()));
+                    throw;
+                }
+
+                ASSERTV(LINE, isValid(X));
+
+                bsl::set<bsl::string> oracle(initial.begin(), initial.end());
+                oracle.insert(insert.begin(), insert.end());
+                ASSERTV(LINE, oracle.size() == X.size());
+                ASSERTV(LINE, std::equal(X.begin(), X.end(), oracle.begin()));
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            ASSERTV(LINE, 0 == oa.numBlocksInUse());
+        }
+      } break;
+      case 8: {
+        // --------------------------------------------------------------------
+        // COMPARISON OPERATORS
+        //
+        // Concerns:
+        // 1. Two sets compare equal if and only if they hold the same keys.
+        //
+        // 2. The relational operators order sets lexicographically.
+        //
+        // Plan:
+        // 1. For every pair of a table of sets, compare the result of each
+        //    operator with that for the corresponding `bsl::set` objects.
+        //    (C-1..2)
+        //
+        // Testing:
+        //   bool operator==(const flat_set&, const flat_set&);
+        //   bool operator!=(const flat_set&, const flat_set&);
+        //   bool operator<(const flat_set&, const flat_set&);
+        //   bool operator>(const flat_set&, const flat_set&);
+        //   bool operator<=(const flat_set&, const flat_set&);
+        //   bool operator>=(const flat_set&, const flat_set&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOMPARISON OPERATORS"
+                            "\n====================\n");
+
+        static const char *const SPECS[] = {
+            "", "a", "ab", "abc", "abd", "b", "bc", "c", "acd"
+        };
+        const int NUM_SPECS = sizeof SPECS / sizeof *SPECS;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        for (int i = 0; i < NUM_SPECS; ++i) {
+            const bsl::string SI(SPECS[i]);
+            const Obj         X(SI.begin(), SI.end(), &oa);
+            const Oracle      OX(SI.begin(), SI.end());
+
+            for (int j = 0; j < NUM_SPECS; ++j) {
+                const bsl::string SJ(SPECS[j]);
+                const Obj         Y(SJ.begin(), SJ.end(), &oa);
+                const Oracle      OY(SJ.begin(), SJ.end());
+
+                if (veryVerbose) { T_ P_(SPECS[i]) P(SPECS[j]) }
+
+                ASSERTV(i, j, (OX == OY) == (X == Y));
+                ASSERTV(i, j, (OX != OY) == (X != Y));
+                ASSERTV(i, j, (OX <  OY) == (X <  Y));
+                ASSERTV(i, j, (OX >  OY) == (X >  Y));
+                ASSERTV(i, j, (OX <= OY) == (X <= Y));
+                ASSERTV(i, j, (OX >= OY) == (X >= Y));
+            }
+        }
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // LOOKUP
+        //
+        // Concerns:
+        // 1. `find`, `count`, `contains`, `lower_bound`, `upper_bound`, and
+        //    `equal_range` agree with those of `bsl::set` for keys that are
+        //    present, absent, smaller than all keys, and larger than all keys.
+        //
+        // 2. Lookup uses the comparator supplied at construction, which is
+        //    returned by `key_comp` and `value_comp`.
+        //
+        // 3. Lookup allocates no memory.
+        //
+        // Plan:
+        // 1. Fill a set and an oracle with the odd numbers below 40, and
+        //    compare the results of lookup for every key in [-1, 41].
+        //    (C-1, 3)
+        //
+        // 2. Repeat with a set ordered by `std::greater<int>`.  (C-2)
+        //
+        // Testing:
+        //   key_compare key_comp() const;
+        //   value_compare value_comp() const;
+        //   const_iterator find(const key_type&) const;
+        //   size_type count(const key_type&) const;
+        //   bool contains(const key_type&) const;
+        //   const_iterator lower_bound(const key_type&) const;
+        //   const_iterator upper_bound(const key_type&) const;
+        //   pair<const_iterator, const_iterator> equal_range(const key_type&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nLOOKUP"
+                            "\n======\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj        mX(&oa);  const Obj&  X = mX;
+        GObj       mG(std::greater<int>(), &oa);  const GObj& G = mG;
+        Oracle     oracle;
+
+        for (int i = 1; i < 40; i += 2) {
+            mX.insert(i);
+            mG.insert(i);
+            oracle.insert(i);
+        }
+        ASSERT(matches(X, oracle));
+        ASSERT(isValid(G));
+        ASSERT(39 == *G.begin());
+        ASSERT( G.key_comp()(2, 1));
+        ASSERT( G.value_comp()(2, 1));
+        ASSERT(!X.key_comp()(2, 1));
+
+        bslma::TestAllocatorMonitor oam(&oa);
+
+        for (int k = -1; k <= 41; ++k) {
+            if (veryVerbose) { T_ P(k) }
+
+            const bool PRESENT = oracle.count(k);
+
+            ASSERTV(k, PRESENT == X.contains(k));
+            ASSERTV(k, (PRESENT ? 1u : 0u) == X.count(k));
+            ASSERTV(k, PRESENT == (X.end() != X.find(k)));
+            ASSERTV(k, !PRESENT || k == *X.find(k));
+
+            const Oracle::const_iterator OLB = oracle.lower_bound(k);
+            const Oracle::const_iterator OUB = oracle.upper_bound(k);
+
+            ASSERTV(k, std::distance(oracle.begin(), OLB) ==
+                                         std::distance(X.begin(),
+                                                       X.lower_bound(k)));
+            ASSERTV(k, std::distance(oracle.begin(), OUB) ==
+                                         std::distance(X.begin(),
+                                                       X.upper_bound(k)));
+
+            const bsl::pair<Obj::const_iterator, Obj::const_iterator> R =
+                                                            X.equal_range(k);
+            ASSERTV(k, X.lower_bound(k) == R.first);
+            ASSERTV(k, X.upper_bound(k) == R.second);
+
+            ASSERTV(k, PRESENT == G.contains(k));
+            ASSERTV(k, PRESENT == (G.end() != G.find(k)));
+            ASSERTV(k, G.lower_bound(k) == G.equal_range(k).first);
+            ASSERTV(k, G.end() == G.lower_bound(k) || *G.lower_bound(k) <= k);
+        }
+
+        ASSERT(oam.isTotalSame());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // ERASE
+        //
+        // Concerns:
+        // 1. `erase(position)` removes the key at `position` and returns an
+        //    iterator to the following key.
+        //
+        // 2. `erase(key)` returns the number of keys removed, 0 or 1.
+        //
+        // 3. `erase(first, last)` removes the keys in the range and returns
+        //    `last` adjusted to the new sequence.
+        //
+        // 4. `erase_if` removes exactly the keys satisfying the predicate, and
+        //    returns their number.
+        //
+        // Plan:
+        // 1. Perform each kind of erasure on sets of the numbers below 20,
+        //    and compare against an oracle.  (C-1..4)
+        //
+        // Testing:
+        //   iterator erase(const_iterator);
+        //   size_type erase(const key_type&);
+        //   iterator erase(const_iterator, const_iterator);
+        //   size_type erase_if(flat_set&, PREDICATE);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nERASE"
+                            "\n=====\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        IntVector numbers;
+        for (int i = 0; i < 20; ++i) {
+            numbers.push_back(i);
+        }
+
+        if (verbose) printf("\tErase by position.\n");
+        {
+            Obj mX(numbers.begin(), numbers.end(), &oa);  const Obj& X = mX;
+
+            Obj::iterator it = mX.erase(X.find(5));
+            ASSERT(6 == *it);
+            ASSERT(19 == X.size());
+            ASSERT(!X.contains(5));
+
+            it = mX.erase(X.find(19));
+            ASSERT(X.end() == it);
+
+            it = mX.erase(X.begin());
+            ASSERT(1 == *it);
+            ASSERT(17 == X.size());
+            ASSERT(isValid(X));
+        }
+
+        if (verbose) printf("\tErase by key.\n");
+        {
+            Obj mX(numbers.begin(), numbers.end(), &oa);  const Obj& X = mX;
+
+            ASSERT(1 == mX.erase(7));
+            ASSERT(0 == mX.erase(7));
+            ASSERT(0 == mX.erase(100));
+            ASSERT(19 == X.size());
+            ASSERT(isValid(X));
+        }
+
+        if (verbose) printf("\tErase a range.\n");
+        {
+            for (int b = 0; b <= 20; ++b) {
+                for (int e = b; e <= 20; ++e) {
+                    Obj        mX(numbers.begin(), numbers.end(), &oa);
+                    const Obj& X = mX;
+                    Oracle     oracle(numbers.begin(), numbers.end());
+
+                    Obj::iterator it = mX.erase(X.begin() + b, X.begin() + e);
+                    oracle.erase(oracle.lower_bound(b), oracle.lower_bound(e));
+
+                    ASSERTV(b, e, matches(X, oracle));
+                    ASSERTV(b, e, X.begin() + b == it);
+                }
+            }
+        }
+
+        if (verbose) printf("\tErase by predicate.\n");
+        {
+            Obj mX(numbers.begin(), numbers.end(), &oa);  const Obj& X = mX;
+
+            ASSERT(10 == bsl::erase_if(mX, isEven));
+            ASSERT(10 == X.size());
+            ASSERT(isValid(X));
+            for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(*it, !isEven(*it));
+            }
+            ASSERT(0 == bsl::erase_if(mX, isEven));
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // COPY, MOVE, ASSIGNMENT, AND SWAP
+        //
+        // Concerns:
+        // 1. Copy construction copies the keys, using the supplied allocator
+        //    or, if none, the default allocator.
+        //
+        // 2. Move construction with no allocator, or with an equal one,
+        //    allocates no memory and transfers the keys.
+        //
+        // 3. Move construction with a different allocator copies the keys
+        //    into memory from that allocator.
+        //
+        // 4. Copy and move assignment leave the target with the value of the
+        //    source, using the target's allocator.
+        //
+        // 5. `swap` exchanges the keys without allocating.
+        //
+        // Plan:
+        // 1. Exercise each operation on `bsl::string` keys long enough to
+        //    allocate, checking values and allocator use.  (C-1..5)
+        //
+        // Testing:
+        //   flat_set(const flat_set&);
+        //   flat_set(const flat_set&, const ALLOCATOR&);
+        //   flat_set(MovableRef<flat_set>);
+        //   flat_set(MovableRef<flat_set>, const ALLOCATOR&);
+        //   flat_set& operator=(const flat_set&);
+        //   flat_set& operator=(MovableRef<flat_set>);
+        //   flat_set& operator=(initializer_list<KEY>);
+        //   void swap(flat_set&);
+        //   void swap(flat_set&, flat_set&);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCOPY, MOVE, ASSIGNMENT, AND SWAP"
+                            "\n================================\n");
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+        bslma::TestAllocator za("other",  veryVeryVeryVerbose);
+
+        const bsl::string PREFIX(40, '_');
+
+        SObj mW(&oa);  const SObj& W = mW;
+        for (char c = 'a'; c <= 'j'; ++c) {
+            mW.insert(PREFIX + c);
+        }
+
+        if (verbose) printf("\tCopy construction.\n");
+        {
+            bslma::TestAllocatorMonitor dam(&defaultAllocator);
+
+            const SObj X(W);
+            ASSERT(W == X);
+            ASSERT(&defaultAllocator == X.get_allocator().mechanism());
+            ASSERT(dam.isInUseUp());
+
+            const SObj Y(W, &za);
+            ASSERT(W == Y);
+            ASSERT(&za == Y.get_allocator().mechanism());
+        }
+
+        if (verbose) printf("\tMove construction.\n");
+        {
+            SObj mS(W, &oa);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            SObj mX(MoveUtil::move(mS));  const SObj& X = mX;
+            ASSERT(W == X);
+            ASSERT(&oa == X.get_allocator().mechanism());
+            ASSERT(oam.isTotalSame());
+
+            SObj mY(MoveUtil::move(mX), &oa);  const SObj& Y = mY;
+            ASSERT(W == Y);
+            ASSERT(oam.isTotalSame());
+
+            SObj mZ(MoveUtil::move(mY), &za);  const SObj& Z = mZ;
+            ASSERT(W == Z);
+            ASSERT(&za == Z.get_allocator().mechanism());
+            ASSERT(0 < za.numBlocksInUse());
+        }
+
+        if (verbose) printf("\tAssignment.\n");
+        {
+            SObj mX(&za);  const SObj& X = mX;
+            mX.insert(PREFIX + 'z');
+
+            mX = W;
+            ASSERT(W == X);
+            ASSERT(&za == X.get_allocator().mechanism());
+
+            SObj mS(W, &oa);
+            mX.clear();
+            mX = MoveUtil::move(mS);
+            ASSERT(W == X);
+            ASSERT(&za == X.get_allocator().mechanism());
+
+            SObj mY(&oa);  const SObj& Y = mY;
+            SObj mT(W, &oa);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+            mY = MoveUtil::move(mT);
+            ASSERT(W == Y);
+            ASSERT(oam.isTotalSame());
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            Obj mI(&oa);  const Obj& I = mI;
+            mI = { 3, 1, 2, 1 };
+            ASSERT(3 == I.size());
+            ASSERT(1 == *I.begin());
+#endif
+        }
+
+        if (verbose) printf("\tSwap.\n");
+        {
+            SObj mX(W, &oa);  const SObj& X = mX;
+            SObj mY(&oa);     const SObj& Y = mY;
+            mY.insert(PREFIX + 'z');
+
+            const SObj XX(X, &za);
+            const SObj YY(Y, &za);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            mX.swap(mY);
+            ASSERT(YY == X);
+            ASSERT(XX == Y);
+
+            swap(mX, mY);
+            ASSERT(XX == X);
+            ASSERT(YY == Y);
+
+            ASSERT(oam.isTotalSame());
+        }
+        ASSERT(0 == za.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // BULK INSERTION
+        //
+        // Concerns:
+        // 1. Inserting a range, whether sorted or not, and whether it
+        //    overlaps the keys present or lies entirely after them, leaves
+        //    the union of the keys, with the keys present before the
+        //    insertion retained in preference to equivalent inserted keys.
+        //
+        // 2. Duplicates within the inserted range are dropped.
+        //
+        // 3. Inserting a sorted, unique range with the `sorted_unique` tag
+        //    gives the same result as without it.
+        //
+        // 4. Input iterators that are not forward iterators are supported.
+        //
+        // 5. Initializer lists are supported.
+        //
+        // Plan:
+        // 1. For many pseudo-random initial contents and ranges, of various
+        //    sizes and key spreads, insert into a set and an oracle and
+        //    compare.  (C-1..2)
+        //
+        // 2. Insert a sorted version of each range with `sorted_unique`.
+        //    (C-3)
+        //
+        // 3. Use a set of a type whose equivalent keys are distinguishable,
+        //    and check which key survives.  (C-1)
+        //
+        // 4. Insert from a `bsl::set` iterator range and from initializer
+        //    lists.  (C-4..5)
+        //
+        // Testing:
+        //   void insert(INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR);
+        //   void insert(initializer_list<KEY>);
+        //   void insert(sorted_unique_t, initializer_list<KEY>);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBULK INSERTION"
+                            "\n==============\n");
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        unsigned int state = 1;
+
+        if (verbose) printf("\tRandom ranges.\n");
+
+        static const int SIZES[] = { 0, 1, 2, 3, 7, 16, 100, 1000 };
+        const int        NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            for (int ni = 0; ni < NUM_SIZES; ++ni) {
+                for (int spread = 1; spread <= 4096; spread *= 8) {
+                    const int INITIAL = SIZES[si];
+                    const int NEW     = SIZES[ni];
+
+                    if (veryVerbose) { T_ P_(INITIAL) P_(NEW) P(spread) }
+
+                    IntVector initial, insert;
+                    for (int i = 0; i < INITIAL; ++i) {
+                        initial.push_back(nextRandom(&state) % spread);
+                    }
+                    for (int i = 0; i < NEW; ++i) {
+                        insert.push_back(nextRandom(&state) % spread +
+                                         (spread == 8 ? spread : 0));
+                    }
+
+                    Obj        mX(initial.begin(), initial.end(), &oa);
+                    const Obj& X = mX;
+                    Oracle     oracle(initial.begin(), initial.end());
+                    ASSERTV(INITIAL, NEW, spread, matches(X, oracle));
+
+                    Obj mS(X, &oa);  const Obj& S = mS;
+
+                    mX.insert(insert.begin(), insert.end());
+                    oracle.insert(insert.begin(), insert.end());
+                    ASSERTV(INITIAL, NEW, spread, matches(X, oracle));
+
+                    const Oracle sorted(insert.begin(), insert.end());
+                    mS.insert(bsl::sorted_unique,
+                              sorted.begin(),
+                              sorted.end());
+                    ASSERTV(INITIAL, NEW, spread, X == S);
+                }
+            }
+        }
+
+        if (verbose) printf("\tExisting keys win.\n");
+        {
+            typedef bsl::pair<int, int>                           Pair;
+            typedef bsl::flat_set<Pair, bool (*)(const Pair&,
+                                                 const Pair&)>    PObj;
+
+            struct Local {
+                static bool lessFirst(const Pair& lhs, const Pair& rhs)
+                {
+                    return lhs.first < rhs.first;
+                }
+            };
+
+            PObj mX(&Local::lessFirst, &oa);  const PObj& X = mX;
+            for (int i = 0; i < 10; i += 2) {
+                mX.insert(Pair(i, 0));
+            }
+
+            bsl::vector<Pair> insert;
+            for (int i = 9; i >= 0; --i) {
+                insert.push_back(Pair(i, 1));
+                insert.push_back(Pair(i, 2));
+            }
+            mX.insert(insert.begin(), insert.end());
+
+            ASSERT(10 == X.size());
+            for (PObj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                ASSERTV(it->first, it->second,
+                        (0 == it->first % 2) == (0 == it->second));
+            }
+        }
+
+        if (verbose) printf("\tInitializer lists.\n");
+        {
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+            Obj mX({ 5, 3, 5 }, &oa);  const Obj& X = mX;
+            ASSERT(2 == X.size());
+
+            mX.insert({ 4, 3, 9 });
+            ASSERT(4 == X.size());
+
+            mX.insert(bsl::sorted_unique, { 10, 11 });
+            ASSERT(6 == X.size());
+            ASSERT(11 == *X.rbegin());
+            ASSERT(isValid(X));
+
+            const Obj Y(bsl::sorted_unique,
+                        { 3, 4, 5, 9, 10, 11 },
+                        std::less<int>(),
+                        &oa);
+            ASSERT(X == Y);
+#endif
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // CONSTRUCTION FROM SEQUENCES
+        //
+        // Concerns:
+        // 1. Construction from a container or a range sorts the keys and
+        //    drops duplicates.
+        //
+        // 2. Construction with `sorted_unique` adopts the keys as they are.
+        //
+        // 3. Construction from a moved container, and `replace`, take over
+        //    its memory without allocating.
+        //
+        // 4. The allocator is the one supplied, or the default allocator.
+        //
+        // Plan:
+        // 1. Construct sets with each constructor from a shuffled sequence
+        //    with duplicates, and from its sorted, unique counterpart, and
+        //    check the keys and allocator.  (C-1..4)
+        //
+        // Testing:
+        //   flat_set(const container_type&, const C&, const A&);
+        //   flat_set(MovableRef<container_type>, const COMPARATOR&);
+        //   flat_set(sorted_unique_t, const container_type&, const C&, ...);
+        //   flat_set(sorted_unique_t, MovableRef<container_type>, const C&);
+        //   flat_set(INPUT_ITERATOR, INPUT_ITERATOR, const C&, const A&);
+        //   flat_set(INPUT_ITERATOR, INPUT_ITERATOR, const A&);
+        //   flat_set(sorted_unique_t, INPUT_ITERATOR, INPUT_ITERATOR, ...);
+        //   flat_set(initializer_list<KEY>, const C&, const A&);
+        //   flat_set(initializer_list<KEY>, const A&);
+        //   flat_set(sorted_unique_t, initializer_list<KEY>, const C&, ...);
+        //   void replace(MovableRef<container_type>);
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nCONSTRUCTION FROM SEQUENCES"
+                            "\n===========================\n");
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        IntVector shuffled(&oa);
+        static const int VALUES[] = { 8, 3, 5, 3, 0, 9, 1, 8, 2, 7, 4, 6, 0 };
+        shuffled.assign(VALUES, VALUES + sizeof VALUES / sizeof *VALUES);
+
+        IntVector sorted(&oa);
+        for (int i = 0; i < 10; ++i) {
+            sorted.push_back(i);
+        }
+
+        {
+            const Obj X(shuffled, std::less<int>(), &oa);
+            ASSERT(sorted == X.keys());
+            ASSERT(&oa == X.get_allocator().mechanism());
+
+            const Obj Y(shuffled.begin(), shuffled.end(), &oa);
+            ASSERT(sorted == Y.keys());
+
+            const Obj Z(shuffled.begin(), shuffled.end());
+            ASSERT(sorted == Z.keys());
+            ASSERT(&defaultAllocator == Z.get_allocator().mechanism());
+
+            const GObj G(shuffled.begin(), shuffled.end());
+            ASSERT(9 == *G.begin());
+            ASSERT(isValid(G));
+
+            const Obj S(bsl::sorted_unique, sorted, std::less<int>(), &oa);
+            ASSERT(sorted == S.keys());
+
+            const Obj T(bsl::sorted_unique, sorted.begin(), sorted.end());
+            ASSERT(sorted == T.keys());
+        }
+        {
+            IntVector keys(shuffled, &oa);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            const Obj X(MoveUtil::move(keys));
+            ASSERT(sorted == X.keys());
+            ASSERT(&oa == X.get_allocator().mechanism());
+            ASSERT(oam.isInUseSame());
+
+            IntVector sortedKeys(sorted, &oa);
+            const Obj Y(bsl::sorted_unique, MoveUtil::move(sortedKeys));
+            ASSERT(sorted == Y.keys());
+        }
+        {
+            Obj       mX(&oa);  const Obj& X = mX;
+            IntVector keys(shuffled, &oa);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+
+            mX.replace(MoveUtil::move(keys));
+            ASSERT(shuffled == X.keys());
+            ASSERT(oam.isInUseSame());
+
+            IntVector other(sorted, &oa);
+            mX.replace(MoveUtil::move(other));
+            ASSERT(sorted == X.keys());
+        }
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_GENERALIZED_INITIALIZERS)
+        {
+            const Obj X({ 2, 1, 2, 0 }, std::less<int>(), &oa);
+            ASSERT(3 == X.size());
+            ASSERT(0 == *X.begin());
+
+            const Obj Y({ 2, 1, 2, 0 }, &oa);
+            ASSERT(X == Y);
+
+            const Obj Z(bsl::sorted_unique,
+                        { 0, 1, 2 },
+                        std::less<int>(),
+                        &oa);
+            ASSERT(X == Z);
+        }
+#endif
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // DEFAULT CONSTRUCTION, SINGLE-KEY INSERTION, AND BASIC ACCESSORS
+        //
+        // Concerns:
+        // 1. A default-constructed set is empty and uses the supplied
+        //    allocator, or else the default allocator.
+        //
+        // 2. Inserting a key that is absent returns an iterator to it and
+        //    `true`; inserting one that is present returns an iterator to the
+        //    existing key and `false`, and does not allocate.
+        //
+        // 3. Hinted insertion gives the same result for correct and incorrect
+        //    hints.
+        //
+        // 4. Moved-in keys are moved, not copied.
+        //
+        // 5. The iterators and `keys` reflect the sorted keys.
+        //
+        // 6. `clear` removes all keys, and retains the capacity.
+        //
+        // Plan:
+        // 1. Insert the keys of a table in order, with and without hints, and
+        //    check the results.  (C-1..3, 5..6)
+        //
+        // 2. Insert a `bsl::string` long enough to allocate by move, and check
+        //    that no memory is allocated.  (C-4)
+        //
+        // Testing:
+        //   flat_set();
+        //   flat_set(const COMPARATOR&, const ALLOCATOR&);
+        //   flat_set(const ALLOCATOR&);
+        //   pair<iterator, bool> insert(const value_type&);
+        //   pair<iterator, bool> insert(MovableRef<value_type>);
+        //   iterator insert(const_iterator, const value_type&);
+        //   iterator insert(const_iterator, MovableRef<value_type>);
+        //   void clear();
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        //   const_reverse_iterator rbegin() const;
+        //   const_reverse_iterator rend() const;
+        //   bool empty() const;
+        //   size_type size() const;
+        //   allocator_type get_allocator() const;
+        //   const container_type& keys() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nDEFAULT CONSTRUCTION, SINGLE-KEY INSERTION"
+                            "\n==========================================\n");
+
+        typedef bslmf::MovableRefUtil MoveUtil;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        {
+            const Obj X;
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(X.begin() == X.end());
+            ASSERT(X.rbegin() == X.rend());
+            ASSERT(&defaultAllocator == X.get_allocator().mechanism());
+
+            const Obj Y(std::less<int>(), &oa);
+            ASSERT(&oa == Y.get_allocator().mechanism());
+
+            const Obj Z(&oa);
+            ASSERT(&oa == Z.get_allocator().mechanism());
+            ASSERT(0 == oa.numBlocksTotal());
+        }
+
+        static const struct {
+            int d_line;
+            int d_key;
+            int d_index;     // expected position after insertion
+            bool d_isNew;    // expected result of insertion
+        } DATA[] = {
+            //LINE KEY INDEX  NEW
+            //---- --- -----  -----
+            { L_,   5,    0,  true  },
+            { L_,   5,    0,  false },
+            { L_,   9,    1,  true  },
+            { L_,   1,    0,  true  },
+            { L_,   7,    2,  true  },
+            { L_,   9,    3,  false },
+            { L_,   0,    0,  true  },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int hinted = 0; hinted < 3; ++hinted) {
+            Obj mX(&oa);  const Obj& X = mX;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int  LINE   = DATA[ti].d_line;
+                const int  KEY    = DATA[ti].d_key;
+                const int  INDEX  = DATA[ti].d_index;
+                const bool IS_NEW = DATA[ti].d_isNew;
+
+                const Obj::size_type SIZE = X.size();
+
+                Obj::iterator it;
+                if (0 == hinted) {
+                    bsl::pair<Obj::iterator, bool> result = mX.insert(KEY);
+                    ASSERTV(LINE, IS_NEW == result.second);
+                    it = result.first;
+                }
+                else if (1 == hinted) {
+                    it = mX.insert(X.lower_bound(KEY), KEY);  // correct hint
+                }
+                else {
+                    it = mX.insert(X.end(), KEY);  // mostly incorrect hint
+                }
+
+                ASSERTV(LINE, KEY == *it);
+                ASSERTV(LINE, INDEX == it - X.begin());
+                ASSERTV(LINE, SIZE + IS_NEW == X.size());
+                ASSERTV(LINE, isValid(X));
+                ASSERTV(LINE, X.keys().size() == X.size());
+                ASSERTV(LINE, &X.keys().front() == &*X.begin());
+                ASSERTV(LINE, *X.rbegin() == X.keys().back());
+            }
+
+            const Obj::size_type CAPACITY = X.keys().capacity();
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(CAPACITY == X.keys().capacity());
+        }
+
+        {
+            SObj mX(&oa);  const SObj& X = mX;
+            mX.insert(bsl::string(40, 'a'));
+            mX.insert(bsl::string(40, 'c'));
+
+            bsl::string b(40, 'b', &oa);
+            bsl::string d(40, 'd', &oa);
+
+            bslma::TestAllocatorMonitor oam(&oa);
+            mX.insert(MoveUtil::move(b));
+            mX.insert(X.end(), MoveUtil::move(d));
+            ASSERT(4 == X.size());
+            ASSERT(oam.isInUseSame());
+            ASSERT(bsl::string(40, 'b') == X.keys()[1]);
+        }
+        ASSERT(0 == oa.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        // 1. The class is sufficiently functional to enable comprehensive
+        //    testing in subsequent test cases.
+        //
+        // Plan:
+        // 1. Insert, find, and erase a few keys, and create sets in bulk.
+        //    (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        ASSERT((bslalg::HasStlIterators<Obj>::value));
+        ASSERT((bslma::UsesBslmaAllocator<Obj>::value));
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+        ASSERT(mX.insert(3).second);
+        ASSERT(mX.insert(1).second);
+        ASSERT(!mX.insert(3).second);
+        ASSERT(2 == X.size());
+        ASSERT(1 == *X.begin());
+        ASSERT(X.contains(3));
+        ASSERT(1 == mX.erase(3));
+        ASSERT(!X.contains(3));
+
+        static const int VALUES[] = { 4, 2, 4, 8, 6 };
+        mX.insert(VALUES, VALUES + 5);
+        ASSERT(5 == X.size());
+        ASSERT(isValid(X));
+
+        const Obj Y(VALUES, VALUES + 5, &oa);
+        ASSERT(4 == Y.size());
+        ASSERT(X != Y);
+        ASSERT(X < Y);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: `flat_set` VS. `set`
+        //
+        // Concerns:
+        // 1. Compare the time taken by `flat_set` and `set` to build a set in
+        //    bulk from unsorted keys, to insert a batch of keys into a large
+        //    set, and to look up keys.
+        //
+        // Plan:
+        // 1. Time each operation for several sizes, with pseudo-random `int`
+        //    keys.  The optional second argument, if positive, scales the
+        //    number of lookups.
+        //
+        // Testing:
+        //   PERFORMANCE: `flat_set` VS. `set`
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPERFORMANCE: `flat_set` VS. `set`"
+                            "\n=================================\n");
+
+        const int scale = argc > 2 && atoi(argv[2]) > 0 ? atoi(argv[2]) : 1;
+
+        static const int SIZES[] = { 100, 10000, 1000000 };
+        const int        NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        printf("%9s %-8s %12s %12s %12s  (ns/key)\n",
+               "size", "set", "build", "batch", "find");
+
+        unsigned int state = 12345;
+        long         sink  = 0;
+
+        for (int si = 0; si < NUM_SIZES; ++si) {
+            const int SIZE    = SIZES[si];
+            const int BATCH   = SIZE / 10 + 1;
+            const int LOOKUPS = scale * 1000000;
+
+            IntVector keys, batch, probes;
+            for (int i = 0; i < SIZE; ++i) {
+                keys.push_back(static_cast<int>(nextRandom(&state)));
+            }
+            for (int i = 0; i < BATCH; ++i) {
+                batch.push_back(static_cast<int>(nextRandom(&state)));
+            }
+            for (int i = 0; i < LOOKUPS; ++i) {
+                probes.push_back(0 == i % 2
+                                 ? keys[nextRandom(&state) % SIZE]
+                                 : static_cast<int>(nextRandom(&state)));
+            }
+
+            bsls::Stopwatch timer;
+            double          flatTimes[3];
+            double          treeTimes[3];
+
+            {
+                timer.reset();
+                timer.start();
+                Obj mX(keys.begin(), keys.end());
+                timer.stop();
+                flatTimes[0] = timer.elapsedTime() * 1.0e9 / SIZE;
+
+                timer.reset();
+                timer.start();
+                mX.insert(batch.begin(), batch.end());
+                timer.stop();
+                flatTimes[1] = timer.elapsedTime() * 1.0e9 / BATCH;
+
+                timer.reset();
+                timer.start();
+                for (int i = 0; i < LOOKUPS; ++i) {
+                    sink += mX.count(probes[i]);
+                }
+                timer.stop();
+                flatTimes[2] = timer.elapsedTime() * 1.0e9 / LOOKUPS;
+            }
+            {
+                timer.reset();
+                timer.start();
+                Oracle mX(keys.begin(), keys.end());
+                timer.stop();
+                treeTimes[0] = timer.elapsedTime() * 1.0e9 / SIZE;
+
+                timer.reset();
+                timer.start();
+                mX.insert(batch.begin(), batch.end());
+                timer.stop();
+                treeTimes[1] = timer.elapsedTime() * 1.0e9 / BATCH;
+
+                timer.reset();
+                timer.start();
+                for (int i = 0; i < LOOKUPS; ++i) {
+                    sink += mX.count(probes[i]);
+                }
+                timer.stop();
+                treeTimes[2] = timer.elapsedTime() * 1.0e9 / LOOKUPS;
+            }
+
+            printf("%9d %-8s %12.1f %12.1f %12.1f\n",
+                   SIZE, "flat", flatTimes[0], flatTimes[1], flatTimes[2]);
+            printf("%9s %-8s %12.1f %12.1f %12.1f\n",
+                   "", "tree", treeTimes[0], treeTimes[1], treeTimes[2]);
+        }
+
+        if (veryVerbose) {
+            P(sink);
+        }
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(globalAllocator.numBlocksTotal(),
+            0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
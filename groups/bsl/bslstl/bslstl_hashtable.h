@@ -1982,18 +1982,6 @@ class HashTable {
 
     // PRIVATE ACCESSORS
 
-    /// Return the address of the first node in this hash table having a key
-    /// that compares equal (according to this hash-table's `comparator`) to
-    /// the specified `key`.  The behavior is undefined unless the specified
-    /// `hashValue` is the hash code for the `key` according to the `hasher`
-    /// functor of this hash table.  Note that this function's
-    /// implementation relies on the supplied `hashValue` rather than
-    /// recomputing it, eliminating some redundant computation for the
-    /// public methods.
-    template <class DEDUCED_KEY>
-    bslalg::BidirectionalLink *find(DEDUCED_KEY& key,
-                                    std::size_t  hashValue) const;
-
     /// Return the address of the bucket at the specified `bucketIndex` in
     /// bucket array of this hash table.  The behavior is undefined unless
     /// `bucketIndex < this->numBuckets()`.
@@ -2266,6 +2254,35 @@ class HashTable {
                                    bool                        *isInsertedFlag,
                                    bslmf::MovableRef<ValueType> value);
 
+    /// Insert the specified `value`, whose key has the specified
+    /// `hashValue`, into this hash-table if a key equivalent to that of
+    /// `value` does not already exist in this hash-table.  Return the
+    /// address of the (possibly newly inserted) element in this hash-table
+    /// whose key is equivalent to that of `value`, and load into the
+    /// specified `isInsertedFlag` `true` if `value` was inserted, and
+    /// `false` otherwise.  If `value` is passed as a movable reference, it
+    /// is left in a valid but unspecified state.  If this hash-table
+    /// contains more than one element with a matching key, return the first
+    /// such element (from the contiguous sequence of elements having a
+    /// matching key).  Additional buckets are allocated, as needed, to
+    /// preserve the invariant `loadFactor <= maxLoadFactor`.  If this
+    /// function tries to allocate a number of buckets larger than can be
+    /// represented by this hash-table's `SizeType`, a `std::length_error`
+    /// exception is thrown.  The behavior is undefined unless `hashValue` is
+    /// the hash code for the key of `value` according to the `hasher`
+    /// functor of this hash table.  This method requires that the
+    /// `ValueType` defined in the (template parameter) type `KEY_CONFIG` be
+    /// `copy-insertable` (or, respectively, `move-insertable`) into this
+    /// hash-table (see {Requirements on `KEY_CONFIG`}).
+    bslalg::BidirectionalLink *insertIfMissing(
+                                        bool             *isInsertedFlag,
+                                        const ValueType&  value,
+                                        std::size_t       hashValue);
+    bslalg::BidirectionalLink *insertIfMissing(
+                                   bool                        *isInsertedFlag,
+                                   bslmf::MovableRef<ValueType> value,
+                                   std::size_t                  hashValue);
+
     /// Insert into this hash-table a `ValueType` object created from the
     /// specified `value` if a key equivalent to that of such an object does
     /// not already exist in this hash-table.  Return the address of the
@@ -2753,6 +2770,18 @@ class HashTable {
     /// the same key).
     bslalg::BidirectionalLink *find(const KeyType& key) const;
 
+    /// Return the address of the first node in this hash table having a key
+    /// that compares equal (according to this hash-table's `comparator`) to
+    /// the specified `key`, and a null pointer value if no such link exists.
+    /// The behavior is undefined unless the specified `hashValue` is the
+    /// hash code for the `key` according to the `hasher` functor of this
+    /// hash table.  Note that this function relies on the supplied
+    /// `hashValue` rather than recomputing it, so that a key hashed once
+    /// can be looked up in several hash tables having the same hasher.
+    template <class DEDUCED_KEY>
+    bslalg::BidirectionalLink *find(DEDUCED_KEY& key,
+                                    std::size_t  hashValue) const;
+
     /// Return the address of the first node after any nodes holding a value
     /// having the same key as the specified `first` node (according to this
     /// hash-table's `comparator`), and a null pointer value if all nodes
@@ -2857,6 +2886,14 @@ class HashTable {
     /// Return the number of buckets contained in this hash table.
     SizeType numBuckets() const;
 
+    /// Issue a hint to the processor to fetch into its cache the bucket of
+    /// this hash table in which elements having the specified `hashValue`
+    /// are found.  This method has no observable effect.  Note that issuing
+    /// `prefetch` for a batch of keys before looking each of them up (using
+    /// the overloads of `find` and `insertIfMissing` taking a hash value)
+    /// allows the memory accesses of the lookups to overlap.
+    void prefetch(std::size_t hashValue) const;
+
     /// Return the number of elements this hash table can hold without
     /// requiring a rehash operation in order to respect the
     /// `maxLoadFactor`.
@@ -4231,21 +4268,6 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::removeAllImp()
 }
 
 // PRIVATE ACCESSORS
-template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
-template <class DEDUCED_KEY>
-inline
-bslalg::BidirectionalLink *
-HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
-                                                  DEDUCED_KEY& key,
-                                                  std::size_t  hashValue) const
-{
-    return bslalg::HashTableImpUtil::find<KEY_CONFIG>(
-                                                     d_anchor,
-                                                     key,
-                                                     d_parameters.comparator(),
-                                                     hashValue);
-}
-
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 inline
 bslalg::HashTableBucket *
@@ -4497,14 +4519,25 @@ bslalg::BidirectionalLink *
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
                                               bool             *isInsertedFlag,
                                               const ValueType&  value)
+{
+    return insertIfMissing(isInsertedFlag,
+                           value,
+                           this->d_parameters.hashCodeForKey(
+                                               KEY_CONFIG::extractKey(value)));
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
+                                        bool             *isInsertedFlag,
+                                        const ValueType&  value,
+                                        std::size_t       hashValue)
 {
     BSLS_ASSERT(isInsertedFlag);
 
-    size_t hashCode = this->d_parameters.hashCodeForKey(
-                                                KEY_CONFIG::extractKey(value));
     bslalg::BidirectionalLink *position = this->find(
                                                  KEY_CONFIG::extractKey(value),
-                                                 hashCode);
+                                                 hashValue);
 
     *isInsertedFlag = (!position);
 
@@ -4516,7 +4549,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
         position = d_parameters.nodeFactory().emplaceIntoNewNode(value);
         bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
                                                         position,
-                                                        hashCode);
+                                                        hashValue);
         ++d_size;
     }
 
@@ -4531,13 +4564,26 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
 {
     ValueType& lvalue = value;
 
-    BSLS_ASSERT(isInsertedFlag);
-
     size_t hashCode = this->d_parameters.hashCodeForKey(
                                                KEY_CONFIG::extractKey(lvalue));
+
+    return insertIfMissing(isInsertedFlag, MoveUtil::move(lvalue), hashCode);
+}
+
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
+                                   bool                        *isInsertedFlag,
+                                   bslmf::MovableRef<ValueType> value,
+                                   std::size_t                  hashValue)
+{
+    ValueType& lvalue = value;
+
+    BSLS_ASSERT(isInsertedFlag);
+
     bslalg::BidirectionalLink *position = this->find(
                                                 KEY_CONFIG::extractKey(lvalue),
-                                                hashCode);
+                                                hashValue);
 
     *isInsertedFlag = (!position);
 
@@ -4550,7 +4596,7 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::insertIfMissing(
                                                        MoveUtil::move(lvalue));
         bslalg::HashTableImpUtil::insertAtFrontOfBucket(&d_anchor,
                                                         position,
-                                                        hashCode);
+                                                        hashValue);
         ++d_size;
     }
 
@@ -4991,6 +5037,21 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
                                              d_parameters.hashCodeForKey(key));
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+template <class DEDUCED_KEY>
+inline
+bslalg::BidirectionalLink *
+HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::find(
+                                                  DEDUCED_KEY& key,
+                                                  std::size_t  hashValue) const
+{
+    return bslalg::HashTableImpUtil::find<KEY_CONFIG>(
+                                                     d_anchor,
+                                                     key,
+                                                     d_parameters.comparator(),
+                                                     hashValue);
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 bslalg::BidirectionalLink *
 HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::findEndOfRange(
@@ -5238,6 +5299,18 @@ HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::numBuckets() const
     return static_cast<SizeType>(d_anchor.bucketArraySize());
 }
 
+template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
+inline
+void HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::prefetch(
+                                                   std::size_t hashValue) const
+{
+    bsls::PerformanceHint::prefetchForReading(
+                    d_anchor.bucketArrayAddress()
+                  + bslalg::HashTableImpUtil::computeBucketIndex(
+                                                  hashValue,
+                                                  d_anchor.bucketArraySize()));
+}
+
 template <class KEY_CONFIG, class HASHER, class COMPARATOR, class ALLOCATOR>
 inline
 typename HashTable<KEY_CONFIG, HASHER, COMPARATOR, ALLOCATOR>::SizeType
@@ -0,0 +1,30 @@
+// bslstl_sortedtags.cpp                                              -*-C++-*-
+#include <bslstl_sortedtags.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bslstl_sortedtags_cpp, "$Id$ $CSID$")
+
+namespace bsl {
+
+#if !defined(BSLS_COMPILERFEATURES_SUPPORT_INLINE_VARIABLES)
+const sorted_unique_t     sorted_unique     = sorted_unique_t();
+const sorted_equivalent_t sorted_equivalent = sorted_equivalent_t();
+#endif
+
+}  // close namespace bsl
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
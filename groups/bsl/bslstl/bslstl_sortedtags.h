@@ -0,0 +1,144 @@
+// bslstl_sortedtags.h                                                -*-C++-*-
+#ifndef INCLUDED_BSLSTL_SORTEDTAGS
+#define INCLUDED_BSLSTL_SORTEDTAGS
+
+#include <bsls_ident.h>
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide tag types indicating that an input sequence is sorted.
+//
+//@CLASSES:
+//  bsl::sorted_unique_t: tag for a sorted sequence of unique keys
+//  bsl::sorted_equivalent_t: tag for a sorted sequence of keys
+//
+//@CANONICAL_HEADER: bsl_flat_map.h
+//
+//@SEE_ALSO: bslstl_flatmap, bslstl_flatset
+//
+//@DESCRIPTION: This component provides an implementation of the C++23
+// standard tag types `bsl::sorted_unique_t` and `bsl::sorted_equivalent_t`,
+// and the corresponding tag values `bsl::sorted_unique` and
+// `bsl::sorted_equivalent`.  The tags are passed to the constructors and the
+// range `insert` methods of the flat associative containers (`bsl::flat_map`,
+// `bsl::flat_multimap`, and `bsl::flat_set`) to assert that the supplied
+// input is already sorted with respect to the comparator of the container
+// (and, for `sorted_unique_t`, has no equivalent keys), so that the container
+// can skip sorting it.
+//
+///Usage
+///-----
+// This component is an implementation detail of the flat associative
+// containers, and the tags are used as arguments to their methods.  See the
+// usage examples of `bslstl_flatmap` and `bslstl_flatset`.
+
+#include <bslscm_version.h>
+
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+
+namespace bsl {
+
+                            // ======================
+                            // struct sorted_unique_t
+                            // ======================
+
+/// This trivial tag type is passed to the methods of the flat associative
+/// containers to indicate that an input sequence is sorted and free of
+/// equivalent keys.
+struct sorted_unique_t {
+
+    // CREATORS
+
+    /// Create a `sorted_unique_t` value.
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_DEFAULTED_FUNCTIONS)
+    explicit BSLS_KEYWORD_CONSTEXPR sorted_unique_t() = default;
+#else
+    explicit BSLS_KEYWORD_CONSTEXPR sorted_unique_t() BSLS_KEYWORD_NOEXCEPT;
+#endif
+};
+
+                          // ==========================
+                          // struct sorted_equivalent_t
+                          // ==========================
+
+/// This trivial tag type is passed to the methods of the flat associative
+/// containers to indicate that an input sequence is sorted (but may contain
+/// equivalent keys).
+struct sorted_equivalent_t {
+
+    // CREATORS
+
+    /// Create a `sorted_equivalent_t` value.
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_DEFAULTED_FUNCTIONS)
+    explicit BSLS_KEYWORD_CONSTEXPR sorted_equivalent_t() = default;
+#else
+    explicit BSLS_KEYWORD_CONSTEXPR sorted_equivalent_t()
+                                                         BSLS_KEYWORD_NOEXCEPT;
+#endif
+};
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                            // ----------------------
+                            // struct sorted_unique_t
+                            // ----------------------
+
+// CREATORS
+#if !defined(BSLS_COMPILERFEATURES_SUPPORT_DEFAULTED_FUNCTIONS)
+inline
+BSLS_KEYWORD_CONSTEXPR sorted_unique_t::sorted_unique_t() BSLS_KEYWORD_NOEXCEPT
+{
+}
+#endif
+
+                          // --------------------------
+                          // struct sorted_equivalent_t
+                          // --------------------------
+
+// CREATORS
+#if !defined(BSLS_COMPILERFEATURES_SUPPORT_DEFAULTED_FUNCTIONS)
+inline
+BSLS_KEYWORD_CONSTEXPR
+sorted_equivalent_t::sorted_equivalent_t() BSLS_KEYWORD_NOEXCEPT
+{
+}
+#endif
+
+/// Value of type `sorted_unique_t` used as an argument to functions that
+/// take a `sorted_unique_t` argument.
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_INLINE_VARIABLES)
+inline constexpr sorted_unique_t sorted_unique = sorted_unique_t();
+#else
+extern const sorted_unique_t sorted_unique;
+#endif
+
+/// Value of type `sorted_equivalent_t` used as an argument to functions
+/// that take a `sorted_equivalent_t` argument.
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_INLINE_VARIABLES)
+inline constexpr sorted_equivalent_t sorted_equivalent =
+                                                         sorted_equivalent_t();
+#else
+extern const sorted_equivalent_t sorted_equivalent;
+#endif
+
+}  // close namespace bsl
+
+#endif  // INCLUDED_BSLSTL_SORTEDTAGS
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
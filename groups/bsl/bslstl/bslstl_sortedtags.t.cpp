@@ -0,0 +1,242 @@
+// bslstl_sortedtags.t.cpp                                            -*-C++-*-
+#include <bslstl_sortedtags.h>
+
+#include <bslmf_issame.h>
+
+#include <bsls_assert.h>
+#include <bsls_bsltestutil.h>
+#include <bsls_compilerfeatures.h>
+#include <bsls_keyword.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace BloombergLP;
+
+//=============================================================================
+//                                  TEST PLAN
+//-----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test provides two empty tag types and a constant of
+// each.  We check that the constants have the expected types, that the types
+// are distinct, empty, and copyable, and that the default constructors are
+// usable in constant expressions where `constexpr` is supported.
+//-----------------------------------------------------------------------------
+// CLASSES
+// [ 2] sorted_unique_t
+// [ 2] sorted_equivalent_t
+//
+// CONSTANTS
+// [ 2] const sorted_unique_t sorted_unique;
+// [ 2] const sorted_equivalent_t sorted_equivalent;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+//-----------------------------------------------------------------------------
+
+// ============================================================================
+//                     STANDARD BSL ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        printf("Error " __FILE__ "(%d): %s    (failed)\n", line, message);
+        fflush(stdout);
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BSL TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLS_BSLTESTUTIL_ASSERT
+#define ASSERTV      BSLS_BSLTESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLS_BSLTESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLS_BSLTESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLS_BSLTESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLS_BSLTESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLS_BSLTESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLS_BSLTESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLS_BSLTESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLS_BSLTESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLS_BSLTESTUTIL_Q   // Quote identifier literally.
+#define P            BSLS_BSLTESTUTIL_P   // Print identifier and value.
+#define P_           BSLS_BSLTESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLS_BSLTESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLS_BSLTESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                       GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+/// Return 1, identifying an overload chosen for a sorted, unique sequence.
+int overload(bsl::sorted_unique_t)
+{
+    return 1;
+}
+
+/// Return 2, identifying an overload chosen for a sorted sequence.
+int overload(bsl::sorted_equivalent_t)
+{
+    return 2;
+}
+
+/// Return 0, identifying an overload chosen for an arbitrary sequence.
+int overload(int)
+{
+    return 0;
+}
+
+//=============================================================================
+//                              MAIN PROGRAM
+//-----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+    bool veryVeryVeryVerbose = argc > 5;
+
+    (void)veryVerbose;          // suppress warning
+    (void)veryVeryVerbose;      // suppress warning
+    (void)veryVeryVeryVerbose;  // suppress warning
+
+    printf("TEST " __FILE__ " CASE %d\n", test);
+
+    switch (test) { case 0:
+      case 2: {
+        // --------------------------------------------------------------------
+        // TAG TYPES AND CONSTANTS
+        //
+        // Concerns:
+        // 1. `sorted_unique` has type `const sorted_unique_t`, and
+        //    `sorted_equivalent` has type `const sorted_equivalent_t`.
+        //
+        // 2. The two tag types are distinct, so that overloads taking each of
+        //    them (and neither) are selected by the argument passed.
+        //
+        // 3. The tag types are empty, and can be default constructed and
+        //    copied.
+        //
+        // 4. Where `constexpr` is supported, the tags can be constructed in
+        //    a constant expression.
+        //
+        // Plan:
+        // 1. Use `bsl::is_same` on the declared types of the constants.
+        //    (C-1)
+        //
+        // 2. Call an overload set with each constant and with an `int`, and
+        //    verify the selected overload.  (C-2)
+        //
+        // 3. Check `sizeof` of each type, and create and copy objects of each
+        //    type.  (C-3)
+        //
+        // 4. Create `constexpr` objects of each type.  (C-4)
+        //
+        // Testing:
+        //   sorted_unique_t
+        //   sorted_equivalent_t
+        //   const sorted_unique_t sorted_unique;
+        //   const sorted_equivalent_t sorted_equivalent;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nTAG TYPES AND CONSTANTS"
+                            "\n=======================\n");
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_DECLTYPE)
+        ASSERT((bsl::is_same<const bsl::sorted_unique_t,
+                             decltype(bsl::sorted_unique)>::value));
+        ASSERT((bsl::is_same<const bsl::sorted_equivalent_t,
+                             decltype(bsl::sorted_equivalent)>::value));
+#endif
+
+        ASSERT(1 == overload(bsl::sorted_unique));
+        ASSERT(2 == overload(bsl::sorted_equivalent));
+        ASSERT(0 == overload(0));
+
+        ASSERT(1 == sizeof(bsl::sorted_unique_t));
+        ASSERT(1 == sizeof(bsl::sorted_equivalent_t));
+
+        bsl::sorted_unique_t           u;
+        bsl::sorted_equivalent_t       e;
+        const bsl::sorted_unique_t     uc(bsl::sorted_unique);
+        const bsl::sorted_equivalent_t ec(bsl::sorted_equivalent);
+
+        u = uc;
+        e = ec;
+
+        ASSERT(1 == overload(u));
+        ASSERT(2 == overload(e));
+
+#if defined(BSLS_COMPILERFEATURES_SUPPORT_CONSTEXPR)
+        constexpr bsl::sorted_unique_t     CU = bsl::sorted_unique_t();
+        constexpr bsl::sorted_equivalent_t CE = bsl::sorted_equivalent_t();
+
+        ASSERT(1 == overload(CU));
+        ASSERT(2 == overload(CE));
+#endif
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic
+        //   functionality.
+        //
+        // Concerns:
+        // 1. The tag constants can be passed by value.
+        //
+        // Plan:
+        // 1. Pass each constant to an overload set.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nBREATHING TEST"
+                            "\n==============\n");
+
+        ASSERT(1 == overload(bsl::sorted_unique));
+        ASSERT(2 == overload(bsl::sorted_equivalent));
+      } break;
+      default: {
+        fprintf(stderr, "WARNING: CASE `%d' NOT FOUND.\n", test);
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        fprintf(stderr, "Error, non-zero test status = %d.\n", testStatus);
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2026 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -1522,6 +1522,17 @@ class unordered_map {
     /// not removed.
     size_type erase(const key_type& key);
 
+    /// Remove from this unordered map the `value_type` object having the
+    /// specified `key`, whose hash value is the specified `hashCode`, if it
+    /// exists, and return 1; otherwise (there is no object with a key
+    /// equivalent to `key` in this unordered map) return 0 with no other
+    /// effect.  This method invalidates only iterators and references to
+    /// the removed element and previously saved values of the `end()`
+    /// iterator, and preserves the relative order of the elements not
+    /// removed.  The behavior is undefined unless
+    /// `hash_function()(key) == hashCode`.
+    size_type erase(const key_type& key, std::size_t hashCode);
+
     /// Remove from this unordered map the `value_type` objects starting at
     /// the specified `first` position up to, but not including, the
     /// specified `last` position, and return `last`.  This method
@@ -1556,6 +1567,16 @@ class unordered_map {
     /// (`end`) otherwise.
     iterator find(const key_type& key);
 
+    /// Return an iterator providing modifiable access to the `value_type`
+    /// object in this unordered map with a key equivalent to the specified
+    /// `key`, whose hash value is the specified `hashCode`, if such an entry
+    /// exists, and the past-the-end iterator (`end`) otherwise.  The
+    /// behavior is undefined unless `hash_function()(key) == hashCode`.
+    /// Note that this method does not invoke the hasher, so that a key
+    /// hashed once can be looked up in several containers having the same
+    /// hasher.
+    iterator find(const key_type& key, std::size_t hashCode);
+
     /// Insert the specified `value` into this unordered map if the key (the
     /// `first` element) of the object referred to by `value` does not
     /// already exist in this unordered map; otherwise, this method has no
@@ -1571,6 +1592,22 @@ class unordered_map {
     /// `value_type`}).
     pair<iterator, bool> insert(const value_type& value);
 
+    /// Insert the specified `value`, whose key has the specified
+    /// `hashCode`, into this unordered map if the key (the `first` element)
+    /// of the object referred to by `value` does not already exist in this
+    /// unordered map; otherwise, this method has no effect.  Return a `pair`
+    /// whose `first` member is an iterator referring to the (possibly newly
+    /// inserted) `value_type` object in this unordered map whose key is
+    /// equivalent to that of the object to be inserted, and whose `second`
+    /// member is `true` if a new value was inserted, and `false` if a value
+    /// having an equivalent key was already present.  The behavior is
+    /// undefined unless `hash_function()(value.first) == hashCode`.  Note
+    /// that this method requires that the (template parameter) types `KEY`
+    /// and `VALUE` both be `copy-insertable` into this unordered map (see
+    /// {Requirements on `value_type`}).
+    pair<iterator, bool> insert(const value_type& value,
+                                std::size_t       hashCode);
+
 #if defined(BSLS_PLATFORM_CMP_SUN) && BSLS_PLATFORM_CMP_VERSION < 0x5130
     template <class ALT_VALUE_TYPE>
     pair<iterator, bool>
@@ -2230,6 +2267,14 @@ class unordered_map {
     /// iterator (`end`) otherwise.
     const_iterator find(const key_type& key) const;
 
+    /// Return an iterator providing non-modifiable access to the
+    /// `value_type` object in this unordered map with a key equivalent to
+    /// the specified `key`, whose hash value is the specified `hashCode`, if
+    /// such an entry exists, and the past-the-end iterator (`end`)
+    /// otherwise.  The behavior is undefined unless
+    /// `hash_function()(key) == hashCode`.
+    const_iterator find(const key_type& key, std::size_t hashCode) const;
+
     /// Return (a copy of) the allocator used for memory allocation by this
     /// unordered map.
     allocator_type get_allocator() const BSLS_KEYWORD_NOEXCEPT;
@@ -2258,6 +2303,14 @@ class unordered_map {
     /// those buckets (see `rehash`).
     float max_load_factor() const BSLS_KEYWORD_NOEXCEPT;
 
+    /// Issue a hint to the processor to fetch into its cache the bucket of
+    /// this unordered map in which a key having the specified `hashCode`
+    /// would be found.  This method has no observable effect.  Note that
+    /// issuing `prefetch` for a batch of keys before looking each of them
+    /// up (with the overloads of `find`, `insert`, and `erase` taking a hash
+    /// code) allows the memory accesses of the lookups to overlap.
+    void prefetch(std::size_t hashCode) const;
+
     /// Return the number of elements in this unordered map.
     size_type size() const BSLS_KEYWORD_NOEXCEPT;
 
@@ -3080,6 +3133,24 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::erase(const key_type& key)
     }
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::size_type
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::erase(
+                                                      const key_type& key,
+                                                      std::size_t     hashCode)
+{
+    BSLS_ASSERT_SAFE(hashCode == d_impl.hasher()(key));
+
+    HashTableLink *target = d_impl.find(key, hashCode);
+    if (target) {
+        d_impl.remove(target);
+        return 1;                                                     // RETURN
+    }
+    else {
+        return 0;                                                     // RETURN
+    }
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
 unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::erase(const_iterator first,
@@ -3123,6 +3194,18 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(const key_type& key)
     return iterator(d_impl.find(key));
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(
+                                                      const key_type& key,
+                                                      std::size_t     hashCode)
+{
+    BSLS_ASSERT_SAFE(hashCode == d_impl.hasher()(key));
+
+    return iterator(d_impl.find(key, hashCode));
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
@@ -3139,6 +3222,27 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::insert(
     return ResultType(iterator(result), isInsertedFlag);
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+pair<typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator,
+     bool>
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::insert(
+                                                    const value_type& value,
+                                                    std::size_t       hashCode)
+{
+    BSLS_ASSERT_SAFE(hashCode == d_impl.hasher()(value.first));
+
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.insertIfMissing(&isInsertedFlag,
+                                                   value,
+                                                   hashCode);
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 typename unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::iterator
@@ -3575,6 +3679,19 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(
     return const_iterator(d_impl.find(key));
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename
+       unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::const_iterator
+unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::find(
+                                                const key_type& key,
+                                                std::size_t     hashCode) const
+{
+    BSLS_ASSERT_SAFE(hashCode == d_impl.hasher()(key));
+
+    return const_iterator(d_impl.find(key, hashCode));
+}
+
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
 ALLOCATOR
@@ -3616,6 +3733,14 @@ unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::max_load_factor() const
     return d_impl.maxLoadFactor();
 }
 
+template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void unordered_map<KEY, VALUE, HASH, EQUAL, ALLOCATOR>::prefetch(
+                                                    std::size_t hashCode) const
+{
+    d_impl.prefetch(hashCode);
+}
+
 
 template <class KEY, class VALUE, class HASH, class EQUAL, class ALLOCATOR>
 inline
@@ -163,6 +163,7 @@ using bsl::pair;
 // [18] Iter erase(CIter);
 // [18] Iter erase(Iter);
 // [18] size_type erase(const KEY&);
+// [46] size_type erase(const key_type&, size_t);
 // [18] Iter erase(CIter, CIter);
 // [15] pair<Iter, bool> insert(const Pair&);
 // [15] Iter insert(CIter, const Pair&);
@@ -171,6 +172,7 @@ using bsl::pair;
 // [29] pair<iterator, bool> insert(ALT_PAIR&&);
 // [29] iterator insert(CIter, Pair&&);
 // [29] iterator insert(CIter, ALT_PAIR&&);
+// [46] pair<iterator, bool> insert(const value_type&, size_t);
 // [33] void insert(initializer_list<Pair>);
 // [ 8] void swap(Obj&);
 //
@@ -188,6 +190,9 @@ using bsl::pair;
 // [13] pair<const_iter, const_iter> equal_range(const KEY&) const;
 // [ 4] iterator find(const KEY& key);
 // [ 4] const_iterator find(const KEY& key) const;
+// [46] iterator find(const key_type&, size_t);
+// [46] const_iterator find(const key_type&, size_t) const;
+// [46] void prefetch(size_t) const;
 //
 // non-local iterators:
 // [14] iterator begin();
@@ -236,7 +241,7 @@ using bsl::pair;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [41] CLASS TEMPLATE ARGUMENT DEDUCTION
-// [45] USAGE EXAMPLE
+// [47] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 // [ 3] int  ggg(Obj *, const char *, bool verbose = true);
@@ -10592,7 +10597,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 45: {
+      case 47: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -10612,6 +10617,114 @@ int main(int argc, char *argv[])
                             "\n=============\n");
         usage();
       } break;
+      case 46: {
+        // --------------------------------------------------------------------
+        // PRECOMPUTED HASH CODES
+        //
+        // Concerns:
+        // 1. The overloads of `find`, `insert`, and `erase` taking a hash code
+        //    behave as the corresponding overloads taking only a key (or
+        //    value), when supplied the hash code of the key.
+        //
+        // 2. `prefetch` has no observable effect.
+        //
+        // 3. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Insert a sequence of keys into an unordered map using the
+        //    hash-taking `insert`, inserting each key twice, and verify the
+        //    return values and the size of the container.  (C-1)
+        //
+        // 2. For each key, and for some absent keys, invoke `prefetch`, and
+        //    verify that the hash-taking `find` (both `const` and non-`const`)
+        //    and `erase` agree with the key-only overloads.  (C-1,2)
+        //
+        // 3. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for a hash code that is not that of the key.  (C-3)
+        //
+        // Testing:
+        //   iterator find(const key_type&, size_t);
+        //   const_iterator find(const key_type&, size_t) const;
+        //   pair<iterator, bool> insert(const value_type&, size_t);
+        //   size_type erase(const key_type&, size_t);
+        //   void prefetch(size_t) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPRECOMPUTED HASH CODES"
+                            "\n======================\n");
+
+        typedef bsl::unordered_map<int, int> Obj;
+
+        const int NUM_KEYS = 100;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            const int         KEY  = 2 * i;
+            const std::size_t HASH = X.hash_function()(KEY);
+
+            X.prefetch(HASH);
+
+            ASSERTV(i, X.end() == X.find(KEY, HASH));
+
+            const Obj::value_type VALUE(KEY, KEY);
+
+            bsl::pair<Obj::iterator, bool> rv = mX.insert(VALUE, HASH);
+            ASSERTV(i, rv.second);
+            ASSERTV(i, KEY == rv.first->first);
+
+            rv = mX.insert(Obj::value_type(KEY, -1), HASH);
+            ASSERTV(i, !rv.second);
+            ASSERTV(i, KEY == rv.first->first);
+
+            ASSERTV(i, static_cast<Obj::size_type>(i + 1) == X.size());
+        }
+
+        for (int key = -1; key < 2 * NUM_KEYS + 1; ++key) {
+            const std::size_t HASH = X.hash_function()(key);
+
+            X.prefetch(HASH);
+
+            Obj::const_iterator cit = X.find(key, HASH);
+            Obj::iterator        it = mX.find(key, HASH);
+
+            ASSERTV(key, X.find(key)  == cit);
+            ASSERTV(key, mX.find(key) == it);
+            if (it != mX.end()) {
+                ASSERTV(key, key == it->first);
+            }
+        }
+
+        for (int key = -1; key < 2 * NUM_KEYS + 1; ++key) {
+            const std::size_t     HASH     = X.hash_function()(key);
+            const Obj::size_type  EXPECTED = X.count(key);
+            const Obj::size_type  SIZE     = X.size();
+
+            ASSERTV(key, EXPECTED == mX.erase(key, HASH));
+            ASSERTV(key, 0        == mX.erase(key, HASH));
+            ASSERTV(key, SIZE - EXPECTED == X.size());
+        }
+        ASSERT(0 == X.size());
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const int         KEY  = 1;
+            const std::size_t GOOD = X.hash_function()(KEY);
+            const std::size_t BAD  = GOOD + 1;
+
+            ASSERT_SAFE_PASS(X.find(KEY, GOOD));
+            ASSERT_SAFE_FAIL(X.find(KEY, BAD));
+            ASSERT_SAFE_PASS(mX.find(KEY, GOOD));
+            ASSERT_SAFE_FAIL(mX.find(KEY, BAD));
+            ASSERT_SAFE_FAIL(mX.erase(KEY, BAD));
+            ASSERT_SAFE_PASS(mX.erase(KEY, GOOD));
+        }
+      } break;
+      case 45: // falls through
       case 44: // falls through
       case 43: // falls through
       case 42: // falls through
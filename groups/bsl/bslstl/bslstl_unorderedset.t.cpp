@@ -142,6 +142,7 @@ using bsls::NameOf;
 //
 // modifiers:
 //*[15] bsl::pair<iterator, bool> insert(const value_type& value);
+// [39] pair<iterator, bool> insert(const value_type&, size_t);
 // [30] bsl::pair<iterator, bool> insert(value_type&& value);
 //*[15] iterator insert(const_iterator position, const value_type& value);
 // [30] iterator insert(const_iterator position, value_type&& value);
@@ -153,6 +154,7 @@ using bsls::NameOf;
 //
 //*[18] iterator erase(const_iterator position);
 //*[18] size_type erase(const key_type& key);
+// [39] size_type erase(const key_type&, size_t);
 //*[18] iterator erase(const_iterator first, const_iterator last);
 //*[ 8] void swap(unordered_set& other);
 //*[ 2] void clear();
@@ -167,6 +169,9 @@ using bsls::NameOf;
 //*[13] bool contains(const LOOKUP_KEY& key);
 //*[13] iterator find(const key_type& key);
 //*[13] const_iterator find(const key_type& key) const;
+// [39] iterator find(const key_type&, size_t);
+// [39] const_iterator find(const key_type&, size_t) const;
+// [39] void prefetch(size_t) const;
 //*[13] size_type count(const key_type& key) const;
 //*[13] bsl::pair<iterator, iterator> equal_range(const key_type& key);
 //*[13] bsl::pair<const_iter, const_iter> equal_range(const key_type&) const;
@@ -201,7 +206,7 @@ using bsls::NameOf;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] default construction (only)
-// [39] USAGE EXAMPLE
+// [40] USAGE EXAMPLE
 //
 // TEST APPARATUS: GENERATOR FUNCTIONS
 //*[ 3] int ggg(unordered_set<K,H,E,A> *object, const char *spec, int verbose);
@@ -4718,7 +4723,7 @@ int main(int argc, char *argv[])
     ASSERT(0 == bslma::Default::setDefaultAllocator(&defaultAllocator));
 
     switch (test) { case 0:
-      case 39: {
+      case 40: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -4873,6 +4878,111 @@ if (verbose) {
 // See the material in {`bslstl_unorderedmap`|Example 2}.
 
       } break;
+      case 39: {
+        // --------------------------------------------------------------------
+        // PRECOMPUTED HASH CODES
+        //
+        // Concerns:
+        // 1. The overloads of `find`, `insert`, and `erase` taking a hash code
+        //    behave as the corresponding overloads taking only a key (or
+        //    value), when supplied the hash code of the key.
+        //
+        // 2. `prefetch` has no observable effect.
+        //
+        // 3. QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        // 1. Insert a sequence of keys into an unordered set using the
+        //    hash-taking `insert`, inserting each key twice, and verify the
+        //    return values and the size of the container.  (C-1)
+        //
+        // 2. For each key, and for some absent keys, invoke `prefetch`, and
+        //    verify that the hash-taking `find` (both `const` and non-`const`)
+        //    and `erase` agree with the key-only overloads.  (C-1,2)
+        //
+        // 3. Verify that, in appropriate build modes, defensive checks are
+        //    triggered for a hash code that is not that of the key.  (C-3)
+        //
+        // Testing:
+        //   iterator find(const key_type&, size_t);
+        //   const_iterator find(const key_type&, size_t) const;
+        //   pair<iterator, bool> insert(const value_type&, size_t);
+        //   size_type erase(const key_type&, size_t);
+        //   void prefetch(size_t) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) printf("\nPRECOMPUTED HASH CODES"
+                            "\n======================\n");
+
+        typedef bsl::unordered_set<int> Obj;
+
+        const int NUM_KEYS = 100;
+
+        bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+        Obj mX(&oa);  const Obj& X = mX;
+
+        for (int i = 0; i < NUM_KEYS; ++i) {
+            const int         KEY  = 2 * i;
+            const std::size_t HASH = X.hash_function()(KEY);
+
+            X.prefetch(HASH);
+
+            ASSERTV(i, X.end() == X.find(KEY, HASH));
+
+            bsl::pair<Obj::iterator, bool> rv = mX.insert(KEY, HASH);
+            ASSERTV(i, rv.second);
+            ASSERTV(i, KEY == *rv.first);
+
+            rv = mX.insert(KEY, HASH);
+            ASSERTV(i, !rv.second);
+            ASSERTV(i, KEY == *rv.first);
+
+            ASSERTV(i, static_cast<Obj::size_type>(i + 1) == X.size());
+        }
+
+        for (int key = -1; key < 2 * NUM_KEYS + 1; ++key) {
+            const std::size_t HASH = X.hash_function()(key);
+
+            X.prefetch(HASH);
+
+            Obj::const_iterator cit = X.find(key, HASH);
+            Obj::iterator        it = mX.find(key, HASH);
+
+            ASSERTV(key, X.find(key)  == cit);
+            ASSERTV(key, mX.find(key) == it);
+            if (it != mX.end()) {
+                ASSERTV(key, key == *it);
+            }
+        }
+
+        for (int key = -1; key < 2 * NUM_KEYS + 1; ++key) {
+            const std::size_t     HASH     = X.hash_function()(key);
+            const Obj::size_type  EXPECTED = X.count(key);
+            const Obj::size_type  SIZE     = X.size();
+
+            ASSERTV(key, EXPECTED == mX.erase(key, HASH));
+            ASSERTV(key, 0        == mX.erase(key, HASH));
+            ASSERTV(key, SIZE - EXPECTED == X.size());
+        }
+        ASSERT(0 == X.size());
+
+        if (verbose) printf("\nNegative Testing.\n");
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            const int         KEY  = 1;
+            const std::size_t GOOD = X.hash_function()(KEY);
+            const std::size_t BAD  = GOOD + 1;
+
+            ASSERT_SAFE_PASS(X.find(KEY, GOOD));
+            ASSERT_SAFE_FAIL(X.find(KEY, BAD));
+            ASSERT_SAFE_PASS(mX.find(KEY, GOOD));
+            ASSERT_SAFE_FAIL(mX.find(KEY, BAD));
+            ASSERT_SAFE_FAIL(mX.erase(KEY, BAD));
+            ASSERT_SAFE_PASS(mX.erase(KEY, GOOD));
+        }
+      } break;
       case 38: // falls through
       case 37: // falls through
       case 36: // falls through
@@ -401,6 +401,19 @@ class unordered_set {
     /// `KEY` be `copy-insertable` (see {Requirements on `KEY`}).
     pair<iterator, bool> insert(const value_type& value);
 
+    /// Insert the specified `value`, whose hash value is the specified
+    /// `hashCode`, into this set if an equivalent key does not already
+    /// exist in this set; otherwise, this method has no effect.  Return a
+    /// pair whose `first` member is an iterator referring to the (possibly
+    /// newly inserted) `value_type` object in this set that is equivalent
+    /// to `value`, and whose `second` member is `true` if a new value was
+    /// inserted, and `false` if the key was already present.  The behavior
+    /// is undefined unless `hash_function()(value) == hashCode`.  This
+    /// method requires that the (template parameter) type `KEY` be
+    /// `copy-insertable` (see {Requirements on `KEY`}).
+    pair<iterator, bool> insert(const value_type& value,
+                                std::size_t       hashCode);
+
     /// Insert the specified `value` into this set if a key equivalent to
     /// `value` does not already exist in this set; otherwise, if a key
     /// equivalent to `value` already exists in this set, this method has no
@@ -861,6 +874,17 @@ class unordered_set {
     /// the elements not removed.
     size_type erase(const key_type& key);
 
+    /// Remove from this set the `value_type` object that is equivalent to
+    /// the specified `key`, whose hash value is the specified `hashCode`,
+    /// if such an entry exists, and return 1; otherwise, if there is no
+    /// `value_type` object that is equivalent to `key`, return 0 with no
+    /// other effect.  This method invalidates only iterators and references
+    /// to the removed element and previously saved values of the `end()`
+    /// iterator, and preserves the relative order of the elements not
+    /// removed.  The behavior is undefined unless
+    /// `hash_function()(key) == hashCode`.
+    size_type erase(const key_type& key, std::size_t hashCode);
+
     /// Remove from this set the `value_type` objects starting at the
     /// specified `first` position up to, but including the specified `last`
     /// position, and return `last`.  This method invalidates only iterators
@@ -918,6 +942,16 @@ class unordered_set {
     /// iterator otherwise.
     iterator find(const key_type& key);
 
+    /// Return an iterator providing modifiable access to the `value_type`
+    /// object in this unordered set that is equivalent to the specified
+    /// `key`, whose hash value is the specified `hashCode`, if such an entry
+    /// exists, and the past-the-end (`end`) iterator otherwise.  The
+    /// behavior is undefined unless `hash_function()(key) == hashCode`.
+    /// Note that this method does not invoke the hasher, so that a key
+    /// hashed once can be looked up in several containers having the same
+    /// hasher.
+    iterator find(const key_type& key, std::size_t hashCode);
+
     /// Return a pair of iterators providing modifiable access to the
     /// sequence of `value_type` objects in this unordered set that are
     /// equivalent to the specified `key`, where the first iterator is
@@ -1068,6 +1102,14 @@ class unordered_set {
     /// (`end`) iterator otherwise.
     const_iterator find(const key_type& key) const;
 
+    /// Return an iterator providing non-modifiable access to the
+    /// `value_type` object in this unordered set that is equivalent to the
+    /// specified `key`, whose hash value is the specified `hashCode`, if
+    /// such an entry exists, and the past-the-end (`end`) iterator
+    /// otherwise.  The behavior is undefined unless
+    /// `hash_function()(key) == hashCode`.
+    const_iterator find(const key_type& key, std::size_t hashCode) const;
+
     /// Return the number of `value_type` objects within this unordered set
     /// that are equivalent to the specified `key`.  The behavior is
     /// undefined unless `key` is equivalent to at most one element in this
@@ -1201,6 +1243,14 @@ class unordered_set {
     /// number of buckets and rehash the elements of the container into
     /// those buckets the (see rehash).
     float max_load_factor() const BSLS_KEYWORD_NOEXCEPT;
+
+    /// Issue a hint to the processor to fetch into its cache the bucket of
+    /// this set in which a key having the specified `hashCode` would be
+    /// found.  This method has no observable effect.  Note that issuing
+    /// `prefetch` for a batch of keys before looking each of them up (with
+    /// the overloads of `find`, `insert`, and `erase` taking a hash code)
+    /// allows the memory accesses of the lookups to overlap.
+    void prefetch(std::size_t hashCode) const;
 };
 
 #ifdef BSLS_COMPILERFEATURES_SUPPORT_CTAD
@@ -2597,6 +2647,22 @@ unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::erase(const key_type& key)
     }
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::erase(const key_type& key,
+                                                  std::size_t     hashCode)
+{
+    BSLS_ASSERT_SAFE(hashCode == d_impl.hasher()(key));
+
+    if (HashTableLink *target = d_impl.find(key, hashCode)) {
+        d_impl.remove(target);
+        return 1;                                                     // RETURN
+    }
+    else {
+        return 0;                                                     // RETURN
+    }
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 inline
 typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
@@ -2632,6 +2698,17 @@ unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::find(const key_type& key)
     return iterator(d_impl.find(key));
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::find(const key_type& key,
+                                                 std::size_t     hashCode)
+{
+    BSLS_ASSERT_SAFE(hashCode == d_impl.hasher()(key));
+
+    return iterator(d_impl.find(key, hashCode));
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 inline
 bsl::pair<typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator, bool>
@@ -2646,6 +2723,25 @@ unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::insert(const value_type& value)
     return ResultType(iterator(result), isInsertedFlag);
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+bsl::pair<typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator, bool>
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::insert(const value_type& value,
+                                                   std::size_t       hashCode)
+{
+    BSLS_ASSERT_SAFE(hashCode == d_impl.hasher()(value));
+
+    typedef bsl::pair<iterator, bool> ResultType;
+
+    bool isInsertedFlag = false;
+
+    HashTableLink *result = d_impl.insertIfMissing(&isInsertedFlag,
+                                                   value,
+                                                   hashCode);
+
+    return ResultType(iterator(result), isInsertedFlag);
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 inline
 bsl::pair<typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::iterator, bool>
@@ -2859,6 +2955,18 @@ unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::find(const key_type& key) const
     return const_iterator(d_impl.find(key));
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::const_iterator
+unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::find(
+                                                const key_type& key,
+                                                std::size_t     hashCode) const
+{
+    BSLS_ASSERT_SAFE(hashCode == d_impl.hasher()(key));
+
+    return const_iterator(d_impl.find(key, hashCode));
+}
+
 template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
 inline
 typename unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::size_type
@@ -2980,6 +3088,14 @@ float unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::max_load_factor() const
     return d_impl.maxLoadFactor();
 }
 
+template <class KEY, class HASH, class EQUAL, class ALLOCATOR>
+inline
+void unordered_set<KEY, HASH, EQUAL, ALLOCATOR>::prefetch(
+                                                    std::size_t hashCode) const
+{
+    d_impl.prefetch(hashCode);
+}
+
 }  // close namespace bsl
 
 // FREE OPERATORS